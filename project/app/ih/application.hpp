@@ -26,7 +26,9 @@ class Application {
 
   auto terminate() noexcept -> void;
 
-  static auto create_venue_simulation_platform() -> std::unique_ptr<Platform>;
+  // Hosts the venues listed in the configuration in a single process,
+  // or the venue of the process when no venues are listed
+  static auto create_simulation_platform() -> std::unique_ptr<Platform>;
 
   std::unique_ptr<Platform> platform_;
 };
@@ -53,6 +53,10 @@ class FixAcceptor final : public middleware::TradingReplyReceiver {
     fix::send_reply(confirmation, acceptor_);
   }
 
+  auto process(protocol::OrderMassCancellationReport report) -> void override {
+    fix::send_reply(report, acceptor_);
+  }
+
   auto process(protocol::MarketDataReject reject) -> void override {
     fix::send_reply(reject, acceptor_);
   }
@@ -58,6 +58,12 @@ class Generator final : public middleware::TradingReplyReceiver,
     generator::accept_reply(confirmation, generator_);
   }
 
+  auto process(protocol::OrderMassCancellationReport report) -> void override {
+    // Orders cancelled by a mass cancellation are confirmed one by one,
+    // the generator tracks them by the cancellation confirmations.
+    log::debug("generator ignores {}", report);
+  }
+
   auto process(protocol::MarketDataReject reject) -> void override {
     // The generator does not send MarketDataRequest messages.
     // Thus, it is not expected to receive MarketDataReject messages.
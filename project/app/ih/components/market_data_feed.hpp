@@ -0,0 +1,113 @@
+#ifndef SIMULATOR_APP_IH_COMPONENTS_MARKET_DATA_FEED_HPP_
+#define SIMULATOR_APP_IH_COMPONENTS_MARKET_DATA_FEED_HPP_
+
+#include "log/logging.hpp"
+#include "middleware/channels/trading_reply_channel.hpp"
+#include "publisher/lifetime.hpp"
+#include "publisher/transport.hpp"
+
+namespace simulator {
+
+class MarketDataFeed final : public middleware::TradingReplyReceiver {
+ public:
+  explicit MarketDataFeed(const mdfeed::PublisherSettings& settings)
+      : publisher_(mdfeed::create_publisher(settings)) {}
+
+  auto launch() -> void { mdfeed::start_publisher(publisher_); }
+
+  auto terminate() -> void { mdfeed::stop_publisher(publisher_); }
+
+  auto process(protocol::BusinessMessageReject reject) -> void override {
+    // The market data feed sends MarketDataRequest messages only.
+    log::warn(
+        "unexpected BusinessMessageReject message received by the market "
+        "data feed, ignoring {}",
+        reject);
+  }
+
+  auto process(protocol::ExecutionReport report) -> void override {
+    log::warn(
+        "unexpected ExecutionReport message received by the market data "
+        "feed, ignoring {}",
+        report);
+  }
+
+  auto process(protocol::OrderPlacementReject reject) -> void override {
+    log::warn(
+        "unexpected OrderPlacementReject message received by the market data "
+        "feed, ignoring {}",
+        reject);
+  }
+
+  auto process(protocol::OrderPlacementConfirmation confirmation)
+      -> void override {
+    log::warn(
+        "unexpected OrderPlacementConfirmation message received by the "
+        "market data feed, ignoring {}",
+        confirmation);
+  }
+
+  auto process(protocol::OrderModificationReject reject) -> void override {
+    log::warn(
+        "unexpected OrderModificationReject message received by the market "
+        "data feed, ignoring {}",
+        reject);
+  }
+
+  auto process(protocol::OrderModificationConfirmation confirmation)
+      -> void override {
+    log::warn(
+        "unexpected OrderModificationConfirmation message received by the "
+        "market data feed, ignoring {}",
+        confirmation);
+  }
+
+  auto process(protocol::OrderCancellationReject reject) -> void override {
+    log::warn(
+        "unexpected OrderCancellationReject message received by the market "
+        "data feed, ignoring {}",
+        reject);
+  }
+
+  auto process(protocol::OrderCancellationConfirmation confirmation)
+      -> void override {
+    log::warn(
+        "unexpected OrderCancellationConfirmation message received by the "
+        "market data feed, ignoring {}",
+        confirmation);
+  }
+
+  auto process(protocol::OrderMassCancellationReport report) -> void override {
+    log::warn(
+        "unexpected OrderMassCancellationReport message received by the "
+        "market data feed, ignoring {}",
+        report);
+  }
+
+  auto process(protocol::MarketDataReject reject) -> void override {
+    mdfeed::accept_reply(reject, publisher_);
+  }
+
+  auto process(protocol::MarketDataSnapshot snapshot) -> void override {
+    mdfeed::accept_reply(snapshot, publisher_);
+  }
+
+  auto process(protocol::MarketDataUpdate update) -> void override {
+    mdfeed::accept_reply(update, publisher_);
+  }
+
+  auto process(protocol::SecurityStatus status) -> void override {
+    // The market data feed does not send SecurityStatusRequest messages.
+    log::warn(
+        "unexpected SecurityStatus message received by the market data feed, "
+        "ignoring {}",
+        status);
+  }
+
+ private:
+  mdfeed::Publisher publisher_;
+};
+
+}  // namespace simulator
+
+#endif  // SIMULATOR_APP_IH_COMPONENTS_MARKET_DATA_FEED_HPP_
@@ -17,6 +17,13 @@ class TradingEngine final : public middleware::TradingAdminRequestReceiver,
       const data_layer::database::Context& database)
       : trading_system_(trading_system::create_trading_system(database)) {}
 
+  // Runs engines of the trading system on threads shared by the venues
+  // hosted by the process
+  TradingEngine(const data_layer::database::Context& database,
+                trading_system::SharedExecutor& executor)
+      : trading_system_(
+            trading_system::create_trading_system(database, executor)) {}
+
   auto launch() -> void {
     trading_system::launch_trading_system(trading_system_);
   }
@@ -37,6 +44,15 @@ class TradingEngine final : public middleware::TradingAdminRequestReceiver,
     trading_system::process(std::move(request), trading_system_);
   }
 
+  auto process(protocol::OrderMassCancellationRequest request)
+      -> void override {
+    trading_system::process(std::move(request), trading_system_);
+  }
+
+  auto process(protocol::MassQuoteRequest request) -> void override {
+    trading_system::process(std::move(request), trading_system_);
+  }
+
   auto process(protocol::MarketDataRequest request) -> void override {
     trading_system::process(std::move(request), trading_system_);
   }
@@ -70,6 +86,16 @@ class TradingEngine final : public middleware::TradingAdminRequestReceiver,
     trading_system::process(request, reply, trading_system_);
   }
 
+  auto process(const protocol::EngineLatencyRequest& request,
+               protocol::EngineLatencyReply& reply) -> void override {
+    trading_system::process(request, reply, trading_system_);
+  }
+
+  auto process(const protocol::StartupProgressRequest& request,
+               protocol::StartupProgressReply& reply) -> void override {
+    trading_system::process(request, reply, trading_system_);
+  }
+
   auto on_event(const protocol::SessionTerminatedEvent& event)
       -> void override {
     trading_system::react_on(event, trading_system_);
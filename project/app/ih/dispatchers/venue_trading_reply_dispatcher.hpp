@@ -6,6 +6,8 @@
 #include "core/tools/overload.hpp"
 #include "ih/components/fix_acceptor.hpp"
 #include "ih/components/generator.hpp"
+#include "ih/components/market_data_feed.hpp"
+#include "log/logging.hpp"
 #include "protocol/types/session.hpp"
 
 namespace simulator {
@@ -15,9 +17,11 @@ struct VenueTradingReplyDispatcher final
  public:
   VenueTradingReplyDispatcher(
       std::shared_ptr<Generator> generator,
-      std::shared_ptr<FixAcceptor> fix_acceptor) noexcept
+      std::shared_ptr<FixAcceptor> fix_acceptor,
+      std::shared_ptr<MarketDataFeed> market_data_feed) noexcept
       : generator_(std::move(generator)),
-        fix_acceptor_(std::move(fix_acceptor)) {}
+        fix_acceptor_(std::move(fix_acceptor)),
+        market_data_feed_(std::move(market_data_feed)) {}
 
   auto process(protocol::BusinessMessageReject reject) -> void override {
     dispatch_message(std::move(reject));
@@ -54,6 +58,10 @@ struct VenueTradingReplyDispatcher final
     dispatch_message(std::move(confirmation));
   }
 
+  auto process(protocol::OrderMassCancellationReport report) -> void override {
+    dispatch_message(std::move(report));
+  }
+
   auto process(protocol::MarketDataReject reject) -> void override {
     dispatch_message(std::move(reject));
   }
@@ -79,6 +87,16 @@ struct VenueTradingReplyDispatcher final
         },
         [&](const protocol::generator::Session& /*session*/) {
           generator_->process(std::move(message));
+        },
+        [&](const protocol::mdfeed::Session& /*session*/) {
+          if (market_data_feed_) [[likely]] {
+            market_data_feed_->process(std::move(message));
+          } else {
+            log::warn(
+                "market data feed is disabled, dropping a reply message "
+                "addressed to it: {}",
+                message);
+          }
         });
 
     std::visit(by_session_type_dispatcher, message.session.value);
@@ -86,6 +104,8 @@ struct VenueTradingReplyDispatcher final
 
   std::shared_ptr<Generator> generator_;
   std::shared_ptr<FixAcceptor> fix_acceptor_;
+  // Null when the market data feed is disabled in the configuration
+  std::shared_ptr<MarketDataFeed> market_data_feed_;
 };
 
 }  // namespace simulator
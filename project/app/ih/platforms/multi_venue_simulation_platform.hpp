@@ -0,0 +1,56 @@
+#ifndef SIMULATOR_APP_IH_PLATFORMS_MULTI_VENUE_SIMULATION_PLATFORM_HPP_
+#define SIMULATOR_APP_IH_PLATFORMS_MULTI_VENUE_SIMULATION_PLATFORM_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "cfg/api/cfg.hpp"
+#include "data_layer/api/database/context.hpp"
+#include "ih/components/fix_acceptor.hpp"
+#include "ih/components/generator.hpp"
+#include "ih/components/http_server.hpp"
+#include "ih/components/trading_engine.hpp"
+#include "ih/platforms/platform.hpp"
+#include "trading_system/trading_system.hpp"
+
+namespace simulator {
+
+// Hosts several venues in a single process. Each venue has its own
+// trading system, generator and FIX acceptor, which are bound to the
+// venue with cfg::VenueScope. The trading system thread pool,
+// the logger and the HTTP server are shared by the venues.
+class MultiVenueSimulationPlatform final : public Platform {
+ public:
+  explicit MultiVenueSimulationPlatform(
+      const data_layer::database::Context& database);
+
+  auto launch() -> void override;
+
+  auto terminate() -> void override;
+
+ private:
+  struct HostedVenue {
+    const cfg::HostedVenueConfiguration* config = nullptr;
+    std::shared_ptr<TradingEngine> trading_engine;
+    std::shared_ptr<FixAcceptor> fix_acceptor;
+    std::shared_ptr<Generator> generator;
+    // Heap growth over the venue creation and trading system start-up
+    std::size_t memory_bytes = 0;
+  };
+
+  auto create_venue(const data_layer::database::Context& database,
+                    const cfg::HostedVenueConfiguration& config)
+      -> HostedVenue;
+
+  auto log_resource_usage() const -> void;
+
+  // Declared first to outlive the trading systems running on it
+  trading_system::SharedExecutor executor_;
+  std::vector<HostedVenue> venues_;
+  std::shared_ptr<HttpServer> http_server_;
+};
+
+}  // namespace simulator
+
+#endif  // SIMULATOR_APP_IH_PLATFORMS_MULTI_VENUE_SIMULATION_PLATFORM_HPP_
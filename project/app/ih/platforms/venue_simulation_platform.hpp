@@ -7,6 +7,7 @@
 #include "ih/components/fix_acceptor.hpp"
 #include "ih/components/generator.hpp"
 #include "ih/components/http_server.hpp"
+#include "ih/components/market_data_feed.hpp"
 #include "ih/components/trading_engine.hpp"
 #include "ih/platforms/platform.hpp"
 
@@ -26,6 +27,7 @@ class VenueSimulationPlatform final : public Platform {
   std::shared_ptr<FixAcceptor> fix_acceptor_;
   std::shared_ptr<Generator> generator_;
   std::shared_ptr<HttpServer> http_server_;
+  std::shared_ptr<MarketDataFeed> market_data_feed_;
 };
 
 }  // namespace simulator
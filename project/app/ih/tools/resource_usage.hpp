@@ -0,0 +1,30 @@
+#ifndef SIMULATOR_APP_IH_TOOLS_RESOURCE_USAGE_HPP_
+#define SIMULATOR_APP_IH_TOOLS_RESOURCE_USAGE_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+namespace simulator {
+
+struct ResourceUsage {
+  std::chrono::nanoseconds cpu_time{0};
+  std::size_t memory_bytes = 0;
+};
+
+// Returns CPU time (user and system) of all the process threads
+// and the resident set size of the process
+[[nodiscard]]
+auto read_process_resource_usage() -> ResourceUsage;
+
+// Returns the number of bytes allocated on the heap and not yet released,
+// a difference of two readings is the heap growth between them
+[[nodiscard]]
+auto read_heap_usage() -> std::size_t;
+
+auto log_resource_usage(std::string_view consumer, const ResourceUsage& usage)
+    -> void;
+
+}  // namespace simulator
+
+#endif  // SIMULATOR_APP_IH_TOOLS_RESOURCE_USAGE_HPP_
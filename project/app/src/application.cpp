@@ -3,6 +3,7 @@
 #include "cfg/api/cfg.hpp"
 #include "core/version.hpp"
 #include "data_layer/api/data_access_layer.hpp"
+#include "ih/platforms/multi_venue_simulation_platform.hpp"
 #include "ih/platforms/venue_simulation_platform.hpp"
 #include "log/logging.hpp"
 
@@ -26,7 +27,7 @@ auto Application::start() -> Application {
 
 Application::Application() {
   log::debug("creating simulator application");
-  platform_ = create_venue_simulation_platform();
+  platform_ = create_simulation_platform();
   log::info("simulator application created");
 }
 
@@ -48,9 +49,15 @@ auto Application::terminate() noexcept -> void try {
   log::err("unknown error occurred while terminating simulator application");
 }
 
-auto Application::create_venue_simulation_platform()
-    -> std::unique_ptr<Platform> {
-  return std::make_unique<VenueSimulationPlatform>(setup_database_connection());
+auto Application::create_simulation_platform() -> std::unique_ptr<Platform> {
+  if (cfg::hosted_venues().empty()) {
+    return std::make_unique<VenueSimulationPlatform>(
+        setup_database_connection());
+  }
+
+  log::info("hosting {} venues in the process", cfg::hosted_venues().size());
+  return std::make_unique<MultiVenueSimulationPlatform>(
+      setup_database_connection());
 }
 
 }  // namespace simulator
\ No newline at end of file
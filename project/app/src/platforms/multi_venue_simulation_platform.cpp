@@ -0,0 +1,123 @@
+#include "ih/platforms/multi_venue_simulation_platform.hpp"
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "cfg/api/cfg.hpp"
+#include "cfg/api/venue_scope.hpp"
+#include "ih/components/fix_acceptor.hpp"
+#include "ih/components/generator.hpp"
+#include "ih/components/http_server.hpp"
+#include "ih/components/trading_engine.hpp"
+#include "ih/dispatchers/venue_trading_reply_dispatcher.hpp"
+#include "ih/tools/resource_usage.hpp"
+#include "log/logging.hpp"
+#include "middleware/channels/generator_admin_channel.hpp"
+#include "middleware/channels/trading_admin_channel.hpp"
+#include "middleware/channels/trading_reply_channel.hpp"
+#include "middleware/channels/trading_request_channel.hpp"
+#include "middleware/channels/trading_session_event_channel.hpp"
+
+namespace simulator {
+
+MultiVenueSimulationPlatform::MultiVenueSimulationPlatform(
+    const data_layer::database::Context& database)
+    : executor_(trading_system::create_shared_executor()) {
+  log::debug("creating multi-venue simulation platform");
+  if (cfg::market_data_feed().enabled) {
+    log::warn(
+        "market data feed is not supported when hosting multiple venues, "
+        "ignoring its configuration");
+  }
+
+  venues_.reserve(cfg::hosted_venues().size());
+  for (const auto& config : cfg::hosted_venues()) {
+    venues_.push_back(create_venue(database, config));
+  }
+  // Created once all the venues channels are bound, so that
+  // the server never routes a request to an unbound channel
+  http_server_ = std::make_shared<HttpServer>(database);
+  log::debug("multi-venue simulation platform has been created");
+}
+
+auto MultiVenueSimulationPlatform::launch() -> void {
+  log::debug("launching multi-venue simulation platform");
+  http_server_->launch();
+  for (const auto& venue : venues_) {
+    const cfg::VenueScope scope{venue.config};
+    venue.fix_acceptor->launch();
+    venue.generator->launch();
+  }
+  log_resource_usage();
+  log::info("multi-venue simulation platform has been launched");
+}
+
+auto MultiVenueSimulationPlatform::terminate() -> void {
+  log::debug("terminating multi-venue simulation platform");
+  for (const auto& venue : venues_) {
+    const cfg::VenueScope scope{venue.config};
+    venue.trading_engine->terminate();
+    venue.fix_acceptor->terminate();
+    venue.generator->terminate();
+  }
+  http_server_->terminate();
+  log_resource_usage();
+
+  for (const auto& venue : venues_) {
+    const cfg::VenueScope scope{venue.config};
+    middleware::release_trading_admin_channel();
+    middleware::release_trading_reply_channel();
+    middleware::release_trading_request_channel();
+    middleware::release_trading_session_event_channel();
+    middleware::release_generator_admin_channel();
+  }
+
+  venues_.clear();
+  http_server_.reset();
+  log::info("multi-venue simulation platform has been terminated");
+}
+
+auto MultiVenueSimulationPlatform::create_venue(
+    const data_layer::database::Context& database,
+    const cfg::HostedVenueConfiguration& config) -> HostedVenue {
+  const cfg::VenueScope scope{&config};
+  log::debug("creating hosted venue {}", config.venue.name);
+  const std::size_t heap_before = read_heap_usage();
+
+  HostedVenue venue{.config = &config};
+  venue.trading_engine = std::make_shared<TradingEngine>(database, executor_);
+  venue.fix_acceptor =
+      std::make_shared<FixAcceptor>(cfg::quickfix().session_settings);
+  venue.generator = std::make_shared<Generator>(database);
+
+  middleware::bind_trading_admin_channel(venue.trading_engine);
+  middleware::bind_trading_reply_channel(
+      std::make_shared<VenueTradingReplyDispatcher>(
+          venue.generator, venue.fix_acceptor, nullptr));
+  middleware::bind_trading_request_channel(venue.trading_engine);
+  middleware::bind_trading_session_event_channel(venue.trading_engine);
+  middleware::bind_generator_admin_channel(venue.generator);
+
+  // Engines are constructed and recovered before the next venue is
+  // created, so that the heap growth is attributed to this venue only
+  venue.trading_engine->launch();
+  const std::size_t heap_after = read_heap_usage();
+  venue.memory_bytes = heap_after > heap_before ? heap_after - heap_before : 0;
+
+  log::info("hosted venue {} has been created", config.venue.name);
+  return venue;
+}
+
+auto MultiVenueSimulationPlatform::log_resource_usage() const -> void {
+  simulator::log_resource_usage("process", read_process_resource_usage());
+  for (const auto& venue : venues_) {
+    simulator::log_resource_usage(
+        fmt::format("venue {}", venue.config->venue.name),
+        ResourceUsage{.cpu_time = cfg::venue_cpu_time(*venue.config),
+                      .memory_bytes = venue.memory_bytes});
+  }
+}
+
+}  // namespace simulator
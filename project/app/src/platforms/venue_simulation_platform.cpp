@@ -1,13 +1,20 @@
 #include "ih/platforms/venue_simulation_platform.hpp"
 
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
 
 #include "cfg/api/cfg.hpp"
 #include "ih/components/fix_acceptor.hpp"
 #include "ih/components/generator.hpp"
 #include "ih/components/http_server.hpp"
+#include "ih/components/market_data_feed.hpp"
 #include "ih/components/trading_engine.hpp"
 #include "ih/dispatchers/venue_trading_reply_dispatcher.hpp"
+#include "ih/tools/resource_usage.hpp"
 #include "log/logging.hpp"
 #include "middleware/channels/generator_admin_channel.hpp"
 #include "middleware/channels/trading_admin_channel.hpp"
@@ -22,6 +29,26 @@ auto get_fix_configuration_path() -> std::filesystem::path {
   return cfg::quickfix().session_settings;
 }
 
+auto create_market_data_feed() -> std::shared_ptr<MarketDataFeed> {
+  const auto& config = cfg::market_data_feed();
+  if (!config.enabled) {
+    log::debug("market data feed is disabled in the configuration");
+    return nullptr;
+  }
+
+  return std::make_shared<MarketDataFeed>(mdfeed::PublisherSettings{
+      .feed_address = config.address,
+      .feed_port = static_cast<std::uint16_t>(config.port),
+      .request_port = static_cast<std::uint16_t>(config.request_port),
+      .replay_depth = static_cast<std::size_t>(config.replay_depth)});
+}
+
+// The process hosts a single venue, which consumes all the process resources
+auto log_resource_usage() -> void {
+  simulator::log_resource_usage(fmt::format("venue {}", cfg::venue().name),
+                                read_process_resource_usage());
+}
+
 }  // namespace
 
 VenueSimulationPlatform::VenueSimulationPlatform(
@@ -31,10 +58,12 @@ VenueSimulationPlatform::VenueSimulationPlatform(
   fix_acceptor_ = std::make_shared<FixAcceptor>(get_fix_configuration_path());
   generator_ = std::make_shared<Generator>(database);
   http_server_ = std::make_shared<HttpServer>(database);
+  market_data_feed_ = create_market_data_feed();
 
   middleware::bind_trading_admin_channel(trading_engine_);
   middleware::bind_trading_reply_channel(
-      std::make_shared<VenueTradingReplyDispatcher>(generator_, fix_acceptor_));
+      std::make_shared<VenueTradingReplyDispatcher>(
+          generator_, fix_acceptor_, market_data_feed_));
   middleware::bind_trading_request_channel(trading_engine_);
   middleware::bind_trading_session_event_channel(trading_engine_);
   middleware::bind_generator_admin_channel(generator_);
@@ -43,10 +72,16 @@ VenueSimulationPlatform::VenueSimulationPlatform(
 
 auto VenueSimulationPlatform::launch() -> void {
   log::debug("launching venue simulation platform");
+  // The HTTP server is launched first to report the trading engine
+  // start-up progress, FIX sessions are accepted once engines are ready
+  http_server_->launch();
   trading_engine_->launch();
   fix_acceptor_->launch();
   generator_->launch();
-  http_server_->launch();
+  if (market_data_feed_) {
+    market_data_feed_->launch();
+  }
+  log_resource_usage();
   log::info("venue simulation platform has been launched");
 }
 
@@ -56,6 +91,10 @@ auto VenueSimulationPlatform::terminate() -> void {
   fix_acceptor_->terminate();
   generator_->terminate();
   http_server_->terminate();
+  if (market_data_feed_) {
+    market_data_feed_->terminate();
+  }
+  log_resource_usage();
 
   middleware::release_trading_admin_channel();
   middleware::release_trading_reply_channel();
@@ -67,6 +106,7 @@ auto VenueSimulationPlatform::terminate() -> void {
   fix_acceptor_.reset();
   generator_.reset();
   http_server_.reset();
+  market_data_feed_.reset();
   log::info("venue simulation platform has been terminated");
 }
 
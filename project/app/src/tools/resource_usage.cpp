@@ -0,0 +1,67 @@
+#include "ih/tools/resource_usage.hpp"
+
+#include <malloc.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <string_view>
+
+#include "log/logging.hpp"
+
+namespace simulator {
+namespace {
+
+auto to_duration(const timeval& time) -> std::chrono::nanoseconds {
+  return std::chrono::seconds{time.tv_sec} +
+         std::chrono::microseconds{time.tv_usec};
+}
+
+auto read_resident_memory() -> std::size_t {
+  // The second field of statm is the resident set size in pages
+  std::ifstream statm{"/proc/self/statm"};
+  std::size_t total_pages = 0;
+  std::size_t resident_pages = 0;
+  if (!(statm >> total_pages >> resident_pages)) {
+    return 0;
+  }
+
+  const long page_size = sysconf(_SC_PAGESIZE);
+  return page_size > 0 ? resident_pages * static_cast<std::size_t>(page_size)
+                       : 0;
+}
+
+}  // namespace
+
+auto read_process_resource_usage() -> ResourceUsage {
+  ResourceUsage usage;
+
+  rusage process_usage{};
+  if (getrusage(RUSAGE_SELF, &process_usage) == 0) {
+    usage.cpu_time = to_duration(process_usage.ru_utime) +
+                     to_duration(process_usage.ru_stime);
+  }
+  usage.memory_bytes = read_resident_memory();
+
+  return usage;
+}
+
+auto read_heap_usage() -> std::size_t {
+  const auto info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+auto log_resource_usage(std::string_view consumer, const ResourceUsage& usage)
+    -> void {
+  constexpr std::size_t bytes_in_kib = 1024;
+  log::info("{} resource usage: cpu time {} ms, memory {} KiB",
+            consumer,
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                usage.cpu_time)
+                .count(),
+            usage.memory_bytes / bytes_in_kib);
+}
+
+}  // namespace simulator
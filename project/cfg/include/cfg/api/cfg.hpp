@@ -1,7 +1,10 @@
 #ifndef SIMULATOR_CFG_API_CFG_HPP_
 #define SIMULATOR_CFG_API_CFG_HPP_
 
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "core/tools/time.hpp"
 
@@ -14,6 +17,10 @@ struct DbConfiguration {
   std::string host;
   std::string port;
   std::string venue;
+
+  // Connection pool settings, a non-positive value keeps the default
+  int pool_size = 0;
+  int pool_idle_timeout = 0;
 };
 
 struct QuickFIXConfiguration {
@@ -41,6 +48,28 @@ struct HttpConfiguration {
 
   PeerHostResolution peer_resolution = PeerHostResolution::Localhost;
   bool check_api_version = true;
+  // Time limits (milliseconds) to connect to another instance and to read
+  // its response to a redirected request
+  int redirect_connect_timeout = 1000;
+  int redirect_read_timeout = 5000;
+};
+
+// A venue hosted along with other venues by a single process
+struct HostedVenueConfiguration {
+  VenueConfiguration venue;
+  QuickFIXConfiguration quickfix;
+  // Position of the venue among the hosted venues, starting from 1
+  std::size_t index = 0;
+};
+
+constexpr std::size_t MaxHostedVenues = 64;
+
+struct MarketDataFeedConfiguration {
+  bool enabled = false;
+  std::string address = "127.0.0.1";
+  int port = 0;
+  int request_port = 0;
+  int replay_depth = 256;
 };
 
 auto init(const std::string& path) -> void;
@@ -49,16 +78,28 @@ auto init() -> void;
 
 auto db() -> const DbConfiguration&;
 
+// Return configuration of the venue the calling thread is bound to
+// with a VenueScope, configuration of the process venue otherwise
 auto quickfix() -> const QuickFIXConfiguration&;
 
 auto venue() -> const VenueConfiguration&;
 
+// Venues hosted by the process,
+// empty when the process simulates the single venue
+auto hosted_venues() -> const std::vector<HostedVenueConfiguration>&;
+
+// Returns nullptr when the venue is not hosted by the process
+auto find_hosted_venue(std::string_view name)
+    -> const HostedVenueConfiguration*;
+
 auto log() -> const LogConfiguration&;
 
 auto generator() -> const GeneratorConfiguration&;
 
 auto http() -> const HttpConfiguration&;
 
+auto market_data_feed() -> const MarketDataFeedConfiguration&;
+
 }  // namespace simulator::cfg
 
 #endif  // SIMULATOR_CFG_API_CFG_HPP_
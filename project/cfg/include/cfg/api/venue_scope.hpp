@@ -0,0 +1,87 @@
+#ifndef SIMULATOR_CFG_API_VENUE_SCOPE_HPP_
+#define SIMULATOR_CFG_API_VENUE_SCOPE_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "cfg/api/cfg.hpp"
+
+namespace simulator::cfg {
+
+// Binds the calling thread to a hosted venue for the scope lifetime:
+// `venue()` and `quickfix()` return the hosted venue configuration and
+// middleware channels route messages to the venue components.
+//
+// A scope bound to nullptr unbinds the thread, so that a single-venue
+// process is not affected. Scopes nest, a scope destruction rebinds
+// the thread to the venue of the enclosing scope.
+class VenueScope {
+ public:
+  explicit VenueScope(const HostedVenueConfiguration* venue) noexcept;
+
+  VenueScope(const VenueScope&) = delete;
+  VenueScope(VenueScope&&) = delete;
+  ~VenueScope() noexcept;
+
+  auto operator=(const VenueScope&) -> VenueScope& = delete;
+  auto operator=(VenueScope&&) -> VenueScope& = delete;
+
+ private:
+  const HostedVenueConfiguration* enclosing_;
+};
+
+// A VenueScope binding the whole lifetime of a thread to a venue,
+// the thread CPU time is charged to the venue
+class VenueThreadScope {
+ public:
+  explicit VenueThreadScope(const HostedVenueConfiguration* venue) noexcept;
+
+  VenueThreadScope(const VenueThreadScope&) = delete;
+  VenueThreadScope(VenueThreadScope&&) = delete;
+  ~VenueThreadScope() noexcept;
+
+  auto operator=(const VenueThreadScope&) -> VenueThreadScope& = delete;
+  auto operator=(VenueThreadScope&&) -> VenueThreadScope& = delete;
+
+ private:
+  VenueScope scope_;
+  const HostedVenueConfiguration* venue_;
+};
+
+// Returns nullptr when the calling thread is not bound to a venue
+[[nodiscard]]
+auto current_venue() noexcept -> const HostedVenueConfiguration*;
+
+// Returns the index of the venue the calling thread is bound to,
+// zero when the thread is not bound to a venue
+[[nodiscard]]
+auto current_venue_index() noexcept -> std::size_t;
+
+// Charges time spent on the venue tasks by threads shared between
+// venues, does nothing when the venue is nullptr
+auto charge_venue(const HostedVenueConfiguration* venue,
+                  std::chrono::nanoseconds time) noexcept -> void;
+
+// Returns CPU time of the threads bound to the venue with VenueThreadScope
+// along with the time charged to the venue
+[[nodiscard]]
+auto venue_cpu_time(const HostedVenueConfiguration& venue)
+    -> std::chrono::nanoseconds;
+
+// Wraps a thread function, so that a thread running it is bound to
+// the venue of the thread calling `bind_venue_scope`
+template <typename F>
+[[nodiscard]]
+auto bind_venue_scope(F function) {
+  return [venue = current_venue(),
+          function = std::move(function)](auto&&... args) mutable {
+    const VenueThreadScope scope{venue};
+    return std::invoke(function, std::forward<decltype(args)>(args)...);
+  };
+}
+
+}  // namespace simulator::cfg
+
+#endif  // SIMULATOR_CFG_API_VENUE_SCOPE_HPP_
@@ -4,14 +4,17 @@
 #include <fmt/format.h>
 #include <tinyxml2.h>
 
+#include <algorithm>
 #include <exception>
 #include <iostream>
 #include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <string_view>
+#include <vector>
 
 #include "api/cfg.hpp"
+#include "api/venue_scope.hpp"
 #include "core/tools/time.hpp"
 
 namespace simulator::cfg {
@@ -83,13 +86,33 @@ void init(const std::string& path) { ConfigurationImpl::instance(false, path); }
 auto db() -> const DbConfiguration& { return ConfigurationImpl::instance().db; }
 
 auto quickfix() -> const QuickFIXConfiguration& {
+  if (const auto* hosted_venue = current_venue()) {
+    return hosted_venue->quickfix;
+  }
   return ConfigurationImpl::instance().quickfix;
 }
 
 auto venue() -> const VenueConfiguration& {
+  if (const auto* hosted_venue = current_venue()) {
+    return hosted_venue->venue;
+  }
   return ConfigurationImpl::instance().venue;
 }
 
+auto hosted_venues() -> const std::vector<HostedVenueConfiguration>& {
+  return ConfigurationImpl::instance().hosted_venues;
+}
+
+auto find_hosted_venue(std::string_view name)
+    -> const HostedVenueConfiguration* {
+  const auto& venues = hosted_venues();
+  const auto venue =
+      std::find_if(venues.begin(), venues.end(), [name](const auto& hosted) {
+        return hosted.venue.name == name;
+      });
+  return venue != venues.end() ? &*venue : nullptr;
+}
+
 auto log() -> const LogConfiguration& {
   return ConfigurationImpl::instance().log;
 }
@@ -102,6 +125,10 @@ auto http() -> const HttpConfiguration& {
   return ConfigurationImpl::instance().http;
 }
 
+auto market_data_feed() -> const MarketDataFeedConfiguration& {
+  return ConfigurationImpl::instance().market_data_feed;
+}
+
 auto ConfigurationImpl::instance(bool mock, const std::string& path)
     -> ConfigurationImpl& {
   std::call_once(config_init_flag_, [mock, &path]() -> void {
@@ -142,6 +169,9 @@ ConfigurationImpl::ConfigurationImpl(const std::string& path) {
   auto* venue_element = root->FirstChildElement("venue");
   init_venue_configuration(venue_element);
 
+  auto* hosted_venues_element = root->FirstChildElement("hostedVenues");
+  init_hosted_venues_configuration(hosted_venues_element);
+
   auto* logger_element = root->FirstChildElement("logger");
   init_log_configuration(logger_element);
 
@@ -150,6 +180,9 @@ ConfigurationImpl::ConfigurationImpl(const std::string& path) {
 
   auto* http_element = root->FirstChildElement("http");
   init_http_configuration(http_element);
+
+  auto* market_data_feed_element = root->FirstChildElement("marketDataFeed");
+  init_market_data_feed_configuration(market_data_feed_element);
 }
 
 auto ConfigurationImpl::init_db_configuration(
@@ -163,6 +196,13 @@ auto ConfigurationImpl::init_db_configuration(
   set_config(element, db.password, "password");
   set_config(element, db.host, "host", false);
   set_config(element, db.port, "port");
+
+  set_config(element, db.pool_size, "poolSize", false);
+  set_config(element, db.pool_idle_timeout, "poolIdleTimeout", false);
+  if (db.pool_size < 0 || db.pool_idle_timeout < 0) {
+    throw std::runtime_error(
+        "database poolSize and poolIdleTimeout must not be negative");
+  }
 }
 
 auto ConfigurationImpl::init_quickfix_configuration(
@@ -185,6 +225,38 @@ auto ConfigurationImpl::init_venue_configuration(
       core::get_current_tz_time(core::TzClock{date::current_zone()->name()});
 }
 
+auto ConfigurationImpl::init_hosted_venues_configuration(
+    const tinyxml2::XMLElement* element) -> void {
+  if (element == nullptr) {
+    return;
+  }
+
+  for (const auto* venue_element = element->FirstChildElement("venue");
+       venue_element != nullptr;
+       venue_element = venue_element->NextSiblingElement("venue")) {
+    auto& hosted = hosted_venues.emplace_back();
+    set_config(venue_element, hosted.venue.name, "name");
+    set_config(venue_element, hosted.quickfix.session_settings, "config");
+    hosted.venue.start_time = venue.start_time;
+    hosted.index = hosted_venues.size();
+  }
+
+  if (hosted_venues.size() > MaxHostedVenues) {
+    throw std::runtime_error(
+        fmt::format("at most {} venues can be hosted", MaxHostedVenues));
+  }
+  const bool process_venue_hosted =
+      std::any_of(hosted_venues.begin(),
+                  hosted_venues.end(),
+                  [&](const auto& hosted) {
+                    return hosted.venue.name == venue.name;
+                  });
+  if (!hosted_venues.empty() && !process_venue_hosted) {
+    throw std::runtime_error(
+        "the venue of the instance must be one of the hosted venues");
+  }
+}
+
 auto ConfigurationImpl::init_log_configuration(
     const tinyxml2::XMLElement* element) -> void {
   if (element == nullptr) {
@@ -234,6 +306,46 @@ auto ConfigurationImpl::init_http_configuration(
   }
 
   set_config(element, http.check_api_version, "checkApiVersion", false);
+
+  set_config(element,
+             http.redirect_connect_timeout,
+             "redirectConnectTimeout",
+             false);
+  set_config(element, http.redirect_read_timeout, "redirectReadTimeout", false);
+  if (http.redirect_connect_timeout <= 0 || http.redirect_read_timeout <= 0) {
+    throw std::runtime_error(
+        "http redirectConnectTimeout and redirectReadTimeout must be positive");
+  }
+}
+
+auto ConfigurationImpl::init_market_data_feed_configuration(
+    const tinyxml2::XMLElement* element) -> void {
+  if (element == nullptr) {
+    return;
+  }
+
+  set_config(element, market_data_feed.enabled, "enabled", false);
+  if (!market_data_feed.enabled) {
+    return;
+  }
+
+  set_config(element, market_data_feed.address, "address", false);
+  set_config(element, market_data_feed.port, "port");
+  set_config(element, market_data_feed.request_port, "requestPort");
+
+  constexpr int max_port = 65535;
+  if (market_data_feed.port <= 0 || market_data_feed.port > max_port ||
+      market_data_feed.request_port <= 0 ||
+      market_data_feed.request_port > max_port) {
+    throw std::runtime_error(
+        "market data feed port and requestPort must be valid port numbers");
+  }
+
+  set_config(element, market_data_feed.replay_depth, "replayDepth", false);
+  if (market_data_feed.replay_depth < 0) {
+    throw std::runtime_error(
+        "market data feed replayDepth must not be negative");
+  }
 }
 
 std::unique_ptr<ConfigurationImpl> ConfigurationImpl::configuration_instance_{
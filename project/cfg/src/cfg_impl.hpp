@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cfg/api/cfg.hpp"
 
@@ -27,12 +28,16 @@ class ConfigurationImpl {
 
   VenueConfiguration venue;
 
+  std::vector<HostedVenueConfiguration> hosted_venues;
+
   LogConfiguration log;
 
   GeneratorConfiguration generator;
 
   HttpConfiguration http;
 
+  MarketDataFeedConfiguration market_data_feed;
+
  private:
   auto init_db_configuration(const tinyxml2::XMLElement* element) -> void;
 
@@ -40,6 +45,9 @@ class ConfigurationImpl {
 
   auto init_venue_configuration(const tinyxml2::XMLElement* element) -> void;
 
+  auto init_hosted_venues_configuration(const tinyxml2::XMLElement* element)
+      -> void;
+
   auto init_log_configuration(const tinyxml2::XMLElement* element) -> void;
 
   auto init_generator_configuration(const tinyxml2::XMLElement* element)
@@ -47,6 +55,9 @@ class ConfigurationImpl {
 
   auto init_http_configuration(const tinyxml2::XMLElement* element) -> void;
 
+  auto init_market_data_feed_configuration(
+      const tinyxml2::XMLElement* element) -> void;
+
   static std::unique_ptr<ConfigurationImpl> configuration_instance_;
   static std::once_flag config_init_flag_;
 };
@@ -0,0 +1,118 @@
+#include "api/venue_scope.hpp"
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+#include "api/cfg.hpp"
+
+namespace simulator::cfg {
+namespace {
+
+// NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+thread_local const HostedVenueConfiguration* bound_venue = nullptr;
+
+struct VenueUsage {
+  std::mutex mutex;
+  // CPU clocks of the alive threads bound to the venue
+  std::vector<clockid_t> threads;
+  // CPU time of the finished threads and the time charged to the venue
+  std::atomic<std::int64_t> charged_ns{0};
+};
+
+auto usage_of(const HostedVenueConfiguration& venue) -> VenueUsage& {
+  static std::array<VenueUsage, MaxHostedVenues + 1> usages;
+  return usages[std::min(venue.index, MaxHostedVenues)];
+}
+
+auto read_cpu_time(clockid_t clock) noexcept -> std::chrono::nanoseconds {
+  timespec time{};
+  if (clock_gettime(clock, &time) != 0) {
+    return std::chrono::nanoseconds::zero();
+  }
+  return std::chrono::seconds{time.tv_sec} +
+         std::chrono::nanoseconds{time.tv_nsec};
+}
+
+}  // namespace
+
+VenueScope::VenueScope(const HostedVenueConfiguration* venue) noexcept
+    : enclosing_(bound_venue) {
+  bound_venue = venue;
+}
+
+VenueScope::~VenueScope() noexcept { bound_venue = enclosing_; }
+
+VenueThreadScope::VenueThreadScope(
+    const HostedVenueConfiguration* venue) noexcept
+    : scope_(venue), venue_(venue) {
+  if (venue_ == nullptr) {
+    return;
+  }
+
+  clockid_t clock{};
+  if (pthread_getcpuclockid(pthread_self(), &clock) == 0) {
+    auto& usage = usage_of(*venue_);
+    const std::lock_guard lock{usage.mutex};
+    usage.threads.push_back(clock);
+  }
+}
+
+VenueThreadScope::~VenueThreadScope() noexcept {
+  if (venue_ == nullptr) {
+    return;
+  }
+
+  clockid_t clock{};
+  if (pthread_getcpuclockid(pthread_self(), &clock) != 0) {
+    return;
+  }
+
+  auto& usage = usage_of(*venue_);
+  const std::lock_guard lock{usage.mutex};
+  const auto thread =
+      std::find(usage.threads.begin(), usage.threads.end(), clock);
+  if (thread != usage.threads.end()) {
+    usage.threads.erase(thread);
+    usage.charged_ns.fetch_add(read_cpu_time(CLOCK_THREAD_CPUTIME_ID).count(),
+                               std::memory_order_relaxed);
+  }
+}
+
+auto current_venue() noexcept -> const HostedVenueConfiguration* {
+  return bound_venue;
+}
+
+auto current_venue_index() noexcept -> std::size_t {
+  return bound_venue != nullptr ? bound_venue->index : 0;
+}
+
+auto charge_venue(const HostedVenueConfiguration* venue,
+                  std::chrono::nanoseconds time) noexcept -> void {
+  if (venue != nullptr) {
+    usage_of(*venue).charged_ns.fetch_add(time.count(),
+                                          std::memory_order_relaxed);
+  }
+}
+
+auto venue_cpu_time(const HostedVenueConfiguration& venue)
+    -> std::chrono::nanoseconds {
+  auto& usage = usage_of(venue);
+  const std::lock_guard lock{usage.mutex};
+
+  std::chrono::nanoseconds time{
+      usage.charged_ns.load(std::memory_order_relaxed)};
+  for (const clockid_t thread : usage.threads) {
+    time += read_cpu_time(thread);
+  }
+  return time;
+}
+
+}  // namespace simulator::cfg
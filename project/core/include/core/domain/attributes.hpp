@@ -249,6 +249,12 @@ struct BusinessRejectRefId {
                                    .plural = "BusinessRejectRefIDs"};
 };
 
+struct TotalAffectedOrders {
+  using value_type = std::uint64_t;
+  constexpr static core::Name name{.singular = "TotalAffectedOrders",
+                                   .plural = "TotalAffectedOrders"};
+};
+
 }  // namespace simulator::tag
 
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, Price, Arithmetic);
@@ -257,6 +263,7 @@ SIMULATOR_DECLARE_ATTRIBUTE(simulator, MarketDepth, Arithmetic);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, RequesterInstrumentId, Arithmetic);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, ShortSaleExemptionReason, Arithmetic);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, SeqNum, Arithmetic);
+SIMULATOR_DECLARE_ATTRIBUTE(simulator, TotalAffectedOrders, Arithmetic);
 SIMULATOR_DECLARE_ENUMERABLE_ATTRIBUTE(simulator, ExecutionType);
 SIMULATOR_DECLARE_ENUMERABLE_ATTRIBUTE(simulator, OrderStatus);
 SIMULATOR_DECLARE_ENUMERABLE_ATTRIBUTE(simulator, OrderType);
@@ -305,6 +312,12 @@ struct OrderPrice {
                                    .plural = "OrderPrices"};
 };
 
+struct StopPrice {
+  using primary_type = simulator::Price;
+  constexpr static core::Name name{.singular = "StopPrice",
+                                   .plural = "StopPrices"};
+};
+
 struct BestBidPrice {
   using primary_type = simulator::Price;
   constexpr static core::Name name{.singular = "BestBidPrice",
@@ -347,6 +360,12 @@ struct ExecutedQuantity {
                                    .plural = "ExecutedQuantities"};
 };
 
+struct DisplayQuantity {
+  using primary_type = simulator::Quantity;
+  constexpr static core::Name name{.singular = "DisplayQuantity",
+                                   .plural = "DisplayQuantities"};
+};
+
 struct CurrentBidDepth {
   using primary_type = simulator::MarketDepth;
   constexpr static core::Name name{.singular = "CurrentBidDepth",
@@ -380,6 +399,7 @@ struct PriceCurrency {
 }  // namespace simulator::tag
 
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, OrderPrice, Derived);
+SIMULATOR_DECLARE_ATTRIBUTE(simulator, StopPrice, Derived);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, BestBidPrice, Derived);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, BestOfferPrice, Derived);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, ExecutionPrice, Derived);
@@ -388,6 +408,7 @@ SIMULATOR_DECLARE_ATTRIBUTE(simulator, CumExecutedQuantity, Derived);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, LeavesQuantity, Derived);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, OrderQuantity, Derived);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, ExecutedQuantity, Derived);
+SIMULATOR_DECLARE_ATTRIBUTE(simulator, DisplayQuantity, Derived);
 
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, CurrentBidDepth, Derived);
 SIMULATOR_DECLARE_ATTRIBUTE(simulator, CurrentOfferDepth, Derived);
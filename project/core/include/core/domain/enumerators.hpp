@@ -26,7 +26,7 @@ enum class OrderStatus : std::uint8_t {
   Rejected
 };
 
-enum class OrderType : std::uint8_t { Limit, Market };
+enum class OrderType : std::uint8_t { Limit, Market, Stop, StopLimit };
 
 enum class PartyIdentifierSource : std::uint8_t {
   UKNationalInsuranceOrPensionNumber,
@@ -261,7 +261,11 @@ enum class TradingPhase : std::uint8_t {
 
 enum class TradingStatus : std::uint8_t { Halt, Resume };
 
-enum class RejectedMessageType : std::uint8_t { SecurityStatusRequest };
+enum class RejectedMessageType : std::uint8_t {
+  SecurityStatusRequest,
+  OrderMassCancelRequest,
+  MassQuote
+};
 
 enum class BusinessRejectReason : std::uint8_t {
   Other,
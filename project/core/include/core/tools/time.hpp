@@ -6,6 +6,8 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
+#include <utility>
 
 namespace simulator::core {
 
@@ -124,8 +126,41 @@ template <typename Duration>
   return core::local_time<Duration>(time.time_since_epoch());
 }
 
+namespace detail {
+
+// A time reported as current on the calling thread instead of the clock one,
+// see `CurrentTimeOverride`
+inline thread_local std::optional<core::sys_us> current_time_override;
+
+}  // namespace detail
+
+// Makes the current time functions report a given time on the calling thread
+// while the override is alive, e.g. to process a command replayed from
+// a journal at the time it was initially processed at.
+// Overrides are restored in the reverse order they were created in.
+class CurrentTimeOverride {
+ public:
+  explicit CurrentTimeOverride(core::sys_us time) noexcept
+      : previous_(std::exchange(detail::current_time_override, time)) {}
+
+  CurrentTimeOverride(const CurrentTimeOverride&) = delete;
+  CurrentTimeOverride(CurrentTimeOverride&&) = delete;
+  ~CurrentTimeOverride() noexcept {
+    detail::current_time_override = previous_;
+  }
+
+  auto operator=(const CurrentTimeOverride&) -> CurrentTimeOverride& = delete;
+  auto operator=(CurrentTimeOverride&&) -> CurrentTimeOverride& = delete;
+
+ private:
+  std::optional<core::sys_us> previous_;
+};
+
 [[nodiscard]]
 inline auto get_current_system_time() noexcept -> core::sys_us {
+  if (const auto& overridden = detail::current_time_override) [[unlikely]] {
+    return *overridden;
+  }
   return core::to_time(std::chrono::system_clock::now());
 }
 
@@ -14,6 +14,7 @@ SIMULATOR_DEFINE_ATTRIBUTE(simulator, MarketDepth, Arithmetic);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, RequesterInstrumentId, Arithmetic);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, ShortSaleExemptionReason, Arithmetic);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, SeqNum, Arithmetic);
+SIMULATOR_DEFINE_ATTRIBUTE(simulator, TotalAffectedOrders, Arithmetic);
 SIMULATOR_DEFINE_ENUMERABLE_ATTRIBUTE(simulator, ExecutionType);
 SIMULATOR_DEFINE_ENUMERABLE_ATTRIBUTE(simulator, OrderStatus);
 SIMULATOR_DEFINE_ENUMERABLE_ATTRIBUTE(simulator, OrderType);
@@ -53,6 +54,7 @@ SIMULATOR_DEFINE_ATTRIBUTE(simulator, SellerId, Literal);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, SecurityStatusReqId, Literal);
 
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, OrderPrice, Derived);
+SIMULATOR_DEFINE_ATTRIBUTE(simulator, StopPrice, Derived);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, BestBidPrice, Derived);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, BestOfferPrice, Derived);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, ExecutionPrice, Derived);
@@ -61,6 +63,7 @@ SIMULATOR_DEFINE_ATTRIBUTE(simulator, CumExecutedQuantity, Derived);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, LeavesQuantity, Derived);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, OrderQuantity, Derived);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, ExecutedQuantity, Derived);
+SIMULATOR_DEFINE_ATTRIBUTE(simulator, DisplayQuantity, Derived);
 
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, CurrentBidDepth, Derived);
 SIMULATOR_DEFINE_ATTRIBUTE(simulator, CurrentOfferDepth, Derived);
@@ -31,7 +31,9 @@ EnumConverter<OrderStatus> EnumConverter<OrderStatus>::instance_{
 template <>
 EnumConverter<OrderType> EnumConverter<OrderType>::instance_{
     {{enumerators::OrderType::Limit, "Limit"},
-     {enumerators::OrderType::Market, "Market"}}};
+     {enumerators::OrderType::Market, "Market"},
+     {enumerators::OrderType::Stop, "Stop"},
+     {enumerators::OrderType::StopLimit, "StopLimit"}}};
 
 // clang-format off
 template <>
@@ -308,7 +310,9 @@ EnumConverter<TradingStatus> EnumConverter<TradingStatus>::instance_{
 template <>
 EnumConverter<RejectedMessageType>
     EnumConverter<RejectedMessageType>::instance_{
-        {{enumerators::RejectedMessageType::SecurityStatusRequest, "SecurityStatusRequest"}}};
+        {{enumerators::RejectedMessageType::SecurityStatusRequest, "SecurityStatusRequest"},
+         {enumerators::RejectedMessageType::OrderMassCancelRequest, "OrderMassCancelRequest"},
+         {enumerators::RejectedMessageType::MassQuote, "MassQuote"}}};
 // clang-format on
 
 // clang-format off
@@ -72,6 +72,9 @@ auto operator==(const TzClock& lhs, const TzClock& rhs) noexcept -> bool {
 TzClock::~TzClock() noexcept = default;
 
 auto TzClock::now(const TzClock& clock) -> time_point {
+  if (const auto& overridden = detail::current_time_override) [[unlikely]] {
+    return to_timezone(*overridden, clock);
+  }
   return to_timezone(std::chrono::system_clock::now(), clock);
 }
 
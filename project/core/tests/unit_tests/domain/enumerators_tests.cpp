@@ -266,7 +266,9 @@ INSTANTIATE_TEST_SUITE_P(
     CoreOrderTypeFormatting,
     Values(std::make_pair(static_cast<OrderType::Option>(0xFF), "undefined"),
            std::make_pair(OrderType::Option::Limit, "Limit"),
-           std::make_pair(OrderType::Option::Market, "Market")));
+           std::make_pair(OrderType::Option::Market, "Market"),
+           std::make_pair(OrderType::Option::Stop, "Stop"),
+           std::make_pair(OrderType::Option::StopLimit, "StopLimit")));
 // clang-format on
 
 struct CorePartyIdSourceFormatting
@@ -788,7 +790,9 @@ INSTANTIATE_TEST_SUITE_P(
     Formatting,
     RejectedMessageTypeFormatting,
     Values(std::make_pair(static_cast<RejectedMessageType::Option>(0xFF), "undefined"),
-           std::make_pair(RejectedMessageType::Option::SecurityStatusRequest, "SecurityStatusRequest")));
+           std::make_pair(RejectedMessageType::Option::SecurityStatusRequest, "SecurityStatusRequest"),
+           std::make_pair(RejectedMessageType::Option::OrderMassCancelRequest, "OrderMassCancelRequest"),
+           std::make_pair(RejectedMessageType::Option::MassQuote, "MassQuote")));
 // clang-format on
 
 struct BusinessRejectReasonFormatting
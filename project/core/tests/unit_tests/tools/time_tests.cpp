@@ -98,5 +98,30 @@ TEST(TimeTest, TzTimeCorrectlyFormatted) {
             "2024-09-18 17:32:55.000000000");
 }
 
+TEST(TimeTest, CurrentTimeOverrideIsReportedAsCurrentTime) {
+  // 2024-09-18 15:32:55 GMT (UNIX time)
+  constexpr auto sys = core::sys_us(1726673575s);
+  const TzClock clock("Europe/Warsaw");
+
+  const CurrentTimeOverride time_override{sys};
+
+  ASSERT_EQ(get_current_system_time(), sys);
+  // 2024-09-18 17:32:55 CEST (in Warsaw)
+  ASSERT_EQ(get_current_tz_time(clock), core::tz_us(1726680775s));
+}
+
+TEST(TimeTest, CurrentTimeOverrideIsRestoredOnDestruction) {
+  constexpr auto outer = core::sys_us(1726673575s);
+  constexpr auto inner = core::sys_us(1726680775s);
+
+  const CurrentTimeOverride outer_override{outer};
+  {
+    const CurrentTimeOverride inner_override{inner};
+    ASSERT_EQ(get_current_system_time(), inner);
+  }
+
+  ASSERT_EQ(get_current_system_time(), outer);
+}
+
 }  // namespace
 }  // namespace simulator::core
\ No newline at end of file
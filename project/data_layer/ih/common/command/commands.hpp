@@ -4,6 +4,7 @@
 #include <optional>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "api/predicate/expression.hpp"
 
@@ -46,6 +47,76 @@ class Insert {
   PatchType initial_patch_;
 };
 
+template <typename Model>
+class InsertAll {
+ public:
+  using ModelType = Model;
+  using PatchType = typename ModelType::Patch;
+
+  InsertAll() = delete;
+
+  static auto create(std::vector<PatchType> patches) -> InsertAll {
+    return InsertAll{std::move(patches)};
+  }
+
+  [[nodiscard]]
+  auto patches() const noexcept -> const std::vector<PatchType>& {
+    return patches_;
+  }
+
+  // Contains a record per patch, in the order of patches
+  [[nodiscard]]
+  auto result() -> std::vector<ModelType>& {
+    return result_;
+  }
+
+  auto set_result(std::vector<ModelType> result) -> void {
+    result_ = std::move(result);
+  }
+
+ private:
+  explicit InsertAll(std::vector<PatchType> patches) noexcept
+      : patches_(std::move(patches)) {}
+
+  std::vector<PatchType> patches_;
+  std::vector<ModelType> result_;
+};
+
+template <typename Model>
+class UpsertAll {
+ public:
+  using ModelType = Model;
+  using PatchType = typename ModelType::Patch;
+
+  UpsertAll() = delete;
+
+  static auto create(std::vector<PatchType> patches) -> UpsertAll {
+    return UpsertAll{std::move(patches)};
+  }
+
+  [[nodiscard]]
+  auto patches() const noexcept -> const std::vector<PatchType>& {
+    return patches_;
+  }
+
+  // Contains a record per patch, in the order of patches
+  [[nodiscard]]
+  auto result() -> std::vector<ModelType>& {
+    return result_;
+  }
+
+  auto set_result(std::vector<ModelType> result) -> void {
+    result_ = std::move(result);
+  }
+
+ private:
+  explicit UpsertAll(std::vector<PatchType> patches) noexcept
+      : patches_(std::move(patches)) {}
+
+  std::vector<PatchType> patches_;
+  std::vector<ModelType> result_;
+};
+
 template <typename Model>
 class SelectOne {
  public:
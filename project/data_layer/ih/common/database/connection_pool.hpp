@@ -0,0 +1,354 @@
+#ifndef SIMULATOR_DATA_LAYER_IH_COMMON_DATABASE_CONNECTION_POOL_HPP_
+#define SIMULATOR_DATA_LAYER_IH_COMMON_DATABASE_CONNECTION_POOL_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/database/pool_statistics.hpp"
+#include "api/exceptions/exceptions.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::data_layer::database {
+
+struct PoolSettings {
+  // The maximal number of connections opened at the same time
+  std::size_t max_size = 4;
+  // An idle connection is closed when it has not been used for this period
+  std::chrono::seconds idle_timeout{300};
+  // An idle connection is probed before reuse when it has not been used
+  // for this period, fresher connections are only checked to be open
+  std::chrono::seconds validation_interval{30};
+  // A checkout fails when no connection becomes available for this period
+  std::chrono::milliseconds acquire_timeout{5000};
+};
+
+// A bounded, thread-safe pool of database connections.
+//
+// The Driver type abstracts a concrete DBMS client library:
+//   typename Driver::Connection - a movable connection type,
+//   Driver::is_open(const Connection&) -> bool - a cheap local check,
+//   Driver::probe(Connection&) -> void - a round trip to the database,
+//     throws when the connection is not usable.
+//
+// The Clock is used to age idle connections only, waiting for a released
+// connection is always measured with the steady clock.
+template <typename Driver, typename Clock = std::chrono::steady_clock>
+class BasicConnectionPool {
+ public:
+  using Connection = typename Driver::Connection;
+  using Factory = std::function<Connection()>;
+
+  // Holds a connection checked out of the pool,
+  // returns the connection back to the pool on destruction
+  class Lease {
+    friend class BasicConnectionPool;
+
+   public:
+    Lease(const Lease&) = delete;
+    auto operator=(const Lease&) -> Lease& = delete;
+
+    Lease(Lease&& other) noexcept
+        : connection_(std::move(other.connection_)),
+          pool_(std::exchange(other.pool_, nullptr)),
+          reusable_(other.reusable_) {}
+
+    auto operator=(Lease&& other) noexcept -> Lease& {
+      if (this != &other) {
+        release();
+        connection_ = std::move(other.connection_);
+        pool_ = std::exchange(other.pool_, nullptr);
+        reusable_ = other.reusable_;
+      }
+      return *this;
+    }
+
+    ~Lease() { release(); }
+
+    auto operator*() noexcept -> Connection& { return *connection_; }
+
+    auto operator*() const noexcept -> const Connection& {
+      return *connection_;
+    }
+
+    auto operator->() noexcept -> Connection* { return &*connection_; }
+
+    auto operator->() const noexcept -> const Connection* {
+      return &*connection_;
+    }
+
+    // Makes the pool close the connection instead of reusing it
+    auto discard() noexcept -> void { reusable_ = false; }
+
+   private:
+    Lease(BasicConnectionPool& pool, Connection connection)
+        : connection_(std::move(connection)), pool_(&pool) {}
+
+    auto release() noexcept -> void {
+      if (auto* pool = std::exchange(pool_, nullptr)) {
+        pool->release(std::move(*connection_), reusable_);
+        connection_.reset();
+      }
+    }
+
+    std::optional<Connection> connection_;
+    BasicConnectionPool* pool_;
+    bool reusable_{true};
+  };
+
+  BasicConnectionPool(PoolSettings settings, Factory factory)
+      : settings_(settings), factory_(std::move(factory)) {
+    settings_.max_size = std::max<std::size_t>(settings_.max_size, 1);
+    idle_.reserve(settings_.max_size);
+  }
+
+  BasicConnectionPool(const BasicConnectionPool&) = delete;
+  auto operator=(const BasicConnectionPool&) -> BasicConnectionPool& = delete;
+
+  BasicConnectionPool(BasicConnectionPool&&) = delete;
+  auto operator=(BasicConnectionPool&&) -> BasicConnectionPool& = delete;
+
+  ~BasicConnectionPool() {
+    const PoolStatistics stats = statistics();
+    if (stats.acquisitions == 0) {
+      return;
+    }
+    log::info(
+        "closing database connection pool: {} acquisitions, {} waited "
+        "(total {}us, max {}us), {} timed out, {} connections opened, "
+        "{} closed",
+        stats.acquisitions,
+        stats.waited_acquisitions,
+        stats.total_wait.count(),
+        stats.max_wait.count(),
+        stats.timed_out_acquisitions,
+        stats.opened_connections,
+        stats.closed_connections);
+  }
+
+  [[nodiscard]]
+  auto settings() const noexcept -> const PoolSettings& {
+    return settings_;
+  }
+
+  [[nodiscard]]
+  auto statistics() const -> PoolStatistics {
+    const std::lock_guard lock{mutex_};
+    PoolStatistics stats = statistics_;
+    stats.idle = idle_.size();
+    stats.in_use = opened_ - idle_.size();
+    stats.max_size = settings_.max_size;
+    return stats;
+  }
+
+  // Checks out an idle connection or opens a new one when the pool
+  // is not full, otherwise waits for a connection to be released.
+  // Throws ConnectionFailure when waiting times out.
+  [[nodiscard]]
+  auto acquire() -> Lease {
+    return std::move(*checkout(/*wait=*/true));
+  }
+
+  // Makes a round trip to the database.
+  // A pooled connection is used when one is available, so that a connection
+  // which fails to reach the database is closed. When all the connections
+  // are checked out, a dedicated connection is opened over the pool limit,
+  // so that an exhausted pool is not taken for an unreachable database.
+  // Throws ConnectionFailure when the database can not be reached.
+  auto check() -> void {
+    if (auto lease = checkout(/*wait=*/false)) {
+      try {
+        probe(**lease);
+      } catch (...) {
+        lease->discard();
+        throw;
+      }
+      return;
+    }
+
+    log::debug("database connection pool is exhausted, checking the database "
+               "with a dedicated connection");
+    Connection connection = factory_();
+    probe(connection);
+  }
+
+ private:
+  struct IdleConnection {
+    Connection connection;
+    typename Clock::time_point released_at;
+  };
+
+  // Returns nothing when the pool is exhausted and waiting is not allowed
+  auto checkout(bool wait) -> std::optional<Lease> {
+    using WaitClock = std::chrono::steady_clock;
+    const auto started = WaitClock::now();
+    const auto deadline = started + settings_.acquire_timeout;
+    bool waited = false;
+
+    std::vector<IdleConnection> expired;
+    std::unique_lock lock{mutex_};
+    while (true) {
+      take_expired(expired);
+
+      if (!idle_.empty()) {
+        IdleConnection candidate = std::move(idle_.back());
+        idle_.pop_back();
+
+        lock.unlock();
+        expired.clear();
+        const bool usable = validate(candidate);
+        lock.lock();
+
+        if (usable) {
+          record_acquisition(WaitClock::now() - started, waited);
+          return Lease{*this, std::move(candidate.connection)};
+        }
+        expired.push_back(std::move(candidate));
+        forget_connection();
+        continue;
+      }
+
+      if (opened_ < settings_.max_size) {
+        ++opened_;
+        lock.unlock();
+        expired.clear();
+
+        std::optional<Connection> connection;
+        try {
+          connection.emplace(factory_());
+        } catch (...) {
+          lock.lock();
+          --opened_;
+          released_.notify_one();
+          throw;
+        }
+
+        lock.lock();
+        ++statistics_.opened_connections;
+        record_acquisition(WaitClock::now() - started, waited);
+        return Lease{*this, std::move(*connection)};
+      }
+
+      if (!wait) {
+        return std::nullopt;
+      }
+      waited = true;
+      if (released_.wait_until(lock, deadline) == std::cv_status::timeout &&
+          idle_.empty() && opened_ >= settings_.max_size) {
+        ++statistics_.timed_out_acquisitions;
+        log::warn("no database connection became available in {}ms",
+                  settings_.acquire_timeout.count());
+        throw data_layer::ConnectionFailure{
+            "database connection pool is exhausted"};
+      }
+    }
+  }
+
+  static auto probe(Connection& connection) -> void {
+    try {
+      Driver::probe(connection);
+    } catch (const data_layer::ConnectionFailure&) {
+      throw;
+    } catch (const std::exception& exception) {
+      throw data_layer::ConnectionFailure{exception.what()};
+    }
+  }
+
+  auto release(Connection connection, bool reusable) noexcept -> void {
+    bool open = false;
+    if (reusable) {
+      try {
+        open = Driver::is_open(connection);
+      } catch (...) {
+        open = false;
+      }
+    }
+
+    const std::lock_guard lock{mutex_};
+    if (open) {
+      // Capacity for all connections is reserved on construction
+      idle_.push_back(IdleConnection{std::move(connection), Clock::now()});
+    } else {
+      forget_connection();
+    }
+    released_.notify_one();
+  }
+
+  auto validate(IdleConnection& candidate) const noexcept -> bool {
+    try {
+      if (!Driver::is_open(candidate.connection)) {
+        return false;
+      }
+      if (Clock::now() - candidate.released_at >=
+          settings_.validation_interval) {
+        Driver::probe(candidate.connection);
+      }
+      return true;
+    } catch (const std::exception& exception) {
+      log::warn("dropping a pooled database connection, probe failed: {}",
+                exception.what());
+    } catch (...) {
+      log::warn("dropping a pooled database connection, probe failed");
+    }
+    return false;
+  }
+
+  // Moves connections idle for longer than the idle timeout out of the pool,
+  // so that they are closed by the caller outside of the lock
+  auto take_expired(std::vector<IdleConnection>& expired) -> void {
+    const auto now = Clock::now();
+    const auto is_expired = [&](const IdleConnection& idle) {
+      return now - idle.released_at >= settings_.idle_timeout;
+    };
+
+    // Idle connections are ordered by release time, the oldest go first
+    const auto first_fresh =
+        std::find_if_not(idle_.begin(), idle_.end(), is_expired);
+    for (auto it = idle_.begin(); it != first_fresh; ++it) {
+      expired.push_back(std::move(*it));
+      forget_connection();
+    }
+    idle_.erase(idle_.begin(), first_fresh);
+  }
+
+  auto forget_connection() noexcept -> void {
+    --opened_;
+    ++statistics_.closed_connections;
+  }
+
+  auto record_acquisition(std::chrono::steady_clock::duration wait_time,
+                          bool waited) noexcept -> void {
+    ++statistics_.acquisitions;
+    if (!waited) {
+      return;
+    }
+
+    const auto wait =
+        std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
+    ++statistics_.waited_acquisitions;
+    statistics_.total_wait += wait;
+    statistics_.max_wait = std::max(statistics_.max_wait, wait);
+  }
+
+  PoolSettings settings_;
+  Factory factory_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable released_;
+  // Ordered by release time, the most recently released connection is last
+  std::vector<IdleConnection> idle_;
+  // Idle, checked out and being opened connections
+  std::size_t opened_{0};
+  PoolStatistics statistics_;
+};
+
+}  // namespace simulator::data_layer::database
+
+#endif  // SIMULATOR_DATA_LAYER_IH_COMMON_DATABASE_CONNECTION_POOL_HPP_
@@ -0,0 +1,24 @@
+#ifndef SIMULATOR_DATA_LAYER_IH_COMMON_DATABASE_POOL_INSPECTOR_HPP_
+#define SIMULATOR_DATA_LAYER_IH_COMMON_DATABASE_POOL_INSPECTOR_HPP_
+
+#include "api/database/context.hpp"
+#include "api/database/pool_statistics.hpp"
+#include "ih/common/database/context_resolver.hpp"
+
+namespace simulator::data_layer::database {
+
+// Reads statistics of the connection pool shared by copies of a context
+class PoolInspector final : public ContextResolver {
+ public:
+  static auto inspect(const database::Context& context) -> PoolStatistics;
+
+ private:
+  auto execute_with(const internal_pqxx::Context& pqxx_context)
+      -> void override;
+
+  PoolStatistics statistics_;
+};
+
+}  // namespace simulator::data_layer::database
+
+#endif  // SIMULATOR_DATA_LAYER_IH_COMMON_DATABASE_POOL_INSPECTOR_HPP_
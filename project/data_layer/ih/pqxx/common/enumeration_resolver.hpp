@@ -31,6 +31,11 @@ class EnumerationResolver {
   auto operator()(std::string_view engine_type, Venue::EngineType& value) const
       -> void;
 
+  [[nodiscard]]
+  auto operator()(Venue::SelfTradePrevention mode) const -> std::string;
+  auto operator()(std::string_view mode,
+                  Venue::SelfTradePrevention& value) const -> void;
+
  private:
   [[nodiscard]]
   static auto to_string(Datasource::Format format) -> std::string;
@@ -51,6 +56,11 @@ class EnumerationResolver {
   static auto to_string(Venue::EngineType value) -> std::string;
   static auto from_string(std::string_view engine_type,
                           Venue::EngineType& value) -> void;
+
+  [[nodiscard]]
+  static auto to_string(Venue::SelfTradePrevention value) -> std::string;
+  static auto from_string(std::string_view mode,
+                          Venue::SelfTradePrevention& value) -> void;
 };
 
 }  // namespace simulator::data_layer::internal_pqxx
@@ -135,10 +135,12 @@ constexpr std::string_view TnsEnabled{"tns_enabled"};
 constexpr std::string_view TnsQtyEnabled{"tns_qty_enabled"};
 constexpr std::string_view TnsSideEnabled{"tns_side_enabled"};
 constexpr std::string_view TnsPartiesEnabled{"tns_parties_enabled"};
+constexpr std::string_view TnsHistoryDepth{"tns_history_depth"};
 constexpr std::string_view Timezone{"timezone"};
 constexpr std::string_view CancelOnDisconnect{"cancel_on_disconnect"};
 constexpr std::string_view PersistenceEnabled{"persistence_enabled"};
 constexpr std::string_view PersistenceFilePath{"persistence_file_path"};
+constexpr std::string_view SelfTradePrevention{"self_trade_prevention"};
 
 }  // namespace venue_column
 }  // namespace simulator::data_layer::internal_pqxx
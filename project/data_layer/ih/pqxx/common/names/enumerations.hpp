@@ -34,6 +34,16 @@ constexpr std::string_view Matching{"Matching"};
 constexpr std::string_view Quoting{"Quoting"};
 
 }  // namespace venue_engine_type
+
+namespace venue_self_trade_prevention {
+
+constexpr std::string_view None{"None"};
+constexpr std::string_view CancelNewest{"CancelNewest"};
+constexpr std::string_view CancelOldest{"CancelOldest"};
+constexpr std::string_view CancelBoth{"CancelBoth"};
+constexpr std::string_view Decrement{"Decrement"};
+
+}  // namespace venue_self_trade_prevention
 }  // namespace simulator::data_layer::internal_pqxx
 
 #endif  // SIMULATOR_DATA_LAYER_IH_PQXX_COMMON_NAMES_ENUMERATIONS_HPP_
@@ -1,12 +1,16 @@
 #ifndef SIMULATOR_PROJECT_DATA_LAYER_IH_PQXX_CONTEXT_HPP_
 #define SIMULATOR_PROJECT_DATA_LAYER_IH_PQXX_CONTEXT_HPP_
 
+#include <memory>
 #include <string>
 
 #include "cfg/api/cfg.hpp"
+#include "ih/common/database/connection_pool.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
+class ConnectionPool;
+
 class Context {
  public:
   class Configurator {
@@ -34,19 +38,30 @@ class Context {
     const static std::string_view connection_string_format;
   };
 
-  Context() = default;
+  Context();
 
-  explicit Context(std::string connection_string) noexcept;
+  explicit Context(std::string connection_string);
 
   [[nodiscard]]
   auto get_connection_string() const noexcept -> const std::string&;
 
+  [[nodiscard]]
+  auto get_pool_settings() const noexcept -> const database::PoolSettings&;
+
+  // Connections to the database are shared by all copies of the context
+  [[nodiscard]]
+  auto connection_pool() const noexcept -> ConnectionPool&;
+
   // May throw ConnectionPropertyMissing exception in case passed cfg
   // does not contain a required connection property
   auto configure(const cfg::DbConfiguration& cfg) -> void;
 
  private:
+  auto reset_connection_pool() -> void;
+
   std::string connection_;
+  database::PoolSettings pool_settings_;
+  std::shared_ptr<ConnectionPool> pool_;
 };
 
 }  // namespace simulator::data_layer::internal_pqxx
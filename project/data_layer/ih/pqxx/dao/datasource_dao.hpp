@@ -9,6 +9,7 @@
 #include "api/models/datasource.hpp"
 #include "ih/common/command/commands.hpp"
 #include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 #include "ih/pqxx/database/transaction.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
@@ -43,7 +44,7 @@ class DatasourceDao {
   auto execute(UpdateOneCommand& command) -> void;
 
  private:
-  explicit DatasourceDao(pqxx::connection pqxx_connection) noexcept;
+  explicit DatasourceDao(PooledConnection pqxx_connection) noexcept;
 
   [[nodiscard]]
   auto insert(const Datasource::Patch& snapshot,
@@ -90,7 +91,7 @@ class DatasourceDao {
                             Transaction::Handler transaction_handler) const
       -> void;
 
-  pqxx::connection connection_;
+  PooledConnection connection_;
 };
 
 }  // namespace simulator::data_layer::internal_pqxx
@@ -4,10 +4,13 @@
 #include <pqxx/connection>
 #include <pqxx/row>
 #include <pqxx/transaction>
+#include <span>
+#include <vector>
 
 #include "api/models/listing.hpp"
 #include "ih/common/command/commands.hpp"
 #include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 #include "ih/pqxx/database/transaction.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
@@ -17,6 +20,8 @@ class ListingDao {
   using Predicate = predicate::Expression<data_layer::Listing>;
 
   using InsertCommand = command::Insert<data_layer::Listing>;
+  using InsertAllCommand = command::InsertAll<data_layer::Listing>;
+  using UpsertAllCommand = command::UpsertAll<data_layer::Listing>;
   using SelectOneCommand = command::SelectOne<data_layer::Listing>;
   using SelectAllCommand = command::SelectAll<data_layer::Listing>;
   using UpdateOneCommand = command::UpdateOne<data_layer::Listing>;
@@ -34,6 +39,10 @@ class ListingDao {
 
   auto execute(InsertCommand& command) -> void;
 
+  auto execute(InsertAllCommand& command) -> void;
+
+  auto execute(UpsertAllCommand& command) -> void;
+
   auto execute(SelectOneCommand& command) -> void;
 
   auto execute(SelectAllCommand& command) -> void;
@@ -41,12 +50,23 @@ class ListingDao {
   auto execute(UpdateOneCommand& command) -> void;
 
  private:
-  explicit ListingDao(pqxx::connection pqxx_connection) noexcept;
+  explicit ListingDao(PooledConnection pqxx_connection) noexcept;
 
   [[nodiscard]]
   auto insert(const Listing::Patch& snapshot,
               Transaction::Handler transaction_handler) -> Listing;
 
+  [[nodiscard]]
+  auto insert_all(std::span<const Listing::Patch> patches,
+                  Transaction::Handler transaction_handler)
+      -> std::vector<Listing>;
+
+  // Updates listings identified by patches, inserts the rest
+  [[nodiscard]]
+  auto upsert_all(std::span<const Listing::Patch> patches,
+                  Transaction::Handler transaction_handler)
+      -> std::vector<Listing>;
+
   [[nodiscard]]
   auto select_single(const Predicate& predicate,
                      Transaction::Handler transaction_handler) -> Listing;
@@ -68,7 +88,7 @@ class ListingDao {
   [[nodiscard]]
   static auto decode_listing(const pqxx::row& row) -> Listing;
 
-  pqxx::connection connection_;
+  PooledConnection connection_;
 };
 
 }  // namespace simulator::data_layer::internal_pqxx
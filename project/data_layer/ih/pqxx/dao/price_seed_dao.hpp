@@ -4,10 +4,13 @@
 #include <pqxx/connection>
 #include <pqxx/row>
 #include <pqxx/transaction>
+#include <span>
+#include <vector>
 
 #include "api/models/price_seed.hpp"
 #include "ih/common/command/commands.hpp"
 #include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 #include "ih/pqxx/database/transaction.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
@@ -17,6 +20,8 @@ class PriceSeedDao {
   using Predicate = predicate::Expression<data_layer::PriceSeed>;
 
   using InsertCommand = command::Insert<data_layer::PriceSeed>;
+  using InsertAllCommand = command::InsertAll<data_layer::PriceSeed>;
+  using UpsertAllCommand = command::UpsertAll<data_layer::PriceSeed>;
   using SelectOneCommand = command::SelectOne<data_layer::PriceSeed>;
   using SelectAllCommand = command::SelectAll<data_layer::PriceSeed>;
   using UpdateOneCommand = command::UpdateOne<data_layer::PriceSeed>;
@@ -37,6 +42,10 @@ class PriceSeedDao {
 
   auto execute(InsertCommand& command) -> void;
 
+  auto execute(InsertAllCommand& command) -> void;
+
+  auto execute(UpsertAllCommand& command) -> void;
+
   auto execute(SelectOneCommand& command) -> void;
 
   auto execute(SelectAllCommand& command) -> void;
@@ -50,12 +59,23 @@ class PriceSeedDao {
   auto execute(DeleteAllCommand& command) -> void;
 
  private:
-  explicit PriceSeedDao(pqxx::connection pqxx_connection) noexcept;
+  explicit PriceSeedDao(PooledConnection pqxx_connection) noexcept;
 
   [[nodiscard]]
   auto insert(const PriceSeed::Patch& snapshot,
               Transaction::Handler transaction_handler) -> PriceSeed;
 
+  [[nodiscard]]
+  auto insert_all(std::span<const PriceSeed::Patch> patches,
+                  Transaction::Handler transaction_handler)
+      -> std::vector<PriceSeed>;
+
+  // Updates price seeds identified by patches, inserts the rest
+  [[nodiscard]]
+  auto upsert_all(std::span<const PriceSeed::Patch> patches,
+                  Transaction::Handler transaction_handler)
+      -> std::vector<PriceSeed>;
+
   [[nodiscard]]
   auto select_single(const Predicate& predicate,
                      Transaction::Handler transaction_handler) -> PriceSeed;
@@ -89,7 +109,7 @@ class PriceSeedDao {
   [[nodiscard]]
   static auto decode_price_seed(const pqxx::row& row) -> PriceSeed;
 
-  pqxx::connection connection_;
+  PooledConnection connection_;
 };
 
 }  // namespace simulator::data_layer::internal_pqxx
@@ -10,6 +10,7 @@
 #include "api/models/setting.hpp"
 #include "ih/common/command/commands.hpp"
 #include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 #include "ih/pqxx/database/transaction.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
@@ -19,6 +20,8 @@ class SettingDao {
   using Predicate = predicate::Expression<data_layer::Setting>;
 
   using InsertCommand = command::Insert<data_layer::Setting>;
+  using InsertAllCommand = command::InsertAll<data_layer::Setting>;
+  using UpsertAllCommand = command::UpsertAll<data_layer::Setting>;
   using SelectOneCommand = command::SelectOne<data_layer::Setting>;
   using SelectAllCommand = command::SelectAll<data_layer::Setting>;
   using UpdateOneCommand = command::UpdateOne<data_layer::Setting>;
@@ -36,6 +39,10 @@ class SettingDao {
 
   auto execute(InsertCommand& command) -> void;
 
+  auto execute(InsertAllCommand& command) -> void;
+
+  auto execute(UpsertAllCommand& command) -> void;
+
   auto execute(SelectOneCommand& command) -> void;
 
   auto execute(SelectAllCommand& command) -> void;
@@ -43,12 +50,18 @@ class SettingDao {
   auto execute(UpdateOneCommand& command) -> void;
 
  private:
-  explicit SettingDao(pqxx::connection pqxx_connection) noexcept;
+  explicit SettingDao(PooledConnection pqxx_connection) noexcept;
 
   [[nodiscard]]
   auto insert(const Setting::Patch& snapshot,
               Transaction::Handler transaction_handler) -> Setting;
 
+  [[nodiscard]]
+  auto insert_all(const std::vector<Setting::Patch>& patches,
+                  bool update_existing,
+                  Transaction::Handler transaction_handler)
+      -> std::vector<Setting>;
+
   [[nodiscard]]
   auto select_single(const Predicate& predicate,
                      Transaction::Handler transaction_handler) -> Setting;
@@ -70,7 +83,7 @@ class SettingDao {
   [[nodiscard]]
   static auto decode_setting(const pqxx::row& row) -> Setting;
 
-  pqxx::connection connection_;
+  PooledConnection connection_;
 };
 
 }  // namespace simulator::data_layer::internal_pqxx
@@ -9,6 +9,7 @@
 #include "api/models/venue.hpp"
 #include "ih/common/command/commands.hpp"
 #include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 #include "ih/pqxx/database/transaction.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
@@ -42,7 +43,7 @@ class VenueDao {
   auto execute(UpdateOneCommand& command) -> void;
 
  private:
-  explicit VenueDao(pqxx::connection pqxx_connection) noexcept;
+  explicit VenueDao(PooledConnection pqxx_connection) noexcept;
 
   [[nodiscard]]
   auto insert(const Venue::Patch& snapshot,
@@ -85,7 +86,7 @@ class VenueDao {
   auto drop_phases(const std::string& venue_id,
                    Transaction::Handler transaction_handler) const -> void;
 
-  pqxx::connection connection_;
+  PooledConnection connection_;
 };
 
 }  // namespace simulator::data_layer::internal_pqxx
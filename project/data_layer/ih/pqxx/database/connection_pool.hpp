@@ -0,0 +1,41 @@
+#ifndef SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_CONNECTION_POOL_HPP_
+#define SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_CONNECTION_POOL_HPP_
+
+#include <pqxx/connection>
+#include <pqxx/transaction>
+
+#include "ih/common/database/connection_pool.hpp"
+#include "ih/pqxx/database/prepared_statements.hpp"
+
+namespace simulator::data_layer::internal_pqxx {
+
+// A pooled database connection, statements prepared on the connection
+// live as long as the connection does
+struct Connection {
+  pqxx::connection handle;
+  PreparedStatements statements;
+};
+
+struct PqxxDriver {
+  using Connection = internal_pqxx::Connection;
+
+  static auto is_open(const Connection& connection) noexcept -> bool {
+    return connection.handle.is_open();
+  }
+
+  static auto probe(Connection& connection) -> void {
+    pqxx::nontransaction transaction{connection.handle};
+    transaction.exec("SELECT 1");
+  }
+};
+
+class ConnectionPool final : public database::BasicConnectionPool<PqxxDriver> {
+ public:
+  using BasicConnectionPool::BasicConnectionPool;
+};
+
+using PooledConnection = ConnectionPool::Lease;
+
+}  // namespace simulator::data_layer::internal_pqxx
+
+#endif  // SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_CONNECTION_POOL_HPP_
@@ -6,6 +6,7 @@
 #include <string>
 
 #include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
@@ -14,9 +15,17 @@ class Connector {
   using ConnectingStrategy =
       std::function<pqxx::connection(const std::string&)>;
 
+  // Checks a connection out of the connection pool of the context
+  static auto acquire(const internal_pqxx::Context& context)
+      -> PooledConnection;
+
+  // Opens a dedicated connection, which is not managed by a pool
   static auto connect(const internal_pqxx::Context& context)
       -> pqxx::connection;
 
+  static auto connect(const std::string& connection_string)
+      -> pqxx::connection;
+
   static auto ping(const internal_pqxx::Context& context) -> void;
 
   Connector() = delete;
@@ -27,6 +36,10 @@ class Connector {
   auto connect_under(const internal_pqxx::Context& context) const
       -> pqxx::connection;
 
+  [[nodiscard]]
+  auto connect_under(const std::string& connection_string) const
+      -> pqxx::connection;
+
  private:
   [[nodiscard]]
   auto connect_by_conn_string(const std::string& conn_string) const
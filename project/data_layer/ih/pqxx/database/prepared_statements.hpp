@@ -0,0 +1,72 @@
+#ifndef SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_PREPARED_STATEMENTS_HPP_
+#define SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_PREPARED_STATEMENTS_HPP_
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <pqxx/connection>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace simulator::data_layer::internal_pqxx {
+
+// Keeps track of statements prepared on a single database connection.
+//
+// Statements are keyed by a query text. Query values are passed
+// as parameters, so the text depends on the query shape only and
+// the database parses and plans each shape once per connection.
+class PreparedStatements {
+  struct QueryHash {
+    using is_transparent = void;
+
+    auto operator()(std::string_view query) const noexcept -> std::size_t {
+      return std::hash<std::string_view>{}(query);
+    }
+  };
+
+ public:
+  // Predicates are composed by clients, so the number of query shapes
+  // is not bounded, queries beyond the capacity are executed unprepared
+  constexpr static std::size_t DefaultCapacity = 64;
+
+  explicit PreparedStatements(std::size_t capacity = DefaultCapacity) noexcept
+      : capacity_(capacity) {}
+
+  // Returns a name of the statement prepared for the query,
+  // prepares the statement when the query is executed the first time.
+  // Returns std::nullopt when the capacity is exhausted.
+  template <typename DbConnection>
+  auto prepare(DbConnection& connection, std::string_view query)
+      -> std::optional<pqxx::zview> {
+    if (const auto it = statements_.find(query); it != statements_.end()) {
+      return pqxx::zview{it->second};
+    }
+    if (statements_.size() >= capacity_) {
+      return std::nullopt;
+    }
+
+    std::string name = fmt::format("simulator_{}", statements_.size());
+    connection.prepare(pqxx::zview{name}, pqxx::zview{query});
+    const auto inserted =
+        statements_.emplace(std::string{query}, std::move(name)).first;
+    return pqxx::zview{inserted->second};
+  }
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t {
+    return statements_.size();
+  }
+
+ private:
+  // Query text to statement name
+  std::unordered_map<std::string, std::string, QueryHash, std::equal_to<>>
+      statements_;
+  std::size_t capacity_;
+};
+
+}  // namespace simulator::data_layer::internal_pqxx
+
+#endif  // SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_PREPARED_STATEMENTS_HPP_
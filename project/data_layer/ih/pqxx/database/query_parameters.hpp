@@ -0,0 +1,40 @@
+#ifndef SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_QUERY_PARAMETERS_HPP_
+#define SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_QUERY_PARAMETERS_HPP_
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <pqxx/params>
+#include <string>
+
+namespace simulator::data_layer::internal_pqxx {
+
+// Binds values to positional query parameters.
+// A value is substituted by a placeholder ($1, $2, ...) in a query text,
+// and is passed to the database separately from the query.
+class QueryParameters {
+ public:
+  template <typename T>
+  auto operator()(const T& value) -> std::string {
+    values_.append(value);
+    return fmt::format("${}", ++count_);
+  }
+
+  [[nodiscard]]
+  auto values() const noexcept -> const pqxx::params& {
+    return values_;
+  }
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t {
+    return count_;
+  }
+
+ private:
+  pqxx::params values_;
+  std::size_t count_{0};
+};
+
+}  // namespace simulator::data_layer::internal_pqxx
+
+#endif  // SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_QUERY_PARAMETERS_HPP_
@@ -2,13 +2,16 @@
 #define SIMULATOR_DATA_LAYER_IH_PQXX_DATABASE_TRANSACTION_HPP_
 
 #include <functional>
+#include <optional>
 #include <pqxx/connection>
+#include <pqxx/params>
 #include <pqxx/result>
 #include <pqxx/row>
 #include <pqxx/transaction>
 #include <utility>
 
 #include "api/exceptions/exceptions.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
@@ -35,6 +38,37 @@ class TransactionHandler {
     return handle_errors(trx_executor);
   }
 
+  auto exec0(std::string_view query, const pqxx::params& parameters) {
+    const auto trx_executor = [&] {
+      return impl().exec_params0(pqxx::zview(query), parameters);
+    };
+    return handle_errors(trx_executor);
+  }
+
+  auto exec1(std::string_view query, const pqxx::params& parameters) {
+    const auto trx_executor = [&] {
+      return impl().exec_params1(pqxx::zview(query), parameters);
+    };
+    return handle_errors(trx_executor);
+  }
+
+  auto exec(std::string_view query, const pqxx::params& parameters) {
+    const auto trx_executor = [&] {
+      return impl().exec_params(pqxx::zview(query), parameters);
+    };
+    return handle_errors(trx_executor);
+  }
+
+  // Executes a query which shape is unlikely to be repeated,
+  // such a query is not worth a prepared statement
+  auto exec_unprepared(std::string_view query,
+                       const pqxx::params& parameters) {
+    const auto trx_executor = [&] {
+      return impl().exec_unprepared(pqxx::zview(query), parameters);
+    };
+    return handle_errors(trx_executor);
+  }
+
  private:
   template <typename TransactionExecutor>
   auto handle_errors(TransactionExecutor executor) {
@@ -107,13 +141,73 @@ class TransactionHandler {
   std::reference_wrapper<TransactionImpl> implementation_;
 };
 
+// Executes parameterized queries as statements prepared on the connection,
+// a query is prepared when it is executed on the connection the first time
+class PreparingTransaction {
+ public:
+  explicit PreparingTransaction(Connection& connection)
+      : transaction_(connection.handle), connection_(connection) {}
+
+  auto exec0(pqxx::zview query) -> pqxx::result {
+    return transaction_.exec0(query);
+  }
+
+  auto exec1(pqxx::zview query) -> pqxx::row {
+    return transaction_.exec1(query);
+  }
+
+  auto exec(pqxx::zview query) -> pqxx::result {
+    return transaction_.exec(query);
+  }
+
+  auto exec_params0(pqxx::zview query, const pqxx::params& parameters)
+      -> pqxx::result {
+    if (const auto statement = prepare(query)) {
+      return transaction_.exec_prepared0(*statement, parameters);
+    }
+    return transaction_.exec_params0(query, parameters);
+  }
+
+  auto exec_params1(pqxx::zview query, const pqxx::params& parameters)
+      -> pqxx::row {
+    if (const auto statement = prepare(query)) {
+      return transaction_.exec_prepared1(*statement, parameters);
+    }
+    return transaction_.exec_params1(query, parameters);
+  }
+
+  auto exec_params(pqxx::zview query, const pqxx::params& parameters)
+      -> pqxx::result {
+    if (const auto statement = prepare(query)) {
+      return transaction_.exec_prepared(*statement, parameters);
+    }
+    return transaction_.exec_params(query, parameters);
+  }
+
+  auto exec_unprepared(pqxx::zview query, const pqxx::params& parameters)
+      -> pqxx::result {
+    return transaction_.exec_params(query, parameters);
+  }
+
+  auto commit() -> void { transaction_.commit(); }
+
+ private:
+  auto prepare(pqxx::zview query) -> std::optional<pqxx::zview> {
+    Connection& connection = connection_.get();
+    return connection.statements.prepare(connection.handle, query);
+  }
+
+  pqxx::work transaction_;
+  std::reference_wrapper<Connection> connection_;
+};
+
 class Transaction {
-  using DbmsTransaction = pqxx::work;
+  using DbmsTransaction = PreparingTransaction;
 
  public:
   using Handler = TransactionHandler<DbmsTransaction>;
 
-  explicit Transaction(pqxx::connection& connection)
+  explicit Transaction(Connection& connection)
       : transaction_(connection), handler_(transaction_) {}
 
   auto handler() noexcept -> Handler { return handler_; }
@@ -0,0 +1,279 @@
+#ifndef SIMULATOR_DATA_LAYER_IH_PQXX_QUERIES_DETAIL_BULK_INSERT_QUERY_BUILDER_HPP_
+#define SIMULATOR_DATA_LAYER_IH_PQXX_QUERIES_DETAIL_BULK_INSERT_QUERY_BUILDER_HPP_
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "api/exceptions/exceptions.hpp"
+#include "ih/common/queries/data_extractor.hpp"
+#include "ih/pqxx/common/column_resolver.hpp"
+#include "ih/pqxx/common/enumeration_resolver.hpp"
+
+namespace simulator::data_layer::internal_pqxx::detail {
+
+// Builds a single multi-row INSERT query,
+// optionally turned into an upsert by a conflict target.
+// All rows of the query must specify the same set of columns.
+class BulkInsertQueryBuilder {
+  template <typename Sanitizer>
+  using CustomExtractorType =
+      data_layer::DataExtractor<internal_pqxx::ColumnResolver,
+                                internal_pqxx::EnumerationResolver,
+                                Sanitizer>;
+
+  template <typename T>
+  constexpr static bool can_be_resolved_as_column_v =
+      std::is_invocable_r_v<std::string, internal_pqxx::ColumnResolver, T>;
+
+  // Leaves values as they are, used to read columns of a patch only
+  struct ColumnsOnly {
+    auto operator()(const std::string& value) const -> std::string {
+      return value;
+    }
+  };
+
+ public:
+  // PostgreSQL wire protocol limits a number of parameters of a statement
+  constexpr static std::size_t MaxParameters = 65535;
+
+  BulkInsertQueryBuilder() = delete;
+
+  explicit BulkInsertQueryBuilder(std::string table_name);
+
+  // Splits patches into consecutive batches, each batch can be inserted
+  // with a single query: patches of a batch specify the same columns,
+  // all their values fit into a single statement and no key is repeated
+  // within the batch (a statement can not affect a row twice).
+  // Every patch must specify all the key columns.
+  // The reader is invoked as `read(patch, extractor)`.
+  template <typename Patch, typename PatchReader, typename... KeyColumns>
+  [[nodiscard]]
+  static auto split_into_batches(std::span<const Patch> patches,
+                                 PatchReader read,
+                                 KeyColumns... key_columns)
+      -> std::vector<std::span<const Patch>>;
+
+  template <typename Sanitizer>
+  auto make_data_extractor(Sanitizer& value_sanitizer)
+      -> CustomExtractorType<Sanitizer>;
+
+  template <typename Sanitizer>
+  auto add_row(const CustomExtractorType<Sanitizer>& extractor) -> void;
+
+  // Makes the query update conflicting rows with inserted values
+  // of all columns except the conflict target ones
+  template <typename... Columns>
+  auto with_conflict_target(Columns... columns) -> void;
+
+  [[nodiscard]]
+  auto compose() const -> std::string;
+
+ private:
+  std::string table_name_;
+  std::vector<std::string> columns_;
+  std::vector<std::string> conflict_target_;
+  std::string values_;
+  std::size_t rows_{0};
+
+  internal_pqxx::ColumnResolver column_resolver_;
+  internal_pqxx::EnumerationResolver enum_resolver_;
+};
+
+inline BulkInsertQueryBuilder::BulkInsertQueryBuilder(std::string table_name)
+    : table_name_(std::move(table_name)) {
+  if (table_name_.empty()) {
+    throw InternalError(
+        "bulk INSERT query builder has not been supplied with a target "
+        "table name");
+  }
+}
+
+template <typename Patch, typename PatchReader, typename... KeyColumns>
+inline auto BulkInsertQueryBuilder::split_into_batches(
+    std::span<const Patch> patches, PatchReader read, KeyColumns... key_columns)
+    -> std::vector<std::span<const Patch>> {
+  static_assert((can_be_resolved_as_column_v<KeyColumns> && ...),
+                "Can not resolve a column name for a given type");
+
+  internal_pqxx::ColumnResolver column_resolver;
+  internal_pqxx::EnumerationResolver enum_resolver;
+  ColumnsOnly sanitizer;
+  const std::vector<std::string> key_names{column_resolver(key_columns)...};
+
+  const auto read_row = [&](const Patch& patch) {
+    CustomExtractorType<ColumnsOnly> extractor{
+        column_resolver, enum_resolver, sanitizer};
+    read(patch, extractor);
+    return extractor.extracted_data();
+  };
+
+  const auto read_key = [&](const auto& row) {
+    std::vector<std::string> key;
+    key.reserve(key_names.size());
+    for (const auto& key_name : key_names) {
+      const auto field = std::find_if(
+          std::begin(row), std::end(row), [&](const auto& column_value) {
+            return column_value.first == key_name;
+          });
+      if (field == std::end(row)) {
+        throw MalformedPatch(fmt::format(
+            "bulk INSERT patches do not specify the `{}' key field",
+            key_name));
+      }
+      key.emplace_back(field->second);
+    }
+    return key;
+  };
+
+  std::vector<std::span<const Patch>> batches;
+  std::vector<std::string> batch_columns;
+  std::set<std::vector<std::string>> batch_keys;
+  std::size_t batch_begin = 0;
+  for (std::size_t index = 0; index < patches.size(); ++index) {
+    const auto row = read_row(patches[index]);
+    std::vector<std::string> key = read_key(row);
+    std::vector<std::string> columns;
+    columns.reserve(row.size());
+    for (const auto& [column, value] : row) {
+      columns.emplace_back(column);
+    }
+
+    const std::size_t batch_size = index - batch_begin;
+    const bool fits = (batch_size + 1) * columns.size() <= MaxParameters;
+    const bool repeats_key = !key_names.empty() && batch_keys.contains(key);
+    if (batch_size != 0 && (columns != batch_columns || !fits || repeats_key)) {
+      batches.push_back(patches.subspan(batch_begin, batch_size));
+      batch_begin = index;
+      batch_keys.clear();
+    }
+    batch_columns = std::move(columns);
+    batch_keys.insert(std::move(key));
+  }
+  if (batch_begin < patches.size()) {
+    batches.push_back(patches.subspan(batch_begin));
+  }
+  return batches;
+}
+
+template <typename Sanitizer>
+inline auto BulkInsertQueryBuilder::make_data_extractor(
+    Sanitizer& value_sanitizer) -> CustomExtractorType<Sanitizer> {
+  return CustomExtractorType<Sanitizer>{
+      column_resolver_, enum_resolver_, value_sanitizer};
+}
+
+template <typename Sanitizer>
+inline auto BulkInsertQueryBuilder::add_row(
+    const CustomExtractorType<Sanitizer>& extractor) -> void {
+  const auto& extracted_data = extractor.extracted_data();
+  if (extracted_data.empty()) {
+    throw MalformedPatch(
+        "a patch with no fields is passed into bulk INSERT query builder");
+  }
+
+  const bool same_columns =
+      std::equal(columns_.begin(),
+                 columns_.end(),
+                 extracted_data.begin(),
+                 extracted_data.end(),
+                 [](const std::string& column, const auto& column_value) {
+                   return column == column_value.first;
+                 });
+  if (rows_ != 0 && !same_columns) {
+    throw MalformedPatch(
+        "patches with different fields are passed into a single bulk "
+        "INSERT query");
+  }
+
+  if (rows_ == 0) {
+    columns_.reserve(extracted_data.size());
+    for (const auto& [column, value] : extracted_data) {
+      columns_.emplace_back(column);
+    }
+  }
+
+  values_.append(rows_ == 0 ? "(" : ", (");
+  bool first = true;
+  for (const auto& [column, value] : extracted_data) {
+    values_.append(first ? "" : ", ");
+    values_.append(value);
+    first = false;
+  }
+  values_.push_back(')');
+  ++rows_;
+}
+
+template <typename... Columns>
+inline auto BulkInsertQueryBuilder::with_conflict_target(Columns... columns)
+    -> void {
+  static_assert((can_be_resolved_as_column_v<Columns> && ...),
+                "Can not resolve a column name for a given type");
+  conflict_target_ = {column_resolver_(columns)...};
+}
+
+inline auto BulkInsertQueryBuilder::compose() const -> std::string {
+  assert(!table_name_.empty());  // Must be validated in c-tor
+
+  if (rows_ == 0) {
+    throw MalformedPatch(
+        "no patches are passed into bulk INSERT query builder");
+  }
+
+  constexpr std::string_view separator = ", ";
+  std::string query = fmt::format("INSERT INTO {} ({}) VALUES {}",
+                                  table_name_,
+                                  fmt::join(columns_, separator),
+                                  values_);
+
+  if (!conflict_target_.empty()) {
+    const auto is_target = [&](const std::string& column) {
+      return std::find(conflict_target_.begin(),
+                       conflict_target_.end(),
+                       column) != conflict_target_.end();
+    };
+    for (const auto& column : conflict_target_) {
+      if (std::find(columns_.begin(), columns_.end(), column) ==
+          columns_.end()) {
+        throw MalformedPatch(fmt::format(
+            "bulk upsert patches do not specify the `{}' key field", column));
+      }
+    }
+
+    // A conflicting row is updated with its own key values when patches
+    // specify key columns only, so that the row is still returned
+    std::vector<std::string> updates;
+    for (const auto& column : columns_) {
+      if (!is_target(column)) {
+        updates.emplace_back(fmt::format("{0} = EXCLUDED.{0}", column));
+      }
+    }
+    if (updates.empty()) {
+      for (const auto& column : conflict_target_) {
+        updates.emplace_back(fmt::format("{0} = EXCLUDED.{0}", column));
+      }
+    }
+
+    fmt::format_to(std::back_inserter(query),
+                   " ON CONFLICT ({}) DO UPDATE SET {}",
+                   fmt::join(conflict_target_, separator),
+                   fmt::join(updates, separator));
+  }
+
+  query.append(" RETURNING *");
+  return query;
+}
+
+}  // namespace simulator::data_layer::internal_pqxx::detail
+
+#endif  // SIMULATOR_DATA_LAYER_IH_PQXX_QUERIES_DETAIL_BULK_INSERT_QUERY_BUILDER_HPP_
@@ -1,9 +1,12 @@
 #ifndef SIMULATOR_DATA_LAYER_IH_PQXX_QUERIES_DETAIL_PREDICATE_FORMATTER_HPP_
 #define SIMULATOR_DATA_LAYER_IH_PQXX_QUERIES_DETAIL_PREDICATE_FORMATTER_HPP_
 
-#include <fmt/ranges.h>
+#include <fmt/format.h>
 
 #include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
 
 #include "api/predicate/predicate.hpp"
 
@@ -27,14 +30,13 @@ class PredicateFormatter {
 
   template <typename Model>
   auto accept(const predicate::Expression<Model>& expression) {
-    lexemes_.clear();
+    formatted_.clear();
     expression.accept(*this);
   }
 
   [[nodiscard]]
   auto compose() const -> std::string {
-    constexpr std::string_view separator{" "};
-    return fmt::format("{}", fmt::join(lexemes_, separator));
+    return formatted_;
   }
 
   template <typename Column, typename Value>
@@ -44,7 +46,9 @@ class PredicateFormatter {
     const std::string col = column_resolver_(column);
     const std::string_view operation = format(basic_operation);
     const std::string val = sanitizer_(std::forward<Value>(value));
-    lexemes_.emplace_back(fmt::format("{} {} {}", col, operation, val));
+    separate();
+    fmt::format_to(
+        std::back_inserter(formatted_), "{} {} {}", col, operation, val);
   }
 
   template <typename Column, typename Value>
@@ -57,19 +61,30 @@ class PredicateFormatter {
 
   auto operator()([[maybe_unused]] predicate::SubExpressionBegin lexeme)
       -> void {
-    lexemes_.emplace_back("(");
+    append("(");
   }
 
   auto operator()([[maybe_unused]] predicate::SubExpressionEnd lexeme) -> void {
-    lexemes_.emplace_back(")");
+    append(")");
   }
 
   auto operator()(predicate::CompositeOperation composite_operation) -> void {
-    const std::string_view operation = format(composite_operation);
-    lexemes_.emplace_back(fmt::format("{}", operation));
+    append(format(composite_operation));
   }
 
  private:
+  // Lexemes are separated by a single space
+  auto separate() -> void {
+    if (!formatted_.empty()) {
+      formatted_.push_back(' ');
+    }
+  }
+
+  auto append(std::string_view lexeme) -> void {
+    separate();
+    formatted_.append(lexeme);
+  }
+
   constexpr static auto format(predicate::BasicOperation basic_operation)
       -> std::string_view {
     std::string_view value{};
@@ -110,7 +125,8 @@ class PredicateFormatter {
     return value;
   }
 
-  std::vector<std::string> lexemes_;
+  // Lexemes are written into a single buffer as they are visited
+  std::string formatted_;
 
   std::reference_wrapper<ColumnResolver> column_resolver_;
   std::reference_wrapper<EnumerationResolver> enum_resolver_;
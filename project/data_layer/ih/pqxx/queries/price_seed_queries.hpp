@@ -1,11 +1,15 @@
 #ifndef SIMULATOR_DATA_LAYER_IH_PQXX_QUERIES_PRICE_SEED_QUERIES_HPP_
 #define SIMULATOR_DATA_LAYER_IH_PQXX_QUERIES_PRICE_SEED_QUERIES_HPP_
 
+#include <span>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "api/inspectors/price_seed.hpp"
 #include "api/models/price_seed.hpp"
 #include "ih/pqxx/common/names/database_entries.hpp"
+#include "ih/pqxx/queries/detail/bulk_insert_query_builder.hpp"
 #include "ih/pqxx/queries/detail/delete_query_builder.hpp"
 #include "ih/pqxx/queries/detail/insert_query_builder.hpp"
 #include "ih/pqxx/queries/detail/select_query_builder.hpp"
@@ -53,6 +57,54 @@ class Insert {
   detail::InsertQueryBuilder builder_;
 };
 
+class InsertAll {
+ public:
+  using PatchType = data_layer::PriceSeed::Patch;
+
+  [[nodiscard]]
+  static auto split_into_batches(std::span<const PatchType> patches)
+      -> std::vector<std::span<const PatchType>> {
+    return detail::BulkInsertQueryBuilder::split_into_batches(
+        patches, [](const PatchType& patch, auto& data_extractor) {
+          using PatchReader = PriceSeedPatchReader<
+              std::remove_reference_t<decltype(data_extractor)>>;
+          PatchReader reader{data_extractor};
+          reader.read(patch);
+        });
+  }
+
+  template <typename Sanitizer>
+  static auto prepare(std::span<const PatchType> patches,
+                      Sanitizer& sanitizer) -> InsertAll {
+    InsertAll query{};
+    for (const PatchType& patch : patches) {
+      query.build(patch, sanitizer);
+    }
+    return query;
+  }
+
+  [[nodiscard]]
+  auto compose() const -> std::string {
+    return builder_.compose();
+  }
+
+ private:
+  InsertAll() : builder_(std::string{table::PriceSeed}) {}
+
+  template <typename Sanitizer>
+  auto build(const PatchType& patch, Sanitizer& sanitizer) -> void {
+    auto data_extractor = builder_.make_data_extractor(sanitizer);
+
+    using PatchReader = PriceSeedPatchReader<decltype(data_extractor)>;
+    PatchReader reader{data_extractor};
+    reader.read(patch);
+
+    builder_.add_row(data_extractor);
+  }
+
+  detail::BulkInsertQueryBuilder builder_;
+};
+
 class Select {
  public:
   using Predicate = predicate::Expression<PriceSeed>;
@@ -5,6 +5,7 @@
 
 #include "cfg/api/cfg.hpp"
 #include "data_layer/api/database/context.hpp"
+#include "data_layer/api/database/pool_statistics.hpp"
 #include "data_layer/api/exceptions/exceptions.hpp"
 #include "data_layer/api/models/datasource.hpp"
 #include "data_layer/api/models/listing.hpp"
@@ -21,6 +22,9 @@ auto create_pqxx_connection(std::string connection_string) -> database::Context;
 
 auto ping(const database::Context& context) noexcept -> bool;
 
+// Reports usage of the connection pool of the database context
+auto pool_statistics(const database::Context& context) -> PoolStatistics;
+
 }  // namespace simulator::data_layer::database
 
 namespace simulator::data_layer {
@@ -50,6 +54,19 @@ auto update_one_datasource(const database::Context& context,
 auto insert_listing(const database::Context& context,
                     Listing::Patch initial_patch) -> data_layer::Listing;
 
+// Inserts all listings in a single transaction,
+// returns inserted listings in the order of patches
+auto insert_listings(const database::Context& context,
+                     std::vector<Listing::Patch> initial_patches)
+    -> std::vector<data_layer::Listing>;
+
+// Updates listings identified by the listing identifier of a patch
+// and inserts patches without one in a single transaction,
+// returns listings in the order of patches
+auto upsert_listings(const database::Context& context,
+                     std::vector<Listing::Patch> patches)
+    -> std::vector<data_layer::Listing>;
+
 auto select_one_listing(const database::Context& context,
                         Listing::Predicate predicate) -> data_layer::Listing;
 
@@ -66,6 +83,19 @@ auto update_one_listing(const database::Context& context,
 auto insert_price_seed(const database::Context& context,
                        PriceSeed::Patch initial_patch) -> data_layer::PriceSeed;
 
+// Inserts all price seeds in a single transaction,
+// returns inserted price seeds in the order of patches
+auto insert_price_seeds(const database::Context& context,
+                        std::vector<PriceSeed::Patch> initial_patches)
+    -> std::vector<data_layer::PriceSeed>;
+
+// Updates price seeds identified by the price seed identifier of a patch
+// and inserts patches without one in a single transaction,
+// returns price seeds in the order of patches
+auto upsert_price_seeds(const database::Context& context,
+                        std::vector<PriceSeed::Patch> patches)
+    -> std::vector<data_layer::PriceSeed>;
+
 auto select_one_price_seed(const database::Context& context,
                            PriceSeed::Predicate predicate)
     -> data_layer::PriceSeed;
@@ -98,6 +128,20 @@ auto delete_all_price_seeds(
 auto insert_setting(const database::Context& context,
                     Setting::Patch initial_patch) -> data_layer::Setting;
 
+// Inserts all settings in a single transaction,
+// returns inserted settings in the order of patches.
+// Each patch must specify the key
+auto insert_settings(const database::Context& context,
+                     std::vector<Setting::Patch> initial_patches)
+    -> std::vector<data_layer::Setting>;
+
+// Inserts settings or updates ones existing with the same key
+// in a single transaction, returns settings in the order of patches.
+// Patches repeating a key are applied in order
+auto upsert_settings(const database::Context& context,
+                     std::vector<Setting::Patch> patches)
+    -> std::vector<data_layer::Setting>;
+
 auto select_one_setting(const database::Context& context,
                         Setting::Predicate predicate) -> data_layer::Setting;
 
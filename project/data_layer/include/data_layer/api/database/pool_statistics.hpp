@@ -0,0 +1,27 @@
+#ifndef SIMULATOR_DATA_LAYER_INCLUDE_DATA_LAYER_API_DATABASE_POOL_STATISTICS_HPP_
+#define SIMULATOR_DATA_LAYER_INCLUDE_DATA_LAYER_API_DATABASE_POOL_STATISTICS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace simulator::data_layer::database {
+
+// Counters of a database connection pool since it has been opened,
+// along with the current state of its connections
+struct PoolStatistics {
+  std::uint64_t acquisitions = 0;
+  std::uint64_t waited_acquisitions = 0;
+  std::uint64_t timed_out_acquisitions = 0;
+  std::uint64_t opened_connections = 0;
+  std::uint64_t closed_connections = 0;
+  std::chrono::microseconds total_wait{0};
+  std::chrono::microseconds max_wait{0};
+  std::size_t in_use = 0;
+  std::size_t idle = 0;
+  std::size_t max_size = 0;
+};
+
+}  // namespace simulator::data_layer::database
+
+#endif  // SIMULATOR_DATA_LAYER_INCLUDE_DATA_LAYER_API_DATABASE_POOL_STATISTICS_HPP_
@@ -415,6 +415,12 @@ inline auto ListingPatchReader<Marshaller>::read(const Listing::Patch& patch)
 template <typename Unmarshaller>
 inline auto ListingPatchWriter<Unmarshaller>::write(Listing::Patch& patch)
     -> void {
+  std::uint64_t listing_id{};
+  static_assert(can_unmarshall_v<decltype(listing_id)>);
+  if (unmarshaller_(Attribute::ListingId, listing_id)) {
+    patch.with_listing_id(listing_id);
+  }
+
   std::string symbol{};
   static_assert(can_unmarshall_v<decltype(symbol)>);
   if (unmarshaller_(Attribute::Symbol, symbol)) {
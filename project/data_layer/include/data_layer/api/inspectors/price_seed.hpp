@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_DATA_LAYER_API_COMMON_INSPECTORS_PRICE_SEED_HPP_
 #define SIMULATOR_DATA_LAYER_API_COMMON_INSPECTORS_PRICE_SEED_HPP_
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <type_traits>
@@ -186,6 +187,12 @@ auto PriceSeedPatchReader<Marshaller>::read(const PriceSeed::Patch& patch)
 template <typename Unmarshaller>
 auto PriceSeedPatchWriter<Unmarshaller>::write(PriceSeed::Patch& patch)
     -> void {
+  std::uint64_t price_seed_id{};
+  static_assert(can_unmarshall_v<decltype(price_seed_id)>);
+  if (unmarshaller_(Attribute::PriceSeedId, price_seed_id)) {
+    patch.with_price_seed_id(price_seed_id);
+  }
+
   std::string symbol{};
   static_assert(can_unmarshall_v<decltype(symbol)>);
   if (unmarshaller_(Attribute::Symbol, symbol)) {
@@ -142,6 +142,11 @@ auto VenueReader<Marshaller>::read(const Venue& venue) -> void {
     marshaller_(Attribute::TnsPartiesEnabled, *value);
   }
 
+  if (const auto& value = venue.tns_history_depth()) {
+    static_assert(can_marshall_v<decltype(*value)>);
+    marshaller_(Attribute::TnsHistoryDepth, *value);
+  }
+
   if (const auto& value = venue.timezone()) {
     static_assert(can_marshall_v<decltype(*value)>);
     marshaller_(Attribute::Timezone, *value);
@@ -161,6 +166,11 @@ auto VenueReader<Marshaller>::read(const Venue& venue) -> void {
     static_assert(can_marshall_v<decltype(*value)>);
     marshaller_(Attribute::PersistenceFilePath, *value);
   }
+
+  if (const auto& value = venue.self_trade_prevention()) {
+    static_assert(can_marshall_v<decltype(*value)>);
+    marshaller_(Attribute::SelfTradePrevention, *value);
+  }
 }
 
 template <typename Marshaller>
@@ -236,6 +246,11 @@ inline auto VenuePatchReader<Marshaller>::read(const Venue::Patch& patch)
     marshaller_(Attribute::TnsPartiesEnabled, *value);
   }
 
+  if (const auto& value = patch.tns_history_depth()) {
+    static_assert(can_marshall_v<decltype(*value)>);
+    marshaller_(Attribute::TnsHistoryDepth, *value);
+  }
+
   if (const auto& value = patch.timezone()) {
     static_assert(can_marshall_v<decltype(*value)>);
     marshaller_(Attribute::Timezone, *value);
@@ -255,6 +270,11 @@ inline auto VenuePatchReader<Marshaller>::read(const Venue::Patch& patch)
     static_assert(can_marshall_v<decltype(*value)>);
     marshaller_(Attribute::PersistenceFilePath, *value);
   }
+
+  if (const auto& value = patch.self_trade_prevention()) {
+    static_assert(can_marshall_v<decltype(*value)>);
+    marshaller_(Attribute::SelfTradePrevention, *value);
+  }
 }
 
 template <typename Unmarshaller>
@@ -343,6 +363,12 @@ inline auto VenuePatchWriter<Unmarshaller>::write(Venue::Patch& patch) -> void {
     patch.with_tns_parties_enabled_flag(tns_parties_enabled);
   }
 
+  std::uint32_t tns_history_depth{};
+  static_assert(can_unmarshall_v<decltype(tns_history_depth)>);
+  if (unmarshaller_(Attribute::TnsHistoryDepth, tns_history_depth)) {
+    patch.with_tns_history_depth(tns_history_depth);
+  }
+
   std::string timezone{};
   static_assert(can_unmarshall_v<decltype(timezone)>);
   if (unmarshaller_(Attribute::Timezone, timezone)) {
@@ -366,6 +392,12 @@ inline auto VenuePatchWriter<Unmarshaller>::write(Venue::Patch& patch) -> void {
   if (unmarshaller_(Attribute::PersistenceFilePath, persistence_file_path)) {
     patch.with_persistence_file_path(std::move(persistence_file_path));
   }
+
+  Venue::SelfTradePrevention self_trade_prevention{};
+  static_assert(can_unmarshall_v<decltype(self_trade_prevention)>);
+  if (unmarshaller_(Attribute::SelfTradePrevention, self_trade_prevention)) {
+    patch.with_self_trade_prevention(self_trade_prevention);
+  }
 }
 
 }  // namespace simulator::data_layer
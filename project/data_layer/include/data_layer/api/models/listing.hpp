@@ -215,6 +215,12 @@ class Listing::Patch {
  public:
   using Attribute = Listing::Attribute;
 
+  // Identifies a stored listing a bulk upsert updates,
+  // is never written into a listing record
+  [[nodiscard]]
+  auto listing_id() const noexcept -> const std::optional<std::uint64_t>&;
+  auto with_listing_id(std::uint64_t id) noexcept -> Patch&;
+
   [[nodiscard]]
   auto symbol() const noexcept -> const std::optional<std::string>&;
   auto with_symbol(std::string symbol) noexcept -> Patch&;
@@ -356,6 +362,7 @@ class Listing::Patch {
   auto with_random_aggressive_amt_maximum(double amount) noexcept -> Patch&;
 
  private:
+  std::optional<std::uint64_t> listing_id_;
   std::optional<std::string> symbol_;
   std::optional<std::string> venue_id_;
   std::optional<std::string> security_type_;
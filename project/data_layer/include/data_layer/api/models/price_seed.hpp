@@ -90,6 +90,12 @@ class PriceSeed::Patch {
  public:
   using Attribute = PriceSeed::Attribute;
 
+  // Identifies a stored price seed a bulk upsert updates,
+  // is never written into a price seed record
+  [[nodiscard]]
+  auto price_seed_id() const noexcept -> const std::optional<std::uint64_t>&;
+  auto with_price_seed_id(std::uint64_t id) noexcept -> Patch&;
+
   [[nodiscard]]
   auto symbol() const noexcept -> const std::optional<std::string>&;
   auto with_symbol(std::string symbol) noexcept -> Patch&;
@@ -131,6 +137,7 @@ class PriceSeed::Patch {
   auto with_last_update(std::string update_timestamp) noexcept -> Patch&;
 
  private:
+  std::optional<std::uint64_t> price_seed_id_;
   std::optional<std::string> symbol_;
   std::optional<std::string> security_type_;
   std::optional<std::string> price_currency_;
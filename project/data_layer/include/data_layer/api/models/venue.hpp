@@ -31,14 +31,27 @@ class Venue {
     TnsQtyEnabled,
     TnsSideEnabled,
     TnsPartiesEnabled,
+    TnsHistoryDepth,
     Timezone,
     CancelOnDisconnect,
     PersistenceEnabled,
     PersistenceFilePath,
+    SelfTradePrevention,
   };
 
   enum class EngineType { Matching, Quoting };
 
+  enum class SelfTradePrevention {
+    None,
+    CancelNewest,
+    CancelOldest,
+    CancelBoth,
+    Decrement
+  };
+
+  // The greatest number of recent trades a venue may keep per listing
+  constexpr inline static std::uint32_t MaxTnsHistoryDepth = 1000;
+
   [[nodiscard]]
   static auto create(Patch snapshot) -> Venue;
 
@@ -85,6 +98,9 @@ class Venue {
   [[nodiscard]]
   auto tns_parties_enabled_flag() const noexcept -> std::optional<bool>;
 
+  [[nodiscard]]
+  auto tns_history_depth() const noexcept -> std::optional<std::uint32_t>;
+
   [[nodiscard]]
   auto timezone() const noexcept -> const std::optional<std::string>&;
 
@@ -98,6 +114,10 @@ class Venue {
   auto persistence_file_path() const noexcept
       -> const std::optional<std::string>&;
 
+  [[nodiscard]]
+  auto self_trade_prevention() const noexcept
+      -> std::optional<SelfTradePrevention>;
+
   [[nodiscard]]
   auto market_phases() const noexcept -> const std::vector<MarketPhase>&;
 
@@ -113,8 +133,10 @@ class Venue {
   std::vector<data_layer::MarketPhase> market_phases_;
 
   std::optional<std::uint32_t> random_parties_count_;
+  std::optional<std::uint32_t> tns_history_depth_;
 
   std::optional<EngineType> engine_type_;
+  std::optional<SelfTradePrevention> self_trade_prevention_;
 
   std::optional<std::uint16_t> rest_port_;
 
@@ -194,6 +216,10 @@ class Venue::Patch {
   auto tns_parties_enabled_flag() const noexcept -> std::optional<bool>;
   auto with_tns_parties_enabled_flag(bool flag) noexcept -> Patch&;
 
+  [[nodiscard]]
+  auto tns_history_depth() const noexcept -> std::optional<std::uint32_t>;
+  auto with_tns_history_depth(std::uint32_t depth) noexcept -> Patch&;
+
   [[nodiscard]]
   auto timezone() const noexcept -> const std::optional<std::string>&;
   auto with_timezone(std::string timezone) noexcept -> Patch&;
@@ -211,6 +237,12 @@ class Venue::Patch {
       -> const std::optional<std::string>&;
   auto with_persistence_file_path(std::string path) noexcept -> Patch&;
 
+  [[nodiscard]]
+  auto self_trade_prevention() const noexcept
+      -> std::optional<SelfTradePrevention>;
+  auto with_self_trade_prevention(SelfTradePrevention mode) noexcept
+      -> Patch&;
+
   [[nodiscard]]
   auto market_phases() const noexcept
       -> const std::optional<std::vector<MarketPhase::Patch>>&;
@@ -226,8 +258,10 @@ class Venue::Patch {
   std::optional<std::vector<MarketPhase::Patch>> patched_market_phases_;
 
   std::optional<std::uint32_t> patched_random_parties_count_;
+  std::optional<std::uint32_t> patched_tns_history_depth_;
 
   std::optional<EngineType> patched_engine_type_;
+  std::optional<SelfTradePrevention> patched_self_trade_prevention_;
 
   std::optional<std::uint16_t> patched_rest_port_;
 
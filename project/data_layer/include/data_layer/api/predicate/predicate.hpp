@@ -41,7 +41,8 @@ struct ModelTraits<data_layer::Setting> {
 template <>
 struct ModelTraits<data_layer::Venue> {
   using AttributeType = Venue::Attribute;
-  using CustomFieldTypes = std::tuple<Venue::EngineType>;
+  using CustomFieldTypes =
+      std::tuple<Venue::EngineType, Venue::SelfTradePrevention>;
 };
 
 }  // namespace predicate
@@ -9,6 +9,7 @@
 #include "ih/common/command/handlers.hpp"
 #include "ih/common/database/driver.hpp"
 #include "ih/common/database/ping_agent.hpp"
+#include "ih/common/database/pool_inspector.hpp"
 #include "ih/pqxx/context.hpp"
 
 namespace simulator::data_layer::database {
@@ -27,6 +28,10 @@ auto ping(const database::Context& context) noexcept -> bool {
   return PingAgent::ping(context);
 }
 
+auto pool_statistics(const database::Context& context) -> PoolStatistics {
+  return PoolInspector::inspect(context);
+}
+
 }  // namespace simulator::data_layer::database
 
 namespace simulator::data_layer {
@@ -78,6 +83,26 @@ auto insert_listing(const database::Context& context,
   return Listing{std::move(command.result())};
 }
 
+auto insert_listings(const database::Context& context,
+                     std::vector<Listing::Patch> initial_patches)
+    -> std::vector<Listing> {
+  using Command = data_layer::command::InsertAll<Listing>;
+  auto command = Command::create(std::move(initial_patches));
+  ListingCommandHandler<Command>::handle(command, context);
+
+  return std::vector<Listing>{std::move(command.result())};
+}
+
+auto upsert_listings(const database::Context& context,
+                     std::vector<Listing::Patch> patches)
+    -> std::vector<Listing> {
+  using Command = data_layer::command::UpsertAll<Listing>;
+  auto command = Command::create(std::move(patches));
+  ListingCommandHandler<Command>::handle(command, context);
+
+  return std::vector<Listing>{std::move(command.result())};
+}
+
 auto select_one_listing(const database::Context& context,
                         Listing::Predicate predicate) -> Listing {
   using Command = data_layer::command::SelectOne<Listing>;
@@ -116,6 +141,26 @@ auto insert_price_seed(const database::Context& context,
   return PriceSeed{std::move(command.result())};
 }
 
+auto insert_price_seeds(const database::Context& context,
+                        std::vector<PriceSeed::Patch> initial_patches)
+    -> std::vector<PriceSeed> {
+  using Command = data_layer::command::InsertAll<PriceSeed>;
+  auto command = Command::create(std::move(initial_patches));
+  PriceSeedCommandHandler<Command>::handle(command, context);
+
+  return std::vector<PriceSeed>{std::move(command.result())};
+}
+
+auto upsert_price_seeds(const database::Context& context,
+                        std::vector<PriceSeed::Patch> patches)
+    -> std::vector<PriceSeed> {
+  using Command = data_layer::command::UpsertAll<PriceSeed>;
+  auto command = Command::create(std::move(patches));
+  PriceSeedCommandHandler<Command>::handle(command, context);
+
+  return std::vector<PriceSeed>{std::move(command.result())};
+}
+
 auto select_one_price_seed(const database::Context& context,
                            PriceSeed::Predicate predicate) -> PriceSeed {
   using Command = data_layer::command::SelectOne<PriceSeed>;
@@ -180,6 +225,26 @@ auto insert_setting(const database::Context& context,
   return Setting{std::move(command.result())};
 }
 
+auto insert_settings(const database::Context& context,
+                     std::vector<Setting::Patch> initial_patches)
+    -> std::vector<Setting> {
+  using Command = data_layer::command::InsertAll<Setting>;
+  auto command = Command::create(std::move(initial_patches));
+  SettingCommandHandler<Command>::handle(command, context);
+
+  return std::vector<Setting>{std::move(command.result())};
+}
+
+auto upsert_settings(const database::Context& context,
+                     std::vector<Setting::Patch> patches)
+    -> std::vector<Setting> {
+  using Command = data_layer::command::UpsertAll<Setting>;
+  auto command = Command::create(std::move(patches));
+  SettingCommandHandler<Command>::handle(command, context);
+
+  return std::vector<Setting>{std::move(command.result())};
+}
+
 auto select_one_setting(const database::Context& context,
                         Setting::Predicate predicate) -> data_layer::Setting {
   using Command = data_layer::command::SelectOne<Setting>;
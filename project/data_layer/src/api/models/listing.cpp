@@ -215,6 +215,16 @@ auto Listing::random_aggressive_amt_maximum() const noexcept
   return random_aggressive_amt_maximum_;
 }
 
+auto Listing::Patch::listing_id() const noexcept
+    -> const std::optional<std::uint64_t>& {
+  return listing_id_;
+}
+
+auto Listing::Patch::with_listing_id(std::uint64_t id) noexcept -> Patch& {
+  listing_id_ = id;
+  return *this;
+}
+
 auto Listing::Patch::symbol() const noexcept
     -> const std::optional<std::string>& {
   return symbol_;
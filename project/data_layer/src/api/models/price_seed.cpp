@@ -81,6 +81,17 @@ auto PriceSeed::last_update() const noexcept
   return last_update_;
 }
 
+auto PriceSeed::Patch::price_seed_id() const noexcept
+    -> const std::optional<std::uint64_t>& {
+  return price_seed_id_;
+}
+
+auto PriceSeed::Patch::with_price_seed_id(std::uint64_t id) noexcept
+    -> Patch& {
+  price_seed_id_ = id;
+  return *this;
+}
+
 auto PriceSeed::Patch::symbol() const noexcept
     -> const std::optional<std::string>& {
   return symbol_;
@@ -27,7 +27,9 @@ auto Venue::create(Patch snapshot) -> Venue {
   SIM_ASSIGN_FIELD(timezone_, patched_timezone_);
   SIM_ASSIGN_FIELD(persistence_file_path_, patched_persistence_file_path_);
   SIM_ASSIGN_FIELD(random_parties_count_, patched_random_parties_count_);
+  SIM_ASSIGN_FIELD(tns_history_depth_, patched_tns_history_depth_);
   SIM_ASSIGN_FIELD(engine_type_, patched_engine_type_);
+  SIM_ASSIGN_FIELD(self_trade_prevention_, patched_self_trade_prevention_);
   SIM_ASSIGN_FIELD(rest_port_, patched_rest_port_);
   SIM_ASSIGN_FIELD(support_tif_ioc_flag_, patched_support_tif_ioc_flag_);
   SIM_ASSIGN_FIELD(support_tif_fok_flag_, patched_support_tif_fok_flag_);
@@ -118,6 +120,11 @@ auto Venue::tns_parties_enabled_flag() const noexcept -> std::optional<bool> {
   return tns_parties_enabled_flag_;
 }
 
+auto Venue::tns_history_depth() const noexcept
+    -> std::optional<std::uint32_t> {
+  return tns_history_depth_;
+}
+
 auto Venue::timezone() const noexcept -> const std::optional<std::string>& {
   return timezone_;
 }
@@ -135,6 +142,11 @@ auto Venue::persistence_file_path() const noexcept
   return persistence_file_path_;
 }
 
+auto Venue::self_trade_prevention() const noexcept
+    -> std::optional<SelfTradePrevention> {
+  return self_trade_prevention_;
+}
+
 auto Venue::market_phases() const noexcept -> const std::vector<MarketPhase>& {
   return market_phases_;
 }
@@ -276,6 +288,17 @@ auto Venue::Patch::with_tns_parties_enabled_flag(bool flag) noexcept -> Patch& {
   return *this;
 }
 
+auto Venue::Patch::tns_history_depth() const noexcept
+    -> std::optional<std::uint32_t> {
+  return patched_tns_history_depth_;
+}
+
+auto Venue::Patch::with_tns_history_depth(std::uint32_t depth) noexcept
+    -> Patch& {
+  patched_tns_history_depth_ = depth;
+  return *this;
+}
+
 auto Venue::Patch::timezone() const noexcept
     -> const std::optional<std::string>& {
   return patched_timezone_;
@@ -318,6 +341,17 @@ auto Venue::Patch::with_persistence_file_path(std::string path) noexcept
   return *this;
 }
 
+auto Venue::Patch::self_trade_prevention() const noexcept
+    -> std::optional<SelfTradePrevention> {
+  return patched_self_trade_prevention_;
+}
+
+auto Venue::Patch::with_self_trade_prevention(SelfTradePrevention mode) noexcept
+    -> Patch& {
+  patched_self_trade_prevention_ = mode;
+  return *this;
+}
+
 auto Venue::Patch::market_phases() const noexcept
     -> const std::optional<std::vector<MarketPhase::Patch>>& {
   return patched_market_phases_;
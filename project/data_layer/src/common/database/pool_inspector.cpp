@@ -0,0 +1,20 @@
+#include "ih/common/database/pool_inspector.hpp"
+
+#include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
+
+namespace simulator::data_layer::database {
+
+auto PoolInspector::inspect(const database::Context& context)
+    -> PoolStatistics {
+  PoolInspector inspector;
+  inspector.resolve(context);
+  return inspector.statistics_;
+}
+
+auto PoolInspector::execute_with(const internal_pqxx::Context& pqxx_context)
+    -> void {
+  statistics_ = pqxx_context.connection_pool().statistics();
+}
+
+}  // namespace simulator::data_layer::database
@@ -367,6 +367,9 @@ auto ColumnResolver::to_column_name(Venue::Attribute attribute) -> std::string {
     case Venue::Attribute::TnsPartiesEnabled:
       column_name = venue_column::TnsPartiesEnabled;
       break;
+    case Venue::Attribute::TnsHistoryDepth:
+      column_name = venue_column::TnsHistoryDepth;
+      break;
     case Venue::Attribute::Timezone:
       column_name = venue_column::Timezone;
       break;
@@ -379,6 +382,9 @@ auto ColumnResolver::to_column_name(Venue::Attribute attribute) -> std::string {
     case Venue::Attribute::PersistenceFilePath:
       column_name = venue_column::PersistenceFilePath;
       break;
+    case Venue::Attribute::SelfTradePrevention:
+      column_name = venue_column::SelfTradePrevention;
+      break;
   }
 
   if (!column_name.empty()) {
@@ -50,6 +50,17 @@ auto EnumerationResolver::operator()(std::string_view engine_type,
   EnumerationResolver::from_string(engine_type, value);
 }
 
+auto EnumerationResolver::operator()(Venue::SelfTradePrevention mode) const
+    -> std::string {
+  return EnumerationResolver::to_string(mode);
+}
+
+auto EnumerationResolver::operator()(
+    std::string_view mode, data_layer::Venue::SelfTradePrevention& value) const
+    -> void {
+  EnumerationResolver::from_string(mode, value);
+}
+
 auto EnumerationResolver::to_string(Datasource::Format format) -> std::string {
   std::string_view string{};
   switch (format) {
@@ -178,4 +189,55 @@ auto EnumerationResolver::from_string(std::string_view string,
   }
 }
 
+auto EnumerationResolver::to_string(Venue::SelfTradePrevention value)
+    -> std::string {
+  std::string_view string{};
+  switch (value) {
+    case Venue::SelfTradePrevention::None:
+      string = internal_pqxx::venue_self_trade_prevention::None;
+      break;
+    case Venue::SelfTradePrevention::CancelNewest:
+      string = internal_pqxx::venue_self_trade_prevention::CancelNewest;
+      break;
+    case Venue::SelfTradePrevention::CancelOldest:
+      string = internal_pqxx::venue_self_trade_prevention::CancelOldest;
+      break;
+    case Venue::SelfTradePrevention::CancelBoth:
+      string = internal_pqxx::venue_self_trade_prevention::CancelBoth;
+      break;
+    case Venue::SelfTradePrevention::Decrement:
+      string = internal_pqxx::venue_self_trade_prevention::Decrement;
+      break;
+  }
+
+  if (!string.empty()) {
+    return std::string{string};
+  }
+  throw EnumEncodingError("Venue::SelfTradePrevention", value);
+}
+
+auto EnumerationResolver::from_string(
+    std::string_view string, data_layer::Venue::SelfTradePrevention& value)
+    -> void {
+  using internal_pqxx::venue_self_trade_prevention::CancelBoth;
+  using internal_pqxx::venue_self_trade_prevention::CancelNewest;
+  using internal_pqxx::venue_self_trade_prevention::CancelOldest;
+  using internal_pqxx::venue_self_trade_prevention::Decrement;
+  using internal_pqxx::venue_self_trade_prevention::None;
+
+  if (string == None) {
+    value = Venue::SelfTradePrevention::None;
+  } else if (string == CancelNewest) {
+    value = Venue::SelfTradePrevention::CancelNewest;
+  } else if (string == CancelOldest) {
+    value = Venue::SelfTradePrevention::CancelOldest;
+  } else if (string == CancelBoth) {
+    value = Venue::SelfTradePrevention::CancelBoth;
+  } else if (string == Decrement) {
+    value = Venue::SelfTradePrevention::Decrement;
+  } else {
+    throw EnumDecodingError("Venue::SelfTradePrevention", string);
+  }
+}
+
 }  // namespace simulator::data_layer::internal_pqxx
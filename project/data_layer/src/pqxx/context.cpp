@@ -2,12 +2,16 @@
 
 #include <fmt/format.h>
 
+#include <chrono>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
 
 #include "cfg/api/cfg.hpp"
 #include "ih/common/exceptions.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
+#include "ih/pqxx/database/connector.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
@@ -62,13 +66,26 @@ auto Context::Configurator::format_connection_string() const -> std::string {
                      fmt::arg("dbname", database_));
 }
 
-Context::Context(std::string connection_string) noexcept
-    : connection_(std::move(connection_string)) {}
+Context::Context() { reset_connection_pool(); }
+
+Context::Context(std::string connection_string)
+    : connection_(std::move(connection_string)) {
+  reset_connection_pool();
+}
 
 auto Context::get_connection_string() const noexcept -> const std::string& {
   return connection_;
 }
 
+auto Context::get_pool_settings() const noexcept
+    -> const database::PoolSettings& {
+  return pool_settings_;
+}
+
+auto Context::connection_pool() const noexcept -> ConnectionPool& {
+  return *pool_;
+}
+
 auto Context::configure(const cfg::DbConfiguration& cfg) -> void {
   Configurator configurator;
   configurator.with_host(cfg.host);
@@ -78,6 +95,22 @@ auto Context::configure(const cfg::DbConfiguration& cfg) -> void {
   configurator.with_database(cfg.name);
 
   connection_ = configurator.format_connection_string();
+
+  if (cfg.pool_size > 0) {
+    pool_settings_.max_size = static_cast<std::size_t>(cfg.pool_size);
+  }
+  if (cfg.pool_idle_timeout > 0) {
+    pool_settings_.idle_timeout = std::chrono::seconds{cfg.pool_idle_timeout};
+  }
+  reset_connection_pool();
+}
+
+auto Context::reset_connection_pool() -> void {
+  // Connections are opened lazily, on the first checkout
+  pool_ = std::make_shared<ConnectionPool>(
+      pool_settings_, [connection = connection_] {
+        return Connection{Connector::connect(connection), PreparedStatements{}};
+      });
 }
 
 }  // namespace simulator::data_layer::internal_pqxx
\ No newline at end of file
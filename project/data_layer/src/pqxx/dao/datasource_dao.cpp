@@ -7,20 +7,20 @@
 
 #include "api/validations/datasource.hpp"
 #include "ih/pqxx/database/connector.hpp"
+#include "ih/pqxx/database/query_parameters.hpp"
 #include "ih/pqxx/database/transaction.hpp"
-#include "ih/pqxx/database/value_sanitizer.hpp"
 #include "ih/pqxx/queries/datasource_queries.hpp"
 #include "ih/pqxx/result/datasource_parser.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
-DatasourceDao::DatasourceDao(pqxx::connection pqxx_connection) noexcept
+DatasourceDao::DatasourceDao(PooledConnection pqxx_connection) noexcept
     : connection_(std::move(pqxx_connection)) {}
 
 auto DatasourceDao::setup_with(const internal_pqxx::Context& context)
     -> DatasourceDao {
-  return DatasourceDao{internal_pqxx::Connector::connect(context)};
+  return DatasourceDao{internal_pqxx::Connector::acquire(context)};
 }
 
 auto DatasourceDao::execute(InsertCommand& command) -> void {
@@ -29,7 +29,7 @@ auto DatasourceDao::execute(InsertCommand& command) -> void {
     throw MalformedPatch{valid.error()};
   }
 
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
 
   Datasource inserted = insert(snapshot, transaction.handler());
 
@@ -38,7 +38,7 @@ auto DatasourceDao::execute(InsertCommand& command) -> void {
 }
 
 auto DatasourceDao::execute(SelectOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Predicate& predicate = command.predicate();
 
   Datasource selected = select_single(predicate, transaction.handler());
@@ -48,7 +48,7 @@ auto DatasourceDao::execute(SelectOneCommand& command) -> void {
 }
 
 auto DatasourceDao::execute(SelectAllCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
 
   std::vector<Datasource> selected =
       select_all(command.predicate(), transaction.handler());
@@ -63,7 +63,7 @@ auto DatasourceDao::execute(UpdateOneCommand& command) -> void {
     throw MalformedPatch{valid.error()};
   }
 
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Predicate& predicate = command.predicate();
 
   Datasource updated = update(patch, predicate, transaction.handler());
@@ -77,14 +77,14 @@ auto DatasourceDao::insert(const Datasource::Patch& snapshot,
     -> Datasource {
   using Query = datasource_query::Insert;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare(snapshot, sanitizer).returning_id().compose();
+      Query::prepare(snapshot, parameters).returning_id().compose();
 
   log::debug("executing `{}'", query);
   const pqxx::row result = [&] {
     try {
-      return transaction_handler.exec1(query);
+      return transaction_handler.exec1(query, parameters.values());
     } catch (const std::exception& exception) {
       log::warn("datasource insertion failed, error: `{}'", exception.what());
       throw;
@@ -107,11 +107,13 @@ auto DatasourceDao::select_single(const Predicate& predicate,
                                   Transaction::Handler transaction_handler)
     -> Datasource {
   using Query = datasource_query::Select;
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare().by(predicate, sanitizer).compose();
+  QueryParameters parameters{};
+  const std::string query =
+      Query::prepare().by(predicate, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("datasource selection query executed");
 
   Datasource selected_datasource =
@@ -123,12 +125,13 @@ auto DatasourceDao::select_single(std::uint64_t datasource_id,
                                   Transaction::Handler transaction_handler)
     -> Datasource {
   using Query = datasource_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_datasource_id(datasource_id, sanitizer).compose();
+      Query::prepare().by_datasource_id(datasource_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("datasource selection query executed");
 
   Datasource selected_datasource =
@@ -141,16 +144,17 @@ auto DatasourceDao::select_all(const std::optional<Predicate>& predicate,
                                Transaction::Handler transaction_handler)
     -> std::vector<Datasource> {
   using Query = datasource_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query = [&] {
     if (predicate.has_value()) {
-      return Query::prepare().by(*predicate, sanitizer).compose();
+      return Query::prepare().by(*predicate, parameters).compose();
     }
     return Query::prepare().compose();
   }();
 
   log::debug("executing `{}'", query);
-  const pqxx::result selected = transaction_handler.exec(query);
+  const pqxx::result selected =
+      transaction_handler.exec(query, parameters.values());
   log::debug("Datasource selection query executed, {} record retrieved",
              selected.size());
 
@@ -170,14 +174,15 @@ auto DatasourceDao::update(const Datasource::Patch& patch,
     -> Datasource {
   using Query = datasource_query::Update;
 
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare(patch, sanitizer)
-                                .by(predicate, sanitizer)
+  QueryParameters parameters{};
+  const std::string query = Query::prepare(patch, parameters)
+                                .by(predicate, parameters)
                                 .returning_id()
                                 .compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row result = transaction_handler.exec1(query);
+  const pqxx::row result =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("datasource update query was executed");
 
   log::debug("decoding an updated datasource record identifier");
@@ -231,14 +236,14 @@ auto DatasourceDao::insert_columns_mapping(
     Transaction::Handler transaction_handler) const -> void {
   using Query = column_mapping_query::Insert;
 
-  ValueSanitizer sanitizer{connection_};
   log::debug("inserting {} column mapping records", column_mappings.size());
 
   for (const auto& mapping : column_mappings) {
-    const std::string query = Query::prepare(mapping, sanitizer).compose();
+    QueryParameters parameters{};
+    const std::string query = Query::prepare(mapping, parameters).compose();
     log::debug("executing `{}", query);
     try {
-      transaction_handler.exec0(query);
+      transaction_handler.exec0(query, parameters.values());
       log::debug("column mapping insertion query executed");
     } catch (const std::exception& exception) {
       log::warn("failed to inset a column mapping, error occurred: `{}'",
@@ -252,12 +257,13 @@ auto DatasourceDao::select_columns_mapping(
     -> std::vector<ColumnMapping::Patch> {
   using Query = column_mapping_query::Select;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_datasource_id(datasource_id, sanitizer).compose();
+      Query::prepare().by_datasource_id(datasource_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::result selected = transaction_handler.exec(query);
+  const pqxx::result selected =
+      transaction_handler.exec(query, parameters.values());
   log::debug(
       "{} column mapping records selected with `{}' datasource identifier",
       selected.size(),
@@ -284,12 +290,13 @@ auto DatasourceDao::drop_columns_mapping(
     -> void {
   using Query = column_mapping_query::Delete;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_datasource_id(datasource_id, sanitizer).compose();
+      Query::prepare().by_datasource_id(datasource_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::result result = transaction_handler.exec0(query);
+  const pqxx::result result =
+      transaction_handler.exec0(query, parameters.values());
   log::debug(
       "{} column mapping records deleted with `{}' datasource identifier",
       result.affected_rows(),
@@ -1,27 +1,32 @@
 #include "ih/pqxx/dao/listing_dao.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <pqxx/connection>
+#include <span>
 #include <utility>
+#include <vector>
 
+#include "api/predicate/predicate.hpp"
 #include "ih/pqxx/database/connector.hpp"
+#include "ih/pqxx/database/query_parameters.hpp"
 #include "ih/pqxx/database/transaction.hpp"
-#include "ih/pqxx/database/value_sanitizer.hpp"
 #include "ih/pqxx/queries/listing_queries.hpp"
 #include "ih/pqxx/result/listing_parser.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
-ListingDao::ListingDao(pqxx::connection pqxx_connection) noexcept
+ListingDao::ListingDao(PooledConnection pqxx_connection) noexcept
     : connection_(std::move(pqxx_connection)) {}
 
 auto ListingDao::setup_with(const internal_pqxx::Context& context)
     -> ListingDao {
-  return ListingDao{internal_pqxx::Connector::connect(context)};
+  return ListingDao{internal_pqxx::Connector::acquire(context)};
 }
 
 auto ListingDao::execute(InsertCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Listing::Patch& snapshot = command.initial_patch();
 
   Listing inserted = insert(snapshot, transaction.handler());
@@ -30,8 +35,28 @@ auto ListingDao::execute(InsertCommand& command) -> void {
   command.set_result(std::move(inserted));
 }
 
+auto ListingDao::execute(InsertAllCommand& command) -> void {
+  Transaction transaction{*connection_};
+
+  std::vector<Listing> inserted =
+      insert_all(command.patches(), transaction.handler());
+
+  transaction.commit();
+  command.set_result(std::move(inserted));
+}
+
+auto ListingDao::execute(UpsertAllCommand& command) -> void {
+  Transaction transaction{*connection_};
+
+  std::vector<Listing> upserted =
+      upsert_all(command.patches(), transaction.handler());
+
+  transaction.commit();
+  command.set_result(std::move(upserted));
+}
+
 auto ListingDao::execute(SelectOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Predicate& predicate = command.predicate();
 
   Listing selected = select_single(predicate, transaction.handler());
@@ -41,7 +66,7 @@ auto ListingDao::execute(SelectOneCommand& command) -> void {
 }
 
 auto ListingDao::execute(SelectAllCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
 
   std::vector<Listing> selected =
       select_all(command.predicate(), transaction.handler());
@@ -51,7 +76,7 @@ auto ListingDao::execute(SelectAllCommand& command) -> void {
 }
 
 auto ListingDao::execute(ListingDao::UpdateOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Listing::Patch& patch = command.patch();
   const Predicate& predicate = command.predicate();
 
@@ -65,14 +90,14 @@ auto ListingDao::insert(const Listing::Patch& snapshot,
                         Transaction::Handler transaction_handler) -> Listing {
   using Query = listing_query::Insert;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare(snapshot, sanitizer).returning_id().compose();
+      Query::prepare(snapshot, parameters).returning_id().compose();
 
   log::debug("executing `{}'", query);
   const pqxx::row result = [&] {
     try {
-      return transaction_handler.exec1(query);
+      return transaction_handler.exec1(query, parameters.values());
     } catch (const std::exception& exception) {
       log::warn("listing insertion failed, error: `{}'",
                            exception.what());
@@ -89,15 +114,84 @@ auto ListingDao::insert(const Listing::Patch& snapshot,
   return select_single(inserted_id, transaction_handler);
 }
 
+auto ListingDao::insert_all(std::span<const Listing::Patch> patches,
+                            Transaction::Handler transaction_handler)
+    -> std::vector<Listing> {
+  using Query = listing_query::InsertAll;
+
+  std::vector<Listing> inserted{};
+  inserted.reserve(patches.size());
+  for (const auto batch : Query::split_into_batches(patches)) {
+    QueryParameters parameters{};
+    const std::string query = Query::prepare(batch, parameters).compose();
+
+    // Each batch has its own shape, it is not worth a prepared statement
+    log::debug("executing bulk insertion of {} listings", batch.size());
+    const pqxx::result result = [&] {
+      try {
+        return transaction_handler.exec_unprepared(query, parameters.values());
+      } catch (const std::exception& exception) {
+        log::warn("listing bulk insertion failed, error: `{}'",
+                  exception.what());
+        throw;
+      }
+    }();
+    log::debug("listing bulk insertion query executed, {} records returned",
+               result.size());
+
+    // Rows are returned in the order of inserted values
+    for (const pqxx::row& row : result) {
+      inserted.emplace_back(decode_listing(row));
+    }
+  }
+
+  return inserted;
+}
+
+auto ListingDao::upsert_all(std::span<const Listing::Patch> patches,
+                            Transaction::Handler transaction_handler)
+    -> std::vector<Listing> {
+  std::vector<Listing> upserted{};
+  upserted.reserve(patches.size());
+
+  // The schema guarantees no natural key to conflict on, so a patch
+  // carrying an identifier updates that listing and consecutive patches
+  // without one are inserted in bulk, keeping the order of patches
+  const auto identified = [](const Listing::Patch& patch) {
+    return patch.listing_id().has_value();
+  };
+  auto current = patches.begin();
+  while (current != patches.end()) {
+    if (identified(*current)) {
+      const auto predicate =
+          ListingCmp::eq(Listing::Attribute::ListingId, *current->listing_id());
+      upserted.emplace_back(update(*current, predicate, transaction_handler));
+      ++current;
+      continue;
+    }
+
+    const auto inserted_end = std::find_if(current, patches.end(), identified);
+    std::vector<Listing> inserted = insert_all(
+        std::span<const Listing::Patch>{current, inserted_end},
+        transaction_handler);
+    std::move(inserted.begin(), inserted.end(), std::back_inserter(upserted));
+    current = inserted_end;
+  }
+
+  return upserted;
+}
+
 auto ListingDao::select_single(const Predicate& predicate,
                                Transaction::Handler transaction_handler)
     -> Listing {
   using Query = listing_query::Select;
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare().by(predicate, sanitizer).compose();
+  QueryParameters parameters{};
+  const std::string query =
+      Query::prepare().by(predicate, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("listing selection query executed");
 
   Listing selected_listing = decode_listing(selected);
@@ -108,12 +202,13 @@ auto ListingDao::select_single(std::uint64_t listing_id,
                                Transaction::Handler transaction_handler)
     -> Listing {
   using Query = listing_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_listing_id(listing_id, sanitizer).compose();
+      Query::prepare().by_listing_id(listing_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("listing selection query executed");
 
   Listing selected_listing = decode_listing(selected);
@@ -126,16 +221,17 @@ auto ListingDao::select_all(const std::optional<Predicate>& predicate,
                             Transaction::Handler transaction_handler)
     -> std::vector<Listing> {
   using Query = listing_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query = [&] {
     if (predicate.has_value()) {
-      return Query::prepare().by(*predicate, sanitizer).compose();
+      return Query::prepare().by(*predicate, parameters).compose();
     }
     return Query::prepare().compose();
   }();
 
   log::debug("executing `{}'", query);
-  const pqxx::result selected = transaction_handler.exec(query);
+  const pqxx::result selected =
+      transaction_handler.exec(query, parameters.values());
   log::debug(
       "listing selection query executed, {} records retrieved",
       selected.size());
@@ -154,14 +250,15 @@ auto ListingDao::update(const Listing::Patch& patch,
                         Transaction::Handler transaction_handler) -> Listing {
   using Query = listing_query::Update;
 
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare(patch, sanitizer)
-                                .by(predicate, sanitizer)
+  QueryParameters parameters{};
+  const std::string query = Query::prepare(patch, parameters)
+                                .by(predicate, parameters)
                                 .returning_id()
                                 .compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row result = transaction_handler.exec1(query);
+  const pqxx::row result =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("listing update query was executed");
 
   log::debug("decoding an updated listing record identifier");
@@ -1,27 +1,32 @@
 #include "ih/pqxx/dao/price_seed_dao.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <pqxx/connection>
+#include <span>
 #include <utility>
+#include <vector>
 
+#include "api/predicate/predicate.hpp"
 #include "ih/pqxx/database/connector.hpp"
+#include "ih/pqxx/database/query_parameters.hpp"
 #include "ih/pqxx/database/transaction.hpp"
-#include "ih/pqxx/database/value_sanitizer.hpp"
 #include "ih/pqxx/queries/price_seed_queries.hpp"
 #include "ih/pqxx/result/price_seed_parser.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
-PriceSeedDao::PriceSeedDao(pqxx::connection pqxx_connection) noexcept
+PriceSeedDao::PriceSeedDao(PooledConnection pqxx_connection) noexcept
     : connection_(std::move(pqxx_connection)) {}
 
 auto PriceSeedDao::setup_with(const internal_pqxx::Context& context)
     -> PriceSeedDao {
-  return PriceSeedDao{internal_pqxx::Connector::connect(context)};
+  return PriceSeedDao{internal_pqxx::Connector::acquire(context)};
 }
 
 auto PriceSeedDao::execute(InsertCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const PriceSeed::Patch& snapshot = command.initial_patch();
 
   PriceSeed inserted = insert(snapshot, transaction.handler());
@@ -30,8 +35,28 @@ auto PriceSeedDao::execute(InsertCommand& command) -> void {
   command.set_result(std::move(inserted));
 }
 
+auto PriceSeedDao::execute(InsertAllCommand& command) -> void {
+  Transaction transaction{*connection_};
+
+  std::vector<PriceSeed> inserted =
+      insert_all(command.patches(), transaction.handler());
+
+  transaction.commit();
+  command.set_result(std::move(inserted));
+}
+
+auto PriceSeedDao::execute(UpsertAllCommand& command) -> void {
+  Transaction transaction{*connection_};
+
+  std::vector<PriceSeed> upserted =
+      upsert_all(command.patches(), transaction.handler());
+
+  transaction.commit();
+  command.set_result(std::move(upserted));
+}
+
 auto PriceSeedDao::execute(SelectOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Predicate& predicate = command.predicate();
 
   PriceSeed selected = select_single(predicate, transaction.handler());
@@ -41,7 +66,7 @@ auto PriceSeedDao::execute(SelectOneCommand& command) -> void {
 }
 
 auto PriceSeedDao::execute(SelectAllCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
 
   std::vector<PriceSeed> selected =
       select_all(command.predicate(), transaction.handler());
@@ -51,7 +76,7 @@ auto PriceSeedDao::execute(SelectAllCommand& command) -> void {
 }
 
 auto PriceSeedDao::execute(UpdateOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const PriceSeed::Patch& patch = command.patch();
   const Predicate& predicate = command.predicate();
 
@@ -62,7 +87,7 @@ auto PriceSeedDao::execute(UpdateOneCommand& command) -> void {
 }
 
 auto PriceSeedDao::execute(UpdateAllCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const PriceSeed::Patch& patch = command.patch();
   const std::optional<Predicate>& predicate = command.predicate();
 
@@ -74,7 +99,7 @@ auto PriceSeedDao::execute(UpdateAllCommand& command) -> void {
 }
 
 auto PriceSeedDao::execute(DeleteOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Predicate& predicate = command.predicate();
 
   delete_single(predicate, transaction.handler());
@@ -83,7 +108,7 @@ auto PriceSeedDao::execute(DeleteOneCommand& command) -> void {
 }
 
 auto PriceSeedDao::execute(DeleteAllCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const std::optional<Predicate>& predicate = command.predicate();
 
   delete_all(predicate, transaction.handler());
@@ -96,14 +121,14 @@ auto PriceSeedDao::insert(const PriceSeed::Patch& snapshot,
     -> PriceSeed {
   using Query = price_seed_query::Insert;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare(snapshot, sanitizer).returning_id().compose();
+      Query::prepare(snapshot, parameters).returning_id().compose();
 
   log::debug("executing `{}'", query);
   const pqxx::row result = [&] {
     try {
-      return transaction_handler.exec1(query);
+      return transaction_handler.exec1(query, parameters.values());
     } catch (const std::exception& exception) {
       log::warn("price seed insertion failed, error: `{}'", exception.what());
       throw;
@@ -118,15 +143,84 @@ auto PriceSeedDao::insert(const PriceSeed::Patch& snapshot,
   return select_single(inserted_id, transaction_handler);
 }
 
+auto PriceSeedDao::insert_all(std::span<const PriceSeed::Patch> patches,
+                              Transaction::Handler transaction_handler)
+    -> std::vector<PriceSeed> {
+  using Query = price_seed_query::InsertAll;
+
+  std::vector<PriceSeed> inserted{};
+  inserted.reserve(patches.size());
+  for (const auto batch : Query::split_into_batches(patches)) {
+    QueryParameters parameters{};
+    const std::string query = Query::prepare(batch, parameters).compose();
+
+    // Each batch has its own shape, it is not worth a prepared statement
+    log::debug("executing bulk insertion of {} price seeds", batch.size());
+    const pqxx::result result = [&] {
+      try {
+        return transaction_handler.exec_unprepared(query, parameters.values());
+      } catch (const std::exception& exception) {
+        log::warn("price seed bulk insertion failed, error: `{}'",
+                  exception.what());
+        throw;
+      }
+    }();
+    log::debug("price seed bulk insertion query executed, {} records returned",
+               result.size());
+
+    // Rows are returned in the order of inserted values
+    for (const pqxx::row& row : result) {
+      inserted.emplace_back(decode_price_seed(row));
+    }
+  }
+
+  return inserted;
+}
+
+auto PriceSeedDao::upsert_all(std::span<const PriceSeed::Patch> patches,
+                              Transaction::Handler transaction_handler)
+    -> std::vector<PriceSeed> {
+  std::vector<PriceSeed> upserted{};
+  upserted.reserve(patches.size());
+
+  // The schema guarantees no natural key to conflict on, so a patch
+  // carrying an identifier updates that price seed and consecutive patches
+  // without one are inserted in bulk, keeping the order of patches
+  const auto identified = [](const PriceSeed::Patch& patch) {
+    return patch.price_seed_id().has_value();
+  };
+  auto current = patches.begin();
+  while (current != patches.end()) {
+    if (identified(*current)) {
+      const auto predicate = PriceSeedCmp::eq(
+          PriceSeed::Attribute::PriceSeedId, *current->price_seed_id());
+      upserted.emplace_back(update(*current, predicate, transaction_handler));
+      ++current;
+      continue;
+    }
+
+    const auto inserted_end = std::find_if(current, patches.end(), identified);
+    std::vector<PriceSeed> inserted = insert_all(
+        std::span<const PriceSeed::Patch>{current, inserted_end},
+        transaction_handler);
+    std::move(inserted.begin(), inserted.end(), std::back_inserter(upserted));
+    current = inserted_end;
+  }
+
+  return upserted;
+}
+
 auto PriceSeedDao::select_single(const Predicate& predicate,
                                  Transaction::Handler transaction_handler)
     -> PriceSeed {
   using Query = price_seed_query::Select;
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare().by(predicate, sanitizer).compose();
+  QueryParameters parameters{};
+  const std::string query =
+      Query::prepare().by(predicate, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("price seed selection query executed");
 
   PriceSeed selected_seed = decode_price_seed(selected);
@@ -137,12 +231,13 @@ auto PriceSeedDao::select_single(std::uint64_t seed_id,
                                  Transaction::Handler transaction_handler)
     -> PriceSeed {
   using Query = price_seed_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_price_seed_id(seed_id, sanitizer).compose();
+      Query::prepare().by_price_seed_id(seed_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("price seed selection query executed");
 
   PriceSeed selected_seed = decode_price_seed(selected);
@@ -154,16 +249,17 @@ auto PriceSeedDao::select_all(const std::optional<Predicate>& predicate,
                               Transaction::Handler transaction_handler)
     -> std::vector<PriceSeed> {
   using Query = price_seed_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query = [&] {
     if (predicate.has_value()) {
-      return Query::prepare().by(*predicate, sanitizer).compose();
+      return Query::prepare().by(*predicate, parameters).compose();
     }
     return Query::prepare().compose();
   }();
 
   log::debug("executing `{}'", query);
-  const pqxx::result selected = transaction_handler.exec(query);
+  const pqxx::result selected =
+      transaction_handler.exec(query, parameters.values());
   log::debug("price seed selection query executed, {} records retrieved",
              selected.size());
 
@@ -182,14 +278,15 @@ auto PriceSeedDao::update(const PriceSeed::Patch& patch,
     -> PriceSeed {
   using Query = price_seed_query::Update;
 
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare(patch, sanitizer)
-                                .by(predicate, sanitizer)
+  QueryParameters parameters{};
+  const std::string query = Query::prepare(patch, parameters)
+                                .by(predicate, parameters)
                                 .returning_id()
                                 .compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row result = transaction_handler.exec1(query);
+  const pqxx::row result =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("price seed update query was executed");
 
   log::debug("decoding an updated price seed record identifier");
@@ -205,20 +302,21 @@ auto PriceSeedDao::update_all(const PriceSeed::Patch& patch,
     -> std::vector<PriceSeed> {
   using Query = price_seed_query::Update;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query = [&] {
     if (predicate.has_value()) {
-      return Query::prepare(patch, sanitizer)
-          .by(*predicate, sanitizer)
+      return Query::prepare(patch, parameters)
+          .by(*predicate, parameters)
           .returning_id()
           .compose();
     }
 
-    return Query::prepare(patch, sanitizer).returning_id().compose();
+    return Query::prepare(patch, parameters).returning_id().compose();
   }();
 
   log::debug("executing `{}'", query);
-  const pqxx::result result = transaction_handler.exec(query);
+  const pqxx::result result =
+      transaction_handler.exec(query, parameters.values());
   log::debug("price seed update query was executed");
 
   log::debug("selecting updated price seeds records");
@@ -236,11 +334,13 @@ auto PriceSeedDao::delete_single(const Predicate& predicate,
                                  Transaction::Handler transaction_handler)
     -> void {
   using Query = price_seed_query::Delete;
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare().by(predicate, sanitizer).compose();
+  QueryParameters parameters{};
+  const std::string query =
+      Query::prepare().by(predicate, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::result deleted_info = transaction_handler.exec0(query);
+  const pqxx::result deleted_info =
+      transaction_handler.exec0(query, parameters.values());
   log::debug("price seed delete query executed");
 
   const auto num_deleted = deleted_info.affected_rows();
@@ -257,16 +357,17 @@ auto PriceSeedDao::delete_all(const std::optional<Predicate>& predicate,
                               Transaction::Handler transaction_handler)
     -> void {
   using Query = price_seed_query::Delete;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query = [&] {
     if (predicate.has_value()) {
-      return Query::prepare().by(*predicate, sanitizer).compose();
+      return Query::prepare().by(*predicate, parameters).compose();
     }
     return Query::prepare().compose();
   }();
 
   log::debug("executing `{}'", query);
-  const pqxx::result deleted_info = transaction_handler.exec0(query);
+  const pqxx::result deleted_info =
+      transaction_handler.exec0(query, parameters.values());
 
   const auto num_deleted = deleted_info.affected_rows();
   log::debug("price seed delete query executed, {} records deleted",
@@ -6,24 +6,24 @@
 #include <vector>
 
 #include "ih/pqxx/database/connector.hpp"
+#include "ih/pqxx/database/query_parameters.hpp"
 #include "ih/pqxx/database/transaction.hpp"
-#include "ih/pqxx/database/value_sanitizer.hpp"
 #include "ih/pqxx/queries/setting_queries.hpp"
 #include "ih/pqxx/result/setting_parser.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
-SettingDao::SettingDao(pqxx::connection pqxx_connection) noexcept
+SettingDao::SettingDao(PooledConnection pqxx_connection) noexcept
     : connection_(std::move(pqxx_connection)) {}
 
 auto SettingDao::setup_with(const internal_pqxx::Context& context)
     -> SettingDao {
-  return SettingDao{internal_pqxx::Connector::connect(context)};
+  return SettingDao{internal_pqxx::Connector::acquire(context)};
 }
 
 auto SettingDao::execute(InsertCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Setting::Patch& snapshot = command.initial_patch();
 
   Setting inserted = insert(snapshot, transaction.handler());
@@ -32,8 +32,28 @@ auto SettingDao::execute(InsertCommand& command) -> void {
   command.set_result(std::move(inserted));
 }
 
+auto SettingDao::execute(InsertAllCommand& command) -> void {
+  Transaction transaction{*connection_};
+
+  std::vector<Setting> inserted =
+      insert_all(command.patches(), false, transaction.handler());
+
+  transaction.commit();
+  command.set_result(std::move(inserted));
+}
+
+auto SettingDao::execute(UpsertAllCommand& command) -> void {
+  Transaction transaction{*connection_};
+
+  std::vector<Setting> inserted =
+      insert_all(command.patches(), true, transaction.handler());
+
+  transaction.commit();
+  command.set_result(std::move(inserted));
+}
+
 auto SettingDao::execute(SelectOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Predicate& predicate = command.predicate();
 
   Setting selected = select_single(predicate, transaction.handler());
@@ -43,7 +63,7 @@ auto SettingDao::execute(SelectOneCommand& command) -> void {
 }
 
 auto SettingDao::execute(SelectAllCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
 
   std::vector<Setting> selected =
       select_all(command.predicate(), transaction.handler());
@@ -53,7 +73,7 @@ auto SettingDao::execute(SelectAllCommand& command) -> void {
 }
 
 auto SettingDao::execute(UpdateOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Setting::Patch& patch = command.patch();
   const Predicate& predicate = command.predicate();
 
@@ -67,14 +87,14 @@ auto SettingDao::insert(const Setting::Patch& snapshot,
                         Transaction::Handler transaction_handler) -> Setting {
   using Query = setting_query::Insert;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare(snapshot, sanitizer).returning_key().compose();
+      Query::prepare(snapshot, parameters).returning_key().compose();
 
   log::debug("executing `{}'", query);
   const pqxx::row result = [&] {
     try {
-      return transaction_handler.exec1(query);
+      return transaction_handler.exec1(query, parameters.values());
     } catch (const std::exception& exception) {
       log::warn("setting insertion failed, error: `{}'", exception.what());
       throw;
@@ -89,15 +109,56 @@ auto SettingDao::insert(const Setting::Patch& snapshot,
   return select_single(inserted_key, transaction_handler);
 }
 
+auto SettingDao::insert_all(const std::vector<Setting::Patch>& patches,
+                           bool update_existing,
+                           Transaction::Handler transaction_handler)
+    -> std::vector<Setting> {
+  using Query = setting_query::InsertAll;
+
+  std::vector<Setting> inserted{};
+  inserted.reserve(patches.size());
+  for (const auto batch : Query::split_into_batches(patches)) {
+    QueryParameters parameters{};
+    auto query_builder = Query::prepare(batch, parameters);
+    if (update_existing) {
+      query_builder.on_conflict_update();
+    }
+    const std::string query = query_builder.compose();
+
+    // Each batch has its own shape, it is not worth a prepared statement
+    log::debug("executing bulk insertion of {} settings", batch.size());
+    const pqxx::result result = [&] {
+      try {
+        return transaction_handler.exec_unprepared(query, parameters.values());
+      } catch (const std::exception& exception) {
+        log::warn("setting bulk insertion failed, error: `{}'",
+                  exception.what());
+        throw;
+      }
+    }();
+    log::debug("setting bulk insertion query executed, {} records returned",
+               result.size());
+
+    // Rows are returned in the order of inserted values
+    for (const pqxx::row& row : result) {
+      inserted.emplace_back(decode_setting(row));
+    }
+  }
+
+  return inserted;
+}
+
 auto SettingDao::select_single(const Predicate& predicate,
                                Transaction::Handler transaction_handler)
     -> Setting {
   using Query = setting_query::Select;
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare().by(predicate, sanitizer).compose();
+  QueryParameters parameters{};
+  const std::string query =
+      Query::prepare().by(predicate, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("setting selection query executed");
 
   Setting selected_setting = decode_setting(selected);
@@ -108,11 +169,12 @@ auto SettingDao::select_single(const std::string& key,
                                Transaction::Handler transaction_handler)
     -> Setting {
   using Query = setting_query::Select;
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare().by_key(key, sanitizer).compose();
+  QueryParameters parameters{};
+  const std::string query = Query::prepare().by_key(key, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("setting selection query executed");
 
   Setting selected_setting = decode_setting(selected);
@@ -124,16 +186,17 @@ auto SettingDao::select_all(const std::optional<Predicate>& predicate,
                             Transaction::Handler transaction_handler)
     -> std::vector<Setting> {
   using Query = setting_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query = [&] {
     if (predicate.has_value()) {
-      return Query::prepare().by(*predicate, sanitizer).compose();
+      return Query::prepare().by(*predicate, parameters).compose();
     }
     return Query::prepare().compose();
   }();
 
   log::debug("executing `{}'", query);
-  const pqxx::result selected = transaction_handler.exec(query);
+  const pqxx::result selected =
+      transaction_handler.exec(query, parameters.values());
   log::debug("setting selection query executed, {} records retrieved",
              selected.size());
 
@@ -151,14 +214,15 @@ auto SettingDao::update(const Setting::Patch& patch,
                         Transaction::Handler transaction_handler) -> Setting {
   using Query = setting_query::Update;
 
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare(patch, sanitizer)
-                                .by(predicate, sanitizer)
+  QueryParameters parameters{};
+  const std::string query = Query::prepare(patch, parameters)
+                                .by(predicate, parameters)
                                 .returning_key()
                                 .compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row result = transaction_handler.exec1(query);
+  const pqxx::row result =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("setting update query was executed");
 
   log::debug("decoding an updated setting key");
@@ -6,23 +6,23 @@
 
 #include "api/inspectors/venue.hpp"
 #include "ih/pqxx/database/connector.hpp"
+#include "ih/pqxx/database/query_parameters.hpp"
 #include "ih/pqxx/database/transaction.hpp"
-#include "ih/pqxx/database/value_sanitizer.hpp"
 #include "ih/pqxx/queries/venue_queries.hpp"
 #include "ih/pqxx/result/venue_parser.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::data_layer::internal_pqxx {
 
-VenueDao::VenueDao(pqxx::connection pqxx_connection) noexcept
+VenueDao::VenueDao(PooledConnection pqxx_connection) noexcept
     : connection_(std::move(pqxx_connection)) {}
 
 auto VenueDao::setup_with(const internal_pqxx::Context& context) -> VenueDao {
-  return VenueDao{internal_pqxx::Connector::connect(context)};
+  return VenueDao{internal_pqxx::Connector::acquire(context)};
 }
 
 auto VenueDao::execute(InsertCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Venue::Patch& snapshot = command.initial_patch();
 
   Venue inserted = insert(snapshot, transaction.handler());
@@ -32,7 +32,7 @@ auto VenueDao::execute(InsertCommand& command) -> void {
 }
 
 auto VenueDao::execute(SelectOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Predicate& predicate = command.predicate();
 
   Venue selected = select_single(predicate, transaction.handler());
@@ -42,7 +42,7 @@ auto VenueDao::execute(SelectOneCommand& command) -> void {
 }
 
 auto VenueDao::execute(SelectAllCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
 
   std::vector<Venue> selected =
       select_all(command.predicate(), transaction.handler());
@@ -52,7 +52,7 @@ auto VenueDao::execute(SelectAllCommand& command) -> void {
 }
 
 auto VenueDao::execute(UpdateOneCommand& command) -> void {
-  Transaction transaction{connection_};
+  Transaction transaction{*connection_};
   const Venue::Patch& patch = command.patch();
   const Predicate& predicate = command.predicate();
 
@@ -66,14 +66,14 @@ auto VenueDao::insert(const Venue::Patch& snapshot,
                       Transaction::Handler transaction_handler) -> Venue {
   using Query = venue_query::Insert;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare(snapshot, sanitizer).returning_id().compose();
+      Query::prepare(snapshot, parameters).returning_id().compose();
 
   log::debug("executing `{}'", query);
   const pqxx::row result = [&] {
     try {
-      return transaction_handler.exec1(query);
+      return transaction_handler.exec1(query, parameters.values());
     } catch (const std::exception& exception) {
       log::warn("venue insertion failed, error: `{}'", exception.what());
       throw;
@@ -104,11 +104,13 @@ auto VenueDao::select_single(const Predicate& predicate,
                              Transaction::Handler transaction_handler)
     -> Venue {
   using Query = venue_query::Select;
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare().by(predicate, sanitizer).compose();
+  QueryParameters parameters{};
+  const std::string query =
+      Query::prepare().by(predicate, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("venue selection query executed");
 
   Venue selected_venue = decode_venue(selected, transaction_handler);
@@ -119,12 +121,13 @@ auto VenueDao::select_single(const std::string& venue_id,
                              Transaction::Handler transaction_handler)
     -> Venue {
   using Query = venue_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_venue_id(venue_id, sanitizer).compose();
+      Query::prepare().by_venue_id(venue_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row selected = transaction_handler.exec1(query);
+  const pqxx::row selected =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("venue selection query executed");
 
   Venue selected_venue = decode_venue(selected, transaction_handler);
@@ -136,16 +139,17 @@ auto VenueDao::select_all(const std::optional<Predicate>& predicate,
                           Transaction::Handler transaction_handler)
     -> std::vector<Venue> {
   using Query = venue_query::Select;
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query = [&] {
     if (predicate.has_value()) {
-      return Query::prepare().by(*predicate, sanitizer).compose();
+      return Query::prepare().by(*predicate, parameters).compose();
     }
     return Query::prepare().compose();
   }();
 
   log::debug("executing `{}'", query);
-  const pqxx::result selected = transaction_handler.exec(query);
+  const pqxx::result selected =
+      transaction_handler.exec(query, parameters.values());
   log::debug("venue selection query executed, {} records retrieved",
              selected.size());
 
@@ -163,14 +167,15 @@ auto VenueDao::update(const Venue::Patch& patch,
                       Transaction::Handler transaction_handler) -> Venue {
   using Query = venue_query::Update;
 
-  ValueSanitizer sanitizer{connection_};
-  const std::string query = Query::prepare(patch, sanitizer)
-                                .by(predicate, sanitizer)
+  QueryParameters parameters{};
+  const std::string query = Query::prepare(patch, parameters)
+                                .by(predicate, parameters)
                                 .returning_id()
                                 .compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::row updated_id = transaction_handler.exec1(query);
+  const pqxx::row updated_id =
+      transaction_handler.exec1(query, parameters.values());
   log::debug("venue update query was executed");
 
   log::debug("Decoding an updated venue record identifier");
@@ -212,14 +217,14 @@ auto VenueDao::insert_phases(const std::vector<MarketPhase>& phases,
     -> void {
   using Query = market_phase_query::Insert;
 
-  ValueSanitizer sanitizer{connection_};
   log::debug("inserting {} market phase records", phases.size());
 
   for (const auto& phase : phases) {
-    const std::string query = Query::prepare(phase, sanitizer).compose();
+    QueryParameters parameters{};
+    const std::string query = Query::prepare(phase, parameters).compose();
     log::debug("executing `{}", query);
     try {
-      transaction_handler.exec0(query);
+      transaction_handler.exec0(query, parameters.values());
       log::debug("market phase insertion query executed");
     } catch (const std::exception& exception) {
       log::warn("failed to inset a market phase, error occurred: `{}'",
@@ -249,12 +254,13 @@ auto VenueDao::select_phases(const std::string& venue_id,
     -> std::vector<MarketPhase::Patch> {
   using Query = market_phase_query::Select;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_venue_id(venue_id, sanitizer).compose();
+      Query::prepare().by_venue_id(venue_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::result selected_rows = transaction_handler.exec(query);
+  const pqxx::result selected_rows =
+      transaction_handler.exec(query, parameters.values());
   log::debug("{} market phase records selected with `{}' venue identifier",
              selected_rows.size(),
              venue_id);
@@ -280,12 +286,13 @@ auto VenueDao::drop_phases(const std::string& venue_id,
     -> void {
   using Query = market_phase_query::Delete;
 
-  ValueSanitizer sanitizer{connection_};
+  QueryParameters parameters{};
   const std::string query =
-      Query::prepare().by_venue_id(venue_id, sanitizer).compose();
+      Query::prepare().by_venue_id(venue_id, parameters).compose();
 
   log::debug("executing `{}'", query);
-  const pqxx::result result = transaction_handler.exec0(query);
+  const pqxx::result result =
+      transaction_handler.exec0(query, parameters.values());
   log::debug("{} market phase records deleted with `{}' venue identifier",
              result.affected_rows(),
              venue_id);
@@ -12,17 +12,33 @@
 
 namespace simulator::data_layer::internal_pqxx {
 
+namespace {
+
+auto make_connection(const std::string& conn_url) -> pqxx::connection {
+  return pqxx::connection{conn_url};
+}
+
+}  // namespace
+
+auto Connector::acquire(const internal_pqxx::Context& context)
+    -> PooledConnection {
+  return context.connection_pool().acquire();
+}
+
 auto Connector::connect(const internal_pqxx::Context& context)
     -> pqxx::connection {
-  const static auto connection_strategy = [](const std::string& conn_url) {
-    return pqxx::connection{conn_url};
-  };
+  return Connector{make_connection}.connect_under(context);
+}
 
-  return Connector{connection_strategy}.connect_under(context);
+auto Connector::connect(const std::string& connection_string)
+    -> pqxx::connection {
+  return Connector{make_connection}.connect_under(connection_string);
 }
 
 void Connector::ping(const internal_pqxx::Context& context) {
-  Connector::connect(context);
+  // Reaches the database with a pooled connection when one is available,
+  // a connection which fails to reach it is closed
+  context.connection_pool().check();
 }
 
 Connector::Connector(Connector::ConnectingStrategy connecting_strategy)
@@ -47,6 +63,19 @@ auto Connector::connect_under(const internal_pqxx::Context& context) const
   return connection;
 }
 
+auto Connector::connect_under(const std::string& connection_string) const
+    -> pqxx::connection {
+  if (connection_string.empty()) {
+    throw data_layer::ConnectionFailure{
+        "no connection string in pqxx context, has it been configured?"};
+  }
+
+  pqxx::connection connection = connect_by_conn_string(connection_string);
+  log::debug("opened a new database connection using pqxx driver");
+
+  return connection;
+}
+
 auto Connector::connect_by_conn_string(const std::string& conn_string) const
     -> pqxx::connection {
   assert(connecting_strategy_);  // Must be validated on construction stage
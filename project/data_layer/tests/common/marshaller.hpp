@@ -29,6 +29,9 @@ class Marshaller {
   MOCK_METHOD(void, real, (Attribute, double));
   MOCK_METHOD(void, string, (Attribute, std::string));
   MOCK_METHOD(void, engine_type, (Attribute, Venue::EngineType));
+  MOCK_METHOD(void,
+              self_trade_prevention,
+              (Attribute, Venue::SelfTradePrevention));
   MOCK_METHOD(void, datasource_format, (Attribute, Datasource::Format));
   MOCK_METHOD(void, datasource_type, (Attribute, Datasource::Type));
   MOCK_METHOD(void, market_phase_type, (Attribute, MarketPhase::Phase));
@@ -45,6 +48,8 @@ class Marshaller {
   DEFINE_MARSHALLING_OPERATOR(double, real);
   DEFINE_MARSHALLING_OPERATOR(const std::string&, string);
   DEFINE_MARSHALLING_OPERATOR(Venue::EngineType, engine_type);
+  DEFINE_MARSHALLING_OPERATOR(Venue::SelfTradePrevention,
+                              self_trade_prevention);
   DEFINE_MARSHALLING_OPERATOR(Datasource::Format, datasource_format);
   DEFINE_MARSHALLING_OPERATOR(Datasource::Type, datasource_type);
   DEFINE_MARSHALLING_OPERATOR(MarketPhase::Phase, market_phase_type);
@@ -66,6 +71,9 @@ class Unmarshaller {
   MOCK_METHOD(bool, real, (Attribute, double&));
   MOCK_METHOD(bool, string, (Attribute, std::string&));
   MOCK_METHOD(bool, engine_type, (Attribute, Venue::EngineType&));
+  MOCK_METHOD(bool,
+              self_trade_prevention,
+              (Attribute, Venue::SelfTradePrevention&));
   MOCK_METHOD(bool, datasource_format, (Attribute, Datasource::Format&));
   MOCK_METHOD(bool, datasource_type, (Attribute, Datasource::Type&));
   MOCK_METHOD(bool, market_phase_type, (Attribute, MarketPhase::Phase&));
@@ -84,6 +92,8 @@ class Unmarshaller {
   DEFINE_UNMARSHALLING_OPERATOR(double&, real);
   DEFINE_UNMARSHALLING_OPERATOR(std::string&, string);
   DEFINE_UNMARSHALLING_OPERATOR(Venue::EngineType&, engine_type);
+  DEFINE_UNMARSHALLING_OPERATOR(Venue::SelfTradePrevention&,
+                                self_trade_prevention);
   DEFINE_UNMARSHALLING_OPERATOR(Datasource::Format&, datasource_format);
   DEFINE_UNMARSHALLING_OPERATOR(Datasource::Type&, datasource_type);
   DEFINE_UNMARSHALLING_OPERATOR(MarketPhase::Phase&, market_phase_type);
@@ -13,6 +13,8 @@ namespace {
 
 using Attribute = TestModel::Attribute;
 using InsertCommand = Insert<TestModel>;
+using InsertAllCommand = InsertAll<TestModel>;
+using UpsertAllCommand = UpsertAll<TestModel>;
 using SelectOneCommand = SelectOne<TestModel>;
 using SelectAllCommand = SelectAll<TestModel>;
 using UpdateOneCommand = UpdateOne<TestModel>;
@@ -31,6 +33,24 @@ TEST(DataLayer_Common_InsertCommand, GetResult_ResultSet) {
   EXPECT_NO_THROW((void)command.result());
 }
 
+TEST(DataLayer_Common_InsertAllCommand, GetPatches) {
+  auto command = InsertAllCommand::create(
+      std::vector<TestModel::Patch>{TestModel::Patch{}, TestModel::Patch{}});
+  EXPECT_EQ(command.patches().size(), 2);
+}
+
+TEST(DataLayer_Common_InsertAllCommand, GetResult_ResultSet) {
+  auto command = InsertAllCommand::create({TestModel::Patch{}});
+
+  command.set_result(std::vector<TestModel>{TestModel{}});
+  EXPECT_EQ(command.result().size(), 1);
+}
+
+TEST(DataLayer_Common_UpsertAllCommand, GetResult_ResultNotSet) {
+  auto command = UpsertAllCommand::create({TestModel::Patch{}});
+  EXPECT_TRUE(command.result().empty());
+}
+
 TEST(DataLayer_Common_SelectOneCommand, GetResult_ResultNotSet) {
   const auto pred = predicate::eq<TestModel>(Attribute::BooleanField, true);
   auto command = SelectOneCommand::create(pred);
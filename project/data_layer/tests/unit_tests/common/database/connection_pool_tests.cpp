@@ -0,0 +1,269 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "api/exceptions/exceptions.hpp"
+#include "ih/common/database/connection_pool.hpp"
+
+namespace simulator::data_layer::database::test {
+namespace {
+
+// NOLINTBEGIN(*magic-numbers*)
+
+using namespace ::testing;  // NOLINT
+
+struct FakeConnection {
+  int identifier = 0;
+  bool open = true;
+  bool healthy = true;
+};
+
+struct FakeDriver {
+  using Connection = FakeConnection;
+
+  static auto is_open(const FakeConnection& connection) -> bool {
+    return connection.open;
+  }
+
+  static auto probe(FakeConnection& connection) -> void {
+    ++probes;
+    if (!connection.healthy) {
+      throw std::runtime_error{"database is unreachable"};
+    }
+  }
+
+  inline static int probes = 0;
+};
+
+struct FakeClock {
+  using duration = std::chrono::steady_clock::duration;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<FakeClock>;
+  static constexpr bool is_steady = true;
+
+  static auto now() noexcept -> time_point { return current; }
+
+  inline static time_point current{};
+};
+
+using Pool = BasicConnectionPool<FakeDriver, FakeClock>;
+
+struct DataLayer_Database_ConnectionPool : public Test {
+  auto make_pool(PoolSettings settings = {}) -> Pool {
+    return Pool{settings, [this] {
+                  if (fail_connecting) {
+                    throw ConnectionFailure{"connection refused"};
+                  }
+                  return FakeConnection{++opened};
+                }};
+  }
+
+  static auto make_settings(std::size_t max_size) -> PoolSettings {
+    PoolSettings settings;
+    settings.max_size = max_size;
+    settings.acquire_timeout = std::chrono::milliseconds{20};
+    return settings;
+  }
+
+  void SetUp() override {
+    FakeDriver::probes = 0;
+    FakeClock::current = FakeClock::time_point{};
+  }
+
+  int opened = 0;
+  bool fail_connecting = false;
+};
+
+TEST_F(DataLayer_Database_ConnectionPool, OpensConnectionsLazily) {
+  auto pool = make_pool();
+
+  ASSERT_EQ(opened, 0);
+  EXPECT_EQ(pool.statistics().idle, 0);
+  EXPECT_EQ(pool.statistics().in_use, 0);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, ReusesReleasedConnection) {
+  auto pool = make_pool();
+
+  { const auto lease = pool.acquire(); }
+  auto lease = pool.acquire();
+
+  EXPECT_EQ((*lease).identifier, 1);
+  EXPECT_EQ(opened, 1);
+  EXPECT_EQ(FakeDriver::probes, 0);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, OpensConnectionPerConcurrentLease) {
+  auto pool = make_pool(make_settings(2));
+
+  auto first = pool.acquire();
+  auto second = pool.acquire();
+
+  EXPECT_NE(first->identifier, second->identifier);
+  EXPECT_EQ(pool.statistics().in_use, 2);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, FailsToAcquireWhenExhausted) {
+  auto pool = make_pool(make_settings(1));
+  const auto lease = pool.acquire();
+
+  EXPECT_THROW((void)pool.acquire(), ConnectionFailure);
+  EXPECT_EQ(pool.statistics().timed_out_acquisitions, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, WaitsForReleasedConnection) {
+  auto settings = make_settings(1);
+  settings.acquire_timeout = std::chrono::seconds{5};
+  auto pool = make_pool(settings);
+  auto lease = pool.acquire();
+
+  std::thread releaser{[held = std::move(lease)]() mutable {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    const auto released = std::move(held);
+  }};
+  const auto waited = pool.acquire();
+  releaser.join();
+
+  const auto statistics = pool.statistics();
+  EXPECT_EQ(statistics.acquisitions, 2);
+  EXPECT_EQ(statistics.waited_acquisitions, 1);
+  EXPECT_GT(statistics.max_wait.count(), 0);
+  EXPECT_EQ(opened, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, DropsClosedConnectionOnRelease) {
+  auto pool = make_pool();
+
+  {
+    auto lease = pool.acquire();
+    lease->open = false;
+  }
+  const auto lease = pool.acquire();
+
+  EXPECT_EQ(opened, 2);
+  EXPECT_EQ(pool.statistics().closed_connections, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, DropsDiscardedConnection) {
+  auto pool = make_pool();
+
+  {
+    auto lease = pool.acquire();
+    lease.discard();
+  }
+
+  EXPECT_EQ(pool.statistics().idle, 0);
+  EXPECT_EQ(pool.statistics().closed_connections, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, ClosesConnectionsIdleForTimeout) {
+  PoolSettings settings;
+  settings.idle_timeout = std::chrono::seconds{60};
+  auto pool = make_pool(settings);
+
+  { const auto lease = pool.acquire(); }
+  FakeClock::current += std::chrono::seconds{61};
+  auto lease = pool.acquire();
+
+  EXPECT_EQ(lease->identifier, 2);
+  EXPECT_EQ(pool.statistics().closed_connections, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, ProbesConnectionIdleForInterval) {
+  PoolSettings settings;
+  settings.validation_interval = std::chrono::seconds{30};
+  auto pool = make_pool(settings);
+
+  { const auto lease = pool.acquire(); }
+  FakeClock::current += std::chrono::seconds{31};
+  auto lease = pool.acquire();
+
+  EXPECT_EQ(FakeDriver::probes, 1);
+  EXPECT_EQ(lease->identifier, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, ReplacesConnectionFailedProbe) {
+  PoolSettings settings;
+  settings.validation_interval = std::chrono::seconds{30};
+  auto pool = make_pool(settings);
+
+  {
+    auto lease = pool.acquire();
+    lease->healthy = false;
+  }
+  FakeClock::current += std::chrono::seconds{31};
+  auto lease = pool.acquire();
+
+  EXPECT_EQ(lease->identifier, 2);
+  EXPECT_EQ(pool.statistics().closed_connections, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, FreesSlotWhenConnectingFails) {
+  auto pool = make_pool(make_settings(1));
+
+  fail_connecting = true;
+  EXPECT_THROW((void)pool.acquire(), ConnectionFailure);
+
+  fail_connecting = false;
+  EXPECT_NO_THROW((void)pool.acquire());
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, CheckProbesConnection) {
+  auto pool = make_pool();
+
+  EXPECT_NO_THROW(pool.check());
+  EXPECT_EQ(FakeDriver::probes, 1);
+  EXPECT_EQ(pool.statistics().idle, 1);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, CheckDropsUnreachableConnection) {
+  auto pool = make_pool();
+  {
+    auto lease = pool.acquire();
+    lease->healthy = false;
+  }
+
+  EXPECT_THROW(pool.check(), ConnectionFailure);
+  EXPECT_EQ(pool.statistics().idle, 0);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, CheckConnectsWhenPoolIsExhausted) {
+  auto pool = make_pool(make_settings(1));
+  const auto lease = pool.acquire();
+
+  EXPECT_NO_THROW(pool.check());
+  EXPECT_EQ(opened, 2);
+  EXPECT_EQ(pool.statistics().opened_connections, 1);
+  EXPECT_EQ(pool.statistics().timed_out_acquisitions, 0);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool,
+       CheckFailsWhenDatabaseIsUnreachableAndPoolIsExhausted) {
+  auto pool = make_pool(make_settings(1));
+  const auto lease = pool.acquire();
+
+  fail_connecting = true;
+  EXPECT_THROW(pool.check(), ConnectionFailure);
+}
+
+TEST_F(DataLayer_Database_ConnectionPool, ReportsConnectionsUsage) {
+  auto pool = make_pool(make_settings(3));
+  const auto lease = pool.acquire();
+  (void)pool.acquire();
+
+  const auto statistics = pool.statistics();
+  EXPECT_EQ(statistics.in_use, 1);
+  EXPECT_EQ(statistics.idle, 1);
+  EXPECT_EQ(statistics.max_size, 3);
+  EXPECT_EQ(statistics.acquisitions, 2);
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace simulator::data_layer::database::test
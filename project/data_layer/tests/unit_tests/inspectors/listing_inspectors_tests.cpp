@@ -78,6 +78,10 @@ class DataLayer_Inspectors_ListingPatchWriter : public ::testing::Test {
         .Times(AnyNumber())
         .WillRepeatedly(Return(false));
 
+    EXPECT_CALL(unmarshaller(), uint64)
+        .Times(AnyNumber())
+        .WillRepeatedly(Return(false));
+
     EXPECT_CALL(unmarshaller(), real)
         .Times(AnyNumber())
         .WillRepeatedly(Return(false));
@@ -867,6 +871,15 @@ TEST_F(DataLayer_Inspectors_ListingPatchReader,
   make_reader().read(patch);
 }
 
+TEST_F(DataLayer_Inspectors_ListingPatchWriter, Write_ListingID) {
+  Listing::Patch patch{};
+  EXPECT_CALL(unmarshaller(), uint64(Eq(Attribute::ListingId), _))
+      .WillOnce(DoAll(SetArgReferee<1>(42), Return(true)));
+
+  make_writer().write(patch);
+  EXPECT_THAT(patch.listing_id(), Optional(Eq(42)));
+}
+
 TEST_F(DataLayer_Inspectors_ListingPatchWriter, Write_Symbol) {
   Listing::Patch patch{};
   EXPECT_CALL(unmarshaller(), string(Eq(Attribute::Symbol), _))
@@ -61,6 +61,10 @@ class DataLayer_Inspectors_PriceSeedPatchWriter : public ::testing::Test {
 
  protected:
   auto SetUp() -> void override {
+    EXPECT_CALL(unmarshaller(), uint64)
+        .Times(AnyNumber())
+        .WillRepeatedly(Return(false));
+
     EXPECT_CALL(unmarshaller(), real)
         .Times(AnyNumber())
         .WillRepeatedly(Return(false));
@@ -308,6 +312,15 @@ TEST_F(DataLayer_Inspectors_PriceSeedPatchReader, Read_LastUpdate) {
   make_reader().read(patch);
 }
 
+TEST_F(DataLayer_Inspectors_PriceSeedPatchWriter, Write_PriceSeedID) {
+  PriceSeed::Patch patch{};
+  EXPECT_CALL(unmarshaller(), uint64(Eq(Attribute::PriceSeedId), _))
+      .WillOnce(DoAll(SetArgReferee<1>(42), Return(true)));
+
+  make_writer().write(patch);
+  EXPECT_THAT(patch.price_seed_id(), Optional(Eq(42)));
+}
+
 TEST_F(DataLayer_Inspectors_PriceSeedPatchWriter, Write_Symbol) {
   EXPECT_CALL(unmarshaller(), string(Eq(Attribute::Symbol), _))
       .WillOnce(DoAll(SetArgReferee<1>("AAPL"), Return(true)));
@@ -255,6 +255,18 @@ TEST_F(DataLayer_Inspectors_VenueReader, Read_TnsPartiesEnabledFlag) {
   make_reader().read(venue);
 }
 
+TEST_F(DataLayer_Inspectors_VenueReader, Read_TnsHistoryDepth) {
+  const auto patch =
+      make_default_patch().with_tns_history_depth(100);  // NOLINT
+  ASSERT_THAT(patch.tns_history_depth(), Optional(Eq(100)));
+  const auto venue = Venue::create(patch);
+
+  EXPECT_CALL(marshaller(), uint32(Eq(Attribute::TnsHistoryDepth), Eq(100)))
+      .Times(1);
+
+  make_reader().read(venue);
+}
+
 TEST_F(DataLayer_Inspectors_VenueReader, Read_Timezone) {
   const auto patch = make_default_patch().with_timezone("GMT+3");
   ASSERT_THAT(patch.timezone(), Optional(Eq("GMT+3")));
@@ -304,6 +316,20 @@ TEST_F(DataLayer_Inspectors_VenueReader, Read_PersistenceFilePath) {
   make_reader().read(venue);
 }
 
+TEST_F(DataLayer_Inspectors_VenueReader, Read_SelfTradePrevention) {
+  const auto patch = make_default_patch().with_self_trade_prevention(
+      Venue::SelfTradePrevention::CancelOldest);
+  const auto venue = Venue::create(patch);
+
+  EXPECT_CALL(marshaller(),
+              self_trade_prevention(
+                  Eq(Attribute::SelfTradePrevention),
+                  Eq(Venue::SelfTradePrevention::CancelOldest)))
+      .Times(1);
+
+  make_reader().read(venue);
+}
+
 TEST_F(DataLayer_Inspectors_VenuePatchReader, Read_VenueID) {
   Venue::Patch patch{};
   patch.with_venue_id("XETRA");
@@ -463,6 +489,17 @@ TEST_F(DataLayer_Inspectors_VenuePatchReader, Read_TnsPartiesEnabledFlag) {
   make_reader().read(patch);
 }
 
+TEST_F(DataLayer_Inspectors_VenuePatchReader, Read_TnsHistoryDepth) {
+  Venue::Patch patch{};
+  patch.with_tns_history_depth(100);  // NOLINT: Test value
+  ASSERT_THAT(patch.tns_history_depth(), Optional(Eq(100)));
+
+  EXPECT_CALL(marshaller(), uint32(Eq(Attribute::TnsHistoryDepth), Eq(100)))
+      .Times(1);
+
+  make_reader().read(patch);
+}
+
 TEST_F(DataLayer_Inspectors_VenuePatchReader, Read_Timezone) {
   Venue::Patch patch{};
   patch.with_timezone("GMT+3");
@@ -511,6 +548,18 @@ TEST_F(DataLayer_Inspectors_VenuePatchReader, Read_PersistenceFilePath) {
   make_reader().read(patch);
 }
 
+TEST_F(DataLayer_Inspectors_VenuePatchReader, Read_SelfTradePrevention) {
+  Venue::Patch patch{};
+  patch.with_self_trade_prevention(Venue::SelfTradePrevention::Decrement);
+
+  EXPECT_CALL(marshaller(),
+              self_trade_prevention(Eq(Attribute::SelfTradePrevention),
+                                    Eq(Venue::SelfTradePrevention::Decrement)))
+      .Times(1);
+
+  make_reader().read(patch);
+}
+
 TEST_F(DataLayer_Inspectors_VenuePatchWriter, Write_VenueID) {
   EXPECT_CALL(unmarshaller(), string(Eq(Attribute::VenueId), _))
       .WillOnce(DoAll(SetArgReferee<1>("XETRA"), Return(true)));
@@ -642,6 +691,16 @@ TEST_F(DataLayer_Inspectors_VenuePatchWriter, Write_TnsPartiesEnabledFlag) {
   EXPECT_THAT(patch.tns_parties_enabled_flag(), Optional(Eq(false)));
 }
 
+TEST_F(DataLayer_Inspectors_VenuePatchWriter, Write_TnsHistoryDepth) {
+  EXPECT_CALL(unmarshaller(), uint32(Eq(Attribute::TnsHistoryDepth), _))
+      .WillOnce(DoAll(SetArgReferee<1>(100), Return(true)));  // NOLINT
+
+  Venue::Patch patch{};
+  make_writer().write(patch);
+
+  EXPECT_THAT(patch.tns_history_depth(), Optional(Eq(100)));
+}
+
 TEST_F(DataLayer_Inspectors_VenuePatchWriter, Write_Timezone) {
   EXPECT_CALL(unmarshaller(), string(Eq(Attribute::Timezone), _))
       .WillOnce(DoAll(SetArgReferee<1>("GMT+3"), Return(true)));
@@ -682,5 +741,18 @@ TEST_F(DataLayer_Inspectors_VenuePatchWriter, Write_PersistenceFilePath) {
   EXPECT_THAT(patch.persistence_file_path(), Optional(Eq("/rw/file.json")));
 }
 
+TEST_F(DataLayer_Inspectors_VenuePatchWriter, Write_SelfTradePrevention) {
+  EXPECT_CALL(unmarshaller(),
+              self_trade_prevention(Eq(Attribute::SelfTradePrevention), _))
+      .WillOnce(DoAll(SetArgReferee<1>(Venue::SelfTradePrevention::CancelBoth),
+                      Return(true)));
+
+  Venue::Patch patch{};
+  make_writer().write(patch);
+
+  EXPECT_THAT(patch.self_trade_prevention(),
+              Optional(Eq(Venue::SelfTradePrevention::CancelBoth)));
+}
+
 }  // namespace
 }  // namespace simulator::data_layer::test
\ No newline at end of file
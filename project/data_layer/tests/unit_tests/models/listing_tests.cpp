@@ -17,6 +17,13 @@ struct DataLayerListingPatch : public Test {
   Listing::Patch patch;
 };
 
+TEST_F(DataLayerListingPatch, SetsListingID) {
+  ASSERT_FALSE(patch.listing_id().has_value());
+
+  patch.with_listing_id(42);
+  EXPECT_THAT(patch.listing_id(), Optional(Eq(42)));
+}
+
 TEST_F(DataLayerListingPatch, SetsSymbol) {
   ASSERT_FALSE(patch.symbol().has_value());
 
@@ -11,6 +11,14 @@ namespace {
 
 using namespace ::testing;
 
+TEST(DataLayer_Model_PriceSeed, Patch_Set_PriceSeedID) {
+  PriceSeed::Patch patch{};
+  EXPECT_FALSE(patch.price_seed_id().has_value());
+
+  patch.with_price_seed_id(42);  // NOLINT: test value
+  EXPECT_THAT(patch.price_seed_id(), Optional(Eq(42)));
+}
+
 TEST(DataLayer_Model_PriceSeed, Patch_Set_Symbol) {
   PriceSeed::Patch patch{};
   EXPECT_FALSE(patch.symbol().has_value());
@@ -116,6 +116,13 @@ TEST_F(DataLayerModelsVenue, Patch_Set_TnsPartiesEnabledFlag) {
   EXPECT_THAT(patch.tns_parties_enabled_flag(), Optional(Eq(false)));
 }
 
+TEST_F(DataLayerModelsVenue, Patch_Set_TnsHistoryDepth) {
+  ASSERT_FALSE(patch.tns_history_depth().has_value());
+
+  patch.with_tns_history_depth(100);  // NOLINT: Test value
+  EXPECT_THAT(patch.tns_history_depth(), Optional(Eq(100)));
+}
+
 TEST_F(DataLayerModelsVenue, Patch_Set_Timezone) {
   ASSERT_FALSE(patch.timezone().has_value());
 
@@ -145,6 +152,14 @@ TEST_F(DataLayerModelsVenue, Patch_Set_PersistenceFilePath) {
               Optional(Eq("/rw/sim-storage.json")));
 }
 
+TEST_F(DataLayerModelsVenue, Patch_Set_SelfTradePrevention) {
+  ASSERT_FALSE(patch.self_trade_prevention().has_value());
+
+  patch.with_self_trade_prevention(Venue::SelfTradePrevention::CancelNewest);
+  EXPECT_THAT(patch.self_trade_prevention(),
+              Optional(Eq(Venue::SelfTradePrevention::CancelNewest)));
+}
+
 TEST_F(DataLayerModelsVenue, Patch_Set_MarketPhases_Add) {
   const MarketPhase::Patch market_phase;
 
@@ -387,6 +402,21 @@ TEST_F(DataLayerModelsVenue, Get_TnsPartiesEnabledFlag_Specified) {
   EXPECT_THAT(venue.tns_parties_enabled_flag(), Optional(Eq(false)));
 }
 
+TEST_F(DataLayerModelsVenue, Get_TnsHistoryDepth_Missing) {
+  patch.with_venue_id("LSE");
+
+  const Venue venue = Venue::create(patch);
+  EXPECT_EQ(venue.tns_history_depth(), std::nullopt);
+}
+
+TEST_F(DataLayerModelsVenue, Get_TnsHistoryDepth_Specified) {
+  patch.with_venue_id("LSE");
+  patch.with_tns_history_depth(100);  // NOLINT: Test value
+
+  const Venue venue = Venue::create(patch);
+  EXPECT_THAT(venue.tns_history_depth(), Optional(Eq(100)));
+}
+
 TEST_F(DataLayerModelsVenue, Get_Timezone_Missing) {
   patch.with_venue_id("LSE");
 
@@ -448,6 +478,22 @@ TEST_F(DataLayerModelsVenue, Get_PersistenceFilePath_Specified) {
   EXPECT_THAT(venue.persistence_file_path(), Optional(Eq("/rw/state.json")));
 }
 
+TEST_F(DataLayerModelsVenue, Get_SelfTradePrevention_Missing) {
+  patch.with_venue_id("LSE");
+
+  const Venue venue = Venue::create(patch);
+  EXPECT_EQ(venue.self_trade_prevention(), std::nullopt);
+}
+
+TEST_F(DataLayerModelsVenue, Get_SelfTradePrevention_Specified) {
+  patch.with_venue_id("LSE");
+  patch.with_self_trade_prevention(Venue::SelfTradePrevention::Decrement);
+
+  const Venue venue = Venue::create(patch);
+  EXPECT_THAT(venue.self_trade_prevention(),
+              Optional(Eq(Venue::SelfTradePrevention::Decrement)));
+}
+
 TEST_F(DataLayerModelsVenue, Get_MarketPhases_Missing) {
   patch.with_venue_id("LSE");
   ASSERT_FALSE(patch.market_phases().has_value());
@@ -419,6 +419,10 @@ TEST_F(DataLayerVenueResolver, ResolvesTnsPartiesEnabled) {
   EXPECT_EQ(resolver(Column::TnsPartiesEnabled), "tns_parties_enabled");
 }
 
+TEST_F(DataLayerVenueResolver, ResolvesTnsHistoryDepth) {
+  EXPECT_EQ(resolver(Column::TnsHistoryDepth), "tns_history_depth");
+}
+
 TEST_F(DataLayerVenueResolver, ResolvesTimezone) {
   EXPECT_EQ(resolver(Column::Timezone), "timezone");
 }
@@ -435,5 +439,9 @@ TEST_F(DataLayerVenueResolver, ResolvesPersistenceFilePath) {
   EXPECT_EQ(resolver(Column::PersistenceFilePath), "persistence_file_path");
 }
 
+TEST_F(DataLayerVenueResolver, ResolvesSelfTradePrevention) {
+  EXPECT_EQ(resolver(Column::SelfTradePrevention), "self_trade_prevention");
+}
+
 }  // namespace
 }  // namespace simulator::data_layer::internal_pqxx::test
\ No newline at end of file
@@ -202,5 +202,69 @@ TEST(DataLayer_Pqxx_EnumerationResolver_VenueEngineType, Value_Quoting) {
   EXPECT_EQ(engine_type, Venue::EngineType::Quoting);
 }
 
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     String_Undefined) {
+  constexpr EnumerationResolver resolver;
+  EXPECT_THROW(resolver(static_cast<Venue::SelfTradePrevention>(-1)),
+               EnumEncodingError);
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention, String_None) {
+  constexpr EnumerationResolver resolver;
+  EXPECT_EQ(resolver(Venue::SelfTradePrevention::None), "None");
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     String_CancelNewest) {
+  constexpr EnumerationResolver resolver;
+  EXPECT_EQ(resolver(Venue::SelfTradePrevention::CancelNewest),
+            "CancelNewest");
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     String_CancelOldest) {
+  constexpr EnumerationResolver resolver;
+  EXPECT_EQ(resolver(Venue::SelfTradePrevention::CancelOldest),
+            "CancelOldest");
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     String_CancelBoth) {
+  constexpr EnumerationResolver resolver;
+  EXPECT_EQ(resolver(Venue::SelfTradePrevention::CancelBoth), "CancelBoth");
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     String_Decrement) {
+  constexpr EnumerationResolver resolver;
+  EXPECT_EQ(resolver(Venue::SelfTradePrevention::Decrement), "Decrement");
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     Value_Undefined) {
+  constexpr EnumerationResolver resolver;
+  auto mode = static_cast<Venue::SelfTradePrevention>(-1);
+
+  EXPECT_THROW(resolver("bad_string", mode), EnumDecodingError);
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     Value_CancelOldest) {
+  constexpr EnumerationResolver resolver;
+  auto mode = static_cast<Venue::SelfTradePrevention>(-1);
+
+  EXPECT_NO_THROW(resolver("CancelOldest", mode));
+  EXPECT_EQ(mode, Venue::SelfTradePrevention::CancelOldest);
+}
+
+TEST(DataLayer_Pqxx_EnumerationResolver_VenueSelfTradePrevention,
+     Value_Decrement) {
+  constexpr EnumerationResolver resolver;
+  auto mode = static_cast<Venue::SelfTradePrevention>(-1);
+
+  EXPECT_NO_THROW(resolver("Decrement", mode));
+  EXPECT_EQ(mode, Venue::SelfTradePrevention::Decrement);
+}
+
 }  // namespace
 }  // namespace simulator::data_layer::internal_pqxx::test
\ No newline at end of file
@@ -1,10 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <string>
 
 #include "cfg/api/cfg.hpp"
 #include "ih/common/exceptions.hpp"
 #include "ih/pqxx/context.hpp"
+#include "ih/pqxx/database/connection_pool.hpp"
 
 namespace simulator::data_layer::internal_pqxx::test {
 namespace {
@@ -141,5 +143,38 @@ TEST(DataLayer_Pqxx_Context, GetConnectionString_ProperlyConfigured) {
   EXPECT_EQ(context.get_connection_string(), expected);
 }
 
+TEST(DataLayer_Pqxx_Context, GetPoolSettings_NonConfigured) {
+  const Context context;
+  const database::PoolSettings defaults;
+
+  EXPECT_EQ(context.get_pool_settings().max_size, defaults.max_size);
+  EXPECT_EQ(context.get_pool_settings().idle_timeout, defaults.idle_timeout);
+}
+
+TEST(DataLayer_Pqxx_Context, GetPoolSettings_Configured) {
+  cfg::DbConfiguration config;
+  config.host = "host";
+  config.port = "5432";
+  config.user = "user";
+  config.name = "database";
+  config.password = "password";
+  config.pool_size = 8;            // NOLINT: Test value
+  config.pool_idle_timeout = 120;  // NOLINT: Test value
+
+  Context context;
+  ASSERT_NO_THROW(context.configure(config));
+
+  EXPECT_EQ(context.get_pool_settings().max_size, 8);
+  EXPECT_EQ(context.get_pool_settings().idle_timeout,
+            std::chrono::seconds{120});
+}
+
+TEST(DataLayer_Pqxx_Context, ConnectionPool_SharedByCopies) {
+  const Context context{"my_connection_string"};
+  const Context copy = context;  // NOLINT: Copy is tested
+
+  EXPECT_EQ(&context.connection_pool(), &copy.connection_pool());
+}
+
 }  // namespace
 }  // namespace simulator::data_layer::internal_pqxx::test
\ No newline at end of file
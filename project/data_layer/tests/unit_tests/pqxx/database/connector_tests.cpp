@@ -59,6 +59,28 @@ TEST_F(DataLayer_Pqxx_Connector, Connect_WithNonConfiguredContext) {
   EXPECT_THROW(auto cnn = connector.connect_under(context), ConnectionFailure);
 }
 
+TEST_F(DataLayer_Pqxx_Connector, Connect_WithEmptyConnectionString) {
+  const Connector connector = make_connector(
+      []([[maybe_unused]] const auto& conn_url) -> pqxx::connection {
+        return pqxx::connection{};
+      });
+
+  EXPECT_THROW(auto cnn = connector.connect_under(std::string{}),
+               ConnectionFailure);
+}
+
+TEST_F(DataLayer_Pqxx_Connector, Connect_WithConnectionString) {
+  const Connector connector =
+      make_connector([](const std::string& conn_url) -> pqxx::connection {
+        EXPECT_EQ(conn_url, expected_connection_string());
+        throw std::logic_error("test error");
+      });
+
+  EXPECT_THROW(
+      auto cnn = connector.connect_under(expected_connection_string()),
+      ConnectionFailure);
+}
+
 TEST_F(DataLayer_Pqxx_Connector, Connect_WithConfiguredContext) {
   Context context{};
   ASSERT_NO_THROW(context.configure(make_default_configuration()));
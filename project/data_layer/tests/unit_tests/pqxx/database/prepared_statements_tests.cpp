@@ -0,0 +1,87 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "ih/pqxx/database/prepared_statements.hpp"
+
+namespace simulator::data_layer::internal_pqxx::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+class ConnectionMock {
+ public:
+  MOCK_METHOD(void, prepare, (std::string_view, std::string_view));
+};
+
+class DataLayer_Pqxx_PreparedStatements : public Test {
+ public:
+  ConnectionMock connection;
+};
+
+TEST_F(DataLayer_Pqxx_PreparedStatements, PreparesNewQuery) {
+  PreparedStatements statements;
+
+  EXPECT_CALL(connection, prepare(_, Eq("SELECT * FROM t WHERE a = $1")));
+
+  const auto name =
+      statements.prepare(connection, "SELECT * FROM t WHERE a = $1");
+
+  ASSERT_TRUE(name.has_value());
+  EXPECT_EQ(statements.size(), 1);
+}
+
+TEST_F(DataLayer_Pqxx_PreparedStatements, ReusesStatementForSameQuery) {
+  PreparedStatements statements;
+
+  EXPECT_CALL(connection, prepare).Times(1);
+
+  const auto first = statements.prepare(connection, "SELECT * FROM t");
+  const auto second = statements.prepare(connection, "SELECT * FROM t");
+
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(std::string{*first}, std::string{*second});
+}
+
+TEST_F(DataLayer_Pqxx_PreparedStatements, NamesQueriesDistinctly) {
+  PreparedStatements statements;
+
+  EXPECT_CALL(connection, prepare).Times(2);
+
+  const auto first = statements.prepare(connection, "SELECT * FROM t");
+  const auto second = statements.prepare(connection, "SELECT * FROM u");
+
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_NE(std::string{*first}, std::string{*second});
+}
+
+TEST_F(DataLayer_Pqxx_PreparedStatements, SkipsQueryWhenCapacityExhausted) {
+  PreparedStatements statements{1};
+
+  EXPECT_CALL(connection, prepare).Times(1);
+
+  ASSERT_TRUE(statements.prepare(connection, "SELECT * FROM t").has_value());
+  EXPECT_FALSE(statements.prepare(connection, "SELECT * FROM u").has_value());
+  EXPECT_TRUE(statements.prepare(connection, "SELECT * FROM t").has_value());
+}
+
+TEST_F(DataLayer_Pqxx_PreparedStatements, ForgetsQueryFailedToPrepare) {
+  PreparedStatements statements;
+
+  EXPECT_CALL(connection, prepare)
+      .WillOnce(Throw(std::runtime_error{"syntax error"}))
+      .WillOnce(Return());
+
+  EXPECT_THROW((void)statements.prepare(connection, "SELEC"),
+               std::runtime_error);
+  EXPECT_EQ(statements.size(), 0);
+  EXPECT_TRUE(statements.prepare(connection, "SELEC").has_value());
+}
+
+}  // namespace
+}  // namespace simulator::data_layer::internal_pqxx::test
@@ -0,0 +1,41 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "ih/pqxx/database/query_parameters.hpp"
+
+namespace simulator::data_layer::internal_pqxx::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*)
+
+TEST(DataLayer_Pqxx_QueryParameters, IsEmptyByDefault) {
+  const QueryParameters parameters;
+
+  EXPECT_EQ(parameters.size(), 0);
+}
+
+TEST(DataLayer_Pqxx_QueryParameters, SubstitutesValueWithPlaceholder) {
+  QueryParameters parameters;
+
+  EXPECT_EQ(parameters(std::string{"LSE"}), "$1");
+  EXPECT_EQ(parameters.size(), 1);
+}
+
+TEST(DataLayer_Pqxx_QueryParameters, NumbersPlaceholdersInBindingOrder) {
+  QueryParameters parameters;
+
+  EXPECT_EQ(parameters(std::string{"LSE"}), "$1");
+  EXPECT_EQ(parameters(std::uint64_t{42}), "$2");
+  EXPECT_EQ(parameters(true), "$3");
+  EXPECT_EQ(parameters.size(), 3);
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace simulator::data_layer::internal_pqxx::test
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <pqxx/except>
+#include <pqxx/params>
 
 #include "api/exceptions/exceptions.hpp"
 #include "ih/pqxx/database/transaction.hpp"
@@ -16,6 +17,10 @@ class TransactionImplMock {
   MOCK_METHOD(void, exec0, (pqxx::zview));
   MOCK_METHOD(void, exec1, (pqxx::zview));
   MOCK_METHOD(void, exec, (pqxx::zview));
+  MOCK_METHOD(void, exec_params0, (pqxx::zview, const pqxx::params&));
+  MOCK_METHOD(void, exec_params1, (pqxx::zview, const pqxx::params&));
+  MOCK_METHOD(void, exec_params, (pqxx::zview, const pqxx::params&));
+  MOCK_METHOD(void, exec_unprepared, (pqxx::zview, const pqxx::params&));
 };
 
 class DataLayer_Pqxx_TransactionHandler : public ::testing::Test {
@@ -251,5 +256,65 @@ TEST_F(DataLayer_Pqxx_TransactionHandler, Exec_UnkonwError) {
   EXPECT_THROW(handler.exec(""), data_layer::InternalError);
 }
 
+TEST_F(DataLayer_Pqxx_TransactionHandler, Exec0Params_ExecutesParameterized) {
+  TransactionHandler handler = make_transaction_handler();
+  const pqxx::params parameters;
+
+  EXPECT_CALL(transaction(), exec_params0(Eq("DELETE FROM t"), _));
+
+  handler.exec0("DELETE FROM t", parameters);
+}
+
+TEST_F(DataLayer_Pqxx_TransactionHandler, Exec0Params_ConnectionBrokenThrown) {
+  TransactionHandler handler = make_transaction_handler();
+  const pqxx::params parameters;
+
+  EXPECT_CALL(transaction(), exec_params0)
+      .WillOnce(Throw(pqxx::broken_connection{""}));
+
+  EXPECT_THROW(handler.exec0("", parameters), data_layer::ConnectionFailure);
+}
+
+TEST_F(DataLayer_Pqxx_TransactionHandler, Exec1Params_UnexpectedRowsThrown) {
+  TransactionHandler handler = make_transaction_handler();
+  const pqxx::params parameters;
+
+  EXPECT_CALL(transaction(), exec_params1)
+      .WillOnce(Throw(pqxx::unexpected_rows{""}));
+
+  EXPECT_THROW(handler.exec1("", parameters),
+               data_layer::CardinalityViolationError);
+}
+
+TEST_F(DataLayer_Pqxx_TransactionHandler, ExecParams_PqxxDataError) {
+  TransactionHandler handler = make_transaction_handler();
+  const pqxx::params parameters;
+
+  EXPECT_CALL(transaction(), exec_params)
+      .WillOnce(Throw(pqxx::data_exception{""}));
+
+  EXPECT_THROW(handler.exec("", parameters), data_layer::InternalError);
+}
+
+TEST_F(DataLayer_Pqxx_TransactionHandler, ExecUnprepared_ExecutesQuery) {
+  TransactionHandler handler = make_transaction_handler();
+  const pqxx::params parameters;
+
+  EXPECT_CALL(transaction(), exec_unprepared(Eq("INSERT INTO t"), _));
+
+  handler.exec_unprepared("INSERT INTO t", parameters);
+}
+
+TEST_F(DataLayer_Pqxx_TransactionHandler, ExecUnprepared_UniqueViolation) {
+  TransactionHandler handler = make_transaction_handler();
+  const pqxx::params parameters;
+
+  EXPECT_CALL(transaction(), exec_unprepared)
+      .WillOnce(Throw(pqxx::unique_violation{""}));
+
+  EXPECT_THROW(handler.exec_unprepared("", parameters),
+               data_layer::DataIntegrityError);
+}
+
 }  // namespace
 }  // namespace simulator::data_layer::internal_pqxx::test
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "api/exceptions/exceptions.hpp"
+#include "api/models/venue.hpp"
+#include "ih/pqxx/queries/detail/bulk_insert_query_builder.hpp"
+#include "tests/test_utils/sanitizer_stub.hpp"
+
+namespace simulator::data_layer::internal_pqxx::detail::test {
+namespace {
+
+struct DataLayerPqxxBulkInsertQueryBuilder : public ::testing::Test {
+  SanitizerStub sanitizer;
+  BulkInsertQueryBuilder builder{"table"};
+
+  auto add_venue(const std::string& venue_id, const std::string& name)
+      -> void {
+    auto data_extractor = builder.make_data_extractor(sanitizer);
+    data_extractor(Venue::Attribute::VenueId, venue_id);
+    data_extractor(Venue::Attribute::Name, name);
+    builder.add_row(data_extractor);
+  }
+};
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, Create_EmptyTableName) {
+  EXPECT_THROW(BulkInsertQueryBuilder{""}, InternalError);
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, Compose_Empty) {
+  EXPECT_THROW((void)builder.compose(), MalformedPatch);
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, AddRow_NoColumns) {
+  auto data_extractor = builder.make_data_extractor(sanitizer);
+
+  EXPECT_THROW(builder.add_row(data_extractor), MalformedPatch);
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, AddRow_DifferentColumns) {
+  add_venue("LSE", "London Stock Exchange");
+
+  auto data_extractor = builder.make_data_extractor(sanitizer);
+  data_extractor(Venue::Attribute::VenueId, "XETRA");
+
+  EXPECT_THROW(builder.add_row(data_extractor), MalformedPatch);
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, Compose_SingleRow) {
+  add_venue("LSE", "London Stock Exchange");
+
+  EXPECT_EQ(builder.compose(),
+            "INSERT INTO table (venue_id, name) "
+            "VALUES (`LSE`, `London Stock Exchange`) "
+            "RETURNING *");
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, Compose_MultipleRows) {
+  add_venue("LSE", "London Stock Exchange");
+  add_venue("XETRA", "Deutsche Boerse");
+
+  EXPECT_EQ(builder.compose(),
+            "INSERT INTO table (venue_id, name) "
+            "VALUES (`LSE`, `London Stock Exchange`), "
+            "(`XETRA`, `Deutsche Boerse`) "
+            "RETURNING *");
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, Compose_WithConflictTarget) {
+  add_venue("LSE", "London Stock Exchange");
+  builder.with_conflict_target(Venue::Attribute::VenueId);
+
+  EXPECT_EQ(builder.compose(),
+            "INSERT INTO table (venue_id, name) "
+            "VALUES (`LSE`, `London Stock Exchange`) "
+            "ON CONFLICT (venue_id) DO UPDATE SET name = EXCLUDED.name "
+            "RETURNING *");
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, Compose_WithConflictTargetOnly) {
+  auto data_extractor = builder.make_data_extractor(sanitizer);
+  data_extractor(Venue::Attribute::VenueId, "LSE");
+  builder.add_row(data_extractor);
+  builder.with_conflict_target(Venue::Attribute::VenueId);
+
+  EXPECT_EQ(builder.compose(),
+            "INSERT INTO table (venue_id) "
+            "VALUES (`LSE`) "
+            "ON CONFLICT (venue_id) "
+            "DO UPDATE SET venue_id = EXCLUDED.venue_id "
+            "RETURNING *");
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilder, Compose_MissingConflictTarget) {
+  add_venue("LSE", "London Stock Exchange");
+  builder.with_conflict_target(Venue::Attribute::Timezone);
+
+  EXPECT_THROW((void)builder.compose(), MalformedPatch);
+}
+
+struct DataLayerPqxxBulkInsertQueryBuilderBatches : public ::testing::Test {
+  template <typename... KeyColumns>
+  static auto split(const std::vector<Venue::Patch>& patches,
+                    KeyColumns... key_columns) -> std::vector<std::size_t> {
+    const auto batches = BulkInsertQueryBuilder::split_into_batches(
+        std::span<const Venue::Patch>{patches},
+        [](const Venue::Patch& patch, auto& data_extractor) {
+          if (patch.venue_id().has_value()) {
+            data_extractor(Venue::Attribute::VenueId, *patch.venue_id());
+          }
+          if (patch.name().has_value()) {
+            data_extractor(Venue::Attribute::Name, *patch.name());
+          }
+        },
+        key_columns...);
+
+    std::vector<std::size_t> sizes;
+    for (const auto& batch : batches) {
+      sizes.push_back(batch.size());
+    }
+    return sizes;
+  }
+};
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilderBatches, SplitsNothing) {
+  EXPECT_TRUE(split({}).empty());
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilderBatches, KeepsSameColumnsTogether) {
+  std::vector<Venue::Patch> patches(3);
+  patches[0].with_venue_id("LSE").with_name("London");
+  patches[1].with_venue_id("XETRA").with_name("Frankfurt");
+  patches[2].with_venue_id("NYSE").with_name("New York");
+
+  EXPECT_EQ(split(patches), std::vector<std::size_t>{3});
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilderBatches, SplitsOnDifferentColumns) {
+  std::vector<Venue::Patch> patches(3);
+  patches[0].with_venue_id("LSE").with_name("London");
+  patches[1].with_venue_id("XETRA");
+  patches[2].with_venue_id("NYSE").with_name("New York");
+
+  EXPECT_EQ(split(patches), (std::vector<std::size_t>{1, 1, 1}));
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilderBatches, SplitsOnParametersLimit) {
+  constexpr std::size_t rows_per_batch =
+      BulkInsertQueryBuilder::MaxParameters / 2;
+  std::vector<Venue::Patch> patches(rows_per_batch + 1);
+  for (auto& patch : patches) {
+    patch.with_venue_id("LSE").with_name("London");
+  }
+
+  EXPECT_EQ(split(patches), (std::vector<std::size_t>{rows_per_batch, 1}));
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilderBatches, KeepsDistinctKeysTogether) {
+  std::vector<Venue::Patch> patches(3);
+  patches[0].with_venue_id("LSE").with_name("London");
+  patches[1].with_venue_id("XETRA").with_name("Frankfurt");
+  patches[2].with_venue_id("NYSE").with_name("New York");
+
+  EXPECT_EQ(split(patches, Venue::Attribute::VenueId),
+            std::vector<std::size_t>{3});
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilderBatches, SplitsOnRepeatedKey) {
+  std::vector<Venue::Patch> patches(4);
+  patches[0].with_venue_id("LSE").with_name("London");
+  patches[1].with_venue_id("XETRA").with_name("Frankfurt");
+  patches[2].with_venue_id("LSE").with_name("London City");
+  patches[3].with_venue_id("NYSE").with_name("New York");
+
+  EXPECT_EQ(split(patches, Venue::Attribute::VenueId),
+            (std::vector<std::size_t>{2, 2}));
+}
+
+TEST_F(DataLayerPqxxBulkInsertQueryBuilderBatches, RejectsPatchWithoutKey) {
+  std::vector<Venue::Patch> patches(2);
+  patches[0].with_venue_id("LSE").with_name("London");
+  patches[1].with_name("Frankfurt");
+
+  EXPECT_THROW((void)split(patches, Venue::Attribute::VenueId),
+               MalformedPatch);
+}
+
+}  // namespace
+}  // namespace simulator::data_layer::internal_pqxx::detail::test
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "api/exceptions/exceptions.hpp"
 #include "api/models/listing.hpp"
@@ -34,6 +35,43 @@ TEST_F(DataLayerPqxxListingQueryInsert, Compose_FromNonEmptyPatch) {
             "RETURNING listing_id");
 }
 
+struct DataLayerPqxxListingQueryInsertAll : public ::testing::Test {
+  std::vector<Listing::Patch> patches{2};
+  SanitizerStub sanitizer;
+};
+
+TEST_F(DataLayerPqxxListingQueryInsertAll, Compose_FromNonEmptyPatches) {
+  patches[0].with_symbol("AAPL").with_venue_id("NASDAQ");
+  patches[1].with_symbol("MSFT").with_venue_id("NASDAQ");
+
+  const auto query = InsertAll::prepare(patches, sanitizer);
+  EXPECT_EQ(query.compose(),
+            "INSERT INTO listing (symbol, venue_id) "
+            "VALUES (`AAPL`, `NASDAQ`), (`MSFT`, `NASDAQ`) "
+            "RETURNING *");
+}
+
+TEST_F(DataLayerPqxxListingQueryInsertAll, Compose_IgnoresListingID) {
+  patches[0].with_listing_id(1).with_symbol("AAPL").with_venue_id("NASDAQ");
+  patches[1].with_listing_id(2).with_symbol("MSFT").with_venue_id("NASDAQ");
+
+  const auto query = InsertAll::prepare(patches, sanitizer);
+  EXPECT_EQ(query.compose(),
+            "INSERT INTO listing (symbol, venue_id) "
+            "VALUES (`AAPL`, `NASDAQ`), (`MSFT`, `NASDAQ`) "
+            "RETURNING *");
+}
+
+TEST_F(DataLayerPqxxListingQueryInsertAll, SplitIntoBatches_ByColumns) {
+  patches[0].with_symbol("AAPL").with_venue_id("NASDAQ");
+  patches[1].with_symbol("MSFT");
+
+  const auto batches = InsertAll::split_into_batches(patches);
+  ASSERT_EQ(batches.size(), 2);
+  EXPECT_EQ(batches[0].size(), 1);
+  EXPECT_EQ(batches[1].size(), 1);
+}
+
 struct DataLayerPqxxListingQuerySelect : public ::testing::Test {
   SanitizerStub sanitizer;
 };
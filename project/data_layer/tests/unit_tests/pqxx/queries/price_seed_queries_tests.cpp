@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "api/exceptions/exceptions.hpp"
 #include "api/models/price_seed.hpp"
@@ -32,6 +33,22 @@ TEST_F(DataLayerPqxxPriceSeedQueryInsert, Compose_FromNonEmptyPatch) {
             "RETURNING price_seed_id");
 }
 
+struct DataLayerPqxxPriceSeedQueryInsertAll : public ::testing::Test {
+  std::vector<PriceSeed::Patch> patches{2};
+  SanitizerStub sanitizer;
+};
+
+TEST_F(DataLayerPqxxPriceSeedQueryInsertAll, Compose_FromNonEmptyPatches) {
+  patches[0].with_symbol("AAPL").with_mid_price(42.42);  // NOLINT: test value
+  patches[1].with_symbol("MSFT").with_mid_price(24.24);  // NOLINT: test value
+
+  const auto query = InsertAll::prepare(patches, sanitizer);
+  EXPECT_EQ(query.compose(),
+            "INSERT INTO price_seed (symbol, mid_price) "
+            "VALUES (`AAPL`, `42.42`), (`MSFT`, `24.24`) "
+            "RETURNING *");
+}
+
 struct DataLayerPqxxPriceSeedQuerySelect : public ::testing::Test {
   SanitizerStub sanitizer;
 };
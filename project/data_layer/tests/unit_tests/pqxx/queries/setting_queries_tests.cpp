@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "api/exceptions/exceptions.hpp"
 #include "api/models/setting.hpp"
@@ -41,6 +42,35 @@ TEST_F(DataLayerPqxxSettingQueryInsert, Compose_WithKeyReturning) {
             "RETURNING key");
 }
 
+struct DataLayerPqxxSettingQueryInsertAll : public ::testing::Test {
+  std::vector<Setting::Patch> patches{2};
+  SanitizerStub sanitizer;
+};
+
+TEST_F(DataLayerPqxxSettingQueryInsertAll, Compose_FromNonEmptyPatches) {
+  patches[0].with_key("A").with_value("1");
+  patches[1].with_key("B").with_value("2");
+
+  const auto query = InsertAll::prepare(patches, sanitizer);
+  EXPECT_EQ(query.compose(),
+            "INSERT INTO setting (key, value) "
+            "VALUES (`A`, `1`), (`B`, `2`) "
+            "RETURNING *");
+}
+
+TEST_F(DataLayerPqxxSettingQueryInsertAll, Compose_WithConflictUpdate) {
+  patches[0].with_key("A").with_value("1");
+  patches[1].with_key("B").with_value("2");
+
+  auto query = InsertAll::prepare(patches, sanitizer);
+  query.on_conflict_update();
+  EXPECT_EQ(query.compose(),
+            "INSERT INTO setting (key, value) "
+            "VALUES (`A`, `1`), (`B`, `2`) "
+            "ON CONFLICT (key) DO UPDATE SET value = EXCLUDED.value "
+            "RETURNING *");
+}
+
 struct DataLayerPqxxSettingQuerySelect : public ::testing::Test {
   SanitizerStub sanitizer;
 };
@@ -7,12 +7,15 @@
 
 #include <functional>
 
+#include "cfg/api/cfg.hpp"
 #include "ih/communicators/reply_sender.hpp"
 #include "ih/processors/event_processor.hpp"
 #include "ih/processors/request_processor.hpp"
 
 namespace simulator::fix::acceptor {
 
+// Processes FIX messages bound to the venue the application
+// is constructed in, as QuickFIX session threads are not
 class Application final : public FIX::NullApplication {
  public:
   Application(const RequestProcessor& request_processor,
@@ -35,6 +38,7 @@ class Application final : public FIX::NullApplication {
 
   std::reference_wrapper<const RequestProcessor> request_processor_;
   std::reference_wrapper<const EventProcessor> event_processor_;
+  const cfg::HostedVenueConfiguration* venue_;
 };
 
 }  // namespace simulator::fix::acceptor
@@ -8,7 +8,9 @@
 #include "core/domain/instrument_descriptor.hpp"
 #include "core/domain/party.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -25,6 +27,12 @@ struct FromFixMapper {
   static auto map(const FIX::Message& fix_message,
                   protocol::OrderCancellationRequest& request) -> void;
 
+  static auto map(const FIX::Message& fix_message,
+                  protocol::OrderMassCancellationRequest& request) -> void;
+
+  static auto map(const FIX::Message& fix_message,
+                  protocol::MassQuoteRequest& request) -> void;
+
   static auto map(const FIX::Message& fix_message,
                   protocol::MarketDataRequest& request) -> void;
 
@@ -15,6 +15,7 @@
 #include "protocol/app/market_data_update.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -56,6 +57,10 @@ struct ToFixMapper {
                   FIX::Message& fix_message,
                   const MappingSettings::Setting& setting) -> void;
 
+  static auto map(const protocol::OrderMassCancellationReport& reply,
+                  FIX::Message& fix_message,
+                  const MappingSettings::Setting& setting) -> void;
+
   static auto map(const protocol::MarketDataReject& reply,
                   FIX::Message& fix_message,
                   const MappingSettings::Setting& setting) -> void;
@@ -19,6 +19,7 @@
 #include "protocol/app/market_data_update.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -38,6 +39,7 @@ concept ReplyMapperConcept =
     ReplyMessageMapper<Mapper, protocol::OrderModificationReject, FIX::Message, MappingSettings::Setting> &&
     ReplyMessageMapper<Mapper, protocol::OrderCancellationConfirmation, FIX::Message, MappingSettings::Setting> &&
     ReplyMessageMapper<Mapper, protocol::OrderCancellationReject, FIX::Message, MappingSettings::Setting> &&
+    ReplyMessageMapper<Mapper, protocol::OrderMassCancellationReport, FIX::Message, MappingSettings::Setting> &&
     ReplyMessageMapper<Mapper, protocol::MarketDataReject, FIX::Message, MappingSettings::Setting> &&
     ReplyMessageMapper<Mapper, protocol::MarketDataSnapshot, FIX::Message, MappingSettings::Setting> &&
     ReplyMessageMapper<Mapper, protocol::MarketDataUpdate, FIX::Message, MappingSettings::Setting> &&
@@ -92,6 +94,11 @@ class AppReplyProcessor {
     send_as(FIX::MsgType{FIX::MsgType_OrderCancelReject}, reply);
   }
 
+  auto process_reply(const protocol::OrderMassCancellationReport& reply) const
+      -> void {
+    send_as(FIX::MsgType{FIX::MsgType_OrderMassCancelReport}, reply);
+  }
+
   auto process_reply(const protocol::MarketDataReject& reply) const -> void {
     send_as(FIX::MsgType{FIX::MsgType_MarketDataRequestReject}, reply);
   }
@@ -14,7 +14,9 @@
 #include "ih/processors/request_processor.hpp"
 #include "middleware/routing/trading_request_channel.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -29,6 +31,8 @@ concept RequestMapperConcept =
     RequestMessageMapper<Mapper, FIX::Message, protocol::OrderPlacementRequest> &&
     RequestMessageMapper<Mapper, FIX::Message, protocol::OrderModificationRequest> &&
     RequestMessageMapper<Mapper, FIX::Message, protocol::OrderCancellationRequest> &&
+    RequestMessageMapper<Mapper, FIX::Message, protocol::OrderMassCancellationRequest> &&
+    RequestMessageMapper<Mapper, FIX::Message, protocol::MassQuoteRequest> &&
     RequestMessageMapper<Mapper, FIX::Message, protocol::MarketDataRequest> &&
     RequestMessageMapper<Mapper, FIX::Message, protocol::SecurityStatusRequest>;
 // clang-format on
@@ -64,6 +68,11 @@ auto AppRequestProcessor<MapperType>::process_fix_request(
     dispatch_as<protocol::OrderModificationRequest>(fix_message, fix_session);
   } else if (message_type == FIX::MsgType_OrderCancelRequest) {
     dispatch_as<protocol::OrderCancellationRequest>(fix_message, fix_session);
+  } else if (message_type == FIX::MsgType_OrderMassCancelRequest) {
+    dispatch_as<protocol::OrderMassCancellationRequest>(fix_message,
+                                                        fix_session);
+  } else if (message_type == FIX::MsgType_MassQuote) {
+    dispatch_as<protocol::MassQuoteRequest>(fix_message, fix_session);
   } else if (message_type == FIX::MsgType_MarketDataRequest) {
     dispatch_as<protocol::MarketDataRequest>(fix_message, fix_session);
   } else if (message_type == FIX::MsgType_SecurityStatusRequest) {
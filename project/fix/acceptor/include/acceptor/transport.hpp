@@ -9,6 +9,7 @@
 #include "protocol/app/market_data_update.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -38,6 +39,9 @@ auto send_reply(const protocol::OrderModificationReject& reply,
 auto send_reply(const protocol::OrderCancellationConfirmation& reply,
                 Acceptor& acceptor) noexcept -> void;
 
+auto send_reply(const protocol::OrderMassCancellationReport& reply,
+                Acceptor& acceptor) noexcept -> void;
+
 auto send_reply(const protocol::OrderCancellationReject& reply,
                 Acceptor& acceptor) noexcept -> void;
 
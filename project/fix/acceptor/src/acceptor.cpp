@@ -241,6 +241,12 @@ auto send_reply(const protocol::OrderCancellationConfirmation& reply,
   send_reply_message(reply, acceptor.implementation());
 }
 
+auto send_reply(const protocol::OrderMassCancellationReport& reply,
+                Acceptor& acceptor) noexcept -> void {
+  log::debug("fix acceptor sending OrderMassCancellationReport reply");
+  send_reply_message(reply, acceptor.implementation());
+}
+
 auto send_reply(const protocol::OrderCancellationReject& reply,
                 Acceptor& acceptor) noexcept -> void {
   log::debug("fix acceptor sending OrderCancellationReject reply");
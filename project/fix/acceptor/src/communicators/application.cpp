@@ -5,6 +5,7 @@
 
 #include <stdexcept>
 
+#include "cfg/api/venue_scope.hpp"
 #include "ih/processors/event_processor.hpp"
 #include "ih/processors/request_processor.hpp"
 #include "log/logging.hpp"
@@ -14,9 +15,11 @@ namespace simulator::fix::acceptor {
 Application::Application(const RequestProcessor& request_processor,
                          const EventProcessor& event_processor) noexcept
     : request_processor_(request_processor),
-      event_processor_(event_processor) {}
+      event_processor_(event_processor),
+      venue_(cfg::current_venue()) {}
 
 auto Application::onLogout(const FIX::SessionID& fix_session) -> void {
+  const cfg::VenueScope scope{venue_};
   try {
     log::debug("application accepted session disconnection event");
     emit_session_disconnection_event(event_processor_, fix_session);
@@ -31,6 +34,7 @@ auto Application::onLogout(const FIX::SessionID& fix_session) -> void {
 auto Application::fromApp(const FIX::Message& fix_message,
                           const FIX::SessionID& fix_session) noexcept(false)
     -> void {
+  const cfg::VenueScope scope{venue_};
   try {
     log::debug("application accepted fix message");
     process_request(request_processor_, fix_session, fix_message);
@@ -65,6 +65,29 @@ auto map_market_entry_type(const FIX::FieldMap& source,
   }
 }
 
+auto map_quote_entry(const FIX::FieldMap& source,
+                     std::vector<protocol::QuoteEntry>& destination) -> void {
+  std::optional<ClientOrderId> client_order_id;
+  map_fix_field<FIX::QuoteEntryID>(source, client_order_id);
+
+  // Each side of a quote entry is placed as a separate order,
+  // both of them are identified by the quote entry identifier.
+  if (contains<FIX::FIELD::BidPx>(source)) {
+    auto& entry = destination.emplace_back();
+    entry.client_order_id = client_order_id;
+    entry.side = Side::Option::Buy;
+    map_fix_field<FIX::BidPx>(source, entry.order_price);
+    map_fix_field<FIX::BidSize>(source, entry.order_quantity);
+  }
+  if (contains<FIX::FIELD::OfferPx>(source)) {
+    auto& entry = destination.emplace_back();
+    entry.client_order_id = client_order_id;
+    entry.side = Side::Option::Sell;
+    map_fix_field<FIX::OfferPx>(source, entry.order_price);
+    map_fix_field<FIX::OfferSize>(source, entry.order_quantity);
+  }
+}
+
 }  // namespace
 
 auto FromFixMapper::map(const FIX::Message& fix_message,
@@ -78,6 +101,8 @@ auto FromFixMapper::map(const FIX::Message& fix_message,
   map_fix_field<FIX::TimeInForce>(fix_message, request.time_in_force);
   map_fix_field<FIX::OrderQty>(fix_message, request.order_quantity);
   map_fix_field<FIX::Price>(fix_message, request.order_price);
+  map_fix_field<FIX::StopPx>(fix_message, request.stop_price);
+  map_fix_field<FIX::MaxFloor>(fix_message, request.display_quantity);
   map_fix_field<FIX::ExpireTime>(fix_message, request.expire_time);
   map_fix_field<FIX::ExpireDate>(fix_message, request.expire_date);
 
@@ -120,6 +145,52 @@ auto FromFixMapper::map(const FIX::Message& fix_message,
   map_fix_field<FIX::Side>(fix_message, request.side);
 }
 
+auto FromFixMapper::map(const FIX::Message& fix_message,
+                        protocol::OrderMassCancellationRequest& request)
+    -> void {
+  map_fix_field<FIX::MsgSeqNum>(fix_message.getHeader(), request.seq_num);
+  map_parties(fix_message, request.parties);
+
+  // Orders of all instruments are cancelled unless an instrument is given
+  if (contains<FIX::FIELD::Symbol>(fix_message) ||
+      contains<FIX::FIELD::SecurityID>(fix_message)) {
+    request.instrument = decode_instrument(fix_message, request.parties);
+  }
+
+  map_fix_field<FIX::ClOrdID>(fix_message, request.client_order_id);
+  map_fix_field<FIX::Side>(fix_message, request.side);
+}
+
+auto FromFixMapper::map(const FIX::Message& fix_message,
+                        protocol::MassQuoteRequest& request) -> void {
+  map_fix_field<FIX::MsgSeqNum>(fix_message.getHeader(), request.seq_num);
+  map_parties(fix_message, request.parties);
+  map_fix_field<FIX::QuoteID>(fix_message, request.client_order_id);
+
+  // Entries carry an instrument each, the request quotes a single one,
+  // so that the instrument of the first entry is used.
+  bool instrument_mapped = false;
+  const auto sets_num = get_fix_field<FIX::NoQuoteSets>(fix_message);
+  for (int set = 1; set <= sets_num; ++set) {
+    const auto& quote_set =
+        fix_message.getGroupRef(set, FIX::FIELD::NoQuoteSets);
+    if (!contains<FIX::FIELD::NoQuoteEntries>(quote_set)) {
+      continue;
+    }
+
+    const auto entries_num = get_fix_field<FIX::NoQuoteEntries>(quote_set);
+    for (int entry = 1; entry <= entries_num; ++entry) {
+      const auto& quote_entry =
+          quote_set.getGroupRef(entry, FIX::FIELD::NoQuoteEntries);
+      if (!instrument_mapped) {
+        map_instrument(quote_entry, request.parties, request.instrument);
+        instrument_mapped = true;
+      }
+      map_quote_entry(quote_entry, request.entries);
+    }
+  }
+}
+
 auto FromFixMapper::map(const FIX::Message& fix_message,
                         protocol::MarketDataRequest& request) -> void {
   map_parties(fix_message, request.parties);
@@ -135,6 +135,29 @@ auto ToFixMapper::map(const protocol::OrderCancellationReject& reply,
       FIX::CxlRejResponseTo_ORDER_CANCEL_REQUEST, fix_message);
 }
 
+auto ToFixMapper::map(const protocol::OrderMassCancellationReport& reply,
+                      FIX::Message& fix_message,
+                      [[maybe_unused]] const MappingSettings::Setting& setting)
+    -> void {
+  // The report is sent for accepted requests only,
+  // the response echoes the scope of the request.
+  const char request_type =
+      reply.instrument.has_value()
+          ? FIX::MassCancelRequestType_CANCEL_ORDERS_FOR_A_SECURITY
+          : FIX::MassCancelRequestType_CANCEL_ALL_ORDERS;
+  set_fix_field<FIX::MassCancelRequestType>(request_type, fix_message);
+  set_fix_field<FIX::MassCancelResponse>(request_type, fix_message);
+
+  if (const auto& instrument = reply.instrument) {
+    map_instrument(*instrument, fix_message);
+  }
+  map_fix_field<FIX::ClOrdID>(reply.client_order_id, fix_message);
+  map_fix_field<FIX::MassActionReportID>(reply.venue_order_id, fix_message);
+  map_fix_field<FIX::Side>(reply.side, fix_message);
+  map_fix_field<FIX::TotalAffectedOrders>(reply.total_affected_orders,
+                                          fix_message);
+}
+
 auto ToFixMapper::map(const protocol::MarketDataReject& reply,
                       FIX::Message& fix_message,
                       [[maybe_unused]] const MappingSettings::Setting& setting)
@@ -161,6 +184,7 @@ auto ToFixMapper::map(const protocol::MarketDataSnapshot& reply,
     auto group = std::make_unique<
         FIX50SP2::MarketDataSnapshotFullRefresh::NoMDEntries>();
     map_market_entry(entry, *group, setting);
+    map_fix_field<FIX::RptSeq>(reply.update_sequence, *group);
     fix_message.addGroupPtr(FIX::FIELD::NoMDEntries, group.release());
   }
 }
@@ -178,6 +202,7 @@ auto ToFixMapper::map(const protocol::MarketDataUpdate& reply,
         std::make_unique<FIX50SP2::MarketDataIncrementalRefresh::NoMDEntries>();
     map_market_entry(entry, *group, setting);
     map_fix_field<FIX::MDUpdateAction>(entry.action, *group);
+    map_fix_field<FIX::RptSeq>(reply.update_sequence, *group);
     fix_message.addGroupPtr(FIX::FIELD::NoMDEntries, group.release());
   }
 }
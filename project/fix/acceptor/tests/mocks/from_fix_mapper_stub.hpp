@@ -4,7 +4,9 @@
 #include <quickfix/Message.h>
 
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -24,6 +26,15 @@ struct FromFixMapperStub {
            [[maybe_unused]] protocol::OrderCancellationRequest& request) const
       -> void {}
 
+  auto map(
+      [[maybe_unused]] const FIX::Message& message,
+      [[maybe_unused]] protocol::OrderMassCancellationRequest& request) const
+      -> void {}
+
+  auto map([[maybe_unused]] const FIX::Message& message,
+           [[maybe_unused]] protocol::MassQuoteRequest& request) const
+      -> void {}
+
   auto map([[maybe_unused]] const FIX::Message& message,
            [[maybe_unused]] protocol::MarketDataRequest& request) const
       -> void {}
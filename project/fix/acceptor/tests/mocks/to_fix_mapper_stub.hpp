@@ -10,6 +10,7 @@
 #include "protocol/app/market_data_update.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -59,6 +60,11 @@ struct ToFixMapperStub {
            [[maybe_unused]] const MappingSettings::Setting& setting) const
       -> void {}
 
+  auto map([[maybe_unused]] const protocol::OrderMassCancellationReport& reply,
+           [[maybe_unused]] FIX::Message& message,
+           [[maybe_unused]] const MappingSettings::Setting& setting) const
+      -> void {}
+
   auto map([[maybe_unused]] const protocol::MarketDataReject& reply,
            [[maybe_unused]] FIX::Message& message,
            [[maybe_unused]] const MappingSettings::Setting& setting) const
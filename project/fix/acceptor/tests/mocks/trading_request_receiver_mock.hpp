@@ -12,6 +12,8 @@ struct TradingRequestReceiverMock : public middleware::TradingRequestReceiver {
   MOCK_METHOD(void, process, (protocol::OrderPlacementRequest));
   MOCK_METHOD(void, process, (protocol::OrderModificationRequest));
   MOCK_METHOD(void, process, (protocol::OrderCancellationRequest));
+  MOCK_METHOD(void, process, (protocol::OrderMassCancellationRequest));
+  MOCK_METHOD(void, process, (protocol::MassQuoteRequest));
   MOCK_METHOD(void, process, (protocol::MarketDataRequest));
   MOCK_METHOD(void, process, (protocol::SecurityStatusRequest));
   MOCK_METHOD(void, process, (const protocol::InstrumentStateRequest&, protocol::InstrumentState&));
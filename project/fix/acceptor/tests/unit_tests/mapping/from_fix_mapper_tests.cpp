@@ -3,9 +3,11 @@
 #include <quickfix/FieldTypes.h>
 #include <quickfix/Fields.h>
 #include <quickfix/fix50sp2/MarketDataRequest.h>
+#include <quickfix/fix50sp2/MassQuote.h>
 #include <quickfix/fix50sp2/NewOrderSingle.h>
 #include <quickfix/fix50sp2/OrderCancelReplaceRequest.h>
 #include <quickfix/fix50sp2/OrderCancelRequest.h>
+#include <quickfix/fix50sp2/OrderMassCancelRequest.h>
 
 #include <chrono>
 
@@ -224,6 +226,23 @@ TEST_F(AcceptorFromFixNewOrderSingleMapping, MapsOrderPrice) {
   ASSERT_THAT(internal_message.order_price, Optional(Eq(OrderPrice{120.0})));
 }
 
+TEST_F(AcceptorFromFixNewOrderSingleMapping, MapsStopPrice) {
+  set_field(FIX::StopPx{119.5});
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.stop_price, Optional(Eq(StopPrice{119.5})));
+}
+
+TEST_F(AcceptorFromFixNewOrderSingleMapping, MapsDisplayQuantity) {
+  set_field(FIX::MaxFloor{100});
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.display_quantity,
+              Optional(Eq(DisplayQuantity{100})));
+}
+
 TEST_F(AcceptorFromFixNewOrderSingleMapping, MapsExpireTime) {
   // 2024-09-01 12:01:02.138567
   set_field(
@@ -405,6 +424,150 @@ TEST_F(AcceptorFromFixOrderCancelRequestMapping, MapsSide) {
   ASSERT_THAT(internal_message.side, Optional(Eq(Side::Option::Buy)));
 }
 
+struct AcceptorFromFixOrderMassCancelRequestMapping
+    : public FromFixMapperFixture<FIX50SP2::OrderMassCancelRequest,
+                                  protocol::OrderMassCancellationRequest> {};
+
+TEST_F(AcceptorFromFixOrderMassCancelRequestMapping, MapsClientOrderId) {
+  set_field(FIX::ClOrdID{"client_order_id_"});
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.client_order_id,
+              Optional(Eq(ClientOrderId{"client_order_id_"})));
+}
+
+TEST_F(AcceptorFromFixOrderMassCancelRequestMapping, MapsSide) {
+  set_field(FIX::Side{FIX::Side_SELL});
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.side, Optional(Eq(Side::Option::Sell)));
+}
+
+TEST_F(AcceptorFromFixOrderMassCancelRequestMapping,
+       DoesNotMapInstrumentWhenNotSpecified) {
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.instrument, Eq(std::nullopt));
+}
+
+TEST_F(AcceptorFromFixOrderMassCancelRequestMapping, MapsInstrument) {
+  set_field(FIX::Symbol{"AAPL"});
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.instrument,
+              Optional(Field(&InstrumentDescriptor::symbol,
+                             Optional(Eq(Symbol{"AAPL"})))));
+}
+
+TEST_F(AcceptorFromFixOrderMassCancelRequestMapping, MapsRequestParties) {
+  fix_message.addGroup([] {
+    FIX50SP2::NewOrderSingle::NoPartyIDs party;
+    set_field(FIX::PartyID{"P1"}, party);
+    set_field(FIX::PartyRole{FIX::PartyRole_CLIENT_ID}, party);
+    set_field(FIX::PartyIDSource{FIX::PartyIDSource_PROPRIETARY_CUSTOM_CODE},
+              party);
+    return party;
+  }());
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.parties, SizeIs(1));
+}
+
+struct AcceptorFromFixMassQuoteMapping
+    : public FromFixMapperFixture<FIX50SP2::MassQuote,
+                                  protocol::MassQuoteRequest> {
+  using QuoteSet = FIX50SP2::MassQuote::NoQuoteSets;
+  using QuoteEntry = FIX50SP2::MassQuote::NoQuoteSets::NoQuoteEntries;
+
+ private:
+  auto SetUp() -> void override { fix_message.set(FIX::NoQuoteSets(0)); }
+};
+
+TEST_F(AcceptorFromFixMassQuoteMapping, MapsQuoteIdAsClientOrderId) {
+  set_field(FIX::QuoteID{"quote_id_"});
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.client_order_id,
+              Optional(Eq(ClientOrderId{"quote_id_"})));
+}
+
+TEST_F(AcceptorFromFixMassQuoteMapping, MapsInstrumentOfFirstQuoteEntry) {
+  QuoteSet quote_set;
+  quote_set.addGroup([] {
+    QuoteEntry entry;
+    set_field(FIX::Symbol{"AAPL"}, entry);
+    return entry;
+  }());
+  quote_set.addGroup([] {
+    QuoteEntry entry;
+    set_field(FIX::Symbol{"GOOGL"}, entry);
+    return entry;
+  }());
+  fix_message.addGroup(quote_set);
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.instrument.symbol, Optional(Eq(Symbol{"AAPL"})));
+}
+
+TEST_F(AcceptorFromFixMassQuoteMapping, MapsBidAndOfferOfQuoteEntry) {
+  QuoteSet quote_set;
+  quote_set.addGroup([] {
+    QuoteEntry entry;
+    set_field(FIX::QuoteEntryID{"entry_"}, entry);
+    set_field(FIX::BidPx{42.0}, entry);
+    set_field(FIX::BidSize{100}, entry);
+    set_field(FIX::OfferPx{43.0}, entry);
+    set_field(FIX::OfferSize{200}, entry);
+    return entry;
+  }());
+  fix_message.addGroup(quote_set);
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(
+      internal_message.entries,
+      ElementsAre(
+          AllOf(Field(&protocol::QuoteEntry::client_order_id,
+                      Optional(Eq(ClientOrderId{"entry_"}))),
+                Field(&protocol::QuoteEntry::side,
+                      Optional(Eq(Side::Option::Buy))),
+                Field(&protocol::QuoteEntry::order_price,
+                      Optional(Eq(OrderPrice{42.0}))),
+                Field(&protocol::QuoteEntry::order_quantity,
+                      Optional(Eq(OrderQuantity{100})))),
+          AllOf(Field(&protocol::QuoteEntry::client_order_id,
+                      Optional(Eq(ClientOrderId{"entry_"}))),
+                Field(&protocol::QuoteEntry::side,
+                      Optional(Eq(Side::Option::Sell))),
+                Field(&protocol::QuoteEntry::order_price,
+                      Optional(Eq(OrderPrice{43.0}))),
+                Field(&protocol::QuoteEntry::order_quantity,
+                      Optional(Eq(OrderQuantity{200}))))));
+}
+
+TEST_F(AcceptorFromFixMassQuoteMapping, MapsOneSidedQuoteEntry) {
+  QuoteSet quote_set;
+  quote_set.addGroup([] {
+    QuoteEntry entry;
+    set_field(FIX::OfferPx{43.0}, entry);
+    set_field(FIX::OfferSize{200}, entry);
+    return entry;
+  }());
+  fix_message.addGroup(quote_set);
+
+  FromFixMapper::map(fix_message, internal_message);
+
+  ASSERT_THAT(internal_message.entries,
+              ElementsAre(Field(&protocol::QuoteEntry::side,
+                                Optional(Eq(Side::Option::Sell)))));
+}
+
 struct AcceptorFromFixMarketDataRequestMapping
     : public FromFixMapperFixture<FIX50SP2::MarketDataRequest,
                                   protocol::MarketDataRequest> {
@@ -13,6 +13,7 @@
 #include "protocol/app/execution_report.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -1121,6 +1122,77 @@ TEST_F(AcceptorToFixOrderCancellationRejectMapping, MapsOrderStatus) {
 
 // region MarketDataReject mapping
 
+struct AcceptorToFixOrderMassCancellationReportMapping
+    : public AcceptorToFixMapping {
+  protocol::OrderMassCancellationReport reply =
+      make_internal_message<protocol::OrderMassCancellationReport>();
+};
+
+TEST_F(AcceptorToFixOrderMassCancellationReportMapping,
+       ReportsAllOrdersCancelledWhenNoInstrumentSpecified) {
+  ToFixMapper::map(reply, fix_message, {});
+
+  EXPECT_THAT(get_fix_field<FIX::MassCancelRequestType>(fix_message),
+              Optional(Eq(FIX::MassCancelRequestType_CANCEL_ALL_ORDERS)));
+  EXPECT_THAT(get_fix_field<FIX::MassCancelResponse>(fix_message),
+              Optional(Eq(FIX::MassCancelResponse_CANCEL_ALL_ORDERS)));
+  EXPECT_THAT(get_fix_field<FIX::Symbol>(fix_message), Eq(std::nullopt));
+}
+
+TEST_F(AcceptorToFixOrderMassCancellationReportMapping,
+       ReportsInstrumentOrdersCancelled) {
+  reply.instrument = InstrumentDescriptor{};
+  reply.instrument->symbol = Symbol{"AAPL"};
+
+  ToFixMapper::map(reply, fix_message, {});
+
+  EXPECT_THAT(
+      get_fix_field<FIX::MassCancelRequestType>(fix_message),
+      Optional(Eq(FIX::MassCancelRequestType_CANCEL_ORDERS_FOR_A_SECURITY)));
+  EXPECT_THAT(
+      get_fix_field<FIX::MassCancelResponse>(fix_message),
+      Optional(Eq(FIX::MassCancelResponse_CANCEL_ORDERS_FOR_A_SECURITY)));
+  EXPECT_THAT(get_fix_field<FIX::Symbol>(fix_message), Optional(Eq("AAPL")));
+}
+
+TEST_F(AcceptorToFixOrderMassCancellationReportMapping, MapsClientOrderId) {
+  reply.client_order_id = ClientOrderId{"ClientOrderId"};
+
+  ToFixMapper::map(reply, fix_message, {});
+
+  ASSERT_THAT(get_fix_field<FIX::ClOrdID>(fix_message),
+              Optional(Eq("ClientOrderId")));
+}
+
+TEST_F(AcceptorToFixOrderMassCancellationReportMapping,
+       MapsVenueOrderIdAsMassActionReportId) {
+  reply.venue_order_id = VenueOrderId{"VenueOrderId"};
+
+  ToFixMapper::map(reply, fix_message, {});
+
+  ASSERT_THAT(get_fix_field<FIX::MassActionReportID>(fix_message),
+              Optional(Eq("VenueOrderId")));
+}
+
+TEST_F(AcceptorToFixOrderMassCancellationReportMapping, MapsSide) {
+  reply.side = Side::Option::Sell;
+
+  ToFixMapper::map(reply, fix_message, {});
+
+  ASSERT_THAT(get_fix_field<FIX::Side>(fix_message),
+              Optional(Eq(FIX::Side_SELL)));
+}
+
+TEST_F(AcceptorToFixOrderMassCancellationReportMapping,
+       MapsTotalAffectedOrders) {
+  reply.total_affected_orders = TotalAffectedOrders{42};
+
+  ToFixMapper::map(reply, fix_message, {});
+
+  ASSERT_THAT(get_fix_field<FIX::TotalAffectedOrders>(fix_message),
+              Optional(Eq(42)));
+}
+
 struct AcceptorToFixMarketDataRejectMapping : public AcceptorToFixMapping {
   protocol::MarketDataReject reply =
       make_internal_message<protocol::MarketDataReject>();
@@ -1258,6 +1330,22 @@ TEST_F(AcceptorToFixMarketDataSnapshotMapping,
               Optional(Eq(FIX::TradingSessionID_DAY)));
 }
 
+TEST_F(AcceptorToFixMarketDataSnapshotMapping,
+       MapsUpdateSequenceToEachMarketDataEntry) {
+  reply.update_sequence = SeqNum{42};
+  reply.market_data_entries.resize(2);
+
+  ToFixMapper::map(reply, fix_message, {});
+  ASSERT_THAT(get_fix_field<FIX::NoMDEntries>(fix_message), Optional(Eq(2)));
+
+  EXPECT_THAT(get_fix_field<FIX::RptSeq>(
+                  fix_message.getGroupRef(1, FIX::FIELD::NoMDEntries)),
+              Optional(Eq(42)));
+  EXPECT_THAT(get_fix_field<FIX::RptSeq>(
+                  fix_message.getGroupRef(2, FIX::FIELD::NoMDEntries)),
+              Optional(Eq(42)));
+}
+
 // endregion MarketDataSnapshot mapping
 
 // region MarketDataUpdate mapping
@@ -1362,6 +1450,34 @@ TEST_F(AcceptorToFixMarketDataUpdateMapping,
               Optional(Eq(FIX::TradingSessionID_DAY)));
 }
 
+TEST_F(AcceptorToFixMarketDataUpdateMapping,
+       MapsUpdateSequenceToEachMarketDataEntry) {
+  reply.update_sequence = SeqNum{42};
+  reply.market_data_entries.resize(2);
+
+  ToFixMapper::map(reply, fix_message, {});
+  ASSERT_THAT(get_fix_field<FIX::NoMDEntries>(fix_message), Optional(Eq(2)));
+
+  EXPECT_THAT(get_fix_field<FIX::RptSeq>(
+                  fix_message.getGroupRef(1, FIX::FIELD::NoMDEntries)),
+              Optional(Eq(42)));
+  EXPECT_THAT(get_fix_field<FIX::RptSeq>(
+                  fix_message.getGroupRef(2, FIX::FIELD::NoMDEntries)),
+              Optional(Eq(42)));
+}
+
+TEST_F(AcceptorToFixMarketDataUpdateMapping,
+       DoesNotMapUpdateSequenceWhenAbsent) {
+  reply.market_data_entries.resize(1);
+
+  ToFixMapper::map(reply, fix_message, {});
+  ASSERT_THAT(get_fix_field<FIX::NoMDEntries>(fix_message), Optional(Eq(1)));
+
+  EXPECT_THAT(fix_message.getGroupRef(1, FIX::FIELD::NoMDEntries)
+                  .isSetField(FIX::FIELD::RptSeq),
+              IsFalse());
+}
+
 // endregion MarketDataUpdate mapping
 
 // NOLINTEND(*-magic-numbers,*-array-to-pointer-decay)
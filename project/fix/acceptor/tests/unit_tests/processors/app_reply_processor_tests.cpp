@@ -11,6 +11,7 @@
 #include "protocol/app/market_data_reject.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -113,6 +114,17 @@ TEST_F(AcceptorAppReplySender,
   processor.process_reply(reply);
 }
 
+TEST_F(AcceptorAppReplySender,
+       SendsOrderMassCancellationReportAsOrderMassCancelReport) {
+  const auto reply = make_message<protocol::OrderMassCancellationReport>();
+
+  EXPECT_CALL(
+      reply_sender,
+      send_reply_message(MsgTypeIs(FIX::MsgType_OrderMassCancelReport), _));
+
+  processor.process_reply(reply);
+}
+
 TEST_F(AcceptorAppReplySender, SendsMarketDataRejectAsMarketDataRequestReject) {
   const auto reply = make_message<protocol::MarketDataReject>();
 
@@ -67,6 +67,24 @@ TEST_F(AcceptorAppRequestProcessor, DispatchesOrderCancelRequest) {
   ASSERT_NO_THROW(processor.process_fix_request(fix_message, fix_session));
 }
 
+TEST_F(AcceptorAppRequestProcessor, DispatchesOrderMassCancelRequest) {
+  const auto fix_message =
+      make_fix_message(FIX::MsgType_OrderMassCancelRequest);
+
+  EXPECT_CALL(request_receiver,
+              process(A<protocol::OrderMassCancellationRequest>()));
+
+  ASSERT_NO_THROW(processor.process_fix_request(fix_message, fix_session));
+}
+
+TEST_F(AcceptorAppRequestProcessor, DispatchesMassQuote) {
+  const auto fix_message = make_fix_message(FIX::MsgType_MassQuote);
+
+  EXPECT_CALL(request_receiver, process(A<protocol::MassQuoteRequest>()));
+
+  ASSERT_NO_THROW(processor.process_fix_request(fix_message, fix_session));
+}
+
 TEST_F(AcceptorAppRequestProcessor, DispatchersMarketDataRequest) {
   const auto fix_message = make_fix_message(FIX::MsgType_MarketDataRequest);
 
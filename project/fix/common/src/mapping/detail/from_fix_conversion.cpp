@@ -25,7 +25,9 @@ auto make_order_type_mapping_association()
   // clang-format off
   return {
     {FIX::OrdType_LIMIT, OrderType::Option::Limit},
-    {FIX::OrdType_MARKET, OrderType::Option::Market}};
+    {FIX::OrdType_MARKET, OrderType::Option::Market},
+    {FIX::OrdType_STOP, OrderType::Option::Stop},
+    {FIX::OrdType_STOP_LIMIT, OrderType::Option::StopLimit}};
   // clang-format on
 }
 
@@ -41,7 +41,9 @@ auto make_order_type_association()
   // clang-format off
   return {
     {OrderType::Limit, FIX::OrdType_LIMIT},
-    {OrderType::Market, FIX::OrdType_MARKET}};
+    {OrderType::Market, FIX::OrdType_MARKET},
+    {OrderType::Stop, FIX::OrdType_STOP},
+    {OrderType::StopLimit, FIX::OrdType_STOP_LIMIT}};
   // clang-format on
 }
 
@@ -341,7 +343,9 @@ auto make_rejected_message_type_association()
 
   // clang-format off
   return {
-    {RejectedMessageType::SecurityStatusRequest, FIX::MsgType_SecurityStatusRequest}};
+    {RejectedMessageType::SecurityStatusRequest, FIX::MsgType_SecurityStatusRequest},
+    {RejectedMessageType::OrderMassCancelRequest, FIX::MsgType_OrderMassCancelRequest},
+    {RejectedMessageType::MassQuote, FIX::MsgType_MassQuote}};
   // clang-format on
 }
 
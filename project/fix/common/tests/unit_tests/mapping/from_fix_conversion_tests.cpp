@@ -140,7 +140,9 @@ TEST_F(FromFixOrderTypeConversion, ReportsUnknownFixValue) {
 INSTANTIATE_TEST_SUITE_P(FixValues, FromFixOrderTypeConversion,
   Values(
     std::make_tuple(FIX::OrdType_MARKET, OrderType::Option::Market),
-    std::make_tuple(FIX::OrdType_LIMIT, OrderType::Option::Limit)
+    std::make_tuple(FIX::OrdType_LIMIT, OrderType::Option::Limit),
+    std::make_tuple(FIX::OrdType_STOP, OrderType::Option::Stop),
+    std::make_tuple(FIX::OrdType_STOP_LIMIT, OrderType::Option::StopLimit)
   ));
 // clang-format on
 
@@ -219,7 +219,9 @@ TEST_F(ToFixOrderTypeConversion, ReportsErrorOnUnknownValueConversion) {
 INSTANTIATE_TEST_SUITE_P(InternalEnum, ToFixOrderTypeConversion,
   Values(
     std::make_tuple(OrderType::Option::Market, FIX::OrdType_MARKET),
-    std::make_tuple(OrderType::Option::Limit, FIX::OrdType_LIMIT)
+    std::make_tuple(OrderType::Option::Limit, FIX::OrdType_LIMIT),
+    std::make_tuple(OrderType::Option::Stop, FIX::OrdType_STOP),
+    std::make_tuple(OrderType::Option::StopLimit, FIX::OrdType_STOP_LIMIT)
   )
 );
 // clang-format on
@@ -699,7 +701,9 @@ TEST_F(ToFixRejectedMessageTypeConversion,
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(InternalEnum, ToFixRejectedMessageTypeConversion,
   Values(
-    std::make_tuple(RejectedMessageType::Option::SecurityStatusRequest, FIX::MsgType_SecurityStatusRequest)
+    std::make_tuple(RejectedMessageType::Option::SecurityStatusRequest, FIX::MsgType_SecurityStatusRequest),
+    std::make_tuple(RejectedMessageType::Option::OrderMassCancelRequest, FIX::MsgType_OrderMassCancelRequest),
+    std::make_tuple(RejectedMessageType::Option::MassQuote, FIX::MsgType_MassQuote)
   ));
 // clang-format on
 
@@ -12,6 +12,8 @@ enum class MessageType : std::uint8_t {
   NewOrderSingle,
   OrderCancelReplaceRequest,
   OrderCancelRequest,
+  OrderMassCancelRequest,
+  MassQuote,
   ExecutionReport
 };
 
@@ -5,8 +5,10 @@
 #include "data_layer/api/models/listing.hpp"
 #include "ih/adaptation/generated_message.hpp"
 #include "protocol/app/execution_report.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -30,6 +32,14 @@ namespace simulator::generator {
     const GeneratedMessage& message, const InstrumentDescriptor& instrument)
     -> protocol::OrderCancellationRequest;
 
+[[nodiscard]] auto convert_to_order_mass_cancellation_request(
+    const GeneratedMessage& message, const InstrumentDescriptor& instrument)
+    -> protocol::OrderMassCancellationRequest;
+
+[[nodiscard]] auto convert_to_mass_quote_request(
+    const GeneratedMessage& message, const InstrumentDescriptor& instrument)
+    -> protocol::MassQuoteRequest;
+
 [[nodiscard]]
 auto convert_to_generated_message(
     const protocol::OrderPlacementConfirmation& confirmation)
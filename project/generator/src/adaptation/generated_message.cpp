@@ -34,6 +34,12 @@ auto fmt::formatter<simulator::generator::MessageType>::format(
     case MessageType::OrderCancelRequest:
       value = "OrderCancelRequest";
       break;
+    case MessageType::OrderMassCancelRequest:
+      value = "OrderMassCancelRequest";
+      break;
+    case MessageType::MassQuote:
+      value = "MassQuote";
+      break;
     case MessageType::ExecutionReport:
       value = "ExecutionReport";
       break;
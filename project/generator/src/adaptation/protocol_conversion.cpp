@@ -225,6 +225,46 @@ auto convert_to_order_cancellation_request(
   return request;
 }
 
+auto convert_to_order_mass_cancellation_request(
+    const GeneratedMessage& message, const InstrumentDescriptor& instrument)
+    -> protocol::OrderMassCancellationRequest {
+  protocol::OrderMassCancellationRequest request{
+      protocol::Session{protocol::generator::Session{}}};
+
+  request.side = message.side;
+  request.client_order_id = message.client_order_id;
+  if (const auto& party = message.party) {
+    request.parties.push_back(*party);
+  }
+  request.instrument = instrument;
+
+  return request;
+}
+
+auto convert_to_mass_quote_request(const GeneratedMessage& message,
+                                   const InstrumentDescriptor& instrument)
+    -> protocol::MassQuoteRequest {
+  protocol::MassQuoteRequest request{
+      protocol::Session{protocol::generator::Session{}}};
+
+  // A generated message carries a single price level,
+  // which is quoted as the only entry of the ladder.
+  protocol::QuoteEntry entry;
+  entry.client_order_id = message.client_order_id;
+  entry.order_price = message.order_price;
+  entry.order_quantity = convert_order_quantity(message.quantity);
+  entry.side = message.side;
+
+  request.client_order_id = message.client_order_id;
+  if (const auto& party = message.party) {
+    request.parties.push_back(*party);
+  }
+  request.entries.push_back(std::move(entry));
+  request.instrument = instrument;
+
+  return request;
+}
+
 auto convert_to_generated_message(
     const protocol::OrderPlacementConfirmation& confirmation)
     -> GeneratedMessage {
@@ -28,6 +28,12 @@ auto send_message(const GeneratedMessage& message,
     } else if (message.message_type == MessageType::OrderCancelRequest) {
       middleware::send_trading_request(
           convert_to_order_cancellation_request(message, instrument));
+    } else if (message.message_type == MessageType::OrderMassCancelRequest) {
+      middleware::send_trading_request(
+          convert_to_order_mass_cancellation_request(message, instrument));
+    } else if (message.message_type == MessageType::MassQuote) {
+      middleware::send_trading_request(
+          convert_to_mass_quote_request(message, instrument));
     }
   } catch (const middleware::ChannelUnboundError&) {
     log::err(
@@ -6,6 +6,7 @@
 #include <thread>
 #include <utility>
 
+#include "cfg/api/venue_scope.hpp"
 #include "ih/context/component_context.hpp"
 #include "ih/utils/executable.hpp"
 #include "log/logging.hpp"
@@ -69,7 +70,8 @@ auto Executor::is_executing() const noexcept -> bool {
 
 auto Executor::start() -> void {
   reset_executing_thread();
-  executing_thread_ = std::make_unique<std::thread>([this] { execute(); });
+  executing_thread_ = std::make_unique<std::thread>(
+      cfg::bind_venue_scope([this] { execute(); }));
 }
 
 auto Executor::reset_executing_thread() noexcept -> void {
@@ -13,6 +13,8 @@ struct TradingRequestReceiver
   MOCK_METHOD(void, process, (simulator::protocol::OrderPlacementRequest));
   MOCK_METHOD(void, process, (simulator::protocol::OrderModificationRequest));
   MOCK_METHOD(void, process, (simulator::protocol::OrderCancellationRequest));
+  MOCK_METHOD(void, process, (simulator::protocol::OrderMassCancellationRequest));
+  MOCK_METHOD(void, process, (simulator::protocol::MassQuoteRequest));
   MOCK_METHOD(void, process, (simulator::protocol::MarketDataRequest));
   MOCK_METHOD(void, process, (simulator::protocol::SecurityStatusRequest));
   MOCK_METHOD(void, process, (const simulator::protocol::InstrumentStateRequest&, simulator::protocol::InstrumentState&));
@@ -241,6 +241,115 @@ TEST_F(GeneratorOrderCancellationRequestConversion, ConvertsOrigClientOrderId) {
               Optional(Eq(OrigClientOrderId{"GeneratorOrdID"})));
 }
 
+struct GeneratorOrderMassCancellationRequestConversion : Test {
+  GeneratedMessage message;
+  InstrumentDescriptor instrument;
+};
+
+TEST_F(GeneratorOrderMassCancellationRequestConversion,
+       ConvertsGeneratorSession) {
+  const auto request =
+      convert_to_order_mass_cancellation_request(message, instrument);
+
+  ASSERT_THAT(request.session.value,
+              VariantWith<protocol::generator::Session>(_));
+}
+
+TEST_F(GeneratorOrderMassCancellationRequestConversion, ConvertsSide) {
+  message.side = Side::Option::Sell;
+
+  const auto request =
+      convert_to_order_mass_cancellation_request(message, instrument);
+
+  ASSERT_THAT(request.side, Optional(Eq(Side::Option::Sell)));
+}
+
+TEST_F(GeneratorOrderMassCancellationRequestConversion, ConvertsClientOrderId) {
+  message.client_order_id = ClientOrderId{"GeneratorOrdID"};
+
+  const auto request =
+      convert_to_order_mass_cancellation_request(message, instrument);
+
+  ASSERT_THAT(request.client_order_id,
+              Optional(Eq(ClientOrderId{"GeneratorOrdID"})));
+}
+
+TEST_F(GeneratorOrderMassCancellationRequestConversion, ConvertsParties) {
+  message.party = generated_party(PartyId{"CP1"});
+
+  const auto request =
+      convert_to_order_mass_cancellation_request(message, instrument);
+
+  ASSERT_THAT(
+      request.parties,
+      ElementsAre(AllOf(
+          Property(&Party::party_id, Eq(PartyId{"CP1"})),
+          Property(&Party::source, Eq(PartyIdSource::Option::Proprietary)),
+          Property(&Party::role, Eq(PartyRole::Option::ExecutingFirm)))));
+}
+
+TEST_F(GeneratorOrderMassCancellationRequestConversion, ConvertsInstrument) {
+  instrument.symbol = Symbol{"AAPL"};
+
+  const auto request =
+      convert_to_order_mass_cancellation_request(message, instrument);
+
+  ASSERT_THAT(request.instrument,
+              Optional(Field(&InstrumentDescriptor::symbol,
+                             Optional(Eq(Symbol{"AAPL"})))));
+}
+
+struct GeneratorMassQuoteRequestConversion : Test {
+  GeneratedMessage message;
+  InstrumentDescriptor instrument;
+};
+
+TEST_F(GeneratorMassQuoteRequestConversion, ConvertsGeneratorSession) {
+  const auto request = convert_to_mass_quote_request(message, instrument);
+
+  ASSERT_THAT(request.session.value,
+              VariantWith<protocol::generator::Session>(_));
+}
+
+TEST_F(GeneratorMassQuoteRequestConversion, ConvertsClientOrderId) {
+  message.client_order_id = ClientOrderId{"GeneratorOrdID"};
+
+  const auto request = convert_to_mass_quote_request(message, instrument);
+
+  ASSERT_THAT(request.client_order_id,
+              Optional(Eq(ClientOrderId{"GeneratorOrdID"})));
+}
+
+TEST_F(GeneratorMassQuoteRequestConversion, ConvertsSingleQuoteEntry) {
+  message.client_order_id = ClientOrderId{"GeneratorOrdID"};
+  message.order_price = OrderPrice{42.42};
+  message.quantity = Quantity{10};
+  message.side = Side::Option::Buy;
+
+  const auto request = convert_to_mass_quote_request(message, instrument);
+
+  ASSERT_THAT(request.entries, SizeIs(1));
+  const auto& entry = request.entries.front();
+  EXPECT_THAT(entry.client_order_id,
+              Optional(Eq(ClientOrderId{"GeneratorOrdID"})));
+  EXPECT_THAT(entry.order_price, Optional(Eq(OrderPrice{42.42})));
+  EXPECT_THAT(entry.order_quantity, Optional(Eq(OrderQuantity{10})));
+  EXPECT_THAT(entry.side, Optional(Eq(Side::Option::Buy)));
+}
+
+TEST_F(GeneratorMassQuoteRequestConversion, ConvertsParties) {
+  message.party = generated_party(PartyId{"CP1"});
+
+  const auto request = convert_to_mass_quote_request(message, instrument);
+
+  ASSERT_THAT(
+      request.parties,
+      ElementsAre(AllOf(
+          Property(&Party::party_id, Eq(PartyId{"CP1"})),
+          Property(&Party::source, Eq(PartyIdSource::Option::Proprietary)),
+          Property(&Party::role, Eq(PartyRole::Option::ExecutingFirm)))));
+}
+
 // NOLINTEND(*magic-numbers*)
 
 }  // namespace
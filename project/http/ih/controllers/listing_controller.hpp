@@ -7,6 +7,7 @@
 #include <functional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "ih/data_bridge/listing_accessor.hpp"
 
@@ -28,11 +29,26 @@ class ListingController {
   [[nodiscard]]
   auto insert_listing(const std::string& body) const -> Result;
 
+  // Inserts a JSON array of listings in a single transaction
+  [[nodiscard]]
+  auto insert_listings(const std::string& body) const -> Result;
+
+  // Inserts or updates a JSON array of listings in a single transaction
+  [[nodiscard]]
+  auto upsert_listings(const std::string& body) const -> Result;
+
   [[nodiscard]]
   auto update_listing(const std::string& key, const std::string& body) const
       -> Result;
 
  private:
+  using StoredListings =
+      tl::expected<std::vector<data_layer::Listing>, data_bridge::Failure>;
+
+  // Formats a response with listings stored by a bulk request
+  static auto make_bulk_result(const StoredListings& result,
+                               Pistache::Http::Code success_code) -> Result;
+
   static auto format_error_response(data_bridge::Failure failure) -> std::string;
 
   std::reference_wrapper<const data_bridge::ListingAccessor> data_accessor_;
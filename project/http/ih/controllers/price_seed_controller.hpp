@@ -7,6 +7,7 @@
 #include <functional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "ih/data_bridge/price_seed_accessor.hpp"
 #include "ih/data_bridge/setting_accessor.hpp"
@@ -30,6 +31,14 @@ class PriceSeedController {
   [[nodiscard]]
   auto insert_price_seed(const std::string& body) const -> Result;
 
+  // Inserts a JSON array of price seeds in a single transaction
+  [[nodiscard]]
+  auto insert_price_seeds(const std::string& body) const -> Result;
+
+  // Inserts or updates a JSON array of price seeds in a single transaction
+  [[nodiscard]]
+  auto upsert_price_seeds(const std::string& body) const -> Result;
+
   [[nodiscard]]
   auto update_price_seed(std::uint64_t seed_id, const std::string& body) const
       -> Result;
@@ -41,6 +50,13 @@ class PriceSeedController {
   auto sync_price_seeds() const -> Result;
 
  private:
+  using StoredPriceSeeds =
+      tl::expected<std::vector<data_layer::PriceSeed>, data_bridge::Failure>;
+
+  // Formats a response with price seeds stored by a bulk request
+  static auto make_bulk_result(const StoredPriceSeeds& result,
+                               Pistache::Http::Code success_code) -> Result;
+
   static auto format_error_response(data_bridge::Failure failure)
       -> std::string;
 
@@ -23,6 +23,12 @@ class TradingController {
 
   [[nodiscard]]
   auto recover_market_state() const -> Result;
+
+  [[nodiscard]]
+  auto engine_latency() const -> Result;
+
+  [[nodiscard]]
+  auto startup_progress() const -> Result;
 };
 
 }  // namespace simulator::http
@@ -38,6 +38,19 @@ class ListingAccessor {
   virtual auto add(data_layer::Listing::Patch snapshot) const noexcept
       -> tl::expected<void, Failure> = 0;
 
+  // Inserts all listings at once, returns them in the order of patches
+  [[nodiscard]]
+  virtual auto add_all(std::vector<data_layer::Listing::Patch> snapshots)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::Listing>, Failure> = 0;
+
+  // Inserts or updates all listings at once,
+  // returns them in the order of patches
+  [[nodiscard]]
+  virtual auto upsert_all(std::vector<data_layer::Listing::Patch> patches)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::Listing>, Failure> = 0;
+
   [[nodiscard]]
   virtual auto update(data_layer::Listing::Patch update,
                       std::uint64_t listing_id) const noexcept
@@ -73,6 +86,16 @@ class DataLayerListingAccessor final : public ListingAccessor {
   auto add(data_layer::Listing::Patch snapshot) const noexcept
       -> tl::expected<void, Failure> override;
 
+  [[nodiscard]]
+  auto add_all(std::vector<data_layer::Listing::Patch> snapshots)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::Listing>, Failure> override;
+
+  [[nodiscard]]
+  auto upsert_all(std::vector<data_layer::Listing::Patch> patches)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::Listing>, Failure> override;
+
   [[nodiscard]]
   auto update(data_layer::Listing::Patch update,
               std::uint64_t listing_id) const noexcept
@@ -34,6 +34,19 @@ class PriceSeedAccessor {
   virtual auto add(data_layer::PriceSeed::Patch snapshot) const noexcept
       -> tl::expected<void, Failure> = 0;
 
+  // Inserts all price seeds at once, returns them in the order of patches
+  [[nodiscard]]
+  virtual auto add_all(std::vector<data_layer::PriceSeed::Patch> snapshots)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::PriceSeed>, Failure> = 0;
+
+  // Inserts or updates all price seeds at once,
+  // returns them in the order of patches
+  [[nodiscard]]
+  virtual auto upsert_all(std::vector<data_layer::PriceSeed::Patch> patches)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::PriceSeed>, Failure> = 0;
+
   [[nodiscard]]
   virtual auto update(data_layer::PriceSeed::Patch update,
                       std::uint64_t seed_id) const noexcept
@@ -68,6 +81,16 @@ class DataLayerPriceSeedAccessor final : public PriceSeedAccessor {
   auto add(data_layer::PriceSeed::Patch snapshot) const noexcept
       -> tl::expected<void, Failure> override;
 
+  [[nodiscard]]
+  auto add_all(std::vector<data_layer::PriceSeed::Patch> snapshots)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::PriceSeed>, Failure> override;
+
+  [[nodiscard]]
+  auto upsert_all(std::vector<data_layer::PriceSeed::Patch> patches)
+      const noexcept
+      -> tl::expected<std::vector<data_layer::PriceSeed>, Failure> override;
+
   [[nodiscard]]
   auto update(data_layer::PriceSeed::Patch update,
               std::uint64_t seed_id) const noexcept
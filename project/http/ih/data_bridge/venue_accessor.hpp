@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "data_layer/api/database/context.hpp"
+#include "data_layer/api/database/pool_statistics.hpp"
 #include "data_layer/api/models/venue.hpp"
 #include "ih/data_bridge/operation_failure.hpp"
 
@@ -37,6 +38,11 @@ class VenueAccessor {
   virtual auto update(data_layer::Venue::Patch update,
                       const std::string& venue_id) const noexcept
       -> tl::expected<void, Failure> = 0;
+
+  // Reports usage of the database connection pool of the instance
+  [[nodiscard]]
+  virtual auto pool_statistics() const noexcept
+      -> tl::expected<data_layer::database::PoolStatistics, Failure> = 0;
 };
 
 class DataLayerVenueAccessor final : public VenueAccessor {
@@ -64,6 +70,10 @@ class DataLayerVenueAccessor final : public VenueAccessor {
               const std::string& venue_id) const noexcept
       -> tl::expected<void, Failure> override;
 
+  [[nodiscard]]
+  auto pool_statistics() const noexcept
+      -> tl::expected<data_layer::database::PoolStatistics, Failure> override;
+
  private:
   data_layer::database::Context context_;
 };
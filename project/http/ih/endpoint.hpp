@@ -17,6 +17,10 @@ const std::string Recover{"/api/recover"};
 const std::string RecoverById{"/api/recover/:venueId"};
 const std::string Halt{"/api/halt/:venueId"};
 const std::string Resume{"/api/resume/:venueId"};
+const std::string Latency{"/api/latency"};
+const std::string LatencyById{"/api/latency/:venueId"};
+const std::string Startup{"/api/startup"};
+const std::string StartupById{"/api/startup/:venueId"};
 const std::string Status{"/api/status"};
 const std::string VenueStatusByVenueId{"/api/venuestatus/:id"};
 const std::string VenueStatus{"/api/venuestatus"};
@@ -24,8 +28,10 @@ const std::string VenuesById{"/api/venues/:id"};
 const std::string Venues{"/api/venues"};
 const std::string ListingsBySymbol{"/api/listings/:symbol"};
 const std::string Listings{"/api/listings"};
+const std::string BulkListings{"/api/bulklistings"};
 const std::string PriceSeedsById{"/api/priceseeds/:id"};
 const std::string PriceSeeds{"/api/priceseeds"};
+const std::string BulkPriceSeeds{"/api/bulkpriceseeds"};
 const std::string SyncPriceSeeds{"/api/syncpriceseeds"};
 const std::string DataSourcesById{"/api/datasources/:id"};
 const std::string DataSources{"/api/datasources"};
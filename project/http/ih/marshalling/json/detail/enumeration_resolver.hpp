@@ -31,6 +31,13 @@ class EnumerationResolver {
 
   static auto resolve(const std::string& value,
                       data_layer::Venue::EngineType& result) -> void;
+
+  [[nodiscard]]
+  static auto resolve(data_layer::Venue::SelfTradePrevention value)
+      -> std::string_view;
+
+  static auto resolve(const std::string& value,
+                      data_layer::Venue::SelfTradePrevention& result) -> void;
 };
 
 }  // namespace simulator::http::json
@@ -33,6 +33,24 @@ constexpr std::string_view Datasources{"dataSources"};
 
 }  // namespace datasource_key
 
+namespace engine_latency_key {
+
+constexpr std::string_view Engines{"engines"};
+constexpr std::string_view InstrumentId{"instrumentId"};
+constexpr std::string_view Symbol{"symbol"};
+constexpr std::string_view Commands{"commands"};
+constexpr std::string_view Command{"command"};
+constexpr std::string_view Stage{"stage"};
+constexpr std::string_view Count{"count"};
+constexpr std::string_view Mean{"meanNs"};
+constexpr std::string_view P50{"p50Ns"};
+constexpr std::string_view P90{"p90Ns"};
+constexpr std::string_view P99{"p99Ns"};
+constexpr std::string_view P999{"p999Ns"};
+constexpr std::string_view Max{"maxNs"};
+
+}  // namespace engine_latency_key
+
 namespace listing_key {
 
 constexpr std::string_view ListingId{"id"};
@@ -109,6 +127,16 @@ constexpr std::string_view Settings{"settings"};
 
 }  // namespace setting_key
 
+namespace startup_progress_key {
+
+constexpr std::string_view Stage{"stage"};
+constexpr std::string_view EnginesTotal{"enginesTotal"};
+constexpr std::string_view EnginesConstructed{"enginesConstructed"};
+constexpr std::string_view EnginesRecovered{"enginesRecovered"};
+constexpr std::string_view Elapsed{"elapsedMs"};
+
+}  // namespace startup_progress_key
+
 namespace venue_key {
 
 constexpr std::string_view VenueId{"id"};
@@ -125,6 +153,8 @@ constexpr std::string_view TnsEnabled{"timeAndSalesEnabled"};
 constexpr std::string_view TnsQtyEnabled{"timeAndSalesQuantityEnabled"};
 constexpr std::string_view TnsSideEnabled{"timeAndSalesSideEnabled"};
 constexpr std::string_view TnsPartiesEnabled{"timeAndSalesPartiesEnabled"};
+constexpr std::string_view TnsHistoryDepth{"timeAndSalesHistoryDepth"};
+constexpr std::string_view SelfTradePrevention{"selfTradePrevention"};
 constexpr std::string_view Timezone{"timezone"};
 constexpr std::string_view CancelOnDisconnect{"cancelOnDisconnect"};
 constexpr std::string_view PersistenceEnabled{"persistenceEnabled"};
@@ -0,0 +1,27 @@
+#ifndef SIMULATOR_HTTP_IH_MARSHALLING_JSON_ENGINE_LATENCY_HPP_
+#define SIMULATOR_HTTP_IH_MARSHALLING_JSON_ENGINE_LATENCY_HPP_
+
+#include <rapidjson/document.h>
+
+#include <string>
+
+#include "protocol/admin/engine_latency.hpp"
+
+namespace simulator::http::json {
+
+class EngineLatencyMarshaller {
+ public:
+  static auto marshall(const protocol::EngineLatencyReply& reply)
+      -> std::string;
+
+ private:
+  static auto marshall(const protocol::EngineLatency& latency,
+                       rapidjson::Document& dest) -> void;
+
+  static auto marshall(const protocol::CommandLatency& latency,
+                       rapidjson::Document& dest) -> void;
+};
+
+}  // namespace simulator::http::json
+
+#endif  // SIMULATOR_HTTP_IH_MARSHALLING_JSON_ENGINE_LATENCY_HPP_
@@ -27,6 +27,11 @@ class ListingUnmarshaller {
  public:
   static auto unmarshall(std::string_view json,
                          data_layer::Listing::Patch& dest) -> void;
+
+  // Accepts a JSON array of Listing objects, either bare or keyed
+  // the same way as a marshalled list
+  static auto unmarshall(std::string_view json,
+                         std::vector<data_layer::Listing::Patch>& dest) -> void;
 };
 
 }  // namespace simulator::http::json
@@ -27,6 +27,11 @@ class PriceSeedUnmarshaller {
  public:
   static auto unmarshall(std::string_view json,
                          data_layer::PriceSeed::Patch& dest) -> void;
+
+  // Accepts a JSON array of PriceSeed objects, either bare or keyed
+  // the same way as a marshalled list
+  static auto unmarshall(std::string_view json,
+                         std::vector<data_layer::PriceSeed::Patch>& dest) -> void;
 };
 
 }  // namespace simulator::http::json
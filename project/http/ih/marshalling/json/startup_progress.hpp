@@ -0,0 +1,18 @@
+#ifndef SIMULATOR_HTTP_IH_MARSHALLING_JSON_STARTUP_PROGRESS_HPP_
+#define SIMULATOR_HTTP_IH_MARSHALLING_JSON_STARTUP_PROGRESS_HPP_
+
+#include <string>
+
+#include "protocol/admin/startup_progress.hpp"
+
+namespace simulator::http::json {
+
+class StartupProgressMarshaller {
+ public:
+  static auto marshall(const protocol::StartupProgressReply& reply)
+      -> std::string;
+};
+
+}  // namespace simulator::http::json
+
+#endif  // SIMULATOR_HTTP_IH_MARSHALLING_JSON_STARTUP_PROGRESS_HPP_
@@ -6,12 +6,14 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "data_layer/api/models/venue.hpp"
 #include "ih/controllers/datasource_controller.hpp"
 #include "ih/controllers/listing_controller.hpp"
 #include "ih/controllers/price_seed_controller.hpp"
 #include "ih/controllers/setting_controller.hpp"
+#include "ih/controllers/trading_controller.hpp"
 #include "ih/controllers/venue_controller.hpp"
 #include "ih/data_bridge/venue_accessor.hpp"
 #include "ih/redirect/redirection_processor.hpp"
@@ -26,6 +28,7 @@ class GetProcessor {
                         const ListingController& listing_controller,
                         const PriceSeedController& price_seed_controller,
                         const SettingController& setting_controller,
+                        const TradingController& trading_controller,
                         const VenueController& venue_controller);
 
   auto get_venue(const Pistache::Rest::Request& request,
@@ -67,6 +70,12 @@ class GetProcessor {
   auto get_order_gen_status(const Pistache::Rest::Request& request,
                             Pistache::Http::ResponseWriter response) -> void;
 
+  auto get_engine_latency(const Pistache::Rest::Request& request,
+                          Pistache::Http::ResponseWriter response) -> void;
+
+  auto get_startup_progress(const Pistache::Rest::Request& request,
+                            Pistache::Http::ResponseWriter response) -> void;
+
   auto get_venue_status_str(const data_layer::Venue& venue,
                             bool send_response_code,
                             bool& available) const -> std::string;
@@ -84,6 +93,11 @@ class GetProcessor {
   auto redirect(const Pistache::Rest::Request& request,
                 const std::string& instance_id) const -> redirect::Result;
 
+  auto check_venue_availability(const std::string& venue_id) const -> bool;
+
+  auto check_venues_availability(
+      const std::vector<data_layer::Venue>& venues) const -> std::vector<bool>;
+
   std::shared_ptr<redirect::RedirectionProcessor> redirector_;
 
   std::reference_wrapper<const data_bridge::VenueAccessor> venue_accessor_;
@@ -92,6 +106,7 @@ class GetProcessor {
   std::reference_wrapper<const ListingController> listing_controller_;
   std::reference_wrapper<const PriceSeedController> price_seed_controller_;
   std::reference_wrapper<const SettingController> setting_controller_;
+  std::reference_wrapper<const TradingController> trading_controller_;
   std::reference_wrapper<const VenueController> venue_controller_;
 };
 
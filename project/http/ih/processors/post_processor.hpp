@@ -35,12 +35,18 @@ class PostProcessor {
   auto add_listing(const Pistache::Rest::Request& request,
                    Pistache::Http::ResponseWriter response) -> void;
 
+  auto add_listings(const Pistache::Rest::Request& request,
+                    Pistache::Http::ResponseWriter response) -> void;
+
   auto add_data_source(const Pistache::Rest::Request& request,
                        Pistache::Http::ResponseWriter response) -> void;
 
   auto add_price_seed(const Pistache::Rest::Request& request,
                       Pistache::Http::ResponseWriter response) -> void;
 
+  auto add_price_seeds(const Pistache::Rest::Request& request,
+                       Pistache::Http::ResponseWriter response) -> void;
+
   auto handle_store_request(const Pistache::Rest::Request& request,
                             Pistache::Http::ResponseWriter response) -> void;
 
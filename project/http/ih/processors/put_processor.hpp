@@ -34,12 +34,18 @@ class PutProcessor {
   auto update_listing(const Pistache::Rest::Request& request,
                       Pistache::Http::ResponseWriter response) -> void;
 
+  auto upsert_listings(const Pistache::Rest::Request& request,
+                       Pistache::Http::ResponseWriter response) -> void;
+
   auto update_data_source(const Pistache::Rest::Request& request,
                           Pistache::Http::ResponseWriter response) -> void;
 
   auto update_price_seed(const Pistache::Rest::Request& request,
                          Pistache::Http::ResponseWriter response) -> void;
 
+  auto upsert_price_seeds(const Pistache::Rest::Request& request,
+                          Pistache::Http::ResponseWriter response) -> void;
+
   auto sync_price_seeds(const Pistache::Rest::Request& request,
                         Pistache::Http::ResponseWriter response) -> void;
 
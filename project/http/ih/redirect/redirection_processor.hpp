@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "ih/data_bridge/venue_accessor.hpp"
 #include "ih/redirect/redirector.hpp"
@@ -13,6 +14,12 @@
 
 namespace simulator::http::redirect {
 
+struct VenueRequest {
+  std::string venue_id;
+  Pistache::Http::Method method;
+  std::string url;
+};
+
 class RedirectionProcessor {
  public:
   RedirectionProcessor() = delete;
@@ -27,6 +34,11 @@ class RedirectionProcessor {
                          Pistache::Http::Method method,
                          const std::string& url) const -> Result;
 
+  // Redirects requests to several venues at once, results are ordered as
+  // the requests, a venue failure does not affect results of other venues
+  auto redirect_to_venues(const std::vector<VenueRequest>& requests) const
+      -> std::vector<Result>;
+
   static auto create(const data_bridge::VenueAccessor& venue_accessor)
       -> std::shared_ptr<RedirectionProcessor>;
 
@@ -3,6 +3,7 @@
 
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "ih/redirect/request.hpp"
 #include "ih/redirect/result.hpp"
@@ -19,6 +20,18 @@ class Redirector {
 
   virtual auto redirect(const Request& request) const noexcept
       -> RedirectionResult = 0;
+
+  // Redirects requests to several destinations,
+  // results are ordered as the requests
+  virtual auto redirect_all(const std::vector<Request>& requests) const noexcept
+      -> std::vector<RedirectionResult> {
+    std::vector<RedirectionResult> results;
+    results.reserve(requests.size());
+    for (const auto& request : requests) {
+      results.push_back(redirect(request));
+    }
+    return results;
+  }
 };
 
 }  // namespace simulator::http::redirect
@@ -1,18 +1,57 @@
 #ifndef SIMULATOR_HTTP_IH_REDIRECT_REQUEST_REDIRECTOR_HPP_
 #define SIMULATOR_HTTP_IH_REDIRECT_REQUEST_REDIRECTOR_HPP_
 
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "ih/redirect/destination.hpp"
 #include "ih/redirect/redirector.hpp"
 
 namespace simulator::http::redirect {
 
+// Redirects requests through persistent (keep-alive) connections,
+// which are pooled per destination and reused by subsequent requests.
 class RequestRedirector final : public Redirector {
  public:
+  struct Timeouts {
+    std::chrono::milliseconds connection{1000};
+    std::chrono::milliseconds read{5000};
+  };
+
+  RequestRedirector() noexcept;
+  explicit RequestRedirector(Timeouts timeouts) noexcept;
+  RequestRedirector(const RequestRedirector&) = delete;
+  RequestRedirector(RequestRedirector&&) = delete;
+  ~RequestRedirector() noexcept override;
+
+  auto operator=(const RequestRedirector&) -> RequestRedirector& = delete;
+  auto operator=(RequestRedirector&&) -> RequestRedirector& = delete;
+
   auto redirect(const Request& request) const noexcept
       -> RedirectionResult override;
 
+  // Redirects the requests concurrently, each one within its own timeouts,
+  // so that it takes as long as the slowest destination to respond
+  auto redirect_all(const std::vector<Request>& requests) const noexcept
+      -> std::vector<RedirectionResult> override;
+
   static auto create() -> std::shared_ptr<RequestRedirector>;
+
+ private:
+  class ClientPool;
+
+  auto pool_of(const Destination& destination) const -> ClientPool&;
+
+  Timeouts timeouts_;
+
+  mutable std::mutex pools_mutex_;
+  mutable std::map<std::pair<std::string, int>, std::unique_ptr<ClientPool>>
+      pools_;
 };
 
 }  // namespace simulator::http::redirect
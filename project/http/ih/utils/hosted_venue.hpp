@@ -0,0 +1,38 @@
+#ifndef SIMULATOR_HTTP_IH_UTILS_HOSTED_VENUE_HPP_
+#define SIMULATOR_HTTP_IH_UTILS_HOSTED_VENUE_HPP_
+
+#include <optional>
+#include <string_view>
+
+#include "cfg/api/cfg.hpp"
+
+namespace simulator::http {
+
+// Resolves a venue (instance) identifier of a request to a venue hosted
+// by this process, an empty identifier denotes the venue of the process.
+//
+// Returns std::nullopt when the venue is hosted by another process and
+// the request has to be redirected. Otherwise, returns the venue to bind
+// the request processing to with cfg::VenueScope, which is nullptr
+// in a single-venue process.
+[[nodiscard]]
+inline auto find_local_venue(std::string_view instance_id)
+    -> std::optional<const cfg::HostedVenueConfiguration*> {
+  if (cfg::hosted_venues().empty()) {
+    if (instance_id.empty() || instance_id == cfg::venue().name) {
+      return nullptr;
+    }
+    return std::nullopt;
+  }
+
+  const auto* venue = cfg::find_hosted_venue(
+      instance_id.empty() ? std::string_view{cfg::venue().name} : instance_id);
+  if (venue != nullptr) {
+    return venue;
+  }
+  return std::nullopt;
+}
+
+}  // namespace simulator::http
+
+#endif  // SIMULATOR_HTTP_IH_UTILS_HOSTED_VENUE_HPP_
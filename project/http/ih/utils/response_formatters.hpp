@@ -4,11 +4,14 @@
 #include <fmt/format.h>
 #include <rapidjson/document.h>
 
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 
 #include "cfg/api/cfg.hpp"
 #include "core/version.hpp"
+#include "data_layer/api/database/pool_statistics.hpp"
 #include "data_layer/api/models/venue.hpp"
 #include "ih/marshalling/json/detail/utils.hpp"
 
@@ -26,14 +29,13 @@ inline auto format_result_response(std::string_view result_message)
   return format_response("result", result_message);
 }
 
-[[nodiscard]]
-inline auto format_venue_status(const data_layer::Venue& venue,
-                                int response_code) -> std::string {
-  rapidjson::Document document;
-  rapidjson::Value value;
+namespace detail {
 
+inline auto add_venue_status(rapidjson::Document& document,
+                             const data_layer::Venue& venue,
+                             int response_code) -> void {
+  rapidjson::Value value;
   auto& allocator = document.GetAllocator();
-  document.SetObject();
 
   value.SetString(venue.venue_id().data(), allocator);
   document.AddMember("id", value, allocator);
@@ -54,7 +56,56 @@ inline auto format_venue_status(const data_layer::Venue& venue,
     value.SetInt(response_code);
     document.AddMember("statusCode", value, allocator);
   }
+}
+
+inline auto add_pool_statistics(
+    rapidjson::Document& document,
+    const data_layer::database::PoolStatistics& statistics) -> void {
+  auto& allocator = document.GetAllocator();
+  rapidjson::Value pool{rapidjson::kObjectType};
+
+  pool.AddMember("inUse", static_cast<std::uint64_t>(statistics.in_use),
+                 allocator);
+  pool.AddMember("idle", static_cast<std::uint64_t>(statistics.idle),
+                 allocator);
+  pool.AddMember("maxSize", static_cast<std::uint64_t>(statistics.max_size),
+                 allocator);
+  pool.AddMember("acquisitions", statistics.acquisitions, allocator);
+  pool.AddMember(
+      "waitedAcquisitions", statistics.waited_acquisitions, allocator);
+  pool.AddMember(
+      "timedOutAcquisitions", statistics.timed_out_acquisitions, allocator);
+  pool.AddMember("maxWaitUs",
+                 static_cast<std::int64_t>(statistics.max_wait.count()),
+                 allocator);
+
+  document.AddMember("databasePool", pool, allocator);
+}
+
+}  // namespace detail
 
+[[nodiscard]]
+inline auto format_venue_status(const data_layer::Venue& venue,
+                                int response_code) -> std::string {
+  rapidjson::Document document;
+  document.SetObject();
+  detail::add_venue_status(document, venue, response_code);
+  return json::encode(document);
+}
+
+// Reports the status of the venue along with the usage of the database
+// connection pool of the instance, when it is known
+[[nodiscard]]
+inline auto format_system_status(
+    const data_layer::Venue& venue,
+    const std::optional<data_layer::database::PoolStatistics>& pool_statistics)
+    -> std::string {
+  rapidjson::Document document;
+  document.SetObject();
+  detail::add_venue_status(document, venue, 0);
+  if (pool_statistics.has_value()) {
+    detail::add_pool_statistics(document, *pool_statistics);
+  }
   return json::encode(document);
 }
 
@@ -2,8 +2,10 @@
 
 #include <fmt/format.h>
 
+#include <cstddef>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "core/tools/numeric.hpp"
 #include "data_layer/api/models/listing.hpp"
@@ -15,9 +17,10 @@ namespace simulator::http {
 
 namespace {
 
+template <typename Patch>
 [[nodiscard]]
 auto unmarshall_request_body(std::string_view body,
-                             data_layer::Listing::Patch& dest,
+                             Patch& dest,
                              Pistache::Http::Code& code,
                              std::string& content) noexcept -> bool {
   try {
@@ -137,6 +140,42 @@ auto ListingController::insert_listing(const std::string& body) const
   return std::make_pair(code, std::move(content));
 }
 
+auto ListingController::insert_listings(const std::string& body) const
+    -> Result {
+  Pistache::Http::Code code{};
+  std::string content;
+
+  std::vector<data_layer::Listing::Patch> patches;
+  if (!unmarshall_request_body(body, patches, code, content)) {
+    return std::make_pair(code, std::move(content));
+  }
+
+  const std::size_t requested = patches.size();
+  auto result = data_accessor_.get().add_all(std::move(patches));
+  if (result) {
+    log::info("successfully inserted {} listings", requested);
+  }
+  return make_bulk_result(result, Pistache::Http::Code::Created);
+}
+
+auto ListingController::upsert_listings(const std::string& body) const
+    -> Result {
+  Pistache::Http::Code code{};
+  std::string content;
+
+  std::vector<data_layer::Listing::Patch> patches;
+  if (!unmarshall_request_body(body, patches, code, content)) {
+    return std::make_pair(code, std::move(content));
+  }
+
+  const std::size_t requested = patches.size();
+  auto result = data_accessor_.get().upsert_all(std::move(patches));
+  if (result) {
+    log::info("successfully upserted {} listings", requested);
+  }
+  return make_bulk_result(result, Pistache::Http::Code::Ok);
+}
+
 auto ListingController::update_listing(const std::string& key,
                                        const std::string& body) const
     -> Result {
@@ -182,6 +221,41 @@ auto ListingController::update_listing(const std::string& key,
   return std::make_pair(code, std::move(content));
 }
 
+auto ListingController::make_bulk_result(const StoredListings& result,
+                                         Pistache::Http::Code success_code)
+    -> Result {
+  Pistache::Http::Code code{};
+  std::string content;
+
+  if (result) {
+    try {
+      content = json::ListingMarshaller::marshall(result.value());
+      code = success_code;
+    } catch (const std::exception& ex) {
+      log::warn("failed to marshall listings list to JSON: {}", ex.what());
+      code = Pistache::Http::Code::Internal_Server_Error;
+      content = format_result_response("failed to marshall listings list");
+    }
+  } else {
+    const auto failure = result.error();
+    content = format_error_response(failure);
+    switch (failure) {
+      case data_bridge::Failure::MalformedInput:
+      case data_bridge::Failure::DataIntegrityViolationError:
+        code = Pistache::Http::Code::Bad_Request;
+        break;
+      case data_bridge::Failure::ResponseCardinalityError:
+        code = Pistache::Http::Code::Not_Found;
+        break;
+      default:
+        code = Pistache::Http::Code::Internal_Server_Error;
+        break;
+    }
+  }
+
+  return std::make_pair(code, std::move(content));
+}
+
 auto ListingController::format_error_response(data_bridge::Failure failure)
     -> std::string {
   std::string message;
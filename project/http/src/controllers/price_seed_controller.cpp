@@ -2,9 +2,11 @@
 
 #include <fmt/chrono.h>
 
+#include <cstddef>
 #include <ctime>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "data_layer/api/models/price_seed.hpp"
 #include "data_layer/api/models/setting.hpp"
@@ -16,9 +18,10 @@ namespace simulator::http {
 
 namespace {
 
+template <typename Patch>
 [[nodiscard]]
 auto unmarshall_request_body(std::string_view body,
-                             data_layer::PriceSeed::Patch& dest,
+                             Patch& dest,
                              Pistache::Http::Code& code,
                              std::string& content) noexcept -> bool {
   try {
@@ -144,6 +147,42 @@ auto PriceSeedController::insert_price_seed(const std::string& body) const
   return std::make_pair(code, std::move(content));
 }
 
+auto PriceSeedController::insert_price_seeds(const std::string& body) const
+    -> Result {
+  Pistache::Http::Code code{};
+  std::string content;
+
+  std::vector<data_layer::PriceSeed::Patch> patches;
+  if (!unmarshall_request_body(body, patches, code, content)) {
+    return std::make_pair(code, std::move(content));
+  }
+
+  const std::size_t requested = patches.size();
+  auto result = seed_accessor_.get().add_all(std::move(patches));
+  if (result) {
+    log::info("successfully inserted {} price seeds", requested);
+  }
+  return make_bulk_result(result, Pistache::Http::Code::Created);
+}
+
+auto PriceSeedController::upsert_price_seeds(const std::string& body) const
+    -> Result {
+  Pistache::Http::Code code{};
+  std::string content;
+
+  std::vector<data_layer::PriceSeed::Patch> patches;
+  if (!unmarshall_request_body(body, patches, code, content)) {
+    return std::make_pair(code, std::move(content));
+  }
+
+  const std::size_t requested = patches.size();
+  auto result = seed_accessor_.get().upsert_all(std::move(patches));
+  if (result) {
+    log::info("successfully upserted {} price seeds", requested);
+  }
+  return make_bulk_result(result, Pistache::Http::Code::Ok);
+}
+
 auto PriceSeedController::update_price_seed(std::uint64_t seed_id,
                                             const std::string& body) const
     -> Result {
@@ -252,6 +291,41 @@ auto PriceSeedController::sync_price_seeds() const -> Result {
   return std::make_pair(code, std::move(content));
 }
 
+auto PriceSeedController::make_bulk_result(const StoredPriceSeeds& result,
+                                           Pistache::Http::Code success_code)
+    -> Result {
+  Pistache::Http::Code code{};
+  std::string content;
+
+  if (result) {
+    try {
+      content = json::PriceSeedMarshaller::marshall(result.value());
+      code = success_code;
+    } catch (const std::exception& ex) {
+      log::warn("failed to marshall price seeds list to JSON: {}", ex.what());
+      code = Pistache::Http::Code::Internal_Server_Error;
+      content = format_result_response("failed to marshall price seeds list");
+    }
+  } else {
+    const auto failure = result.error();
+    content = format_error_response(failure);
+    switch (failure) {
+      case data_bridge::Failure::MalformedInput:
+      case data_bridge::Failure::DataIntegrityViolationError:
+        code = Pistache::Http::Code::Bad_Request;
+        break;
+      case data_bridge::Failure::ResponseCardinalityError:
+        code = Pistache::Http::Code::Not_Found;
+        break;
+      default:
+        code = Pistache::Http::Code::Internal_Server_Error;
+        break;
+    }
+  }
+
+  return std::make_pair(code, std::move(content));
+}
+
 auto PriceSeedController::format_error_response(data_bridge::Failure failure)
     -> std::string {
   std::string message;
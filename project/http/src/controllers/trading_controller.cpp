@@ -1,11 +1,15 @@
 #include "ih/controllers/trading_controller.hpp"
 
 #include "core/common/return_code.hpp"
+#include "ih/marshalling/json/engine_latency.hpp"
 #include "ih/marshalling/json/halt.hpp"
+#include "ih/marshalling/json/startup_progress.hpp"
 #include "ih/utils/response_formatters.hpp"
 #include "log/logging.hpp"
 #include "middleware/routing/trading_admin_channel.hpp"
+#include "protocol/admin/engine_latency.hpp"
 #include "protocol/admin/market_state.hpp"
+#include "protocol/admin/startup_progress.hpp"
 #include "protocol/admin/trading_phase.hpp"
 
 namespace simulator::http {
@@ -232,4 +236,38 @@ auto TradingController::recover_market_state() const -> Result {
   return std::make_pair(code, format_result_response(message));
 }
 
-}  // namespace simulator::http
\ No newline at end of file
+auto TradingController::engine_latency() const -> Result {
+  protocol::EngineLatencyRequest request;
+  protocol::EngineLatencyReply reply;
+
+  try {
+    middleware::send_admin_request(request, reply);
+  } catch (const middleware::ChannelUnboundError&) {
+    log::err("failed to send request {}", request);
+    return std::make_pair(
+        Pistache::Http::Code::Internal_Server_Error,
+        format_result_response("Failed to process the request."));
+  }
+
+  return std::make_pair(Pistache::Http::Code::Ok,
+                        json::EngineLatencyMarshaller::marshall(reply));
+}
+
+auto TradingController::startup_progress() const -> Result {
+  protocol::StartupProgressRequest request;
+  protocol::StartupProgressReply reply;
+
+  try {
+    middleware::send_admin_request(request, reply);
+  } catch (const middleware::ChannelUnboundError&) {
+    log::err("failed to send request {}", request);
+    return std::make_pair(
+        Pistache::Http::Code::Internal_Server_Error,
+        format_result_response("Failed to process the request."));
+  }
+
+  return std::make_pair(Pistache::Http::Code::Ok,
+                        json::StartupProgressMarshaller::marshall(reply));
+}
+
+}  // namespace simulator::http
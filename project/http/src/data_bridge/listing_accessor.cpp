@@ -121,6 +121,64 @@ auto DataLayerListingAccessor::add(data_layer::Listing::Patch snapshot)
   return tl::unexpected{Failure::UnknownError};
 }
 
+auto DataLayerListingAccessor::add_all(
+    std::vector<data_layer::Listing::Patch> snapshots) const noexcept
+    -> tl::expected<std::vector<data_layer::Listing>, Failure> {
+  try {
+    return data_layer::insert_listings(context_, std::move(snapshots));
+  } catch (const data_layer::ConnectionFailure&) {
+    return tl::unexpected{Failure::DatabaseConnectionError};
+  } catch (const data_layer::CardinalityViolationError&) {
+    return tl::unexpected{Failure::ResponseCardinalityError};
+  } catch (const data_layer::MalformedPatch&) {
+    return tl::unexpected{Failure::MalformedInput};
+  } catch (const data_layer::DataIntegrityError&) {
+    return tl::unexpected{Failure::DataIntegrityViolationError};
+  } catch (const data_layer::DataDecodingError&) {
+    return tl::unexpected{Failure::ResponseDecodingError};
+  } catch (const std::exception& ex) {
+    log::warn(
+        "data access layer raised unexpected exception while adding "
+        "listings: {}",
+        ex.what());
+  } catch (...) {
+    log::err(
+        "unknown error is raised by data access layer while adding "
+        "listings");
+  }
+
+  return tl::unexpected{Failure::UnknownError};
+}
+
+auto DataLayerListingAccessor::upsert_all(
+    std::vector<data_layer::Listing::Patch> patches) const noexcept
+    -> tl::expected<std::vector<data_layer::Listing>, Failure> {
+  try {
+    return data_layer::upsert_listings(context_, std::move(patches));
+  } catch (const data_layer::ConnectionFailure&) {
+    return tl::unexpected{Failure::DatabaseConnectionError};
+  } catch (const data_layer::CardinalityViolationError&) {
+    return tl::unexpected{Failure::ResponseCardinalityError};
+  } catch (const data_layer::MalformedPatch&) {
+    return tl::unexpected{Failure::MalformedInput};
+  } catch (const data_layer::DataIntegrityError&) {
+    return tl::unexpected{Failure::DataIntegrityViolationError};
+  } catch (const data_layer::DataDecodingError&) {
+    return tl::unexpected{Failure::ResponseDecodingError};
+  } catch (const std::exception& ex) {
+    log::warn(
+        "data access layer raised unexpected exception while upserting "
+        "listings: {}",
+        ex.what());
+  } catch (...) {
+    log::err(
+        "unknown error is raised by data access layer while upserting "
+        "listings");
+  }
+
+  return tl::unexpected{Failure::UnknownError};
+}
+
 auto DataLayerListingAccessor::update(data_layer::Listing::Patch update,
                                       std::uint64_t listing_id) const noexcept
     -> tl::expected<void, Failure> {
@@ -90,6 +90,64 @@ auto DataLayerPriceSeedAccessor::add(data_layer::PriceSeed::Patch snapshot)
   return tl::unexpected{Failure::UnknownError};
 }
 
+auto DataLayerPriceSeedAccessor::add_all(
+    std::vector<data_layer::PriceSeed::Patch> snapshots) const noexcept
+    -> tl::expected<std::vector<data_layer::PriceSeed>, Failure> {
+  try {
+    return data_layer::insert_price_seeds(context_, std::move(snapshots));
+  } catch (const data_layer::ConnectionFailure&) {
+    return tl::unexpected{Failure::DatabaseConnectionError};
+  } catch (const data_layer::CardinalityViolationError&) {
+    return tl::unexpected{Failure::ResponseCardinalityError};
+  } catch (const data_layer::MalformedPatch&) {
+    return tl::unexpected{Failure::MalformedInput};
+  } catch (const data_layer::DataIntegrityError&) {
+    return tl::unexpected{Failure::DataIntegrityViolationError};
+  } catch (const data_layer::DataDecodingError&) {
+    return tl::unexpected{Failure::ResponseDecodingError};
+  } catch (const std::exception& ex) {
+    log::warn(
+        "data access layer raised unexpected exception while adding "
+        "price seeds: {}",
+        ex.what());
+  } catch (...) {
+    log::err(
+        "unknown error is raised by data access layer while adding "
+        "price seeds");
+  }
+
+  return tl::unexpected{Failure::UnknownError};
+}
+
+auto DataLayerPriceSeedAccessor::upsert_all(
+    std::vector<data_layer::PriceSeed::Patch> patches) const noexcept
+    -> tl::expected<std::vector<data_layer::PriceSeed>, Failure> {
+  try {
+    return data_layer::upsert_price_seeds(context_, std::move(patches));
+  } catch (const data_layer::ConnectionFailure&) {
+    return tl::unexpected{Failure::DatabaseConnectionError};
+  } catch (const data_layer::CardinalityViolationError&) {
+    return tl::unexpected{Failure::ResponseCardinalityError};
+  } catch (const data_layer::MalformedPatch&) {
+    return tl::unexpected{Failure::MalformedInput};
+  } catch (const data_layer::DataIntegrityError&) {
+    return tl::unexpected{Failure::DataIntegrityViolationError};
+  } catch (const data_layer::DataDecodingError&) {
+    return tl::unexpected{Failure::ResponseDecodingError};
+  } catch (const std::exception& ex) {
+    log::warn(
+        "data access layer raised unexpected exception while upserting "
+        "price seeds: {}",
+        ex.what());
+  } catch (...) {
+    log::err(
+        "unknown error is raised by data access layer while upserting "
+        "price seeds");
+  }
+
+  return tl::unexpected{Failure::UnknownError};
+}
+
 auto DataLayerPriceSeedAccessor::update(data_layer::PriceSeed::Patch update,
                                         std::uint64_t seed_id) const noexcept
     -> tl::expected<void, Failure> {
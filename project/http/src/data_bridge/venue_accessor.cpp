@@ -127,4 +127,22 @@ auto DataLayerVenueAccessor::update(data_layer::Venue::Patch update,
   return tl::unexpected{Failure::UnknownError};
 }
 
+auto DataLayerVenueAccessor::pool_statistics() const noexcept
+    -> tl::expected<data_layer::database::PoolStatistics, Failure> {
+  try {
+    return data_layer::database::pool_statistics(context_);
+  } catch (const std::exception& ex) {
+    log::warn(
+        "data access layer raised unexpected exception while reading "
+        "database connection pool statistics: {}",
+        ex.what());
+  } catch (...) {
+    log::err(
+        "unknown error is raised by data access layer while reading "
+        "database connection pool statistics");
+  }
+
+  return tl::unexpected{Failure::UnknownError};
+}
+
 }  // namespace simulator::http::data_bridge
@@ -38,6 +38,16 @@ constexpr std::string_view Quoting{"Quoting"};
 
 }  // namespace venue_engine_type
 
+namespace venue_self_trade_prevention {
+
+constexpr std::string_view None{"None"};
+constexpr std::string_view CancelNewest{"CancelNewest"};
+constexpr std::string_view CancelOldest{"CancelOldest"};
+constexpr std::string_view CancelBoth{"CancelBoth"};
+constexpr std::string_view Decrement{"Decrement"};
+
+}  // namespace venue_self_trade_prevention
+
 namespace {
 
 template <typename Enumeration>
@@ -174,4 +184,42 @@ auto EnumerationResolver::resolve(const std::string& value,
   }
 }
 
+auto EnumerationResolver::resolve(data_layer::Venue::SelfTradePrevention value)
+    -> std::string_view {
+  using Mode = data_layer::Venue::SelfTradePrevention;
+  switch (value) {
+    case Mode::None:
+      return venue_self_trade_prevention::None;
+    case Mode::CancelNewest:
+      return venue_self_trade_prevention::CancelNewest;
+    case Mode::CancelOldest:
+      return venue_self_trade_prevention::CancelOldest;
+    case Mode::CancelBoth:
+      return venue_self_trade_prevention::CancelBoth;
+    case Mode::Decrement:
+      return venue_self_trade_prevention::Decrement;
+  }
+
+  raise_bad_enumeration_error("Venue::SelfTradePrevention", value);
+}
+
+auto EnumerationResolver::resolve(
+    const std::string& value, data_layer::Venue::SelfTradePrevention& result)
+    -> void {
+  using Mode = data_layer::Venue::SelfTradePrevention;
+  if (value == venue_self_trade_prevention::None) {
+    result = Mode::None;
+  } else if (value == venue_self_trade_prevention::CancelNewest) {
+    result = Mode::CancelNewest;
+  } else if (value == venue_self_trade_prevention::CancelOldest) {
+    result = Mode::CancelOldest;
+  } else if (value == venue_self_trade_prevention::CancelBoth) {
+    result = Mode::CancelBoth;
+  } else if (value == venue_self_trade_prevention::Decrement) {
+    result = Mode::Decrement;
+  } else {
+    raise_bad_value_error("Venue::SelfTradePrevention", value);
+  }
+}
+
 }  // namespace simulator::http::json
@@ -245,6 +245,8 @@ auto KeyResolver::resolve_key(data_layer::Venue::Attribute attribute)
       return venue_key::TnsSideEnabled;
     case data_layer::Venue::Attribute::TnsPartiesEnabled:
       return venue_key::TnsPartiesEnabled;
+    case data_layer::Venue::Attribute::TnsHistoryDepth:
+      return venue_key::TnsHistoryDepth;
     case data_layer::Venue::Attribute::Timezone:
       return venue_key::Timezone;
     case data_layer::Venue::Attribute::CancelOnDisconnect:
@@ -253,6 +255,8 @@ auto KeyResolver::resolve_key(data_layer::Venue::Attribute attribute)
       return venue_key::PersistenceEnabled;
     case data_layer::Venue::Attribute::PersistenceFilePath:
       return venue_key::PersistenceFilePath;
+    case data_layer::Venue::Attribute::SelfTradePrevention:
+      return venue_key::SelfTradePrevention;
   }
 
   raise_bad_attribute_error("Venue", attribute);
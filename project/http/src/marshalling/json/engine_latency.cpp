@@ -0,0 +1,83 @@
+#include "ih/marshalling/json/engine_latency.hpp"
+
+#include <rapidjson/document.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "ih/marshalling/json/detail/keys.hpp"
+#include "ih/marshalling/json/detail/utils.hpp"
+
+namespace simulator::http::json {
+namespace {
+
+auto to_json(std::chrono::nanoseconds latency) -> std::int64_t {
+  return static_cast<std::int64_t>(latency.count());
+}
+
+}  // namespace
+
+auto EngineLatencyMarshaller::marshall(
+    const protocol::EngineLatencyReply& reply) -> std::string {
+  rapidjson::Document root;
+  root.SetObject();
+  auto& allocator = root.GetAllocator();
+
+  rapidjson::Document engines{std::addressof(allocator)};
+  engines.SetArray();
+  for (const auto& engine : reply.engines) {
+    rapidjson::Document engine_doc{std::addressof(allocator)};
+    marshall(engine, engine_doc);
+    engines.PushBack(engine_doc, allocator);
+  }
+
+  root.AddMember(make_key(engine_latency_key::Engines), engines, allocator);
+  return encode(root);
+}
+
+auto EngineLatencyMarshaller::marshall(const protocol::EngineLatency& latency,
+                                       rapidjson::Document& dest) -> void {
+  using namespace engine_latency_key;
+
+  dest.SetObject();
+  auto& allocator = dest.GetAllocator();
+
+  rapidjson::Document commands{std::addressof(allocator)};
+  commands.SetArray();
+  for (const auto& command : latency.commands) {
+    rapidjson::Document command_doc{std::addressof(allocator)};
+    marshall(command, command_doc);
+    commands.PushBack(command_doc, allocator);
+  }
+
+  dest.AddMember(make_key(InstrumentId), latency.instrument_id, allocator);
+  dest.AddMember(make_key(Symbol),
+                 rapidjson::Value{latency.symbol.c_str(), allocator},
+                 allocator);
+  dest.AddMember(make_key(Commands), commands, allocator);
+}
+
+auto EngineLatencyMarshaller::marshall(const protocol::CommandLatency& latency,
+                                       rapidjson::Document& dest) -> void {
+  using namespace engine_latency_key;
+
+  dest.SetObject();
+  auto& allocator = dest.GetAllocator();
+
+  dest.AddMember(make_key(Command),
+                 rapidjson::Value{latency.command.c_str(), allocator},
+                 allocator);
+  dest.AddMember(make_key(Stage),
+                 rapidjson::Value{latency.stage.c_str(), allocator},
+                 allocator);
+  dest.AddMember(make_key(Count), latency.count, allocator);
+  dest.AddMember(make_key(Mean), to_json(latency.mean), allocator);
+  dest.AddMember(make_key(P50), to_json(latency.p50), allocator);
+  dest.AddMember(make_key(P90), to_json(latency.p90), allocator);
+  dest.AddMember(make_key(P99), to_json(latency.p99), allocator);
+  dest.AddMember(make_key(P999), to_json(latency.p999), allocator);
+  dest.AddMember(make_key(Max), to_json(latency.max), allocator);
+}
+
+}  // namespace simulator::http::json
@@ -1,7 +1,10 @@
 #include "ih/marshalling/json/listing.hpp"
 
+#include <fmt/format.h>
 #include <rapidjson/document.h>
 
+#include <vector>
+
 #include "data_layer/api/inspectors/listing.hpp"
 #include "ih/marshalling/json/detail/keys.hpp"
 #include "ih/marshalling/json/detail/marshaller.hpp"
@@ -61,4 +64,38 @@ auto ListingUnmarshaller::unmarshall(std::string_view json,
   writer.write(dest);
 }
 
+auto ListingUnmarshaller::unmarshall(
+    std::string_view json, std::vector<data_layer::Listing::Patch>& dest)
+    -> void {
+  using data_layer::ListingPatchWriter;
+
+  rapidjson::Document document;
+  document.Parse(json.data());
+
+  const rapidjson::Value* items = &document;
+  if (document.IsObject()) {
+    if (!document.HasMember(make_key(listing_key::Listings))) {
+      throw std::runtime_error{
+          fmt::format("listings JSON does not contain required `{}' key",
+                      listing_key::Listings)};
+    }
+    items = &document[listing_key::Listings.data()];
+  }
+  if (!items->IsArray()) {
+    throw std::runtime_error{"failed to parse Listing JSON array"};
+  }
+
+  const auto items_array = items->GetArray();
+  dest.reserve(dest.size() + items_array.Size());
+  for (const auto& item : items_array) {
+    if (!item.IsObject()) {
+      throw std::runtime_error{"failed to parse Listing JSON object"};
+    }
+
+    Unmarshaller unmarshaller{item};
+    ListingPatchWriter<decltype(unmarshaller)> writer{unmarshaller};
+    writer.write(dest.emplace_back());
+  }
+}
+
 }  // namespace simulator::http::json
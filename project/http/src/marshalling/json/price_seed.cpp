@@ -1,7 +1,10 @@
 #include "ih/marshalling/json/price_seed.hpp"
 
+#include <fmt/format.h>
 #include <rapidjson/document.h>
 
+#include <vector>
+
 #include "data_layer/api/inspectors/price_seed.hpp"
 #include "ih/marshalling/json/detail/keys.hpp"
 #include "ih/marshalling/json/detail/marshaller.hpp"
@@ -62,4 +65,38 @@ auto PriceSeedUnmarshaller::unmarshall(std::string_view json,
   writer.write(dest);
 }
 
+auto PriceSeedUnmarshaller::unmarshall(
+    std::string_view json, std::vector<data_layer::PriceSeed::Patch>& dest)
+    -> void {
+  using data_layer::PriceSeedPatchWriter;
+
+  rapidjson::Document document;
+  document.Parse(json.data());
+
+  const rapidjson::Value* items = &document;
+  if (document.IsObject()) {
+    if (!document.HasMember(make_key(price_seed_key::PriceSeeds))) {
+      throw std::runtime_error{
+          fmt::format("price seeds JSON does not contain required `{}' key",
+                      price_seed_key::PriceSeeds)};
+    }
+    items = &document[price_seed_key::PriceSeeds.data()];
+  }
+  if (!items->IsArray()) {
+    throw std::runtime_error{"failed to parse PriceSeed JSON array"};
+  }
+
+  const auto items_array = items->GetArray();
+  dest.reserve(dest.size() + items_array.Size());
+  for (const auto& item : items_array) {
+    if (!item.IsObject()) {
+      throw std::runtime_error{"failed to parse PriceSeed JSON object"};
+    }
+
+    Unmarshaller unmarshaller{item};
+    PriceSeedPatchWriter<decltype(unmarshaller)> writer{unmarshaller};
+    writer.write(dest.emplace_back());
+  }
+}
+
 }  // namespace simulator::http::json
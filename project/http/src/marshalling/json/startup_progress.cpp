@@ -0,0 +1,34 @@
+#include "ih/marshalling/json/startup_progress.hpp"
+
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+
+#include <cstdint>
+
+#include "ih/marshalling/json/detail/keys.hpp"
+#include "ih/marshalling/json/detail/utils.hpp"
+
+namespace simulator::http::json {
+
+auto StartupProgressMarshaller::marshall(
+    const protocol::StartupProgressReply& reply) -> std::string {
+  using namespace startup_progress_key;
+
+  rapidjson::Document root;
+  root.SetObject();
+  auto& allocator = root.GetAllocator();
+
+  const std::string stage = fmt::format("{}", reply.stage);
+  root.AddMember(
+      make_key(Stage), rapidjson::Value{stage.c_str(), allocator}, allocator);
+  root.AddMember(make_key(EnginesTotal), reply.engines_total, allocator);
+  root.AddMember(
+      make_key(EnginesConstructed), reply.engines_constructed, allocator);
+  root.AddMember(make_key(EnginesRecovered), reply.engines_recovered, allocator);
+  root.AddMember(make_key(Elapsed),
+                 static_cast<std::int64_t>(reply.elapsed.count()),
+                 allocator);
+  return encode(root);
+}
+
+}  // namespace simulator::http::json
@@ -84,6 +84,15 @@ auto VenueUnmarshaller::unmarshall(std::string_view json,
   VenuePatchWriter<decltype(unmarshaller)> writer{unmarshaller};
   writer.write(dest);
 
+  if (const auto depth = dest.tns_history_depth();
+      depth.has_value() && *depth > data_layer::Venue::MaxTnsHistoryDepth) {
+    throw std::runtime_error{fmt::format(
+        "invalid integer received for `{}', value is greater than supported "
+        "maximal value {}",
+        venue_key::TnsHistoryDepth,
+        data_layer::Venue::MaxTnsHistoryDepth)};
+  }
+
   unmarshall_phases(document, dest);
 }
 
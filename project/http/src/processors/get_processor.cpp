@@ -5,12 +5,17 @@
 #include <pistache/router.h>
 
 #include <cassert>
+#include <cstddef>
+#include <optional>
 #include <regex>
 #include <utility>
+#include <vector>
 
 #include "cfg/api/cfg.hpp"
+#include "cfg/api/venue_scope.hpp"
 #include "ih/endpoint.hpp"
 #include "ih/marshalling/json/venue.hpp"
+#include "ih/utils/hosted_venue.hpp"
 #include "ih/utils/response_formatters.hpp"
 #include "log/logging.hpp"
 #include "middleware/routing/generator_admin_channel.hpp"
@@ -23,6 +28,7 @@ GetProcessor::GetProcessor(const data_bridge::VenueAccessor& venue_accessor,
                            const ListingController& listing_controller,
                            const PriceSeedController& price_seed_controller,
                            const SettingController& setting_controller,
+                           const TradingController& trading_controller,
                            const VenueController& venue_controller)
     : redirector_(redirect::RedirectionProcessor::create(venue_accessor)),
       venue_accessor_(venue_accessor),
@@ -30,6 +36,7 @@ GetProcessor::GetProcessor(const data_bridge::VenueAccessor& venue_accessor,
       listing_controller_(listing_controller),
       price_seed_controller_(price_seed_controller),
       setting_controller_(setting_controller),
+      trading_controller_(trading_controller),
       venue_controller_(venue_controller) {}
 
 auto GetProcessor::get_venue(const Pistache::Rest::Request& request,
@@ -114,10 +121,16 @@ auto GetProcessor::get_status(const Pistache::Rest::Request& request,
 
   const auto result = venue_accessor_.get().select_single(cfg::venue().name);
   if (result) {
-    bool available = false;
-    response_body = get_venue_status_str(result.value(), false, available);
-    response_code = available ? Pistache::Http::Code::Ok
-                              : Pistache::Http::Code::Service_Unavailable;
+    // The database is reachable at this point, an exhausted connection
+    // pool is reported in the status, but does not fail the request
+    std::optional<data_layer::database::PoolStatistics> pool_statistics;
+    if (auto statistics = venue_accessor_.get().pool_statistics()) {
+      pool_statistics = *statistics;
+    }
+    response_body = format_system_status(result.value(), pool_statistics);
+    response_code = check_venue_availability(result->venue_id())
+                        ? Pistache::Http::Code::Ok
+                        : Pistache::Http::Code::Service_Unavailable;
   } else {
     response_code = Pistache::Http::Code::Service_Unavailable;
     response_body = format_result_response("failed to select venue");
@@ -156,7 +169,6 @@ auto GetProcessor::get_venue_statuses(const Pistache::Rest::Request& request,
 
   Pistache::Http::Code response_code{};
   std::string response_body;
-  bool available = false;
 
   const auto result = venue_accessor_.get().select_all();
   if (!result) {
@@ -166,11 +178,17 @@ auto GetProcessor::get_venue_statuses(const Pistache::Rest::Request& request,
     return;
   }
 
-  for (const auto& venue : result.value()) {
+  const auto& venues = result.value();
+  const std::vector<bool> availability = check_venues_availability(venues);
+  for (std::size_t index = 0; index < venues.size(); ++index) {
     if (!response_body.empty()) {
       response_body.append(",");
     }
-    response_body.append(get_venue_status_str(venue, true, available));
+    const auto venue_code = availability[index]
+                                ? Pistache::Http::Code::Ok
+                                : Pistache::Http::Code::Service_Unavailable;
+    response_body.append(
+        format_venue_status(venues[index], static_cast<int>(venue_code)));
   }
 
   response_code = Pistache::Http::Code::Ok;
@@ -183,18 +201,7 @@ auto GetProcessor::get_venue_statuses(const Pistache::Rest::Request& request,
 auto GetProcessor::get_venue_status_str(const data_layer::Venue& venue,
                                         bool send_response_code,
                                         bool& available) const -> std::string {
-  available = false;
-  const auto& venue_id = venue.venue_id();
-
-  if (venue_id == cfg::venue().name) {
-    available = true;
-  } else {
-    auto result = redirector_->redirect_to_venue(
-        venue_id,
-        Pistache::Http::Method::Get,
-        fmt::format(endpoint::VenueStatusByVenueIdFmt, venue_id));
-    available = result.http_code() == Pistache::Http::Code::Ok;
-  }
+  available = check_venue_availability(venue.venue_id());
 
   const auto response_code = available
                                  ? Pistache::Http::Code::Ok
@@ -203,6 +210,53 @@ auto GetProcessor::get_venue_status_str(const data_layer::Venue& venue,
       venue, send_response_code ? static_cast<int>(response_code) : 0);
 }
 
+auto GetProcessor::check_venue_availability(const std::string& venue_id) const
+    -> bool {
+  if (find_local_venue(venue_id).has_value()) {
+    return true;
+  }
+
+  const auto result = redirector_->redirect_to_venue(
+      venue_id,
+      Pistache::Http::Method::Get,
+      fmt::format(endpoint::VenueStatusByVenueIdFmt, venue_id));
+  return result.http_code() == Pistache::Http::Code::Ok;
+}
+
+auto GetProcessor::check_venues_availability(
+    const std::vector<data_layer::Venue>& venues) const -> std::vector<bool> {
+  std::vector<bool> availability(venues.size(), false);
+
+  // Peer instances are requested at once, so that the check takes
+  // as long as the slowest peer to respond
+  std::vector<redirect::VenueRequest> peer_requests;
+  std::vector<std::size_t> peer_positions;
+  for (std::size_t position = 0; position < venues.size(); ++position) {
+    const auto& venue_id = venues[position].venue_id();
+    if (find_local_venue(venue_id).has_value()) {
+      availability[position] = true;
+      continue;
+    }
+
+    peer_requests.push_back(redirect::VenueRequest{
+        .venue_id = venue_id,
+        .method = Pistache::Http::Method::Get,
+        .url = fmt::format(endpoint::VenueStatusByVenueIdFmt, venue_id)});
+    peer_positions.push_back(position);
+  }
+
+  if (peer_requests.empty()) {
+    return availability;
+  }
+
+  const auto results = redirector_->redirect_to_venues(peer_requests);
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    availability[peer_positions[index]] =
+        results[index].http_code() == Pistache::Http::Code::Ok;
+  }
+  return availability;
+}
+
 auto GetProcessor::get_settings(
     [[maybe_unused]] const Pistache::Rest::Request& request,
     Pistache::Http::ResponseWriter response) -> void {
@@ -219,7 +273,8 @@ auto GetProcessor::get_order_gen_status(const Pistache::Rest::Request& request,
   log::info("received request to retrieve random order generator status for {}",
             instance_id);
 
-  if (instance_id == cfg::venue().name) {
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
     handle_generation_status_request(request, std::move(response));
   } else {
     const auto redirect_response = redirect(request, instance_id);
@@ -230,6 +285,51 @@ auto GetProcessor::get_order_gen_status(const Pistache::Rest::Request& request,
   }
 }
 
+auto GetProcessor::get_engine_latency(const Pistache::Rest::Request& request,
+                                      Pistache::Http::ResponseWriter response)
+    -> void {
+  const auto instance_id = request.hasParam(":venueId")
+                               ? request.param(":venueId").as<std::string>()
+                               : std::string{};
+  log::info("received request to retrieve matching engines latency for {}",
+            instance_id);
+
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
+    const auto [code, body] = trading_controller_.get().engine_latency();
+    respond(request, response, code, body);
+  } else {
+    const auto redirect_response = redirect(request, instance_id);
+    respond(request,
+            response,
+            redirect_response.http_code(),
+            redirect_response.body_content());
+  }
+}
+
+auto GetProcessor::get_startup_progress(const Pistache::Rest::Request& request,
+                                        Pistache::Http::ResponseWriter response)
+    -> void {
+  const auto instance_id = request.hasParam(":venueId")
+                               ? request.param(":venueId").as<std::string>()
+                               : std::string{};
+  log::info("received request to retrieve trading system start-up progress "
+            "for {}",
+            instance_id);
+
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
+    const auto [code, body] = trading_controller_.get().startup_progress();
+    respond(request, response, code, body);
+  } else {
+    const auto redirect_response = redirect(request, instance_id);
+    respond(request,
+            response,
+            redirect_response.http_code(),
+            redirect_response.body_content());
+  }
+}
+
 auto GetProcessor::handle_generation_status_request(
     const Pistache::Rest::Request& request,
     Pistache::Http::ResponseWriter response) -> void {
@@ -2,7 +2,9 @@
 
 #include <pistache/http_defs.h>
 
+#include "cfg/api/venue_scope.hpp"
 #include "ih/redirect/redirection_processor.hpp"
+#include "ih/utils/hosted_venue.hpp"
 #include "ih/utils/response_formatters.hpp"
 #include "log/logging.hpp"
 
@@ -40,6 +42,16 @@ auto PostProcessor::add_listing(const Pistache::Rest::Request& request,
   respond(request, response, code, body);
 }
 
+auto PostProcessor::add_listings(const Pistache::Rest::Request& request,
+                                 Pistache::Http::ResponseWriter response)
+    -> void {
+  log::info("requested bulk insert of listings");
+
+  auto [code, body] =
+      listing_controller_.get().insert_listings(request.body());
+  respond(request, response, code, body);
+}
+
 auto PostProcessor::add_data_source(const Pistache::Rest::Request& request,
                                     Pistache::Http::ResponseWriter response)
     -> void {
@@ -60,6 +72,16 @@ auto PostProcessor::add_price_seed(const Pistache::Rest::Request& request,
   respond(request, response, code, body);
 }
 
+auto PostProcessor::add_price_seeds(const Pistache::Rest::Request& request,
+                                    Pistache::Http::ResponseWriter response)
+    -> void {
+  log::info("requested bulk insert of price seeds");
+
+  auto [code, body] =
+      price_seed_controller_.get().insert_price_seeds(request.body());
+  respond(request, response, code, body);
+}
+
 auto PostProcessor::handle_store_request(
     const Pistache::Rest::Request& request,
     Pistache::Http::ResponseWriter response) -> void {
@@ -67,7 +89,8 @@ auto PostProcessor::handle_store_request(
                                ? request.param(":venueId").as<std::string>()
                                : std::string{};
 
-  if (instance_id.empty() || instance_id == cfg::venue().name) {
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
     const auto [code, body] = trading_controller_.get().store_market_state();
     respond(request, response, code, body);
   } else {
@@ -86,7 +109,8 @@ auto PostProcessor::handle_recover_request(
                                ? request.param(":venueId").as<std::string>()
                                : std::string{};
 
-  if (instance_id.empty() || instance_id == cfg::venue().name) {
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
     const auto [code, body] = trading_controller_.get().recover_market_state();
     respond(request, response, code, body);
   } else {
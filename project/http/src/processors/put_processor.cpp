@@ -5,7 +5,9 @@
 #include <regex>
 #include <string>
 
+#include "cfg/api/venue_scope.hpp"
 #include "ih/controllers/trading_controller.hpp"
+#include "ih/utils/hosted_venue.hpp"
 #include "ih/utils/response_formatters.hpp"
 #include "log/logging.hpp"
 #include "middleware/routing/generator_admin_channel.hpp"
@@ -51,6 +53,16 @@ auto PutProcessor::update_listing(const Pistache::Rest::Request& request,
   respond(request, response, code, body);
 }
 
+auto PutProcessor::upsert_listings(const Pistache::Rest::Request& request,
+                                   Pistache::Http::ResponseWriter response)
+    -> void {
+  log::info("requested bulk upsert of listings");
+
+  auto [code, body] =
+      listing_controller_.get().upsert_listings(request.body());
+  respond(request, response, code, body);
+}
+
 auto PutProcessor::update_data_source(const Pistache::Rest::Request& request,
                                       Pistache::Http::ResponseWriter response)
     -> void {
@@ -73,6 +85,16 @@ auto PutProcessor::update_price_seed(const Pistache::Rest::Request& request,
   respond(request, response, code, body);
 }
 
+auto PutProcessor::upsert_price_seeds(const Pistache::Rest::Request& request,
+                                      Pistache::Http::ResponseWriter response)
+    -> void {
+  log::info("requested bulk upsert of price seeds");
+
+  auto [code, body] =
+      price_seed_controller_.get().upsert_price_seeds(request.body());
+  respond(request, response, code, body);
+}
+
 auto PutProcessor::sync_price_seeds(const Pistache::Rest::Request& request,
                                     Pistache::Http::ResponseWriter response)
     -> void {
@@ -97,7 +119,8 @@ auto PutProcessor::stop_order_gen(const Pistache::Rest::Request& request,
   const auto instance_id = request.param(":venueId").as<std::string>();
   log::info("requested to stop order generation for {}", instance_id);
 
-  if (instance_id == cfg::venue().name) {
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
     handle_generation_stop_request(request, std::move(response));
   } else {
     const auto redirect_response = redirect(request, instance_id);
@@ -114,7 +137,8 @@ auto PutProcessor::start_order_gen(const Pistache::Rest::Request& request,
   const auto instance_id = request.param(":venueId").as<std::string>();
   log::info("requested to start order generation for {}", instance_id);
 
-  if (instance_id == cfg::venue().name) {
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
     handle_generation_start_request(request, std::move(response));
   } else {
     const auto redirect_response = redirect(request, instance_id);
@@ -128,7 +152,8 @@ auto PutProcessor::start_order_gen(const Pistache::Rest::Request& request,
 auto PutProcessor::halt_phase(const Pistache::Rest::Request& request,
                               Pistache::Http::ResponseWriter response) -> void {
   const auto instance_id = request.param(":venueId").as<std::string>();
-  if (instance_id == cfg::venue().name) {
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
     const auto [code, body] = trading_controller_.get().halt(request.body());
     respond(request, response, code, body);
   } else {
@@ -144,7 +169,8 @@ auto PutProcessor::resume_phase(const Pistache::Rest::Request& request,
                                 Pistache::Http::ResponseWriter response)
     -> void {
   const auto instance_id = request.param(":venueId").as<std::string>();
-  if (instance_id == cfg::venue().name) {
+  if (const auto local_venue = find_local_venue(instance_id)) {
+    const cfg::VenueScope scope{*local_venue};
     const auto [code, body] = trading_controller_.get().resume();
     respond(request, response, code, body);
   } else {
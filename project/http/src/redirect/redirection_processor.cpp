@@ -2,7 +2,10 @@
 
 #include <fmt/format.h>
 
+#include <cstddef>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "ih/data_bridge/venue_accessor.hpp"
 #include "ih/redirect/destination_resolver.hpp"
@@ -40,6 +43,44 @@ auto RedirectionProcessor::redirect_to_venue(const std::string& venue_id,
   return *response;
 }
 
+auto RedirectionProcessor::redirect_to_venues(
+    const std::vector<VenueRequest>& requests) const -> std::vector<Result> {
+  std::vector<std::optional<Result>> results(requests.size());
+
+  std::vector<Request> redirected_requests;
+  std::vector<std::size_t> redirected_positions;
+  for (std::size_t position = 0; position < requests.size(); ++position) {
+    const auto& [venue_id, method, url] = requests[position];
+    auto [destination, status] = resolver_->resolve_by_venue_id(venue_id);
+    if (!destination.has_value() || status != Resolver::Status::Success) {
+      results[position] = process_resolve_error(status, venue_id);
+      continue;
+    }
+
+    redirected_requests.emplace_back(std::move(*destination), method, url);
+    redirected_positions.push_back(position);
+  }
+
+  auto responses = redirector_->redirect_all(redirected_requests);
+  for (std::size_t index = 0; index < responses.size(); ++index) {
+    const std::size_t position = redirected_positions[index];
+    auto& [response, status] = responses[index];
+    if (!response.has_value() || status != Redirector::Status::Success) {
+      results[position] =
+          process_redirect_error(status, requests[position].venue_id);
+    } else {
+      results[position] = std::move(*response);
+    }
+  }
+
+  std::vector<Result> venue_results;
+  venue_results.reserve(results.size());
+  for (auto& result : results) {
+    venue_results.push_back(std::move(*result));
+  }
+  return venue_results;
+}
+
 auto RedirectionProcessor::create(
     const data_bridge::VenueAccessor& venue_accessor)
     -> std::shared_ptr<RedirectionProcessor> {
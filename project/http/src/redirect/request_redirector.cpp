@@ -3,14 +3,68 @@
 #include <httplib.h>
 #include <pistache/http.h>
 
+#include <cstddef>
+#include <future>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
 
+#include "cfg/api/cfg.hpp"
 #include "ih/formatters/redirect.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::http::redirect {
 
+// Idle keep-alive clients connected to a single destination.
+// A client is taken by a request for its duration, so that concurrent
+// requests to the destination are sent through distinct connections.
+class RequestRedirector::ClientPool {
+ public:
+  // Bounds the connections kept open to a destination between requests
+  static constexpr std::size_t MaxIdleClients = 8;
+
+  ClientPool(Destination destination, Timeouts timeouts) noexcept
+      : destination_{std::move(destination)}, timeouts_{timeouts} {}
+
+  auto acquire() -> std::unique_ptr<httplib::Client> {
+    {
+      const std::lock_guard lock{mutex_};
+      if (!idle_clients_.empty()) {
+        auto client = std::move(idle_clients_.back());
+        idle_clients_.pop_back();
+        return client;
+      }
+    }
+
+    auto client = std::make_unique<httplib::Client>(destination_.host(),
+                                                    destination_.port());
+    client->set_keep_alive(true);
+    client->set_connection_timeout(timeouts_.connection);
+    client->set_read_timeout(timeouts_.read);
+    return client;
+  }
+
+  // Is called only for clients which have received a response,
+  // a failed client is dropped as its connection state is unknown
+  auto release(std::unique_ptr<httplib::Client> client) -> void {
+    const std::lock_guard lock{mutex_};
+    if (idle_clients_.size() < MaxIdleClients) {
+      idle_clients_.push_back(std::move(client));
+    }
+  }
+
+ private:
+  Destination destination_;
+  Timeouts timeouts_;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<httplib::Client>> idle_clients_;
+};
+
 using MethodHandler =
     std::function<httplib::Result(httplib::Client&, const Request&)>;
 
@@ -58,8 +112,10 @@ static auto process_error(httplib::Error error, const Request& request)
     -> Redirector::RedirectionResult {
   using Status = Redirector::Status;
 
+  // A read error is reported as well when the destination
+  // has not responded within the read timeout
   if (error == httplib::Error::ConnectionTimeout ||
-      error == httplib::Error::Connection) {
+      error == httplib::Error::Connection || error == httplib::Error::Read) {
     log::err("{} failed - connection failed", request);
     return std::make_pair(std::nullopt, Status::ConnectionFailed);
   }
@@ -69,16 +125,25 @@ static auto process_error(httplib::Error error, const Request& request)
   return std::make_pair(std::nullopt, Status::UnknownError);
 }
 
+RequestRedirector::RequestRedirector() noexcept
+    : RequestRedirector(Timeouts{}) {}
+
+RequestRedirector::RequestRedirector(Timeouts timeouts) noexcept
+    : timeouts_{timeouts} {}
+
+RequestRedirector::~RequestRedirector() noexcept = default;
+
 auto RequestRedirector::redirect(const Request& request) const noexcept
     -> Redirector::RedirectionResult {
-  const auto& destination = request.destination();
   try {
     log::debug("forwarding {}", request);
-    httplib::Client client{destination.host(), destination.port()};
     const auto& method_handler = find_handler(request.method());
-    auto request_result = method_handler(client, request);
+    auto& pool = pool_of(request.destination());
+    auto client = pool.acquire();
+    auto request_result = method_handler(*client, request);
 
     if (request_result) {
+      pool.release(std::move(client));
       return process_response(std::move(request_result), request);
     }
 
@@ -93,8 +158,51 @@ auto RequestRedirector::redirect(const Request& request) const noexcept
   }
 }
 
+auto RequestRedirector::redirect_all(
+    const std::vector<Request>& requests) const noexcept
+    -> std::vector<RedirectionResult> {
+  std::vector<std::future<RedirectionResult>> pending_results;
+  pending_results.reserve(requests.size());
+  for (const auto& request : requests) {
+    const auto redirect_request = [this, &request] {
+      return redirect(request);
+    };
+    try {
+      pending_results.push_back(
+          std::async(std::launch::async, redirect_request));
+    } catch (const std::system_error& error) {
+      log::warn("failed to forward {} concurrently: {}, forwarding it later",
+                request,
+                error.what());
+      pending_results.push_back(
+          std::async(std::launch::deferred, redirect_request));
+    }
+  }
+
+  std::vector<RedirectionResult> results;
+  results.reserve(requests.size());
+  for (auto& pending_result : pending_results) {
+    results.push_back(pending_result.get());
+  }
+  return results;
+}
+
 auto RequestRedirector::create() -> std::shared_ptr<RequestRedirector> {
-  return std::make_shared<RequestRedirector>();
+  const auto& config = cfg::http();
+  return std::make_shared<RequestRedirector>(Timeouts{
+      .connection =
+          std::chrono::milliseconds{config.redirect_connect_timeout},
+      .read = std::chrono::milliseconds{config.redirect_read_timeout}});
+}
+
+auto RequestRedirector::pool_of(const Destination& destination) const
+    -> ClientPool& {
+  const std::lock_guard lock{pools_mutex_};
+  auto& pool = pools_[std::make_pair(destination.host(), destination.port())];
+  if (!pool) {
+    pool = std::make_unique<ClientPool>(destination, timeouts_);
+  }
+  return *pool;
 }
 
 }  // namespace simulator::http::redirect
\ No newline at end of file
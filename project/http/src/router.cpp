@@ -107,6 +107,7 @@ Router::Router([[maybe_unused]] database::Context database)
                      listing_controller_,
                      price_seed_controller_,
                      setting_controller_,
+                     trading_controller_,
                      venue_controller_),
       post_processor_(venue_accessor_,
                       datasource_controller_,
@@ -169,6 +170,30 @@ auto Router::init_generator_admin_routers() -> void {
 }
 
 auto Router::init_matching_engine_admin_routes() -> void {
+  Pistache::Rest::Routes::Get(
+      router_,
+      endpoint::Latency,
+      Pistache::Rest::Routes::bind(&GetProcessor::get_engine_latency,
+                                   &get_processor_));
+
+  Pistache::Rest::Routes::Get(
+      router_,
+      endpoint::LatencyById,
+      Pistache::Rest::Routes::bind(&GetProcessor::get_engine_latency,
+                                   &get_processor_));
+
+  Pistache::Rest::Routes::Get(
+      router_,
+      endpoint::Startup,
+      Pistache::Rest::Routes::bind(&GetProcessor::get_startup_progress,
+                                   &get_processor_));
+
+  Pistache::Rest::Routes::Get(
+      router_,
+      endpoint::StartupById,
+      Pistache::Rest::Routes::bind(&GetProcessor::get_startup_progress,
+                                   &get_processor_));
+
   Pistache::Rest::Routes::Post(
       router_,
       endpoint::Store,
@@ -266,6 +291,18 @@ auto Router::init_listing_routes() -> void {
       Pistache::Rest::Routes::bind(&PostProcessor::add_listing,
                                    &post_processor_));
 
+  Pistache::Rest::Routes::Post(
+      router_,
+      endpoint::BulkListings,
+      Pistache::Rest::Routes::bind(&PostProcessor::add_listings,
+                                   &post_processor_));
+
+  Pistache::Rest::Routes::Put(
+      router_,
+      endpoint::BulkListings,
+      Pistache::Rest::Routes::bind(&PutProcessor::upsert_listings,
+                                   &put_processor_));
+
   Pistache::Rest::Routes::Put(
       router_,
       endpoint::ListingsBySymbol,
@@ -292,6 +329,18 @@ auto Router::init_price_seed_routes() -> void {
       Pistache::Rest::Routes::bind(&PostProcessor::add_price_seed,
                                    &post_processor_));
 
+  Pistache::Rest::Routes::Post(
+      router_,
+      endpoint::BulkPriceSeeds,
+      Pistache::Rest::Routes::bind(&PostProcessor::add_price_seeds,
+                                   &post_processor_));
+
+  Pistache::Rest::Routes::Put(
+      router_,
+      endpoint::BulkPriceSeeds,
+      Pistache::Rest::Routes::bind(&PutProcessor::upsert_price_seeds,
+                                   &put_processor_));
+
   Pistache::Rest::Routes::Put(
       router_,
       endpoint::PriceSeedsById,
@@ -32,6 +32,18 @@ struct TradingAdminRequestReceiver
               (const protocol::RecoverMarketStateRequest& request,
                protocol::RecoverMarketStateReply& reply),
               (override));
+
+  MOCK_METHOD(void,
+              process,
+              (const protocol::EngineLatencyRequest& request,
+               protocol::EngineLatencyReply& reply),
+              (override));
+
+  MOCK_METHOD(void,
+              process,
+              (const protocol::StartupProgressRequest& request,
+               protocol::StartupProgressReply& reply),
+              (override));
 };
 
 }  // namespace simulator::http::mock
@@ -21,6 +21,7 @@ class VenueAccessor : public data_bridge::VenueAccessor {
   using VenueResult = Result<Venue>;
   using VenuesResult = Result<std::vector<Venue>>;
   using EmptyResult = Result<void>;
+  using PoolStatisticsResult = Result<data_layer::database::PoolStatistics>;
 
   MOCK_METHOD(VenueResult,
               select_single,
@@ -35,6 +36,11 @@ class VenueAccessor : public data_bridge::VenueAccessor {
               update,
               (Patch, const std::string&),
               (const, noexcept, override));
+
+  MOCK_METHOD(PoolStatisticsResult,
+              pool_statistics,
+              (),
+              (const, noexcept, override));
 };
 
 }  // namespace simulator::http::mock
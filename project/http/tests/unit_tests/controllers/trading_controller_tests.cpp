@@ -370,5 +370,77 @@ TEST_F(HttpTradingControllerRecoverMarketStateTest,
                 "The persistence file is malformed: Error message."));
 }
 
+struct HttpTradingControllerEngineLatencyTest : HttpTradingControllerTest {
+  auto set_engine_latency_reply(protocol::EngineLatencyReply latency_reply)
+      -> void {
+    ON_CALL(receiver_,
+            process(A<const protocol::EngineLatencyRequest&>(),
+                    A<protocol::EngineLatencyReply&>()))
+        .WillByDefault(Invoke([latency_reply = std::move(latency_reply)](
+                                  [[maybe_unused]] const auto& request,
+                                  auto& reply) { reply = latency_reply; }));
+  }
+};
+
+TEST_F(HttpTradingControllerEngineLatencyTest,
+       RepliesInternalServerErrorIfReceiverIsNotBound) {
+  const auto [code, body] = controller.engine_latency();
+
+  ASSERT_EQ(code, Pistache::Http::Code::Internal_Server_Error);
+  ASSERT_EQ(body, format_result_response("Failed to process the request."));
+}
+
+TEST_F(HttpTradingControllerEngineLatencyTest, RepliesOkWithEngineLatencies) {
+  bind_channel();
+  protocol::EngineLatencyReply reply;
+  auto& engine = reply.engines.emplace_back();
+  engine.instrument_id = 1;
+  engine.symbol = "AAPL";
+  set_engine_latency_reply(std::move(reply));
+
+  const auto [code, body] = controller.engine_latency();
+
+  ASSERT_EQ(code, Pistache::Http::Code::Ok);
+  ASSERT_EQ(
+      body,
+      R"({"engines":[{"instrumentId":1,"symbol":"AAPL","commands":[]}]})");
+}
+
+struct HttpTradingControllerStartupProgressTest : HttpTradingControllerTest {
+  auto set_startup_progress_reply(protocol::StartupProgressReply progress_reply)
+      -> void {
+    ON_CALL(receiver_,
+            process(A<const protocol::StartupProgressRequest&>(),
+                    A<protocol::StartupProgressReply&>()))
+        .WillByDefault(Invoke([progress_reply](
+                                  [[maybe_unused]] const auto& request,
+                                  auto& reply) { reply = progress_reply; }));
+  }
+};
+
+TEST_F(HttpTradingControllerStartupProgressTest,
+       RepliesInternalServerErrorIfReceiverIsNotBound) {
+  const auto [code, body] = controller.startup_progress();
+
+  ASSERT_EQ(code, Pistache::Http::Code::Internal_Server_Error);
+  ASSERT_EQ(body, format_result_response("Failed to process the request."));
+}
+
+TEST_F(HttpTradingControllerStartupProgressTest, RepliesOkWithProgress) {
+  bind_channel();
+  protocol::StartupProgressReply reply;
+  reply.stage = protocol::StartupProgressReply::Stage::ConstructingEngines;
+  reply.engines_total = 2;
+  reply.engines_constructed = 1;
+  set_startup_progress_reply(reply);
+
+  const auto [code, body] = controller.startup_progress();
+
+  ASSERT_EQ(code, Pistache::Http::Code::Ok);
+  ASSERT_EQ(body,
+            R"({"stage":"ConstructingEngines","enginesTotal":2,)"
+            R"("enginesConstructed":1,"enginesRecovered":0,"elapsedMs":0})");
+}
+
 }  // namespace
 }  // namespace simulator::http::test
@@ -180,5 +180,60 @@ TEST_F(HttJsonEnumerationResolverVenueEngineType, ResolvesStringQuoting) {
   EXPECT_EQ(type, EngineType::Quoting);
 }
 
+struct HttJsonEnumerationResolverVenueSelfTradePrevention
+    : public ::testing::Test {
+  using Mode = data_layer::Venue::SelfTradePrevention;
+};
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesEnumUndefined) {
+  EXPECT_THROW((void)EnumerationResolver::resolve(static_cast<Mode>(-1)),
+               std::logic_error);
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention, ResolvesEnumNone) {
+  EXPECT_EQ(EnumerationResolver::resolve(Mode::None), "None");
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesEnumCancelNewest) {
+  EXPECT_EQ(EnumerationResolver::resolve(Mode::CancelNewest), "CancelNewest");
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesEnumCancelOldest) {
+  EXPECT_EQ(EnumerationResolver::resolve(Mode::CancelOldest), "CancelOldest");
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesEnumCancelBoth) {
+  EXPECT_EQ(EnumerationResolver::resolve(Mode::CancelBoth), "CancelBoth");
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesEnumDecrement) {
+  EXPECT_EQ(EnumerationResolver::resolve(Mode::Decrement), "Decrement");
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesStringUndefined) {
+  Mode mode{};
+  EXPECT_THROW(EnumerationResolver::resolve("bad", mode), std::runtime_error);
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesStringCancelBoth) {
+  Mode mode{};
+  ASSERT_NO_THROW(EnumerationResolver::resolve("CancelBoth", mode));
+  EXPECT_EQ(mode, Mode::CancelBoth);
+}
+
+TEST_F(HttJsonEnumerationResolverVenueSelfTradePrevention,
+       ResolvesStringDecrement) {
+  Mode mode{};
+  ASSERT_NO_THROW(EnumerationResolver::resolve("Decrement", mode));
+  EXPECT_EQ(mode, Mode::Decrement);
+}
+
 }  // namespace
 }  // namespace simulator::http::json::test
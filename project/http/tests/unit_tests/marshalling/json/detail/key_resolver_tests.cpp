@@ -440,6 +440,16 @@ TEST_F(HttpJsonKeyResolverVenue, ResolvesTnsPartiesEnabled) {
             "timeAndSalesPartiesEnabled");
 }
 
+TEST_F(HttpJsonKeyResolverVenue, ResolvesTnsHistoryDepth) {
+  EXPECT_EQ(KeyResolver::resolve_key(Attribute::TnsHistoryDepth),
+            "timeAndSalesHistoryDepth");
+}
+
+TEST_F(HttpJsonKeyResolverVenue, ResolvesSelfTradePrevention) {
+  EXPECT_EQ(KeyResolver::resolve_key(Attribute::SelfTradePrevention),
+            "selfTradePrevention");
+}
+
 TEST_F(HttpJsonKeyResolverVenue, ResolvesRandomPartiesCount) {
   EXPECT_EQ(KeyResolver::resolve_key(Attribute::RandomPartiesCount),
             "randomPartyCount");
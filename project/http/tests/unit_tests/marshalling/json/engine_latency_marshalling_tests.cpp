@@ -0,0 +1,83 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string_view>
+
+#include "ih/marshalling/json/engine_latency.hpp"
+#include "protocol/admin/engine_latency.hpp"
+
+namespace simulator::http::json::test {
+namespace {
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+TEST(HttpJsonEngineLatencyMarshaller, MarshallsEmptyReply) {
+  const protocol::EngineLatencyReply reply;
+
+  constexpr std::string_view expected_json = R"({"engines":[]})";
+
+  ASSERT_EQ(EngineLatencyMarshaller::marshall(reply), expected_json);
+}
+
+TEST(HttpJsonEngineLatencyMarshaller, MarshallsEngineWithoutCommands) {
+  protocol::EngineLatencyReply reply;
+  auto& engine = reply.engines.emplace_back();
+  engine.instrument_id = 42;  // NOLINT
+  engine.symbol = "AAPL";
+
+  // clang-format off
+  constexpr std::string_view expected_json = "{"
+    R"("engines":[{)"
+      R"("instrumentId":42,)"
+      R"("symbol":"AAPL",)"
+      R"("commands":[])"
+    "}]"
+  "}";
+  // clang-format on
+
+  ASSERT_EQ(EngineLatencyMarshaller::marshall(reply), expected_json);
+}
+
+TEST(HttpJsonEngineLatencyMarshaller, MarshallsCommandLatency) {
+  protocol::EngineLatencyReply reply;
+  auto& engine = reply.engines.emplace_back();
+  engine.instrument_id = 1;
+  engine.symbol = "MSFT";
+  auto& command = engine.commands.emplace_back();
+  command.command = "PlaceOrder";
+  command.stage = "Execution";
+  command.count = 10;  // NOLINT
+  command.mean = 150ns;
+  command.p50 = 120ns;
+  command.p90 = 200ns;
+  command.p99 = 400ns;
+  command.p999 = 900ns;
+  command.max = 1000ns;
+
+  // clang-format off
+  constexpr std::string_view expected_json = "{"
+    R"("engines":[{)"
+      R"("instrumentId":1,)"
+      R"("symbol":"MSFT",)"
+      R"("commands":[{)"
+        R"("command":"PlaceOrder",)"
+        R"("stage":"Execution",)"
+        R"("count":10,)"
+        R"("meanNs":150,)"
+        R"("p50Ns":120,)"
+        R"("p90Ns":200,)"
+        R"("p99Ns":400,)"
+        R"("p999Ns":900,)"
+        R"("maxNs":1000)"
+      "}]"
+    "}]"
+  "}";
+  // clang-format on
+
+  ASSERT_EQ(EngineLatencyMarshaller::marshall(reply), expected_json);
+}
+
+}  // namespace
+}  // namespace simulator::http::json::test
@@ -2,6 +2,8 @@
 #include <gtest/gtest.h>
 
 #include <initializer_list>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -571,6 +573,14 @@ struct HttpJsonListingUnmarshaller : public ::testing::Test {
   data_layer::Listing::Patch patch;
 };
 
+TEST_F(HttpJsonListingUnmarshaller, UnmarshallsListingID) {
+  constexpr std::string_view json{R"({"id":42})"};
+
+  ListingUnmarshaller::unmarshall(json, patch);
+
+  ASSERT_THAT(patch.listing_id(), Optional(Eq(42)));
+}
+
 TEST_F(HttpJsonListingUnmarshaller, UnmarshallsSymbol) {
   constexpr std::string_view json{R"({"symbol":"AAPL"})"};
 
@@ -835,6 +845,48 @@ TEST_F(HttpJsonListingUnmarshaller, UnmarshallsRandomAggressiveAmtMaximum) {
   ASSERT_THAT(patch.random_aggressive_amt_maximum(), Optional(DoubleEq(42.42)));
 }
 
+TEST(HttpJsonListingsUnmarshaller, UnmarshallsBareArray) {
+  constexpr std::string_view json{
+      R"([{"symbol":"AAPL","venueId":"NASDAQ"},{"symbol":"MSFT"}])"};
+  std::vector<data_layer::Listing::Patch> patches;
+
+  ListingUnmarshaller::unmarshall(json, patches);
+
+  ASSERT_EQ(patches.size(), 2);
+  EXPECT_THAT(patches[0].symbol(), Optional(Eq("AAPL")));
+  EXPECT_THAT(patches[0].venue_id(), Optional(Eq("NASDAQ")));
+  EXPECT_THAT(patches[1].symbol(), Optional(Eq("MSFT")));
+  EXPECT_EQ(patches[1].venue_id(), std::nullopt);
+}
+
+TEST(HttpJsonListingsUnmarshaller, UnmarshallsKeyedArray) {
+  constexpr std::string_view json{
+      R"({"listings":[{"symbol":"AAPL"},{"symbol":"MSFT"}]})"};
+  std::vector<data_layer::Listing::Patch> patches;
+
+  ListingUnmarshaller::unmarshall(json, patches);
+
+  ASSERT_EQ(patches.size(), 2);
+  EXPECT_THAT(patches[0].symbol(), Optional(Eq("AAPL")));
+  EXPECT_THAT(patches[1].symbol(), Optional(Eq("MSFT")));
+}
+
+TEST(HttpJsonListingsUnmarshaller, RejectsObjectWithoutListings) {
+  constexpr std::string_view json{R"({"symbol":"AAPL"})"};
+  std::vector<data_layer::Listing::Patch> patches;
+
+  EXPECT_THROW(ListingUnmarshaller::unmarshall(json, patches),
+               std::runtime_error);
+}
+
+TEST(HttpJsonListingsUnmarshaller, RejectsNonObjectItem) {
+  constexpr std::string_view json{R"([{"symbol":"AAPL"},42])"};
+  std::vector<data_layer::Listing::Patch> patches;
+
+  EXPECT_THROW(ListingUnmarshaller::unmarshall(json, patches),
+               std::runtime_error);
+}
+
 // NOLINTEND(*magic-numbers*)
 
 }  // namespace
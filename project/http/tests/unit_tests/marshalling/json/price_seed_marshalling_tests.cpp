@@ -3,7 +3,9 @@
 
 #include <initializer_list>
 #include <string>
+#include <stdexcept>
 #include <string_view>
+#include <vector>
 
 #include "data_layer/api/models/price_seed.hpp"
 #include "ih/marshalling/json/price_seed.hpp"
@@ -200,6 +202,14 @@ struct HttpJsonPriceSeedUnmarshaller : public ::testing::Test {
   data_layer::PriceSeed::Patch patch;
 };
 
+TEST_F(HttpJsonPriceSeedUnmarshaller, UnmarshallsPriceSeedID) {
+  constexpr std::string_view json = R"({"id":42})";
+
+  PriceSeedUnmarshaller::unmarshall(json, patch);
+
+  ASSERT_THAT(patch.price_seed_id(), Optional(Eq(42)));  // NOLINT
+}
+
 TEST_F(HttpJsonPriceSeedUnmarshaller, UnmarshallsSymbol) {
   constexpr std::string_view json = R"({"symbol":"AAPL"})";
 
@@ -280,5 +290,36 @@ TEST_F(HttpJsonPriceSeedUnmarshaller, UnmarshallsLastUpdate) {
   ASSERT_THAT(patch.last_update(), Optional(Eq("2023-09-01")));
 }
 
+TEST(HttpJsonPriceSeedsUnmarshaller, UnmarshallsBareArray) {
+  constexpr std::string_view json =
+      R"([{"symbol":"AAPL","midPrice":42.42},{"symbol":"MSFT"}])";
+  std::vector<data_layer::PriceSeed::Patch> patches;
+
+  PriceSeedUnmarshaller::unmarshall(json, patches);
+
+  ASSERT_EQ(patches.size(), 2);
+  EXPECT_THAT(patches[0].symbol(), Optional(Eq("AAPL")));
+  EXPECT_THAT(patches[0].mid_price(), Optional(DoubleEq(42.42)));
+  EXPECT_THAT(patches[1].symbol(), Optional(Eq("MSFT")));
+}
+
+TEST(HttpJsonPriceSeedsUnmarshaller, UnmarshallsKeyedArray) {
+  constexpr std::string_view json = R"({"priceSeeds":[{"symbol":"AAPL"}]})";
+  std::vector<data_layer::PriceSeed::Patch> patches;
+
+  PriceSeedUnmarshaller::unmarshall(json, patches);
+
+  ASSERT_EQ(patches.size(), 1);
+  EXPECT_THAT(patches[0].symbol(), Optional(Eq("AAPL")));
+}
+
+TEST(HttpJsonPriceSeedsUnmarshaller, RejectsNonArray) {
+  constexpr std::string_view json = R"({"priceSeeds":{"symbol":"AAPL"}})";
+  std::vector<data_layer::PriceSeed::Patch> patches;
+
+  EXPECT_THROW(PriceSeedUnmarshaller::unmarshall(json, patches),
+               std::runtime_error);
+}
+
 }  // namespace
 }  // namespace simulator::http::json::test
@@ -0,0 +1,54 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string_view>
+
+#include "ih/marshalling/json/startup_progress.hpp"
+#include "protocol/admin/startup_progress.hpp"
+
+namespace simulator::http::json::test {
+namespace {
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+TEST(HttpJsonStartupProgressMarshaller, MarshallsInitialProgress) {
+  const protocol::StartupProgressReply reply;
+
+  // clang-format off
+  constexpr std::string_view expected_json = "{"
+    R"("stage":"Initializing",)"
+    R"("enginesTotal":0,)"
+    R"("enginesConstructed":0,)"
+    R"("enginesRecovered":0,)"
+    R"("elapsedMs":0)"
+  "}";
+  // clang-format on
+
+  ASSERT_EQ(StartupProgressMarshaller::marshall(reply), expected_json);
+}
+
+TEST(HttpJsonStartupProgressMarshaller, MarshallsRecoveryProgress) {
+  protocol::StartupProgressReply reply;
+  reply.stage = protocol::StartupProgressReply::Stage::RecoveringState;
+  reply.engines_total = 100;        // NOLINT
+  reply.engines_constructed = 100;  // NOLINT
+  reply.engines_recovered = 42;     // NOLINT
+  reply.elapsed = 1500ms;
+
+  // clang-format off
+  constexpr std::string_view expected_json = "{"
+    R"("stage":"RecoveringState",)"
+    R"("enginesTotal":100,)"
+    R"("enginesConstructed":100,)"
+    R"("enginesRecovered":42,)"
+    R"("elapsedMs":1500)"
+  "}";
+  // clang-format on
+
+  ASSERT_EQ(StartupProgressMarshaller::marshall(reply), expected_json);
+}
+
+}  // namespace
+}  // namespace simulator::http::json::test
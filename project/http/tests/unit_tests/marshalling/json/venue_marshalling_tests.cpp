@@ -250,6 +250,37 @@ TEST_F(HttpJsonVenueMarshaller, MarshallsTnsPartiesEnabled) {
   ASSERT_EQ(marshall(venue), expected_json);
 }
 
+TEST_F(HttpJsonVenueMarshaller, MarshallsTnsHistoryDepth) {
+  const auto patch = make_default_patch().with_tns_history_depth(100);
+  const auto venue = make_venue(patch);
+
+  // clang-format off
+  const std::string expected_json{"{"
+    R"("id":"dummy",)"
+    R"("timeAndSalesHistoryDepth":100,)"
+    R"("phases":[])"
+  "}"};
+  // clang-format on
+
+  ASSERT_EQ(marshall(venue), expected_json);
+}
+
+TEST_F(HttpJsonVenueMarshaller, MarshallsSelfTradePrevention) {
+  const auto patch = make_default_patch().with_self_trade_prevention(
+      data_layer::Venue::SelfTradePrevention::CancelOldest);
+  const auto venue = make_venue(patch);
+
+  // clang-format off
+  const std::string expected_json{"{"
+    R"("id":"dummy",)"
+    R"("selfTradePrevention":"CancelOldest",)"
+    R"("phases":[])"
+  "}"};
+  // clang-format on
+
+  ASSERT_EQ(marshall(venue), expected_json);
+}
+
 TEST_F(HttpJsonVenueMarshaller, MarshallsTimezone) {
   const auto patch = make_default_patch().with_timezone("GMT");
   const auto venue = make_venue(patch);
@@ -467,6 +498,28 @@ TEST_F(HttpJsonVenueUnmarshaller, UnmarshallsTnsPartiesEnabled) {
   EXPECT_THAT(patch.tns_parties_enabled_flag(), Optional(Eq(false)));
 }
 
+TEST_F(HttpJsonVenueUnmarshaller, UnmarshallsTnsHistoryDepth) {
+  constexpr std::string_view json{R"({"timeAndSalesHistoryDepth":100})"};
+
+  VenueUnmarshaller::unmarshall(json, patch);
+  EXPECT_THAT(patch.tns_history_depth(), Optional(Eq(100)));
+}
+
+TEST_F(HttpJsonVenueUnmarshaller, RejectsTnsHistoryDepthAboveMaximum) {
+  constexpr std::string_view json{R"({"timeAndSalesHistoryDepth":1001})"};
+
+  EXPECT_THROW(VenueUnmarshaller::unmarshall(json, patch),
+               std::runtime_error);
+}
+
+TEST_F(HttpJsonVenueUnmarshaller, UnmarshallsSelfTradePrevention) {
+  constexpr std::string_view json{R"({"selfTradePrevention":"Decrement"})"};
+
+  VenueUnmarshaller::unmarshall(json, patch);
+  EXPECT_THAT(patch.self_trade_prevention(),
+              Optional(Eq(data_layer::Venue::SelfTradePrevention::Decrement)));
+}
+
 TEST_F(HttpJsonVenueUnmarshaller, UnmarshallsTimezone) {
   constexpr std::string_view json{R"({"timezone":"GMT"})"};
 
@@ -3,6 +3,7 @@
 #include <pistache/http_defs.h>
 
 #include <memory>
+#include <vector>
 
 #include "ih/redirect/destination.hpp"
 #include "ih/redirect/redirection_processor.hpp"
@@ -32,6 +33,17 @@ class HttpRedirectionProcessor : public testing::Test {
     return processor_->redirect_to_venue(venue_id, method, url);
   }
 
+  auto redirect(const std::vector<redirect::VenueRequest>& requests)
+      -> std::vector<redirect::Result> {
+    return processor_->redirect_to_venues(requests);
+  }
+
+  static auto make_venue_request(const std::string& venue_id)
+      -> redirect::VenueRequest {
+    return redirect::VenueRequest{
+        .venue_id = venue_id, .method = TestMethod, .url = TestEndpoint};
+  }
+
   static auto make_redirect_result(Pistache::Http::Code response_code,
                                    std::string body = "") -> redirect::Result {
     redirect::Result result{response_code};
@@ -245,5 +257,52 @@ TEST_F(HttpRedirectionProcessor, ReturnsOkOnSuccessfulRedirection) {
   ASSERT_EQ(result.body_content(), response_body);
 }
 
+TEST_F(HttpRedirectionProcessor, ReturnsVenuesResultsInRequestsOrder) {
+  EXPECT_CALL(resolver(), resolve_by_venue_id(Eq("LSE")))
+      .WillOnce(Return(mock::Resolver::make_output(
+          redirect::Destination{"localhost", 10001})));
+  EXPECT_CALL(resolver(), resolve_by_venue_id(Eq("XETRA")))
+      .WillOnce(Return(
+          mock::Resolver::make_output(ResolveStatus::NonexistentInstance)));
+  EXPECT_CALL(resolver(), resolve_by_venue_id(Eq("NYSE")))
+      .WillOnce(Return(mock::Resolver::make_output(
+          redirect::Destination{"localhost", 10002})));
+
+  EXPECT_CALL(redirector(),
+              redirect(Property(&redirect::Request::destination,
+                                Property(&redirect::Destination::port, 10001))))
+      .WillOnce(Return(mock::Redirector::make_output(
+          make_redirect_result(Pistache::Http::Code::Ok))));
+  EXPECT_CALL(redirector(),
+              redirect(Property(&redirect::Request::destination,
+                                Property(&redirect::Destination::port, 10002))))
+      .WillOnce(Return(
+          mock::Redirector::make_output(RedirectStatus::ConnectionFailed)));
+
+  const auto results = redirect({make_venue_request("LSE"),
+                                 make_venue_request("XETRA"),
+                                 make_venue_request("NYSE")});
+
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_EQ(results[0].http_code(), Pistache::Http::Code::Ok);
+  EXPECT_EQ(results[1].http_code(), Pistache::Http::Code::Bad_Gateway);
+  EXPECT_EQ(results[2].http_code(), Pistache::Http::Code::Bad_Gateway);
+}
+
+TEST_F(HttpRedirectionProcessor, DoesNotRedirectToUnresolvedVenues) {
+  EXPECT_CALL(resolver(), resolve_by_venue_id)
+      .Times(2)
+      .WillRepeatedly(
+          Return(mock::Resolver::make_output(ResolveStatus::ResolvingFailed)));
+  EXPECT_CALL(redirector(), redirect).Times(0);
+
+  const auto results =
+      redirect({make_venue_request("LSE"), make_venue_request("XETRA")});
+
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0].http_code(), Pistache::Http::Code::Bad_Gateway);
+  EXPECT_EQ(results[1].http_code(), Pistache::Http::Code::Bad_Gateway);
+}
+
 }  // namespace
 }  // namespace simulator::http::redirect::test
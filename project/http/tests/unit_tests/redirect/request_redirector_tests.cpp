@@ -2,6 +2,7 @@
 #include <pistache/http_defs.h>
 
 #include <cstdint>
+#include <vector>
 
 #include "cfg/api/cfg.hpp"
 #include "ih/redirect/destination.hpp"
@@ -27,6 +28,11 @@ class HttpRequestRedirector : public testing::Test {
     return request_redirector_->redirect(request);
   }
 
+  auto redirect_all(const std::vector<Request>& requests)
+      -> std::vector<Redirector::RedirectionResult> {
+    return request_redirector_->redirect_all(requests);
+  }
+
   static auto make_destination(std::uint16_t port) -> Destination {
     return Destination{"localhost", port};
   }
@@ -213,5 +219,35 @@ TEST_F(HttpRequestRedirector, RedirectsResponseBody) {
   ASSERT_EQ(response->body_content(), body);
 }
 
+TEST_F(HttpRequestRedirector, RedirectsSubsequentRequestsToSameDestination) {
+  server_responder().set_response_data(Pistache::Http::Code::Ok);
+
+  const auto request =
+      make_get_request(make_destination(server_port()), "/test/get/request");
+
+  ASSERT_EQ(redirect(request).second, RedirectStatus::Success);
+  auto [response, status] = redirect(request);
+
+  ASSERT_EQ(status, RedirectStatus::Success);
+  ASSERT_TRUE(response.has_value());
+  EXPECT_EQ(response->http_code(), Pistache::Http::Code::Ok);
+}
+
+TEST_F(HttpRequestRedirector, RedirectsAllRequestsInRequestsOrder) {
+  constexpr std::uint16_t invalid_port = 0;
+  server_responder().set_response_data(Pistache::Http::Code::Ok);
+
+  const auto results = redirect_all(
+      {make_get_request(make_destination(server_port()), "/test/get/request"),
+       make_get_request(make_destination(invalid_port), "/test/get/request"),
+       make_put_request(make_destination(server_port()),
+                        "/test/put/request")});
+
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_EQ(results[0].second, RedirectStatus::Success);
+  EXPECT_EQ(results[1].second, RedirectStatus::ConnectionFailed);
+  EXPECT_EQ(results[2].second, RedirectStatus::Success);
+}
+
 }  // namespace
 }  // namespace simulator::http::redirect::test
@@ -0,0 +1,83 @@
+#ifndef SIMULATOR_MDFEED_CLIENT_IH_FEED_CLIENT_HPP_
+#define SIMULATOR_MDFEED_CLIENT_IH_FEED_CLIENT_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "codec/messages.hpp"
+#include "ih/statistics.hpp"
+#include "transport/udp_socket.hpp"
+
+namespace simulator::mdfeed::client {
+
+struct ClientSettings {
+  std::string feed_address = "127.0.0.1";
+  std::uint16_t feed_port = 0;
+  std::string request_address = "127.0.0.1";
+  std::uint16_t request_port = 0;
+  std::vector<std::string> symbols;
+  bool include_trades = false;
+  std::chrono::seconds duration{10};
+};
+
+// Subscribes to listings and tracks stream sequence numbers.
+// Sequence gaps are filled with replayed refreshes, a stream is recovered
+// with a snapshot if replayed refreshes do not arrive.
+class FeedClient {
+ public:
+  explicit FeedClient(ClientSettings settings);
+
+  auto run() -> void;
+
+  [[nodiscard]]
+  auto statistics() noexcept -> FeedStatistics&;
+
+ private:
+  struct StreamState {
+    std::string symbol;
+    std::uint64_t expected_sequence = 0;
+    // Refreshes received ahead of the expected one, waiting for a replay
+    std::set<std::uint64_t> pending_sequences;
+    // Refreshes up to this one are either received or requested for a replay
+    std::uint64_t covered_sequence = 0;
+    bool synchronized = false;
+  };
+
+  auto subscribe() -> void;
+
+  auto process(const codec::Message& message) -> void;
+
+  auto process(const codec::IncrementalRefresh& refresh) -> void;
+
+  auto process(const codec::SnapshotRefresh& refresh) -> void;
+
+  auto process(const codec::SubscribeResponse& response) -> void;
+
+  auto handle_gap(std::uint32_t stream_id,
+                  StreamState& stream,
+                  std::uint64_t sequence) -> void;
+
+  static auto apply_pending(StreamState& stream) -> void;
+
+  auto request_snapshot(std::uint32_t stream_id) -> void;
+
+  auto request_replay(std::uint32_t stream_id,
+                      std::uint64_t first_sequence,
+                      std::uint64_t last_sequence) -> void;
+
+  auto send(const codec::Message& message) -> void;
+
+  ClientSettings settings_;
+  transport::UdpSocket feed_socket_;
+  transport::UdpSocket request_socket_;
+  std::unordered_map<std::uint32_t, StreamState> streams_;
+  FeedStatistics statistics_;
+};
+
+}  // namespace simulator::mdfeed::client
+
+#endif  // SIMULATOR_MDFEED_CLIENT_IH_FEED_CLIENT_HPP_
@@ -0,0 +1,47 @@
+#ifndef SIMULATOR_MDFEED_CLIENT_IH_STATISTICS_HPP_
+#define SIMULATOR_MDFEED_CLIENT_IH_STATISTICS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace simulator::mdfeed::client {
+
+// Collects one-way latency samples (sending time to receive time),
+// which are meaningful only when the feed and the client share a clock.
+class LatencyStatistics {
+ public:
+  auto record(std::chrono::nanoseconds latency) -> void;
+
+  [[nodiscard]]
+  auto count() const noexcept -> std::size_t;
+
+  // Returns a latency percentile in [0, 100] range, sorts samples lazily
+  [[nodiscard]]
+  auto percentile(double rank) -> std::chrono::nanoseconds;
+
+  [[nodiscard]]
+  auto max() -> std::chrono::nanoseconds;
+
+ private:
+  std::vector<std::int64_t> samples_;
+  bool sorted_{true};
+};
+
+struct FeedStatistics {
+  std::uint64_t datagrams = 0;
+  std::uint64_t bytes = 0;
+  std::uint64_t incremental_refreshes = 0;
+  std::uint64_t snapshot_refreshes = 0;
+  std::uint64_t entries = 0;
+  std::uint64_t gaps = 0;
+  std::uint64_t missed_messages = 0;
+  std::uint64_t replay_requests = 0;
+  std::uint64_t malformed_datagrams = 0;
+  LatencyStatistics latency;
+};
+
+}  // namespace simulator::mdfeed::client
+
+#endif  // SIMULATOR_MDFEED_CLIENT_IH_STATISTICS_HPP_
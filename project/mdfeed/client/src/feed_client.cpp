@@ -0,0 +1,206 @@
+#include "ih/feed_client.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "codec/codec.hpp"
+
+namespace simulator::mdfeed::client {
+namespace {
+
+constexpr auto PollingTimeout = std::chrono::milliseconds{100};
+
+// A stream waiting for more replayed refreshes is considered lost
+// and is recovered with a snapshot
+constexpr std::size_t MaxPendingRefreshes = 1024;
+
+auto now() -> std::int64_t {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+FeedClient::FeedClient(ClientSettings settings)
+    : settings_(std::move(settings)),
+      feed_socket_(transport::UdpSocket::open_receiver(settings_.feed_address,
+                                                       settings_.feed_port)),
+      request_socket_(transport::UdpSocket::open_sender(
+          settings_.request_address, settings_.request_port)) {}
+
+auto FeedClient::run() -> void {
+  subscribe();
+
+  std::vector<std::byte> buffer(codec::MaxDatagramSize);
+  const auto deadline = std::chrono::steady_clock::now() + settings_.duration;
+  while (std::chrono::steady_clock::now() < deadline) {
+    const auto received = feed_socket_.receive(buffer, PollingTimeout);
+    if (!received.has_value()) {
+      continue;
+    }
+
+    statistics_.datagrams++;
+    statistics_.bytes += *received;
+    const auto message = codec::decode(std::span{buffer}.first(*received));
+    if (message.has_value()) {
+      process(*message);
+    } else {
+      statistics_.malformed_datagrams++;
+    }
+  }
+}
+
+auto FeedClient::statistics() noexcept -> FeedStatistics& {
+  return statistics_;
+}
+
+auto FeedClient::subscribe() -> void {
+  for (const auto& symbol : settings_.symbols) {
+    send(codec::SubscribeRequest{.symbol = codec::make_symbol(symbol),
+                                 .include_trades = settings_.include_trades});
+  }
+}
+
+auto FeedClient::process(const codec::Message& message) -> void {
+  std::visit(
+      [this]<typename M>(const M& concrete) {
+        if constexpr (std::is_same_v<M, codec::IncrementalRefresh> ||
+                      std::is_same_v<M, codec::SnapshotRefresh> ||
+                      std::is_same_v<M, codec::SubscribeResponse>) {
+          process(concrete);
+        }
+      },
+      message);
+}
+
+auto FeedClient::process(const codec::IncrementalRefresh& refresh) -> void {
+  const auto iter = streams_.find(refresh.stream_id);
+  if (iter == streams_.end()) {
+    // A stream subscribed by another feed consumer
+    return;
+  }
+
+  statistics_.incremental_refreshes++;
+  statistics_.entries += refresh.entries.size();
+  statistics_.latency.record(
+      std::chrono::nanoseconds{now() - refresh.sending_time});
+
+  auto& stream = iter->second;
+  if (!stream.synchronized || refresh.sequence < stream.expected_sequence) {
+    // The stream awaits a snapshot or the refresh is already applied
+    return;
+  }
+  if (refresh.sequence > stream.expected_sequence) {
+    handle_gap(refresh.stream_id, stream, refresh.sequence);
+    return;
+  }
+  stream.expected_sequence++;
+  apply_pending(stream);
+}
+
+auto FeedClient::process(const codec::SnapshotRefresh& refresh) -> void {
+  const auto iter = streams_.find(refresh.stream_id);
+  if (iter == streams_.end()) {
+    return;
+  }
+
+  statistics_.snapshot_refreshes++;
+  statistics_.entries += refresh.entries.size();
+
+  auto& stream = iter->second;
+  if (refresh.fragment + 1 == refresh.fragments_count &&
+      (!stream.synchronized ||
+       refresh.last_sequence + 1 >= stream.expected_sequence)) {
+    stream.expected_sequence = refresh.last_sequence + 1;
+    stream.covered_sequence =
+        std::max(stream.covered_sequence, refresh.last_sequence);
+    stream.synchronized = true;
+    apply_pending(stream);
+  }
+}
+
+auto FeedClient::process(const codec::SubscribeResponse& response) -> void {
+  const auto symbol = std::string{codec::view(response.symbol)};
+  if (std::ranges::find(settings_.symbols, symbol) ==
+      settings_.symbols.end()) {
+    return;
+  }
+
+  if (response.status == codec::SubscribeStatus::Rejected) {
+    fmt::println("subscription on `{}' was rejected", symbol);
+    return;
+  }
+  if (streams_.try_emplace(response.stream_id, StreamState{.symbol = symbol})
+          .second) {
+    fmt::println(
+        "subscribed to `{}', stream id {}", symbol, response.stream_id);
+  }
+}
+
+auto FeedClient::handle_gap(std::uint32_t stream_id,
+                            StreamState& stream,
+                            std::uint64_t sequence) -> void {
+  stream.pending_sequences.insert(sequence);
+  if (stream.pending_sequences.size() > MaxPendingRefreshes) {
+    fmt::println("replay on `{}' stream has not arrived, requesting snapshot",
+                 stream.symbol);
+    stream.synchronized = false;
+    stream.pending_sequences.clear();
+    request_snapshot(stream_id);
+    return;
+  }
+
+  const auto first_missing =
+      std::max(stream.expected_sequence, stream.covered_sequence + 1);
+  if (first_missing >= sequence) {
+    // Missing refreshes are already requested
+    return;
+  }
+
+  statistics_.gaps++;
+  statistics_.missed_messages += sequence - first_missing;
+  fmt::println("gap detected on `{}' stream, expected {}, received {}",
+               stream.symbol,
+               first_missing,
+               sequence);
+  stream.covered_sequence = sequence;
+  request_replay(stream_id, first_missing, sequence - 1);
+}
+
+auto FeedClient::apply_pending(StreamState& stream) -> void {
+  auto& pending = stream.pending_sequences;
+  while (!pending.empty() && *pending.begin() <= stream.expected_sequence) {
+    if (*pending.begin() == stream.expected_sequence) {
+      stream.expected_sequence++;
+    }
+    pending.erase(pending.begin());
+  }
+}
+
+auto FeedClient::request_snapshot(std::uint32_t stream_id) -> void {
+  send(codec::SnapshotRequest{.stream_id = stream_id});
+}
+
+auto FeedClient::request_replay(std::uint32_t stream_id,
+                                std::uint64_t first_sequence,
+                                std::uint64_t last_sequence) -> void {
+  statistics_.replay_requests++;
+  send(codec::ReplayRequest{.stream_id = stream_id,
+                            .first_sequence = first_sequence,
+                            .last_sequence = last_sequence});
+}
+
+auto FeedClient::send(const codec::Message& message) -> void {
+  if (!request_socket_.send(codec::encode(message))) {
+    fmt::println("failed to send a request to the feed");
+  }
+}
+
+}  // namespace simulator::mdfeed::client
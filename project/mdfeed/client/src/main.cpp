@@ -0,0 +1,127 @@
+#include <fmt/format.h>
+
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "ih/feed_client.hpp"
+
+namespace simulator::mdfeed::client {
+namespace {
+
+constexpr std::string_view HelpMessage =
+    "usage: mdfeed_client [options] SYMBOL...\n"
+    "  --feed-address ADDRESS     feed address or multicast group "
+    "(127.0.0.1)\n"
+    "  --feed-port PORT           feed port (required)\n"
+    "  --request-address ADDRESS  feed request address (127.0.0.1)\n"
+    "  --request-port PORT        feed request port (required)\n"
+    "  --trades                   subscribe to trades\n"
+    "  --duration SECONDS         measurement duration (10)\n"
+    "  --help                     print help message and exit";
+
+template <typename T>
+auto parse_number(std::string_view value) -> T {
+  T number{};
+  const auto* const end = value.data() + value.size();
+  const auto [parsed_end, error] = std::from_chars(value.data(), end, number);
+  if (error != std::errc{} || parsed_end != end) {
+    throw std::runtime_error(fmt::format("invalid number '{}'", value));
+  }
+  return number;
+}
+
+auto parse_settings(int argc, const char** argv) -> ClientSettings {
+  ClientSettings settings;
+  for (int index = 1; index < argc; ++index) {
+    const std::string_view option = argv[index];
+    const auto value = [&]() -> std::string_view {
+      if (index + 1 >= argc) {
+        throw std::runtime_error(
+            fmt::format("'{}' option is given without a value", option));
+      }
+      return argv[++index];
+    };
+
+    if (option == "--help") {
+      fmt::println("{}", HelpMessage);
+      std::exit(EXIT_SUCCESS);
+    } else if (option == "--feed-address") {
+      settings.feed_address = value();
+    } else if (option == "--feed-port") {
+      settings.feed_port = parse_number<std::uint16_t>(value());
+    } else if (option == "--request-address") {
+      settings.request_address = value();
+    } else if (option == "--request-port") {
+      settings.request_port = parse_number<std::uint16_t>(value());
+    } else if (option == "--trades") {
+      settings.include_trades = true;
+    } else if (option == "--duration") {
+      settings.duration =
+          std::chrono::seconds{parse_number<std::uint32_t>(value())};
+    } else if (option.starts_with("--")) {
+      throw std::runtime_error(fmt::format("unknown option '{}'", option));
+    } else {
+      settings.symbols.emplace_back(option);
+    }
+  }
+
+  if (settings.feed_port == 0 || settings.request_port == 0) {
+    throw std::runtime_error("feed and request ports are required");
+  }
+  if (settings.symbols.empty()) {
+    throw std::runtime_error("at least one symbol is required");
+  }
+  return settings;
+}
+
+auto report(FeedStatistics& statistics, std::chrono::seconds duration)
+    -> void {
+  const auto seconds = static_cast<double>(duration.count());
+  auto& latency = statistics.latency;
+
+  fmt::println("datagrams:             {} ({:.0f}/s)",
+               statistics.datagrams,
+               static_cast<double>(statistics.datagrams) / seconds);
+  fmt::println("bytes:                 {} ({:.0f}/s)",
+               statistics.bytes,
+               static_cast<double>(statistics.bytes) / seconds);
+  fmt::println("entries:               {} ({:.0f}/s)",
+               statistics.entries,
+               static_cast<double>(statistics.entries) / seconds);
+  fmt::println("incremental refreshes: {}", statistics.incremental_refreshes);
+  fmt::println("snapshot refreshes:    {}", statistics.snapshot_refreshes);
+  fmt::println("sequence gaps:         {} ({} messages missed)",
+               statistics.gaps,
+               statistics.missed_messages);
+  fmt::println("replay requests:       {}", statistics.replay_requests);
+  fmt::println("malformed datagrams:   {}", statistics.malformed_datagrams);
+  fmt::println("latency (ns):          p50 {} p99 {} p99.9 {} max {}",
+               latency.percentile(50).count(),
+               latency.percentile(99).count(),
+               latency.percentile(99.9).count(),
+               latency.max().count());
+}
+
+}  // namespace
+}  // namespace simulator::mdfeed::client
+
+auto main(int argc, const char** argv) -> int {
+  using namespace simulator::mdfeed::client;
+
+  try {
+    const auto settings = parse_settings(argc, argv);
+    FeedClient client{settings};
+    client.run();
+    report(client.statistics(), settings.duration);
+  } catch (const std::exception& exception) {
+    fmt::println(stderr, "mdfeed client failed: {}", exception.what());
+    fmt::println(stderr, "{}", HelpMessage);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
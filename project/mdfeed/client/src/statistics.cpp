@@ -0,0 +1,36 @@
+#include "ih/statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace simulator::mdfeed::client {
+
+auto LatencyStatistics::record(std::chrono::nanoseconds latency) -> void {
+  samples_.push_back(latency.count());
+  sorted_ = false;
+}
+
+auto LatencyStatistics::count() const noexcept -> std::size_t {
+  return samples_.size();
+}
+
+auto LatencyStatistics::percentile(double rank) -> std::chrono::nanoseconds {
+  if (samples_.empty()) {
+    return std::chrono::nanoseconds::zero();
+  }
+  if (!sorted_) {
+    std::ranges::sort(samples_);
+    sorted_ = true;
+  }
+
+  const auto clamped = std::clamp(rank, 0.0, 100.0);
+  const auto index = static_cast<std::size_t>(
+      std::ceil(clamped / 100.0 * static_cast<double>(samples_.size())));
+  return std::chrono::nanoseconds{samples_[std::max<std::size_t>(index, 1) - 1]};
+}
+
+auto LatencyStatistics::max() -> std::chrono::nanoseconds {
+  return percentile(100.0);
+}
+
+}  // namespace simulator::mdfeed::client
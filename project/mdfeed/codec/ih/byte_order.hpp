@@ -0,0 +1,99 @@
+#ifndef SIMULATOR_MDFEED_CODEC_IH_BYTE_ORDER_HPP_
+#define SIMULATOR_MDFEED_CODEC_IH_BYTE_ORDER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace simulator::mdfeed::codec {
+
+// Writes fixed-size little-endian fields into a growing byte buffer.
+class Writer {
+ public:
+  explicit Writer(std::vector<std::byte>& buffer) noexcept : buffer_(buffer) {}
+
+  template <std::integral T>
+  auto put(T value) -> void {
+    if constexpr (std::endian::native == std::endian::big) {
+      value = byteswap(value);
+    }
+    const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+    buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+  }
+
+  template <typename E>
+    requires std::is_enum_v<E>
+  auto put(E value) -> void {
+    put(static_cast<std::underlying_type_t<E>>(value));
+  }
+
+  auto put(std::span<const char> chars) -> void {
+    const auto* bytes = reinterpret_cast<const std::byte*>(chars.data());
+    buffer_.insert(buffer_.end(), bytes, bytes + chars.size());
+  }
+
+  auto pad(std::size_t count) -> void {
+    buffer_.insert(buffer_.end(), count, std::byte{0});
+  }
+
+ private:
+  template <std::integral T>
+  static auto byteswap(T value) noexcept -> T {
+    auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+    std::reverse(bytes.begin(), bytes.end());
+    return std::bit_cast<T>(bytes);
+  }
+
+  std::vector<std::byte>& buffer_;
+};
+
+// Reads fixed-size little-endian fields from a byte span,
+// the caller is responsible for checking the remaining size.
+class Reader {
+ public:
+  explicit Reader(std::span<const std::byte> buffer) noexcept
+      : buffer_(buffer) {}
+
+  [[nodiscard]]
+  auto remaining() const noexcept -> std::size_t {
+    return buffer_.size() - offset_;
+  }
+
+  template <std::integral T>
+  auto get() noexcept -> T {
+    std::array<std::byte, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), buffer_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    if constexpr (std::endian::native == std::endian::big) {
+      std::reverse(bytes.begin(), bytes.end());
+    }
+    return std::bit_cast<T>(bytes);
+  }
+
+  template <typename E>
+    requires std::is_enum_v<E>
+  auto get() noexcept -> E {
+    return static_cast<E>(get<std::underlying_type_t<E>>());
+  }
+
+  auto get(std::span<char> chars) noexcept -> void {
+    std::memcpy(chars.data(), buffer_.data() + offset_, chars.size());
+    offset_ += chars.size();
+  }
+
+  auto skip(std::size_t count) noexcept -> void { offset_ += count; }
+
+ private:
+  std::span<const std::byte> buffer_;
+  std::size_t offset_{0};
+};
+
+}  // namespace simulator::mdfeed::codec
+
+#endif  // SIMULATOR_MDFEED_CODEC_IH_BYTE_ORDER_HPP_
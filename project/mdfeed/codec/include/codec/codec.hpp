@@ -0,0 +1,36 @@
+#ifndef SIMULATOR_MDFEED_CODEC_CODEC_HPP_
+#define SIMULATOR_MDFEED_CODEC_CODEC_HPP_
+
+#include <cstddef>
+#include <span>
+#include <tl/expected.hpp>
+#include <vector>
+
+#include "codec/messages.hpp"
+
+namespace simulator::mdfeed::codec {
+
+enum class DecodingError {
+  BufferTooShort,
+  UnknownSchema,
+  UnknownTemplate,
+  MalformedBlock
+};
+
+// Appends an encoded message to the buffer,
+// the buffer is not cleared to allow its reuse between messages.
+auto encode(const Message& message, std::vector<std::byte>& buffer) -> void;
+
+[[nodiscard]]
+auto encode(const Message& message) -> std::vector<std::byte>;
+
+[[nodiscard]]
+auto decode(std::span<const std::byte> buffer)
+    -> tl::expected<Message, DecodingError>;
+
+[[nodiscard]]
+auto describe(DecodingError error) -> const char*;
+
+}  // namespace simulator::mdfeed::codec
+
+#endif  // SIMULATOR_MDFEED_CODEC_CODEC_HPP_
@@ -0,0 +1,206 @@
+#ifndef SIMULATOR_MDFEED_CODEC_MESSAGES_HPP_
+#define SIMULATOR_MDFEED_CODEC_MESSAGES_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace simulator::mdfeed::codec {
+
+// The binary feed follows SBE conventions: every message starts with
+// a fixed message header, fields are little-endian and have fixed offsets,
+// repeating groups are prefixed with a group dimension (block length, count).
+
+constexpr std::uint16_t SchemaId = 1;
+constexpr std::uint16_t SchemaVersion = 1;
+
+// Decimal fields are transmitted as mantissas with a constant exponent
+constexpr std::int32_t DecimalExponent = -9;
+
+// Null value for optional integer fields (SBE int64 null value)
+constexpr std::int64_t NullInt64 = std::numeric_limits<std::int64_t>::min();
+
+constexpr std::size_t SymbolLength = 32;
+constexpr std::size_t EntryIdLength = 48;
+
+// Largest payload which fits into a single UDP datagram
+constexpr std::size_t MaxDatagramSize = 65507;
+
+enum class TemplateId : std::uint16_t {
+  IncrementalRefresh = 1,
+  SnapshotRefresh = 2,
+  SubscribeRequest = 3,
+  SubscribeResponse = 4,
+  SnapshotRequest = 5,
+  ReplayRequest = 6
+};
+
+enum class EntryType : std::uint8_t {
+  Bid,
+  Offer,
+  Trade,
+  LowPrice,
+  MidPrice,
+  HighPrice
+};
+
+enum class EntryAction : std::uint8_t { New, Change, Delete, None };
+
+enum class AggressorSide : std::uint8_t { None, Buy, Sell };
+
+enum class SubscribeStatus : std::uint8_t { Accepted, Rejected };
+
+using Symbol = std::array<char, SymbolLength>;
+using EntryId = std::array<char, EntryIdLength>;
+
+struct MessageHeader {
+  std::uint16_t block_length = 0;
+  std::uint16_t template_id = 0;
+  std::uint16_t schema_id = SchemaId;
+  std::uint16_t version = SchemaVersion;
+
+  constexpr static std::size_t encoded_length = 8;
+};
+
+struct GroupDimension {
+  std::uint16_t block_length = 0;
+  std::uint16_t num_in_group = 0;
+
+  constexpr static std::size_t encoded_length = 4;
+};
+
+struct Entry {
+  EntryType type = EntryType::Bid;
+  EntryAction action = EntryAction::None;
+  AggressorSide aggressor_side = AggressorSide::None;
+  std::int64_t price = NullInt64;
+  std::int64_t quantity = NullInt64;
+  std::int64_t time = NullInt64;  // nanoseconds since UNIX epoch
+  EntryId id{};
+
+  constexpr static std::size_t encoded_length = 80;
+
+  [[nodiscard]]
+  auto operator==(const Entry&) const -> bool = default;
+};
+
+// Publishes changes of a listing market data, each message of a stream
+// carries the next stream sequence number.
+struct IncrementalRefresh {
+  std::uint32_t stream_id = 0;
+  std::uint64_t sequence = 0;
+  std::int64_t sending_time = 0;
+  std::vector<Entry> entries;
+
+  constexpr static std::size_t block_length = 24;
+
+  [[nodiscard]]
+  auto operator==(const IncrementalRefresh&) const -> bool = default;
+};
+
+// Publishes a full state of a listing market data, which corresponds to the
+// stream state after an incremental refresh with the last_sequence number.
+// Large snapshots are split into several fragments.
+struct SnapshotRefresh {
+  std::uint32_t stream_id = 0;
+  std::uint16_t fragment = 0;
+  std::uint16_t fragments_count = 1;
+  std::uint64_t last_sequence = 0;
+  std::int64_t sending_time = 0;
+  std::vector<Entry> entries;
+
+  constexpr static std::size_t block_length = 24;
+
+  [[nodiscard]]
+  auto operator==(const SnapshotRefresh&) const -> bool = default;
+};
+
+// Asks the feed to start streaming a listing, identified by a symbol.
+struct SubscribeRequest {
+  Symbol symbol{};
+  bool include_trades = false;
+
+  constexpr static std::size_t block_length = 40;
+
+  [[nodiscard]]
+  auto operator==(const SubscribeRequest&) const -> bool = default;
+};
+
+// Assigns a stream to a listing (or rejects the subscription).
+struct SubscribeResponse {
+  std::uint32_t stream_id = 0;
+  SubscribeStatus status = SubscribeStatus::Accepted;
+  Symbol symbol{};
+
+  constexpr static std::size_t block_length = 40;
+
+  [[nodiscard]]
+  auto operator==(const SubscribeResponse&) const -> bool = default;
+};
+
+// Asks the feed to publish a snapshot refresh for a stream,
+// used to recover after a sequence gap is detected.
+struct SnapshotRequest {
+  std::uint32_t stream_id = 0;
+
+  constexpr static std::size_t block_length = 8;
+
+  [[nodiscard]]
+  auto operator==(const SnapshotRequest&) const -> bool = default;
+};
+
+// Asks the feed to publish again incremental refreshes of a stream with
+// sequence numbers from first_sequence to last_sequence (inclusive).
+// Used to fill a small sequence gap, the feed publishes a snapshot refresh
+// instead if the range is no longer kept by the feed.
+struct ReplayRequest {
+  std::uint32_t stream_id = 0;
+  std::uint64_t first_sequence = 0;
+  std::uint64_t last_sequence = 0;
+
+  constexpr static std::size_t block_length = 24;
+
+  [[nodiscard]]
+  auto operator==(const ReplayRequest&) const -> bool = default;
+};
+
+using Message = std::variant<IncrementalRefresh,
+                             SnapshotRefresh,
+                             SubscribeRequest,
+                             SubscribeResponse,
+                             SnapshotRequest,
+                             ReplayRequest>;
+
+// Maximal number of entries, which fit into a single refresh datagram
+constexpr std::size_t MaxEntriesPerMessage =
+    (MaxDatagramSize - MessageHeader::encoded_length -
+     IncrementalRefresh::block_length - GroupDimension::encoded_length) /
+    Entry::encoded_length;
+
+[[nodiscard]]
+auto to_decimal(std::int64_t mantissa) -> double;
+
+[[nodiscard]]
+auto to_mantissa(double decimal) -> std::int64_t;
+
+[[nodiscard]]
+auto make_symbol(std::string_view symbol) -> Symbol;
+
+[[nodiscard]]
+auto make_entry_id(std::string_view identifier) -> EntryId;
+
+// Returns a view of a null-padded fixed length string field
+[[nodiscard]]
+auto view(const Symbol& symbol) -> std::string_view;
+
+[[nodiscard]]
+auto view(const EntryId& identifier) -> std::string_view;
+
+}  // namespace simulator::mdfeed::codec
+
+#endif  // SIMULATOR_MDFEED_CODEC_MESSAGES_HPP_
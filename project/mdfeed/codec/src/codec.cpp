@@ -0,0 +1,259 @@
+#include "codec/codec.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "ih/byte_order.hpp"
+
+namespace simulator::mdfeed::codec {
+namespace {
+
+template <typename M>
+constexpr auto template_of() noexcept -> TemplateId {
+  if constexpr (std::is_same_v<M, IncrementalRefresh>) {
+    return TemplateId::IncrementalRefresh;
+  } else if constexpr (std::is_same_v<M, SnapshotRefresh>) {
+    return TemplateId::SnapshotRefresh;
+  } else if constexpr (std::is_same_v<M, SubscribeRequest>) {
+    return TemplateId::SubscribeRequest;
+  } else if constexpr (std::is_same_v<M, SubscribeResponse>) {
+    return TemplateId::SubscribeResponse;
+  } else if constexpr (std::is_same_v<M, SnapshotRequest>) {
+    return TemplateId::SnapshotRequest;
+  } else {
+    static_assert(std::is_same_v<M, ReplayRequest>);
+    return TemplateId::ReplayRequest;
+  }
+}
+
+template <typename M>
+auto encode_header(Writer& writer) -> void {
+  writer.put(static_cast<std::uint16_t>(M::block_length));
+  writer.put(template_of<M>());
+  writer.put(SchemaId);
+  writer.put(SchemaVersion);
+}
+
+auto encode_entries(Writer& writer, const std::vector<Entry>& entries)
+    -> void {
+  writer.put(static_cast<std::uint16_t>(Entry::encoded_length));
+  writer.put(static_cast<std::uint16_t>(entries.size()));
+  for (const auto& entry : entries) {
+    writer.put(entry.type);
+    writer.put(entry.action);
+    writer.put(entry.aggressor_side);
+    writer.pad(5);
+    writer.put(entry.price);
+    writer.put(entry.quantity);
+    writer.put(entry.time);
+    writer.put(entry.id);
+  }
+}
+
+auto encode_block(Writer& writer, const IncrementalRefresh& message) -> void {
+  writer.put(message.stream_id);
+  writer.pad(4);
+  writer.put(message.sequence);
+  writer.put(message.sending_time);
+  encode_entries(writer, message.entries);
+}
+
+auto encode_block(Writer& writer, const SnapshotRefresh& message) -> void {
+  writer.put(message.stream_id);
+  writer.put(message.fragment);
+  writer.put(message.fragments_count);
+  writer.put(message.last_sequence);
+  writer.put(message.sending_time);
+  encode_entries(writer, message.entries);
+}
+
+auto encode_block(Writer& writer, const SubscribeRequest& message) -> void {
+  writer.put(message.symbol);
+  writer.put(static_cast<std::uint8_t>(message.include_trades ? 1 : 0));
+  writer.pad(7);
+}
+
+auto encode_block(Writer& writer, const SubscribeResponse& message) -> void {
+  writer.put(message.stream_id);
+  writer.put(message.status);
+  writer.pad(3);
+  writer.put(message.symbol);
+}
+
+auto encode_block(Writer& writer, const SnapshotRequest& message) -> void {
+  writer.put(message.stream_id);
+  writer.pad(4);
+}
+
+auto encode_block(Writer& writer, const ReplayRequest& message) -> void {
+  writer.put(message.stream_id);
+  writer.pad(4);
+  writer.put(message.first_sequence);
+  writer.put(message.last_sequence);
+}
+
+auto decode_entries(Reader& reader)
+    -> tl::expected<std::vector<Entry>, DecodingError> {
+  if (reader.remaining() < GroupDimension::encoded_length) {
+    return tl::unexpected(DecodingError::BufferTooShort);
+  }
+
+  GroupDimension dimension;
+  dimension.block_length = reader.get<std::uint16_t>();
+  dimension.num_in_group = reader.get<std::uint16_t>();
+  if (dimension.block_length < Entry::encoded_length) {
+    return tl::unexpected(DecodingError::MalformedBlock);
+  }
+  if (reader.remaining() <
+      std::size_t{dimension.block_length} * dimension.num_in_group) {
+    return tl::unexpected(DecodingError::BufferTooShort);
+  }
+
+  std::vector<Entry> entries(dimension.num_in_group);
+  for (auto& entry : entries) {
+    entry.type = reader.get<EntryType>();
+    entry.action = reader.get<EntryAction>();
+    entry.aggressor_side = reader.get<AggressorSide>();
+    reader.skip(5);
+    entry.price = reader.get<std::int64_t>();
+    entry.quantity = reader.get<std::int64_t>();
+    entry.time = reader.get<std::int64_t>();
+    reader.get(entry.id);
+    // Fields appended by newer schema versions are skipped
+    reader.skip(dimension.block_length - Entry::encoded_length);
+  }
+  return entries;
+}
+
+auto decode_block(Reader& reader, IncrementalRefresh& message) -> void {
+  message.stream_id = reader.get<std::uint32_t>();
+  reader.skip(4);
+  message.sequence = reader.get<std::uint64_t>();
+  message.sending_time = reader.get<std::int64_t>();
+}
+
+auto decode_block(Reader& reader, SnapshotRefresh& message) -> void {
+  message.stream_id = reader.get<std::uint32_t>();
+  message.fragment = reader.get<std::uint16_t>();
+  message.fragments_count = reader.get<std::uint16_t>();
+  message.last_sequence = reader.get<std::uint64_t>();
+  message.sending_time = reader.get<std::int64_t>();
+}
+
+auto decode_block(Reader& reader, SubscribeRequest& message) -> void {
+  reader.get(message.symbol);
+  message.include_trades = reader.get<std::uint8_t>() != 0;
+  reader.skip(7);
+}
+
+auto decode_block(Reader& reader, SubscribeResponse& message) -> void {
+  message.stream_id = reader.get<std::uint32_t>();
+  message.status = reader.get<SubscribeStatus>();
+  reader.skip(3);
+  reader.get(message.symbol);
+}
+
+auto decode_block(Reader& reader, SnapshotRequest& message) -> void {
+  message.stream_id = reader.get<std::uint32_t>();
+  reader.skip(4);
+}
+
+auto decode_block(Reader& reader, ReplayRequest& message) -> void {
+  message.stream_id = reader.get<std::uint32_t>();
+  reader.skip(4);
+  message.first_sequence = reader.get<std::uint64_t>();
+  message.last_sequence = reader.get<std::uint64_t>();
+}
+
+template <typename M>
+auto decode_message(Reader& reader, std::uint16_t block_length)
+    -> tl::expected<Message, DecodingError> {
+  if (block_length < M::block_length) {
+    return tl::unexpected(DecodingError::MalformedBlock);
+  }
+  if (reader.remaining() < block_length) {
+    return tl::unexpected(DecodingError::BufferTooShort);
+  }
+
+  M message;
+  decode_block(reader, message);
+  reader.skip(block_length - M::block_length);
+
+  if constexpr (std::is_same_v<M, IncrementalRefresh> ||
+                std::is_same_v<M, SnapshotRefresh>) {
+    auto entries = decode_entries(reader);
+    if (!entries.has_value()) {
+      return tl::unexpected(entries.error());
+    }
+    message.entries = std::move(*entries);
+  }
+  return message;
+}
+
+}  // namespace
+
+auto encode(const Message& message, std::vector<std::byte>& buffer) -> void {
+  Writer writer{buffer};
+  std::visit(
+      [&writer]<typename M>(const M& concrete) {
+        encode_header<M>(writer);
+        encode_block(writer, concrete);
+      },
+      message);
+}
+
+auto encode(const Message& message) -> std::vector<std::byte> {
+  std::vector<std::byte> buffer;
+  encode(message, buffer);
+  return buffer;
+}
+
+auto decode(std::span<const std::byte> buffer)
+    -> tl::expected<Message, DecodingError> {
+  Reader reader{buffer};
+  if (reader.remaining() < MessageHeader::encoded_length) {
+    return tl::unexpected(DecodingError::BufferTooShort);
+  }
+
+  MessageHeader header;
+  header.block_length = reader.get<std::uint16_t>();
+  header.template_id = reader.get<std::uint16_t>();
+  header.schema_id = reader.get<std::uint16_t>();
+  header.version = reader.get<std::uint16_t>();
+  if (header.schema_id != SchemaId) {
+    return tl::unexpected(DecodingError::UnknownSchema);
+  }
+
+  switch (static_cast<TemplateId>(header.template_id)) {
+    case TemplateId::IncrementalRefresh:
+      return decode_message<IncrementalRefresh>(reader, header.block_length);
+    case TemplateId::SnapshotRefresh:
+      return decode_message<SnapshotRefresh>(reader, header.block_length);
+    case TemplateId::SubscribeRequest:
+      return decode_message<SubscribeRequest>(reader, header.block_length);
+    case TemplateId::SubscribeResponse:
+      return decode_message<SubscribeResponse>(reader, header.block_length);
+    case TemplateId::SnapshotRequest:
+      return decode_message<SnapshotRequest>(reader, header.block_length);
+    case TemplateId::ReplayRequest:
+      return decode_message<ReplayRequest>(reader, header.block_length);
+  }
+  return tl::unexpected(DecodingError::UnknownTemplate);
+}
+
+auto describe(DecodingError error) -> const char* {
+  switch (error) {
+    case DecodingError::BufferTooShort:
+      return "buffer is shorter than the encoded message";
+    case DecodingError::UnknownSchema:
+      return "message belongs to an unknown schema";
+    case DecodingError::UnknownTemplate:
+      return "message has an unknown template identifier";
+    case DecodingError::MalformedBlock:
+      return "message block length is malformed";
+  }
+  return "unknown decoding error";
+}
+
+}  // namespace simulator::mdfeed::codec
@@ -0,0 +1,53 @@
+#include "codec/messages.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace simulator::mdfeed::codec {
+namespace {
+
+constexpr double DecimalScale = 1e9;
+
+static_assert(DecimalExponent == -9,
+              "DecimalScale must correspond to the DecimalExponent");
+
+template <std::size_t N>
+auto make_fixed_string(std::string_view value) -> std::array<char, N> {
+  std::array<char, N> fixed{};
+  std::copy_n(value.begin(), std::min(value.size(), N), fixed.begin());
+  return fixed;
+}
+
+template <std::size_t N>
+auto view_fixed_string(const std::array<char, N>& fixed) -> std::string_view {
+  const auto end = std::find(fixed.begin(), fixed.end(), '\0');
+  return {fixed.data(), static_cast<std::size_t>(end - fixed.begin())};
+}
+
+}  // namespace
+
+auto to_decimal(std::int64_t mantissa) -> double {
+  return static_cast<double>(mantissa) / DecimalScale;
+}
+
+auto to_mantissa(double decimal) -> std::int64_t {
+  return std::llround(decimal * DecimalScale);
+}
+
+auto make_symbol(std::string_view symbol) -> Symbol {
+  return make_fixed_string<SymbolLength>(symbol);
+}
+
+auto make_entry_id(std::string_view identifier) -> EntryId {
+  return make_fixed_string<EntryIdLength>(identifier);
+}
+
+auto view(const Symbol& symbol) -> std::string_view {
+  return view_fixed_string(symbol);
+}
+
+auto view(const EntryId& identifier) -> std::string_view {
+  return view_fixed_string(identifier);
+}
+
+}  // namespace simulator::mdfeed::codec
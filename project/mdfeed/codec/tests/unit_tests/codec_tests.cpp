@@ -0,0 +1,169 @@
+#include <gmock/gmock.h>
+
+#include <cstdint>
+
+#include "codec/codec.hpp"
+
+namespace simulator::mdfeed::codec::test {
+namespace {
+
+using namespace ::testing;
+
+auto make_entry() -> Entry {
+  Entry entry;
+  entry.type = EntryType::Trade;
+  entry.action = EntryAction::New;
+  entry.aggressor_side = AggressorSide::Sell;
+  entry.price = to_mantissa(101.25);
+  entry.quantity = to_mantissa(300);
+  entry.time = 1'700'000'000'123'456'000;
+  entry.id = make_entry_id("1700000000:42");
+  return entry;
+}
+
+template <typename M>
+auto round_trip(const M& message) -> M {
+  const auto buffer = encode(message);
+  const auto decoded = decode(buffer);
+  EXPECT_TRUE(decoded.has_value());
+  EXPECT_TRUE(std::holds_alternative<M>(*decoded));
+  return std::get<M>(*decoded);
+}
+
+TEST(MdfeedCodec, EncodesMessageHeader) {
+  const auto buffer = encode(SnapshotRequest{.stream_id = 7});
+
+  ASSERT_EQ(buffer.size(),
+            MessageHeader::encoded_length + SnapshotRequest::block_length);
+  // block length, template id, schema id and version are little-endian
+  EXPECT_EQ(buffer[0], std::byte{8});
+  EXPECT_EQ(buffer[1], std::byte{0});
+  EXPECT_EQ(buffer[2], std::byte{5});
+  EXPECT_EQ(buffer[4], std::byte{1});
+  EXPECT_EQ(buffer[6], std::byte{1});
+  EXPECT_EQ(buffer[8], std::byte{7});
+}
+
+TEST(MdfeedCodec, EncodesEntriesWithFixedLength) {
+  IncrementalRefresh message;
+  message.entries = {make_entry(), make_entry(), make_entry()};
+
+  const auto buffer = encode(message);
+
+  EXPECT_EQ(buffer.size(),
+            MessageHeader::encoded_length + IncrementalRefresh::block_length +
+                GroupDimension::encoded_length + 3 * Entry::encoded_length);
+}
+
+TEST(MdfeedCodec, AppendsToExistingBuffer) {
+  std::vector<std::byte> buffer(3, std::byte{0xFF});
+
+  encode(SnapshotRequest{.stream_id = 1}, buffer);
+
+  EXPECT_EQ(buffer.size(),
+            3 + MessageHeader::encoded_length + SnapshotRequest::block_length);
+}
+
+TEST(MdfeedCodec, RoundTripsIncrementalRefresh) {
+  IncrementalRefresh message;
+  message.stream_id = 3;
+  message.sequence = 123'456;
+  message.sending_time = 1'700'000'000'000'000'000;
+  message.entries = {make_entry(), Entry{}};
+
+  EXPECT_EQ(round_trip(message), message);
+}
+
+TEST(MdfeedCodec, RoundTripsSnapshotRefresh) {
+  SnapshotRefresh message;
+  message.stream_id = 3;
+  message.fragment = 1;
+  message.fragments_count = 2;
+  message.last_sequence = 99;
+  message.sending_time = 42;
+  message.entries = {make_entry()};
+
+  EXPECT_EQ(round_trip(message), message);
+}
+
+TEST(MdfeedCodec, RoundTripsSubscribeRequest) {
+  const SubscribeRequest message{.symbol = make_symbol("AAPL"),
+                                 .include_trades = true};
+
+  EXPECT_EQ(round_trip(message), message);
+}
+
+TEST(MdfeedCodec, RoundTripsSubscribeResponse) {
+  const SubscribeResponse message{.stream_id = 12,
+                                  .status = SubscribeStatus::Rejected,
+                                  .symbol = make_symbol("MSFT")};
+
+  EXPECT_EQ(round_trip(message), message);
+}
+
+TEST(MdfeedCodec, RoundTripsSnapshotRequest) {
+  const SnapshotRequest message{.stream_id = 4};
+
+  EXPECT_EQ(round_trip(message), message);
+}
+
+TEST(MdfeedCodec, RoundTripsReplayRequest) {
+  const ReplayRequest message{
+      .stream_id = 4, .first_sequence = 10, .last_sequence = 12};
+
+  EXPECT_EQ(round_trip(message), message);
+}
+
+TEST(MdfeedCodec, ReportsTruncatedHeader) {
+  const std::vector<std::byte> buffer(MessageHeader::encoded_length - 1);
+
+  EXPECT_THAT(decode(buffer),
+              Eq(tl::unexpected(DecodingError::BufferTooShort)));
+}
+
+TEST(MdfeedCodec, ReportsTruncatedEntries) {
+  IncrementalRefresh message;
+  message.entries = {make_entry()};
+  auto buffer = encode(message);
+  buffer.pop_back();
+
+  EXPECT_THAT(decode(buffer),
+              Eq(tl::unexpected(DecodingError::BufferTooShort)));
+}
+
+TEST(MdfeedCodec, ReportsUnknownSchema) {
+  auto buffer = encode(SnapshotRequest{});
+  buffer[4] = std::byte{2};
+
+  EXPECT_THAT(decode(buffer), Eq(tl::unexpected(DecodingError::UnknownSchema)));
+}
+
+TEST(MdfeedCodec, ReportsUnknownTemplate) {
+  auto buffer = encode(SnapshotRequest{});
+  buffer[2] = std::byte{42};
+
+  EXPECT_THAT(decode(buffer),
+              Eq(tl::unexpected(DecodingError::UnknownTemplate)));
+}
+
+TEST(MdfeedCodec, ReportsTooShortBlockLength) {
+  auto buffer = encode(SnapshotRequest{});
+  buffer[0] = std::byte{4};
+
+  EXPECT_THAT(decode(buffer),
+              Eq(tl::unexpected(DecodingError::MalformedBlock)));
+}
+
+TEST(MdfeedCodec, SkipsBlockExtensionOfNewerVersion) {
+  auto buffer = encode(SnapshotRequest{.stream_id = 5});
+  buffer[0] = std::byte{12};
+  buffer.insert(buffer.end(), 4, std::byte{0xAB});
+
+  const auto decoded = decode(buffer);
+
+  ASSERT_TRUE(decoded.has_value());
+  EXPECT_EQ(std::get<SnapshotRequest>(*decoded).stream_id, 5U);
+}
+
+}  // namespace
+}  // namespace simulator::mdfeed::codec::test
@@ -0,0 +1,46 @@
+#include <gmock/gmock.h>
+
+#include "codec/messages.hpp"
+
+namespace simulator::mdfeed::codec::test {
+namespace {
+
+using namespace ::testing;
+
+TEST(MdfeedMessages, ConvertsDecimalToMantissa) {
+  EXPECT_EQ(to_mantissa(1.5), 1'500'000'000);
+  EXPECT_EQ(to_mantissa(-0.000000001), -1);
+}
+
+TEST(MdfeedMessages, ConvertsMantissaToDecimal) {
+  EXPECT_DOUBLE_EQ(to_decimal(1'500'000'000), 1.5);
+}
+
+TEST(MdfeedMessages, PadsSymbolWithNulls) {
+  const auto symbol = make_symbol("AAPL");
+
+  EXPECT_EQ(view(symbol), "AAPL");
+  EXPECT_EQ(symbol[4], '\0');
+  EXPECT_EQ(symbol.back(), '\0');
+}
+
+TEST(MdfeedMessages, TruncatesLongSymbol) {
+  const std::string long_symbol(SymbolLength + 5, 'X');
+
+  EXPECT_EQ(view(make_symbol(long_symbol)),
+            long_symbol.substr(0, SymbolLength));
+}
+
+TEST(MdfeedMessages, ViewsEntryIdentifier) {
+  EXPECT_EQ(view(make_entry_id("seed:1")), "seed:1");
+}
+
+TEST(MdfeedMessages, FitsMaximalMessageIntoDatagram) {
+  EXPECT_LE(MessageHeader::encoded_length + SnapshotRefresh::block_length +
+                GroupDimension::encoded_length +
+                MaxEntriesPerMessage * Entry::encoded_length,
+            MaxDatagramSize);
+}
+
+}  // namespace
+}  // namespace simulator::mdfeed::codec::test
@@ -0,0 +1,23 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_IH_ENCODING_ENTRY_CONVERSION_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_IH_ENCODING_ENTRY_CONVERSION_HPP_
+
+#include <optional>
+#include <vector>
+
+#include "codec/messages.hpp"
+#include "core/domain/market_data_entry.hpp"
+
+namespace simulator::mdfeed::publisher {
+
+// Converts a market data entry into its binary feed representation,
+// entries without a market data entry type can not be published.
+[[nodiscard]]
+auto convert(const MarketDataEntry& entry) -> std::optional<codec::Entry>;
+
+[[nodiscard]]
+auto convert(const std::vector<MarketDataEntry>& entries)
+    -> std::vector<codec::Entry>;
+
+}  // namespace simulator::mdfeed::publisher
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_IH_ENCODING_ENTRY_CONVERSION_HPP_
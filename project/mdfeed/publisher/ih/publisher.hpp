@@ -0,0 +1,77 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_IH_PUBLISHER_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_IH_PUBLISHER_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "codec/messages.hpp"
+#include "ih/replay_buffer.hpp"
+#include "ih/stream_registry.hpp"
+#include "protocol/app/market_data_reject.hpp"
+#include "protocol/app/market_data_snapshot.hpp"
+#include "protocol/app/market_data_update.hpp"
+#include "publisher/publisher.hpp"
+#include "publisher/settings.hpp"
+#include "transport/udp_socket.hpp"
+
+namespace simulator::mdfeed {
+
+// Publishes market data replies of the trading system onto the feed socket
+// and turns feed requests into market data requests to the trading system.
+//
+// Replies are delivered by trading system threads, while requests are
+// received by a dedicated thread. Replies of a single listing are produced
+// sequentially by its matching engine, so incremental refreshes and
+// snapshots of a stream are published in the order they were produced.
+struct Publisher::Implementation {
+  explicit Implementation(const PublisherSettings& settings);
+  Implementation(const Implementation&) = delete;
+  Implementation(Implementation&&) = delete;
+  ~Implementation() noexcept;
+
+  auto operator=(const Implementation&) -> Implementation& = delete;
+  auto operator=(Implementation&&) -> Implementation& = delete;
+
+  auto start() -> void;
+
+  auto stop() noexcept -> void;
+
+  auto publish(const protocol::MarketDataSnapshot& snapshot) -> void;
+
+  auto publish(const protocol::MarketDataUpdate& update) -> void;
+
+  auto publish(const protocol::MarketDataReject& reject) -> void;
+
+ private:
+  auto receive_requests(const std::stop_token& stop_token) -> void;
+
+  auto process(const codec::SubscribeRequest& request) -> void;
+
+  auto process(const codec::SnapshotRequest& request) -> void;
+
+  auto process(const codec::ReplayRequest& request) -> void;
+
+  auto request_snapshot(const publisher::Stream& stream) -> void;
+
+  auto publish_response(std::uint32_t stream_id,
+                        const std::string& symbol,
+                        codec::SubscribeStatus status) -> void;
+
+  auto publish_snapshot(std::uint32_t stream_id,
+                        std::vector<codec::Entry> entries) -> void;
+
+  auto send(const codec::Message& message) -> void;
+
+  publisher::StreamRegistry streams_;
+  publisher::ReplayBuffer replay_buffer_;
+  transport::UdpSocket feed_socket_;
+  transport::UdpSocket request_socket_;
+  std::unique_ptr<std::jthread> receiver_;
+};
+
+}  // namespace simulator::mdfeed
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_IH_PUBLISHER_HPP_
@@ -0,0 +1,63 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_IH_REPLAY_BUFFER_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_IH_REPLAY_BUFFER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace simulator::mdfeed::publisher {
+
+// Keeps the most recent encoded incremental refreshes of every stream,
+// which allows the feed to publish a small range of refreshes again
+// instead of a full snapshot when a consumer detects a sequence gap.
+//
+// Refreshes are stored by trading system threads and replayed by the
+// request receiving thread, so all operations are synchronized.
+class ReplayBuffer {
+ public:
+  using Datagram = std::vector<std::byte>;
+
+  // Depth is a maximal number of refreshes kept per stream,
+  // refreshes are not kept at all if depth is 0.
+  explicit ReplayBuffer(std::size_t depth);
+
+  [[nodiscard]]
+  auto depth() const noexcept -> std::size_t;
+
+  // Stores an encoded refresh, sequence numbers of a stream refreshes
+  // are expected to be stored in the increasing order without gaps.
+  auto store(std::uint32_t stream_id,
+             std::uint64_t sequence,
+             std::span<const std::byte> datagram) -> void;
+
+  // Returns encoded refreshes with sequence numbers from first_sequence to
+  // last_sequence (inclusive), nullopt if any of them is not kept.
+  [[nodiscard]]
+  auto collect(std::uint32_t stream_id,
+               std::uint64_t first_sequence,
+               std::uint64_t last_sequence) const
+      -> std::optional<std::vector<Datagram>>;
+
+  auto remove(std::uint32_t stream_id) -> void;
+
+ private:
+  // A refresh with a sequence number N is kept in the (N % depth) slot,
+  // slot buffers are reused by newer refreshes.
+  struct StreamRing {
+    std::vector<Datagram> slots;
+    std::uint64_t oldest_sequence = 0;
+    std::uint64_t newest_sequence = 0;
+  };
+
+  std::unordered_map<std::uint32_t, StreamRing> rings_;
+  std::size_t depth_;
+  mutable std::mutex mutex_;
+};
+
+}  // namespace simulator::mdfeed::publisher
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_IH_REPLAY_BUFFER_HPP_
@@ -0,0 +1,80 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_IH_STREAM_REGISTRY_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_IH_STREAM_REGISTRY_HPP_
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace simulator::mdfeed::publisher {
+
+// A stream carries market data of a single listing. Every incremental
+// refresh of a stream increments its sequence number, a snapshot refresh
+// reports the sequence number of the last incremental refresh it includes.
+struct Stream {
+  std::uint32_t id = 0;
+  std::string symbol;
+  bool include_trades = false;
+  // Set once the trading system has accepted the stream subscription
+  bool active = false;
+  std::uint64_t sequence = 0;
+};
+
+// Keeps streams of all listings published by the feed.
+// Streams are shared by all feed consumers, thus a stream is created
+// for the first subscription on a listing and reused by later ones.
+// The registry is accessed both from the request receiving thread and
+// from trading system threads, so all operations are synchronized.
+class StreamRegistry {
+ public:
+  struct Registration {
+    Stream stream;
+    bool created = false;
+  };
+
+  auto register_stream(std::string_view symbol, bool include_trades)
+      -> Registration;
+
+  // Marks the stream subscription as accepted,
+  // returns true if the stream has not been active before.
+  auto activate(std::uint32_t stream_id) -> bool;
+
+  auto remove(std::uint32_t stream_id) -> std::optional<Stream>;
+
+  [[nodiscard]]
+  auto find(std::uint32_t stream_id) const -> std::optional<Stream>;
+
+  // Assigns a next sequence number to an incremental refresh of
+  // an active stream, returns nullopt if the stream is unknown or inactive.
+  auto next_sequence(std::uint32_t stream_id) -> std::optional<std::uint64_t>;
+
+  // Returns the sequence number of the last published incremental refresh
+  [[nodiscard]]
+  auto last_sequence(std::uint32_t stream_id) const
+      -> std::optional<std::uint64_t>;
+
+ private:
+  std::unordered_map<std::uint32_t, Stream> streams_;
+  std::unordered_map<std::string, std::uint32_t> stream_ids_;
+  std::uint32_t last_stream_id_{0};
+  mutable std::mutex mutex_;
+};
+
+// Market data requests sent on behalf of the feed carry a stream id
+// in their request ids, which allows to route replies back to streams.
+
+[[nodiscard]]
+auto make_subscription_request_id(std::uint32_t stream_id) -> std::string;
+
+[[nodiscard]]
+auto make_snapshot_request_id(std::uint32_t stream_id) -> std::string;
+
+[[nodiscard]]
+auto parse_stream_id(std::string_view request_id)
+    -> std::optional<std::uint32_t>;
+
+}  // namespace simulator::mdfeed::publisher
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_IH_STREAM_REGISTRY_HPP_
@@ -0,0 +1,18 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_LIFETIME_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_LIFETIME_HPP_
+
+#include "publisher/publisher.hpp"
+#include "publisher/settings.hpp"
+
+namespace simulator::mdfeed {
+
+[[nodiscard]]
+auto create_publisher(const PublisherSettings& settings) -> Publisher;
+
+auto start_publisher(Publisher& publisher) -> void;
+
+auto stop_publisher(Publisher& publisher) noexcept -> void;
+
+}  // namespace simulator::mdfeed
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_LIFETIME_HPP_
@@ -0,0 +1,27 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_PUBLISHER_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_PUBLISHER_HPP_
+
+#include <memory>
+
+namespace simulator::mdfeed {
+
+struct Publisher {
+  struct Implementation;
+
+  explicit Publisher(std::unique_ptr<Implementation> impl) noexcept;
+  Publisher(const Publisher&) = delete;
+  Publisher(Publisher&&) noexcept;
+  ~Publisher() noexcept;
+
+  auto operator=(const Publisher&) -> Publisher& = delete;
+  auto operator=(Publisher&&) noexcept -> Publisher&;
+
+  auto implementation() noexcept -> Implementation&;
+
+ private:
+  std::unique_ptr<Implementation> impl_;
+};
+
+}  // namespace simulator::mdfeed
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_PUBLISHER_HPP_
@@ -0,0 +1,25 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_SETTINGS_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_SETTINGS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace simulator::mdfeed {
+
+struct PublisherSettings {
+  // Destination of the feed datagrams, may be a multicast group address
+  std::string feed_address = "127.0.0.1";
+  std::uint16_t feed_port = 0;
+
+  // Local port on which subscribe, snapshot and replay requests are received
+  std::uint16_t request_port = 0;
+
+  // Number of the most recent incremental refreshes kept per stream
+  // for replay requests, replays are disabled if set to 0
+  std::size_t replay_depth = 256;
+};
+
+}  // namespace simulator::mdfeed
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_SETTINGS_HPP_
@@ -0,0 +1,22 @@
+#ifndef SIMULATOR_MDFEED_PUBLISHER_TRANSPORT_HPP_
+#define SIMULATOR_MDFEED_PUBLISHER_TRANSPORT_HPP_
+
+#include "protocol/app/market_data_reject.hpp"
+#include "protocol/app/market_data_snapshot.hpp"
+#include "protocol/app/market_data_update.hpp"
+#include "publisher/publisher.hpp"
+
+namespace simulator::mdfeed {
+
+auto accept_reply(const protocol::MarketDataReject& reply,
+                  Publisher& publisher) noexcept -> void;
+
+auto accept_reply(const protocol::MarketDataSnapshot& reply,
+                  Publisher& publisher) noexcept -> void;
+
+auto accept_reply(const protocol::MarketDataUpdate& reply,
+                  Publisher& publisher) noexcept -> void;
+
+}  // namespace simulator::mdfeed
+
+#endif  // SIMULATOR_MDFEED_PUBLISHER_TRANSPORT_HPP_
@@ -0,0 +1,99 @@
+#include "ih/encoding/entry_conversion.hpp"
+
+#include <chrono>
+
+namespace simulator::mdfeed::publisher {
+namespace {
+
+auto convert_type(MdEntryType type) -> codec::EntryType {
+  switch (type.value()) {
+    case MdEntryType::Option::Bid:
+      return codec::EntryType::Bid;
+    case MdEntryType::Option::Offer:
+      return codec::EntryType::Offer;
+    case MdEntryType::Option::Trade:
+      return codec::EntryType::Trade;
+    case MdEntryType::Option::LowPrice:
+      return codec::EntryType::LowPrice;
+    case MdEntryType::Option::MidPrice:
+      return codec::EntryType::MidPrice;
+    case MdEntryType::Option::HighPrice:
+      return codec::EntryType::HighPrice;
+  }
+  return codec::EntryType::Bid;
+}
+
+auto convert_action(const std::optional<MarketEntryAction>& action)
+    -> codec::EntryAction {
+  if (!action.has_value()) {
+    return codec::EntryAction::None;
+  }
+  switch (action->value()) {
+    case MarketEntryAction::Option::New:
+      return codec::EntryAction::New;
+    case MarketEntryAction::Option::Change:
+      return codec::EntryAction::Change;
+    case MarketEntryAction::Option::Delete:
+      return codec::EntryAction::Delete;
+  }
+  return codec::EntryAction::None;
+}
+
+auto convert_aggressor(const std::optional<AggressorSide>& side)
+    -> codec::AggressorSide {
+  if (!side.has_value()) {
+    return codec::AggressorSide::None;
+  }
+  return side->value() == Side::Option::Buy ? codec::AggressorSide::Buy
+                                            : codec::AggressorSide::Sell;
+}
+
+template <typename Attribute>
+auto convert_decimal(const std::optional<Attribute>& attribute)
+    -> std::int64_t {
+  return attribute.has_value() ? codec::to_mantissa(attribute->value())
+                               : codec::NullInt64;
+}
+
+auto convert_time(const std::optional<MarketEntryTime>& time) -> std::int64_t {
+  if (!time.has_value()) {
+    return codec::NullInt64;
+  }
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time->value().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+auto convert(const MarketDataEntry& entry) -> std::optional<codec::Entry> {
+  if (!entry.type.has_value()) {
+    return std::nullopt;
+  }
+
+  codec::Entry converted;
+  converted.type = convert_type(*entry.type);
+  converted.action = convert_action(entry.action);
+  converted.aggressor_side = convert_aggressor(entry.aggressor_side);
+  converted.price = convert_decimal(entry.price);
+  converted.quantity = convert_decimal(entry.quantity);
+  converted.time = convert_time(entry.time);
+  if (entry.id.has_value()) {
+    converted.id = codec::make_entry_id(entry.id->value());
+  }
+  return converted;
+}
+
+auto convert(const std::vector<MarketDataEntry>& entries)
+    -> std::vector<codec::Entry> {
+  std::vector<codec::Entry> converted;
+  converted.reserve(entries.size());
+  for (const auto& entry : entries) {
+    if (auto binary_entry = convert(entry)) {
+      converted.push_back(*binary_entry);
+    }
+  }
+  return converted;
+}
+
+}  // namespace simulator::mdfeed::publisher
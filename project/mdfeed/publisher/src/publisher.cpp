@@ -0,0 +1,452 @@
+#include "ih/publisher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include "codec/codec.hpp"
+#include "core/tools/overload.hpp"
+#include "ih/encoding/entry_conversion.hpp"
+#include "log/logging.hpp"
+#include "middleware/routing/errors.hpp"
+#include "middleware/routing/trading_request_channel.hpp"
+#include "protocol/app/market_data_request.hpp"
+#include "publisher/lifetime.hpp"
+#include "publisher/transport.hpp"
+
+namespace simulator::mdfeed {
+namespace {
+
+constexpr auto RequestPollingTimeout = std::chrono::milliseconds{100};
+
+// Replies are encoded on trading system threads, each thread reuses its buffer
+thread_local std::vector<std::byte> encoding_buffer;
+
+auto now() -> std::int64_t {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+auto get_stream_id(const std::optional<MdRequestId>& request_id)
+    -> std::optional<std::uint32_t> {
+  if (!request_id.has_value()) {
+    return std::nullopt;
+  }
+  return publisher::parse_stream_id(request_id->value());
+}
+
+auto make_market_data_request(const publisher::Stream& stream,
+                              MdSubscriptionRequestType request_type,
+                              std::string request_id)
+    -> protocol::MarketDataRequest {
+  protocol::MarketDataRequest request{
+      protocol::Session{protocol::mdfeed::Session{}}};
+  request.request_id = MdRequestId{std::move(request_id)};
+  request.request_type = request_type;
+  request.update_type = MarketDataUpdateType::Option::Incremental;
+  request.instruments.emplace_back().symbol = Symbol{stream.symbol};
+  request.market_data_types = {MdEntryType::Option::Bid,
+                               MdEntryType::Option::Offer};
+  if (stream.include_trades) {
+    request.market_data_types.emplace_back(MdEntryType::Option::Trade);
+  }
+  return request;
+}
+
+auto send_request(protocol::MarketDataRequest request) -> void {
+  try {
+    middleware::send_trading_request(std::move(request));
+  } catch (const middleware::ChannelUnboundError&) {
+    log::err(
+        "failed to send market data request on behalf of the market data "
+        "feed - trading request channel is not bound");
+  }
+}
+
+auto create_publisher_implementation(const PublisherSettings& settings)
+    -> std::unique_ptr<Publisher::Implementation> {
+  try {
+    return std::make_unique<Publisher::Implementation>(settings);
+  } catch (const std::exception& exception) {
+    log::err(
+        "failed to create a market data feed publisher, an error occurred: {}",
+        exception.what());
+  } catch (...) {
+    log::err(
+        "failed to create a market data feed publisher, unknown error "
+        "occurred");
+  }
+  throw std::runtime_error("failed to create market data feed publisher");
+}
+
+template <typename Message>
+auto accept_reply_message(const Message& reply_message,
+                          Publisher::Implementation& publisher) noexcept
+    -> void {
+  try {
+    publisher.publish(reply_message);
+  } catch (const std::exception& exception) {
+    log::err(
+        "failed to publish reply message on market data feed, "
+        "an error occurred: {}, unpublished message - {}",
+        exception.what(),
+        reply_message);
+  } catch (...) {
+    log::err(
+        "failed to publish reply message on market data feed, "
+        "unknown error occurred, unpublished message - {}",
+        reply_message);
+  }
+}
+
+}  // namespace
+
+Publisher::Publisher(std::unique_ptr<Implementation> impl) noexcept
+    : impl_(std::move(impl)) {}
+
+Publisher::Publisher(Publisher&&) noexcept = default;
+
+Publisher::~Publisher() noexcept = default;
+
+auto Publisher::operator=(Publisher&&) noexcept -> Publisher& = default;
+
+auto Publisher::implementation() noexcept -> Implementation& {
+  if (impl_) [[likely]] {
+    return *impl_;
+  }
+
+  log::err(
+      "market data feed publisher implementation has not been "
+      "allocated/initialized, this may indicate a critical bug in the "
+      "component, can not continue execution, aborting...");
+
+  std::abort();
+}
+
+Publisher::Implementation::Implementation(const PublisherSettings& settings)
+    : replay_buffer_(settings.replay_depth),
+      feed_socket_(transport::UdpSocket::open_sender(settings.feed_address,
+                                                     settings.feed_port)),
+      request_socket_(transport::UdpSocket::open_receiver(
+          "0.0.0.0", settings.request_port)) {}
+
+Publisher::Implementation::~Implementation() noexcept { stop(); }
+
+auto Publisher::Implementation::start() -> void {
+  if (receiver_) [[unlikely]] {
+    log::warn("market data feed publisher is already started");
+    return;
+  }
+
+  receiver_ = std::make_unique<std::jthread>(
+      [this](std::stop_token stop) { receive_requests(stop); });
+}
+
+auto Publisher::Implementation::stop() noexcept -> void {
+  // The jthread destructor requests a stop and joins the receiving thread
+  receiver_.reset();
+}
+
+auto Publisher::Implementation::publish(
+    const protocol::MarketDataSnapshot& snapshot) -> void {
+  const auto stream_id = get_stream_id(snapshot.request_id);
+  if (!stream_id.has_value()) {
+    log::warn("market data feed received a snapshot of an unknown stream: {}",
+              snapshot);
+    return;
+  }
+
+  // The first snapshot of a stream confirms its subscription
+  if (streams_.activate(*stream_id)) {
+    const auto stream = streams_.find(*stream_id);
+    publish_response(*stream_id,
+                     stream ? stream->symbol : std::string{},
+                     codec::SubscribeStatus::Accepted);
+  }
+  publish_snapshot(*stream_id,
+                   publisher::convert(snapshot.market_data_entries));
+}
+
+auto Publisher::Implementation::publish(
+    const protocol::MarketDataUpdate& update) -> void {
+  const auto stream_id = get_stream_id(update.request_id);
+  if (!stream_id.has_value()) {
+    log::warn("market data feed received an update of an unknown stream: {}",
+              update);
+    return;
+  }
+
+  const auto entries = publisher::convert(update.market_data_entries);
+  for (std::size_t offset = 0; offset < entries.size();
+       offset += codec::MaxEntriesPerMessage) {
+    const auto sequence = streams_.next_sequence(*stream_id);
+    if (!sequence.has_value()) {
+      log::debug("dropping update of an inactive market data feed stream {}",
+                 *stream_id);
+      return;
+    }
+
+    const auto count =
+        std::min(codec::MaxEntriesPerMessage, entries.size() - offset);
+    codec::IncrementalRefresh refresh;
+    refresh.stream_id = *stream_id;
+    refresh.sequence = *sequence;
+    refresh.sending_time = now();
+    refresh.entries.assign(entries.begin() + offset,
+                           entries.begin() + offset + count);
+    send(refresh);
+    replay_buffer_.store(*stream_id, *sequence, encoding_buffer);
+  }
+}
+
+auto Publisher::Implementation::publish(
+    const protocol::MarketDataReject& reject) -> void {
+  const auto stream_id = get_stream_id(reject.request_id);
+  if (!stream_id.has_value()) {
+    log::warn("market data feed received a reject of an unknown stream: {}",
+              reject);
+    return;
+  }
+
+  const auto stream = streams_.find(*stream_id);
+  if (stream.has_value() && !stream->active) {
+    log::warn("market data feed subscription on `{}' was rejected: {}",
+              stream->symbol,
+              reject);
+    streams_.remove(*stream_id);
+    replay_buffer_.remove(*stream_id);
+    publish_response(
+        *stream_id, stream->symbol, codec::SubscribeStatus::Rejected);
+    return;
+  }
+
+  log::warn("market data feed request for stream {} was rejected: {}",
+            *stream_id,
+            reject);
+}
+
+auto Publisher::Implementation::receive_requests(
+    const std::stop_token& stop_token) -> void {
+  log::debug("market data feed request receiving thread started");
+
+  std::vector<std::byte> buffer(codec::MaxDatagramSize);
+  while (!stop_token.stop_requested()) {
+    const auto received =
+        request_socket_.receive(buffer, RequestPollingTimeout);
+    if (!received.has_value()) {
+      continue;
+    }
+
+    const auto message = codec::decode(std::span{buffer}.first(*received));
+    if (!message.has_value()) {
+      log::warn("market data feed received a malformed request: {}",
+                codec::describe(message.error()));
+      continue;
+    }
+
+    try {
+      std::visit(core::overload(
+                     [this](const codec::SubscribeRequest& request) {
+                       process(request);
+                     },
+                     [this](const codec::SnapshotRequest& request) {
+                       process(request);
+                     },
+                     [this](const codec::ReplayRequest& request) {
+                       process(request);
+                     },
+                     [](const auto& /*message*/) {
+                       log::warn(
+                           "market data feed received an unexpected "
+                           "message on the request channel, ignoring it");
+                     }),
+                 *message);
+    } catch (const std::exception& exception) {
+      log::err("failed to process market data feed request: {}",
+               exception.what());
+    }
+  }
+
+  log::debug("market data feed request receiving thread stopped");
+}
+
+auto Publisher::Implementation::process(const codec::SubscribeRequest& request)
+    -> void {
+  const auto symbol = codec::view(request.symbol);
+  if (symbol.empty()) {
+    log::warn("market data feed received a subscription without a symbol");
+    publish_response(0, std::string{}, codec::SubscribeStatus::Rejected);
+    return;
+  }
+
+  const auto registration =
+      streams_.register_stream(symbol, request.include_trades);
+  const auto& stream = registration.stream;
+  if (registration.created) {
+    log::debug("subscribing market data feed stream {} on `{}'",
+               stream.id,
+               stream.symbol);
+    send_request(make_market_data_request(
+        stream,
+        MdSubscriptionRequestType::Option::Subscribe,
+        publisher::make_subscription_request_id(stream.id)));
+  } else if (stream.active) {
+    // A late subscriber joins a live stream and needs a snapshot to sync
+    publish_response(
+        stream.id, stream.symbol, codec::SubscribeStatus::Accepted);
+    request_snapshot(stream);
+  }
+}
+
+auto Publisher::Implementation::process(const codec::SnapshotRequest& request)
+    -> void {
+  const auto stream = streams_.find(request.stream_id);
+  if (!stream.has_value() || !stream->active) {
+    log::warn("market data feed received a snapshot request of an unknown "
+              "stream {}",
+              request.stream_id);
+    return;
+  }
+  request_snapshot(*stream);
+}
+
+auto Publisher::Implementation::process(const codec::ReplayRequest& request)
+    -> void {
+  const auto stream = streams_.find(request.stream_id);
+  if (!stream.has_value() || !stream->active) {
+    log::warn("market data feed received a replay request of an unknown "
+              "stream {}",
+              request.stream_id);
+    return;
+  }
+
+  const auto datagrams = replay_buffer_.collect(
+      request.stream_id, request.first_sequence, request.last_sequence);
+  if (!datagrams.has_value()) {
+    // The range is not kept anymore (or is malformed),
+    // the consumer is recovered with a snapshot instead
+    log::debug(
+        "refreshes {}-{} of market data feed stream {} can not be replayed, "
+        "requesting a snapshot",
+        request.first_sequence,
+        request.last_sequence,
+        request.stream_id);
+    request_snapshot(*stream);
+    return;
+  }
+
+  for (const auto& datagram : *datagrams) {
+    if (!feed_socket_.send(datagram)) {
+      log::warn("failed to send a replayed market data feed datagram of {} "
+                "bytes",
+                datagram.size());
+    }
+  }
+}
+
+auto Publisher::Implementation::request_snapshot(
+    const publisher::Stream& stream) -> void {
+  send_request(
+      make_market_data_request(stream,
+                               MdSubscriptionRequestType::Option::Snapshot,
+                               publisher::make_snapshot_request_id(stream.id)));
+}
+
+auto Publisher::Implementation::publish_response(
+    std::uint32_t stream_id,
+    const std::string& symbol,
+    codec::SubscribeStatus status) -> void {
+  send(codec::SubscribeResponse{.stream_id = stream_id,
+                                .status = status,
+                                .symbol = codec::make_symbol(symbol)});
+}
+
+auto Publisher::Implementation::publish_snapshot(
+    std::uint32_t stream_id, std::vector<codec::Entry> entries) -> void {
+  // The snapshot includes all incremental refreshes published so far,
+  // as both are produced sequentially by the listing matching engine
+  const auto last_sequence = streams_.last_sequence(stream_id).value_or(0);
+  const auto fragments_count = std::max<std::size_t>(
+      1,
+      (entries.size() + codec::MaxEntriesPerMessage - 1) /
+          codec::MaxEntriesPerMessage);
+
+  codec::SnapshotRefresh refresh;
+  refresh.stream_id = stream_id;
+  refresh.fragments_count = static_cast<std::uint16_t>(fragments_count);
+  refresh.last_sequence = last_sequence;
+  refresh.sending_time = now();
+  for (std::size_t fragment = 0; fragment < fragments_count; ++fragment) {
+    const auto offset = fragment * codec::MaxEntriesPerMessage;
+    const auto count =
+        std::min(codec::MaxEntriesPerMessage, entries.size() - offset);
+    refresh.fragment = static_cast<std::uint16_t>(fragment);
+    refresh.entries.assign(entries.begin() + offset,
+                           entries.begin() + offset + count);
+    send(refresh);
+  }
+}
+
+auto Publisher::Implementation::send(const codec::Message& message) -> void {
+  encoding_buffer.clear();
+  codec::encode(message, encoding_buffer);
+  if (!feed_socket_.send(encoding_buffer)) {
+    log::warn("failed to send a market data feed datagram of {} bytes",
+              encoding_buffer.size());
+  }
+}
+
+auto create_publisher(const PublisherSettings& settings) -> Publisher {
+  log::debug("creating a market data feed publisher instance");
+
+  Publisher publisher{create_publisher_implementation(settings)};
+
+  log::info(
+      "created a market data feed publisher instance, publishing to {}:{}, "
+      "receiving requests on port {}, keeping {} refreshes per stream for "
+      "replays",
+      settings.feed_address,
+      settings.feed_port,
+      settings.request_port,
+      settings.replay_depth);
+
+  return publisher;
+}
+
+auto start_publisher(Publisher& publisher) -> void {
+  log::debug("starting market data feed publisher");
+
+  publisher.implementation().start();
+
+  log::info("started market data feed publisher");
+}
+
+auto stop_publisher(Publisher& publisher) noexcept -> void {
+  log::debug("stopping market data feed publisher");
+
+  publisher.implementation().stop();
+
+  log::info("stopped market data feed publisher");
+}
+
+auto accept_reply(const protocol::MarketDataReject& reply,
+                  Publisher& publisher) noexcept -> void {
+  accept_reply_message(reply, publisher.implementation());
+}
+
+auto accept_reply(const protocol::MarketDataSnapshot& reply,
+                  Publisher& publisher) noexcept -> void {
+  accept_reply_message(reply, publisher.implementation());
+}
+
+auto accept_reply(const protocol::MarketDataUpdate& reply,
+                  Publisher& publisher) noexcept -> void {
+  accept_reply_message(reply, publisher.implementation());
+}
+
+}  // namespace simulator::mdfeed
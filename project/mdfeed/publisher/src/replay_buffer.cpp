@@ -0,0 +1,65 @@
+#include "ih/replay_buffer.hpp"
+
+namespace simulator::mdfeed::publisher {
+
+ReplayBuffer::ReplayBuffer(std::size_t depth) : depth_(depth) {}
+
+auto ReplayBuffer::depth() const noexcept -> std::size_t { return depth_; }
+
+auto ReplayBuffer::store(std::uint32_t stream_id,
+                         std::uint64_t sequence,
+                         std::span<const std::byte> datagram) -> void {
+  if (depth_ == 0) {
+    return;
+  }
+
+  std::lock_guard lock{mutex_};
+
+  auto& ring = rings_[stream_id];
+  if (ring.slots.empty()) {
+    ring.slots.resize(depth_);
+  }
+
+  if (ring.newest_sequence == 0 || sequence != ring.newest_sequence + 1) {
+    // The first refresh of a stream, or the stream sequence was restarted
+    ring.oldest_sequence = sequence;
+  } else if (sequence - ring.oldest_sequence >= depth_) {
+    ring.oldest_sequence = sequence - depth_ + 1;
+  }
+  ring.newest_sequence = sequence;
+
+  auto& slot = ring.slots[sequence % depth_];
+  slot.assign(datagram.begin(), datagram.end());
+}
+
+auto ReplayBuffer::collect(std::uint32_t stream_id,
+                           std::uint64_t first_sequence,
+                           std::uint64_t last_sequence) const
+    -> std::optional<std::vector<Datagram>> {
+  std::lock_guard lock{mutex_};
+
+  const auto iter = rings_.find(stream_id);
+  if (iter == rings_.end() || first_sequence > last_sequence) {
+    return std::nullopt;
+  }
+
+  const auto& ring = iter->second;
+  if (ring.newest_sequence == 0 || first_sequence < ring.oldest_sequence ||
+      last_sequence > ring.newest_sequence) {
+    return std::nullopt;
+  }
+
+  std::vector<Datagram> datagrams;
+  datagrams.reserve(last_sequence - first_sequence + 1);
+  for (auto sequence = first_sequence; sequence <= last_sequence; ++sequence) {
+    datagrams.push_back(ring.slots[sequence % depth_]);
+  }
+  return datagrams;
+}
+
+auto ReplayBuffer::remove(std::uint32_t stream_id) -> void {
+  std::lock_guard lock{mutex_};
+  rings_.erase(stream_id);
+}
+
+}  // namespace simulator::mdfeed::publisher
@@ -0,0 +1,120 @@
+#include "ih/stream_registry.hpp"
+
+#include <charconv>
+#include <system_error>
+
+namespace simulator::mdfeed::publisher {
+namespace {
+
+constexpr std::string_view RequestIdPrefix = "mdfeed:";
+constexpr std::string_view SnapshotRequestIdSuffix = ":snapshot";
+
+}  // namespace
+
+auto StreamRegistry::register_stream(std::string_view symbol,
+                                     bool include_trades) -> Registration {
+  std::lock_guard lock{mutex_};
+
+  std::string key{symbol};
+  if (const auto iter = stream_ids_.find(key); iter != stream_ids_.end()) {
+    return Registration{.stream = streams_.at(iter->second), .created = false};
+  }
+
+  const auto stream_id = ++last_stream_id_;
+  Stream stream{.id = stream_id,
+                .symbol = key,
+                .include_trades = include_trades,
+                .active = false,
+                .sequence = 0};
+  stream_ids_.emplace(std::move(key), stream_id);
+  streams_.emplace(stream_id, stream);
+  return Registration{.stream = std::move(stream), .created = true};
+}
+
+auto StreamRegistry::activate(std::uint32_t stream_id) -> bool {
+  std::lock_guard lock{mutex_};
+
+  const auto iter = streams_.find(stream_id);
+  if (iter == streams_.end() || iter->second.active) {
+    return false;
+  }
+  iter->second.active = true;
+  return true;
+}
+
+auto StreamRegistry::remove(std::uint32_t stream_id) -> std::optional<Stream> {
+  std::lock_guard lock{mutex_};
+
+  const auto iter = streams_.find(stream_id);
+  if (iter == streams_.end()) {
+    return std::nullopt;
+  }
+  auto stream = std::move(iter->second);
+  streams_.erase(iter);
+  stream_ids_.erase(stream.symbol);
+  return stream;
+}
+
+auto StreamRegistry::find(std::uint32_t stream_id) const
+    -> std::optional<Stream> {
+  std::lock_guard lock{mutex_};
+
+  const auto iter = streams_.find(stream_id);
+  if (iter == streams_.end()) {
+    return std::nullopt;
+  }
+  return iter->second;
+}
+
+auto StreamRegistry::next_sequence(std::uint32_t stream_id)
+    -> std::optional<std::uint64_t> {
+  std::lock_guard lock{mutex_};
+
+  const auto iter = streams_.find(stream_id);
+  if (iter == streams_.end() || !iter->second.active) {
+    return std::nullopt;
+  }
+  return ++iter->second.sequence;
+}
+
+auto StreamRegistry::last_sequence(std::uint32_t stream_id) const
+    -> std::optional<std::uint64_t> {
+  std::lock_guard lock{mutex_};
+
+  const auto iter = streams_.find(stream_id);
+  if (iter == streams_.end()) {
+    return std::nullopt;
+  }
+  return iter->second.sequence;
+}
+
+auto make_subscription_request_id(std::uint32_t stream_id) -> std::string {
+  return std::string{RequestIdPrefix} + std::to_string(stream_id);
+}
+
+auto make_snapshot_request_id(std::uint32_t stream_id) -> std::string {
+  return make_subscription_request_id(stream_id) +
+         std::string{SnapshotRequestIdSuffix};
+}
+
+auto parse_stream_id(std::string_view request_id)
+    -> std::optional<std::uint32_t> {
+  if (!request_id.starts_with(RequestIdPrefix)) {
+    return std::nullopt;
+  }
+  request_id.remove_prefix(RequestIdPrefix.size());
+  if (request_id.ends_with(SnapshotRequestIdSuffix)) {
+    request_id.remove_suffix(SnapshotRequestIdSuffix.size());
+  }
+
+  std::uint32_t stream_id = 0;
+  const auto* const end = request_id.data() + request_id.size();
+  const auto [parsed_end, error] =
+      std::from_chars(request_id.data(), end, stream_id);
+  if (error != std::errc{} || parsed_end != end || request_id.empty()) {
+    return std::nullopt;
+  }
+  return stream_id;
+}
+
+}  // namespace simulator::mdfeed::publisher
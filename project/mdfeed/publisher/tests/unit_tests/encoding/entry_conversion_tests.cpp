@@ -0,0 +1,92 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+
+#include "ih/encoding/entry_conversion.hpp"
+
+namespace simulator::mdfeed::publisher::test {
+namespace {
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+struct MdfeedEntryConversion : public Test {
+  MarketDataEntry entry;
+
+  auto SetUp() -> void override { entry.type = MdEntryType::Option::Bid; }
+};
+
+TEST_F(MdfeedEntryConversion, SkipsEntryWithoutType) {
+  entry.type = std::nullopt;
+
+  EXPECT_EQ(convert(entry), std::nullopt);
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsType) {
+  entry.type = MdEntryType::Option::Trade;
+
+  EXPECT_THAT(convert(entry),
+              Optional(Field(&codec::Entry::type, codec::EntryType::Trade)));
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsAction) {
+  entry.action = MarketEntryAction::Option::Delete;
+
+  EXPECT_THAT(
+      convert(entry),
+      Optional(Field(&codec::Entry::action, codec::EntryAction::Delete)));
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsMissingAction) {
+  EXPECT_THAT(convert(entry),
+              Optional(Field(&codec::Entry::action, codec::EntryAction::None)));
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsSellShortAggressorSideToSell) {
+  entry.aggressor_side = AggressorSide{Side::Option::SellShort};
+
+  EXPECT_THAT(convert(entry),
+              Optional(Field(&codec::Entry::aggressor_side,
+                             codec::AggressorSide::Sell)));
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsPriceAndQuantityToMantissas) {
+  entry.price = Price{12.5};
+  entry.quantity = Quantity{100};
+
+  const auto converted = convert(entry);
+
+  ASSERT_TRUE(converted.has_value());
+  EXPECT_EQ(converted->price, 12'500'000'000);
+  EXPECT_EQ(converted->quantity, 100'000'000'000);
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsMissingPriceToNull) {
+  EXPECT_THAT(convert(entry),
+              Optional(Field(&codec::Entry::price, codec::NullInt64)));
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsTimeToNanoseconds) {
+  entry.time = MarketEntryTime{std::chrono::sys_days{} + 1s + 5us};
+
+  EXPECT_THAT(convert(entry),
+              Optional(Field(&codec::Entry::time, 1'000'005'000)));
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsIdentifier) {
+  entry.id = MarketEntryId{"seed:1"};
+
+  const auto converted = convert(entry);
+
+  ASSERT_TRUE(converted.has_value());
+  EXPECT_EQ(codec::view(converted->id), "seed:1");
+}
+
+TEST_F(MdfeedEntryConversion, ConvertsOnlyTypedEntries) {
+  MarketDataEntry untyped;
+
+  EXPECT_THAT(convert(std::vector{entry, untyped, entry}), SizeIs(2));
+}
+
+}  // namespace
+}  // namespace simulator::mdfeed::publisher::test
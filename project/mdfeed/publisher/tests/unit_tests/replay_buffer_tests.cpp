@@ -0,0 +1,93 @@
+#include <gmock/gmock.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ih/replay_buffer.hpp"
+
+namespace simulator::mdfeed::publisher::test {
+namespace {
+
+using namespace ::testing;
+
+struct MdfeedReplayBuffer : public Test {
+  static auto make_datagram(std::uint64_t sequence) -> ReplayBuffer::Datagram {
+    return ReplayBuffer::Datagram{static_cast<std::byte>(sequence)};
+  }
+
+  auto store(std::uint32_t stream_id,
+             std::uint64_t first_sequence,
+             std::uint64_t last_sequence) -> void {
+    for (auto sequence = first_sequence; sequence <= last_sequence;
+         ++sequence) {
+      buffer.store(stream_id, sequence, make_datagram(sequence));
+    }
+  }
+
+  ReplayBuffer buffer{3};
+};
+
+TEST_F(MdfeedReplayBuffer, CollectsStoredRange) {
+  store(1, 1, 3);
+
+  EXPECT_THAT(buffer.collect(1, 2, 3),
+              Optional(ElementsAre(make_datagram(2), make_datagram(3))));
+}
+
+TEST_F(MdfeedReplayBuffer, KeepsOnlyMostRecentRefreshes) {
+  store(1, 1, 5);
+
+  EXPECT_EQ(buffer.collect(1, 2, 5), std::nullopt);
+  EXPECT_THAT(
+      buffer.collect(1, 3, 5),
+      Optional(ElementsAre(
+          make_datagram(3), make_datagram(4), make_datagram(5))));
+}
+
+TEST_F(MdfeedReplayBuffer, DoesNotCollectNotYetStoredRefreshes) {
+  store(1, 1, 2);
+
+  EXPECT_EQ(buffer.collect(1, 2, 3), std::nullopt);
+}
+
+TEST_F(MdfeedReplayBuffer, DoesNotCollectInvertedRange) {
+  store(1, 1, 3);
+
+  EXPECT_EQ(buffer.collect(1, 3, 2), std::nullopt);
+}
+
+TEST_F(MdfeedReplayBuffer, KeepsStreamsSeparately) {
+  store(1, 1, 3);
+  store(2, 1, 1);
+
+  EXPECT_THAT(buffer.collect(2, 1, 1), Optional(ElementsAre(make_datagram(1))));
+  EXPECT_EQ(buffer.collect(2, 1, 2), std::nullopt);
+}
+
+TEST_F(MdfeedReplayBuffer, DropsRefreshesBeforeRestartedSequence) {
+  store(1, 1, 3);
+  store(1, 10, 10);
+
+  EXPECT_EQ(buffer.collect(1, 3, 3), std::nullopt);
+  EXPECT_THAT(buffer.collect(1, 10, 10),
+              Optional(ElementsAre(make_datagram(10))));
+}
+
+TEST_F(MdfeedReplayBuffer, ForgetsRemovedStream) {
+  store(1, 1, 3);
+
+  buffer.remove(1);
+
+  EXPECT_EQ(buffer.collect(1, 1, 1), std::nullopt);
+}
+
+TEST_F(MdfeedReplayBuffer, KeepsNothingWithZeroDepth) {
+  ReplayBuffer disabled{0};
+  disabled.store(1, 1, make_datagram(1));
+
+  EXPECT_EQ(disabled.collect(1, 1, 1), std::nullopt);
+}
+
+}  // namespace
+}  // namespace simulator::mdfeed::publisher::test
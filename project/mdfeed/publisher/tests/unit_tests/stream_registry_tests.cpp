@@ -0,0 +1,101 @@
+#include <gmock/gmock.h>
+
+#include "ih/stream_registry.hpp"
+
+namespace simulator::mdfeed::publisher::test {
+namespace {
+
+using namespace ::testing;
+
+struct MdfeedStreamRegistry : public Test {
+  StreamRegistry registry;
+};
+
+TEST_F(MdfeedStreamRegistry, CreatesStreamForNewSymbol) {
+  const auto registration = registry.register_stream("AAPL", true);
+
+  ASSERT_TRUE(registration.created);
+  EXPECT_EQ(registration.stream.id, 1U);
+  EXPECT_EQ(registration.stream.symbol, "AAPL");
+  EXPECT_TRUE(registration.stream.include_trades);
+  EXPECT_FALSE(registration.stream.active);
+}
+
+TEST_F(MdfeedStreamRegistry, ReusesStreamOfRegisteredSymbol) {
+  const auto first = registry.register_stream("AAPL", false);
+  const auto second = registry.register_stream("AAPL", true);
+
+  ASSERT_FALSE(second.created);
+  EXPECT_EQ(second.stream.id, first.stream.id);
+  EXPECT_FALSE(second.stream.include_trades);
+}
+
+TEST_F(MdfeedStreamRegistry, AssignsDistinctIdsToDistinctSymbols) {
+  const auto first = registry.register_stream("AAPL", false);
+  const auto second = registry.register_stream("MSFT", false);
+
+  EXPECT_NE(first.stream.id, second.stream.id);
+}
+
+TEST_F(MdfeedStreamRegistry, ActivatesStreamOnce) {
+  const auto stream_id = registry.register_stream("AAPL", false).stream.id;
+
+  EXPECT_TRUE(registry.activate(stream_id));
+  EXPECT_FALSE(registry.activate(stream_id));
+  EXPECT_THAT(registry.find(stream_id),
+              Optional(Field(&Stream::active, IsTrue())));
+}
+
+TEST_F(MdfeedStreamRegistry, DoesNotSequenceInactiveStream) {
+  const auto stream_id = registry.register_stream("AAPL", false).stream.id;
+
+  EXPECT_EQ(registry.next_sequence(stream_id), std::nullopt);
+}
+
+TEST_F(MdfeedStreamRegistry, SequencesActiveStream) {
+  const auto stream_id = registry.register_stream("AAPL", false).stream.id;
+  registry.activate(stream_id);
+
+  EXPECT_THAT(registry.next_sequence(stream_id), Optional(Eq(1U)));
+  EXPECT_THAT(registry.next_sequence(stream_id), Optional(Eq(2U)));
+  EXPECT_THAT(registry.last_sequence(stream_id), Optional(Eq(2U)));
+}
+
+TEST_F(MdfeedStreamRegistry, SequencesStreamsIndependently) {
+  const auto first = registry.register_stream("AAPL", false).stream.id;
+  const auto second = registry.register_stream("MSFT", false).stream.id;
+  registry.activate(first);
+  registry.activate(second);
+
+  registry.next_sequence(first);
+  registry.next_sequence(first);
+
+  EXPECT_THAT(registry.next_sequence(second), Optional(Eq(1U)));
+}
+
+TEST_F(MdfeedStreamRegistry, RemovesStream) {
+  const auto stream_id = registry.register_stream("AAPL", false).stream.id;
+
+  ASSERT_THAT(registry.remove(stream_id),
+              Optional(Field(&Stream::symbol, Eq("AAPL"))));
+  EXPECT_EQ(registry.find(stream_id), std::nullopt);
+  EXPECT_TRUE(registry.register_stream("AAPL", false).created);
+}
+
+TEST(MdfeedStreamRequestId, ParsesSubscriptionRequestId) {
+  EXPECT_THAT(parse_stream_id(make_subscription_request_id(42)),
+              Optional(Eq(42U)));
+}
+
+TEST(MdfeedStreamRequestId, ParsesSnapshotRequestId) {
+  EXPECT_THAT(parse_stream_id(make_snapshot_request_id(7)), Optional(Eq(7U)));
+}
+
+TEST(MdfeedStreamRequestId, RejectsForeignRequestId) {
+  EXPECT_EQ(parse_stream_id("42"), std::nullopt);
+  EXPECT_EQ(parse_stream_id("mdfeed:"), std::nullopt);
+  EXPECT_EQ(parse_stream_id("mdfeed:4x"), std::nullopt);
+}
+
+}  // namespace
+}  // namespace simulator::mdfeed::publisher::test
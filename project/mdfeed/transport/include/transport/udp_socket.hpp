@@ -0,0 +1,68 @@
+#ifndef SIMULATOR_MDFEED_TRANSPORT_UDP_SOCKET_HPP_
+#define SIMULATOR_MDFEED_TRANSPORT_UDP_SOCKET_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace simulator::mdfeed::transport {
+
+// IPv4 endpoint kept in the network byte order, as it is used by sockets
+struct Endpoint {
+  std::uint32_t address = 0;
+  std::uint16_t port = 0;
+};
+
+// Thin RAII wrapper of a POSIX UDP socket.
+// Creation failures are reported with std::runtime_error,
+// send and receive failures are reported through return values.
+class UdpSocket {
+ public:
+  // Creates a socket sending datagrams to the destination address,
+  // the address may be a unicast or a multicast group address.
+  [[nodiscard]]
+  static auto open_sender(const std::string& address, std::uint16_t port)
+      -> UdpSocket;
+
+  // Creates a socket receiving datagrams on the port,
+  // joins the group when the address is a multicast group address.
+  [[nodiscard]]
+  static auto open_receiver(const std::string& address, std::uint16_t port)
+      -> UdpSocket;
+
+  UdpSocket(const UdpSocket&) = delete;
+  UdpSocket(UdpSocket&& other) noexcept;
+  ~UdpSocket() noexcept;
+
+  auto operator=(const UdpSocket&) -> UdpSocket& = delete;
+  auto operator=(UdpSocket&& other) noexcept -> UdpSocket&;
+
+  // Sends a datagram to the default destination
+  auto send(std::span<const std::byte> datagram) const noexcept -> bool;
+
+  auto send_to(std::span<const std::byte> datagram,
+               const Endpoint& destination) const noexcept -> bool;
+
+  // Waits for a datagram at most for the timeout,
+  // returns the received datagram size or nullopt on timeout/error.
+  [[nodiscard]]
+  auto receive(std::span<std::byte> buffer,
+               std::chrono::milliseconds timeout,
+               Endpoint* source = nullptr) const noexcept
+      -> std::optional<std::size_t>;
+
+ private:
+  UdpSocket(int descriptor, Endpoint destination) noexcept;
+
+  auto close() noexcept -> void;
+
+  int descriptor_{-1};
+  Endpoint destination_;
+};
+
+}  // namespace simulator::mdfeed::transport
+
+#endif  // SIMULATOR_MDFEED_TRANSPORT_UDP_SOCKET_HPP_
@@ -0,0 +1,183 @@
+#include "transport/udp_socket.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace simulator::mdfeed::transport {
+namespace {
+
+constexpr int SocketBufferSize = 4 * 1024 * 1024;
+
+[[noreturn]]
+auto socket_error(std::string_view action) -> void {
+  throw std::runtime_error(std::string{"failed to "} + std::string{action} +
+                           ": " + std::strerror(errno));
+}
+
+auto parse_address(const std::string& address) -> std::uint32_t {
+  in_addr parsed{};
+  if (::inet_pton(AF_INET, address.c_str(), &parsed) != 1) {
+    throw std::runtime_error("invalid IPv4 address: " + address);
+  }
+  return parsed.s_addr;
+}
+
+auto is_multicast(std::uint32_t address) noexcept -> bool {
+  return IN_MULTICAST(ntohl(address));
+}
+
+auto to_sockaddr(const Endpoint& endpoint) noexcept -> sockaddr_in {
+  sockaddr_in socket_address{};
+  socket_address.sin_family = AF_INET;
+  socket_address.sin_addr.s_addr = endpoint.address;
+  socket_address.sin_port = endpoint.port;
+  return socket_address;
+}
+
+auto create_socket() -> int {
+  const int descriptor = ::socket(AF_INET, SOCK_DGRAM, 0);
+  if (descriptor < 0) {
+    socket_error("create a udp socket");
+  }
+  return descriptor;
+}
+
+template <typename T>
+auto set_option(int descriptor, int level, int name, const T& value) -> void {
+  if (::setsockopt(descriptor, level, name, &value, sizeof(value)) != 0) {
+    const int error = errno;
+    ::close(descriptor);
+    errno = error;
+    socket_error("configure a udp socket");
+  }
+}
+
+}  // namespace
+
+auto UdpSocket::open_sender(const std::string& address, std::uint16_t port)
+    -> UdpSocket {
+  const Endpoint destination{parse_address(address), htons(port)};
+  const int descriptor = create_socket();
+
+  set_option(descriptor, SOL_SOCKET, SO_SNDBUF, SocketBufferSize);
+  if (is_multicast(destination.address)) {
+    // The feed is meant to be consumed on the same box or the local segment
+    const unsigned char ttl = 1;
+    const unsigned char loop = 1;
+    set_option(descriptor, IPPROTO_IP, IP_MULTICAST_TTL, ttl);
+    set_option(descriptor, IPPROTO_IP, IP_MULTICAST_LOOP, loop);
+  }
+
+  return UdpSocket{descriptor, destination};
+}
+
+auto UdpSocket::open_receiver(const std::string& address, std::uint16_t port)
+    -> UdpSocket {
+  const auto group = parse_address(address);
+  const int descriptor = create_socket();
+
+  const int reuse = 1;
+  set_option(descriptor, SOL_SOCKET, SO_REUSEADDR, reuse);
+  set_option(descriptor, SOL_SOCKET, SO_RCVBUF, SocketBufferSize);
+
+  const auto local = to_sockaddr(Endpoint{htonl(INADDR_ANY), htons(port)});
+  if (::bind(descriptor,
+             reinterpret_cast<const sockaddr*>(&local),
+             sizeof(local)) != 0) {
+    const int error = errno;
+    ::close(descriptor);
+    errno = error;
+    socket_error("bind a udp socket");
+  }
+
+  if (is_multicast(group)) {
+    ip_mreq membership{};
+    membership.imr_multiaddr.s_addr = group;
+    membership.imr_interface.s_addr = htonl(INADDR_ANY);
+    set_option(descriptor, IPPROTO_IP, IP_ADD_MEMBERSHIP, membership);
+  }
+
+  return UdpSocket{descriptor, Endpoint{}};
+}
+
+UdpSocket::UdpSocket(int descriptor, Endpoint destination) noexcept
+    : descriptor_(descriptor), destination_(destination) {}
+
+UdpSocket::UdpSocket(UdpSocket&& other) noexcept
+    : descriptor_(std::exchange(other.descriptor_, -1)),
+      destination_(other.destination_) {}
+
+UdpSocket::~UdpSocket() noexcept { close(); }
+
+auto UdpSocket::operator=(UdpSocket&& other) noexcept -> UdpSocket& {
+  if (this != &other) {
+    close();
+    descriptor_ = std::exchange(other.descriptor_, -1);
+    destination_ = other.destination_;
+  }
+  return *this;
+}
+
+auto UdpSocket::send(std::span<const std::byte> datagram) const noexcept
+    -> bool {
+  return send_to(datagram, destination_);
+}
+
+auto UdpSocket::send_to(std::span<const std::byte> datagram,
+                        const Endpoint& destination) const noexcept -> bool {
+  const auto socket_address = to_sockaddr(destination);
+  const auto sent = ::sendto(descriptor_,
+                             datagram.data(),
+                             datagram.size(),
+                             0,
+                             reinterpret_cast<const sockaddr*>(&socket_address),
+                             sizeof(socket_address));
+  return sent == static_cast<ssize_t>(datagram.size());
+}
+
+auto UdpSocket::receive(std::span<std::byte> buffer,
+                        std::chrono::milliseconds timeout,
+                        Endpoint* source) const noexcept
+    -> std::optional<std::size_t> {
+  pollfd descriptor{.fd = descriptor_, .events = POLLIN, .revents = 0};
+  if (::poll(&descriptor, 1, static_cast<int>(timeout.count())) <= 0) {
+    return std::nullopt;
+  }
+
+  sockaddr_in socket_address{};
+  socklen_t address_length = sizeof(socket_address);
+  const auto received =
+      ::recvfrom(descriptor_,
+                 buffer.data(),
+                 buffer.size(),
+                 0,
+                 reinterpret_cast<sockaddr*>(&socket_address),
+                 &address_length);
+  if (received < 0) {
+    return std::nullopt;
+  }
+
+  if (source != nullptr) {
+    source->address = socket_address.sin_addr.s_addr;
+    source->port = socket_address.sin_port;
+  }
+  return static_cast<std::size_t>(received);
+}
+
+auto UdpSocket::close() noexcept -> void {
+  if (descriptor_ >= 0) {
+    ::close(descriptor_);
+    descriptor_ = -1;
+  }
+}
+
+}  // namespace simulator::mdfeed::transport
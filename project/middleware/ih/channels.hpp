@@ -1,8 +1,11 @@
 #ifndef SIMULATOR_PROJECT_MIDDLEWARE_IH_CHANNEL_HPP_
 #define SIMULATOR_PROJECT_MIDDLEWARE_IH_CHANNEL_HPP_
 
+#include <array>
 #include <memory>
 
+#include "cfg/api/cfg.hpp"
+#include "cfg/api/venue_scope.hpp"
 #include "middleware/channels/generator_admin_channel.hpp"
 #include "middleware/channels/trading_admin_channel.hpp"
 #include "middleware/channels/trading_reply_channel.hpp"
@@ -11,19 +14,30 @@
 
 namespace simulator::middleware {
 
+// Each venue hosted by the process has its own channel receiver, which
+// is bound, released and addressed by threads bound to the venue.
+// Threads not bound to a venue address the receiver of a single-venue
+// process.
 template <typename Receiver>
 struct Channel {
  public:
   static auto bind(std::shared_ptr<Receiver> receiver) noexcept -> void {
-    receiver_ = std::move(receiver);
+    venue_receiver() = std::move(receiver);
   }
 
-  static auto release() noexcept -> void { receiver_.reset(); }
+  static auto release() noexcept -> void { venue_receiver().reset(); }
 
-  static auto receiver() noexcept -> Receiver* { return receiver_.get(); }
+  static auto receiver() noexcept -> Receiver* {
+    return venue_receiver().get();
+  }
 
  private:
-  static inline std::shared_ptr<Receiver> receiver_{nullptr};
+  static auto venue_receiver() noexcept -> std::shared_ptr<Receiver>& {
+    return receivers_[cfg::current_venue_index()];
+  }
+
+  static inline std::array<std::shared_ptr<Receiver>, cfg::MaxHostedVenues + 1>
+      receivers_{};
 };
 
 using GeneratorAdminChannel = Channel<GeneratorAdminRequestReceiver>;
@@ -2,7 +2,9 @@
 #define SIMULATOR_MIDDLEWARE_CHANNELS_TRADING_PHASE_ADMIN_CHANNEL_HPP_
 
 #include "middleware/channels/detail/receiver.hpp"
+#include "protocol/admin/engine_latency.hpp"
 #include "protocol/admin/market_state.hpp"
+#include "protocol/admin/startup_progress.hpp"
 #include "protocol/admin/trading_phase.hpp"
 
 namespace simulator::middleware {
@@ -19,6 +21,12 @@ struct TradingAdminRequestReceiver : public detail::Receiver {
 
   virtual auto process(const protocol::RecoverMarketStateRequest& request,
                        protocol::RecoverMarketStateReply& reply) -> void = 0;
+
+  virtual auto process(const protocol::EngineLatencyRequest& request,
+                       protocol::EngineLatencyReply& reply) -> void = 0;
+
+  virtual auto process(const protocol::StartupProgressRequest& request,
+                       protocol::StartupProgressReply& reply) -> void = 0;
 };
 
 auto bind_trading_admin_channel(
@@ -2,6 +2,8 @@
 #define SIMULATOR_MIDDLEWARE_CHANNELS_TRADING_REPLY_CHANNEL_HPP_
 
 #include <memory>
+#include <span>
+#include <variant>
 
 #include "detail/receiver.hpp"
 #include "protocol/app/business_message_reject.hpp"
@@ -11,6 +13,7 @@
 #include "protocol/app/market_data_update.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -19,6 +22,20 @@
 
 namespace simulator::middleware {
 
+using TradingReply = std::variant<protocol::BusinessMessageReject,
+                                  protocol::ExecutionReport,
+                                  protocol::OrderPlacementReject,
+                                  protocol::OrderPlacementConfirmation,
+                                  protocol::OrderModificationReject,
+                                  protocol::OrderModificationConfirmation,
+                                  protocol::OrderCancellationReject,
+                                  protocol::OrderCancellationConfirmation,
+                                  protocol::OrderMassCancellationReport,
+                                  protocol::MarketDataReject,
+                                  protocol::MarketDataSnapshot,
+                                  protocol::MarketDataUpdate,
+                                  protocol::SecurityStatus>;
+
 struct TradingReplyReceiver : public detail::Receiver {
   virtual auto process(protocol::BusinessMessageReject reject) -> void = 0;
   virtual auto process(protocol::ExecutionReport report) -> void = 0;
@@ -34,11 +51,19 @@ struct TradingReplyReceiver : public detail::Receiver {
   virtual auto process(protocol::OrderCancellationReject reject) -> void = 0;
   virtual auto process(protocol::OrderCancellationConfirmation confirmation)
       -> void = 0;
+  virtual auto process(protocol::OrderMassCancellationReport report)
+      -> void = 0;
 
   virtual auto process(protocol::MarketDataReject reject) -> void = 0;
   virtual auto process(protocol::MarketDataSnapshot snapshot) -> void = 0;
   virtual auto process(protocol::MarketDataUpdate update) -> void = 0;
   virtual auto process(protocol::SecurityStatus status) -> void = 0;
+
+  // Receives replies produced by a single trading request or event,
+  // replies may be moved from. Passes each reply to the matching `process`
+  // overload unless overridden by a receiver able to handle them at once.
+  // An error processing a reply is logged and the next reply is processed.
+  virtual auto process_batch(std::span<TradingReply> replies) -> void;
 };
 
 // Allows the receiver receiving messages sent via the channel,
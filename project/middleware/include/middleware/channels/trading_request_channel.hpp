@@ -6,7 +6,9 @@
 #include "middleware/channels/detail/receiver.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -17,6 +19,9 @@ struct TradingRequestReceiver : public detail::Receiver {
   virtual auto process(protocol::OrderPlacementRequest request) -> void = 0;
   virtual auto process(protocol::OrderModificationRequest request) -> void = 0;
   virtual auto process(protocol::OrderCancellationRequest request) -> void = 0;
+  virtual auto process(protocol::OrderMassCancellationRequest request)
+      -> void = 0;
+  virtual auto process(protocol::MassQuoteRequest request) -> void = 0;
   virtual auto process(protocol::MarketDataRequest request) -> void = 0;
   virtual auto process(protocol::SecurityStatusRequest request) -> void = 0;
 
@@ -2,7 +2,9 @@
 #define SIMULATOR_MIDDLEWARE_ROUTING_TRADING_PHASE_ADMIN_CHANNEL_HPP_
 
 #include "middleware/routing/errors.hpp"
+#include "protocol/admin/engine_latency.hpp"
 #include "protocol/admin/market_state.hpp"
+#include "protocol/admin/startup_progress.hpp"
 #include "protocol/admin/trading_phase.hpp"
 
 namespace simulator::middleware {
@@ -19,6 +21,12 @@ auto send_admin_request(const protocol::StoreMarketStateRequest& request,
 auto send_admin_request(const protocol::RecoverMarketStateRequest& request,
                         protocol::RecoverMarketStateReply& reply) -> void;
 
+auto send_admin_request(const protocol::EngineLatencyRequest& request,
+                        protocol::EngineLatencyReply& reply) -> void;
+
+auto send_admin_request(const protocol::StartupProgressRequest& request,
+                        protocol::StartupProgressReply& reply) -> void;
+
 }  // namespace simulator::middleware
 
 #endif  // SIMULATOR_MIDDLEWARE_ROUTING_TRADING_PHASE_ADMIN_CHANNEL_HPP_
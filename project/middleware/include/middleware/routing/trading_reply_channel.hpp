@@ -1,6 +1,9 @@
 #ifndef SIMULATOR_MIDDLEWARE_ROUTING_TRADING_REPLY_CHANNEL_HPP_
 #define SIMULATOR_MIDDLEWARE_ROUTING_TRADING_REPLY_CHANNEL_HPP_
 
+#include <span>
+
+#include "middleware/channels/trading_reply_channel.hpp"
 #include "middleware/routing/errors.hpp"
 #include "protocol/app/business_message_reject.hpp"
 #include "protocol/app/execution_report.hpp"
@@ -9,6 +12,7 @@
 #include "protocol/app/market_data_update.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -33,6 +37,8 @@ auto send_trading_reply(protocol::OrderCancellationReject reply) -> void;
 
 auto send_trading_reply(protocol::OrderCancellationConfirmation reply) -> void;
 
+auto send_trading_reply(protocol::OrderMassCancellationReport reply) -> void;
+
 auto send_trading_reply(protocol::MarketDataReject reply) -> void;
 
 auto send_trading_reply(protocol::MarketDataSnapshot reply) -> void;
@@ -41,6 +47,9 @@ auto send_trading_reply(protocol::MarketDataUpdate reply) -> void;
 
 auto send_trading_reply(protocol::SecurityStatus reply) -> void;
 
+// Sends replies to the receiver in one call, replies are moved from.
+auto send_trading_replies(std::span<TradingReply> replies) -> void;
+
 }  // namespace simulator::middleware
 
 #endif  // #define SIMULATOR_MIDDLEWARE_ROUTING_TRADING_REPLY_CHANNEL_HPP_
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include "middleware/routing/errors.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -17,6 +19,11 @@ auto send_trading_request(protocol::OrderModificationRequest request) -> void;
 
 auto send_trading_request(protocol::OrderCancellationRequest request) -> void;
 
+auto send_trading_request(protocol::OrderMassCancellationRequest request)
+    -> void;
+
+auto send_trading_request(protocol::MassQuoteRequest request) -> void;
+
 auto send_trading_request(protocol::MarketDataRequest request) -> void;
 
 auto send_trading_request(protocol::SecurityStatusRequest request) -> void;
@@ -1,5 +1,8 @@
+#include <exception>
+#include <span>
 #include <string_view>
 #include <utility>
+#include <variant>
 
 #include "ih/channels.hpp"
 #include "log/logging.hpp"
@@ -209,8 +212,37 @@ auto send_admin_request(const protocol::RecoverMarketStateRequest& request,
   send_via_trading_admin_channel(request, reply);
 }
 
+auto send_admin_request(const protocol::EngineLatencyRequest& request,
+                        protocol::EngineLatencyReply& reply) -> void {
+  log::debug("trading admin channel is transferring EngineLatencyRequest");
+  send_via_trading_admin_channel(request, reply);
+}
+
+auto send_admin_request(const protocol::StartupProgressRequest& request,
+                        protocol::StartupProgressReply& reply) -> void {
+  log::debug("trading admin channel is transferring StartupProgressRequest");
+  send_via_trading_admin_channel(request, reply);
+}
+
 // Trading reply channel implementation
 
+auto TradingReplyReceiver::process_batch(std::span<TradingReply> replies)
+    -> void {
+  for (auto& reply : replies) {
+    // A reply failing to be processed must not prevent the remaining
+    // replies of the batch from being delivered
+    try {
+      std::visit([this](auto& message) { process(std::move(message)); },
+                 reply);
+    } catch (const std::exception& exception) {
+      log::err("failed to process a reply message, an error occurred: {}",
+               exception.what());
+    } catch (...) {
+      log::err("failed to process a reply message, an unknown error occurred");
+    }
+  }
+}
+
 auto bind_trading_reply_channel(std::shared_ptr<TradingReplyReceiver> receiver)
     -> void {
   TradingReplyChannel::bind(std::move(receiver));
@@ -272,6 +304,13 @@ auto send_trading_reply(protocol::OrderCancellationConfirmation reply) -> void {
   send_via_trading_reply_channel(std::move(reply));
 }
 
+auto send_trading_reply(protocol::OrderMassCancellationReport reply) -> void {
+  log::debug(
+      "trading reply channel is transferring OrderMassCancellationReport "
+      "message");
+  send_via_trading_reply_channel(std::move(reply));
+}
+
 auto send_trading_reply(protocol::MarketDataReject reply) -> void {
   log::debug("trading reply channel is transferring MarketDataReject message");
   send_via_trading_reply_channel(std::move(reply));
@@ -293,6 +332,23 @@ auto send_trading_reply(protocol::SecurityStatus reply) -> void {
   send_via_trading_reply_channel(std::move(reply));
 }
 
+auto send_trading_replies(std::span<TradingReply> replies) -> void {
+  log::debug("trading reply channel is transferring {} messages",
+             replies.size());
+  if (auto* receiver = TradingReplyChannel::receiver()) [[likely]] {
+    receiver->process_batch(replies);
+    return;
+  }
+
+  log::warn(
+      "unable to send messages via trading reply channel, "
+      "probably channel has not been bound or has been released already, "
+      "can not dispatch {} messages",
+      replies.size());
+
+  throw TradingReplyChannelUnboundError{};
+}
+
 // Trading request channel implementation
 
 auto bind_trading_request_channel(
@@ -326,6 +382,20 @@ auto send_trading_request(protocol::OrderCancellationRequest request) -> void {
   send_via_trading_request_channel(std::move(request));
 }
 
+auto send_trading_request(protocol::OrderMassCancellationRequest request)
+    -> void {
+  log::debug(
+      "trading request channel is transferring OrderMassCancellationRequest "
+      "message");
+  send_via_trading_request_channel(std::move(request));
+}
+
+auto send_trading_request(protocol::MassQuoteRequest request) -> void {
+  log::debug(
+      "trading request channel is transferring MassQuoteRequest message");
+  send_via_trading_request_channel(std::move(request));
+}
+
 auto send_trading_request(protocol::MarketDataRequest request) -> void {
   log::debug(
       "trading request channel is transferring MarketDataRequest message");
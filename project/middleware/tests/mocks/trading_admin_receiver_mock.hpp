@@ -31,6 +31,18 @@ struct TradingAdminRequestReceiverMock : public TradingAdminRequestReceiver {
               (const protocol::RecoverMarketStateRequest& request,
                protocol::RecoverMarketStateReply& reply),
               (override));
+
+  MOCK_METHOD(void,
+              process,
+              (const protocol::EngineLatencyRequest& request,
+               protocol::EngineLatencyReply& reply),
+              (override));
+
+  MOCK_METHOD(void,
+              process,
+              (const protocol::StartupProgressRequest& request,
+               protocol::StartupProgressReply& reply),
+              (override));
 };
 
 }  // namespace simulator::middleware::test
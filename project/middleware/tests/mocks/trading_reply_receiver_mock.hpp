@@ -20,6 +20,7 @@ struct TradingReplyReceiverMock : public TradingReplyReceiver {
 
   MOCK_METHOD(void, process, (protocol::OrderCancellationReject), (override));
   MOCK_METHOD(void, process, (protocol::OrderCancellationConfirmation), (override));
+  MOCK_METHOD(void, process, (protocol::OrderMassCancellationReport), (override));
 
   MOCK_METHOD(void, process, (protocol::MarketDataReject), (override));
   MOCK_METHOD(void, process, (protocol::MarketDataSnapshot), (override));
@@ -12,6 +12,8 @@ struct TradingRequestReceiverMock : public TradingRequestReceiver {
   MOCK_METHOD(void, process, (protocol::OrderPlacementRequest), (override));
   MOCK_METHOD(void, process, (protocol::OrderModificationRequest), (override));
   MOCK_METHOD(void, process, (protocol::OrderCancellationRequest), (override));
+  MOCK_METHOD(void, process, (protocol::OrderMassCancellationRequest), (override));
+  MOCK_METHOD(void, process, (protocol::MassQuoteRequest), (override));
   MOCK_METHOD(void, process, (protocol::MarketDataRequest), (override));
   MOCK_METHOD(void, process, (protocol::SecurityStatusRequest), (override));
 
@@ -70,6 +70,30 @@ TEST_F(TradingAdminChannel, SendsSyncRecoverMarketStateRequest) {
   ASSERT_NO_THROW(send_admin_request(request, reply));
 }
 
+TEST_F(TradingAdminChannel, SendsSyncEngineLatencyRequest) {
+  bind_channel();
+  constexpr protocol::EngineLatencyRequest request;
+  protocol::EngineLatencyReply reply;
+
+  EXPECT_CALL(receiver,
+              process(A<const protocol::EngineLatencyRequest&>(),
+                      A<protocol::EngineLatencyReply&>()));
+
+  ASSERT_NO_THROW(send_admin_request(request, reply));
+}
+
+TEST_F(TradingAdminChannel, SendsSyncStartupProgressRequest) {
+  bind_channel();
+  constexpr protocol::StartupProgressRequest request;
+  protocol::StartupProgressReply reply;
+
+  EXPECT_CALL(receiver,
+              process(A<const protocol::StartupProgressRequest&>(),
+                      A<protocol::StartupProgressReply&>()));
+
+  ASSERT_NO_THROW(send_admin_request(request, reply));
+}
+
 TEST_F(TradingAdminChannel, ReportsChannelNotBoundWhenSendingSyncRequest) {
   constexpr protocol::HaltPhaseRequest request;
   protocol::HaltPhaseReply reply;
@@ -1,6 +1,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+#include <vector>
+
 #include "middleware/channels/trading_reply_channel.hpp"
 #include "middleware/routing/trading_reply_channel.hpp"
 #include "mocks/trading_reply_receiver_mock.hpp"
@@ -32,6 +35,7 @@ using Messages = testing::Types<protocol::ExecutionReport,
                                 protocol::OrderModificationConfirmation,
                                 protocol::OrderCancellationReject,
                                 protocol::OrderCancellationConfirmation,
+                                protocol::OrderMassCancellationReport,
                                 protocol::MarketDataReject,
                                 protocol::MarketDataSnapshot,
                                 protocol::MarketDataUpdate>;
@@ -52,5 +56,34 @@ TYPED_TEST(TradingReplyChannel, ReportsChannelNotBoundWhenSendingReply) {
   EXPECT_THROW(send_trading_reply(reply), ChannelUnboundError);
 }
 
+TYPED_TEST(TradingReplyChannel, SendsRepliesBatchMessageByMessage) {
+  this->bind_channel();
+  std::vector<TradingReply> replies;
+  replies.emplace_back(make_app_message<TypeParam>());
+  replies.emplace_back(make_app_message<TypeParam>());
+
+  EXPECT_CALL(this->receiver, process(A<TypeParam>())).Times(2);
+  EXPECT_NO_THROW(send_trading_replies(replies));
+}
+
+TYPED_TEST(TradingReplyChannel, SendsRemainingRepliesWhenReplyFails) {
+  this->bind_channel();
+  std::vector<TradingReply> replies;
+  replies.emplace_back(make_app_message<TypeParam>());
+  replies.emplace_back(make_app_message<TypeParam>());
+
+  EXPECT_CALL(this->receiver, process(A<TypeParam>()))
+      .WillOnce(Throw(std::runtime_error{"session is not found"}))
+      .WillOnce(Return());
+  EXPECT_NO_THROW(send_trading_replies(replies));
+}
+
+TYPED_TEST(TradingReplyChannel, ReportsChannelNotBoundWhenSendingReplies) {
+  std::vector<TradingReply> replies;
+  replies.emplace_back(make_app_message<TypeParam>());
+
+  EXPECT_THROW(send_trading_replies(replies), ChannelUnboundError);
+}
+
 }  // namespace
 }  // namespace simulator::middleware::test
\ No newline at end of file
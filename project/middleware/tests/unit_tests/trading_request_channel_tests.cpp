@@ -1,6 +1,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "cfg/api/cfg.hpp"
+#include "cfg/api/venue_scope.hpp"
 #include "middleware/channels/trading_request_channel.hpp"
 #include "middleware/routing/trading_request_channel.hpp"
 #include "mocks/trading_request_receiver_mock.hpp"
@@ -50,6 +52,24 @@ TEST_F(TradingRequestChannel, SendsAsyncOrderCancellationRequest) {
   ASSERT_NO_THROW(send_trading_request(request));
 }
 
+TEST_F(TradingRequestChannel, SendsAsyncOrderMassCancellationRequest) {
+  bind_channel();
+  const auto request =
+      make_app_message<protocol::OrderMassCancellationRequest>();
+
+  EXPECT_CALL(receiver, process(A<protocol::OrderMassCancellationRequest>()))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(request));
+}
+
+TEST_F(TradingRequestChannel, SendsAsyncMassQuoteRequest) {
+  bind_channel();
+  const auto request = make_app_message<protocol::MassQuoteRequest>();
+
+  EXPECT_CALL(receiver, process(A<protocol::MassQuoteRequest>())).Times(1);
+  ASSERT_NO_THROW(send_trading_request(request));
+}
+
 TEST_F(TradingRequestChannel, SendsAsyncMarketDataRequest) {
   bind_channel();
   const auto request = make_app_message<protocol::MarketDataRequest>();
@@ -83,5 +103,55 @@ TEST_F(TradingRequestChannel, ReportsChannelNotBoundWhenSendingSyncRequest) {
   ASSERT_THROW(send_trading_request(request, reply), ChannelUnboundError);
 }
 
+TEST_F(TradingRequestChannel, SendsRequestToReceiverOfBoundVenue) {
+  bind_channel();
+  cfg::HostedVenueConfiguration venue;
+  venue.index = 1;
+  StrictMock<TradingRequestReceiverMock> venue_receiver;
+  const auto request = make_app_message<protocol::OrderPlacementRequest>();
+
+  const cfg::VenueScope scope{&venue};
+  bind_trading_request_channel(std::shared_ptr<TradingRequestReceiver>{
+      std::addressof(venue_receiver), [](auto* /*pointer*/) {}});
+
+  EXPECT_CALL(venue_receiver, process(A<protocol::OrderPlacementRequest>()))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(request));
+
+  release_trading_request_channel();
+}
+
+TEST_F(TradingRequestChannel, SendsRequestToProcessReceiverOutOfVenueScope) {
+  bind_channel();
+  cfg::HostedVenueConfiguration venue;
+  venue.index = 1;
+  StrictMock<TradingRequestReceiverMock> venue_receiver;
+  const auto request = make_app_message<protocol::OrderPlacementRequest>();
+
+  {
+    const cfg::VenueScope scope{&venue};
+    bind_trading_request_channel(std::shared_ptr<TradingRequestReceiver>{
+        std::addressof(venue_receiver), [](auto* /*pointer*/) {}});
+  }
+
+  EXPECT_CALL(receiver, process(A<protocol::OrderPlacementRequest>()))
+      .Times(1);
+  ASSERT_NO_THROW(send_trading_request(request));
+
+  const cfg::VenueScope scope{&venue};
+  release_trading_request_channel();
+}
+
+TEST_F(TradingRequestChannel, ReportsChannelNotBoundForVenueWithoutReceiver) {
+  bind_channel();
+  cfg::HostedVenueConfiguration venue;
+  venue.index = 2;
+  const auto request = make_app_message<protocol::OrderPlacementRequest>();
+
+  const cfg::VenueScope scope{&venue};
+
+  ASSERT_THROW(send_trading_request(request), ChannelUnboundError);
+}
+
 }  // namespace
 }  // namespace simulator::middleware::test
\ No newline at end of file
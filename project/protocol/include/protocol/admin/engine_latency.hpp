@@ -0,0 +1,76 @@
+#ifndef SIMULATOR_PROTOCOL_ADMIN_ENGINE_LATENCY_HPP_
+#define SIMULATOR_PROTOCOL_ADMIN_ENGINE_LATENCY_HPP_
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace simulator::protocol {
+
+struct EngineLatencyRequest {};
+
+// Latency distribution of a single processing stage of an engine command
+struct CommandLatency {
+  std::string command;
+  std::string stage;
+  std::uint64_t count = 0;
+  std::chrono::nanoseconds mean{0};
+  std::chrono::nanoseconds p50{0};
+  std::chrono::nanoseconds p90{0};
+  std::chrono::nanoseconds p99{0};
+  std::chrono::nanoseconds p999{0};
+  std::chrono::nanoseconds max{0};
+};
+
+struct EngineLatency {
+  std::uint64_t instrument_id = 0;
+  std::string symbol;
+  std::vector<CommandLatency> commands;
+};
+
+struct EngineLatencyReply {
+  std::vector<EngineLatency> engines;
+};
+
+}  // namespace simulator::protocol
+
+template <>
+struct fmt::formatter<simulator::protocol::EngineLatencyRequest>
+    : public formatter<std::string_view> {
+  using formattable = simulator::protocol::EngineLatencyRequest;
+
+  auto format(formattable request, format_context& context) const
+      -> decltype(context.out());
+};
+
+template <>
+struct fmt::formatter<simulator::protocol::CommandLatency>
+    : public formatter<std::string_view> {
+  using formattable = simulator::protocol::CommandLatency;
+
+  auto format(const formattable& latency, format_context& context) const
+      -> decltype(context.out());
+};
+
+template <>
+struct fmt::formatter<simulator::protocol::EngineLatency>
+    : public formatter<std::string_view> {
+  using formattable = simulator::protocol::EngineLatency;
+
+  auto format(const formattable& latency, format_context& context) const
+      -> decltype(context.out());
+};
+
+template <>
+struct fmt::formatter<simulator::protocol::EngineLatencyReply>
+    : public formatter<std::string_view> {
+  using formattable = simulator::protocol::EngineLatencyReply;
+
+  auto format(const formattable& reply, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_PROTOCOL_ADMIN_ENGINE_LATENCY_HPP_
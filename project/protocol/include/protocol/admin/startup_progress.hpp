@@ -0,0 +1,59 @@
+#ifndef SIMULATOR_PROTOCOL_ADMIN_STARTUP_PROGRESS_HPP_
+#define SIMULATOR_PROTOCOL_ADMIN_STARTUP_PROGRESS_HPP_
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+namespace simulator::protocol {
+
+struct StartupProgressRequest {};
+
+struct StartupProgressReply {
+  enum class Stage : std::uint8_t {
+    Initializing,
+    ConstructingEngines,
+    RecoveringState,
+    Ready,
+    Failed
+  };
+
+  Stage stage = Stage::Initializing;
+  std::uint64_t engines_total = 0;
+  std::uint64_t engines_constructed = 0;
+  std::uint64_t engines_recovered = 0;
+  std::chrono::milliseconds elapsed{0};
+};
+
+}  // namespace simulator::protocol
+
+template <>
+struct fmt::formatter<simulator::protocol::StartupProgressReply::Stage>
+    : public formatter<std::string_view> {
+  using formattable = simulator::protocol::StartupProgressReply::Stage;
+
+  auto format(formattable stage, format_context& context) const
+      -> decltype(context.out());
+};
+
+template <>
+struct fmt::formatter<simulator::protocol::StartupProgressRequest>
+    : public formatter<std::string_view> {
+  using formattable = simulator::protocol::StartupProgressRequest;
+
+  auto format(formattable request, format_context& context) const
+      -> decltype(context.out());
+};
+
+template <>
+struct fmt::formatter<simulator::protocol::StartupProgressReply>
+    : public formatter<std::string_view> {
+  using formattable = simulator::protocol::StartupProgressReply;
+
+  auto format(const formattable& reply, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_PROTOCOL_ADMIN_STARTUP_PROGRESS_HPP_
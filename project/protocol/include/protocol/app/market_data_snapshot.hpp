@@ -20,6 +20,9 @@ struct MarketDataSnapshot {
 
   InstrumentDescriptor instrument;
   std::optional<MdRequestId> request_id;
+  // Per-listing sequence number of the last market data update,
+  // which is reflected by the snapshot
+  std::optional<SeqNum> update_sequence;
   std::vector<MarketDataEntry> market_data_entries;
 };
 
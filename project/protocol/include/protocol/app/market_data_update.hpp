@@ -19,6 +19,8 @@ struct MarketDataUpdate {
   Session session;
 
   std::optional<MdRequestId> request_id;
+  // Per-listing sequence number of the market data update
+  std::optional<SeqNum> update_sequence;
   std::vector<MarketDataEntry> market_data_entries;
 };
 
@@ -0,0 +1,63 @@
+#ifndef SIMULATOR_PROTOCOL_APP_MASS_QUOTE_REQUEST_HPP_
+#define SIMULATOR_PROTOCOL_APP_MASS_QUOTE_REQUEST_HPP_
+
+#include <fmt/base.h>
+
+#include "core/common/name.hpp"
+#include "core/domain/attributes.hpp"
+#include "core/domain/instrument_descriptor.hpp"
+#include "core/domain/party.hpp"
+#include "protocol/types/session.hpp"
+
+namespace simulator::protocol {
+
+// A single price level of a quote ladder, placed as a day limit order
+struct QuoteEntry {
+  std::optional<ClientOrderId> client_order_id;
+  std::optional<OrderPrice> order_price;
+  std::optional<OrderQuantity> order_quantity;
+  std::optional<Side> side;
+
+  [[nodiscard]]
+  consteval static auto name() {
+    return core::Name{.singular = "QuoteEntry", .plural = "QuoteEntries"};
+  }
+};
+
+// Replaces resting limit orders, which the session has in the instrument,
+// with the quote entries. The book is updated in one step, so that
+// market data reflects the replaced ladder at once.
+struct MassQuoteRequest {
+  explicit MassQuoteRequest(Session protocol_session) noexcept;
+
+  Session session;
+  InstrumentDescriptor instrument;
+  std::optional<ClientOrderId> client_order_id;
+  std::optional<SeqNum> seq_num;
+  std::vector<Party> parties;
+  std::vector<QuoteEntry> entries;
+};
+
+}  // namespace simulator::protocol
+
+template <>
+struct fmt::formatter<simulator::protocol::QuoteEntry> {
+  using formattable = simulator::protocol::QuoteEntry;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& entry, format_context& context) const
+      -> decltype(context.out());
+};
+
+template <>
+struct fmt::formatter<simulator::protocol::MassQuoteRequest> {
+  using formattable = simulator::protocol::MassQuoteRequest;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& message, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_PROTOCOL_APP_MASS_QUOTE_REQUEST_HPP_
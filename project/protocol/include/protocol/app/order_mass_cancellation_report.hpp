@@ -0,0 +1,39 @@
+#ifndef SIMULATOR_PROTOCOL_APP_ORDER_MASS_CANCELLATION_REPORT_HPP_
+#define SIMULATOR_PROTOCOL_APP_ORDER_MASS_CANCELLATION_REPORT_HPP_
+
+#include <fmt/base.h>
+
+#include <optional>
+
+#include "core/domain/attributes.hpp"
+#include "core/domain/instrument_descriptor.hpp"
+#include "protocol/types/session.hpp"
+
+namespace simulator::protocol {
+
+// Reports the number of orders cancelled by an accepted order mass
+// cancellation request. Each cancelled order is reported on its own as well.
+struct OrderMassCancellationReport {
+  explicit OrderMassCancellationReport(Session protocol_session) noexcept;
+
+  Session session;
+  std::optional<InstrumentDescriptor> instrument;
+  std::optional<ClientOrderId> client_order_id;
+  std::optional<VenueOrderId> venue_order_id;
+  std::optional<Side> side;
+  std::optional<TotalAffectedOrders> total_affected_orders;
+};
+
+}  // namespace simulator::protocol
+
+template <>
+struct fmt::formatter<simulator::protocol::OrderMassCancellationReport> {
+  using formattable = simulator::protocol::OrderMassCancellationReport;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& message, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_PROTOCOL_APP_ORDER_MASS_CANCELLATION_REPORT_HPP_
@@ -0,0 +1,40 @@
+#ifndef SIMULATOR_PROTOCOL_APP_ORDER_MASS_CANCELLATION_REQUEST_HPP_
+#define SIMULATOR_PROTOCOL_APP_ORDER_MASS_CANCELLATION_REQUEST_HPP_
+
+#include <fmt/base.h>
+
+#include "core/domain/attributes.hpp"
+#include "core/domain/instrument_descriptor.hpp"
+#include "core/domain/party.hpp"
+#include "protocol/types/session.hpp"
+
+namespace simulator::protocol {
+
+// Requests cancellation of resting orders placed by the session,
+// only of those placed on behalf of any of the parties, when specified.
+// The request may be narrowed down to a side and to an instrument,
+// orders of all instruments are cancelled when no instrument is specified.
+struct OrderMassCancellationRequest {
+  explicit OrderMassCancellationRequest(Session protocol_session) noexcept;
+
+  Session session;
+  std::optional<InstrumentDescriptor> instrument;
+  std::optional<ClientOrderId> client_order_id;
+  std::optional<SeqNum> seq_num;
+  std::vector<Party> parties;
+  std::optional<Side> side;
+};
+
+}  // namespace simulator::protocol
+
+template <>
+struct fmt::formatter<simulator::protocol::OrderMassCancellationRequest> {
+  using formattable = simulator::protocol::OrderMassCancellationRequest;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& message, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_PROTOCOL_APP_ORDER_MASS_CANCELLATION_REQUEST_HPP_
@@ -23,7 +23,9 @@ struct OrderPlacementRequest {
   std::optional<ExpireTime> expire_time;
   std::optional<ExpireDate> expire_date;
   std::optional<OrderPrice> order_price;
+  std::optional<StopPrice> stop_price;
   std::optional<OrderQuantity> order_quantity;
+  std::optional<DisplayQuantity> display_quantity;
   std::optional<ShortSaleExemptionReason> short_sale_exempt_reason;
   std::optional<TimeInForce> time_in_force;
   std::optional<OrderType> order_type;
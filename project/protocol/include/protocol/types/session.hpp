@@ -91,8 +91,28 @@ struct Session {
 
 }  // namespace generator
 
+namespace mdfeed {
+
+// An internal market simulator descriptor for a market data session,
+// dedicated to the binary market data feed
 struct Session {
-  using ValueType = std::variant<fix::Session, generator::Session>;
+  [[nodiscard]] constexpr auto operator==(Session /*other*/) const noexcept
+      -> bool {
+    // Market data feed session objects always represent the same session
+    return true;
+  }
+
+  [[nodiscard]] consteval static auto name() noexcept -> core::Name {
+    return {.singular = "MarketDataFeedSession",
+            .plural = "MarketDataFeedSessions"};
+  }
+};
+
+}  // namespace mdfeed
+
+struct Session {
+  using ValueType =
+      std::variant<fix::Session, generator::Session, mdfeed::Session>;
 
   template <typename SessionType>
     requires std::constructible_from<ValueType, SessionType>
@@ -141,6 +161,10 @@ struct fmt::formatter<simulator::protocol::Session> {
   static auto format_session(
       const simulator::protocol::generator::Session& session,
       format_context& context) -> decltype(context.out());
+
+  static auto format_session(const simulator::protocol::mdfeed::Session& session,
+                             format_context& context)
+      -> decltype(context.out());
 };
 
 #endif  // SIMULATOR_PROTOCOL_TYPES_SESSION_HPP_
\ No newline at end of file
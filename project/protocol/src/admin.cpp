@@ -1,10 +1,13 @@
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 #include <string_view>
 
 #include "core/common/std_formatter.hpp"
+#include "protocol/admin/engine_latency.hpp"
 #include "protocol/admin/generator.hpp"
 #include "protocol/admin/market_state.hpp"
+#include "protocol/admin/startup_progress.hpp"
 #include "protocol/admin/trading_phase.hpp"
 
 namespace protocol = simulator::protocol;
@@ -172,4 +175,86 @@ auto fmt::formatter<protocol::RecoverMarketStateReply>::format(
                    "RecoverMarketStateReply={{ Result={}, ErrorMessage={} }}",
                    reply.result,
                    reply.error_message);
-}
\ No newline at end of file
+}
+
+auto fmt::formatter<protocol::EngineLatencyRequest>::format(
+    [[maybe_unused]] formattable request, format_context& context) const
+    -> decltype(context.out()) {
+  return format_to(context.out(), "EngineLatencyRequest={{}}");
+}
+
+auto fmt::formatter<protocol::CommandLatency>::format(
+    const formattable& latency, format_context& context) const
+    -> decltype(context.out()) {
+  return format_to(context.out(),
+                   "CommandLatency={{ Command={}, Stage={}, Count={}, "
+                   "MeanNs={}, P50Ns={}, P90Ns={}, P99Ns={}, P999Ns={}, "
+                   "MaxNs={} }}",
+                   latency.command,
+                   latency.stage,
+                   latency.count,
+                   latency.mean.count(),
+                   latency.p50.count(),
+                   latency.p90.count(),
+                   latency.p99.count(),
+                   latency.p999.count(),
+                   latency.max.count());
+}
+
+auto fmt::formatter<protocol::EngineLatency>::format(
+    const formattable& latency, format_context& context) const
+    -> decltype(context.out()) {
+  return format_to(
+      context.out(),
+      "EngineLatency={{ InstrumentId={}, Symbol={}, Commands=[{}] }}",
+      latency.instrument_id,
+      latency.symbol,
+      fmt::join(latency.commands, ", "));
+}
+
+auto fmt::formatter<protocol::EngineLatencyReply>::format(
+    const formattable& reply, format_context& context) const
+    -> decltype(context.out()) {
+  return format_to(context.out(),
+                   "EngineLatencyReply={{ Engines=[{}] }}",
+                   fmt::join(reply.engines, ", "));
+}
+
+auto fmt::formatter<protocol::StartupProgressReply::Stage>::format(
+    formattable stage, format_context& context) const
+    -> decltype(context.out()) {
+  using base_formatter = formatter<std::string_view>;
+  switch (stage) {
+    case formattable::Initializing:
+      return base_formatter::format("Initializing", context);
+    case formattable::ConstructingEngines:
+      return base_formatter::format("ConstructingEngines", context);
+    case formattable::RecoveringState:
+      return base_formatter::format("RecoveringState", context);
+    case formattable::Ready:
+      return base_formatter::format("Ready", context);
+    case formattable::Failed:
+      return base_formatter::format("Failed", context);
+  }
+  return base_formatter::format("undefined", context);
+}
+
+auto fmt::formatter<protocol::StartupProgressRequest>::format(
+    [[maybe_unused]] formattable request, format_context& context) const
+    -> decltype(context.out()) {
+  return format_to(context.out(), "StartupProgressRequest={{}}");
+}
+
+auto fmt::formatter<protocol::StartupProgressReply>::format(
+    const formattable& reply, format_context& context) const
+    -> decltype(context.out()) {
+  return format_to(context.out(),
+                   "StartupProgressReply={{ Stage={}, EnginesTotal={}, "
+                   "EnginesConstructed={}, EnginesRecovered={}, "
+                   "ElapsedMs={} }}",
+                   reply.stage,
+                   reply.engines_total,
+                   reply.engines_constructed,
+                   reply.engines_recovered,
+                   reply.elapsed.count());
+}
@@ -9,9 +9,12 @@
 #include "protocol/app/market_data_request.hpp"
 #include "protocol/app/market_data_snapshot.hpp"
 #include "protocol/app/market_data_update.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_modification_request.hpp"
@@ -42,6 +45,9 @@ MarketDataSnapshot::MarketDataSnapshot(Session protocol_session) noexcept
 MarketDataUpdate::MarketDataUpdate(Session protocol_session) noexcept
     : session(std::move(protocol_session)) {}
 
+MassQuoteRequest::MassQuoteRequest(Session protocol_session) noexcept
+    : session(std::move(protocol_session)) {}
+
 OrderCancellationConfirmation::OrderCancellationConfirmation(
     Session protocol_session) noexcept
     : session(std::move(protocol_session)) {}
@@ -54,6 +60,14 @@ OrderCancellationRequest::OrderCancellationRequest(
     Session protocol_session) noexcept
     : session(std::move(protocol_session)) {}
 
+OrderMassCancellationReport::OrderMassCancellationReport(
+    Session protocol_session) noexcept
+    : session(std::move(protocol_session)) {}
+
+OrderMassCancellationRequest::OrderMassCancellationRequest(
+    Session protocol_session) noexcept
+    : session(std::move(protocol_session)) {}
+
 OrderModificationConfirmation::OrderModificationConfirmation(
     Session protocol_session) noexcept
     : session(std::move(protocol_session)) {}
@@ -232,10 +246,12 @@ auto fmt::formatter<simulator::protocol::MarketDataSnapshot>::format(
   using simulator::core::format_collection;
   using simulator::core::name_of;
   return format_to(context.out(),
-                   "MarketDataSnapshot={{ {}, {}={}, {}={}, {:p}={} }}",
+                   "MarketDataSnapshot={{ {}, {}={}, {}={}, {}={}, {:p}={} }}",
                    snapshot.session,
                    name_of(snapshot.request_id),
                    snapshot.request_id,
+                   name_of(snapshot.update_sequence),
+                   snapshot.update_sequence,
                    name_of(snapshot.instrument),
                    snapshot.instrument,
                    name_of(snapshot.market_data_entries),
@@ -248,14 +264,55 @@ auto fmt::formatter<simulator::protocol::MarketDataUpdate>::format(
   using simulator::core::format_collection;
   using simulator::core::name_of;
   return format_to(context.out(),
-                   "MarketDataUpdate={{ {}, {}={}, {:p}={} }}",
+                   "MarketDataUpdate={{ {}, {}={}, {}={}, {:p}={} }}",
                    update.session,
                    name_of(update.request_id),
                    update.request_id,
+                   name_of(update.update_sequence),
+                   update.update_sequence,
                    name_of(update.market_data_entries),
                    format_collection(update.market_data_entries));
 }
 
+auto fmt::formatter<simulator::protocol::QuoteEntry>::format(
+    const formattable& entry, format_context& context) const
+    -> decltype(context.out()) {
+  using simulator::core::name_of;
+  return format_to(context.out(),
+                   "{{ {}={}, {}={}, {}={}, {}={} }}",
+                   name_of(entry.client_order_id),
+                   entry.client_order_id,
+                   name_of(entry.side),
+                   entry.side,
+                   name_of(entry.order_price),
+                   entry.order_price,
+                   name_of(entry.order_quantity),
+                   entry.order_quantity);
+}
+
+auto fmt::formatter<simulator::protocol::MassQuoteRequest>::format(
+    const formattable& message, format_context& context) const
+    -> decltype(context.out()) {
+  using simulator::core::format_collection;
+  using simulator::core::name_of;
+  return format_to(context.out(),
+                   "MassQuoteRequest={{ "
+                   "{}, "
+                   "{}={}, {}={}, {}={}, {:p}={}, {:p}={} "
+                   "}}",
+                   message.session,
+                   name_of(message.client_order_id),
+                   message.client_order_id,
+                   name_of(message.seq_num),
+                   message.seq_num,
+                   name_of(message.instrument),
+                   message.instrument,
+                   name_of(message.parties),
+                   format_collection(message.parties),
+                   name_of(message.entries),
+                   format_collection(message.entries));
+}
+
 auto fmt::formatter<simulator::protocol::OrderCancellationConfirmation>::format(
     const formattable& message, format_context& context) const
     -> decltype(context.out()) {
@@ -347,6 +404,51 @@ auto fmt::formatter<simulator::protocol::OrderCancellationRequest>::format(
                    format_collection(message.parties));
 }
 
+auto fmt::formatter<simulator::protocol::OrderMassCancellationReport>::format(
+    const formattable& message, format_context& context) const
+    -> decltype(context.out()) {
+  using simulator::core::name_of;
+  return format_to(context.out(),
+                   "OrderMassCancellationReport={{ "
+                   "{}, "
+                   "{}={}, {}={}, {}={}, {}={}, {}={} "
+                   "}}",
+                   message.session,
+                   name_of(message.client_order_id),
+                   message.client_order_id,
+                   name_of(message.venue_order_id),
+                   message.venue_order_id,
+                   name_of(message.side),
+                   message.side,
+                   name_of(message.total_affected_orders),
+                   message.total_affected_orders,
+                   name_of(message.instrument),
+                   message.instrument);
+}
+
+auto fmt::formatter<simulator::protocol::OrderMassCancellationRequest>::format(
+    const formattable& message, format_context& context) const
+    -> decltype(context.out()) {
+  using simulator::core::format_collection;
+  using simulator::core::name_of;
+  return format_to(context.out(),
+                   "OrderMassCancellationRequest={{ "
+                   "{}, "
+                   "{}={}, {}={}, {}={}, {}={}, {:p}={} "
+                   "}}",
+                   message.session,
+                   name_of(message.client_order_id),
+                   message.client_order_id,
+                   name_of(message.seq_num),
+                   message.seq_num,
+                   name_of(message.side),
+                   message.side,
+                   name_of(message.instrument),
+                   message.instrument,
+                   name_of(message.parties),
+                   format_collection(message.parties));
+}
+
 auto fmt::formatter<simulator::protocol::OrderModificationConfirmation>::format(
     const formattable& message, format_context& context) const
     -> decltype(context.out()) {
@@ -544,7 +646,7 @@ auto fmt::formatter<simulator::protocol::OrderPlacementRequest>::format(
                    "OrderPlacementRequest={{ "
                    "{}, "
                    "{}={}, {}={}, {}={}, {}={}, {}={}, {}={}, {}={}, {}={}, "
-                   "{}={}, {}={}, {:p}={} "
+                   "{}={}, {}={}, {}={}, {}={}, {:p}={} "
                    "}}",
                    message.session,
                    name_of(message.client_order_id),
@@ -557,8 +659,12 @@ auto fmt::formatter<simulator::protocol::OrderPlacementRequest>::format(
                    message.side,
                    name_of(message.order_quantity),
                    message.order_quantity,
+                   name_of(message.display_quantity),
+                   message.display_quantity,
                    name_of(message.order_price),
                    message.order_price,
+                   name_of(message.stop_price),
+                   message.stop_price,
                    name_of(message.expire_date),
                    message.expire_date,
                    name_of(message.expire_time),
@@ -115,3 +115,10 @@ auto fmt::formatter<simulator::protocol::Session>::format_session(
   using simulator::core::name_of;
   return format_to(context.out(), "{}", name_of(session));
 }
+
+auto fmt::formatter<simulator::protocol::Session>::format_session(
+    const simulator::protocol::mdfeed::Session& session,
+    format_context& context) -> decltype(context.out()) {
+  using simulator::core::name_of;
+  return format_to(context.out(), "{}", name_of(session));
+}
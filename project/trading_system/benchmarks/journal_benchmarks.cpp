@@ -0,0 +1,258 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "common/instrument.hpp"
+#include "ih/journal/journal_codec.hpp"
+#include "ih/journal/journal_reader.hpp"
+#include "ih/journal/journal_writer.hpp"
+#include "ih/journal/journaling_trading_engine.hpp"
+#include "ih/tools/tick_deadline_heap.hpp"
+#include "matching_engine/configuration.hpp"
+#include "matching_engine/matching_engine.hpp"
+#include "middleware/channels/trading_reply_channel.hpp"
+#include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_placement_request.hpp"
+#include "protocol/types/session.hpp"
+#include "runtime/service.hpp"
+
+// Measures journaling costs: appending engine commands to a journal
+// and recovering an engine by replaying a journal, in commands per second.
+// Journals are generated from a seeded generator, so that results
+// of different runs and revisions are comparable.
+//
+// JSON results are produced with the `--benchmark_format=json` option
+// or written to a file by the `trading_system_benchmarks_report` target.
+
+namespace {
+
+namespace journal = simulator::trading_system::journal;
+namespace middleware = simulator::middleware;
+namespace protocol = simulator::protocol;
+namespace runtime = simulator::trading_system::runtime;
+
+using simulator::ClientOrderId;
+using simulator::OrderPrice;
+using simulator::OrderQuantity;
+using simulator::OrderType;
+using simulator::OrigClientOrderId;
+using simulator::Side;
+using simulator::Symbol;
+using simulator::TimeInForce;
+using simulator::trading_system::Instrument;
+using simulator::trading_system::TickDeadlineHeap;
+using simulator::trading_system::matching_engine::Configuration;
+using simulator::trading_system::matching_engine::MatchingEngine;
+
+constexpr std::int64_t MidPrice = 100000;
+constexpr std::int64_t PriceLevels = 100;
+constexpr std::uint32_t JournalSeed = 20240101;
+// Appended commands are generated in advance and appended in a loop
+constexpr std::size_t CommandsPoolSize = 4096;
+
+// Runs engine commands in the calling thread, making the engine synchronous
+class InlineService final : public runtime::Service {
+ public:
+  auto execute(std::function<void()> task) -> void override { task(); }
+};
+
+class DiscardingReplyReceiver final : public middleware::TradingReplyReceiver {
+ public:
+  auto process([[maybe_unused]] protocol::BusinessMessageReject reject)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::ExecutionReport report)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::OrderPlacementReject reject)
+      -> void override {}
+  auto process(
+      [[maybe_unused]] protocol::OrderPlacementConfirmation confirmation)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::OrderModificationReject reject)
+      -> void override {}
+  auto process(
+      [[maybe_unused]] protocol::OrderModificationConfirmation confirmation)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::OrderCancellationReject reject)
+      -> void override {}
+  auto process(
+      [[maybe_unused]] protocol::OrderCancellationConfirmation confirmation)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::OrderMassCancellationReport report)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::MarketDataReject reject)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::MarketDataSnapshot snapshot)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::MarketDataUpdate update)
+      -> void override {}
+  auto process([[maybe_unused]] protocol::SecurityStatus status)
+      -> void override {}
+  auto process_batch([[maybe_unused]] std::span<middleware::TradingReply>
+                         replies) -> void override {}
+};
+
+auto make_session() -> protocol::Session {
+  return protocol::Session{protocol::generator::Session{}};
+}
+
+auto make_instrument() -> Instrument {
+  Instrument instrument;
+  instrument.symbol = Symbol{"BENCH"};
+  return instrument;
+}
+
+// Generates a reproducible flow of limit order placements around MidPrice,
+// every fourth command cancels the order placed three commands before
+class CommandGenerator {
+ public:
+  explicit CommandGenerator(std::uint32_t seed = JournalSeed)
+      : random_(seed) {}
+
+  auto next() -> journal::Command {
+    commands_++;
+    if (commands_ % 4 == 0) {
+      protocol::OrderCancellationRequest request{make_session()};
+      request.orig_client_order_id =
+          OrigClientOrderId{std::to_string(commands_ - 3)};
+      request.client_order_id = ClientOrderId{std::to_string(commands_)};
+      request.side = side_of(commands_ - 3);
+      return request;
+    }
+
+    std::uniform_int_distribution<std::int64_t> offset{-PriceLevels,
+                                                       PriceLevels};
+    std::uniform_int_distribution<std::int64_t> quantity{1, 100};
+    protocol::OrderPlacementRequest request{make_session()};
+    request.client_order_id = ClientOrderId{std::to_string(commands_)};
+    request.order_type = OrderType::Option::Limit;
+    request.time_in_force = TimeInForce::Option::Day;
+    request.side = side_of(commands_);
+    request.order_price =
+        OrderPrice{static_cast<double>(MidPrice + offset(random_))};
+    request.order_quantity =
+        OrderQuantity{static_cast<double>(quantity(random_))};
+    return request;
+  }
+
+ private:
+  static auto side_of(std::uint64_t command) -> Side {
+    return command % 2 == 0 ? Side::Option::Buy : Side::Option::Sell;
+  }
+
+  std::mt19937 random_;
+  std::uint64_t commands_ = 0;
+};
+
+// Removes the benchmark journal directory when the benchmark finishes
+class JournalDirectory {
+ public:
+  JournalDirectory()
+      : path_(std::filesystem::temp_directory_path() /
+              "trading_system_journal_benchmarks") {
+    std::filesystem::remove_all(path_);
+    std::filesystem::create_directories(path_);
+  }
+
+  JournalDirectory(const JournalDirectory&) = delete;
+  JournalDirectory(JournalDirectory&&) = delete;
+
+  ~JournalDirectory() noexcept {
+    std::error_code error;
+    std::filesystem::remove_all(path_, error);
+  }
+
+  auto operator=(const JournalDirectory&) -> JournalDirectory& = delete;
+  auto operator=(JournalDirectory&&) -> JournalDirectory& = delete;
+
+  [[nodiscard]]
+  auto file(std::uint64_t generation) const -> std::filesystem::path {
+    return path_ / ("bench." + std::to_string(generation) + ".journal");
+  }
+
+ private:
+  std::filesystem::path path_;
+};
+
+auto create_writer(const std::filesystem::path& file_path,
+                   journal::Committer& committer)
+    -> std::unique_ptr<journal::Writer> {
+  auto writer = journal::Writer::create(
+      file_path, 1, journal::Writer::Settings{}, committer);
+  if (!writer) {
+    throw std::runtime_error(writer.error());
+  }
+  return std::move(*writer);
+}
+
+// Appends order commands to a journal, group commits included
+auto BM_journal_append(benchmark::State& state) -> void {
+  const JournalDirectory directory;
+  journal::Committer committer;
+  auto writer = create_writer(directory.file(1), committer);
+  CommandGenerator generator;
+  std::vector<journal::Command> commands;
+  commands.reserve(CommandsPoolSize);
+  while (commands.size() < CommandsPoolSize) {
+    commands.push_back(generator.next());
+  }
+
+  std::size_t next = 0;
+  for (auto _ : state) {
+    writer->append(commands[next]);
+    next = (next + 1) % commands.size();
+  }
+  writer->commit();
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Recovers an empty engine by replaying a journal of the given
+// number of order commands
+auto BM_journal_replay(benchmark::State& state) -> void {
+  const auto commands = state.range(0);
+  const JournalDirectory directory;
+  {
+    journal::Committer committer;
+    auto writer = create_writer(directory.file(1), committer);
+    CommandGenerator generator;
+    for (std::int64_t command = 0; command < commands; ++command) {
+      writer->append(generator.next());
+    }
+  }
+
+  middleware::bind_trading_reply_channel(
+      std::make_shared<DiscardingReplyReceiver>());
+  const Configuration configuration;
+  InlineService service;
+  TickDeadlineHeap tick_scheduler;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto engine = std::make_unique<MatchingEngine>(
+        make_instrument(), configuration, service, tick_scheduler);
+    state.ResumeTiming();
+
+    auto reader = journal::Reader::open(directory.file(1));
+    benchmark::DoNotOptimize(journal::replay(*reader, *engine));
+
+    state.PauseTiming();
+    engine.reset();
+    state.ResumeTiming();
+  }
+  middleware::release_trading_reply_channel();
+  state.SetItemsProcessed(state.iterations() * commands);
+}
+
+}  // namespace
+
+BENCHMARK(BM_journal_append);
+BENCHMARK(BM_journal_replay)->RangeMultiplier(10)->Range(1000, 100000);
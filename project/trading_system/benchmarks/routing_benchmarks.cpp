@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "common/attributes.hpp"
+#include "common/trading_engine.hpp"
+#include "ih/repository/trading_engines_repository.hpp"
+
+// Compares a cost of routing requests to trading engines by instrument
+// identifiers through a hash map (as the repository did before engines
+// were routed through a flat table) and through the repository.
+//
+// Requests are routed to random instruments of the universe,
+// so that a lookup is not served from a hot cache line.
+
+namespace {
+
+namespace core = simulator::core;
+namespace event = simulator::trading_system::event;
+namespace market_state = simulator::trading_system::market_state;
+namespace protocol = simulator::protocol;
+
+using simulator::trading_system::InstrumentId;
+using simulator::trading_system::TradingEngine;
+using simulator::trading_system::TradingEnginesRepository;
+
+class IdleEngine final : public TradingEngine {
+ public:
+  auto execute(protocol::OrderPlacementRequest /*request*/) -> void override {}
+  auto execute(protocol::OrderModificationRequest /*request*/)
+      -> void override {}
+  auto execute(protocol::OrderCancellationRequest /*request*/)
+      -> void override {}
+  auto execute(protocol::OrderMassCancellationRequest /*request*/)
+      -> void override {}
+  auto execute(protocol::MassQuoteRequest /*request*/) -> void override {}
+  auto execute(protocol::MarketDataRequest /*request*/) -> void override {}
+  auto execute(protocol::SecurityStatusRequest /*request*/) -> void override {}
+  auto provide_state(protocol::InstrumentState& /*reply*/) -> void override {}
+  auto store_state(market_state::InstrumentState& /*state*/)
+      -> void override {}
+  auto recover_state(market_state::InstrumentState /*state*/)
+      -> void override {}
+  auto provide_latency(protocol::EngineLatency& /*latency*/)
+      -> void override {}
+  auto handle(const protocol::SessionTerminatedEvent& /*event*/)
+      -> void override {}
+  auto handle(event::Tick /*tick*/) -> void override {}
+  auto handle(event::PhaseTransition /*phase_transition*/) -> void override {}
+  auto replay_at(core::sys_us /*journaled_at*/) -> void override {}
+  auto finish_replay() -> void override {}
+};
+
+struct InstrumentIdHasher {
+  auto operator()(InstrumentId identifier) const -> std::size_t {
+    return std::hash<std::uint64_t>{}(identifier.value());
+  }
+};
+
+// Generates identifiers of instruments requests are routed to
+auto make_requests(std::int64_t listings) -> std::vector<InstrumentId> {
+  constexpr std::size_t RequestsCount = 4096;
+  std::mt19937_64 generator{listings};
+  std::uniform_int_distribution<std::uint64_t> identifiers{
+      1, static_cast<std::uint64_t>(listings)};
+
+  std::vector<InstrumentId> requests;
+  requests.reserve(RequestsCount);
+  for (std::size_t request = 0; request < RequestsCount; ++request) {
+    requests.emplace_back(identifiers(generator));
+  }
+  return requests;
+}
+
+auto BM_engine_routing_hash_map(benchmark::State& state) -> void {
+  std::vector<std::unique_ptr<TradingEngine>> engines;
+  std::unordered_map<InstrumentId, TradingEngine*, InstrumentIdHasher> routes;
+  for (std::int64_t index = 1; index <= state.range(0); ++index) {
+    const auto& engine = engines.emplace_back(std::make_unique<IdleEngine>());
+    routes.emplace(InstrumentId{static_cast<std::uint64_t>(index)},
+                   engine.get());
+  }
+  const auto requests = make_requests(state.range(0));
+
+  for (auto _ : state) {
+    for (const InstrumentId instrument_id : requests) {
+      benchmark::DoNotOptimize(routes.find(instrument_id)->second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(requests.size()));
+}
+
+auto BM_engine_routing_table(benchmark::State& state) -> void {
+  TradingEnginesRepository repository;
+  for (std::int64_t index = 1; index <= state.range(0); ++index) {
+    repository.add_engine(InstrumentId{static_cast<std::uint64_t>(index)},
+                          std::make_unique<IdleEngine>());
+  }
+  const auto requests = make_requests(state.range(0));
+
+  for (auto _ : state) {
+    for (const InstrumentId instrument_id : requests) {
+      benchmark::DoNotOptimize(
+          &repository.find_instrument_engine(instrument_id));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(requests.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_engine_routing_hash_map)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000);
+
+BENCHMARK(BM_engine_routing_table)->RangeMultiplier(10)->Range(100, 100'000);
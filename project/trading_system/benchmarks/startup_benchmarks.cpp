@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common/instrument.hpp"
+#include "common/market_state/snapshot.hpp"
+#include "common/trading_engine.hpp"
+#include "ih/config/config.hpp"
+#include "ih/repository/trading_engines_repository.hpp"
+#include "ih/tools/parallel_for.hpp"
+#include "ih/tools/tick_deadline_heap.hpp"
+#include "ih/tools/trading_engine_factory.hpp"
+#include "runtime/thread_pool.hpp"
+
+// Measures the trading system start-up against the listings count:
+// construction of a matching engine per listing, the engines registration
+// and the engines state recovery, as the trading system facade does it.
+//
+// Each benchmark is run with a single start-up worker, which is equal
+// to the sequential start-up, and with a worker per hardware thread.
+
+namespace {
+
+namespace market_state = simulator::trading_system::market_state;
+namespace runtime = simulator::trading_system::runtime;
+
+using simulator::Symbol;
+using simulator::trading_system::Config;
+using simulator::trading_system::create_matching_engine_factory;
+using simulator::trading_system::Instrument;
+using simulator::trading_system::InstrumentId;
+using simulator::trading_system::parallel_for;
+using simulator::trading_system::TickDeadlineHeap;
+using simulator::trading_system::TradingEngine;
+using simulator::trading_system::TradingEnginesRepository;
+
+auto make_listings(const std::int64_t count) -> std::vector<Instrument> {
+  std::vector<Instrument> listings(static_cast<std::size_t>(count));
+  for (std::size_t index = 0; index < listings.size(); ++index) {
+    listings[index].identifier = InstrumentId{index + 1};
+    listings[index].symbol = Symbol{fmt::format("SYM{}", index)};
+  }
+  return listings;
+}
+
+auto BM_trading_system_startup(benchmark::State& state) -> void {
+  const auto listings = make_listings(state.range(0));
+  const auto workers = static_cast<std::size_t>(state.range(1));
+  const Config config;
+  auto thread_pool = runtime::ThreadPool::create_simple_thread_pool();
+  TickDeadlineHeap tick_scheduler;
+  const auto engine_factory =
+      create_matching_engine_factory(config, thread_pool, tick_scheduler);
+
+  for (auto _ : state) {
+    TradingEnginesRepository repository;
+
+    std::vector<std::unique_ptr<TradingEngine>> engines(listings.size());
+    parallel_for(
+        listings.size(),
+        [&](std::size_t index) {
+          engines[index] =
+              engine_factory->create_trading_engine(listings[index]);
+        },
+        workers);
+    for (std::size_t index = 0; index < listings.size(); ++index) {
+      repository.add_engine(listings[index], std::move(engines[index]));
+    }
+
+    parallel_for(
+        listings.size(),
+        [&](std::size_t index) {
+          market_state::InstrumentState instrument_state;
+          instrument_state.instrument = listings[index];
+          repository.find_instrument_engine(listings[index].identifier)
+              .recover_state(std::move(instrument_state));
+        },
+        workers);
+
+    state.PauseTiming();
+    repository = TradingEnginesRepository{};
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_trading_system_startup)
+    ->ArgNames({"listings", "workers"})
+    ->ArgsProduct({{1'000, 10'000, 50'000}, {1, 0}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "common/attributes.hpp"
+#include "common/events.hpp"
+#include "common/tick_scheduler.hpp"
+#include "common/trading_engine.hpp"
+#include "core/tools/time.hpp"
+#include "ih/repository/trading_engines_repository.hpp"
+#include "ih/tools/tick_deadline_heap.hpp"
+
+// Compares a cost of dispatching a tick to trading engines by broadcasting it
+// to every engine (as the trading system did before engines deadlines were
+// tracked) and by taking engines with due deadlines from the deadline heap.
+//
+// An active engine keeps expirable orders, so it reschedules its deadline
+// to the next tick once it handles a tick.
+
+namespace {
+
+namespace core = simulator::core;
+namespace event = simulator::trading_system::event;
+namespace market_state = simulator::trading_system::market_state;
+namespace protocol = simulator::protocol;
+
+using simulator::trading_system::InstrumentId;
+using simulator::trading_system::TickDeadline;
+using simulator::trading_system::TickDeadlineHeap;
+using simulator::trading_system::TickScheduler;
+using simulator::trading_system::TradingEngine;
+using simulator::trading_system::TradingEnginesRepository;
+
+using namespace std::chrono_literals;
+
+class TickCountingEngine final : public TradingEngine {
+ public:
+  TickCountingEngine(InstrumentId instrument_id,
+                     TickScheduler& scheduler,
+                     bool active)
+      : instrument_id_(instrument_id), scheduler_(scheduler), active_(active) {}
+
+  auto execute(protocol::OrderPlacementRequest /*request*/) -> void override {}
+  auto execute(protocol::OrderModificationRequest /*request*/)
+      -> void override {}
+  auto execute(protocol::OrderCancellationRequest /*request*/)
+      -> void override {}
+  auto execute(protocol::OrderMassCancellationRequest /*request*/)
+      -> void override {}
+  auto execute(protocol::MassQuoteRequest /*request*/) -> void override {}
+  auto execute(protocol::MarketDataRequest /*request*/) -> void override {}
+  auto execute(protocol::SecurityStatusRequest /*request*/) -> void override {}
+  auto provide_state(protocol::InstrumentState& /*reply*/) -> void override {}
+  auto store_state(market_state::InstrumentState& /*state*/)
+      -> void override {}
+  auto recover_state(market_state::InstrumentState /*state*/)
+      -> void override {}
+  auto provide_latency(protocol::EngineLatency& /*latency*/)
+      -> void override {}
+  auto handle(const protocol::SessionTerminatedEvent& /*event*/)
+      -> void override {}
+  auto handle(event::PhaseTransition /*phase_transition*/) -> void override {}
+  auto replay_at(core::sys_us /*journaled_at*/) -> void override {}
+  auto finish_replay() -> void override {}
+
+  auto handle(event::Tick tick) -> void override {
+    benchmark::DoNotOptimize(++ticks_);
+    if (active_) {
+      scheduler_.reschedule(instrument_id_,
+                            TickDeadline{.time = tick.sys_tick_time + 1s});
+    }
+  }
+
+ private:
+  InstrumentId instrument_id_;
+  TickScheduler& scheduler_;
+  bool active_;
+  std::uint64_t ticks_ = 0;
+};
+
+// Creates `listings` engines, first `active` of them have a deadline
+auto make_engines(std::int64_t listings,
+                  std::int64_t active,
+                  TickDeadlineHeap& heap,
+                  const event::Tick& tick) -> TradingEnginesRepository {
+  TradingEnginesRepository repository;
+  for (std::int64_t index = 0; index < listings; ++index) {
+    const InstrumentId instrument_id{static_cast<std::uint64_t>(index + 1)};
+    repository.add_engine(instrument_id,
+                          std::make_unique<TickCountingEngine>(
+                              instrument_id, heap, index < active));
+    if (index < active) {
+      heap.schedule(instrument_id, TickDeadline{.time = tick.sys_tick_time});
+    }
+  }
+  return repository;
+}
+
+auto make_tick() -> event::Tick {
+  return event::Tick{.sys_tick_time = simulator::core::get_current_system_time(),
+                     .tz_tick_time = {},
+                     .is_new_sys_day = false,
+                     .is_new_tz_day = false};
+}
+
+auto BM_tick_broadcast(benchmark::State& state) -> void {
+  TickDeadlineHeap heap;
+  auto tick = make_tick();
+  const auto repository =
+      make_engines(state.range(0), state.range(1), heap, tick);
+
+  for (auto _ : state) {
+    repository.for_each_engine(
+        [&tick](TradingEngine& engine) { engine.handle(tick); });
+    tick.sys_tick_time += 1s;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+auto BM_tick_deadline_dispatch(benchmark::State& state) -> void {
+  TickDeadlineHeap heap;
+  auto tick = make_tick();
+  const auto repository =
+      make_engines(state.range(0), state.range(1), heap, tick);
+
+  for (auto _ : state) {
+    for (const InstrumentId instrument_id : heap.take_due(tick)) {
+      repository.find_instrument_engine(instrument_id).handle(tick);
+    }
+    tick.sys_tick_time += 1s;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_tick_broadcast)
+    ->ArgNames({"listings", "active"})
+    ->ArgsProduct({{50'000}, {0, 100, 5'000, 50'000}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_tick_deadline_dispatch)
+    ->ArgNames({"listings", "active"})
+    ->ArgsProduct({{50'000}, {0, 100, 5'000, 50'000}})
+    ->Unit(benchmark::kMicrosecond);
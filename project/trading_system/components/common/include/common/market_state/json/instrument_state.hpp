@@ -19,12 +19,18 @@ struct simulator::core::json::Struct<
       Field(&simulator::trading_system::market_state::InstrumentState::
                 last_trade,
             "last_trade"),
+      Field(&simulator::trading_system::market_state::InstrumentState::
+                recent_trades,
+            "recent_trades"),
       Field(
           &simulator::trading_system::market_state::InstrumentState::info,
           "info"),
       Field(&simulator::trading_system::market_state::InstrumentState::
                 order_book,
-            "order_book"));
+            "order_book"),
+      Field(&simulator::trading_system::market_state::InstrumentState::
+                journal_generation,
+            "journal_generation"));
 };
 
 #endif  // SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_INSTRUMENT_STATE_HPP_
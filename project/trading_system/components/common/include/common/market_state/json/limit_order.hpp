@@ -46,7 +46,15 @@ struct simulator::core::json::Struct<
           "total_quantity"),
       Field(&simulator::trading_system::market_state::LimitOrder::
                 cum_executed_quantity,
-            "cum_executed_quantity"));
+            "cum_executed_quantity"),
+      Field(&simulator::trading_system::market_state::LimitOrder::
+                display_quantity,
+            "display_quantity"),
+      Field(
+          &simulator::trading_system::market_state::LimitOrder::hidden_quantity,
+          "hidden_quantity"),
+      Field(&simulator::trading_system::market_state::LimitOrder::quote,
+            "quote"));
 };
 
 #endif  // SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_LIMIT_ORDER_HPP_
@@ -2,6 +2,7 @@
 #define SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_ORDER_BOOK_HPP_
 
 #include "common/market_state/json/limit_order.hpp"
+#include "common/market_state/json/stop_order.hpp"
 #include "common/market_state/snapshot.hpp"
 #include "core/common/json/type_container.hpp"
 #include "core/common/json/type_struct.hpp"
@@ -15,7 +16,16 @@ struct simulator::core::json::Struct<
           "buy_orders"),
       Field(
           &simulator::trading_system::market_state::OrderBook::sell_orders,
-          "sell_orders"));
+          "sell_orders"),
+      Field(&simulator::trading_system::market_state::OrderBook::
+                buy_stop_orders,
+            "buy_stop_orders"),
+      Field(&simulator::trading_system::market_state::OrderBook::
+                sell_stop_orders,
+            "sell_stop_orders"),
+      Field(&simulator::trading_system::market_state::OrderBook::
+                last_order_id,
+            "last_order_id"));
 };
 
 #endif  // SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_ORDER_BOOK_HPP_
@@ -0,0 +1,51 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_STOP_ORDER_HPP_
+#define SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_STOP_ORDER_HPP_
+
+#include "common/market_state/json/session.hpp"
+#include "common/market_state/snapshot.hpp"
+#include "core/common/json/type_struct.hpp"
+#include "core/domain/json/instrument_descriptor.hpp"
+#include "core/domain/json/party.hpp"
+#include "protocol/types/json/session.hpp"
+
+template <>
+struct simulator::core::json::Struct<
+    simulator::trading_system::market_state::StopOrder> {
+  static constexpr auto fields = std::make_tuple(
+      Field(&simulator::trading_system::market_state::StopOrder::
+                client_instrument_descriptor,
+            "client_instrument_descriptor"),
+      Field(
+          &simulator::trading_system::market_state::StopOrder::client_session,
+          "client_session"),
+      Field(
+          &simulator::trading_system::market_state::StopOrder::client_order_id,
+          "client_order_id"),
+      Field(&simulator::trading_system::market_state::StopOrder::order_parties,
+            "order_parties"),
+      Field(&simulator::trading_system::market_state::StopOrder::expire_time,
+            "expire_time"),
+      Field(&simulator::trading_system::market_state::StopOrder::expire_date,
+            "expire_date"),
+      Field(&simulator::trading_system::market_state::StopOrder::
+                short_sale_exemption_reason,
+            "short_sale_exemption_reason"),
+      Field(&simulator::trading_system::market_state::StopOrder::time_in_force,
+            "time_in_force"),
+      Field(&simulator::trading_system::market_state::StopOrder::order_id,
+            "order_id"),
+      Field(&simulator::trading_system::market_state::StopOrder::order_time,
+            "order_time"),
+      Field(&simulator::trading_system::market_state::StopOrder::side, "side"),
+      Field(&simulator::trading_system::market_state::StopOrder::order_status,
+            "order_status"),
+      Field(&simulator::trading_system::market_state::StopOrder::stop_price,
+            "stop_price"),
+      Field(&simulator::trading_system::market_state::StopOrder::order_price,
+            "order_price"),
+      Field(
+          &simulator::trading_system::market_state::StopOrder::total_quantity,
+          "total_quantity"));
+};
+
+#endif  // SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_MARKET_STATE_JSON_STOP_ORDER_HPP_
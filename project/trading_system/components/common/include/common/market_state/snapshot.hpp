@@ -38,11 +38,38 @@ struct LimitOrder {
   OrderPrice order_price{0.};
   OrderQuantity total_quantity{0.};
   CumExecutedQuantity cum_executed_quantity{0.};
+  // Specified for iceberg orders only
+  std::optional<DisplayQuantity> display_quantity;
+  std::optional<LeavesQuantity> hidden_quantity;
+  // Specified for orders placed by mass quote entries only
+  std::optional<bool> quote;
 
   [[nodiscard]]
   bool operator==(const LimitOrder&) const = default;
 };
 
+struct StopOrder {
+  InstrumentDescriptor client_instrument_descriptor;
+  Session client_session;
+  std::optional<ClientOrderId> client_order_id;
+  std::vector<Party> order_parties;
+  std::optional<ExpireTime> expire_time;
+  std::optional<ExpireDate> expire_date;
+  std::optional<ShortSaleExemptionReason> short_sale_exemption_reason;
+  TimeInForce time_in_force{TimeInForce::Option::Day};
+  OrderId order_id{0};
+  OrderTime order_time{core::sys_us{std::chrono::microseconds{0}}};
+  Side side{Side::Option::Buy};
+  OrderStatus order_status{OrderStatus::Option::New};
+  StopPrice stop_price{0.};
+  // Specified for stop-limit orders only
+  std::optional<OrderPrice> order_price;
+  OrderQuantity total_quantity{0.};
+
+  [[nodiscard]]
+  bool operator==(const StopOrder&) const = default;
+};
+
 struct InstrumentInfo {
   Price low_price{0.};
   Price high_price{0.};
@@ -54,6 +81,12 @@ struct InstrumentInfo {
 struct OrderBook {
   std::vector<LimitOrder> buy_orders;
   std::vector<LimitOrder> sell_orders;
+  // Untriggered stop orders, absent in states stored without stop orders
+  std::optional<std::vector<StopOrder>> buy_stop_orders;
+  std::optional<std::vector<StopOrder>> sell_stop_orders;
+  // The identifier of the last order placed, resuming the sequence of order
+  // identifiers makes replayed orders get their original identifiers
+  std::optional<OrderId> last_order_id;
 
   [[nodiscard]]
   bool operator==(const OrderBook&) const = default;
@@ -62,8 +95,12 @@ struct OrderBook {
 struct InstrumentState {
   Instrument instrument;
   std::optional<Trade> last_trade;
+  // Trades from the oldest to the most recent one
+  std::optional<std::vector<Trade>> recent_trades;
   std::optional<InstrumentInfo> info;
   OrderBook order_book;
+  // The first generation of the command journal not covered by the state
+  std::optional<std::uint64_t> journal_generation;
 
   [[nodiscard]]
   bool operator==(const InstrumentState&) const = default;
@@ -103,6 +140,15 @@ struct fmt::formatter<simulator::trading_system::market_state::LimitOrder>
       -> format_context::iterator;
 };
 
+template <>
+struct fmt::formatter<simulator::trading_system::market_state::StopOrder>
+    : fmt::formatter<std::string_view> {
+  using formattable = simulator::trading_system::market_state::StopOrder;
+
+  auto format(const formattable& order, format_context& ctx) const
+      -> format_context::iterator;
+};
+
 template <>
 struct fmt::formatter<simulator::trading_system::market_state::InstrumentInfo>
     : fmt::formatter<std::string_view> {
@@ -0,0 +1,58 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_TICK_SCHEDULER_HPP_
+#define SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_TICK_SCHEDULER_HPP_
+
+#include <optional>
+
+#include "common/attributes.hpp"
+#include "common/events.hpp"
+#include "core/tools/time.hpp"
+
+namespace simulator::trading_system {
+
+// Describes the earliest tick an engine has to handle,
+// i.e. the first tick an order resting in the engine may expire at
+struct TickDeadline {
+  // A system time an order expires at
+  std::optional<core::sys_us> time;
+  // Whether an order expires once a new timezone day starts
+  bool new_day = false;
+
+  // Keeps the earliest of the deadlines
+  auto merge(const TickDeadline& other) -> void;
+
+  [[nodiscard]]
+  auto is_due(const event::Tick& tick) const -> bool;
+
+  [[nodiscard]]
+  auto empty() const -> bool;
+
+  bool operator==(const TickDeadline& rhs) const = default;
+};
+
+// Collects deadlines of trading engines, so that a tick is dispatched only
+// to engines which have something to do at it.
+//
+// Engines call the scheduler from the threads executing their commands.
+class TickScheduler {
+ public:
+  TickScheduler() = default;
+  TickScheduler(const TickScheduler&) = delete;
+  TickScheduler(TickScheduler&&) = delete;
+  virtual ~TickScheduler() = default;
+
+  auto operator=(const TickScheduler&) -> TickScheduler& = delete;
+  auto operator=(TickScheduler&&) -> TickScheduler& = delete;
+
+  // Merges the deadline with one already scheduled for the instrument engine
+  virtual auto schedule(InstrumentId instrument_id, TickDeadline deadline)
+      -> void = 0;
+
+  // Replaces a deadline scheduled for the instrument engine,
+  // an engine without a deadline is not dispatched ticks
+  virtual auto reschedule(InstrumentId instrument_id,
+                          std::optional<TickDeadline> deadline) -> void = 0;
+};
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_COMPONENTS_COMMON_TICK_SCHEDULER_HPP_
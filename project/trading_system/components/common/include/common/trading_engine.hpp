@@ -3,9 +3,13 @@
 
 #include "common/events.hpp"
 #include "common/market_state/snapshot.hpp"
+#include "core/tools/time.hpp"
+#include "protocol/admin/engine_latency.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -29,6 +33,11 @@ class TradingEngine {
 
   virtual auto execute(protocol::OrderCancellationRequest request) -> void = 0;
 
+  virtual auto execute(protocol::OrderMassCancellationRequest request)
+      -> void = 0;
+
+  virtual auto execute(protocol::MassQuoteRequest request) -> void = 0;
+
   virtual auto execute(protocol::MarketDataRequest request) -> void = 0;
 
   virtual auto execute(protocol::SecurityStatusRequest request) -> void = 0;
@@ -39,12 +48,25 @@ class TradingEngine {
 
   virtual auto recover_state(market_state::InstrumentState state) -> void = 0;
 
+  // Reports latencies of commands processed by the engine so far,
+  // may be called concurrently with requests processing
+  virtual auto provide_latency(protocol::EngineLatency& latency) -> void = 0;
+
   virtual auto handle(const protocol::SessionTerminatedEvent& event)
       -> void = 0;
 
   virtual auto handle(event::Tick tick) -> void = 0;
 
   virtual auto handle(event::PhaseTransition phase_transition) -> void = 0;
+
+  // Makes the engine process the following commands as replayed from
+  // a journal: the commands are processed as if the current time was
+  // the time they were journaled at, no replies and market data updates
+  // are published for them
+  virtual auto replay_at(core::sys_us journaled_at) -> void = 0;
+
+  // Makes the engine process the following commands as live ones again
+  virtual auto finish_replay() -> void = 0;
 };
 
 }  // namespace simulator::trading_system
@@ -48,7 +48,8 @@ auto fmt::formatter<simulator::trading_system::market_state::LimitOrder>::
       "\"short_sale_exemption_reason\": {}, \"time_in_force\": {}, "
       "\"order_id\": {}, \"order_time\": {}, \"side\": {}, \"order_status\": "
       "{}, \"order_price\": {}, \"total_quantity\": {}, "
-      "\"cum_executed_quantity\": {} }}\"",
+      "\"cum_executed_quantity\": {}, \"display_quantity\": {}, "
+      "\"hidden_quantity\": {}, \"quote\": {} }}\"",
       order.client_instrument_descriptor,
       order.client_session,
       order.client_order_id,
@@ -63,7 +64,41 @@ auto fmt::formatter<simulator::trading_system::market_state::LimitOrder>::
       order.order_status,
       order.order_price,
       order.total_quantity,
-      order.cum_executed_quantity);
+      order.cum_executed_quantity,
+      order.display_quantity,
+      order.hidden_quantity,
+      order.quote);
+}
+
+auto fmt::formatter<simulator::trading_system::market_state::StopOrder>::
+    format(const formattable& order, format_context& ctx) const
+    -> format_context::iterator {
+  using simulator::core::format_collection;
+  using simulator::core::name_of;
+  return format_to(
+      ctx.out(),
+      "{{ \"client_instrument_descriptor\": {}, "
+      "\"client_session\": {}, \"client_order_id\": {}, \"order_parties\": {}, "
+      "\"expire_time\": {}, \"expire_date\": {}, "
+      "\"short_sale_exemption_reason\": {}, \"time_in_force\": {}, "
+      "\"order_id\": {}, \"order_time\": {}, \"side\": {}, \"order_status\": "
+      "{}, \"stop_price\": {}, \"order_price\": {}, "
+      "\"total_quantity\": {} }}",
+      order.client_instrument_descriptor,
+      order.client_session,
+      order.client_order_id,
+      format_collection(order.order_parties),
+      order.expire_time,
+      order.expire_date,
+      order.short_sale_exemption_reason,
+      order.time_in_force,
+      order.order_id,
+      order.order_time,
+      order.side,
+      order.order_status,
+      order.stop_price,
+      order.order_price,
+      order.total_quantity);
 }
 
 auto fmt::formatter<simulator::trading_system::market_state::InstrumentInfo>::
@@ -0,0 +1,23 @@
+#include "common/tick_scheduler.hpp"
+
+#include <algorithm>
+
+namespace simulator::trading_system {
+
+auto TickDeadline::merge(const TickDeadline& other) -> void {
+  if (other.time.has_value()) {
+    time = time.has_value() ? std::min(*time, *other.time) : other.time;
+  }
+  new_day = new_day || other.new_day;
+}
+
+auto TickDeadline::is_due(const event::Tick& tick) const -> bool {
+  return (time.has_value() && *time <= tick.sys_tick_time) ||
+         (new_day && tick.is_new_tz_day);
+}
+
+auto TickDeadline::empty() const -> bool {
+  return !time.has_value() && !new_day;
+}
+
+}  // namespace simulator::trading_system
@@ -21,6 +21,14 @@ MATCHER_P2(HasString, key, expected, "") {
              StrEq(expected), iter->value.GetString(), result_listener);
 }
 
+MATCHER_P2(HasBool, key, expected, "") {
+  auto iter = arg.FindMember(key);
+  return ExplainMatchResult(Ne(arg.MemberEnd()), iter, result_listener) &&
+         ExplainMatchResult(IsTrue, iter->value.IsBool(), result_listener) &&
+         ExplainMatchResult(
+             Eq(expected), iter->value.GetBool(), result_listener);
+}
+
 MATCHER_P2(HasInt, key, expected, "") {
   auto iter = arg.FindMember(key);
   return ExplainMatchResult(Ne(arg.MemberEnd()), iter, result_listener) &&
@@ -50,12 +50,37 @@ TEST_F(TradingSystemCommonInstrumentState, ReadsFromJson) {
   ASSERT_EQ(instrument_state.instrument.symbol, Symbol{"Symbol"});
   ASSERT_TRUE(instrument_state.last_trade.has_value());
   ASSERT_EQ(instrument_state.last_trade->buyer, BuyerId{"BuyerId"});
+  ASSERT_EQ(instrument_state.recent_trades, std::nullopt);
   ASSERT_THAT(instrument_state.info,
               Optional(Field(&InstrumentInfo::low_price, Eq(Price{3.14}))));
   ASSERT_TRUE(instrument_state.order_book.buy_orders.empty());
   ASSERT_TRUE(instrument_state.order_book.sell_orders.empty());
 }
 
+TEST_F(TradingSystemCommonInstrumentState, ReadsRecentTradesFromJson) {
+  value.SetObject();
+  value.AddMember("instrument", json(Instrument{}).Move(), doc.GetAllocator());
+  value.AddMember("order_book", json(OrderBook{}).Move(), doc.GetAllocator());
+
+  const Trade trade{BuyerId{"BuyerId"},
+                    std::nullopt,
+                    Price{0.},
+                    Quantity{0.},
+                    std::nullopt,
+                    core::get_current_system_time(),
+                    MarketPhase::open()};
+  rapidjson::Value recent_trades{rapidjson::kArrayType};
+  recent_trades.PushBack(json(trade).Move(), doc.GetAllocator());
+  value.AddMember("recent_trades", recent_trades.Move(), doc.GetAllocator());
+
+  const auto instrument_state =
+      core::json::Type<InstrumentState>::read_json_value(value);
+
+  ASSERT_THAT(instrument_state.recent_trades,
+              Optional(ElementsAre(
+                  Field(&Trade::buyer, Optional(Eq(BuyerId{"BuyerId"}))))));
+}
+
 TEST_F(TradingSystemCommonInstrumentState, WritesToJson) {
   using namespace simulator::trading_system::test;
 
@@ -75,17 +100,21 @@ TEST_F(TradingSystemCommonInstrumentState, WritesToJson) {
 
   const InstrumentState instrument_state{.instrument = instrument,
                                          .last_trade = trade,
+                                         .recent_trades = std::vector{trade},
                                          .info = info,
-                                         .order_book = OrderBook{}};
+                                         .order_book = OrderBook{},
+                                         .journal_generation = 7};
 
   core::json::Type<InstrumentState>::write_json_value(
       value, doc.GetAllocator(), instrument_state);
 
   ASSERT_THAT(value, HasInner("instrument", HasString("symbol", "Symbol")));
   ASSERT_THAT(value, HasInner("last_trade", HasString("buyer", "BuyerId")));
+  ASSERT_THAT(value, HasArraySize("recent_trades", 1));
   ASSERT_THAT(value, HasInner("info", HasDouble("low_price", 3.14)));
   ASSERT_THAT(value, HasInner("order_book", HasArraySize("buy_orders", 0)));
   ASSERT_THAT(value, HasInner("order_book", HasArraySize("sell_orders", 0)));
+  ASSERT_THAT(value, HasUInt64("journal_generation", 7));
 }
 
 }  // namespace
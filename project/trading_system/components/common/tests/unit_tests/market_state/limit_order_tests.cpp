@@ -76,7 +76,8 @@ TEST(TradingSystemCommonLimitOrderFmt, FormatsToString) {
       "GoodTillDate, \"order_id\": 42, \"order_time\": 2023-Oct-01 "
       "13:00:00.123456, \"side\": SellShort, \"order_status\": "
       "PartiallyFilled, \"order_price\": 100.1, \"total_quantity\": 200.2, "
-      "\"cum_executed_quantity\": 50.5 }\"");
+      "\"cum_executed_quantity\": 50.5, \"display_quantity\": none, "
+      "\"hidden_quantity\": none, \"quote\": none }\"");
 }
 
 struct TradingSystemCommonLimitOrder : public ::testing::Test {
@@ -122,6 +123,9 @@ TEST_F(TradingSystemCommonLimitOrder, ReadsFromJson) {
   value.AddMember("order_price", 100.1, doc.GetAllocator());
   value.AddMember("total_quantity", 200.2, doc.GetAllocator());
   value.AddMember("cum_executed_quantity", 50.5, doc.GetAllocator());
+  value.AddMember("display_quantity", 20.5, doc.GetAllocator());
+  value.AddMember("hidden_quantity", 100.5, doc.GetAllocator());
+  value.AddMember("quote", true, doc.GetAllocator());
 
   const auto order = core::json::Type<LimitOrder>::read_json_value(value);
 
@@ -141,6 +145,9 @@ TEST_F(TradingSystemCommonLimitOrder, ReadsFromJson) {
   ASSERT_EQ(order.order_price, OrderPrice{100.1});
   ASSERT_EQ(order.total_quantity, OrderQuantity{200.2});
   ASSERT_EQ(order.cum_executed_quantity, CumExecutedQuantity{50.5});
+  ASSERT_EQ(order.display_quantity, DisplayQuantity{20.5});
+  ASSERT_EQ(order.hidden_quantity, LeavesQuantity{100.5});
+  ASSERT_EQ(order.quote, true);
 }
 
 TEST_F(TradingSystemCommonLimitOrder, WritesToJson) {
@@ -162,7 +169,10 @@ TEST_F(TradingSystemCommonLimitOrder, WritesToJson) {
       .order_status = OrderStatus::Option::PartiallyFilled,
       .order_price = OrderPrice{100.1},
       .total_quantity = OrderQuantity{200.2},
-      .cum_executed_quantity = CumExecutedQuantity{50.5}};
+      .cum_executed_quantity = CumExecutedQuantity{50.5},
+      .display_quantity = DisplayQuantity{20.5},
+      .hidden_quantity = LeavesQuantity{100.5},
+      .quote = true};
 
   core::json::Type<LimitOrder>::write_json_value(
       value, doc.GetAllocator(), order);
@@ -183,6 +193,9 @@ TEST_F(TradingSystemCommonLimitOrder, WritesToJson) {
   ASSERT_THAT(value, HasDouble("order_price", 100.1));
   ASSERT_THAT(value, HasDouble("total_quantity", 200.2));
   ASSERT_THAT(value, HasDouble("cum_executed_quantity", 50.5));
+  ASSERT_THAT(value, HasDouble("display_quantity", 20.5));
+  ASSERT_THAT(value, HasDouble("hidden_quantity", 100.5));
+  ASSERT_THAT(value, HasBool("quote", true));
 }
 
 }  // namespace
@@ -57,6 +57,44 @@ TEST_F(TradingSystemCommonOrderBook, ReadsFromJson) {
   ASSERT_EQ(order_book.buy_orders[0].client_order_id, ClientOrderId{"buy"});
   ASSERT_EQ(order_book.sell_orders.size(), 1);
   ASSERT_EQ(order_book.sell_orders[0].client_order_id, ClientOrderId{"sell"});
+  ASSERT_FALSE(order_book.buy_stop_orders.has_value());
+  ASSERT_FALSE(order_book.sell_stop_orders.has_value());
+  ASSERT_FALSE(order_book.last_order_id.has_value());
+}
+
+TEST_F(TradingSystemCommonOrderBook, ReadsStopOrdersFromJson) {
+  OrderBook stored;
+  StopOrder order;
+  order.client_order_id = ClientOrderId{"buy"};
+  order.stop_price = StopPrice{101.};
+  stored.buy_stop_orders.emplace().push_back(order);
+
+  order.client_order_id = ClientOrderId{"sell"};
+  order.side = Side::Option::Sell;
+  order.stop_price = StopPrice{99.};
+  order.order_price = OrderPrice{98.};
+  stored.sell_stop_orders.emplace().push_back(order);
+  core::json::Type<OrderBook>::write_json_value(
+      value, doc.GetAllocator(), stored);
+
+  const auto order_book = core::json::Type<OrderBook>::read_json_value(value);
+
+  ASSERT_EQ(order_book, stored);
+}
+
+TEST_F(TradingSystemCommonOrderBook, ReadsLastOrderIdFromJson) {
+  value.SetObject();
+  value.AddMember("buy_orders",
+                  rapidjson::Value(rapidjson::Type::kArrayType),
+                  doc.GetAllocator());
+  value.AddMember("sell_orders",
+                  rapidjson::Value(rapidjson::Type::kArrayType),
+                  doc.GetAllocator());
+  value.AddMember("last_order_id", 42, doc.GetAllocator());
+
+  const auto order_book = core::json::Type<OrderBook>::read_json_value(value);
+
+  ASSERT_EQ(order_book.last_order_id, OrderId{42});
 }
 
 TEST_F(TradingSystemCommonOrderBook, WritesEmptyContainersToJson) {
@@ -94,5 +132,35 @@ TEST_F(TradingSystemCommonOrderBook, WritesToJson) {
   ASSERT_THAT(value["sell_orders"][0], HasString("client_order_id", "sell"));
 }
 
+TEST_F(TradingSystemCommonOrderBook, WritesStopOrdersToJson) {
+  using namespace simulator::trading_system::test;
+
+  OrderBook order_book;
+  StopOrder order;
+  order.client_order_id = ClientOrderId{"buy"};
+  order.stop_price = StopPrice{101.};
+  order_book.buy_stop_orders.emplace().push_back(order);
+
+  core::json::Type<OrderBook>::write_json_value(
+      value, doc.GetAllocator(), order_book);
+
+  ASSERT_THAT(value, HasArraySize("buy_stop_orders", 1));
+  ASSERT_THAT(value["buy_stop_orders"][0], HasString("client_order_id", "buy"));
+  ASSERT_THAT(value["buy_stop_orders"][0], HasDouble("stop_price", 101.));
+  ASSERT_THAT(value, HasNull("sell_stop_orders"));
+}
+
+TEST_F(TradingSystemCommonOrderBook, WritesLastOrderIdToJson) {
+  using namespace simulator::trading_system::test;
+
+  OrderBook order_book;
+  order_book.last_order_id = OrderId{42};
+
+  core::json::Type<OrderBook>::write_json_value(
+      value, doc.GetAllocator(), order_book);
+
+  ASSERT_THAT(value, HasUInt64("last_order_id", 42));
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::market_state::test
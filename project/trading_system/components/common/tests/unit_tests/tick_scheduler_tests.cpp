@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "common/events.hpp"
+#include "common/tick_scheduler.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr auto Now = core::sys_us{core::sys_days{2025y / 12 / 30} + 13h};
+
+auto make_tick(core::sys_us time, bool is_new_day = false) -> event::Tick {
+  return event::Tick{.sys_tick_time = time,
+                     .tz_tick_time = core::tz_us{time.time_since_epoch()},
+                     .is_new_sys_day = is_new_day,
+                     .is_new_tz_day = is_new_day};
+}
+
+TEST(TradingSystemTickDeadline, MergesEarliestTime) {
+  TickDeadline deadline{.time = Now + 2s};
+
+  deadline.merge(TickDeadline{.time = Now + 1s});
+  deadline.merge(TickDeadline{.time = Now + 3s});
+
+  EXPECT_EQ(deadline, TickDeadline{.time = Now + 1s});
+}
+
+TEST(TradingSystemTickDeadline, MergesNewDayFlag) {
+  TickDeadline deadline{.time = Now};
+
+  deadline.merge(TickDeadline{.new_day = true});
+
+  EXPECT_EQ(deadline, (TickDeadline{.time = Now, .new_day = true}));
+}
+
+TEST(TradingSystemTickDeadline, IsDueAtItsTime) {
+  const TickDeadline deadline{.time = Now};
+
+  EXPECT_FALSE(deadline.is_due(make_tick(Now - 1s)));
+  EXPECT_TRUE(deadline.is_due(make_tick(Now)));
+  EXPECT_TRUE(deadline.is_due(make_tick(Now + 1s)));
+}
+
+TEST(TradingSystemTickDeadline, IsDueOnNewDay) {
+  const TickDeadline deadline{.new_day = true};
+
+  EXPECT_FALSE(deadline.is_due(make_tick(Now)));
+  EXPECT_TRUE(deadline.is_due(make_tick(Now, /*is_new_day=*/true)));
+}
+
+TEST(TradingSystemTickDeadline, IsEmptyWithoutTimeAndNewDay) {
+  EXPECT_TRUE(TickDeadline{}.empty());
+  EXPECT_FALSE(TickDeadline{.time = Now}.empty());
+  EXPECT_FALSE(TickDeadline{.new_day = true}.empty());
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test
@@ -0,0 +1,165 @@
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <functional>
+#include <variant>
+
+#include "common/instrument.hpp"
+#include "core/domain/instrument_descriptor.hpp"
+#include "ih/instruments_container.hpp"
+#include "ih/lookup/lookup.hpp"
+#include "ih/lookup/match_rate.hpp"
+#include "ih/lookup/strategies.hpp"
+
+// Compares a cost of resolving an instrument descriptor in a large universe
+// by scanning the whole container (as the lookup did before instruments were
+// indexed) and by probing the container's hash index.
+
+namespace {
+
+using simulator::Currency;
+using simulator::InstrumentDescriptor;
+using simulator::PriceCurrency;
+using simulator::SecurityExchange;
+using simulator::SecurityId;
+using simulator::SecurityIdSource;
+using simulator::SecurityType;
+using simulator::Symbol;
+using simulator::trading_system::Instrument;
+using simulator::trading_system::InstrumentId;
+using simulator::trading_system::IsinId;
+using simulator::trading_system::instrument::Container;
+using simulator::trading_system::instrument::lookup::IsinIdLookup;
+using simulator::trading_system::instrument::lookup::Lookup;
+using simulator::trading_system::instrument::lookup::MatchRate;
+using simulator::trading_system::instrument::lookup::SymbolLookup;
+
+// Lists each of `size` securities on two exchanges
+auto make_universe(const std::int64_t size) -> Container {
+  Container container;
+  std::uint64_t identifier = 0;
+  for (std::int64_t security = 0; security < size; ++security) {
+    for (const auto* exchange : {"XLON", "XETR"}) {
+      Instrument instrument;
+      instrument.identifier = InstrumentId{++identifier};
+      instrument.symbol = Symbol{fmt::format("SYM{}", security)};
+      instrument.isin = IsinId{fmt::format("GB{:010}", security)};
+      instrument.security_exchange = SecurityExchange{exchange};
+      instrument.security_type = SecurityType::Option::CommonStock;
+      instrument.price_currency = PriceCurrency{"GBP"};
+      container.emplace(instrument);
+    }
+  }
+  return container;
+}
+
+// Resolves a descriptor with a full container scan
+template <typename Strategy>
+auto scan(const Strategy& strategy, const Container& container)
+    -> const Instrument* {
+  const Instrument* best_match = nullptr;
+  const Instrument* ambiguous_match = nullptr;
+  MatchRate best_rate = MatchRate::Unmatchable;
+  for (const auto& instrument : container) {
+    const auto rate = strategy(instrument);
+    if (rate <= MatchRate::Unmatchable) {
+      continue;
+    }
+    if (rate > best_rate) {
+      best_rate = rate;
+      best_match = &instrument;
+      ambiguous_match = nullptr;
+    } else if (rate == best_rate) {
+      ambiguous_match = &instrument;
+    }
+  }
+  return ambiguous_match == nullptr ? best_match : nullptr;
+}
+
+auto make_symbol_descriptor(const std::int64_t size) -> InstrumentDescriptor {
+  InstrumentDescriptor descriptor;
+  descriptor.symbol = Symbol{fmt::format("SYM{}", size - 1)};
+  descriptor.security_exchange = SecurityExchange{"XETR"};
+  return descriptor;
+}
+
+auto make_isin_descriptor(const std::int64_t size) -> InstrumentDescriptor {
+  InstrumentDescriptor descriptor;
+  descriptor.security_id = SecurityId{fmt::format("GB{:010}", size - 1)};
+  descriptor.security_id_source = SecurityIdSource::Option::Isin;
+  descriptor.security_type = SecurityType::Option::CommonStock;
+  descriptor.currency = Currency{"GBP"};
+  descriptor.security_exchange = SecurityExchange{"XLON"};
+  return descriptor;
+}
+
+auto BM_lookup_by_symbol_scan(benchmark::State& state) -> void {
+  const auto container = make_universe(state.range(0));
+  const auto descriptor = make_symbol_descriptor(state.range(0));
+  const auto strategy = SymbolLookup::create(descriptor);
+
+  for (auto _ : state) {
+    const auto* instrument = scan(*strategy, container);
+    benchmark::DoNotOptimize(instrument);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+auto BM_lookup_by_symbol_index(benchmark::State& state) -> void {
+  const auto container = make_universe(state.range(0));
+  const auto descriptor = make_symbol_descriptor(state.range(0));
+  const auto lookup = Lookup::create(descriptor);
+
+  for (auto _ : state) {
+    auto view = std::invoke(*lookup, container);
+    benchmark::DoNotOptimize(view);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+auto BM_lookup_by_isin_scan(benchmark::State& state) -> void {
+  const auto container = make_universe(state.range(0));
+  const auto descriptor = make_isin_descriptor(state.range(0));
+  const auto strategy = IsinIdLookup::create(descriptor);
+
+  for (auto _ : state) {
+    const auto* instrument = scan(*strategy, container);
+    benchmark::DoNotOptimize(instrument);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+auto BM_lookup_by_isin_index(benchmark::State& state) -> void {
+  const auto container = make_universe(state.range(0));
+  const auto descriptor = make_isin_descriptor(state.range(0));
+  const auto lookup = Lookup::create(descriptor);
+
+  for (auto _ : state) {
+    auto view = std::invoke(*lookup, container);
+    benchmark::DoNotOptimize(view);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_lookup_by_symbol_scan)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000)
+    ->Complexity(benchmark::oN);
+
+BENCHMARK(BM_lookup_by_symbol_index)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000)
+    ->Complexity(benchmark::o1);
+
+BENCHMARK(BM_lookup_by_isin_scan)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000)
+    ->Complexity(benchmark::oN);
+
+BENCHMARK(BM_lookup_by_isin_index)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000)
+    ->Complexity(benchmark::o1);
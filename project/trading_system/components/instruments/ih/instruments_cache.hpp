@@ -1,6 +1,8 @@
 #ifndef SIMULATOR_INSTRUMENTS_IH_INSTRUMENTS_CACHE_HPP_
 #define SIMULATOR_INSTRUMENTS_IH_INSTRUMENTS_CACHE_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <tl/expected.hpp>
 #include <vector>
 
@@ -29,11 +31,16 @@ struct Cache::Implementation {
 
   auto container() const -> const Container& { return container_; }
 
+  auto generation() const noexcept -> std::uint64_t {
+    return generation_.load(std::memory_order_acquire);
+  }
+
  private:
   [[nodiscard]] auto generate_new_id() -> InstrumentId;
 
   Container container_{};
   idgen::InstrumentIdContext id_generation_context_;
+  std::atomic<std::uint64_t> generation_{0};
 };
 
 }  // namespace simulator::trading_system::instrument
@@ -2,10 +2,13 @@
 #define SIMULATOR_INSTRUMENTS_IH_INSTRUMENTS_CONTAINER_HPP_
 
 #include <algorithm>
+#include <optional>
+#include <string_view>
 #include <vector>
 
 #include "common/instrument.hpp"
 #include "idgen/instrument_id.hpp"
+#include "ih/instruments_index.hpp"
 
 namespace simulator::trading_system::instrument {
 
@@ -18,6 +21,20 @@ class Container {
   using const_iterator = typename Storage::const_iterator;
   using iterator = const_iterator;
 
+  Container() = default;
+  Container(const Container& other) : storage_(other.storage_) { reindex(); }
+  Container(Container&&) noexcept = default;
+  ~Container() = default;
+
+  auto operator=(const Container& other) -> Container& {
+    if (this != &other) {
+      storage_ = other.storage_;
+      reindex();
+    }
+    return *this;
+  }
+  auto operator=(Container&&) noexcept -> Container& = default;
+
   [[nodiscard]] auto begin() const noexcept -> const_iterator {
     return storage_.begin();
   }
@@ -39,6 +56,16 @@ class Container {
     return pos != end() && (pos->identifier == identifier) ? pos : end();
   }
 
+  // Searches for instruments having a given identifying attribute value
+  // with a hash index, see `Index::find` for details.
+  [[nodiscard]] auto find_by_attribute(
+      IndexedAttribute attribute,
+      std::string_view value,
+      std::optional<std::string_view> security_exchange) const
+      -> Index::Instruments {
+    return index_.find(attribute, value, security_exchange);
+  }
+
   // Inserts a new instrument into container and returns an interator to it.
   // Does not insert anything when other instrument with the same identifier
   // already exists in the container. An end iterator is returned in this case.
@@ -47,7 +74,20 @@ class Container {
     if (pos != end() && pos->identifier == instrument.identifier) {
       return end();
     }
-    return storage_.emplace(pos, instrument);
+
+    // Instruments are relocated when inserted in the middle or when
+    // the storage grows, the whole index is rebuilt in O(n) then.
+    // Appending an instrument is amortized O(1) as the growth is geometric,
+    // inserting one in the middle is O(n) each time.
+    const bool relocates =
+        pos != end() || storage_.size() == storage_.capacity();
+    const auto inserted = storage_.emplace(pos, instrument);
+    if (relocates) {
+      reindex();
+    } else {
+      index_.add(*inserted);
+    }
+    return inserted;
   }
 
  private:
@@ -62,7 +102,15 @@ class Container {
     return std::lower_bound(begin(), end(), identifier, make_comparator());
   }
 
+  auto reindex() -> void {
+    index_.clear();
+    for (const auto& instrument : storage_) {
+      index_.add(instrument);
+    }
+  }
+
   Storage storage_;
+  Index index_;
 };
 
 }  // namespace simulator::trading_system::instrument
@@ -0,0 +1,107 @@
+#ifndef SIMULATOR_INSTRUMENTS_IH_INSTRUMENTS_INDEX_HPP_
+#define SIMULATOR_INSTRUMENTS_IH_INSTRUMENTS_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/instrument.hpp"
+
+namespace simulator::trading_system::instrument {
+
+// Instrument attributes, which identify an instrument on their own
+// (symbol) or together with a security identifier source (ID + IDSource)
+enum class IndexedAttribute : std::uint8_t {
+  Symbol,
+  Sedol,
+  Cusip,
+  Isin,
+  Ric,
+  ExchangeId,
+  BloombergId
+};
+
+// Hash index of instruments by identifying attribute values.
+//
+// Each instrument is indexed by every identifying attribute it has,
+// both alone and composed with the instrument's security exchange,
+// so that a descriptor, which specifies the security exchange,
+// selects only instruments listed on the exchange.
+//
+// The index keeps pointers to indexed instruments,
+// it must be rebuilt once the instruments are relocated.
+class Index {
+ public:
+  using Instruments = std::span<const Instrument* const>;
+
+  auto add(const Instrument& instrument) -> void;
+
+  auto clear() noexcept -> void;
+
+  // Returns instruments having a given attribute value in order
+  // they were added to the index. When a security exchange is specified,
+  // only instruments listed on the exchange are returned.
+  [[nodiscard]]
+  auto find(IndexedAttribute attribute,
+            std::string_view value,
+            std::optional<std::string_view> security_exchange) const
+      -> Instruments;
+
+ private:
+  struct Key {
+    IndexedAttribute attribute;
+    std::string_view value;
+    std::optional<std::string_view> security_exchange;
+
+    [[nodiscard]]
+    auto operator==(const Key& other) const -> bool = default;
+  };
+
+  struct StoredKey {
+    IndexedAttribute attribute;
+    std::string value;
+    std::optional<std::string> security_exchange;
+
+    [[nodiscard]]
+    auto view() const -> Key;
+  };
+
+  struct KeyHash {
+    using is_transparent = void;
+
+    auto operator()(const Key& key) const noexcept -> std::size_t;
+    auto operator()(const StoredKey& key) const noexcept -> std::size_t;
+  };
+
+  struct KeyEqual {
+    using is_transparent = void;
+
+    auto operator()(const auto& lhs, const auto& rhs) const -> bool {
+      return view(lhs) == view(rhs);
+    }
+
+   private:
+    static auto view(const Key& key) -> Key { return key; }
+    static auto view(const StoredKey& key) -> Key { return key.view(); }
+  };
+
+  auto add(IndexedAttribute attribute,
+           const std::optional<std::string_view>& value,
+           const Instrument& instrument) -> void;
+
+  std::unordered_map<StoredKey,
+                     std::vector<const Instrument*>,
+                     KeyHash,
+                     KeyEqual>
+      buckets_;
+};
+
+}  // namespace simulator::trading_system::instrument
+
+#endif  // SIMULATOR_INSTRUMENTS_IH_INSTRUMENTS_INDEX_HPP_
@@ -5,6 +5,8 @@
 
 #include "common/instrument.hpp"
 #include "core/domain/instrument_descriptor.hpp"
+#include "ih/instruments_container.hpp"
+#include "ih/instruments_index.hpp"
 #include "ih/lookup/match_rate.hpp"
 #include "instruments/lookup_error.hpp"
 
@@ -18,6 +20,11 @@ class SymbolLookup {
   auto
   operator()(const Instrument& instrument) const -> MatchRate;
 
+  // Selects instruments, which may match the descriptor,
+  // instruments not selected are never matched by the strategy
+  [[nodiscard]]
+  auto select(const Container& container) const -> Index::Instruments;
+
   [[nodiscard]]
   static auto create(const InstrumentDescriptor& descriptor)
       -> tl::expected<SymbolLookup, LookupError>;
@@ -36,6 +43,9 @@ class SedolIdLookup {
   auto
   operator()(const Instrument& instrument) const -> MatchRate;
 
+  [[nodiscard]]
+  auto select(const Container& container) const -> Index::Instruments;
+
   [[nodiscard]]
   static auto create(const InstrumentDescriptor& descriptor)
       -> tl::expected<SedolIdLookup, LookupError>;
@@ -54,6 +64,9 @@ class CusipIdLookup {
   auto
   operator()(const Instrument& instrument) const -> MatchRate;
 
+  [[nodiscard]]
+  auto select(const Container& container) const -> Index::Instruments;
+
   [[nodiscard]]
   static auto create(const InstrumentDescriptor& descriptor)
       -> tl::expected<CusipIdLookup, LookupError>;
@@ -72,6 +85,9 @@ class IsinIdLookup {
   auto
   operator()(const Instrument& instrument) const -> MatchRate;
 
+  [[nodiscard]]
+  auto select(const Container& container) const -> Index::Instruments;
+
   [[nodiscard]]
   static auto create(const InstrumentDescriptor& descriptor)
       -> tl::expected<IsinIdLookup, LookupError>;
@@ -90,6 +106,9 @@ class RicIdLookup {
   auto
   operator()(const Instrument& instrument) const -> MatchRate;
 
+  [[nodiscard]]
+  auto select(const Container& container) const -> Index::Instruments;
+
   [[nodiscard]]
   static auto create(const InstrumentDescriptor& descriptor)
       -> tl::expected<RicIdLookup, LookupError>;
@@ -108,6 +127,9 @@ class ExchangeIdLookup {
   auto
   operator()(const Instrument& instrument) const -> MatchRate;
 
+  [[nodiscard]]
+  auto select(const Container& container) const -> Index::Instruments;
+
   [[nodiscard]]
   static auto create(const InstrumentDescriptor& descriptor)
       -> tl::expected<ExchangeIdLookup, LookupError>;
@@ -126,6 +148,9 @@ class BloombergIdLookup {
   auto
   operator()(const Instrument& instrument) const -> MatchRate;
 
+  [[nodiscard]]
+  auto select(const Container& container) const -> Index::Instruments;
+
   [[nodiscard]]
   static auto create(const InstrumentDescriptor& descriptor)
       -> tl::expected<BloombergIdLookup, LookupError>;
@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_INSTRUMENTS_CACHE_HPP_
 #define SIMULATOR_TRADING_SYSTEM_COMPONENTS_INSTRUMENTS_CACHE_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <tl/expected.hpp>
 #include <vector>
@@ -36,6 +37,11 @@ class Cache {
   [[nodiscard]]
   auto retrieve_instruments() const -> std::vector<Instrument>;
 
+  // Changes each time the cached instruments are modified (e.g. reloaded),
+  // results derived from the cache are stale once the generation changes
+  [[nodiscard]]
+  auto generation() const noexcept -> std::uint64_t;
+
   auto load(const struct DatabaseSource& source) -> void;
 
   auto load(const struct MemorySource& source) -> void;
@@ -1,3 +1,4 @@
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 #include <tl/expected.hpp>
@@ -52,6 +53,10 @@ auto Cache::retrieve_instruments() const -> std::vector<Instrument> {
   return impl().retrieve_instruments();
 }
 
+auto Cache::generation() const noexcept -> std::uint64_t {
+  return impl().generation();
+}
+
 auto Cache::load(const DatabaseSource& source) -> void {
   load_instruments(source);
   log::info("loaded instruments from database source into cache");
@@ -28,6 +28,8 @@ auto Cache::Implementation::add_instrument(Instrument instrument) -> void {
     throw std::runtime_error{"internal identifier collision detected"};
   }
 
+  generation_.fetch_add(1, std::memory_order_release);
+
   log::info("cached instrument - {}", instrument);
 }
 
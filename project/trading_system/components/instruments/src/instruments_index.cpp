@@ -0,0 +1,93 @@
+#include "ih/instruments_index.hpp"
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace simulator::trading_system::instrument {
+
+namespace {
+
+template <typename T>
+auto value_of(const std::optional<T>& attribute)
+    -> std::optional<std::string_view> {
+  if (!attribute.has_value()) {
+    return std::nullopt;
+  }
+  return std::string_view{static_cast<const std::string&>(*attribute)};
+}
+
+auto combine(std::size_t seed, std::size_t hash) noexcept -> std::size_t {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+}  // namespace
+
+auto Index::add(const Instrument& instrument) -> void {
+  add(IndexedAttribute::Symbol, value_of(instrument.symbol), instrument);
+  add(IndexedAttribute::Sedol, value_of(instrument.sedol), instrument);
+  add(IndexedAttribute::Cusip, value_of(instrument.cusip), instrument);
+  add(IndexedAttribute::Isin, value_of(instrument.isin), instrument);
+  add(IndexedAttribute::Ric, value_of(instrument.ric), instrument);
+  add(IndexedAttribute::ExchangeId,
+      value_of(instrument.exchange_id),
+      instrument);
+  add(IndexedAttribute::BloombergId,
+      value_of(instrument.bloomberg_id),
+      instrument);
+}
+
+auto Index::clear() noexcept -> void { buckets_.clear(); }
+
+auto Index::find(IndexedAttribute attribute,
+                 std::string_view value,
+                 std::optional<std::string_view> security_exchange) const
+    -> Instruments {
+  const auto bucket = buckets_.find(Key{attribute, value, security_exchange});
+  return bucket != buckets_.end() ? Instruments{bucket->second}
+                                  : Instruments{};
+}
+
+auto Index::add(IndexedAttribute attribute,
+                const std::optional<std::string_view>& value,
+                const Instrument& instrument) -> void {
+  if (!value.has_value()) {
+    return;
+  }
+
+  buckets_[StoredKey{attribute, std::string{*value}, std::nullopt}].push_back(
+      &instrument);
+
+  if (const auto exchange = value_of(instrument.security_exchange)) {
+    buckets_[StoredKey{attribute, std::string{*value}, std::string{*exchange}}]
+        .push_back(&instrument);
+  }
+}
+
+auto Index::StoredKey::view() const -> Key {
+  return Key{attribute,
+             value,
+             security_exchange.has_value()
+                 ? std::optional<std::string_view>{*security_exchange}
+                 : std::nullopt};
+}
+
+auto Index::KeyHash::operator()(const Key& key) const noexcept
+    -> std::size_t {
+  std::size_t seed = std::hash<IndexedAttribute>{}(key.attribute);
+  seed = combine(seed, std::hash<std::string_view>{}(key.value));
+  if (key.security_exchange.has_value()) {
+    seed = combine(seed,
+                   std::hash<std::string_view>{}(*key.security_exchange));
+  }
+  return seed;
+}
+
+auto Index::KeyHash::operator()(const StoredKey& key) const noexcept
+    -> std::size_t {
+  return (*this)(key.view());
+}
+
+}  // namespace simulator::trading_system::instrument
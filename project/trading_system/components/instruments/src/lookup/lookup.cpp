@@ -32,21 +32,27 @@ auto Lookup::operator()(const Container& container) const
         [&](const auto& strategy) { return strategy(instrument); }, strategy_);
   };
 
+  // Only instruments selected by an index probe may match the descriptor,
+  // the rest of the container is not scanned
+  const auto candidates = std::visit(
+      [&](const auto& strategy) { return strategy.select(container); },
+      strategy_);
+
   struct {
     const Instrument* best_match = nullptr;
     const Instrument* ambiguous_match = nullptr;
     MatchRate rate = MatchRate::Unmatchable;
   } ctx;
 
-  for (const auto& instrument : container) {
-    if (const auto rate = calculate_rate(instrument);
+  for (const Instrument* instrument : candidates) {
+    if (const auto rate = calculate_rate(*instrument);
         rate > MatchRate::Unmatchable) {
       if (rate > ctx.rate) {
         ctx.rate = rate;
-        ctx.best_match = &instrument;
+        ctx.best_match = instrument;
         ctx.ambiguous_match = nullptr;
       } else if (rate == ctx.rate) {
-        ctx.ambiguous_match = &instrument;
+        ctx.ambiguous_match = instrument;
       }
     }
   }
@@ -1,8 +1,12 @@
 #include "ih/lookup/strategies.hpp"
 
 #include <optional>
+#include <string>
+#include <string_view>
 #include <tl/expected.hpp>
 
+#include "ih/instruments_container.hpp"
+#include "ih/instruments_index.hpp"
 #include "ih/lookup/matchers.hpp"
 
 namespace simulator::trading_system::instrument::lookup {
@@ -14,6 +18,21 @@ constexpr auto missing(const std::optional<T>& attribute) -> bool {
   return !attribute.has_value();
 }
 
+// Instruments listed on another exchange are never matched,
+// so a specified security exchange narrows the selection
+auto select_by(const Container& container,
+               IndexedAttribute attribute,
+               const auto& value,
+               const InstrumentDescriptor& descriptor) -> Index::Instruments {
+  const auto& exchange = descriptor.security_exchange;
+  return container.find_by_attribute(
+      attribute,
+      static_cast<const std::string&>(value),
+      exchange.has_value() ? std::optional<std::string_view>{
+                                 static_cast<const std::string&>(*exchange)}
+                           : std::nullopt);
+}
+
 }  // namespace
 
 SymbolLookup::SymbolLookup(const InstrumentDescriptor& descriptor)
@@ -29,6 +48,14 @@ auto SymbolLookup::operator()(const Instrument& instrument) const
   return matcher(*descriptor_, instrument);
 }
 
+auto SymbolLookup::select(const Container& container) const
+    -> Index::Instruments {
+  return select_by(container,
+                   IndexedAttribute::Symbol,
+                   *descriptor_->symbol,
+                   *descriptor_);
+}
+
 auto SymbolLookup::create(const InstrumentDescriptor& descriptor)
     -> tl::expected<SymbolLookup, LookupError> {
   if (missing(descriptor.symbol)) [[unlikely]] {
@@ -51,6 +78,14 @@ auto SedolIdLookup::operator()(const Instrument& instrument) const
   return matcher(*descriptor_, instrument);
 }
 
+auto SedolIdLookup::select(const Container& container) const
+    -> Index::Instruments {
+  return select_by(container,
+                   IndexedAttribute::Sedol,
+                   *descriptor_->security_id,
+                   *descriptor_);
+}
+
 auto SedolIdLookup::create(const InstrumentDescriptor& descriptor)
     -> tl::expected<SedolIdLookup, LookupError> {
   if (descriptor.security_id_source != SecurityIdSource::Option::Sedol ||
@@ -74,6 +109,14 @@ auto CusipIdLookup::operator()(const Instrument& instrument) const
   return matcher(*descriptor_, instrument);
 }
 
+auto CusipIdLookup::select(const Container& container) const
+    -> Index::Instruments {
+  return select_by(container,
+                   IndexedAttribute::Cusip,
+                   *descriptor_->security_id,
+                   *descriptor_);
+}
+
 auto CusipIdLookup::create(const InstrumentDescriptor& descriptor)
     -> tl::expected<CusipIdLookup, LookupError> {
   if (descriptor.security_id_source != SecurityIdSource::Option::Cusip ||
@@ -97,6 +140,14 @@ auto IsinIdLookup::operator()(const Instrument& instrument) const
   return matcher(*descriptor_, instrument);
 }
 
+auto IsinIdLookup::select(const Container& container) const
+    -> Index::Instruments {
+  return select_by(container,
+                   IndexedAttribute::Isin,
+                   *descriptor_->security_id,
+                   *descriptor_);
+}
+
 auto IsinIdLookup::create(const InstrumentDescriptor& descriptor)
     -> tl::expected<IsinIdLookup, LookupError> {
   if (descriptor.security_id_source != SecurityIdSource::Option::Isin ||
@@ -129,6 +180,14 @@ auto RicIdLookup::operator()(const Instrument& instrument) const
   return matcher(*descriptor_, instrument);
 }
 
+auto RicIdLookup::select(const Container& container) const
+    -> Index::Instruments {
+  return select_by(container,
+                   IndexedAttribute::Ric,
+                   *descriptor_->security_id,
+                   *descriptor_);
+}
+
 auto RicIdLookup::create(const InstrumentDescriptor& descriptor)
     -> tl::expected<RicIdLookup, LookupError> {
   if (descriptor.security_id_source != SecurityIdSource::Option::Ric ||
@@ -152,6 +211,14 @@ auto ExchangeIdLookup::operator()(const Instrument& instrument) const
   return matcher(*descriptor_, instrument);
 }
 
+auto ExchangeIdLookup::select(const Container& container) const
+    -> Index::Instruments {
+  return select_by(container,
+                   IndexedAttribute::ExchangeId,
+                   *descriptor_->security_id,
+                   *descriptor_);
+}
+
 auto ExchangeIdLookup::create(const InstrumentDescriptor& descriptor)
     -> tl::expected<ExchangeIdLookup, LookupError> {
   if (missing(descriptor.security_id) ||
@@ -176,6 +243,14 @@ auto BloombergIdLookup::operator()(const Instrument& instrument) const
   return matcher(*descriptor_, instrument);
 }
 
+auto BloombergIdLookup::select(const Container& container) const
+    -> Index::Instruments {
+  return select_by(container,
+                   IndexedAttribute::BloombergId,
+                   *descriptor_->security_id,
+                   *descriptor_);
+}
+
 auto BloombergIdLookup::create(const InstrumentDescriptor& descriptor)
     -> tl::expected<BloombergIdLookup, LookupError> {
   if (missing(descriptor.security_id) ||
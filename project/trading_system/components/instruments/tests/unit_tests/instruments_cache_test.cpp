@@ -35,6 +35,14 @@ TEST_F(InstrumentsInstrumentsCache, AddsSeveralInstruments) {
                           Field(&Instrument::identifier, Eq(InstrumentId{2}))));
 }
 
+TEST_F(InstrumentsInstrumentsCache, ChangesGenerationWhenInstrumentAdded) {
+  const auto initial = cache.generation();
+
+  cache.add_instrument(make_instrument(InstrumentId{9}));
+
+  EXPECT_NE(cache.generation(), initial);
+}
+
 TEST_F(InstrumentsInstrumentsCache, RetrieveEmptyCache) {
   const std::vector<Instrument> instruments = cache.retrieve_instruments();
 
@@ -3,6 +3,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <vector>
+
 #include "test_utils/utils.hpp"
 
 namespace simulator::trading_system::instrument::test {
@@ -12,6 +15,13 @@ using namespace ::testing;
 
 struct InstrumentsInstrumentsContainer : public Test {
   Container container;
+
+  static auto find_by_symbol(const Container& container, const char* symbol)
+      -> std::vector<const Instrument*> {
+    const auto found = container.find_by_attribute(
+        IndexedAttribute::Symbol, symbol, std::nullopt);
+    return {found.begin(), found.end()};
+  }
 };
 
 // NOLINTBEGIN(*-magic-numbers)
@@ -86,6 +96,35 @@ TEST_F(InstrumentsInstrumentsContainer,
   EXPECT_EQ(found_it, container.end());
 }
 
+TEST_F(InstrumentsInstrumentsContainer, FindsInstrumentsByIndexedAttribute) {
+  for (const auto identifier : {43, 41, 42}) {
+    auto instrument = make_instrument(InstrumentId{identifier});
+    instrument.symbol = Symbol{identifier == 42 ? "MSFT" : "AAPL"};
+    container.emplace(instrument);
+  }
+
+  EXPECT_THAT(
+      find_by_symbol(container, "AAPL"),
+      ElementsAre(
+          Pointee(Field(&Instrument::identifier, Eq(InstrumentId{41}))),
+          Pointee(Field(&Instrument::identifier, Eq(InstrumentId{43})))));
+  EXPECT_THAT(
+      find_by_symbol(container, "MSFT"),
+      ElementsAre(
+          Pointee(Field(&Instrument::identifier, Eq(InstrumentId{42})))));
+}
+
+TEST_F(InstrumentsInstrumentsContainer, IndexesCopiedInstruments) {
+  auto instrument = make_instrument(InstrumentId{42});
+  instrument.symbol = Symbol{"AAPL"};
+  container.emplace(instrument);
+
+  const Container copy{container};
+  container = Container{};
+
+  EXPECT_THAT(find_by_symbol(copy, "AAPL"), ElementsAre(&*copy.begin()));
+}
+
 // NOLINTEND(*-magic-numbers)
 
 }  // namespace
@@ -0,0 +1,101 @@
+#include "ih/instruments_index.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "test_utils/utils.hpp"
+
+namespace simulator::trading_system::instrument::test {
+namespace {
+
+using namespace ::testing;
+
+struct InstrumentsIndex : public Test {
+  Index index;
+
+  auto find(IndexedAttribute attribute,
+            std::string_view value,
+            std::optional<std::string_view> exchange) const
+      -> std::vector<const Instrument*> {
+    const auto found = index.find(attribute, value, exchange);
+    return {found.begin(), found.end()};
+  }
+
+  static auto make_listing(InstrumentId identifier,
+                           const char* symbol,
+                           std::optional<const char*> exchange)
+      -> Instrument {
+    Instrument instrument = make_instrument(identifier);
+    instrument.symbol = Symbol{symbol};
+    if (exchange.has_value()) {
+      instrument.security_exchange = SecurityExchange{*exchange};
+    }
+    return instrument;
+  }
+};
+
+// NOLINTBEGIN(*-magic-numbers)
+
+TEST_F(InstrumentsIndex, FindsNothingInEmptyIndex) {
+  EXPECT_THAT(find(IndexedAttribute::Symbol, "AAPL", std::nullopt),
+              IsEmpty());
+}
+
+TEST_F(InstrumentsIndex, FindsInstrumentBySymbol) {
+  const auto instrument = make_listing(InstrumentId{1}, "AAPL", "XNAS");
+  index.add(instrument);
+
+  EXPECT_THAT(find(IndexedAttribute::Symbol, "AAPL", std::nullopt),
+              ElementsAre(&instrument));
+  EXPECT_THAT(find(IndexedAttribute::Symbol, "MSFT", std::nullopt),
+              IsEmpty());
+}
+
+TEST_F(InstrumentsIndex, FindsInstrumentBySymbolAndSecurityExchange) {
+  const auto nasdaq = make_listing(InstrumentId{1}, "AAPL", "XNAS");
+  const auto nyse = make_listing(InstrumentId{2}, "AAPL", "XNYS");
+  index.add(nasdaq);
+  index.add(nyse);
+
+  EXPECT_THAT(find(IndexedAttribute::Symbol, "AAPL", "XNYS"),
+              ElementsAre(&nyse));
+  EXPECT_THAT(find(IndexedAttribute::Symbol, "AAPL", std::nullopt),
+              ElementsAre(&nasdaq, &nyse));
+}
+
+TEST_F(InstrumentsIndex, DoesNotFindInstrumentWithoutSecurityExchange) {
+  const auto instrument = make_listing(InstrumentId{1}, "AAPL", std::nullopt);
+  index.add(instrument);
+
+  EXPECT_THAT(find(IndexedAttribute::Symbol, "AAPL", "XNAS"), IsEmpty());
+}
+
+TEST_F(InstrumentsIndex, KeysSecurityIdBySource) {
+  Instrument instrument = make_instrument(InstrumentId{1});
+  instrument.isin = IsinId{"US0378331005"};
+  index.add(instrument);
+
+  EXPECT_THAT(find(IndexedAttribute::Isin, "US0378331005", std::nullopt),
+              ElementsAre(&instrument));
+  EXPECT_THAT(find(IndexedAttribute::Cusip, "US0378331005", std::nullopt),
+              IsEmpty());
+}
+
+TEST_F(InstrumentsIndex, FindsNothingAfterClear) {
+  const auto instrument = make_listing(InstrumentId{1}, "AAPL", "XNAS");
+  index.add(instrument);
+
+  index.clear();
+
+  EXPECT_THAT(find(IndexedAttribute::Symbol, "AAPL", std::nullopt),
+              IsEmpty());
+}
+
+// NOLINTEND(*-magic-numbers)
+
+}  // namespace
+}  // namespace simulator::trading_system::instrument::test
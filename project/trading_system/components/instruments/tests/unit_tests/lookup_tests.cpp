@@ -158,5 +158,67 @@ TEST_F(InstrumentsLookup, ReportsDescriptorAmbiguous) {
   EXPECT_EQ(view.error(), LookupError::AmbiguousInstrumentDescriptor);
 }
 
+TEST_F(InstrumentsLookup, FindsInstrumentBySymbolOnSecurityExchange) {
+  container.emplace([] {
+    Instrument instrument;
+    instrument.identifier = InstrumentId{4};
+    instrument.symbol = Symbol{"listed-symbol"};
+    instrument.security_exchange = SecurityExchange{"XLON"};
+    return instrument;
+  }());
+  container.emplace([] {
+    Instrument instrument;
+    instrument.identifier = InstrumentId{5};
+    instrument.symbol = Symbol{"listed-symbol"};
+    instrument.security_exchange = SecurityExchange{"XETR"};
+    return instrument;
+  }());
+  descriptor.symbol = Symbol{"listed-symbol"};
+  descriptor.security_exchange = SecurityExchange{"XETR"};
+  const auto lookup = Lookup::create(descriptor);
+  ASSERT_TRUE(lookup.has_value());
+
+  const auto view = (*lookup)(container);
+
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(view->instrument().identifier, InstrumentId{5});
+}
+
+TEST_F(InstrumentsLookup, FindsInstrumentBySecurityIdOfGivenSource) {
+  container.emplace([] {
+    Instrument instrument;
+    instrument.identifier = InstrumentId{4};
+    instrument.cusip = CusipId{"037833100"};
+    return instrument;
+  }());
+  container.emplace([] {
+    Instrument instrument;
+    instrument.identifier = InstrumentId{5};
+    instrument.sedol = SedolId{"037833100"};
+    return instrument;
+  }());
+  descriptor.security_id = SecurityId{"037833100"};
+  descriptor.security_id_source = SecurityIdSource::Option::Sedol;
+  const auto lookup = Lookup::create(descriptor);
+  ASSERT_TRUE(lookup.has_value());
+
+  const auto view = (*lookup)(container);
+
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(view->instrument().identifier, InstrumentId{5});
+}
+
+TEST_F(InstrumentsLookup, ReportsInstrumentNotFoundOnOtherSecurityExchange) {
+  descriptor.symbol = Symbol{"unique-symbol"};
+  descriptor.security_exchange = SecurityExchange{"XLON"};
+  const auto lookup = Lookup::create(descriptor);
+  ASSERT_TRUE(lookup.has_value());
+
+  const auto view = (*lookup)(container);
+
+  ASSERT_FALSE(view.has_value());
+  EXPECT_EQ(view.error(), LookupError::InstrumentNotFound);
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::instrument::lookup::tests
\ No newline at end of file
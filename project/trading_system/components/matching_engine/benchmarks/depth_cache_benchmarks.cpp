@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ih/common/events/order_book_notification.hpp"
+#include "ih/market_data/cache/depth_cache.hpp"
+#include "ih/market_data/tools/market_entry_id_generator.hpp"
+#include "protocol/app/instrument_state_request.hpp"
+
+namespace {
+
+namespace mdata = simulator::trading_system::matching_engine::mdata;
+
+using simulator::Price;
+using simulator::Quantity;
+using simulator::Side;
+using simulator::trading_system::OrderId;
+using simulator::trading_system::matching_engine::OrderAdded;
+using simulator::trading_system::matching_engine::OrderBookNotification;
+
+// Creates a two-sided book with the given number of distinct levels per side
+auto make_depth(const std::int64_t levels)
+    -> std::vector<OrderBookNotification> {
+  std::vector<OrderBookNotification> depth;
+  depth.reserve(static_cast<std::size_t>(levels) * 2);
+
+  std::uint64_t order_id = 0;
+  for (std::int64_t level = 0; level < levels; ++level) {
+    const auto distance = static_cast<double>(level + 1);
+    depth.emplace_back(OrderAdded{.order_price = Price(10000 - distance),
+                                  .order_quantity = Quantity(100),
+                                  .order_id = OrderId(++order_id),
+                                  .order_side = Side::Option::Buy});
+    depth.emplace_back(OrderAdded{.order_price = Price(10000 + distance),
+                                  .order_quantity = Quantity(100),
+                                  .order_id = OrderId(++order_id),
+                                  .order_side = Side::Option::Sell});
+  }
+  return depth;
+}
+
+auto BM_depth_cache_capture(benchmark::State& state) -> void {
+  const auto idgen = mdata::MarketEntryIdGenerator::create();
+  mdata::DepthCache cache{*idgen};
+  cache.update(make_depth(state.range(0)));
+
+  for (auto _ : state) {
+    simulator::protocol::InstrumentState instrument_state;
+    cache.capture(instrument_state);
+    benchmark::DoNotOptimize(instrument_state);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_depth_cache_capture)
+    ->RangeMultiplier(10)
+    ->Range(10, 100'000)
+    ->Complexity(benchmark::o1);
+
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "ih/common/events/client_notification.hpp"
+#include "ih/common/events/event.hpp"
+#include "ih/common/events/order_book_notification.hpp"
+#include "ih/dispatching/event_dispatcher.hpp"
+#include "ih/dispatching/static_event_dispatcher.hpp"
+
+// Compares a per-event cost of dispatching an order book notification with
+// handlers registered at runtime (EventDispatcher) and with handlers known
+// at compile time (StaticEventDispatcher). Both variants are called through
+// the EventListener interface, as engine components do.
+
+namespace {
+
+using simulator::Price;
+using simulator::Side;
+using simulator::trading_system::OrderId;
+using simulator::trading_system::matching_engine::ClientNotification;
+using simulator::trading_system::matching_engine::Event;
+using simulator::trading_system::matching_engine::EventDispatcher;
+using simulator::trading_system::matching_engine::EventListener;
+using simulator::trading_system::matching_engine::OrderBookNotification;
+using simulator::trading_system::matching_engine::OrderRemoved;
+using simulator::trading_system::matching_engine::StaticEventDispatcher;
+
+struct CountingClientHandler {
+  auto handle([[maybe_unused]] ClientNotification notification) -> void {
+    handled++;
+  }
+
+  std::uint64_t handled = 0;
+};
+
+struct CountingOrderBookHandler {
+  auto handle([[maybe_unused]] OrderBookNotification notification) -> void {
+    handled++;
+  }
+
+  std::uint64_t handled = 0;
+};
+
+auto make_notification() -> OrderBookNotification {
+  return OrderBookNotification{OrderRemoved{.order_price = Price(100),
+                                            .order_id = OrderId(1),
+                                            .order_side = Side::Option::Buy}};
+}
+
+auto emit_events(benchmark::State& state, EventListener& listener) -> void {
+  const auto notification = make_notification();
+  for (auto _ : state) {
+    listener.on(Event{notification});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+auto BM_runtime_event_dispatch(benchmark::State& state) -> void {
+  CountingClientHandler client_handler;
+  CountingOrderBookHandler order_book_handler;
+
+  EventDispatcher dispatcher;
+  dispatcher
+      .on_client_notification([&](ClientNotification notification) {
+        client_handler.handle(std::move(notification));
+      })
+      .on_order_book_notification([&](OrderBookNotification notification) {
+        order_book_handler.handle(std::move(notification));
+      });
+
+  emit_events(state, dispatcher);
+  benchmark::DoNotOptimize(order_book_handler.handled);
+}
+
+auto BM_static_event_dispatch(benchmark::State& state) -> void {
+  CountingClientHandler client_handler;
+  CountingOrderBookHandler order_book_handler;
+
+  StaticEventDispatcher<CountingClientHandler, CountingOrderBookHandler>
+      dispatcher{client_handler, order_book_handler};
+
+  emit_events(state, dispatcher);
+  benchmark::DoNotOptimize(order_book_handler.handled);
+}
+
+}  // namespace
+
+BENCHMARK(BM_runtime_event_dispatch);
+BENCHMARK(BM_static_event_dispatch);
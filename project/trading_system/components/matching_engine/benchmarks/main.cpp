@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+
+#include "cfg/api/cfg.hpp"
+
+namespace {
+
+auto disable_logging() -> void {
+  using namespace simulator::cfg;
+
+  // Currently we have no other options to disable logging in runtime,
+  // to be updated, once configuration/logging implementation is redesigned
+  simulator::cfg::init();
+  auto& log_cfg = const_cast<LogConfiguration&>(simulator::cfg::log());
+  log_cfg.level = "ERROR";
+  log_cfg.max_files = 0;
+  log_cfg.max_size = 0;
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  disable_logging();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
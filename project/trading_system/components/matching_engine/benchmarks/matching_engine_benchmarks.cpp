@@ -0,0 +1,481 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/events.hpp"
+#include "common/instrument.hpp"
+#include "core/tools/time.hpp"
+#include "matching_engine/configuration.hpp"
+#include "matching_engine/matching_engine.hpp"
+#include "middleware/channels/trading_reply_channel.hpp"
+#include "protocol/app/market_data_request.hpp"
+#include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_modification_request.hpp"
+#include "protocol/app/order_placement_request.hpp"
+#include "protocol/types/session.hpp"
+#include "runtime/service.hpp"
+
+// Measures request processing costs of the matching engine end to end:
+// requests are passed through the public MatchingEngine interface and
+// all replies are delivered to a counting trading reply receiver.
+// Books are populated by a seeded generator, so that results of different
+// runs and revisions are comparable.
+//
+// JSON results are produced with the `--benchmark_format=json` option
+// or written to a file by the `matching_engine_benchmarks_report` target.
+
+namespace {
+
+namespace middleware = simulator::middleware;
+namespace protocol = simulator::protocol;
+namespace runtime = simulator::trading_system::runtime;
+
+using simulator::ClientOrderId;
+using simulator::MdEntryType;
+using simulator::MdRequestId;
+using simulator::MdSubscriptionRequestType;
+using simulator::MarketDataUpdateType;
+using simulator::OrderPrice;
+using simulator::OrderQuantity;
+using simulator::OrderType;
+using simulator::OrigClientOrderId;
+using simulator::Side;
+using simulator::Symbol;
+using simulator::TimeInForce;
+using simulator::trading_system::Instrument;
+using simulator::trading_system::event::Tick;
+using simulator::trading_system::matching_engine::Configuration;
+using simulator::trading_system::matching_engine::MatchingEngine;
+
+constexpr std::int64_t MidPrice = 100000;
+constexpr std::uint32_t BookSeed = 20240101;
+// Resting orders placed by a benchmark are removed in batches of this size,
+// so that the book depth stays around the configured one
+constexpr std::size_t BatchSize = 1024;
+
+// Runs engine commands in the calling thread, making the engine synchronous
+class InlineService final : public runtime::Service {
+ public:
+  auto execute(std::function<void()> task) -> void override { task(); }
+};
+
+class CountingReplyReceiver final : public middleware::TradingReplyReceiver {
+ public:
+  auto process([[maybe_unused]] protocol::BusinessMessageReject reject)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::ExecutionReport report)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::OrderPlacementReject reject)
+      -> void override {
+    replies_++;
+  }
+  auto process(
+      [[maybe_unused]] protocol::OrderPlacementConfirmation confirmation)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::OrderModificationReject reject)
+      -> void override {
+    replies_++;
+  }
+  auto process(
+      [[maybe_unused]] protocol::OrderModificationConfirmation confirmation)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::OrderCancellationReject reject)
+      -> void override {
+    replies_++;
+  }
+  auto process(
+      [[maybe_unused]] protocol::OrderCancellationConfirmation confirmation)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::OrderMassCancellationReport report)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::MarketDataReject reject)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::MarketDataSnapshot snapshot)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::MarketDataUpdate update)
+      -> void override {
+    replies_++;
+  }
+  auto process([[maybe_unused]] protocol::SecurityStatus status)
+      -> void override {
+    replies_++;
+  }
+
+  auto process_batch(std::span<middleware::TradingReply> replies)
+      -> void override {
+    replies_ += replies.size();
+  }
+
+  [[nodiscard]]
+  auto replies() const -> std::uint64_t {
+    return replies_;
+  }
+
+ private:
+  std::uint64_t replies_ = 0;
+};
+
+auto make_session() -> protocol::Session {
+  return protocol::Session{protocol::generator::Session{}};
+}
+
+auto make_subscriber_session(std::int64_t subscriber) -> protocol::Session {
+  return protocol::Session{protocol::fix::Session{
+      protocol::fix::BeginString{"FIXT.1.1"},
+      protocol::fix::SenderCompId{"Subscriber" + std::to_string(subscriber)},
+      protocol::fix::TargetCompId{"Venue"}}};
+}
+
+auto make_instrument() -> Instrument {
+  Instrument instrument;
+  instrument.symbol = Symbol{"BENCH"};
+  return instrument;
+}
+
+// Owns a synchronously executed engine and the reply receiver bound
+// to the trading reply channel for the engine lifetime.
+class BenchmarkedEngine {
+ public:
+  BenchmarkedEngine()
+      : receiver_(std::make_shared<CountingReplyReceiver>()),
+        engine_(make_instrument(), configuration_, service_) {
+    middleware::bind_trading_reply_channel(receiver_);
+  }
+
+  BenchmarkedEngine(const BenchmarkedEngine&) = delete;
+  BenchmarkedEngine(BenchmarkedEngine&&) = delete;
+
+  ~BenchmarkedEngine() noexcept { middleware::release_trading_reply_channel(); }
+
+  auto operator=(const BenchmarkedEngine&) -> BenchmarkedEngine& = delete;
+  auto operator=(BenchmarkedEngine&&) -> BenchmarkedEngine& = delete;
+
+  // Places a day limit order, returns its client order id
+  auto place_limit(Side side, std::int64_t price, std::int64_t quantity)
+      -> ClientOrderId {
+    auto client_order_id = next_client_order_id();
+    protocol::OrderPlacementRequest request{make_session()};
+    request.client_order_id = client_order_id;
+    request.order_type = OrderType::Option::Limit;
+    request.time_in_force = TimeInForce::Option::Day;
+    request.side = side;
+    request.order_price = OrderPrice{static_cast<double>(price)};
+    request.order_quantity = OrderQuantity{static_cast<double>(quantity)};
+    engine_.execute(std::move(request));
+    return client_order_id;
+  }
+
+  auto place_market(Side side, std::int64_t quantity) -> void {
+    protocol::OrderPlacementRequest request{make_session()};
+    request.client_order_id = next_client_order_id();
+    request.order_type = OrderType::Option::Market;
+    request.side = side;
+    request.order_quantity = OrderQuantity{static_cast<double>(quantity)};
+    engine_.execute(std::move(request));
+  }
+
+  // Amends the order identified by the client order id,
+  // returns a client order id the order is known by after the amendment
+  auto amend(const ClientOrderId& orig_client_order_id,
+             Side side,
+             std::int64_t price,
+             std::int64_t quantity) -> ClientOrderId {
+    auto client_order_id = next_client_order_id();
+    protocol::OrderModificationRequest request{make_session()};
+    request.orig_client_order_id =
+        OrigClientOrderId{orig_client_order_id.value()};
+    request.client_order_id = client_order_id;
+    request.order_type = OrderType::Option::Limit;
+    request.time_in_force = TimeInForce::Option::Day;
+    request.side = side;
+    request.order_price = OrderPrice{static_cast<double>(price)};
+    request.order_quantity = OrderQuantity{static_cast<double>(quantity)};
+    engine_.execute(std::move(request));
+    return client_order_id;
+  }
+
+  auto cancel(const ClientOrderId& orig_client_order_id, Side side) -> void {
+    protocol::OrderCancellationRequest request{make_session()};
+    request.orig_client_order_id =
+        OrigClientOrderId{orig_client_order_id.value()};
+    request.client_order_id = next_client_order_id();
+    request.side = side;
+    engine_.execute(std::move(request));
+  }
+
+  auto subscribe(protocol::Session session) -> void {
+    protocol::MarketDataRequest request{std::move(session)};
+    request.request_id = MdRequestId{"BenchmarkSubscription"};
+    request.instruments.emplace_back().symbol = Symbol{"BENCH"};
+    request.market_data_types = {MdEntryType::Option::Bid,
+                                 MdEntryType::Option::Offer,
+                                 MdEntryType::Option::Trade};
+    request.request_type = MdSubscriptionRequestType::Option::Subscribe;
+    request.update_type = MarketDataUpdateType::Option::Incremental;
+    engine_.execute(std::move(request));
+  }
+
+  auto tick(bool is_new_day) -> void {
+    const auto now = simulator::core::get_current_system_time();
+    engine_.handle(Tick{
+        .sys_tick_time = now,
+        .tz_tick_time = simulator::core::as_tz_time(now, configuration_.clock),
+        .is_new_sys_day = is_new_day,
+        .is_new_tz_day = is_new_day});
+  }
+
+  [[nodiscard]]
+  auto replies() const -> std::uint64_t {
+    return receiver_->replies();
+  }
+
+ private:
+  auto next_client_order_id() -> ClientOrderId {
+    return ClientOrderId{std::to_string(++last_client_order_id_)};
+  }
+
+  std::shared_ptr<CountingReplyReceiver> receiver_;
+  Configuration configuration_;
+  InlineService service_;
+  MatchingEngine engine_;
+  std::uint64_t last_client_order_id_ = 0;
+};
+
+// Populates books of a reproducible shape: a given number of price levels
+// per side, level quantities are drawn from a seeded generator.
+// Bids rest below and offers rest above MidPrice, one price unit apart.
+class BookGenerator {
+ public:
+  struct Shape {
+    std::int64_t levels = 0;
+    std::int64_t orders_per_level = 1;
+    std::int64_t min_quantity = 1;
+    std::int64_t max_quantity = 100;
+  };
+
+  explicit BookGenerator(std::uint32_t seed = BookSeed) : random_(seed) {}
+
+  static auto bid_price(std::int64_t level) -> std::int64_t {
+    return MidPrice - 1 - level;
+  }
+
+  static auto offer_price(std::int64_t level) -> std::int64_t {
+    return MidPrice + 1 + level;
+  }
+
+  auto populate(BenchmarkedEngine& engine, Side side, const Shape& shape)
+      -> void {
+    std::uniform_int_distribution<std::int64_t> quantity{shape.min_quantity,
+                                                         shape.max_quantity};
+    for (std::int64_t level = 0; level < shape.levels; ++level) {
+      const auto price = side == Side::Option::Buy ? bid_price(level)
+                                                   : offer_price(level);
+      for (std::int64_t order = 0; order < shape.orders_per_level; ++order) {
+        engine.place_limit(side, price, quantity(random_));
+      }
+    }
+  }
+
+  auto populate(BenchmarkedEngine& engine, const Shape& shape) -> void {
+    populate(engine, Side::Option::Buy, shape);
+    populate(engine, Side::Option::Sell, shape);
+  }
+
+ private:
+  std::mt19937 random_;
+};
+
+auto report_replies(benchmark::State& state, const BenchmarkedEngine& engine)
+    -> void {
+  state.counters["replies"] =
+      benchmark::Counter(static_cast<double>(engine.replies()),
+                         benchmark::Counter::kAvgIterations);
+}
+
+// Places passive limit orders into a book of the given depth (levels)
+auto BM_limit_order_placement(benchmark::State& state) -> void {
+  const auto levels = state.range(0);
+  BenchmarkedEngine engine;
+  BookGenerator{}.populate(engine, {.levels = levels});
+
+  std::vector<ClientOrderId> placed;
+  placed.reserve(BatchSize);
+  std::int64_t level = 0;
+  for (auto _ : state) {
+    placed.push_back(engine.place_limit(
+        Side::Option::Buy, BookGenerator::bid_price(level), 1));
+    level = (level + 1) % levels;
+
+    if (placed.size() == BatchSize) {
+      state.PauseTiming();
+      for (const auto& client_order_id : placed) {
+        engine.cancel(client_order_id, Side::Option::Buy);
+      }
+      placed.clear();
+      state.ResumeTiming();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  report_replies(state, engine);
+}
+
+// Sends a single buy order sweeping the given number of offer levels
+auto BM_aggressive_sweep(benchmark::State& state) -> void {
+  const auto levels = state.range(0);
+  BenchmarkedEngine engine;
+  BookGenerator generator;
+  const BookGenerator::Shape shape{
+      .levels = levels, .min_quantity = 1, .max_quantity = 1};
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    generator.populate(engine, Side::Option::Sell, shape);
+    state.ResumeTiming();
+
+    engine.place_limit(
+        Side::Option::Buy, BookGenerator::offer_price(levels - 1), levels);
+  }
+  state.SetItemsProcessed(state.iterations() * levels);
+  report_replies(state, engine);
+}
+
+// Amends a resting order by its client order id, alternating its quantity
+auto BM_amend_by_client_order_id(benchmark::State& state) -> void {
+  const auto levels = state.range(0);
+  BenchmarkedEngine engine;
+  BookGenerator{}.populate(engine, {.levels = levels});
+
+  const auto price = BookGenerator::bid_price(levels / 2);
+  std::int64_t quantity = 10;
+  auto client_order_id = engine.place_limit(Side::Option::Buy, price, quantity);
+  for (auto _ : state) {
+    quantity = quantity == 10 ? 11 : 10;
+    client_order_id =
+        engine.amend(client_order_id, Side::Option::Buy, price, quantity);
+  }
+  state.SetItemsProcessed(state.iterations());
+  report_replies(state, engine);
+}
+
+// Cancels resting orders by their client order ids
+auto BM_cancel_by_client_order_id(benchmark::State& state) -> void {
+  const auto levels = state.range(0);
+  BenchmarkedEngine engine;
+  BookGenerator{}.populate(engine, {.levels = levels});
+
+  std::vector<ClientOrderId> resting;
+  resting.reserve(BatchSize);
+  for (auto _ : state) {
+    if (resting.empty()) {
+      state.PauseTiming();
+      for (std::size_t order = 0; order < BatchSize; ++order) {
+        const auto level = static_cast<std::int64_t>(order) % levels;
+        resting.push_back(engine.place_limit(
+            Side::Option::Buy, BookGenerator::bid_price(level), 1));
+      }
+      state.ResumeTiming();
+    }
+
+    engine.cancel(resting.back(), Side::Option::Buy);
+    resting.pop_back();
+  }
+  state.SetItemsProcessed(state.iterations());
+  report_replies(state, engine);
+}
+
+// Matches small market orders against a book of the given depth,
+// resting quantities are large enough to never be exhausted
+auto BM_market_order_matching(benchmark::State& state) -> void {
+  const auto levels = state.range(0);
+  BenchmarkedEngine engine;
+  BookGenerator{}.populate(engine,
+                           {.levels = levels,
+                            .min_quantity = 1'000'000'000,
+                            .max_quantity = 1'000'000'000});
+
+  for (auto _ : state) {
+    engine.place_market(Side::Option::Buy, 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+  report_replies(state, engine);
+}
+
+// Handles a system tick over a book with the given number of resting orders.
+// When the tick starts a new day, all resting day orders are eliminated.
+auto BM_system_elimination_tick(benchmark::State& state) -> void {
+  const auto orders = state.range(0);
+  const bool is_new_day = state.range(1) != 0;
+  BenchmarkedEngine engine;
+  BookGenerator generator;
+  const BookGenerator::Shape shape{.levels = 16,
+                                   .orders_per_level = orders / 32};
+
+  generator.populate(engine, shape);
+  for (auto _ : state) {
+    if (is_new_day) {
+      state.PauseTiming();
+      generator.populate(engine, shape);
+      state.ResumeTiming();
+    }
+    engine.tick(is_new_day);
+  }
+  state.SetItemsProcessed(state.iterations() * orders);
+  report_replies(state, engine);
+}
+
+// Amends an order at the top of the book, each amendment is published
+// to the given number of market data subscribers
+auto BM_market_data_publishing(benchmark::State& state) -> void {
+  const auto subscribers = state.range(0);
+  BenchmarkedEngine engine;
+  BookGenerator{}.populate(engine, {.levels = 10});
+  for (std::int64_t subscriber = 0; subscriber < subscribers; ++subscriber) {
+    engine.subscribe(make_subscriber_session(subscriber));
+  }
+
+  const auto price = BookGenerator::bid_price(0);
+  std::int64_t quantity = 10;
+  auto client_order_id = engine.place_limit(Side::Option::Buy, price, quantity);
+  for (auto _ : state) {
+    quantity = quantity == 10 ? 11 : 10;
+    client_order_id =
+        engine.amend(client_order_id, Side::Option::Buy, price, quantity);
+  }
+  state.SetItemsProcessed(state.iterations() * subscribers);
+  report_replies(state, engine);
+}
+
+}  // namespace
+
+BENCHMARK(BM_limit_order_placement)->RangeMultiplier(10)->Range(1, 1000);
+BENCHMARK(BM_aggressive_sweep)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_amend_by_client_order_id)->RangeMultiplier(10)->Range(1, 1000);
+BENCHMARK(BM_cancel_by_client_order_id)->RangeMultiplier(10)->Range(1, 1000);
+BENCHMARK(BM_market_order_matching)->RangeMultiplier(10)->Range(1, 1000);
+BENCHMARK(BM_system_elimination_tick)
+    ->ArgsProduct({{256, 4096}, {0, 1}})
+    ->ArgNames({"orders", "new_day"});
+BENCHMARK(BM_market_data_publishing)->RangeMultiplier(4)->Range(1, 64);
@@ -1,32 +1,55 @@
 #ifndef SIMULATOR_MATCHING_ENGINE_IH_COMMANDS_CLIENT_NOTIFICATION_CACHE_HPP_
 #define SIMULATOR_MATCHING_ENGINE_IH_COMMANDS_CLIENT_NOTIFICATION_CACHE_HPP_
 
+#include <cstddef>
 #include <vector>
 
 #include "ih/common/events/client_notification.hpp"
+#include "middleware/channels/trading_reply_channel.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
+// Replies collected while a command was executed.
+// Refers to the storage of the cache, which is released for the next
+// command once the replies are published.
 class ClientNotifications {
  public:
-  explicit ClientNotifications(std::vector<ClientNotification> notifications);
+  explicit ClientNotifications(
+      std::vector<middleware::TradingReply>& notifications) noexcept;
 
+  // Sends all replies to the trading reply channel as a single batch
   auto publish() -> void;
 
+  // Drops all replies without sending them
+  auto discard() noexcept -> void;
+
  private:
-  std::vector<ClientNotification> notifications_;
+  std::vector<middleware::TradingReply>& notifications_;
 };
 
+// Collects replies of a command into storage reused by every command.
+// The storage is preallocated and never shrinks, so it is only
+// reallocated when a command produces more replies than any before.
 class ClientNotificationCache {
  public:
+  static constexpr std::size_t InitialCapacity = 256;
+
+  ClientNotificationCache();
+
   auto add(ClientNotification notification) -> void;
 
+  // Caches a notification emitted by an engine component
+  auto handle(ClientNotification notification) -> void;
+
   auto collect() -> ClientNotifications;
 
+  [[nodiscard]]
+  auto capacity() const noexcept -> std::size_t;
+
  private:
-  std::vector<ClientNotification> cached_notifications_;
+  std::vector<middleware::TradingReply> cached_notifications_;
 };
 
 }  // namespace simulator::trading_system::matching_engine
 
-#endif  // SIMULATOR_MATCHING_ENGINE_IH_COMMANDS_CLIENT_NOTIFICATION_CACHE_HPP_
\ No newline at end of file
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_COMMANDS_CLIENT_NOTIFICATION_CACHE_HPP_
@@ -12,7 +12,9 @@
 #include "ih/common/abstractions/order_event_handler.hpp"
 #include "ih/common/abstractions/order_request_processor.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -123,6 +125,54 @@ class CancelOrder : public detail::ReplyingCommand {
   MarketDataPublisher& market_data_publisher_;
 };
 
+class MassCancelOrders : public detail::ReplyingCommand {
+ public:
+  MassCancelOrders(protocol::OrderMassCancellationRequest request,
+                   OrderRequestProcessor& request_processor,
+                   MarketDataPublisher& market_data_publisher,
+                   ClientNotificationCache& cache);
+
+  MassCancelOrders(const MassCancelOrders&) = delete;
+  MassCancelOrders(MassCancelOrders&&) = default;
+  ~MassCancelOrders() override = default;
+
+  auto operator=(const MassCancelOrders&) -> MassCancelOrders& = delete;
+  auto operator=(MassCancelOrders&&) -> MassCancelOrders& = delete;
+
+ private:
+  auto execute() const -> void override;
+  auto name() const -> std::string_view override;
+
+  protocol::OrderMassCancellationRequest request_;
+  OrderRequestProcessor& request_processor_;
+  MarketDataPublisher& market_data_publisher_;
+};
+
+// Replaces quotes of a session in a single command,
+// so that the market data is published once for the whole ladder
+class MassQuote : public detail::ReplyingCommand {
+ public:
+  MassQuote(protocol::MassQuoteRequest request,
+            OrderRequestProcessor& request_processor,
+            MarketDataPublisher& market_data_publisher,
+            ClientNotificationCache& cache);
+
+  MassQuote(const MassQuote&) = delete;
+  MassQuote(MassQuote&&) = default;
+  ~MassQuote() override = default;
+
+  auto operator=(const MassQuote&) -> MassQuote& = delete;
+  auto operator=(MassQuote&&) -> MassQuote& = delete;
+
+ private:
+  auto execute() const -> void override;
+  auto name() const -> std::string_view override;
+
+  protocol::MassQuoteRequest request_;
+  OrderRequestProcessor& request_processor_;
+  MarketDataPublisher& market_data_publisher_;
+};
+
 class ProcessMarketDataRequest : public detail::ReplyingCommand {
  public:
   ProcessMarketDataRequest(protocol::MarketDataRequest request,
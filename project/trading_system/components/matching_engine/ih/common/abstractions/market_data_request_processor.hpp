@@ -28,11 +28,14 @@ class MarketDataRequestProcessor {
   virtual auto capture(protocol::InstrumentState& state) -> void = 0;
 
   virtual auto store_state(std::optional<Trade>& last_trade,
+                           std::optional<std::vector<Trade>>& recent_trades,
                            std::optional<market_state::InstrumentInfo>& info)
       -> void = 0;
 
   virtual auto recover_state(std::optional<Trade> last_trade,
-                             std::optional<market_state::InstrumentInfo> info) -> void = 0;
+                             std::optional<std::vector<Trade>> recent_trades,
+                             std::optional<market_state::InstrumentInfo> info)
+      -> void = 0;
 
   virtual auto stop_streaming(const protocol::Session& client_session)
       -> void = 0;
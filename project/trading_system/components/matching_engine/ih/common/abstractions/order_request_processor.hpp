@@ -2,7 +2,9 @@
 #define SIMULATOR_MATCHING_ENGINE_IH_COMMON_ABSTRACTIONS_ORDER_REQUEST_PROCESSOR_HPP_
 
 #include "common/market_state/snapshot.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -29,6 +31,11 @@ class OrderRequestProcessor {
   virtual auto process(const protocol::OrderCancellationRequest& request)
       -> void = 0;
 
+  virtual auto process(const protocol::OrderMassCancellationRequest& request)
+      -> void = 0;
+
+  virtual auto process(const protocol::MassQuoteRequest& request) -> void = 0;
+
   virtual auto process(const protocol::SecurityStatusRequest& request)
       -> void = 0;
 
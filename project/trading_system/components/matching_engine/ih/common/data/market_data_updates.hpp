@@ -2,6 +2,9 @@
 #define SIMULATOR_MATCHING_ENGINE_IH_COMMON_DATA_MARKET_DATA_UPDATES_HPP_
 
 #include <fmt/base.h>
+#include <fmt/ranges.h>
+
+#include <vector>
 
 #include "common/attributes.hpp"
 #include "common/market_state/snapshot.hpp"
@@ -35,6 +38,10 @@ struct LastTradeRecover {
   std::optional<Trade> trade;
 };
 
+struct TradeHistoryRecover {
+  std::vector<Trade> trades;
+};
+
 struct InstrumentInfoRecover {
   std::optional<market_state::InstrumentInfo> info;
 };
@@ -107,6 +114,21 @@ struct fmt::formatter<
   }
 };
 
+template <>
+struct fmt::formatter<
+    simulator::trading_system::matching_engine::TradeHistoryRecover>
+    : formatter<std::string_view> {
+  using formattable =
+      simulator::trading_system::matching_engine::TradeHistoryRecover;
+
+  auto format(const formattable& event, format_context& ctx) const
+      -> format_context::iterator {
+    return format_to(ctx.out(),
+                     R"({{ "TradeHistoryRecover": {{ "trades": [{}] }} }})",
+                     fmt::join(event.trades, ", "));
+  }
+};
+
 template <>
 struct fmt::formatter<
     simulator::trading_system::matching_engine::InstrumentInfoRecover>
@@ -12,6 +12,7 @@
 #include "protocol/app/market_data_update.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -27,6 +28,7 @@ struct ClientNotification {
                              protocol::OrderModificationReject,
                              protocol::OrderCancellationConfirmation,
                              protocol::OrderCancellationReject,
+                             protocol::OrderMassCancellationReport,
                              protocol::ExecutionReport,
                              protocol::MarketDataReject,
                              protocol::MarketDataSnapshot,
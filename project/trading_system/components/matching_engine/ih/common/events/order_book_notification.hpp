@@ -18,6 +18,7 @@ struct OrderBookNotification {
                              OrderRemoved,
                              Trade,
                              LastTradeRecover,
+                             TradeHistoryRecover,
                              InstrumentInfoRecover>;
 
   template <typename NotificationType>
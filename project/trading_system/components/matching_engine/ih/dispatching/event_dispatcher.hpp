@@ -11,6 +11,11 @@ namespace simulator::trading_system::matching_engine {
 struct ClientNotification;
 struct OrderBookNotification;
 
+// Dispatches events to handlers, which are registered at runtime.
+//
+// Each event goes through a type-erased handler call, which is not suitable
+// for the engine hot path (StaticEventDispatcher is used there), but allows
+// to (re)register handlers, e.g. in tests and tools.
 class EventDispatcher : public EventListener {
  public:
   EventDispatcher() = default;
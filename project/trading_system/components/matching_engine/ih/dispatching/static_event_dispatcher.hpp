@@ -0,0 +1,78 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_DISPATCHING_STATIC_EVENT_DISPATCHER_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_DISPATCHING_STATIC_EVENT_DISPATCHER_HPP_
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include "ih/common/abstractions/event_listener.hpp"
+#include "ih/common/events/event.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+template <typename Handler, typename EventCategory>
+concept EventHandler = requires(Handler& handler, EventCategory category) {
+  handler.handle(std::move(category));
+};
+
+// Dispatches events to a fixed set of handlers, which is known at compile
+// time. Every event category must be handled by exactly one handler.
+//
+// Handlers are called directly, without type erasure, so a compiler is able
+// to inline them into the dispatching code. The dispatcher only keeps
+// references to the handlers, which must outlive it.
+template <typename... Handlers>
+class StaticEventDispatcher final : public EventListener {
+  template <typename EventCategory>
+  constexpr static std::size_t handlers_count_of =
+      (static_cast<std::size_t>(EventHandler<Handlers, EventCategory>) + ... +
+       0);
+
+ public:
+  explicit StaticEventDispatcher(Handlers&... handlers) noexcept
+      : handlers_{handlers...} {}
+
+  StaticEventDispatcher(const StaticEventDispatcher&) = delete;
+  StaticEventDispatcher(StaticEventDispatcher&&) = delete;
+  ~StaticEventDispatcher() override = default;
+
+  auto operator=(const StaticEventDispatcher&)
+      -> StaticEventDispatcher& = delete;
+  auto operator=(StaticEventDispatcher&&) -> StaticEventDispatcher& = delete;
+
+  auto on(Event event) -> void override {
+    std::visit(
+        [this]<typename EventCategory>(EventCategory&& category) {
+          dispatch(std::forward<EventCategory>(category));
+        },
+        std::move(event.value));
+  }
+
+ private:
+  template <typename EventCategory>
+  auto dispatch(EventCategory category) -> void {
+    static_assert(handlers_count_of<EventCategory> == 1,
+                  "an event category must be handled by exactly one handler");
+
+    std::apply(
+        [&category](Handlers&... handlers) {
+          (handle_if_accepted(handlers, category), ...);
+        },
+        handlers_);
+  }
+
+  template <typename Handler, typename EventCategory>
+  static auto handle_if_accepted(Handler& handler, EventCategory& category)
+      -> void {
+    if constexpr (EventHandler<Handler, EventCategory>) {
+      handler.handle(std::move(category));
+    }
+  }
+
+  std::tuple<Handlers&...> handlers_;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_DISPATCHING_STATIC_EVENT_DISPATCHER_HPP_
@@ -1,51 +1,98 @@
 #ifndef SIMULATOR_MATCHING_ENGINE_IH_IMPLEMENTATION_HPP_
 #define SIMULATOR_MATCHING_ENGINE_IH_IMPLEMENTATION_HPP_
 
+#include <optional>
+#include <string>
+
 #include "common/events.hpp"
+#include "common/tick_scheduler.hpp"
 #include "ih/commands/client_notification_cache.hpp"
 #include "ih/commands/commands.hpp"
-#include "ih/dispatching/event_dispatcher.hpp"
+#include "ih/dispatching/static_event_dispatcher.hpp"
 #include "ih/market_data/market_data_facade.hpp"
 #include "ih/orders/order_system_facade.hpp"
+#include "ih/statistics/command_latency_recorder.hpp"
+#include "ih/statistics/timed_market_data_publisher.hpp"
 #include "matching_engine/matching_engine.hpp"
+#include "protocol/admin/engine_latency.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
 class MatchingEngine::Implementation {
  public:
-  explicit Implementation(const Instrument& instrument,
-                          const Configuration& configuration);
+  // Registers the engine deadlines in `tick_scheduler`
+  // once commands add orders, which may expire
+  Implementation(const Instrument& instrument,
+                 const Configuration& configuration,
+                 TickScheduler& tick_scheduler);
+
+  using TimePoint = CommandLatencyRecorder::TimePoint;
+
+  // Each command is dispatched with a time its request was accepted at
+  // by the engine, which is used to measure the command queueing latency
+
+  auto dispatch_order_cmd(protocol::OrderPlacementRequest request,
+                          TimePoint enqueued_at) -> void;
+
+  auto dispatch_order_cmd(protocol::OrderModificationRequest request,
+                          TimePoint enqueued_at) -> void;
+
+  auto dispatch_order_cmd(protocol::OrderCancellationRequest request,
+                          TimePoint enqueued_at) -> void;
+
+  auto dispatch_order_cmd(protocol::OrderMassCancellationRequest request,
+                          TimePoint enqueued_at) -> void;
 
-  auto dispatch_order_cmd(protocol::OrderPlacementRequest request) -> void;
+  auto dispatch_order_cmd(protocol::MassQuoteRequest request,
+                          TimePoint enqueued_at) -> void;
 
-  auto dispatch_order_cmd(protocol::OrderModificationRequest request) -> void;
+  auto dispatch_order_cmd(protocol::SecurityStatusRequest request,
+                          TimePoint enqueued_at) -> void;
 
-  auto dispatch_order_cmd(protocol::OrderCancellationRequest request) -> void;
+  auto dispatch_mdata_cmd(protocol::MarketDataRequest request,
+                          TimePoint enqueued_at) -> void;
 
-  auto dispatch_order_cmd(protocol::SecurityStatusRequest request) -> void;
+  auto dispatch_client_disconnected_cmd(const protocol::Session& client_session,
+                                        TimePoint enqueued_at) -> void;
 
-  auto dispatch_mdata_cmd(protocol::MarketDataRequest request) -> void;
+  auto dispatch_instrument_state_capture_cmd(protocol::InstrumentState& reply,
+                                             TimePoint enqueued_at) -> void;
 
-  auto dispatch_client_disconnected_cmd(const protocol::Session& client_session)
-      -> void;
+  auto dispatch_store_state_cmd(market_state::InstrumentState& state,
+                                TimePoint enqueued_at) -> void;
 
-  auto dispatch_instrument_state_capture_cmd(protocol::InstrumentState& reply)
-      -> void;
+  auto dispatch_recover_state_cmd(market_state::InstrumentState state,
+                                  TimePoint enqueued_at) -> void;
 
-  auto dispatch_store_state_cmd(market_state::InstrumentState& state) -> void;
+  auto dispatch_tick_cmd(event::Tick tick, TimePoint enqueued_at) -> void;
 
-  auto dispatch_recover_state_cmd(market_state::InstrumentState state)
-      -> void;
+  auto dispatch_phase_transition_cmd(event::PhaseTransition phase_transition,
+                                     TimePoint enqueued_at) -> void;
 
-  auto dispatch_tick_cmd(event::Tick tick) -> void;
+  // May be called concurrently with commands execution
+  auto provide_latency(protocol::EngineLatency& latency) const -> void;
 
-  auto dispatch_phase_transition_cmd(event::PhaseTransition phase_transition)
-      -> void;
+  // Commands replayed from a journal are executed at the time they were
+  // journaled at, their replies and market data updates are discarded
+  auto start_replay(core::sys_us journaled_at) -> void;
+
+  auto finish_replay() -> void;
 
  private:
-  auto execute(const command::detail::ActionCommand& cmd) -> void;
+  auto execute(const command::detail::ActionCommand& cmd,
+               CommandType type,
+               TimePoint enqueued_at) -> void;
+
+  auto execute(const command::detail::ReplyingCommand& cmd,
+               CommandType type,
+               TimePoint enqueued_at) -> void;
+
+  auto market_data_publisher() -> MarketDataPublisher&;
 
-  auto execute(const command::detail::ReplyingCommand& cmd) -> void;
+  auto schedule_tick(const TickDeadline& deadline) -> void;
+
+  // Replaces the engine deadline with one found in the order book
+  auto reschedule_tick() -> void;
 
   auto create_place_order_command(protocol::OrderPlacementRequest request)
       -> command::PlaceOrder;
@@ -56,6 +103,13 @@ class MatchingEngine::Implementation {
   auto create_cancel_order_command(protocol::OrderCancellationRequest request)
       -> command::CancelOrder;
 
+  auto create_mass_cancel_orders_command(
+      protocol::OrderMassCancellationRequest request)
+      -> command::MassCancelOrders;
+
+  auto create_mass_quote_command(protocol::MassQuoteRequest request)
+      -> command::MassQuote;
+
   auto create_security_status_command(protocol::SecurityStatusRequest request)
       -> command::ProcessSecurityStatusRequest;
 
@@ -80,8 +134,21 @@ class MatchingEngine::Implementation {
   auto create_phase_transition_command(event::PhaseTransition event)
       -> command::PhaseTransitionCommand;
 
-  EventDispatcher event_dispatcher_;
+  using EngineEventDispatcher =
+      StaticEventDispatcher<ClientNotificationCache, MarketDataFacade>;
+
+  InstrumentId instrument_id_;
+  std::string symbol_;
+  // A time the replayed commands were journaled at, is empty for live ones
+  std::optional<core::sys_us> replay_time_;
+  TickScheduler& tick_scheduler_;
+  CommandLatencyRecorder latency_recorder_;
+  // Refers to the market data facade, which is constructed later
+  TimedMarketDataPublisher timed_market_data_publisher_;
   ClientNotificationCache cached_client_notifications_;
+  // Refers to the market data facade, which is constructed later,
+  // engine components do not emit events while being constructed
+  EngineEventDispatcher event_dispatcher_;
   OrderSystemFacade order_system_facade_;
   MarketDataFacade market_data_facade_;
 };
@@ -1,6 +1,9 @@
 #ifndef SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_ACTIONS_MARKET_DATA_RECOVER_HPP_
 #define SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_ACTIONS_MARKET_DATA_RECOVER_HPP_
 
+#include <optional>
+#include <vector>
+
 #include "common/market_state/snapshot.hpp"
 #include "common/trade.hpp"
 #include "ih/common/abstractions/event_listener.hpp"
@@ -14,6 +17,8 @@ class MarketDataRecover : public EventReporter {
 
   auto operator()(std::optional<Trade> last_trade) -> void;
 
+  auto operator()(std::vector<Trade> recent_trades) -> void;
+
   auto operator()(std::optional<market_state::InstrumentInfo> info) -> void;
 };
 
@@ -1,6 +1,8 @@
 #ifndef SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_CACHE_MANAGER_HPP_
 #define SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_CACHE_MANAGER_HPP_
 
+#include <cstdint>
+
 #include "common/market_state/snapshot.hpp"
 #include "ih/common/events/order_book_notification.hpp"
 #include "ih/market_data/cache/depth_cache.hpp"
@@ -22,9 +24,12 @@ class CacheManager final : public MarketDataProvider {
   auto compose_update(const StreamingSettings& settings) const
       -> std::vector<MarketDataEntry> override;
 
+  auto update_sequence() const -> std::uint64_t override;
+
   auto capture(protocol::InstrumentState& state) const -> void;
 
   auto store_state(std::optional<Trade>& last_trade,
+                   std::optional<std::vector<Trade>>& recent_trades,
                    std::optional<market_state::InstrumentInfo>& info) -> void;
 
   auto push(OrderBookNotification notification) -> void;
@@ -39,6 +44,7 @@ class CacheManager final : public MarketDataProvider {
   DepthCache depth_cache_;
   TradeCache trade_cache_;
   InstrumentInfoCache instrument_info_cache_;
+  std::uint64_t update_sequence_{0};
 };
 
 }  // namespace simulator::trading_system::matching_engine::mdata
@@ -1,6 +1,8 @@
 #ifndef SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_MARKET_DATA_PROVIDER_HPP_
 #define SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_MARKET_DATA_PROVIDER_HPP_
 
+#include <cstdint>
+
 #include "core/domain/market_data_entry.hpp"
 #include "ih/market_data/streaming_settings.hpp"
 
@@ -24,6 +26,10 @@ class MarketDataProvider {
 
   virtual auto compose_update(const StreamingSettings& settings) const
       -> std::vector<MarketDataEntry> = 0;
+
+  // Returns a sequence number of the last applied market data update,
+  // the number is incremented by each update of a listing market data.
+  virtual auto update_sequence() const -> std::uint64_t = 0;
 };
 
 }  // namespace simulator::trading_system::matching_engine::mdata
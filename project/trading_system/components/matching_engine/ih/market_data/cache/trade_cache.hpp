@@ -1,12 +1,14 @@
 #ifndef SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_TRADE_CACHE_HPP_
 #define SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_TRADE_CACHE_HPP_
 
+#include <cstddef>
 #include <optional>
 #include <vector>
 
 #include "common/trade.hpp"
 #include "core/domain/market_data_entry.hpp"
 #include "ih/common/events/order_book_notification.hpp"
+#include "ih/market_data/cache/trade_history.hpp"
 #include "ih/market_data/streaming_settings.hpp"
 #include "ih/market_data/tools/market_entry_id_generator.hpp"
 
@@ -18,6 +20,9 @@ class TradeCache {
     bool report_trade_volume = true;
     bool report_trade_parties = true;
     bool report_trade_aggressor_side = true;
+    // The number of recent trades sent in an initial snapshot,
+    // the last trade is kept regardless of the value
+    std::size_t history_depth = 1;
   };
 
   explicit TradeCache(MarketEntryIdGenerator& id_generator);
@@ -32,12 +37,14 @@ class TradeCache {
 
   auto update(const std::vector<OrderBookNotification>& updates) -> void;
 
-  auto store_state(std::optional<Trade>& last_trade) const -> void;
+  auto store_state(std::optional<Trade>& last_trade,
+                   std::optional<std::vector<Trade>>& recent_trades) const
+      -> void;
 
  private:
   auto compose_market_entry(const Trade& trade) const -> MarketDataEntry;
 
-  std::optional<Trade> last_trade_;
+  TradeHistory history_{1};
   std::vector<Trade> cached_trades_;
   MarketEntryIdGenerator& id_generator_;
   Config config_;
@@ -0,0 +1,60 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_TRADE_HISTORY_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_TRADE_HISTORY_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+#include "common/trade.hpp"
+
+namespace simulator::trading_system::matching_engine::mdata {
+
+// Keeps a bounded number of the most recent trades.
+//
+// Trade slots grow with pushed trades up to the capacity and are reused
+// afterwards: when the history is full, a new trade overwrites the oldest one.
+class TradeHistory {
+ public:
+  explicit TradeHistory(std::size_t capacity);
+
+  // Changes the capacity, keeping the most recent trades that fit into it
+  auto set_capacity(std::size_t capacity) -> void;
+
+  [[nodiscard]]
+  auto capacity() const noexcept -> std::size_t;
+
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t;
+
+  [[nodiscard]]
+  auto empty() const noexcept -> bool;
+
+  // Returns the most recent trade, the history must not be empty
+  [[nodiscard]]
+  auto last() const -> const Trade&;
+
+  auto push(const Trade& trade) -> void;
+
+  auto clear() noexcept -> void;
+
+  // Visits the trades from the oldest to the most recent one
+  template <typename F>
+    requires std::invocable<F, const Trade&>
+  auto for_each(F&& function) const -> void {
+    const auto count = size();
+    for (std::size_t offset = 0; offset < count; ++offset) {
+      function(slots_[(oldest_ + offset) % count]);
+    }
+  }
+
+  auto store(std::vector<Trade>& destination) const -> void;
+
+ private:
+  std::vector<Trade> slots_;
+  std::size_t capacity_;
+  std::size_t oldest_ = 0;
+};
+
+}  // namespace simulator::trading_system::matching_engine::mdata
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_CACHE_TRADE_HISTORY_HPP_
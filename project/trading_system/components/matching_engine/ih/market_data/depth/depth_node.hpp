@@ -16,6 +16,8 @@ class DepthNode {
 
   auto price() const -> std::optional<Price> { return record_.price(); }
 
+  auto quantity() const -> Quantity;
+
   auto empty() const -> bool;
 
   auto full_level() const -> DepthLevel;
@@ -1,6 +1,8 @@
 #ifndef SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_DEPTH_DEPTH_SHEET_HPP_
 #define SIMULATOR_MATCHING_ENGINE_IH_MARKET_DATA_DEPTH_DEPTH_SHEET_HPP_
 
+#include <cstdint>
+#include <optional>
 #include <ranges>
 #include <vector>
 
@@ -29,6 +31,14 @@ class DepthSheet {
 
   auto partial_view(const PartyId& excluded_owner) const&;
 
+  // Top-of-book and level count statistics are maintained incrementally
+  // on each applied action, so reading them never walks the depth.
+  auto tob_price() const -> std::optional<Price>;
+
+  auto tob_quantity() const -> std::optional<Quantity>;
+
+  auto levels_count() const -> std::uint32_t { return levels_count_; }
+
   auto apply(const OrderAdded& action) -> void;
 
   auto apply(const OrderReduced& action) -> void;
@@ -42,9 +52,22 @@ class DepthSheet {
   static auto create_offer_sheet(MarketEntryIdGenerator& idgen) -> DepthSheet;
 
  private:
+  struct TopOfBook {
+    std::optional<Price> price;
+    Quantity quantity;
+  };
+
+  auto update_stats(std::vector<DepthNode>::iterator node, bool was_visible)
+      -> void;
+
+  auto find_next_top(std::vector<DepthNode>::const_iterator previous_top) const
+      -> std::optional<TopOfBook>;
+
   std::vector<DepthNode> nodes_;
   std::unique_ptr<DepthNodeComparator> cmp_;
   gsl::not_null<MarketEntryIdGenerator*> idgen_;
+  std::optional<TopOfBook> tob_;
+  std::uint32_t levels_count_{0};
 };
 
 inline auto DepthSheet::view() const& {
@@ -53,6 +76,14 @@ inline auto DepthSheet::view() const& {
              [](const auto& node) { return node.full_level(); });
 }
 
+inline auto DepthSheet::tob_price() const -> std::optional<Price> {
+  return tob_.has_value() ? tob_->price : std::nullopt;
+}
+
+inline auto DepthSheet::tob_quantity() const -> std::optional<Quantity> {
+  return tob_.has_value() ? std::make_optional(tob_->quantity) : std::nullopt;
+}
+
 inline auto DepthSheet::partial_view(const PartyId& excluded_owner) const& {
   return nodes_ | std::views::reverse |
          std::views::transform([&](const auto& node) {
@@ -25,10 +25,12 @@ class MarketDataFacade : public MarketDataRequestProcessor,
   auto capture(protocol::InstrumentState& state) -> void override;
 
   auto store_state(std::optional<Trade>& last_trade,
+                   std::optional<std::vector<Trade>>& recent_trades,
                    std::optional<market_state::InstrumentInfo>& info)
       -> void override;
 
   auto recover_state(std::optional<Trade> last_trade,
+                     std::optional<std::vector<Trade>> recent_trades,
                      std::optional<market_state::InstrumentInfo> info)
       -> void override;
 
@@ -44,6 +46,8 @@ class MarketDataFacade : public MarketDataRequestProcessor,
 
   auto validate(const std::optional<Trade>& last_trade) const -> bool;
 
+  auto validate(const std::vector<Trade>& recent_trades) const -> bool;
+
   auto validate(const std::optional<market_state::InstrumentInfo>& info) const
       -> bool;
 
@@ -0,0 +1,45 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_AUCTION_ORDER_ACTION_PROCESSOR_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_AUCTION_ORDER_ACTION_PROCESSOR_HPP_
+
+#include "ih/common/abstractions/event_listener.hpp"
+#include "ih/common/events/event_reporter.hpp"
+#include "ih/orders/actions/order_action_handler.hpp"
+#include "ih/orders/book/limit_order.hpp"
+#include "ih/orders/book/market_order.hpp"
+#include "ih/orders/book/order_book.hpp"
+#include "ih/orders/book/stop_order.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+// Processes order actions during an auction phase: orders are accumulated
+// in the book without trading until the auction is uncrossed.
+// Orders which must be executed immediately are rejected.
+class AuctionOrderActionProcessor : public OrderActionHandler,
+                                    private EventReporter {
+ public:
+  explicit AuctionOrderActionProcessor(EventListener& event_listener,
+                                       OrderBook& order_book);
+
+  auto place_limit_order(LimitOrder order) -> void override;
+
+  auto place_market_order(MarketOrder order) -> void override;
+
+  auto place_stop_order(StopOrder order) -> void override;
+
+  auto amend_limit_order(LimitUpdate update) -> void override;
+
+  auto cancel_order(const OrderCancel& cancel) -> void override;
+
+  auto recover_order(market_state::LimitOrder order_state) -> void override;
+
+  auto recover_order(market_state::StopOrder order_state) -> void override;
+
+  auto trigger_stop_orders() -> void override;
+
+ private:
+  OrderBook& order_book_;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_AUCTION_ORDER_ACTION_PROCESSOR_HPP_
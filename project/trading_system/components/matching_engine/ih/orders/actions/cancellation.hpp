@@ -24,6 +24,8 @@ class Cancellation : private EventReporter {
  private:
   auto cancel_order(const OrderCancel& cancel, OrderPage& page) -> void;
 
+  auto cancel_stop_order(const OrderCancel& cancel, OrderPage& page) -> void;
+
   OrderBook& order_book_;
 };
 
@@ -2,8 +2,10 @@
 #define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_EOD_ELIMINATION_HPP_
 
 #include <gsl/pointers>
+#include <optional>
 
 #include "common/events.hpp"
+#include "common/tick_scheduler.hpp"
 #include "core/domain/attributes.hpp"
 #include "core/tools/time.hpp"
 #include "ih/common/abstractions/event_listener.hpp"
@@ -21,15 +23,24 @@ class SystemElimination : EventReporter {
  private:
   auto eliminate_expired(LimitOrdersContainer& orders) const -> void;
 
-  auto is_expired(const LimitOrder& order) const -> bool;
+  auto eliminate_expired(StopOrdersContainer& orders) const -> void;
+
+  template <typename OrderType>
+  auto is_expired(const OrderType& order) const -> bool;
 
   auto eliminate(LimitOrder& order) const -> void;
 
+  auto eliminate(StopOrder& order) const -> void;
+
   core::sys_us current_expire_time_;
   core::local_days current_expire_date_;
   bool is_new_day_;
 };
 
+// Finds the earliest tick an order resting in the book may expire at,
+// following the rules of the system elimination
+auto find_expiry_deadline(OrderBook& book) -> std::optional<TickDeadline>;
+
 class AllOrdersElimination : EventReporter {
  public:
   explicit AllOrdersElimination(EventListener& event_listener);
@@ -39,6 +50,8 @@ class AllOrdersElimination : EventReporter {
  private:
   auto eliminate(LimitOrdersContainer& orders) const -> void;
 
+  static auto eliminate(StopOrdersContainer& orders) -> void;
+
   auto eliminate(LimitOrder& order) const -> void;
 };
 
@@ -52,10 +65,15 @@ class ClosedPhaseElimination : EventReporter {
  private:
   auto eliminate_expired(LimitOrdersContainer& orders) const -> void;
 
-  auto is_expired(const LimitOrder& order) const -> bool;
+  auto eliminate_expired(StopOrdersContainer& orders) const -> void;
+
+  template <typename OrderType>
+  auto is_expired(const OrderType& order) const -> bool;
 
   auto eliminate(LimitOrder& order) const -> void;
 
+  auto eliminate(StopOrder& order) const -> void;
+
   core::local_days phase_start_date_;
 };
 
@@ -69,10 +87,15 @@ class OnDisconnectElimination : EventReporter {
  private:
   auto handle_eliminated_orders(LimitOrdersContainer& orders) const -> void;
 
-  auto should_be_eliminated(const LimitOrder& order) const -> bool;
+  auto handle_eliminated_orders(StopOrdersContainer& orders) const -> void;
+
+  template <typename OrderType>
+  auto should_be_eliminated(const OrderType& order) const -> bool;
 
   auto eliminate(LimitOrder& order) const -> void;
 
+  auto eliminate(StopOrder& order) const -> void;
+
   gsl::not_null<const protocol::Session*> disconnected_session_;
 };
 
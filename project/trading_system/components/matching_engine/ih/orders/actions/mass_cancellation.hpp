@@ -0,0 +1,61 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_MASS_CANCELLATION_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_MASS_CANCELLATION_HPP_
+
+#include <cstddef>
+#include <gsl/pointers>
+#include <optional>
+#include <vector>
+
+#include "core/domain/attributes.hpp"
+#include "core/domain/party.hpp"
+#include "ih/common/abstractions/event_listener.hpp"
+#include "ih/common/events/event_reporter.hpp"
+#include "ih/orders/book/order_book.hpp"
+#include "protocol/app/mass_quote_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
+#include "protocol/types/session.hpp"
+
+namespace simulator::trading_system::matching_engine::order {
+
+// Cancels resting orders of a session, only those placed on behalf of any of
+// the requested parties, when the request specifies parties.
+// A mass quote cancels the quotes of its session only, whatever
+// parties it specifies.
+// Each side of the book is compacted in a single pass, so that cancelling
+// many orders does not shift the remaining ones once per cancelled order.
+class MassCancellation : EventReporter {
+ public:
+  // Cancels limit and stop orders, optionally of a single side
+  MassCancellation(EventListener& event_listener,
+                   const protocol::OrderMassCancellationRequest& request);
+
+  // Cancels quotes of the session, which are going to be replaced
+  // by the mass quote
+  MassCancellation(EventListener& event_listener,
+                   const protocol::MassQuoteRequest& request);
+
+  // Returns the number of cancelled orders
+  auto operator()(OrderBook& book) const -> std::size_t;
+
+ private:
+  auto cancel(LimitOrdersContainer& orders) const -> std::size_t;
+
+  auto cancel(StopOrdersContainer& orders) const -> std::size_t;
+
+  template <typename OrderType>
+  auto should_be_cancelled(const OrderType& order) const -> bool;
+
+  auto cancel(LimitOrder& order) const -> void;
+
+  auto cancel(StopOrder& order) const -> void;
+
+  gsl::not_null<const protocol::Session*> session_;
+  gsl::not_null<const std::vector<Party>*> parties_;
+  std::optional<Side> side_;
+  bool cancel_stop_orders_;
+  bool quotes_only_;
+};
+
+}  // namespace simulator::trading_system::matching_engine::order
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_MASS_CANCELLATION_HPP_
@@ -11,6 +11,7 @@
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/market_order.hpp"
 #include "ih/orders/book/order_updates.hpp"
+#include "ih/orders/book/stop_order.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
@@ -28,11 +29,18 @@ class OrderActionHandler {
 
   virtual auto place_market_order(MarketOrder order) -> void = 0;
 
+  virtual auto place_stop_order(StopOrder order) -> void = 0;
+
   virtual auto amend_limit_order(LimitUpdate update) -> void = 0;
 
   virtual auto cancel_order(const OrderCancel& cancel) -> void = 0;
 
   virtual auto recover_order(market_state::LimitOrder order_state) -> void = 0;
+
+  virtual auto recover_order(market_state::StopOrder order_state) -> void = 0;
+
+  // Releases stop orders triggered by the last trade price
+  virtual auto trigger_stop_orders() -> void = 0;
 };
 
 }  // namespace simulator::trading_system::matching_engine
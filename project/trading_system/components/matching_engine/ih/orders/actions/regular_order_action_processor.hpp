@@ -8,27 +8,40 @@
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/market_order.hpp"
 #include "ih/orders/book/order_book.hpp"
+#include "ih/orders/book/stop_order.hpp"
+#include "ih/orders/matchers/regular_order_matcher.hpp"
+#include "matching_engine/configuration.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
 class RegularOrderActionProcessor : public OrderActionHandler {
  public:
-  explicit RegularOrderActionProcessor(EventListener& event_listener,
-                                       OrderBook& order_book);
+  RegularOrderActionProcessor(EventListener& event_listener,
+                              OrderBook& order_book,
+                              SelfTradePrevention self_trade_prevention);
 
   auto place_limit_order(LimitOrder order) -> void override;
 
   auto place_market_order(MarketOrder order) -> void override;
 
+  auto place_stop_order(StopOrder order) -> void override;
+
   auto amend_limit_order(LimitUpdate update) -> void override;
 
   auto cancel_order(const OrderCancel& cancel) -> void override;
 
   auto recover_order(market_state::LimitOrder order_state) -> void override;
 
+  auto recover_order(market_state::StopOrder order_state) -> void override;
+
+  auto trigger_stop_orders() -> void override;
+
  private:
+  auto make_matcher() const -> RegularOrderMatcher;
+
   EventListener& event_listener_;
   OrderBook& order_book_;
+  SelfTradePrevention self_trade_prevention_;
 };
 
 }  // namespace simulator::trading_system::matching_engine
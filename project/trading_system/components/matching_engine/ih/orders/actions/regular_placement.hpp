@@ -6,6 +6,7 @@
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/market_order.hpp"
 #include "ih/orders/book/order_book.hpp"
+#include "ih/orders/book/stop_order.hpp"
 #include "ih/orders/matchers/order_matcher.hpp"
 
 namespace simulator::trading_system::matching_engine {
@@ -27,6 +28,9 @@ class RegularPlacement : private EventReporter {
 
   auto operator()(MarketOrder order) -> void;
 
+  // Keeps the order aside of the book until it is triggered
+  auto operator()(StopOrder order) -> void;
+
  private:
   auto place_order(LimitOrder order) -> void;
 
@@ -0,0 +1,23 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_STOP_ORDER_RECOVER_HPP
+#define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_STOP_ORDER_RECOVER_HPP
+
+#include "common/market_state/snapshot.hpp"
+#include "ih/orders/book/order_book.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+// Restores an untriggered stop order into the stop orders of its side,
+// stop orders are invisible to market data, so nothing is reported.
+class StopOrderRecover {
+ public:
+  explicit StopOrderRecover(OrderBook& order_book);
+
+  auto operator()(market_state::StopOrder order_state) -> void;
+
+ private:
+  OrderBook& order_book_;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_STOP_ORDER_RECOVER_HPP
@@ -0,0 +1,49 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_STOP_ORDER_TRIGGER_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_STOP_ORDER_TRIGGER_HPP_
+
+#include "ih/common/abstractions/event_listener.hpp"
+#include "ih/common/events/event_reporter.hpp"
+#include "ih/orders/book/limit_order.hpp"
+#include "ih/orders/book/market_order.hpp"
+#include "ih/orders/book/order_book.hpp"
+#include "ih/orders/book/stop_order.hpp"
+#include "ih/orders/matchers/order_matcher.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+// Releases stop orders triggered by the last trade price of the book.
+// Released orders are matched as taker orders and may trade, triggering
+// further stop orders, so the operation runs until no stop order is
+// triggered by the last trade price.
+class StopOrderTrigger : private EventReporter {
+ public:
+  StopOrderTrigger(EventListener& event_listener,
+                   OrderBook& order_book,
+                   RegularMatcher& matcher);
+
+  StopOrderTrigger(const StopOrderTrigger&) = default;
+  StopOrderTrigger(StopOrderTrigger&&) = default;
+  ~StopOrderTrigger() override = default;
+
+  auto operator=(const StopOrderTrigger&) -> StopOrderTrigger& = delete;
+  auto operator=(StopOrderTrigger&&) -> StopOrderTrigger& = delete;
+
+  auto operator()() -> void;
+
+ private:
+  auto release(StopOrder order) -> void;
+
+  auto place(LimitOrder order) -> void;
+
+  auto place(MarketOrder order) -> void;
+
+  template <typename OrderType>
+  auto cancel(OrderType& order) -> void;
+
+  OrderBook& order_book_;
+  RegularMatcher& matcher_;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_ACTIONS_STOP_ORDER_TRIGGER_HPP_
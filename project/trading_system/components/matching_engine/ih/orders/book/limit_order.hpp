@@ -12,6 +12,11 @@
 
 namespace simulator::trading_system::matching_engine {
 
+// A resting limit order. An order with a display quantity is an iceberg
+// order: only a slice of its leaves quantity of the display quantity size
+// is shown in the book, the rest is kept hidden. Once the displayed slice
+// is executed, the order replenishes it from the hidden quantity in place
+// and loses its time priority.
 class LimitOrder {
  public:
   struct Update {
@@ -22,6 +27,11 @@ class LimitOrder {
 
   LimitOrder(OrderPrice price, OrderQuantity quantity, OrderRecord record);
 
+  LimitOrder(OrderPrice price,
+             OrderQuantity quantity,
+             DisplayQuantity display_quantity,
+             OrderRecord record);
+
   [[nodiscard]]
   auto id() const -> OrderId;
 
@@ -31,6 +41,9 @@ class LimitOrder {
   [[nodiscard]]
   auto owner() const -> std::optional<Party>;
 
+  [[nodiscard]]
+  auto owner_key() const -> OwnerKey;
+
   [[nodiscard]]
   auto side() const -> Side;
 
@@ -71,25 +84,55 @@ class LimitOrder {
   [[nodiscard]]
   auto leaves_quantity() const -> LeavesQuantity;
 
+  [[nodiscard]]
+  auto display_quantity() const -> std::optional<DisplayQuantity>;
+
+  // The part of the leaves quantity shown in the book,
+  // equals to the leaves quantity for a non-iceberg order
+  [[nodiscard]]
+  auto displayed_quantity() const -> LeavesQuantity;
+
+  [[nodiscard]]
+  auto hidden_quantity() const -> LeavesQuantity;
+
   [[nodiscard]]
   auto time() const -> OrderTime;
 
   [[nodiscard]]
   auto executed() const -> bool;
 
+  // Determines if the order has leaves quantity and has not been cancelled
+  [[nodiscard]]
+  auto tradable() const -> bool;
+
   auto make_execution_id() -> ExecutionId;
 
+  // Replenishes the displayed slice of an iceberg order when the slice
+  // is executed and hidden quantity remains
   auto execute(ExecutedQuantity quantity) -> void;
 
+  // Restores the hidden quantity of a recovered iceberg order along with
+  // its order time, which may have been updated by a replenishment
+  auto restore_hidden_quantity(LeavesQuantity quantity, OrderTime order_time)
+      -> void;
+
   auto amend(Update update) -> void;
 
+  // Reduces the total quantity of the order by a part of its leaves
+  // quantity, the hidden quantity of an iceberg order is reduced first
+  auto reduce(LeavesQuantity quantity) -> void;
+
   auto cancel() -> void;
 
  private:
+  auto replenish() -> void;
+
   std::shared_ptr<OrderRecord> record_;
   OrderPrice price_;
   OrderQuantity total_quantity_;
   CumExecutedQuantity cum_executed_quantity_;
+  std::optional<DisplayQuantity> display_quantity_;
+  LeavesQuantity displayed_quantity_;
 };
 
 }  // namespace simulator::trading_system::matching_engine
@@ -25,6 +25,9 @@ class MarketOrder {
   [[nodiscard]]
   auto owner() const -> std::optional<Party>;
 
+  [[nodiscard]]
+  auto owner_key() const -> OwnerKey;
+
   [[nodiscard]]
   auto side() const -> Side;
 
@@ -65,8 +68,15 @@ class MarketOrder {
   [[nodiscard]]
   auto executed() const -> bool;
 
+  // Determines if the order has leaves quantity and has not been cancelled
+  [[nodiscard]]
+  auto tradable() const -> bool;
+
   auto execute(ExecutedQuantity quantity) -> void;
 
+  // Reduces the total quantity of the order by a part of its leaves quantity
+  auto reduce(LeavesQuantity quantity) -> void;
+
   auto cancel() -> void;
 
   auto make_execution_id() -> ExecutionId;
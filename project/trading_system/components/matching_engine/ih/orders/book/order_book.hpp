@@ -2,10 +2,13 @@
 #define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_BOOK_ORDER_BOOK_HPP_
 
 #include <functional>
+#include <map>
+#include <optional>
 #include <vector>
 
 #include "core/domain/attributes.hpp"
 #include "ih/orders/book/limit_order.hpp"
+#include "ih/orders/book/stop_order.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
@@ -51,6 +54,11 @@ class LimitOrdersContainer {
 
   auto erase(iterator begin, iterator end) -> void;
 
+  // Moves an order, which has lost its time priority, behind the newer
+  // orders of its price level, an order keeping its time stays in place.
+  // Only the order handle is moved, the order record is kept intact.
+  auto requeue(iterator iter) -> iterator;
+
  private:
   using Orders = std::vector<LimitOrder>;
 
@@ -58,6 +66,60 @@ class LimitOrdersContainer {
   BetterOrderComparator order_cmp_;
 };
 
+// Orders stop prices so that stop orders closer to be triggered go first:
+// ascending for the buy side, descending for the sell side.
+class EarlierTriggerComparator {
+ public:
+  EarlierTriggerComparator() = delete;
+  explicit EarlierTriggerComparator(Side side);
+
+  auto operator()(StopPrice left, StopPrice right) const -> bool;
+
+ private:
+  Side side_;
+};
+
+// Keeps stop orders of a side ordered by their stop prices, orders with
+// equal stop prices are kept in the order they were added.
+// As each trade triggers a prefix of the side, triggered orders are taken
+// in O(log n + k) without visiting untriggered orders.
+class StopOrdersContainer {
+ public:
+  using Orders = std::multimap<StopPrice, StopOrder, EarlierTriggerComparator>;
+  using iterator = Orders::iterator;
+  using const_iterator = Orders::const_iterator;
+  using value_type = Orders::value_type;
+
+  StopOrdersContainer() = delete;
+  explicit StopOrdersContainer(Side side);
+
+  auto size() const -> std::size_t;
+
+  auto empty() const -> bool;
+
+  auto begin() -> iterator;
+
+  auto begin() const -> const_iterator;
+
+  auto end() -> iterator;
+
+  auto end() const -> const_iterator;
+
+  auto emplace(const StopOrder& order) -> iterator;
+
+  auto erase(iterator iter) -> iterator;
+
+  // Checks if a trade at the given price triggers any order
+  auto has_triggered(Price trade_price) const -> bool;
+
+  // Removes orders triggered by a trade at the given price,
+  // returns them in the order they are to be released
+  auto take_triggered(Price trade_price) -> std::vector<StopOrder>;
+
+ private:
+  Orders orders_;
+};
+
 class OrderPage {
  public:
   explicit OrderPage(Side side);
@@ -66,8 +128,11 @@ class OrderPage {
 
   auto limit_orders() -> LimitOrdersContainer&;
 
+  auto stop_orders() -> StopOrdersContainer&;
+
  private:
   LimitOrdersContainer limit_orders_;
+  StopOrdersContainer stop_orders_;
 };
 
 class OrderBook {
@@ -78,9 +143,15 @@ class OrderBook {
 
   auto take_page(Side side) -> OrderPage&;
 
+  // Price of the last trade, used as a reference price by auctions
+  auto last_trade_price() const -> std::optional<Price>;
+
+  auto record_trade_price(Price price) -> void;
+
  private:
   OrderPage buy_page_{Side::Option::Buy};
   OrderPage sell_page_{Side::Option::Sell};
+  std::optional<Price> last_trade_price_;
 };
 
 }  // namespace simulator::trading_system::matching_engine
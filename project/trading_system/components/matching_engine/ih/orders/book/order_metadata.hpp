@@ -7,6 +7,7 @@
 #include "common/attributes.hpp"
 #include "core/domain/instrument_descriptor.hpp"
 #include "core/domain/party.hpp"
+#include "ih/orders/book/owner_key.hpp"
 #include "ih/orders/tools/exec_id_generator.hpp"
 #include "protocol/types/session.hpp"
 
@@ -36,6 +37,14 @@ class OrderAttributes {
   [[nodiscard]]
   auto order_owner() const -> std::optional<Party>;
 
+  // The interned order owner, resolved when order parties are set
+  [[nodiscard]]
+  auto owner_key() const -> OwnerKey;
+
+  // Tells whether the order was placed by a mass quote entry
+  [[nodiscard]]
+  auto quote() const -> bool;
+
   auto set_client_order_id(ClientOrderId client_order_id) -> void;
 
   auto set_time_in_force(TimeInForce time_in_force) -> void;
@@ -49,6 +58,8 @@ class OrderAttributes {
 
   auto set_order_parties(std::vector<Party> parties) -> void;
 
+  auto set_quote(bool quote) -> void;
+
  private:
   std::optional<ClientOrderId> client_order_id_;
   std::vector<Party> order_parties_;
@@ -56,6 +67,8 @@ class OrderAttributes {
   std::optional<ExpireDate> expire_date_;
   std::optional<ShortSaleExemptionReason> short_sale_exemption_reason_;
   TimeInForce time_in_force_{TimeInForce::Option::Day};
+  OwnerKey owner_key_{OwnerKey::None};
+  bool quote_{false};
 };
 
 class OrderRecord {
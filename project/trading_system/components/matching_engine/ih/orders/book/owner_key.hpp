@@ -0,0 +1,23 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_ORDERS_BOOK_OWNER_KEY_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_BOOK_OWNER_KEY_HPP_
+
+#include <cstdint>
+#include <optional>
+
+#include "core/domain/party.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+// An interned order owner (the executing firm party of an order).
+// Owners of two orders are the same party when their keys are equal,
+// so that the matcher compares owners without walking order parties.
+enum class OwnerKey : std::uint32_t { None = 0 };
+
+// Returns the key of the owner, identified by its party identifier.
+// Keys are shared by all engines of the process and never released.
+[[nodiscard]]
+auto intern_owner(const std::optional<Party>& owner) -> OwnerKey;
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_BOOK_OWNER_KEY_HPP_
@@ -0,0 +1,117 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_ORDERS_BOOK_STOP_ORDER_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_BOOK_STOP_ORDER_HPP_
+
+#include <fmt/base.h>
+
+#include <memory>
+#include <optional>
+#include <variant>
+
+#include "common/attributes.hpp"
+#include "core/domain/attributes.hpp"
+#include "ih/orders/book/limit_order.hpp"
+#include "ih/orders/book/market_order.hpp"
+#include "ih/orders/book/order_metadata.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+// An order, which is kept aside of the order book until a trade reaches
+// its stop price. A triggered order is released as a market order,
+// or as a limit order when it has a limit price (a stop-limit order).
+class StopOrder {
+ public:
+  using Released = std::variant<LimitOrder, MarketOrder>;
+
+  StopOrder(StopPrice stop_price,
+            std::optional<OrderPrice> limit_price,
+            OrderQuantity quantity,
+            OrderRecord record);
+
+  [[nodiscard]]
+  auto id() const -> OrderId;
+
+  [[nodiscard]]
+  auto attributes() const -> const OrderAttributes&;
+
+  [[nodiscard]]
+  auto owner() const -> std::optional<Party>;
+
+  [[nodiscard]]
+  auto side() const -> Side;
+
+  [[nodiscard]]
+  auto status() const -> OrderStatus;
+
+  [[nodiscard]]
+  auto client_session() const -> const protocol::Session&;
+
+  [[nodiscard]]
+  auto client_order_id() const -> const std::optional<ClientOrderId>&;
+
+  [[nodiscard]]
+  auto instrument() const -> const InstrumentDescriptor&;
+
+  [[nodiscard]]
+  auto time_in_force() const -> TimeInForce;
+
+  [[nodiscard]]
+  auto expire_time() const -> std::optional<ExpireTime>;
+
+  [[nodiscard]]
+  auto expire_date() const -> std::optional<ExpireDate>;
+
+  [[nodiscard]]
+  auto short_sale_exemption_reason() const
+      -> std::optional<ShortSaleExemptionReason>;
+
+  [[nodiscard]]
+  auto order_type() const -> OrderType;
+
+  [[nodiscard]]
+  auto stop_price() const -> StopPrice;
+
+  [[nodiscard]]
+  auto limit_price() const -> std::optional<OrderPrice>;
+
+  [[nodiscard]]
+  auto total_quantity() const -> OrderQuantity;
+
+  [[nodiscard]]
+  auto time() const -> OrderTime;
+
+  // Buy orders are triggered by trades at or above the stop price,
+  // sell orders - by trades at or below the stop price
+  [[nodiscard]]
+  auto is_triggered_by(Price trade_price) const -> bool;
+
+  auto make_execution_id() -> ExecutionId;
+
+  auto cancel() -> void;
+
+  // Converts the order to the order it releases once triggered,
+  // the released order keeps the identifier and the attributes of the
+  // stop order and is timestamped with the time of the release.
+  // A stop order must not be used after it has been released.
+  [[nodiscard]]
+  auto release() && -> Released;
+
+ private:
+  std::shared_ptr<OrderRecord> record_;
+  StopPrice stop_price_;
+  std::optional<OrderPrice> limit_price_;
+  OrderQuantity total_quantity_;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+template <>
+struct fmt::formatter<simulator::trading_system::matching_engine::StopOrder> {
+  using formattable = simulator::trading_system::matching_engine::StopOrder;
+
+  constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  auto format(const formattable& order, format_context& context) const
+      -> decltype(context.out());
+};
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_BOOK_STOP_ORDER_HPP_
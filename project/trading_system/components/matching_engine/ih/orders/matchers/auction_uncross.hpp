@@ -0,0 +1,58 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_ORDERS_MATCHERS_AUCTION_UNCROSS_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_MATCHERS_AUCTION_UNCROSS_HPP_
+
+#include <optional>
+
+#include "core/domain/attributes.hpp"
+#include "core/domain/market_phase.hpp"
+#include "ih/common/abstractions/event_listener.hpp"
+#include "ih/common/events/event_reporter.hpp"
+#include "ih/orders/book/order_book.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+struct AuctionEquilibrium {
+  Price price;
+  Quantity volume;
+  // Quantity left unexecuted on the side having more quantity at the price
+  Quantity imbalance;
+};
+
+// Executes orders accumulated in the book during an auction phase
+// in one batch at a single equilibrium price.
+class AuctionUncross : private EventReporter {
+ public:
+  AuctionUncross(EventListener& event_listener, OrderBook& order_book);
+
+  AuctionUncross(const AuctionUncross&) = default;
+  AuctionUncross(AuctionUncross&&) = default;
+  ~AuctionUncross() override = default;
+
+  auto operator=(const AuctionUncross&) -> AuctionUncross& = delete;
+  auto operator=(AuctionUncross&&) -> AuctionUncross& = delete;
+
+  // Returns nullopt when the book is not crossed.
+  auto operator()(MarketPhase auction_phase)
+      -> std::optional<AuctionEquilibrium>;
+
+  // Finds the price executing the maximum volume, ties are resolved by
+  // the minimum imbalance, then by the distance to the reference price,
+  // then by the lower price. Both sides are scanned once by price levels.
+  [[nodiscard]]
+  static auto find_equilibrium(const LimitOrdersContainer& buy_orders,
+                               const LimitOrdersContainer& sell_orders,
+                               std::optional<Price> reference_price)
+      -> std::optional<AuctionEquilibrium>;
+
+ private:
+  auto trade(LimitOrder& buyer,
+             LimitOrder& seller,
+             ExecutionPrice trade_price,
+             MarketPhase auction_phase) -> void;
+
+  OrderBook& order_book_;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_MATCHERS_AUCTION_UNCROSS_HPP_
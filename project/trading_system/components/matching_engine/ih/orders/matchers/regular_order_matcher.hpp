@@ -7,12 +7,16 @@
 #include "ih/common/events/event_reporter.hpp"
 #include "ih/orders/book/order_book.hpp"
 #include "ih/orders/matchers/order_matcher.hpp"
+#include "matching_engine/configuration.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
 class RegularOrderMatcher : public RegularMatcher, private EventReporter {
  public:
-  RegularOrderMatcher(EventListener& event_listener, OrderBook& order_book);
+  RegularOrderMatcher(
+      EventListener& event_listener,
+      OrderBook& order_book,
+      SelfTradePrevention self_trade_prevention = SelfTradePrevention::None);
 
   RegularOrderMatcher(const RegularOrderMatcher&) = default;
   RegularOrderMatcher(RegularOrderMatcher&&) = default;
@@ -42,16 +46,49 @@ class RegularOrderMatcher : public RegularMatcher, private EventReporter {
   auto find_matching_orders(const MarketOrder& taker)
       -> std::vector<LimitOrder*>;
 
-  auto trade_taker(LimitOrder& taker,
-                   const std::vector<LimitOrder*>& makers) -> void;
+  // Trading functions return identifiers of makers, which were replenished
+  // from their hidden quantity, in the order they were replenished
 
-  auto trade_ioc_taker(LimitOrder& taker,
-                       const std::vector<LimitOrder*>& makers) -> void;
+  auto trade_taker(LimitOrder& taker, std::vector<LimitOrder*> makers)
+      -> std::vector<OrderId>;
 
-  auto trade_market_taker(MarketOrder& taker,
-                          const std::vector<LimitOrder*>& makers) -> void;
+  auto trade_ioc_taker(LimitOrder& taker, std::vector<LimitOrder*> makers)
+      -> std::vector<OrderId>;
 
-  static auto remove_filled_orders(LimitOrdersContainer& side) -> void;
+  auto trade_market_taker(MarketOrder& taker, std::vector<LimitOrder*> makers)
+      -> std::vector<OrderId>;
+
+  // Removes executed and cancelled makers from the front of the side
+  static auto remove_completed_orders(LimitOrdersContainer& side) -> void;
+
+  static auto requeue_replenished_orders(LimitOrdersContainer& side,
+                                         const std::vector<OrderId>& order_ids)
+      -> void;
+
+  // Executes a maker, returns true if the maker has replenished its
+  // displayed quantity
+  static auto execute_maker(LimitOrder& maker, ExecutedQuantity quantity)
+      -> bool;
+
+  // Queues a replenished maker behind the makers of its price level,
+  // so that the taker may trade with the maker again
+  static auto requeue_maker(std::vector<LimitOrder*>& makers,
+                            std::size_t maker_idx) -> void;
+
+  // Returns the owner, whose makers the taker must not trade with,
+  // or OwnerKey::None when self trades are not prevented
+  template <typename TakerOrderType>
+  auto self_trade_owner(const TakerOrderType& taker) const -> OwnerKey;
+
+  // Resolves a self trade according to the configured mode,
+  // the taker stops matching once it is cancelled
+  template <typename TakerOrderType>
+  auto prevent_self_trade(TakerOrderType& taker, LimitOrder& maker) -> void;
+
+  template <typename TakerOrderType>
+  auto cancel_taker(TakerOrderType& taker) -> void;
+
+  auto cancel_maker(LimitOrder& maker) -> void;
 
   auto take_opposite_limit_orders(Side taker_side) -> LimitOrdersContainer&;
 
@@ -64,6 +101,7 @@ class RegularOrderMatcher : public RegularMatcher, private EventReporter {
       -> std::pair<ExecutionPrice, ExecutedQuantity>;
 
   OrderBook& order_book_;
+  SelfTradePrevention self_trade_prevention_;
 };
 
 }  // namespace simulator::trading_system::matching_engine
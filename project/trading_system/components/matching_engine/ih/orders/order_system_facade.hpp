@@ -3,9 +3,11 @@
 
 #include <gsl/pointers>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 #include "common/instrument.hpp"
+#include "common/tick_scheduler.hpp"
 #include "ih/common/abstractions/event_listener.hpp"
 #include "ih/common/abstractions/order_event_handler.hpp"
 #include "ih/common/abstractions/order_request_processor.hpp"
@@ -41,6 +43,13 @@ class OrderSystemFacade : public OrderRequestProcessor,
   auto process(const protocol::OrderCancellationRequest& request)
       -> void override;
 
+  auto process(const protocol::OrderMassCancellationRequest& request)
+      -> void override;
+
+  // Cancels resting quotes of the session and places
+  // the quote entries as day limit quotes
+  auto process(const protocol::MassQuoteRequest& request) -> void override;
+
   auto process(const protocol::SecurityStatusRequest& request) -> void override;
 
   auto store_state(market_state::OrderBook& state) -> void override;
@@ -53,6 +62,9 @@ class OrderSystemFacade : public OrderRequestProcessor,
 
   auto handle_disconnection(const protocol::Session& session) -> void override;
 
+  // Scans the book for the earliest tick a resting order expires at
+  auto expiry_deadline() -> std::optional<TickDeadline>;
+
   static auto setup(const Instrument& instrument,
                     const Configuration& configuration,
                     EventListener& listener) -> OrderSystemFacade;
@@ -61,16 +73,30 @@ class OrderSystemFacade : public OrderRequestProcessor,
   template <typename RequestType>
   auto validate(const RequestType& request) -> bool;
 
-  auto validate(const market_state::LimitOrder& order,
-                order::OrderBookSide order_book_side)
+  // Rejects requests, which cannot be processed in the current phase
+  template <typename RequestType>
+  auto validate_phase(const RequestType& request) -> bool;
+
+  // Validates a stored limit or stop order before it is recovered
+  template <typename OrderState>
+  auto validate(const OrderState& order, order::OrderBookSide order_book_side)
       -> std::optional<std::string_view>;
 
-  auto recover_page(std::vector<market_state::LimitOrder> orders_state,
+  template <typename OrderState>
+  auto recover_page(std::vector<OrderState> orders_state,
                     order::OrderBookSide side) -> void;
 
+  // Places an order, a quote is replaced by the next mass quote
+  // of the session
+  auto place(const protocol::OrderPlacementRequest& request, bool quote)
+      -> void;
+
   template <typename RequestType>
   auto reject_on_halt(const RequestType& request) -> bool;
 
+  // Orders are matched on arrival, except in auction phases
+  auto order_action_handler() -> OrderActionHandler&;
+
   OrderSystemFacade(
       EventListener& event_listener,
       const Instrument& instrument,
@@ -79,7 +105,8 @@ class OrderSystemFacade : public OrderRequestProcessor,
       std::unique_ptr<order::Validator> validator,
       std::unique_ptr<order::RejectNotifier> reject_notifier,
       std::unique_ptr<OrderBook> depr_order_book,
-      std::unique_ptr<OrderActionHandler> depr_order_action_handler);
+      std::unique_ptr<OrderActionHandler> depr_order_action_handler,
+      std::unique_ptr<OrderActionHandler> auction_order_action_handler);
 
   Configuration configuration_;
   order::PhaseHandler phase_handler_;
@@ -92,6 +119,7 @@ class OrderSystemFacade : public OrderRequestProcessor,
 
   std::unique_ptr<OrderBook> depr_order_book_;
   std::unique_ptr<OrderActionHandler> depr_order_action_handler_;
+  std::unique_ptr<OrderActionHandler> auction_order_action_handler_;
   gsl::not_null<EventListener*> event_listener_;
 };
 
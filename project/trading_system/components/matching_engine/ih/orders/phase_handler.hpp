@@ -5,6 +5,7 @@
 
 #include "common/events.hpp"
 #include "core/domain/attributes.hpp"
+#include "core/domain/market_phase.hpp"
 #include "ih/common/events/event_reporter.hpp"
 #include "protocol/app/security_status_request.hpp"
 #include "protocol/types/session.hpp"
@@ -35,6 +36,21 @@ class PhaseHandler : EventReporter {
     return current_state_.trading_status() == TradingStatus::Option::Halt;
   }
 
+  auto in_auction_phase() const -> bool {
+    const auto phase = current_state_.trading_phase();
+    return phase == TradingPhase::Option::OpeningAuction ||
+           phase == TradingPhase::Option::IntradayAuction ||
+           phase == TradingPhase::Option::ClosingAuction;
+  }
+
+  // Orders are matched on arrival
+  auto in_continuous_trading_phase() const -> bool {
+    return current_state_.trading_phase() == TradingPhase::Option::Open &&
+           !in_halt_phase();
+  }
+
+  auto current_phase() const -> MarketPhase { return current_state_; }
+
   auto handle(event::PhaseTransition transition) -> void;
 
   auto process(const protocol::SecurityStatusRequest& request) -> void;
@@ -5,7 +5,9 @@
 
 #include "common/attributes.hpp"
 #include "ih/orders/book/limit_order.hpp"
+#include "ih/orders/book/market_order.hpp"
 #include "ih/orders/book/order_updates.hpp"
+#include "ih/orders/book/stop_order.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
@@ -22,6 +24,10 @@ class CancellationConfirmationBuilder {
 
   auto for_order(const LimitOrder& order) -> CancellationConfirmationBuilder&;
 
+  auto for_order(const MarketOrder& order) -> CancellationConfirmationBuilder&;
+
+  auto for_order(const StopOrder& order) -> CancellationConfirmationBuilder&;
+
   auto with_execution_id(ExecutionId identifier)
       -> CancellationConfirmationBuilder&;
 
@@ -39,6 +45,14 @@ class CancellationConfirmationBuilder {
 auto prepare_cancellation_confirmation(const LimitOrder& order)
     -> CancellationConfirmationBuilder;
 
+[[nodiscard]]
+auto prepare_cancellation_confirmation(const MarketOrder& order)
+    -> CancellationConfirmationBuilder;
+
+[[nodiscard]]
+auto prepare_cancellation_confirmation(const StopOrder& order)
+    -> CancellationConfirmationBuilder;
+
 class CancellationRejectBuilder {
  public:
   explicit CancellationRejectBuilder(protocol::Session session);
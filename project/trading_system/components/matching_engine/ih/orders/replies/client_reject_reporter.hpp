@@ -23,6 +23,12 @@ class ClientRejectReporter : public RejectNotifier, private EventReporter {
   auto notify_rejected(const protocol::OrderCancellationRequest& request,
                        std::string_view reason) -> void override;
 
+  auto notify_rejected(const protocol::OrderMassCancellationRequest& request,
+                       std::string_view reason) -> void override;
+
+  auto notify_rejected(const protocol::MassQuoteRequest& request,
+                       std::string_view reason) -> void override;
+
  private:
   std::reference_wrapper<OrderIdGenerator> order_id_generator_;
 };
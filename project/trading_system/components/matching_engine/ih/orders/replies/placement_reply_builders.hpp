@@ -4,6 +4,7 @@
 #include "common/attributes.hpp"
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/market_order.hpp"
+#include "ih/orders/book/stop_order.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
 #include "protocol/app/order_placement_reject.hpp"
 #include "protocol/app/order_placement_request.hpp"
@@ -22,6 +23,8 @@ class PlacementConfirmationBuilder {
 
   auto for_order(const MarketOrder& order) -> PlacementConfirmationBuilder&;
 
+  auto for_order(const StopOrder& order) -> PlacementConfirmationBuilder&;
+
   auto with_execution_id(ExecutionId identifier)
       -> PlacementConfirmationBuilder&;
 
@@ -37,6 +40,10 @@ auto prepare_placement_confirmation(const LimitOrder& order)
 auto prepare_placement_confirmation(const MarketOrder& order)
     -> PlacementConfirmationBuilder;
 
+[[nodiscard]]
+auto prepare_placement_confirmation(const StopOrder& order)
+    -> PlacementConfirmationBuilder;
+
 class PlacementRejectBuilder {
  public:
   explicit PlacementRejectBuilder(protocol::Session session);
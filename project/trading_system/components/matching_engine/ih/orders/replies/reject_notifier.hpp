@@ -3,7 +3,9 @@
 
 #include <string_view>
 
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 
@@ -30,6 +32,14 @@ class RejectNotifier {
   virtual auto notify_rejected(
       const protocol::OrderCancellationRequest& cancellation_request,
       std::string_view reason) -> void = 0;
+
+  virtual auto notify_rejected(
+      const protocol::OrderMassCancellationRequest& mass_cancellation_request,
+      std::string_view reason) -> void = 0;
+
+  virtual auto notify_rejected(
+      const protocol::MassQuoteRequest& mass_quote_request,
+      std::string_view reason) -> void = 0;
 };
 
 }  // namespace simulator::trading_system::matching_engine::order
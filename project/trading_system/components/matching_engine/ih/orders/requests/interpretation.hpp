@@ -11,6 +11,7 @@
 #include "ih/orders/book/market_order.hpp"
 #include "ih/orders/book/order_metadata.hpp"
 #include "ih/orders/book/order_updates.hpp"
+#include "ih/orders/book/stop_order.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
@@ -24,12 +25,13 @@ enum class OrderRequestError : std::uint8_t {
   SideMissing,
   TimeInForceInvalid,
   PriceMissing,
+  StopPriceMissing,
   QuantityMissing,
   OrderIdInvalid,
 };
 
 using NewOrderInterpretation =
-    std::variant<OrderRequestError, LimitOrder, MarketOrder>;
+    std::variant<OrderRequestError, LimitOrder, MarketOrder, StopOrder>;
 using UpdateInterpretation = std::variant<OrderRequestError, LimitUpdate>;
 using CancelInterpretation = std::variant<OrderRequestError, OrderCancel>;
 
@@ -47,6 +49,12 @@ class PlacementInterpreter {
   auto interpret(const protocol::OrderPlacementRequest& request)
       -> NewOrderInterpretation;
 
+  // Interprets a mass quote entry placement as a limit order,
+  // which is marked as a quote of the session
+  [[nodiscard]]
+  auto interpret_quote(const protocol::OrderPlacementRequest& request)
+      -> NewOrderInterpretation;
+
  private:
   auto create_order_record(const protocol::OrderPlacementRequest& request,
                            OrderAttributes order_attributes) const
@@ -55,9 +63,16 @@ class PlacementInterpreter {
   auto interpret_as_limit_order(const protocol::OrderPlacementRequest& request)
       -> NewOrderInterpretation;
 
+  auto interpret_as_limit_order(const protocol::OrderPlacementRequest& request,
+                                OrderAttributes attributes)
+      -> NewOrderInterpretation;
+
   auto interpret_as_market_order(const protocol::OrderPlacementRequest& request)
       -> NewOrderInterpretation;
 
+  auto interpret_as_stop_order(const protocol::OrderPlacementRequest& request)
+      -> NewOrderInterpretation;
+
   OrderId new_order_id_;
 };
 
@@ -2,6 +2,7 @@
 #define SIMULATOR_MATCHING_ENGINE_IH_ORDERS_TOOLS_NOTIFICATION_CREATORS_HPP_
 
 #include "core/domain/attributes.hpp"
+#include "core/domain/market_phase.hpp"
 #include "ih/common/events/order_book_notification.hpp"
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/market_order.hpp"
@@ -34,6 +35,15 @@ auto make_trade_notification(const MarketOrder& taker,
                              ExecutedQuantity traded_quantity)
     -> OrderBookNotification;
 
+// Auction trades have no aggressor
+[[nodiscard]]
+auto make_auction_trade_notification(const LimitOrder& buyer,
+                                     const LimitOrder& seller,
+                                     ExecutionPrice trade_price,
+                                     ExecutedQuantity traded_quantity,
+                                     MarketPhase auction_phase)
+    -> OrderBookNotification;
+
 }  // namespace simulator::trading_system::matching_engine::order
 
 #endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_TOOLS_NOTIFICATION_CREATORS_HPP_
@@ -9,6 +9,15 @@ namespace simulator::trading_system::matching_engine {
 auto store_order_book_state(OrderBook& order_book,
                             market_state::OrderBook& state) -> void;
 
+// Restores attributes of a stored order, order parties are moved from it
+auto recover_order_attributes(market_state::LimitOrder& order_state)
+    -> OrderAttributes;
+
+auto recover_order_attributes(market_state::StopOrder& order_state)
+    -> OrderAttributes;
+
+auto recover_session(market_state::Session&& session) -> protocol::Session;
+
 }  // namespace simulator::trading_system::matching_engine
 
 #endif  // SIMULATOR_MATCHING_ENGINE_IH_ORDERS_TOOLS_PERSISTENT_STATE_HPP_
@@ -20,6 +20,16 @@ class OrderIdGenerator {
   [[nodiscard]]
   virtual auto operator()() -> OrderId = 0;
 
+  // Returns the identifier preceding the next generated one
+  [[nodiscard]]
+  virtual auto last_generated() const -> OrderId = 0;
+
+  // Continues the sequence after the given identifier
+  virtual auto resume_after(OrderId last_order_id) -> void = 0;
+
+  // Creates a generator of sequential identifiers starting from
+  // a unique time-based identifier, so that the identifiers generated
+  // after resuming the sequence are reproducible
   [[nodiscard]]
   static auto create() -> std::unique_ptr<OrderIdGenerator>;
 };
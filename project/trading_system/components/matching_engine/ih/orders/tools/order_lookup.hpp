@@ -21,6 +21,11 @@ auto find_target_limit_order(OrderPage& page, const LimitUpdate& update)
 auto find_target_limit_order(OrderPage& page, const OrderCancel& cancel)
     -> LimitOrdersContainer::iterator;
 
+// Stop orders are looked up rarely, so they are scanned linearly
+[[nodiscard]]
+auto find_target_stop_order(OrderPage& page, const OrderCancel& cancel)
+    -> StopOrdersContainer::iterator;
+
 }  // namespace simulator::trading_system::matching_engine
 
 #endif  // SIMULATOR_MATCHING_ENGINE_IH_TOOLS_ORDER_RESOLVER_HPP_
\ No newline at end of file
@@ -44,10 +44,17 @@ struct OrderSideSupported {
   explicit OrderSideSupported(OrderBookSide order_book_side)
       : order_book_side_(order_book_side) {}
 
-  auto operator()(const market_state::LimitOrder& order) const
-      -> ValidationResult;
+  auto operator()(const auto& order) const -> ValidationResult {
+    static_assert(
+        requires { order.side; },
+        "given type does not contain side field required by a matcher");
+
+    return check(order.side);
+  }
 
  private:
+  auto check(Side side) const -> ValidationResult;
+
   OrderBookSide order_book_side_;
 };
 
@@ -76,8 +83,17 @@ struct OrderTypeSupported {
 };
 
 struct OrderStatusSupported {
-  auto operator()(const market_state::LimitOrder& order) const
-      -> ValidationResult;
+  auto operator()(const auto& order) const -> ValidationResult {
+    static_assert(
+        requires { order.order_status; },
+        "given type does not contain order status field required by a "
+        "matcher");
+
+    return check(order.order_status);
+  }
+
+ private:
+  static auto check(OrderStatus order_status) -> ValidationResult;
 };
 
 struct OrderQuantitySpecified {
@@ -149,8 +165,15 @@ struct TotalQuantityRespectsMinimum {
   explicit TotalQuantityRespectsMinimum(std::optional<MinQuantity> min)
       : min_{min} {}
 
-  auto operator()(const market_state::LimitOrder& request) const
-      -> ValidationResult;
+  auto operator()(const auto& order) const -> ValidationResult {
+    static_assert(
+        requires { order.total_quantity; },
+        "given type does not contain total quantity field required by a "
+        "matcher");
+
+    return field_respects_minimum(
+        order.total_quantity, min_, ValidationError::TotalQuantityMinViolated);
+  }
 
  private:
   std::optional<MinQuantity> min_;
@@ -160,8 +183,15 @@ struct TotalQuantityRespectsMaximum {
   explicit TotalQuantityRespectsMaximum(std::optional<MaxQuantity> max)
       : max_{max} {}
 
-  auto operator()(const market_state::LimitOrder& order) const
-      -> ValidationResult;
+  auto operator()(const auto& order) const -> ValidationResult {
+    static_assert(
+        requires { order.total_quantity; },
+        "given type does not contain total quantity field required by a "
+        "matcher");
+
+    return field_respects_maximum(
+        order.total_quantity, max_, ValidationError::TotalQuantityMaxViolated);
+  }
 
  private:
   std::optional<MaxQuantity> max_;
@@ -171,8 +201,16 @@ struct TotalQuantityRespectsTick {
   explicit TotalQuantityRespectsTick(std::optional<QuantityTick> tick)
       : tick_{tick} {}
 
-  auto operator()(const market_state::LimitOrder& order) const
-      -> ValidationResult;
+  auto operator()(const auto& order) const -> ValidationResult {
+    static_assert(
+        requires { order.total_quantity; },
+        "given type does not contain total quantity field required by a "
+        "matcher");
+
+    return field_respects_tick(order.total_quantity,
+                               tick_,
+                               ValidationError::TotalQuantityTickViolated);
+  }
 
  private:
   std::optional<QuantityTick> tick_;
@@ -240,11 +278,101 @@ struct OrderPriceRespectsTick {
   std::optional<PriceTick> tick_;
 };
 
-struct TimeInForceSupported {
-  auto operator()(const market_state::LimitOrder& order) const
+struct StopPriceSpecified {
+  auto operator()(const auto& request) -> ValidationResult {
+    static_assert(
+        requires { request.stop_price; },
+        "given type does not contain stop price field required by a matcher");
+
+    return field_specified(request.stop_price,
+                           ValidationError::StopPriceMissing);
+  }
+};
+
+struct StopPriceRespectsTick {
+  explicit StopPriceRespectsTick(std::optional<PriceTick> tick)
+      : tick_(tick) {}
+
+  auto operator()(const auto& request) -> ValidationResult {
+    static_assert(
+        requires { request.stop_price; },
+        "given type does not contain stop price field required by a matcher");
+
+    return field_respects_tick(
+        request.stop_price, tick_, ValidationError::StopPriceTickViolated);
+  }
+
+ private:
+  std::optional<PriceTick> tick_;
+};
+
+struct DisplayQuantityAbsent {
+  auto operator()(const auto& request) -> ValidationResult {
+    static_assert(
+        requires { request.display_quantity; },
+        "given type does not contain display quantity field required by a "
+        "matcher");
+
+    return check(request.display_quantity);
+  }
+
+ private:
+  static auto check(std::optional<DisplayQuantity> quantity)
       -> ValidationResult;
 };
 
+// Display quantity, when specified, must be positive and must not exceed
+// the order quantity
+struct DisplayQuantityWithinOrderQuantity {
+  auto operator()(const auto& request) -> ValidationResult {
+    static_assert(
+        requires {
+          request.display_quantity;
+          request.order_quantity;
+        }, "given type does not contain fields required by a matcher");
+
+    return check(request.display_quantity, request.order_quantity);
+  }
+
+ private:
+  static auto check(std::optional<DisplayQuantity> display_quantity,
+                    std::optional<OrderQuantity> order_quantity)
+      -> ValidationResult;
+};
+
+struct DisplayQuantityRespectsTick {
+  explicit DisplayQuantityRespectsTick(std::optional<QuantityTick> tick)
+      : tick_(tick) {}
+
+  auto operator()(const auto& request) -> ValidationResult {
+    static_assert(
+        requires { request.display_quantity; },
+        "given type does not contain display quantity field required by a "
+        "matcher");
+
+    return field_respects_tick(request.display_quantity,
+                               tick_,
+                               ValidationError::DisplayQuantityTickViolated);
+  }
+
+ private:
+  std::optional<QuantityTick> tick_;
+};
+
+struct TimeInForceSupported {
+  auto operator()(const auto& order) const -> ValidationResult {
+    static_assert(
+        requires { order.time_in_force; },
+        "given type does not contain time in force field required by a "
+        "matcher");
+
+    return check(order.time_in_force);
+  }
+
+ private:
+  static auto check(TimeInForce time_in_force) -> ValidationResult;
+};
+
 struct OrderExpireInfoSpecified {
   auto operator()(const auto& request) const -> ValidationResult {
     static_assert(
@@ -292,8 +420,16 @@ struct OrderNotExpired {
 };
 
 struct DayOrderNotExpired {
-  auto operator()(const market_state::LimitOrder& order) const
-      -> ValidationResult;
+  auto operator()(const auto& order) const -> ValidationResult {
+    static_assert(
+        requires { order.order_time; },
+        "given type does not contain order time field required by a matcher");
+
+    return check(order.order_time);
+  }
+
+ private:
+  static auto check(OrderTime order_time) -> ValidationResult;
 };
 
 }  // namespace simulator::trading_system::matching_engine::order
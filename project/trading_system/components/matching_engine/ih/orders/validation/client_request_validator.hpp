@@ -46,6 +46,10 @@ class ClientRequestValidator : public Validator {
   auto validate(const market_state::LimitOrder& order,
                 OrderBookSide order_book_side) const -> Conclusion override;
 
+  [[nodiscard]]
+  auto validate(const market_state::StopOrder& order,
+                OrderBookSide order_book_side) const -> Conclusion override;
+
  private:
   auto run(Validation<protocol::OrderPlacementRequest>& validation) const
       -> void;
@@ -59,6 +63,9 @@ class ClientRequestValidator : public Validator {
   auto run(Validation<market_state::LimitOrder>& validation,
            OrderBookSide order_book_side) const -> void;
 
+  auto run(Validation<market_state::StopOrder>& validation,
+           OrderBookSide order_book_side) const -> void;
+
   Config config_{};
 };
 
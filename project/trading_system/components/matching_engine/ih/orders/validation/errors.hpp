@@ -31,7 +31,12 @@ enum class ValidationError : std::uint8_t {
   TimeInForceInvalid,
   OrderAlreadyExpired,
   BothExpireDateTimeSpecified,
-  ExpireDateTimeMissing
+  ExpireDateTimeMissing,
+  StopPriceMissing,
+  StopPriceTickViolated,
+  DisplayQuantityNotAllowed,
+  DisplayQuantityRangeViolated,
+  DisplayQuantityTickViolated
 };
 
 [[nodiscard]]
@@ -83,6 +88,16 @@ constexpr auto describe(ValidationError error) -> std::string_view {
       return "both expire date and expire time specified";
     case ValidationError::ExpireDateTimeMissing:
       return "neither expire date nor expire time specified";
+    case ValidationError::StopPriceMissing:
+      return "stop price missing";
+    case ValidationError::StopPriceTickViolated:
+      return "stop price tick constraint violated";
+    case ValidationError::DisplayQuantityNotAllowed:
+      return "display quantity is not allowed";
+    case ValidationError::DisplayQuantityRangeViolated:
+      return "display quantity is not positive or exceeds order quantity";
+    case ValidationError::DisplayQuantityTickViolated:
+      return "display quantity multiple constraint violated";
   }
 
   return "unknown order validation error";
@@ -149,6 +164,16 @@ struct fmt::formatter<
         return base::format("BothExpireDateTimeSpecified", context);
       case formattable::ExpireDateTimeMissing:
         return base::format("ExpireDateTimeMissing", context);
+      case formattable::StopPriceMissing:
+        return base::format("StopPriceMissing", context);
+      case formattable::StopPriceTickViolated:
+        return base::format("StopPriceTickViolated", context);
+      case formattable::DisplayQuantityNotAllowed:
+        return base::format("DisplayQuantityNotAllowed", context);
+      case formattable::DisplayQuantityRangeViolated:
+        return base::format("DisplayQuantityRangeViolated", context);
+      case formattable::DisplayQuantityTickViolated:
+        return base::format("DisplayQuantityTickViolated", context);
     }
 
     return base::format("UnknownOrderValidationError", context);
@@ -34,6 +34,10 @@ class Validator {
   [[nodiscard]]
   virtual auto validate(const market_state::LimitOrder& order,
                         OrderBookSide order_book_side) const -> Conclusion = 0;
+
+  [[nodiscard]]
+  virtual auto validate(const market_state::StopOrder& order,
+                        OrderBookSide order_book_side) const -> Conclusion = 0;
 };
 
 }  // namespace simulator::trading_system::matching_engine::order
@@ -0,0 +1,155 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_COMMAND_LATENCY_RECORDER_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_COMMAND_LATENCY_RECORDER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ih/statistics/latency_histogram.hpp"
+#include "protocol/admin/engine_latency.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+#ifdef SIM_ENABLE_ENGINE_LATENCY_HISTOGRAMS
+constexpr bool LatencyHistogramsEnabled = true;
+#else
+constexpr bool LatencyHistogramsEnabled = false;
+#endif
+
+enum class CommandType : std::uint8_t {
+  PlaceOrder,
+  AmendOrder,
+  CancelOrder,
+  MassCancelOrders,
+  MassQuote,
+  ProcessSecurityStatusRequest,
+  ProcessMarketDataRequest,
+  CaptureInstrumentState,
+  StoreState,
+  RecoverState,
+  NotifyClientDisconnected,
+  Tick,
+  PhaseTransition
+};
+
+enum class LatencyStage : std::uint8_t {
+  // From a request accepted by the engine until its command starts
+  QueueWait,
+  // Order matching or request processing, market data excluded
+  Execution,
+  // Composing and publishing market data updates
+  MarketData,
+  // Sending command replies to the trading reply channel
+  ReplyDispatch
+};
+
+// Records latencies of engine commands by command type and stage.
+//
+// Commands are executed one at a time, so the recorder keeps the state of
+// the command being executed and expects stages to be reported in order.
+// A histogram is allocated once its command stage is first recorded.
+// All operations are no-ops and no histograms are allocated when the engine
+// is built without SIM_ENABLE_ENGINE_LATENCY_HISTOGRAMS.
+class CommandLatencyRecorder {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using TimePoint = Clock::time_point;
+
+  CommandLatencyRecorder() = default;
+  CommandLatencyRecorder(const CommandLatencyRecorder&) = delete;
+  CommandLatencyRecorder(CommandLatencyRecorder&&) = delete;
+  ~CommandLatencyRecorder() noexcept;
+
+  auto operator=(const CommandLatencyRecorder&)
+      -> CommandLatencyRecorder& = delete;
+  auto operator=(CommandLatencyRecorder&&) -> CommandLatencyRecorder& = delete;
+
+  [[nodiscard]]
+  static auto now() noexcept -> TimePoint {
+    if constexpr (LatencyHistogramsEnabled) {
+      return Clock::now();
+    } else {
+      return TimePoint{};
+    }
+  }
+
+  auto start(CommandType command, TimePoint enqueued_at) -> void {
+    if constexpr (LatencyHistogramsEnabled) {
+      command_ = command;
+      stage_started_at_ = Clock::now();
+      market_data_time_ = Clock::duration::zero();
+      market_data_published_ = false;
+      record(LatencyStage::QueueWait, stage_started_at_ - enqueued_at);
+    }
+  }
+
+  auto start_market_data() noexcept -> void {
+    if constexpr (LatencyHistogramsEnabled) {
+      market_data_started_at_ = Clock::now();
+    }
+  }
+
+  auto finish_market_data() noexcept -> void {
+    if constexpr (LatencyHistogramsEnabled) {
+      market_data_time_ += Clock::now() - market_data_started_at_;
+      market_data_published_ = true;
+    }
+  }
+
+  auto finish_execution() -> void {
+    if constexpr (LatencyHistogramsEnabled) {
+      const auto finished_at = Clock::now();
+      record(LatencyStage::Execution,
+             finished_at - stage_started_at_ - market_data_time_);
+      if (market_data_published_) {
+        record(LatencyStage::MarketData, market_data_time_);
+      }
+      stage_started_at_ = finished_at;
+    }
+  }
+
+  auto finish_reply_dispatch() -> void {
+    if constexpr (LatencyHistogramsEnabled) {
+      record(LatencyStage::ReplyDispatch, Clock::now() - stage_started_at_);
+    }
+  }
+
+  // Appends summaries of non-empty histograms,
+  // may be called concurrently with recording
+  auto report(std::vector<protocol::CommandLatency>& latencies) const -> void;
+
+ private:
+  constexpr static std::size_t CommandsCount =
+      static_cast<std::size_t>(CommandType::PhaseTransition) + 1;
+  constexpr static std::size_t StagesCount =
+      static_cast<std::size_t>(LatencyStage::ReplyDispatch) + 1;
+
+  auto record(LatencyStage stage, Clock::duration latency) -> void {
+    const auto index = static_cast<std::size_t>(command_) * StagesCount +
+                       static_cast<std::size_t>(stage);
+    // Only the recording thread stores histogram pointers
+    auto* histogram = histograms_[index].load(std::memory_order_relaxed);
+    if (histogram == nullptr) [[unlikely]] {
+      histogram = std::make_unique<LatencyHistogram>().release();
+      histograms_[index].store(histogram, std::memory_order_release);
+    }
+    histogram->record(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(latency));
+  }
+
+  std::array<std::atomic<LatencyHistogram*>, CommandsCount * StagesCount>
+      histograms_{};
+  TimePoint stage_started_at_;
+  TimePoint market_data_started_at_;
+  Clock::duration market_data_time_{};
+  CommandType command_ = CommandType::PlaceOrder;
+  bool market_data_published_ = false;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_COMMAND_LATENCY_RECORDER_HPP_
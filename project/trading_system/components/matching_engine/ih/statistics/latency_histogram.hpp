@@ -0,0 +1,99 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_LATENCY_HISTOGRAM_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_LATENCY_HISTOGRAM_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace simulator::trading_system::matching_engine {
+
+// Log-linear latency histogram in the manner of HdrHistogram: each power of
+// two range of nanoseconds is split into 16 linear sub-buckets, which gives
+// about 6% relative precision. Latencies above ~2 minutes are counted in the
+// last bucket.
+//
+// Recording is lock-free and expects a single recording thread at a time
+// (the engine executes commands sequentially), summaries may be taken
+// by any thread concurrently with recording.
+class LatencyHistogram {
+ public:
+  struct Summary {
+    std::uint64_t count = 0;
+    std::chrono::nanoseconds mean{0};
+    std::chrono::nanoseconds p50{0};
+    std::chrono::nanoseconds p90{0};
+    std::chrono::nanoseconds p99{0};
+    std::chrono::nanoseconds p999{0};
+    std::chrono::nanoseconds max{0};
+  };
+
+  auto record(std::chrono::nanoseconds latency) noexcept -> void {
+    const auto value = static_cast<std::uint64_t>(
+        std::max(latency.count(), std::chrono::nanoseconds::rep{0}));
+    increment(buckets_[bucket_of(value)]);
+    sum_.store(sum_.load(std::memory_order_relaxed) + value,
+               std::memory_order_relaxed);
+    if (value > max_.load(std::memory_order_relaxed)) {
+      max_.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  [[nodiscard]]
+  auto summarize() const -> Summary;
+
+  [[nodiscard]]
+  constexpr static auto bucket_of(std::uint64_t value) noexcept
+      -> std::size_t {
+    if (value < LinearRange) {
+      return static_cast<std::size_t>(value);
+    }
+    const auto shift =
+        static_cast<std::size_t>(std::bit_width(value)) - SubBucketBits - 1;
+    if (shift > MaxShift) {
+      return BucketsCount - 1;
+    }
+    return LinearRange + (shift - 1) * SubBuckets +
+           static_cast<std::size_t>((value >> shift) - SubBuckets);
+  }
+
+  // Returns the largest value counted in the bucket
+  [[nodiscard]]
+  constexpr static auto highest_equivalent(std::size_t bucket) noexcept
+      -> std::uint64_t {
+    if (bucket < LinearRange) {
+      return bucket;
+    }
+    const auto relative = bucket - LinearRange;
+    const auto shift = relative / SubBuckets + 1;
+    const auto sub_bucket = relative % SubBuckets + SubBuckets;
+    return ((std::uint64_t{sub_bucket} + 1) << shift) - 1;
+  }
+
+ private:
+  constexpr static std::size_t SubBucketBits = 4;
+  constexpr static std::size_t SubBuckets = std::size_t{1} << SubBucketBits;
+  // Values below are counted exactly, one value per bucket
+  constexpr static std::size_t LinearRange = SubBuckets * 2;
+  constexpr static std::size_t MaxShift = 32;
+  constexpr static std::size_t BucketsCount =
+      LinearRange + MaxShift * SubBuckets;
+
+  // A single writer does not need a read-modify-write operation
+  static auto increment(std::atomic<std::uint64_t>& counter) noexcept
+      -> void {
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+  }
+
+  std::array<std::atomic<std::uint64_t>, BucketsCount> buckets_{};
+  std::atomic<std::uint64_t> sum_{0};
+  std::atomic<std::uint64_t> max_{0};
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_LATENCY_HISTOGRAM_HPP_
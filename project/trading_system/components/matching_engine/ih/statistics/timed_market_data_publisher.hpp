@@ -0,0 +1,29 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_TIMED_MARKET_DATA_PUBLISHER_HPP_
+#define SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_TIMED_MARKET_DATA_PUBLISHER_HPP_
+
+#include "ih/common/abstractions/market_data_publisher.hpp"
+#include "ih/statistics/command_latency_recorder.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+// Reports market data publishing time of a command to the latency recorder
+class TimedMarketDataPublisher final : public MarketDataPublisher {
+ public:
+  TimedMarketDataPublisher(MarketDataPublisher& publisher,
+                           CommandLatencyRecorder& recorder) noexcept
+      : publisher_(publisher), recorder_(recorder) {}
+
+  auto publish() -> void override {
+    recorder_.start_market_data();
+    publisher_.publish();
+    recorder_.finish_market_data();
+  }
+
+ private:
+  MarketDataPublisher& publisher_;
+  CommandLatencyRecorder& recorder_;
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_IH_STATISTICS_TIMED_MARKET_DATA_PUBLISHER_HPP_
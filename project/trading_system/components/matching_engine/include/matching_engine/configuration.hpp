@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_COMPONENTS_MATCHING_ENGINE_CONFIGURATION_HPP_
 #define SIMULATOR_TRADING_SYSTEM_COMPONENTS_MATCHING_ENGINE_CONFIGURATION_HPP_
 
+#include <cstdint>
 #include <optional>
 
 #include "common/attributes.hpp"
@@ -8,6 +9,22 @@
 
 namespace simulator::trading_system::matching_engine {
 
+// Determines what happens when an order would trade with a resting order
+// of the same owner (the executing firm party)
+enum class SelfTradePrevention : std::uint8_t {
+  // Orders of the same owner trade with each other
+  None,
+  // The incoming order is cancelled
+  CancelNewest,
+  // The resting order is cancelled, the incoming order continues matching
+  CancelOldest,
+  // Both orders are cancelled
+  CancelBoth,
+  // Both orders are reduced by the smaller leaves quantity,
+  // an order left without leaves quantity is cancelled
+  Decrement
+};
+
 struct Configuration {
   core::TzClock clock;
 
@@ -21,7 +38,9 @@ struct Configuration {
   bool report_trade_volume = true;
   bool report_trade_parties = true;
   bool report_trade_aggressor_side = true;
+  std::uint32_t trade_history_depth = 1;
   bool support_market_data_orders_exclusion = false;
+  SelfTradePrevention self_trade_prevention = SelfTradePrevention::None;
 };
 
 }  // namespace simulator::trading_system::matching_engine
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "common/events.hpp"
+#include "common/tick_scheduler.hpp"
 #include "common/trading_engine.hpp"
 #include "matching_engine/configuration.hpp"
 #include "runtime/mux.hpp"
@@ -15,9 +16,12 @@ class MatchingEngine final : public TradingEngine {
  public:
   class Implementation;
 
+  // The engine registers its deadlines in `tick_scheduler`,
+  // it expects ticks only when its deadline is due
   MatchingEngine(const Instrument& instrument,
                  const Configuration& configuration,
-                 runtime::Service& executor) noexcept;
+                 runtime::Service& executor,
+                 TickScheduler& tick_scheduler) noexcept;
 
   MatchingEngine() = delete;
   MatchingEngine(const MatchingEngine&) = delete;
@@ -33,6 +37,11 @@ class MatchingEngine final : public TradingEngine {
 
   auto execute(protocol::OrderCancellationRequest request) -> void override;
 
+  auto execute(protocol::OrderMassCancellationRequest request)
+      -> void override;
+
+  auto execute(protocol::MassQuoteRequest request) -> void override;
+
   auto execute(protocol::MarketDataRequest request) -> void override;
 
   auto execute(protocol::SecurityStatusRequest request) -> void override;
@@ -49,6 +58,12 @@ class MatchingEngine final : public TradingEngine {
 
   auto handle(event::PhaseTransition phase_transition) -> void override;
 
+  auto replay_at(core::sys_us journaled_at) -> void override;
+
+  auto finish_replay() -> void override;
+
+  auto provide_latency(protocol::EngineLatency& latency) -> void override;
+
  private:
   runtime::Mux mux_;
   std::unique_ptr<Implementation> implementation_;
@@ -1,47 +1,68 @@
 #include "ih/commands/client_notification_cache.hpp"
 
 #include <utility>
+#include <variant>
 
 #include "log/logging.hpp"
 #include "middleware/routing/trading_reply_channel.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
-namespace {
+ClientNotifications::ClientNotifications(
+    std::vector<middleware::TradingReply>& notifications) noexcept
+    : notifications_(notifications) {}
 
-template <typename ReplyType>
-auto send_trading_reply(ReplyType&& reply) -> void {
-  log::debug("sending {}", reply);
+auto ClientNotifications::publish() -> void {
+  if (notifications_.empty()) {
+    return;
+  }
+
+  for (const auto& notification : notifications_) {
+    std::visit([](const auto& message) { log::debug("sending {}", message); },
+               notification);
+  }
 
   try {
-    middleware::send_trading_reply(std::forward<ReplyType>(reply));
+    middleware::send_trading_replies(notifications_);
   } catch (const std::exception& exception) {
-    log::err("failed to send a reply message, an error occurred: {}",
+    log::err("failed to send reply messages, an error occurred: {}",
              exception.what());
   } catch (...) {
-    log::err("failed to send a reply message, an unknown error occurred");
+    log::err("failed to send reply messages, an unknown error occurred");
   }
+  // Keeps the capacity for replies of the next command
+  notifications_.clear();
 }
 
-}  // namespace
-
-ClientNotifications::ClientNotifications(
-    std::vector<ClientNotification> notifications)
-    : notifications_(std::move(notifications)) {}
+auto ClientNotifications::discard() noexcept -> void {
+  // Keeps the capacity for replies of the next command
+  notifications_.clear();
+}
 
-auto ClientNotifications::publish() -> void {
-  for (auto& notification : std::exchange(notifications_, {})) {
-    std::visit([](auto& message) { send_trading_reply(std::move(message)); },
-               notification.value);
-  }
+ClientNotificationCache::ClientNotificationCache() {
+  cached_notifications_.reserve(InitialCapacity);
 }
 
 auto ClientNotificationCache::add(ClientNotification notification) -> void {
-  cached_notifications_.emplace_back(std::move(notification));
+  std::visit(
+      [this]<typename Message>(Message& message) {
+        cached_notifications_.emplace_back(std::in_place_type<Message>,
+                                           std::move(message));
+      },
+      notification.value);
+}
+
+auto ClientNotificationCache::handle(ClientNotification notification)
+    -> void {
+  add(std::move(notification));
 }
 
 auto ClientNotificationCache::collect() -> ClientNotifications {
-  return ClientNotifications{std::exchange(cached_notifications_, {})};
+  return ClientNotifications{cached_notifications_};
+}
+
+auto ClientNotificationCache::capacity() const noexcept -> std::size_t {
+  return cached_notifications_.capacity();
 }
 
-}  // namespace simulator::trading_system::matching_engine
\ No newline at end of file
+}  // namespace simulator::trading_system::matching_engine
@@ -93,6 +93,41 @@ auto CancelOrder::execute() const -> void {
 
 auto CancelOrder::name() const -> std::string_view { return "CancelOrder"; }
 
+MassCancelOrders::MassCancelOrders(
+    protocol::OrderMassCancellationRequest request,
+    OrderRequestProcessor& request_processor,
+    MarketDataPublisher& market_data_publisher,
+    ClientNotificationCache& cache)
+    : detail::ReplyingCommand(cache),
+      request_(std::move(request)),
+      request_processor_(request_processor),
+      market_data_publisher_(market_data_publisher) {}
+
+auto MassCancelOrders::execute() const -> void {
+  request_processor_.process(request_);
+  market_data_publisher_.publish();
+}
+
+auto MassCancelOrders::name() const -> std::string_view {
+  return "MassCancelOrders";
+}
+
+MassQuote::MassQuote(protocol::MassQuoteRequest request,
+                     OrderRequestProcessor& request_processor,
+                     MarketDataPublisher& market_data_publisher,
+                     ClientNotificationCache& cache)
+    : detail::ReplyingCommand(cache),
+      request_(std::move(request)),
+      request_processor_(request_processor),
+      market_data_publisher_(market_data_publisher) {}
+
+auto MassQuote::execute() const -> void {
+  request_processor_.process(request_);
+  market_data_publisher_.publish();
+}
+
+auto MassQuote::name() const -> std::string_view { return "MassQuote"; }
+
 ProcessSecurityStatusRequest::ProcessSecurityStatusRequest(
     protocol::SecurityStatusRequest request,
     OrderRequestProcessor& request_processor,
@@ -147,7 +182,8 @@ StoreState::StoreState(market_state::InstrumentState& state,
 
 auto StoreState::execute() const -> void {
   request_processor_.store_state(state_.order_book);
-  mdata_processor_.store_state(state_.last_trade, state_.info);
+  mdata_processor_.store_state(
+      state_.last_trade, state_.recent_trades, state_.info);
 }
 
 auto StoreState::name() const -> std::string_view { return "StoreState"; }
@@ -163,7 +199,8 @@ RecoverState::RecoverState(market_state::InstrumentState state,
 
 auto RecoverState::execute() const -> void {
   request_processor_.recover_state(std::move(state_.order_book));
-  mdata_processor_.recover_state(state_.last_trade, state_.info);
+  mdata_processor_.recover_state(
+      state_.last_trade, state_.recent_trades, state_.info);
   market_data_publisher_.publish();
 }
 
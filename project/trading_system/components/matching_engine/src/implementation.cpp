@@ -1,6 +1,8 @@
 #include "ih/implementation.hpp"
 
 #include <functional>
+#include <optional>
+#include <string>
 
 #include "ih/common/events/client_notification.hpp"
 #include "ih/common/events/order_book_notification.hpp"
@@ -8,95 +10,224 @@
 
 namespace simulator::trading_system::matching_engine {
 
+namespace {
+
+// Finds a deadline of an order the request may leave resting in the book,
+// the time in force is interpreted as Day when it is not specified
+template <typename RequestType>
+auto requested_deadline(const RequestType& request) -> TickDeadline {
+  const auto time_in_force =
+      request.time_in_force.value_or(TimeInForce::Option::Day);
+  if (time_in_force == TimeInForce::Option::Day) {
+    return TickDeadline{.new_day = true};
+  }
+  if (time_in_force == TimeInForce::Option::GoodTillDate) {
+    if (request.expire_time.has_value()) {
+      return TickDeadline{
+          .time = static_cast<core::sys_us>(*request.expire_time)};
+    }
+    if (request.expire_date.has_value()) {
+      return TickDeadline{.new_day = true};
+    }
+  }
+  return TickDeadline{};
+}
+
+}  // namespace
+
 MatchingEngine::Implementation::Implementation(
-    const Instrument& instrument, const Configuration& configuration)
-    : order_system_facade_(OrderSystemFacade::setup(
+    const Instrument& instrument,
+    const Configuration& configuration,
+    TickScheduler& tick_scheduler)
+    : instrument_id_(instrument.identifier),
+      symbol_(instrument.symbol.has_value() ? instrument.symbol->value()
+                                            : std::string{}),
+      tick_scheduler_(tick_scheduler),
+      timed_market_data_publisher_(market_data_facade_, latency_recorder_),
+      event_dispatcher_(cached_client_notifications_, market_data_facade_),
+      order_system_facade_(OrderSystemFacade::setup(
           instrument, configuration, event_dispatcher_)),
       market_data_facade_(
-          MarketDataFacade::setup(configuration, event_dispatcher_)) {
-  event_dispatcher_
-      .on_client_notification([this](ClientNotification notification) {
-        cached_client_notifications_.add(std::move(notification));
-      })
-      .on_order_book_notification([this](OrderBookNotification notification) {
-        market_data_facade_.handle(std::move(notification));
-      });
+          MarketDataFacade::setup(configuration, event_dispatcher_)) {}
+
+auto MatchingEngine::Implementation::dispatch_order_cmd(
+    protocol::OrderPlacementRequest request, TimePoint enqueued_at) -> void {
+  const TickDeadline deadline = requested_deadline(request);
+  execute(create_place_order_command(std::move(request)),
+          CommandType::PlaceOrder,
+          enqueued_at);
+  schedule_tick(deadline);
 }
 
 auto MatchingEngine::Implementation::dispatch_order_cmd(
-    protocol::OrderPlacementRequest request) -> void {
-  execute(create_place_order_command(std::move(request)));
+    protocol::OrderModificationRequest request, TimePoint enqueued_at) -> void {
+  const TickDeadline deadline = requested_deadline(request);
+  execute(create_amend_order_command(std::move(request)),
+          CommandType::AmendOrder,
+          enqueued_at);
+  schedule_tick(deadline);
 }
 
 auto MatchingEngine::Implementation::dispatch_order_cmd(
-    protocol::OrderModificationRequest request) -> void {
-  execute(create_amend_order_command(std::move(request)));
+    protocol::OrderCancellationRequest request, TimePoint enqueued_at) -> void {
+  execute(create_cancel_order_command(std::move(request)),
+          CommandType::CancelOrder,
+          enqueued_at);
+}
+
+auto MatchingEngine::Implementation::dispatch_order_cmd(
+    protocol::OrderMassCancellationRequest request, TimePoint enqueued_at)
+    -> void {
+  execute(create_mass_cancel_orders_command(std::move(request)),
+          CommandType::MassCancelOrders,
+          enqueued_at);
 }
 
 auto MatchingEngine::Implementation::dispatch_order_cmd(
-    protocol::OrderCancellationRequest request) -> void {
-  execute(create_cancel_order_command(std::move(request)));
+    protocol::MassQuoteRequest request, TimePoint enqueued_at) -> void {
+  execute(create_mass_quote_command(std::move(request)),
+          CommandType::MassQuote,
+          enqueued_at);
+  // Quotes are placed as day orders
+  schedule_tick(TickDeadline{.new_day = true});
 }
 
 auto MatchingEngine::Implementation::dispatch_order_cmd(
-    protocol::SecurityStatusRequest request) -> void {
-  execute(create_security_status_command(std::move(request)));
+    protocol::SecurityStatusRequest request, TimePoint enqueued_at) -> void {
+  execute(create_security_status_command(std::move(request)),
+          CommandType::ProcessSecurityStatusRequest,
+          enqueued_at);
 }
 
 auto MatchingEngine::Implementation::dispatch_mdata_cmd(
-    protocol::MarketDataRequest request) -> void {
-  execute(create_process_market_data_request_command(std::move(request)));
+    protocol::MarketDataRequest request, TimePoint enqueued_at) -> void {
+  execute(create_process_market_data_request_command(std::move(request)),
+          CommandType::ProcessMarketDataRequest,
+          enqueued_at);
 }
 
 auto MatchingEngine::Implementation::dispatch_client_disconnected_cmd(
-    const protocol::Session& client_session) -> void {
-  execute(create_notify_client_disconnected_command(client_session));
+    const protocol::Session& client_session, TimePoint enqueued_at) -> void {
+  execute(create_notify_client_disconnected_command(client_session),
+          CommandType::NotifyClientDisconnected,
+          enqueued_at);
 }
 
 auto MatchingEngine::Implementation::dispatch_instrument_state_capture_cmd(
-    protocol::InstrumentState& reply) -> void {
-  execute(create_capture_instrument_state_command(reply));
+    protocol::InstrumentState& reply, TimePoint enqueued_at) -> void {
+  execute(create_capture_instrument_state_command(reply),
+          CommandType::CaptureInstrumentState,
+          enqueued_at);
 }
 
 auto MatchingEngine::Implementation::dispatch_store_state_cmd(
-    market_state::InstrumentState& state) -> void {
-  execute(create_store_state_command(state));
+    market_state::InstrumentState& state, TimePoint enqueued_at) -> void {
+  execute(create_store_state_command(state),
+          CommandType::StoreState,
+          enqueued_at);
 }
 
 auto MatchingEngine::Implementation::dispatch_recover_state_cmd(
-    market_state::InstrumentState state) -> void {
-  execute(create_recover_state_command(std::move(state)));
+    market_state::InstrumentState state, TimePoint enqueued_at) -> void {
+  execute(create_recover_state_command(std::move(state)),
+          CommandType::RecoverState,
+          enqueued_at);
+  reschedule_tick();
 }
 
-auto MatchingEngine::Implementation::dispatch_tick_cmd(event::Tick tick)
-    -> void {
-  execute(create_tick_command(std::move(tick)));
+auto MatchingEngine::Implementation::dispatch_tick_cmd(
+    event::Tick tick, TimePoint enqueued_at) -> void {
+  execute(create_tick_command(std::move(tick)), CommandType::Tick, enqueued_at);
+  reschedule_tick();
 }
 
 auto MatchingEngine::Implementation::dispatch_phase_transition_cmd(
-    event::PhaseTransition phase_transition) -> void {
-  execute(create_phase_transition_command(phase_transition));
+    event::PhaseTransition phase_transition, TimePoint enqueued_at) -> void {
+  execute(create_phase_transition_command(phase_transition),
+          CommandType::PhaseTransition,
+          enqueued_at);
+  reschedule_tick();
+}
+
+auto MatchingEngine::Implementation::provide_latency(
+    protocol::EngineLatency& latency) const -> void {
+  latency.instrument_id = instrument_id_.value();
+  latency.symbol = symbol_;
+  latency_recorder_.report(latency.commands);
+}
+
+auto MatchingEngine::Implementation::start_replay(core::sys_us journaled_at)
+    -> void {
+  replay_time_ = journaled_at;
+}
+
+auto MatchingEngine::Implementation::finish_replay() -> void {
+  replay_time_.reset();
 }
 
 auto MatchingEngine::Implementation::execute(
-    const command::detail::ActionCommand& cmd) -> void {
+    const command::detail::ActionCommand& cmd,
+    CommandType type,
+    TimePoint enqueued_at) -> void {
   log::trace("executing {} command", cmd.name());
+  std::optional<core::CurrentTimeOverride> replay_time;
+  if (replay_time_.has_value()) {
+    replay_time.emplace(*replay_time_);
+  }
+  latency_recorder_.start(type, enqueued_at);
   std::invoke(cmd);
+  latency_recorder_.finish_execution();
   log::trace("{} command executed", cmd.name());
 }
 
 auto MatchingEngine::Implementation::execute(
-    const command::detail::ReplyingCommand& cmd) -> void {
+    const command::detail::ReplyingCommand& cmd,
+    CommandType type,
+    TimePoint enqueued_at) -> void {
   log::trace("executing {} command", cmd.name());
-  std::invoke(cmd).publish();
+  std::optional<core::CurrentTimeOverride> replay_time;
+  if (replay_time_.has_value()) {
+    replay_time.emplace(*replay_time_);
+  }
+  latency_recorder_.start(type, enqueued_at);
+  auto replies = std::invoke(cmd);
+  latency_recorder_.finish_execution();
+  if (replay_time_.has_value()) {
+    // Clients were notified when the command was processed initially
+    replies.discard();
+  } else {
+    replies.publish();
+  }
+  latency_recorder_.finish_reply_dispatch();
   log::trace("{} command executed", cmd.name());
 }
 
+auto MatchingEngine::Implementation::market_data_publisher()
+    -> MarketDataPublisher& {
+  if constexpr (LatencyHistogramsEnabled) {
+    return timed_market_data_publisher_;
+  } else {
+    return market_data_facade_;
+  }
+}
+
+auto MatchingEngine::Implementation::schedule_tick(
+    const TickDeadline& deadline) -> void {
+  if (!deadline.empty()) {
+    tick_scheduler_.schedule(instrument_id_, deadline);
+  }
+}
+
+auto MatchingEngine::Implementation::reschedule_tick() -> void {
+  tick_scheduler_.reschedule(instrument_id_,
+                             order_system_facade_.expiry_deadline());
+}
+
 auto MatchingEngine::Implementation::create_place_order_command(
     protocol::OrderPlacementRequest request) -> command::PlaceOrder {
   return {std::move(request),
           order_system_facade_,
-          market_data_facade_,
+          market_data_publisher(),
           cached_client_notifications_};
 }
 
@@ -104,7 +235,7 @@ auto MatchingEngine::Implementation::create_amend_order_command(
     protocol::OrderModificationRequest request) -> command::AmendOrder {
   return {std::move(request),
           order_system_facade_,
-          market_data_facade_,
+          market_data_publisher(),
           cached_client_notifications_};
 }
 
@@ -112,7 +243,24 @@ auto MatchingEngine::Implementation::create_cancel_order_command(
     protocol::OrderCancellationRequest request) -> command::CancelOrder {
   return {std::move(request),
           order_system_facade_,
-          market_data_facade_,
+          market_data_publisher(),
+          cached_client_notifications_};
+}
+
+auto MatchingEngine::Implementation::create_mass_cancel_orders_command(
+    protocol::OrderMassCancellationRequest request)
+    -> command::MassCancelOrders {
+  return {std::move(request),
+          order_system_facade_,
+          market_data_publisher(),
+          cached_client_notifications_};
+}
+
+auto MatchingEngine::Implementation::create_mass_quote_command(
+    protocol::MassQuoteRequest request) -> command::MassQuote {
+  return {std::move(request),
+          order_system_facade_,
+          market_data_publisher(),
           cached_client_notifications_};
 }
 
@@ -144,7 +292,7 @@ auto MatchingEngine::Implementation::create_recover_state_command(
   return {std::move(state),
           order_system_facade_,
           market_data_facade_,
-          market_data_facade_};
+          market_data_publisher()};
 }
 
 auto MatchingEngine::Implementation::create_notify_client_disconnected_command(
@@ -160,7 +308,7 @@ auto MatchingEngine::Implementation::create_tick_command(event::Tick event)
     -> command::TickCommand {
   return {event,
           order_system_facade_,
-          market_data_facade_,
+          market_data_publisher(),
           cached_client_notifications_};
 }
 
@@ -168,7 +316,7 @@ auto MatchingEngine::Implementation::create_phase_transition_command(
     event::PhaseTransition event) -> command::PhaseTransitionCommand {
   return {event,
           order_system_facade_,
-          market_data_facade_,
+          market_data_publisher(),
           cached_client_notifications_};
 }
 
@@ -9,6 +9,10 @@ auto MarketDataRecover::operator()(std::optional<Trade> last_trade) -> void {
   emit(OrderBookNotification{LastTradeRecover{std::move(last_trade)}});
 }
 
+auto MarketDataRecover::operator()(std::vector<Trade> recent_trades) -> void {
+  emit(OrderBookNotification{TradeHistoryRecover{std::move(recent_trades)}});
+}
+
 auto MarketDataRecover::operator()(
     std::optional<market_state::InstrumentInfo> info) -> void {
   emit(OrderBookNotification{InstrumentInfoRecover{std::move(info)}});
@@ -11,7 +11,8 @@ auto make_trade_cache_configuration(const Configuration& configuration) {
   return TradeCache::Config{
       .report_trade_volume = configuration.report_trade_volume,
       .report_trade_parties = configuration.report_trade_parties,
-      .report_trade_aggressor_side = configuration.report_trade_aggressor_side};
+      .report_trade_aggressor_side = configuration.report_trade_aggressor_side,
+      .history_depth = configuration.trade_history_depth};
 }
 
 [[nodiscard]]
@@ -49,14 +50,19 @@ auto CacheManager::compose_update(const StreamingSettings& settings) const
   return update;
 }
 
+auto CacheManager::update_sequence() const -> std::uint64_t {
+  return update_sequence_;
+}
+
 auto CacheManager::capture(protocol::InstrumentState& state) const -> void {
   depth_cache_.capture(state);
 }
 
 auto CacheManager::store_state(
     std::optional<Trade>& last_trade,
+    std::optional<std::vector<Trade>>& recent_trades,
     std::optional<market_state::InstrumentInfo>& info) -> void {
-  trade_cache_.store_state(last_trade);
+  trade_cache_.store_state(last_trade, recent_trades);
   instrument_info_cache_.store_state(info);
 }
 
@@ -69,6 +75,7 @@ auto CacheManager::apply_pending_changes() -> void {
   instrument_info_cache_.update(pending_notifications_);
   depth_cache_.update(pending_notifications_);
   pending_notifications_.clear();
+  update_sequence_++;
 }
 
 auto CacheManager::was_updated() const -> bool {
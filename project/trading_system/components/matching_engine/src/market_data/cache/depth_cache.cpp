@@ -5,7 +5,6 @@
 
 #include "core/common/unreachable.hpp"
 #include "core/tools/overload.hpp"
-#include "ih/market_data/depth/depth_stats_reader.hpp"
 #include "ih/market_data/depth/full_depth_update.hpp"
 #include "ih/market_data/depth/incremental_depth_update.hpp"
 #include "ih/market_data/tools/algorithms.hpp"
@@ -47,17 +46,13 @@ auto DepthCache::compose_update(const StreamingSettings& settings,
 }
 
 auto DepthCache::capture(protocol::InstrumentState& state) const -> void {
-  DepthStatsReader reader;
-
-  reader.read(bid_depth_.view());
-  state.current_bid_depth = CurrentBidDepth(reader.levels_count());
-  if (const auto tob_price = reader.tob_price()) {
+  state.current_bid_depth = CurrentBidDepth(bid_depth_.levels_count());
+  if (const auto tob_price = bid_depth_.tob_price()) {
     state.best_bid_price = BestBidPrice(*tob_price);
   }
 
-  reader.read(offer_depth_.view());
-  state.current_offer_depth = CurrentOfferDepth(reader.levels_count());
-  if (const auto tob_price = reader.tob_price()) {
+  state.current_offer_depth = CurrentOfferDepth(offer_depth_.levels_count());
+  if (const auto tob_price = offer_depth_.tob_price()) {
     state.best_offer_price = BestOfferPrice(*tob_price);
   }
 }
@@ -1,5 +1,6 @@
 #include "ih/market_data/cache/trade_cache.hpp"
 
+#include <algorithm>
 #include <ranges>
 #include <variant>
 
@@ -11,14 +12,18 @@ namespace simulator::trading_system::matching_engine::mdata {
 TradeCache::TradeCache(MarketEntryIdGenerator& id_generator)
     : id_generator_(id_generator) {}
 
-auto TradeCache::configure(Config config) -> void { config_ = config; }
+auto TradeCache::configure(Config config) -> void {
+  config_ = config;
+  history_.set_capacity(std::max<std::size_t>(config_.history_depth, 1));
+}
 
 auto TradeCache::compose_initial(
     const StreamingSettings& settings,
     std::vector<MarketDataEntry>& destination) const -> void {
-  if (settings.is_data_type_requested(MdEntryType::Option::Trade) &&
-      last_trade_.has_value()) {
-    destination.emplace_back(compose_market_entry(*last_trade_));
+  if (settings.is_data_type_requested(MdEntryType::Option::Trade)) {
+    history_.for_each([&](const Trade& trade) {
+      destination.emplace_back(compose_market_entry(trade));
+    });
   }
 }
 
@@ -40,23 +45,35 @@ auto TradeCache::update(const std::vector<OrderBookNotification>& updates)
   for (const auto& update : updates) {
     if (const auto* trade = std::get_if<Trade>(&update.value)) {
       cached_trades_.emplace_back(*trade);
+      history_.push(*trade);
     }
     if (const auto* recover = std::get_if<LastTradeRecover>(&update.value)) {
       cached_trades_.clear();
+      history_.clear();
       const auto& last_trade = recover->trade;
       if (last_trade.has_value()) {
         cached_trades_.emplace_back(*last_trade);
+        history_.push(*last_trade);
+      }
+    }
+    if (const auto* recover =
+            std::get_if<TradeHistoryRecover>(&update.value)) {
+      history_.clear();
+      for (const auto& trade : recover->trades) {
+        history_.push(trade);
       }
     }
-  }
-
-  if (!cached_trades_.empty()) {
-    last_trade_ = cached_trades_.back();
   }
 }
 
-auto TradeCache::store_state(std::optional<Trade>& last_trade) const -> void {
-  last_trade = last_trade_;
+auto TradeCache::store_state(
+    std::optional<Trade>& last_trade,
+    std::optional<std::vector<Trade>>& recent_trades) const -> void {
+  last_trade.reset();
+  if (!history_.empty()) {
+    last_trade = history_.last();
+  }
+  history_.store(recent_trades.emplace());
 }
 
 auto TradeCache::compose_market_entry(const Trade& trade) const
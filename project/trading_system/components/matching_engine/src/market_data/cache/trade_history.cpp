@@ -0,0 +1,68 @@
+#include "ih/market_data/cache/trade_history.hpp"
+
+#include <cassert>
+#include <utility>
+
+namespace simulator::trading_system::matching_engine::mdata {
+
+TradeHistory::TradeHistory(std::size_t capacity) : capacity_(capacity) {}
+
+auto TradeHistory::set_capacity(std::size_t capacity) -> void {
+  if (capacity == capacity_) {
+    return;
+  }
+
+  const auto count = size();
+  const auto skipped = count > capacity ? count - capacity : 0;
+
+  std::vector<Trade> slots;
+  slots.reserve(count - skipped);
+  for (std::size_t offset = skipped; offset < count; ++offset) {
+    slots.emplace_back(std::move(slots_[(oldest_ + offset) % count]));
+  }
+
+  slots_ = std::move(slots);
+  capacity_ = capacity;
+  oldest_ = 0;
+}
+
+auto TradeHistory::capacity() const noexcept -> std::size_t {
+  return capacity_;
+}
+
+auto TradeHistory::size() const noexcept -> std::size_t {
+  return slots_.size();
+}
+
+auto TradeHistory::empty() const noexcept -> bool { return slots_.empty(); }
+
+auto TradeHistory::last() const -> const Trade& {
+  assert(!empty());
+  return slots_[(oldest_ + size() - 1) % size()];
+}
+
+auto TradeHistory::push(const Trade& trade) -> void {
+  if (capacity_ == 0) {
+    return;
+  }
+
+  if (slots_.size() < capacity_) {
+    slots_.emplace_back(trade);
+  } else {
+    slots_[oldest_] = trade;
+    oldest_ = (oldest_ + 1) % capacity_;
+  }
+}
+
+auto TradeHistory::clear() noexcept -> void {
+  slots_.clear();
+  oldest_ = 0;
+}
+
+auto TradeHistory::store(std::vector<Trade>& destination) const -> void {
+  destination.clear();
+  destination.reserve(size());
+  for_each([&](const Trade& trade) { destination.emplace_back(trade); });
+}
+
+}  // namespace simulator::trading_system::matching_engine::mdata
@@ -12,6 +12,10 @@ DepthNode::DepthNode(MarketEntryId identifier, const OrderAdded& initial)
   apply(initial);
 }
 
+auto DepthNode::quantity() const -> Quantity {
+  return quantities_.full_quantity();
+}
+
 auto DepthNode::empty() const -> bool {
   return is_empty_quantity(quantities_.full_quantity());
 }
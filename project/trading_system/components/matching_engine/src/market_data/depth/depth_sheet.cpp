@@ -18,7 +18,7 @@ DepthSheet::DepthSheet(std::unique_ptr<DepthNodeComparator> cmp,
     : cmp_(std::move(cmp)), idgen_(&idgen) {}
 
 auto DepthSheet::apply(const OrderAdded& action) -> void {
-  const auto iter = std::ranges::upper_bound(
+  auto iter = std::ranges::upper_bound(
       nodes_,
       action.order_price,
       [this](auto new_price, const auto& node) -> bool {
@@ -26,9 +26,12 @@ auto DepthSheet::apply(const OrderAdded& action) -> void {
       });
 
   if (iter != nodes_.end() && iter->price() == action.order_price) {
+    const bool was_visible = !iter->empty();
     iter->apply(action);
+    update_stats(iter, was_visible);
   } else {
-    nodes_.emplace(iter, std::invoke(*idgen_), action);
+    iter = nodes_.emplace(iter, std::invoke(*idgen_), action);
+    update_stats(iter, false);
   }
 }
 
@@ -38,7 +41,9 @@ auto DepthSheet::apply(const OrderReduced& action) -> void {
   });
 
   if (iter != nodes_.end()) [[likely]] {
+    const bool was_visible = !iter->empty();
     iter->apply(action);
+    update_stats(iter, was_visible);
     return;
   }
 
@@ -54,7 +59,9 @@ auto DepthSheet::apply(const OrderRemoved& action) -> void {
   });
 
   if (iter != nodes_.end()) [[likely]] {
+    const bool was_visible = !iter->empty();
     iter->apply(action);
+    update_stats(iter, was_visible);
     return;
   }
 
@@ -69,6 +76,43 @@ auto DepthSheet::fold() -> void {
   std::ranges::for_each(nodes_, [](auto& node) { node.fold(); });
 }
 
+auto DepthSheet::update_stats(const std::vector<DepthNode>::iterator node,
+                              const bool was_visible) -> void {
+  const bool is_visible = !node->empty();
+  if (is_visible && !was_visible) {
+    ++levels_count_;
+  } else if (!is_visible && was_visible) {
+    --levels_count_;
+  }
+
+  if (is_visible) {
+    if (!tob_.has_value() || (*cmp_)(node->price(), tob_->price)) {
+      tob_ = TopOfBook{.price = node->price(), .quantity = node->quantity()};
+    }
+  } else if (tob_.has_value() && tob_->price == node->price()) {
+    tob_ = find_next_top(node);
+  }
+}
+
+auto DepthSheet::find_next_top(
+    const std::vector<DepthNode>::const_iterator previous_top) const
+    -> std::optional<TopOfBook> {
+  // Nodes are ordered from the worst to the best price, and empty nodes are
+  // erased on each fold. Therefore, only levels emptied since the last fold
+  // may be skipped here before the next visible level is found.
+  const auto worse_nodes =
+      std::ranges::subrange(nodes_.begin(), previous_top) |
+      std::views::reverse;
+  const auto next_top = std::ranges::find_if(
+      worse_nodes, [](const auto& node) { return !node.empty(); });
+
+  if (next_top == std::ranges::end(worse_nodes)) {
+    return std::nullopt;
+  }
+  return TopOfBook{.price = next_top->price(),
+                   .quantity = next_top->quantity()};
+}
+
 auto DepthSheet::create_bid_sheet(MarketEntryIdGenerator& idgen) -> DepthSheet {
   return {std::make_unique<BidComparator>(), idgen};
 }
@@ -60,16 +60,22 @@ auto MarketDataFacade::capture(protocol::InstrumentState& state) -> void {
 
 auto MarketDataFacade::store_state(
     std::optional<Trade>& last_trade,
+    std::optional<std::vector<Trade>>& recent_trades,
     std::optional<market_state::InstrumentInfo>& info) -> void {
-  cache_manager_.store_state(last_trade, info);
+  cache_manager_.store_state(last_trade, recent_trades, info);
 }
 
 auto MarketDataFacade::recover_state(
     std::optional<Trade> last_trade,
+    std::optional<std::vector<Trade>> recent_trades,
     std::optional<market_state::InstrumentInfo> info) -> void {
   if (validate(last_trade)) {
     recover_(std::move(last_trade));
   }
+  // Recent trades are absent in states stored by older versions
+  if (recent_trades.has_value() && validate(*recent_trades)) {
+    recover_(std::move(*recent_trades));
+  }
   if (validate(info)) {
     recover_(std::move(info));
   }
@@ -106,6 +112,23 @@ auto MarketDataFacade::validate(const std::optional<Trade>& last_trade) const
   return true;
 }
 
+auto MarketDataFacade::validate(const std::vector<Trade>& recent_trades) const
+    -> bool {
+  for (const auto& trade : recent_trades) {
+    const auto conclusion = validator_->validate(trade);
+    if (conclusion.failed()) {
+      log::err(
+          "validation failed with '{}' error, recent trades were not "
+          "recovered: {}",
+          conclusion.error(),
+          trade);
+      return false;
+    }
+  }
+
+  return true;
+}
+
 auto MarketDataFacade::validate(
     const std::optional<market_state::InstrumentInfo>& info) const -> bool {
   if (!info) {
@@ -19,6 +19,7 @@ auto Subscription::send_initial(const MarketDataProvider& provider) -> void {
   protocol::MarketDataSnapshot snapshot{session_};
   snapshot.request_id = request_id_;
   snapshot.instrument = instrument_;
+  snapshot.update_sequence = SeqNum{provider.update_sequence()};
   snapshot.market_data_entries = provider.compose_initial(settings_);
   emit(make_snapshot_published_notification(std::move(snapshot)));
 }
@@ -40,6 +41,7 @@ auto Subscription::send_full_update(const MarketDataProvider& provider)
   protocol::MarketDataSnapshot update{session_};
   update.request_id = request_id_;
   update.instrument = instrument_;
+  update.update_sequence = SeqNum{provider.update_sequence()};
   update.market_data_entries = provider.compose_update(settings_);
   emit(make_snapshot_published_notification(std::move(update)));
 }
@@ -48,6 +50,7 @@ auto Subscription::send_incremental_update(const MarketDataProvider& provider)
     -> void {
   protocol::MarketDataUpdate update{session_};
   update.request_id = request_id_;
+  update.update_sequence = SeqNum{provider.update_sequence()};
   update.market_data_entries = provider.compose_update(settings_);
   if (!update.market_data_entries.empty()) {
     emit(make_update_published_notification(std::move(update)));
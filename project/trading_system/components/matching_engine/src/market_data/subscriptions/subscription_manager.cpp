@@ -1,9 +1,16 @@
 #include "ih/market_data/subscriptions/subscription_manager.hpp"
 
 #include <cassert>
-#include <map>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
 
+#include "core/tools/overload.hpp"
 #include "ih/market_data/subscriptions/subscription.hpp"
 #include "ih/market_data/tools/algorithms.hpp"
 #include "ih/market_data/tools/notification_creators.hpp"
@@ -11,69 +18,145 @@
 
 namespace simulator::trading_system::matching_engine::mdata {
 
-class SubscriptionManager::Index {
-  using Container = std::multimap<MdRequestId, std::shared_ptr<Subscription>>;
-  using iterator = Container::iterator;
+namespace {
+
+auto combine_hashes(std::size_t seed, std::size_t hash) noexcept
+    -> std::size_t {
+  return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U));
+}
+
+// Has to agree with the FIX session equality,
+// which does not take ClientSubID into account
+auto hash_fix_session(const protocol::fix::Session& session) noexcept
+    -> std::size_t {
+  const std::hash<std::string> hash;
+  auto seed = hash(session.begin_string.value());
+  seed = combine_hashes(seed, hash(session.sender_comp_id.value()));
+  return combine_hashes(seed, hash(session.target_comp_id.value()));
+}
+
+struct SessionHash {
+  auto operator()(const protocol::Session& session) const noexcept
+      -> std::size_t {
+    const auto type_hash = std::hash<std::size_t>{}(session.value.index());
+    return std::visit(
+        core::overload(
+            [&](const protocol::fix::Session& fix_session) {
+              return combine_hashes(type_hash, hash_fix_session(fix_session));
+            },
+            [&](const auto& /*stateless_session*/) { return type_hash; }),
+        session.value);
+  }
+};
+
+struct SubscriptionKey {
+  protocol::Session session;
+  MdRequestId request_id;
+
+  auto operator==(const SubscriptionKey& other) const -> bool = default;
+};
+
+struct SubscriptionKeyHash {
+  auto operator()(const SubscriptionKey& key) const noexcept -> std::size_t {
+    return combine_hashes(SessionHash{}(key.session),
+                          std::hash<std::string>{}(key.request_id.value()));
+  }
+};
 
+}  // namespace
+
+// Subscriptions are kept in a contiguous array, which is iterated on each
+// publication. A (session, request id) hash map locates a subscription in the
+// array, and per-session buckets allow to drop all subscriptions of
+// a disconnected session without scanning the whole array.
+// Removal moves the last subscription into the freed slot.
+class SubscriptionManager::Index {
  public:
-  auto emplace(Subscription subscription) -> std::shared_ptr<Subscription> {
-    const auto existing_iter =
-        find(subscription.request_id(), subscription.session());
-
-    if (existing_iter == subscriptions_.end()) {
-      auto added = std::make_shared<Subscription>(std::move(subscription));
-      subscriptions_.emplace(added->request_id(), added);
-      return added;
+  // Returns the added subscription or nullptr if a subscription with the same
+  // request id already exists for the session. The returned pointer is valid
+  // until the index is modified.
+  auto emplace(Subscription subscription) -> Subscription* {
+    SubscriptionKey key{subscription.session(), subscription.request_id()};
+    if (positions_.contains(key)) {
+      return nullptr;
     }
-    return nullptr;
+
+    sessions_[key.session].push_back(key.request_id);
+    positions_.emplace(std::move(key), subscriptions_.size());
+    return &subscriptions_.emplace_back(std::move(subscription));
   }
 
   auto erase(const MdRequestId& request_id,
-             const protocol::Session& subscriber_session)
-      -> std::shared_ptr<Subscription> {
-    const auto iter = find(request_id, subscriber_session);
-    if (iter != subscriptions_.end()) {
-      const auto subscription = iter->second;
-      subscriptions_.erase(iter);
-      return subscription;
+             const protocol::Session& subscriber_session) -> bool {
+    const auto iter =
+        positions_.find(SubscriptionKey{subscriber_session, request_id});
+    if (iter == positions_.end()) {
+      return false;
     }
-    return nullptr;
+
+    const auto position = iter->second;
+    positions_.erase(iter);
+    erase_from_bucket(subscriber_session, request_id);
+    erase_at(position);
+    return true;
+  }
+
+  auto erase(const protocol::Session& subscriber_session) -> void {
+    const auto bucket = sessions_.find(subscriber_session);
+    if (bucket == sessions_.end()) {
+      return;
+    }
+
+    for (const auto& request_id : bucket->second) {
+      const auto iter =
+          positions_.find(SubscriptionKey{subscriber_session, request_id});
+      assert(iter != positions_.end());
+      const auto position = iter->second;
+      positions_.erase(iter);
+      erase_at(position);
+    }
+    sessions_.erase(bucket);
   }
 
   template <typename F>
     requires std::invocable<F, Subscription&>
-  auto for_each(F function) const -> void {
-    for (const auto& [_, subscription] : subscriptions_) {
-      function(*subscription);
+  auto for_each(F function) -> void {
+    for (auto& subscription : subscriptions_) {
+      function(subscription);
     }
   }
 
-  template <typename P>
-    requires std::predicate<P, Subscription&>
-  auto erase_if(P predicate) -> void {
-    for (auto iter = subscriptions_.begin(); iter != subscriptions_.end();) {
-      if (predicate(*iter->second)) {
-        const auto subscription = iter->second;
-        iter = subscriptions_.erase(iter);
-      } else {
-        ++iter;
-      }
+ private:
+  auto erase_at(std::size_t position) -> void {
+    assert(position < subscriptions_.size());
+
+    const auto last = subscriptions_.size() - 1;
+    if (position != last) {
+      auto& moved = subscriptions_[last];
+      positions_.at(SubscriptionKey{moved.session(), moved.request_id()}) =
+          position;
+      subscriptions_[position] = std::move(moved);
     }
+    subscriptions_.pop_back();
   }
 
- private:
-  auto find(const MdRequestId& request_id,
-            const protocol::Session& subscriber_session) -> iterator {
-    auto [begin, end] = subscriptions_.equal_range(request_id);
-    for (auto iter = begin; iter != end; ++iter) {
-      if (iter->second->session() == subscriber_session) {
-        return iter;
-      }
+  auto erase_from_bucket(const protocol::Session& subscriber_session,
+                         const MdRequestId& request_id) -> void {
+    const auto bucket = sessions_.find(subscriber_session);
+    assert(bucket != sessions_.end());
+
+    auto& request_ids = bucket->second;
+    std::erase(request_ids, request_id);
+    if (request_ids.empty()) {
+      sessions_.erase(bucket);
     }
-    return subscriptions_.end();
   }
 
-  Container subscriptions_;
+  std::vector<Subscription> subscriptions_;
+  std::unordered_map<SubscriptionKey, std::size_t, SubscriptionKeyHash>
+      positions_;
+  std::unordered_map<protocol::Session, std::vector<MdRequestId>, SessionHash>
+      sessions_;
 };
 
 SubscriptionManager::SubscriptionManager(
@@ -107,9 +190,7 @@ auto SubscriptionManager::process(protocol::MarketDataRequest request) -> void {
 
 auto SubscriptionManager::unsubscribe(const protocol::Session& client_session)
     -> void {
-  index_->erase_if([&](Subscription& subscription) {
-    return subscription.session() == client_session;
-  });
+  index_->erase(client_session);
 }
 
 auto SubscriptionManager::publish() -> void {
@@ -179,8 +260,7 @@ auto SubscriptionManager::unsubscribe(protocol::MarketDataRequest request)
       "unsubscribing a client from market data stream, subscription id: {}",
       request.request_id);
 
-  auto subscription = index_->erase(*request.request_id, request.session);
-  if (!subscription) {
+  if (!index_->erase(*request.request_id, request.session)) {
     emit(make_request_rejected_notification(
         request, "no subscription found for the request id"));
   }
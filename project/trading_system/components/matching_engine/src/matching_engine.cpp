@@ -11,19 +11,24 @@ namespace simulator::trading_system::matching_engine {
 
 MatchingEngine::MatchingEngine(const Instrument& instrument,
                                const Configuration& configuration,
-                               runtime::Service& executor) noexcept
+                               runtime::Service& executor,
+                               TickScheduler& tick_scheduler) noexcept
     : mux_(runtime::Mux::create_chained_mux(executor)),
-      implementation_(
-          std::make_unique<Implementation>(instrument, configuration)) {}
+      implementation_(std::make_unique<Implementation>(
+          instrument, configuration, tick_scheduler)) {}
 
 MatchingEngine::~MatchingEngine() noexcept = default;
 
 auto MatchingEngine::execute(protocol::OrderPlacementRequest request) -> void {
   log::trace("dispatching order placement request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
-    implementation_->dispatch_order_cmd(std::move(request));
-  });
+  runtime::execute(mux_,
+                   [this,
+                    request = std::move(request),
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_order_cmd(std::move(request),
+                                                         enqueued_at);
+                   });
 
   log::trace("order placement request dispatched");
 }
@@ -32,9 +37,13 @@ auto MatchingEngine::execute(protocol::OrderModificationRequest request)
     -> void {
   log::trace("dispatching order amendment request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
-    implementation_->dispatch_order_cmd(std::move(request));
-  });
+  runtime::execute(mux_,
+                   [this,
+                    request = std::move(request),
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_order_cmd(std::move(request),
+                                                         enqueued_at);
+                   });
 
   log::trace("order amendment command dispatched");
 }
@@ -43,19 +52,56 @@ auto MatchingEngine::execute(protocol::OrderCancellationRequest request)
     -> void {
   log::trace("dispatching order cancellation request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
-    implementation_->dispatch_order_cmd(std::move(request));
-  });
+  runtime::execute(mux_,
+                   [this,
+                    request = std::move(request),
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_order_cmd(std::move(request),
+                                                         enqueued_at);
+                   });
 
   log::trace("order cancellation command dispatched");
 }
 
+auto MatchingEngine::execute(protocol::OrderMassCancellationRequest request)
+    -> void {
+  log::trace("dispatching order mass cancellation request");
+
+  runtime::execute(mux_,
+                   [this,
+                    request = std::move(request),
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_order_cmd(std::move(request),
+                                                         enqueued_at);
+                   });
+
+  log::trace("order mass cancellation command dispatched");
+}
+
+auto MatchingEngine::execute(protocol::MassQuoteRequest request) -> void {
+  log::trace("dispatching mass quote request");
+
+  runtime::execute(mux_,
+                   [this,
+                    request = std::move(request),
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_order_cmd(std::move(request),
+                                                         enqueued_at);
+                   });
+
+  log::trace("mass quote command dispatched");
+}
+
 auto MatchingEngine::execute(protocol::MarketDataRequest request) -> void {
   log::trace("dispatching market data request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
-    implementation_->dispatch_mdata_cmd(std::move(request));
-  });
+  runtime::execute(mux_,
+                   [this,
+                    request = std::move(request),
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_mdata_cmd(std::move(request),
+                                                         enqueued_at);
+                   });
 
   log::trace("market data request dispatched");
 }
@@ -63,9 +109,13 @@ auto MatchingEngine::execute(protocol::MarketDataRequest request) -> void {
 auto MatchingEngine::execute(protocol::SecurityStatusRequest request) -> void {
   log::trace("dispatching security status request");
 
-  runtime::execute(mux_, [this, request = std::move(request)]() mutable {
-    implementation_->dispatch_order_cmd(std::move(request));
-  });
+  runtime::execute(mux_,
+                   [this,
+                    request = std::move(request),
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_order_cmd(std::move(request),
+                                                         enqueued_at);
+                   });
 
   log::trace("security status request dispatched");
 }
@@ -75,10 +125,15 @@ auto MatchingEngine::provide_state(protocol::InstrumentState& reply) -> void {
 
   std::promise<void> promise;
 
-  runtime::execute(mux_, [this, &reply, &promise]() mutable {
-    implementation_->dispatch_instrument_state_capture_cmd(reply);
-    promise.set_value();
-  });
+  runtime::execute(mux_,
+                   [this,
+                    &reply,
+                    &promise,
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_instrument_state_capture_cmd(
+                         reply, enqueued_at);
+                     promise.set_value();
+                   });
 
   promise.get_future().wait();
 
@@ -90,10 +145,15 @@ auto MatchingEngine::store_state(market_state::InstrumentState& state) -> void {
 
   std::latch state_stored{1};
 
-  runtime::execute(mux_, [this, &state, &state_stored]() mutable {
-    implementation_->dispatch_store_state_cmd(state);
-    state_stored.count_down();
-  });
+  runtime::execute(mux_,
+                   [this,
+                    &state,
+                    &state_stored,
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_store_state_cmd(state,
+                                                               enqueued_at);
+                     state_stored.count_down();
+                   });
 
   state_stored.wait();
 
@@ -106,11 +166,15 @@ auto MatchingEngine::recover_state(market_state::InstrumentState state)
 
   std::latch state_recovered{1};
 
-  runtime::execute(
-      mux_, [this, state = std::move(state), &state_recovered]() mutable {
-        implementation_->dispatch_recover_state_cmd(std::move(state));
-        state_recovered.count_down();
-      });
+  runtime::execute(mux_,
+                   [this,
+                    state = std::move(state),
+                    &state_recovered,
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_recover_state_cmd(
+                         std::move(state), enqueued_at);
+                     state_recovered.count_down();
+                   });
 
   state_recovered.wait();
 
@@ -121,9 +185,11 @@ auto MatchingEngine::handle(const protocol::SessionTerminatedEvent& event)
     -> void {
   log::trace("dispatching client disconnected notification");
 
-  runtime::execute(mux_, [this, event] {
-    implementation_->dispatch_client_disconnected_cmd(event.session);
-  });
+  runtime::execute(
+      mux_, [this, event, enqueued_at = CommandLatencyRecorder::now()] {
+        implementation_->dispatch_client_disconnected_cmd(event.session,
+                                                          enqueued_at);
+      });
 
   log::debug("client disconnection notification dispatched: {}", event.session);
 }
@@ -131,9 +197,11 @@ auto MatchingEngine::handle(const protocol::SessionTerminatedEvent& event)
 auto MatchingEngine::handle(event::Tick tick) -> void {
   log::trace("dispatching tick event");
 
-  runtime::execute(mux_, [this, tick]() mutable {
-    implementation_->dispatch_tick_cmd(std::move(tick));
-  });
+  runtime::execute(
+      mux_,
+      [this, tick, enqueued_at = CommandLatencyRecorder::now()]() mutable {
+        implementation_->dispatch_tick_cmd(std::move(tick), enqueued_at);
+      });
 
   log::trace("tick event dispatched");
 }
@@ -141,11 +209,33 @@ auto MatchingEngine::handle(event::Tick tick) -> void {
 auto MatchingEngine::handle(event::PhaseTransition phase_transition) -> void {
   log::trace("dispatching phase transition event");
 
-  runtime::execute(mux_, [this, phase_transition]() mutable {
-    implementation_->dispatch_phase_transition_cmd(std::move(phase_transition));
-  });
+  runtime::execute(mux_,
+                   [this,
+                    phase_transition,
+                    enqueued_at = CommandLatencyRecorder::now()]() mutable {
+                     implementation_->dispatch_phase_transition_cmd(
+                         std::move(phase_transition), enqueued_at);
+                   });
 
   log::trace("phase transition event dispatched");
 }
 
+auto MatchingEngine::replay_at(core::sys_us journaled_at) -> void {
+  // Switched in order with the commands queued before and after
+  runtime::execute(mux_, [this, journaled_at] {
+    implementation_->start_replay(journaled_at);
+  });
+}
+
+auto MatchingEngine::finish_replay() -> void {
+  runtime::execute(mux_, [this] { implementation_->finish_replay(); });
+}
+
+auto MatchingEngine::provide_latency(protocol::EngineLatency& latency)
+    -> void {
+  // Histograms are safe to read while commands are executed,
+  // the request is not queued behind pending commands
+  implementation_->provide_latency(latency);
+}
+
 }  // namespace simulator::trading_system::matching_engine
@@ -0,0 +1,134 @@
+#include "ih/orders/actions/auction_order_action_processor.hpp"
+
+#include <functional>
+
+#include "ih/orders/actions/cancellation.hpp"
+#include "ih/orders/actions/limit_order_recover.hpp"
+#include "ih/orders/actions/regular_amendment.hpp"
+#include "ih/orders/actions/regular_placement.hpp"
+#include "ih/orders/actions/stop_order_recover.hpp"
+#include "ih/orders/matchers/order_matcher.hpp"
+#include "ih/orders/replies/placement_reply_builders.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+namespace {
+
+// Leaves orders in the book untraded during an auction phase
+class AccumulatingMatcher : public RegularMatcher {
+ public:
+  auto match(LimitOrder& /*taker*/) -> void override {}
+
+  auto match(MarketOrder& /*taker*/) -> void override {}
+
+  auto has_facing_orders(const LimitOrder& /*taker*/) -> bool override {
+    return false;
+  }
+
+  auto has_facing_orders(const MarketOrder& /*taker*/) -> bool override {
+    return false;
+  }
+
+  auto can_fully_trade(const LimitOrder& /*taker*/) -> bool override {
+    return false;
+  }
+};
+
+}  // namespace
+
+AuctionOrderActionProcessor::AuctionOrderActionProcessor(
+    EventListener& event_listener, OrderBook& order_book)
+    : EventReporter(event_listener), order_book_(order_book) {}
+
+auto AuctionOrderActionProcessor::place_limit_order(LimitOrder order)
+    -> void {
+  const auto time_in_force = order.time_in_force();
+  if (time_in_force == TimeInForce::Option::ImmediateOrCancel ||
+      time_in_force == TimeInForce::Option::FillOrKill) {
+    emit(ClientNotification(
+        prepare_placement_reject(order)
+            .with_reason(RejectText{
+                "immediate orders cannot be placed during an auction phase"})
+            .build()));
+    return;
+  }
+
+  AccumulatingMatcher matcher;
+  RegularPlacement operation(listener(), order_book_, matcher);
+
+  log::debug(
+      "auction order action processor is executing limit order placement "
+      "operation");
+
+  std::invoke(operation, std::move(order));
+}
+
+auto AuctionOrderActionProcessor::place_market_order(MarketOrder order)
+    -> void {
+  emit(ClientNotification(
+      prepare_placement_reject(order)
+          .with_reason(RejectText{
+              "market orders cannot be placed during an auction phase"})
+          .build()));
+}
+
+auto AuctionOrderActionProcessor::place_stop_order(StopOrder order) -> void {
+  AccumulatingMatcher matcher;
+  RegularPlacement operation(listener(), order_book_, matcher);
+
+  log::debug(
+      "auction order action processor is executing stop order placement "
+      "operation");
+
+  std::invoke(operation, std::move(order));
+}
+
+auto AuctionOrderActionProcessor::amend_limit_order(LimitUpdate update)
+    -> void {
+  AccumulatingMatcher matcher;
+  RegularAmendment operation(listener(), order_book_, matcher);
+
+  log::debug(
+      "auction order action processor is executing limit order amendment "
+      "action");
+
+  std::invoke(operation, std::move(update));
+}
+
+auto AuctionOrderActionProcessor::cancel_order(const OrderCancel& cancel)
+    -> void {
+  Cancellation operation(listener(), order_book_);
+
+  log::debug(
+      "auction order action processor is executing order cancellation action");
+
+  std::invoke(operation, cancel);
+}
+
+auto AuctionOrderActionProcessor::recover_order(
+    market_state::LimitOrder order_state) -> void {
+  LimitOrderRecover operation{listener(), order_book_};
+
+  log::debug("auction order action processor is executing order recovering");
+
+  std::invoke(operation, std::move(order_state));
+}
+
+auto AuctionOrderActionProcessor::recover_order(
+    market_state::StopOrder order_state) -> void {
+  StopOrderRecover operation{order_book_};
+
+  log::debug(
+      "auction order action processor is executing stop order recovering");
+
+  std::invoke(operation, std::move(order_state));
+}
+
+auto AuctionOrderActionProcessor::trigger_stop_orders() -> void {
+  // Stop orders are kept untriggered during auctions, they are evaluated
+  // against the last trade price on a transition into unhalted Open
+  log::debug("auction order action processor does not trigger stop orders");
+}
+
+}  // namespace simulator::trading_system::matching_engine
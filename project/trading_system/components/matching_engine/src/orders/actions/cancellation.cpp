@@ -23,9 +23,7 @@ auto Cancellation::cancel_order(const OrderCancel& cancel, OrderPage& page)
     -> void {
   const auto order_it = find_target_limit_order(page, cancel);
   if (order_it == limit_orders_end(page)) {
-    emit(ClientNotification(prepare_cancellation_reject(cancel)
-                                .with_reason(RejectText{"order not found"})
-                                .build()));
+    cancel_stop_order(cancel, page);
     return;
   }
 
@@ -43,4 +41,29 @@ auto Cancellation::cancel_order(const OrderCancel& cancel, OrderPage& page)
           .build()));
 }
 
+auto Cancellation::cancel_stop_order(const OrderCancel& cancel,
+                                     OrderPage& page) -> void {
+  auto& stop_orders = page.stop_orders();
+  const auto order_it = find_target_stop_order(page, cancel);
+  if (order_it == stop_orders.end()) {
+    emit(ClientNotification(prepare_cancellation_reject(cancel)
+                                .with_reason(RejectText{"order not found"})
+                                .build()));
+    return;
+  }
+
+  // Untriggered stop orders are not published in the book
+  auto order = order_it->second;
+  stop_orders.erase(order_it);
+
+  order.cancel();
+
+  emit(ClientNotification(
+      prepare_cancellation_confirmation(order)
+          .with_execution_id(order.make_execution_id())
+          .with_client_order_id(cancel.client_order_id)
+          .with_orig_client_order_id(cancel.orig_client_order_id)
+          .build()));
+}
+
 }  // namespace simulator::trading_system::matching_engine
\ No newline at end of file
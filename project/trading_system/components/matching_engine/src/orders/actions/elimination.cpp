@@ -8,7 +8,8 @@ namespace simulator::trading_system::matching_engine::order {
 
 namespace {
 
-auto get_expire_time(const LimitOrder& order) -> std::optional<core::sys_us> {
+template <typename OrderType>
+auto get_expire_time(const OrderType& order) -> std::optional<core::sys_us> {
   std::optional<core::sys_us> expire_time;
   if (const auto ord_expire_time = order.expire_time()) {
     expire_time = static_cast<core::sys_us>(*ord_expire_time);
@@ -16,7 +17,8 @@ auto get_expire_time(const LimitOrder& order) -> std::optional<core::sys_us> {
   return expire_time;
 }
 
-auto get_expire_date(const LimitOrder& order)
+template <typename OrderType>
+auto get_expire_date(const OrderType& order)
     -> std::optional<core::local_days> {
   std::optional<core::local_days> expire_date;
   if (const auto ord_expire_date = order.expire_date()) {
@@ -25,6 +27,33 @@ auto get_expire_date(const LimitOrder& order)
   return expire_date;
 }
 
+// Untriggered stop orders are not published in the book,
+// so their elimination is reported to the client only
+auto cancel_stop_order(StopOrder& order) -> ClientNotification {
+  order.cancel();
+  return ClientNotification(prepare_cancellation_confirmation(order)
+                                .with_execution_id(order.make_execution_id())
+                                .with_client_order_id(order.client_order_id())
+                                .build());
+}
+
+template <typename OrderType>
+auto get_expiry_deadline(const OrderType& order) -> TickDeadline {
+  const auto time_in_force = order.time_in_force();
+  if (time_in_force == TimeInForce::Option::Day) {
+    return TickDeadline{.new_day = true};
+  }
+  if (time_in_force == TimeInForce::Option::GoodTillDate) {
+    if (const auto expire_time = get_expire_time(order)) {
+      return TickDeadline{.time = expire_time};
+    }
+    if (get_expire_date(order).has_value()) {
+      return TickDeadline{.new_day = true};
+    }
+  }
+  return TickDeadline{};
+}
+
 }  // namespace
 
 SystemElimination::SystemElimination(EventListener& event_listener,
@@ -38,9 +67,11 @@ SystemElimination::SystemElimination(EventListener& event_listener,
 auto SystemElimination::operator()(OrderBook& book) const -> void {
   log::trace("eliminating buy orders");
   eliminate_expired(book.buy_page().limit_orders());
+  eliminate_expired(book.buy_page().stop_orders());
 
   log::trace("eliminating sell orders");
   eliminate_expired(book.sell_page().limit_orders());
+  eliminate_expired(book.sell_page().stop_orders());
 
   log::trace("finished checking for orders eliminated");
 }
@@ -57,7 +88,20 @@ auto SystemElimination::eliminate_expired(LimitOrdersContainer& orders) const
   }
 }
 
-auto SystemElimination::is_expired(const LimitOrder& order) const -> bool {
+auto SystemElimination::eliminate_expired(StopOrdersContainer& orders) const
+    -> void {
+  for (auto iter = orders.begin(); iter != orders.end();) {
+    if (is_expired(iter->second)) {
+      eliminate(iter->second);
+      iter = orders.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+template <typename OrderType>
+auto SystemElimination::is_expired(const OrderType& order) const -> bool {
   const auto time_in_force = order.time_in_force();
   bool expired = false;
   if (time_in_force == TimeInForce::Option::Day) {
@@ -86,15 +130,36 @@ auto SystemElimination::eliminate(LimitOrder& order) const -> void {
   log::debug("cancelled eliminated order {}", order);
 }
 
+auto SystemElimination::eliminate(StopOrder& order) const -> void {
+  log::trace("eliminating expired stop order: {}", order);
+  emit(cancel_stop_order(order));
+  log::debug("cancelled eliminated stop order {}", order);
+}
+
+auto find_expiry_deadline(OrderBook& book) -> std::optional<TickDeadline> {
+  TickDeadline deadline;
+  for (auto* page : {&book.buy_page(), &book.sell_page()}) {
+    for (const auto& order : page->limit_orders()) {
+      deadline.merge(get_expiry_deadline(order));
+    }
+    for (const auto& [_, order] : page->stop_orders()) {
+      deadline.merge(get_expiry_deadline(order));
+    }
+  }
+  return deadline.empty() ? std::nullopt : std::make_optional(deadline);
+}
+
 AllOrdersElimination::AllOrdersElimination(EventListener& event_listener)
     : EventReporter{event_listener} {}
 
 auto AllOrdersElimination::operator()(OrderBook& book) const -> void {
   log::trace("eliminating all buy orders");
   eliminate(book.buy_page().limit_orders());
+  eliminate(book.buy_page().stop_orders());
 
   log::trace("eliminating all sell orders");
   eliminate(book.sell_page().limit_orders());
+  eliminate(book.sell_page().stop_orders());
 
   log::trace("finished eliminating all orders");
 }
@@ -107,6 +172,14 @@ auto AllOrdersElimination::eliminate(LimitOrdersContainer& orders) const
   }
 }
 
+auto AllOrdersElimination::eliminate(StopOrdersContainer& orders) -> void {
+  for (auto iter = orders.begin(); iter != orders.end();) {
+    log::trace("eliminating stop order: {}", iter->second);
+    iter->second.cancel();
+    iter = orders.erase(iter);
+  }
+}
+
 auto AllOrdersElimination::eliminate(LimitOrder& order) const -> void {
   log::trace("eliminating order: {}", order);
   order.cancel();
@@ -123,9 +196,11 @@ ClosedPhaseElimination::ClosedPhaseElimination(EventListener& event_listener,
 auto ClosedPhaseElimination::operator()(OrderBook& book) const -> void {
   log::trace("eliminating buy orders");
   eliminate_expired(book.buy_page().limit_orders());
+  eliminate_expired(book.buy_page().stop_orders());
 
   log::trace("eliminating sell orders");
   eliminate_expired(book.sell_page().limit_orders());
+  eliminate_expired(book.sell_page().stop_orders());
 
   log::trace("finished checking for orders eliminated");
 }
@@ -142,7 +217,21 @@ auto ClosedPhaseElimination::eliminate_expired(
   }
 }
 
-auto ClosedPhaseElimination::is_expired(const LimitOrder& order) const -> bool {
+auto ClosedPhaseElimination::eliminate_expired(
+    StopOrdersContainer& orders) const -> void {
+  for (auto iter = orders.begin(); iter != orders.end();) {
+    if (is_expired(iter->second)) {
+      eliminate(iter->second);
+      iter = orders.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+template <typename OrderType>
+auto ClosedPhaseElimination::is_expired(const OrderType& order) const
+    -> bool {
   const auto time_in_force = order.time_in_force();
   bool expired = false;
 
@@ -170,6 +259,12 @@ auto ClosedPhaseElimination::eliminate(LimitOrder& order) const -> void {
   log::debug("eliminated the order {} due to client disconnect", order.id());
 }
 
+auto ClosedPhaseElimination::eliminate(StopOrder& order) const -> void {
+  log::trace("eliminating expired stop order: {}", order);
+  emit(cancel_stop_order(order));
+  log::debug("eliminated the stop order {}", order.id());
+}
+
 OnDisconnectElimination::OnDisconnectElimination(
     EventListener& event_listener,
     const protocol::Session& disconnected_session)
@@ -179,9 +274,11 @@ OnDisconnectElimination::OnDisconnectElimination(
 auto OnDisconnectElimination::operator()(OrderBook& book) const -> void {
   log::trace("eliminating buy orders due to user disconnect");
   handle_eliminated_orders(book.buy_page().limit_orders());
+  handle_eliminated_orders(book.buy_page().stop_orders());
 
   log::trace("eliminating sell orders due to user disconnect");
   handle_eliminated_orders(book.sell_page().limit_orders());
+  handle_eliminated_orders(book.sell_page().stop_orders());
 
   log::trace("finished checking for orders eliminated due to user disconnect");
 }
@@ -198,8 +295,21 @@ auto OnDisconnectElimination::handle_eliminated_orders(
   }
 }
 
+auto OnDisconnectElimination::handle_eliminated_orders(
+    StopOrdersContainer& orders) const -> void {
+  for (auto iter = orders.begin(); iter != orders.end();) {
+    if (should_be_eliminated(iter->second)) {
+      eliminate(iter->second);
+      iter = orders.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+template <typename OrderType>
 auto OnDisconnectElimination::should_be_eliminated(
-    const LimitOrder& order) const -> bool {
+    const OrderType& order) const -> bool {
   return order.time_in_force() == TimeInForce::Option::Day &&
          order.client_session() == *disconnected_session_;
 }
@@ -216,4 +326,11 @@ auto OnDisconnectElimination::eliminate(LimitOrder& order) const -> void {
   log::debug("eliminated the order {} due to client disconnect", order.id());
 }
 
-}  // namespace simulator::trading_system::matching_engine::order
\ No newline at end of file
+auto OnDisconnectElimination::eliminate(StopOrder& order) const -> void {
+  log::trace("client disconnected, eliminating stop order: {}", order);
+  emit(cancel_stop_order(order));
+  log::debug("eliminated the stop order {} due to client disconnect",
+             order.id());
+}
+
+}  // namespace simulator::trading_system::matching_engine::order
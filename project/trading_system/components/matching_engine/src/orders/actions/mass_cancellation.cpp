@@ -0,0 +1,132 @@
+#include "ih/orders/actions/mass_cancellation.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "ih/orders/replies/cancellation_reply_builders.hpp"
+#include "ih/orders/tools/notification_creators.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::trading_system::matching_engine::order {
+
+MassCancellation::MassCancellation(
+    EventListener& event_listener,
+    const protocol::OrderMassCancellationRequest& request)
+    : EventReporter(event_listener),
+      session_(&request.session),
+      parties_(&request.parties),
+      side_(request.side),
+      cancel_stop_orders_(true),
+      quotes_only_(false) {}
+
+MassCancellation::MassCancellation(EventListener& event_listener,
+                                   const protocol::MassQuoteRequest& request)
+    : EventReporter(event_listener),
+      session_(&request.session),
+      parties_(&request.parties),
+      cancel_stop_orders_(false),
+      quotes_only_(true) {}
+
+auto MassCancellation::operator()(OrderBook& book) const -> std::size_t {
+  std::size_t cancelled = 0;
+
+  if (!side_.has_value() || *side_ == Side::Option::Buy) {
+    log::trace("mass cancelling buy orders");
+    cancelled += cancel(book.buy_page().limit_orders());
+    if (cancel_stop_orders_) {
+      cancelled += cancel(book.buy_page().stop_orders());
+    }
+  }
+
+  if (!side_.has_value() || *side_ != Side::Option::Buy) {
+    log::trace("mass cancelling sell orders");
+    cancelled += cancel(book.sell_page().limit_orders());
+    if (cancel_stop_orders_) {
+      cancelled += cancel(book.sell_page().stop_orders());
+    }
+  }
+
+  log::trace("finished mass cancelling {} orders", cancelled);
+  return cancelled;
+}
+
+auto MassCancellation::cancel(LimitOrdersContainer& orders) const
+    -> std::size_t {
+  // Kept orders are moved towards the beginning, preserving their priority,
+  // and the cancelled tail is erased at once
+  auto kept = orders.begin();
+  for (auto iter = orders.begin(); iter != orders.end(); ++iter) {
+    if (should_be_cancelled(*iter)) {
+      cancel(*iter);
+      continue;
+    }
+    if (kept != iter) {
+      *kept = std::move(*iter);
+    }
+    ++kept;
+  }
+
+  const auto cancelled =
+      static_cast<std::size_t>(std::distance(kept, orders.end()));
+  orders.erase(kept, orders.end());
+  return cancelled;
+}
+
+auto MassCancellation::cancel(StopOrdersContainer& orders) const
+    -> std::size_t {
+  std::size_t cancelled = 0;
+  for (auto iter = orders.begin(); iter != orders.end();) {
+    if (should_be_cancelled(iter->second)) {
+      cancel(iter->second);
+      iter = orders.erase(iter);
+      cancelled++;
+    } else {
+      ++iter;
+    }
+  }
+  return cancelled;
+}
+
+template <typename OrderType>
+auto MassCancellation::should_be_cancelled(const OrderType& order) const
+    -> bool {
+  if (order.client_session() != *session_) {
+    return false;
+  }
+  if (quotes_only_) {
+    return order.attributes().quote();
+  }
+  if (parties_->empty()) {
+    return true;
+  }
+
+  const auto& order_parties = order.attributes().order_parties();
+  return std::ranges::any_of(order_parties, [this](const Party& party) {
+    return std::ranges::find(*parties_, party) != parties_->end();
+  });
+}
+
+auto MassCancellation::cancel(LimitOrder& order) const -> void {
+  log::trace("mass cancelling order: {}", order);
+  order.cancel();
+  emit(make_making_order_removed_from_book_notification(order));
+  emit(ClientNotification(prepare_cancellation_confirmation(order)
+                              .with_execution_id(order.make_execution_id())
+                              .with_client_order_id(order.client_order_id())
+                              .build()));
+  log::debug("mass cancelled the order {}", order.id());
+}
+
+// Untriggered stop orders are not published in the book,
+// so their cancellation is reported to the client only
+auto MassCancellation::cancel(StopOrder& order) const -> void {
+  log::trace("mass cancelling stop order: {}", order);
+  order.cancel();
+  emit(ClientNotification(prepare_cancellation_confirmation(order)
+                              .with_execution_id(order.make_execution_id())
+                              .with_client_order_id(order.client_order_id())
+                              .build()));
+  log::debug("mass cancelled the stop order {}", order.id());
+}
+
+}  // namespace simulator::trading_system::matching_engine::order
@@ -65,7 +65,7 @@ auto RegularAmendment::amend_order(LimitUpdate update, OrderPage &page)
 
   matcher_.match(order);
 
-  if (!order.executed()) {
+  if (order.tradable()) {
     page.limit_orders().emplace(order);
     emit(order::make_making_order_added_to_book_notification(order));
   }
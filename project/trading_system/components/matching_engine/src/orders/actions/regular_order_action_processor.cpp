@@ -6,18 +6,23 @@
 #include "ih/orders/actions/limit_order_recover.hpp"
 #include "ih/orders/actions/regular_amendment.hpp"
 #include "ih/orders/actions/regular_placement.hpp"
+#include "ih/orders/actions/stop_order_recover.hpp"
+#include "ih/orders/actions/stop_order_trigger.hpp"
 #include "ih/orders/book/limit_order.hpp"
-#include "ih/orders/matchers/regular_order_matcher.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
 RegularOrderActionProcessor::RegularOrderActionProcessor(
-    EventListener& event_listener, OrderBook& order_book)
-    : event_listener_(event_listener), order_book_(order_book) {}
+    EventListener& event_listener,
+    OrderBook& order_book,
+    SelfTradePrevention self_trade_prevention)
+    : event_listener_(event_listener),
+      order_book_(order_book),
+      self_trade_prevention_(self_trade_prevention) {}
 
 auto RegularOrderActionProcessor::place_limit_order(LimitOrder order) -> void {
-  RegularOrderMatcher matcher(event_listener_, order_book_);
+  auto matcher = make_matcher();
   RegularPlacement operation(event_listener_, order_book_, matcher);
 
   log::debug(
@@ -25,11 +30,12 @@ auto RegularOrderActionProcessor::place_limit_order(LimitOrder order) -> void {
       "operation");
 
   std::invoke(operation, std::move(order));
+  trigger_stop_orders();
 }
 
 auto RegularOrderActionProcessor::place_market_order(MarketOrder order)
     -> void {
-  RegularOrderMatcher matcher(event_listener_, order_book_);
+  auto matcher = make_matcher();
   RegularPlacement operation(event_listener_, order_book_, matcher);
 
   log::debug(
@@ -37,11 +43,25 @@ auto RegularOrderActionProcessor::place_market_order(MarketOrder order)
       "operation");
 
   std::invoke(operation, std::move(order));
+  trigger_stop_orders();
+}
+
+auto RegularOrderActionProcessor::place_stop_order(StopOrder order) -> void {
+  auto matcher = make_matcher();
+  RegularPlacement operation(event_listener_, order_book_, matcher);
+
+  log::debug(
+      "regular order action processor is executing stop order placement "
+      "operation");
+
+  std::invoke(operation, std::move(order));
+  // A stop order may be triggered by the last trade price at once
+  trigger_stop_orders();
 }
 
 auto RegularOrderActionProcessor::amend_limit_order(LimitUpdate update)
     -> void {
-  RegularOrderMatcher matcher(event_listener_, order_book_);
+  auto matcher = make_matcher();
   RegularAmendment operation(event_listener_, order_book_, matcher);
 
   log::debug(
@@ -49,6 +69,7 @@ auto RegularOrderActionProcessor::amend_limit_order(LimitUpdate update)
       "action");
 
   std::invoke(operation, std::move(update));
+  trigger_stop_orders();
 }
 
 auto RegularOrderActionProcessor::cancel_order(const OrderCancel& cancel)
@@ -70,4 +91,30 @@ auto RegularOrderActionProcessor::recover_order(
   std::invoke(operation, std::move(order_state));
 }
 
+auto RegularOrderActionProcessor::recover_order(
+    market_state::StopOrder order_state) -> void {
+  StopOrderRecover operation{order_book_};
+
+  log::debug(
+      "regular order action processor is executing stop order recovering");
+
+  std::invoke(operation, std::move(order_state));
+}
+
+auto RegularOrderActionProcessor::trigger_stop_orders() -> void {
+  auto matcher = make_matcher();
+  StopOrderTrigger operation(event_listener_, order_book_, matcher);
+
+  log::debug(
+      "regular order action processor is executing stop orders triggering");
+
+  std::invoke(operation);
+}
+
+auto RegularOrderActionProcessor::make_matcher() const
+    -> RegularOrderMatcher {
+  return RegularOrderMatcher{
+      event_listener_, order_book_, self_trade_prevention_};
+}
+
 }  // namespace simulator::trading_system::matching_engine
\ No newline at end of file
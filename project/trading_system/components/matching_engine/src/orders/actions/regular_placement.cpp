@@ -42,6 +42,16 @@ auto RegularPlacement::operator()(MarketOrder order) -> void {
   matcher_.match(order);
 }
 
+auto RegularPlacement::operator()(StopOrder order) -> void {
+  log::debug("placing stop order {}", order);
+
+  emit(ClientNotification(prepare_placement_confirmation(order)
+                              .with_execution_id(order.make_execution_id())
+                              .build()));
+
+  order_book_.take_page(order.side()).stop_orders().emplace(order);
+}
+
 auto RegularPlacement::place_order(LimitOrder order) -> void {
   log::debug("placing limit order {}", order);
 
@@ -51,7 +61,7 @@ auto RegularPlacement::place_order(LimitOrder order) -> void {
 
   matcher_.match(order);
 
-  if (!order.executed()) {
+  if (order.tradable()) {
     order_book_.take_page(order.side()).limit_orders().emplace(order);
     emit(order::make_making_order_added_to_book_notification(order));
   }
@@ -0,0 +1,38 @@
+#include "ih/orders/actions/stop_order_recover.hpp"
+
+#include <utility>
+
+#include "ih/orders/tools/order_book_state_converter.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+namespace {
+
+auto convert_order(market_state::StopOrder&& order_state) -> StopOrder {
+  OrderRecord record{order_state.order_id,
+                     order_state.side,
+                     recover_session(std::move(order_state.client_session)),
+                     std::move(order_state.client_instrument_descriptor),
+                     recover_order_attributes(order_state)};
+  record.set_order_time(order_state.order_time);
+  record.set_order_status(order_state.order_status);
+
+  return StopOrder{order_state.stop_price,
+                   order_state.order_price,
+                   order_state.total_quantity,
+                   std::move(record)};
+}
+
+}  // namespace
+
+StopOrderRecover::StopOrderRecover(OrderBook& order_book)
+    : order_book_{order_book} {}
+
+auto StopOrderRecover::operator()(market_state::StopOrder order_state)
+    -> void {
+  auto order = convert_order(std::move(order_state));
+  const auto side = order.side();
+  order_book_.take_page(side).stop_orders().emplace(order);
+}
+
+}  // namespace simulator::trading_system::matching_engine
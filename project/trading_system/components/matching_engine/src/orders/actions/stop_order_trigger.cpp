@@ -0,0 +1,93 @@
+#include "ih/orders/actions/stop_order_trigger.hpp"
+
+#include <iterator>
+#include <variant>
+#include <vector>
+
+#include "ih/orders/replies/cancellation_reply_builders.hpp"
+#include "ih/orders/tools/notification_creators.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+StopOrderTrigger::StopOrderTrigger(EventListener& event_listener,
+                                   OrderBook& order_book,
+                                   RegularMatcher& matcher)
+    : EventReporter(event_listener),
+      order_book_(order_book),
+      matcher_(matcher) {}
+
+auto StopOrderTrigger::operator()() -> void {
+  while (const auto trade_price = order_book_.last_trade_price()) {
+    auto& buy_orders = order_book_.buy_page().stop_orders();
+    auto& sell_orders = order_book_.sell_page().stop_orders();
+    if (!buy_orders.has_triggered(*trade_price) &&
+        !sell_orders.has_triggered(*trade_price)) {
+      return;
+    }
+
+    auto triggered = buy_orders.take_triggered(*trade_price);
+    auto triggered_sells = sell_orders.take_triggered(*trade_price);
+    triggered.insert(triggered.end(),
+                     std::make_move_iterator(triggered_sells.begin()),
+                     std::make_move_iterator(triggered_sells.end()));
+
+    for (auto& order : triggered) {
+      release(std::move(order));
+    }
+  }
+}
+
+auto StopOrderTrigger::release(StopOrder order) -> void {
+  log::debug("releasing triggered stop order {}", order);
+
+  std::visit([this](auto released) { place(std::move(released)); },
+             std::move(order).release());
+}
+
+auto StopOrderTrigger::place(LimitOrder order) -> void {
+  const auto time_in_force = order.time_in_force();
+  if (time_in_force == TimeInForce::Option::ImmediateOrCancel ||
+      time_in_force == TimeInForce::Option::FillOrKill) {
+    const bool tradable =
+        matcher_.has_facing_orders(order) &&
+        (time_in_force != TimeInForce::Option::FillOrKill ||
+         matcher_.can_fully_trade(order));
+    if (!tradable) {
+      cancel(order);
+      return;
+    }
+
+    matcher_.match(order);
+    return;
+  }
+
+  matcher_.match(order);
+
+  if (order.tradable()) {
+    order_book_.take_page(order.side()).limit_orders().emplace(order);
+    emit(order::make_making_order_added_to_book_notification(order));
+  }
+}
+
+auto StopOrderTrigger::place(MarketOrder order) -> void {
+  if (!matcher_.has_facing_orders(order)) {
+    cancel(order);
+    return;
+  }
+
+  matcher_.match(order);
+}
+
+template <typename OrderType>
+auto StopOrderTrigger::cancel(OrderType& order) -> void {
+  log::debug("released order cannot be traded, cancelling it: {}", order);
+
+  order.cancel();
+  emit(ClientNotification(prepare_cancellation_confirmation(order)
+                              .with_execution_id(order.make_execution_id())
+                              .with_client_order_id(order.client_order_id())
+                              .build()));
+}
+
+}  // namespace simulator::trading_system::matching_engine
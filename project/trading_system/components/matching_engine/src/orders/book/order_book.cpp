@@ -111,12 +111,105 @@ auto LimitOrdersContainer::erase(iterator begin, iterator end) -> void {
   orders_.erase(begin, end);
 }
 
-OrderPage::OrderPage(Side side) : limit_orders_(side) {}
+auto LimitOrdersContainer::requeue(iterator iter) -> iterator {
+  if (iter < begin() || iter >= end()) [[unlikely]] {
+    throw std::invalid_argument(
+        "failed to requeue limit order, bad order iterator passed");
+  }
+
+  log::debug("requeueing order on the limit side: {}", *iter);
+
+  // Orders behind the requeued one are either newer or have worse prices
+  const auto level_end =
+      std::find_if(std::next(iter), end(), [&](const LimitOrder& order) {
+        return order_cmp_.is_better(*iter, order);
+      });
+  std::rotate(iter, std::next(iter), level_end);
+  return std::prev(level_end);
+}
+
+EarlierTriggerComparator::EarlierTriggerComparator(Side side) : side_(side) {
+  if (side_ != Side::Option::Buy && side_ != Side::Option::Sell) [[unlikely]] {
+    throw std::invalid_argument(
+        fmt::format("cannot create earlier trigger comparator "
+                    "for an unknown side value - '0{:x}'",
+                    core::underlying_cast(side_.value())));
+  }
+}
+
+auto EarlierTriggerComparator::operator()(StopPrice left,
+                                          StopPrice right) const -> bool {
+  return side_ == Side::Option::Buy ? left < right : left > right;
+}
+
+StopOrdersContainer::StopOrdersContainer(Side side)
+    : orders_(EarlierTriggerComparator{side}) {}
+
+auto StopOrdersContainer::size() const -> std::size_t {
+  return orders_.size();
+}
+
+auto StopOrdersContainer::empty() const -> bool { return orders_.empty(); }
+
+auto StopOrdersContainer::begin() -> iterator { return orders_.begin(); }
+
+auto StopOrdersContainer::begin() const -> const_iterator {
+  return orders_.begin();
+}
+
+auto StopOrdersContainer::end() -> iterator { return orders_.end(); }
+
+auto StopOrdersContainer::end() const -> const_iterator {
+  return orders_.end();
+}
+
+auto StopOrdersContainer::emplace(const StopOrder& order) -> iterator {
+  log::debug("adding order to the stop side: {}", order);
+
+  return orders_.emplace(order.stop_price(), order);
+}
+
+auto StopOrdersContainer::erase(iterator iter) -> iterator {
+  if (iter == end()) [[unlikely]] {
+    throw std::invalid_argument(
+        "failed to erase stop order, bad order iterator passed");
+  }
+
+  log::debug("erasing order from the stop side: {}", iter->second);
+
+  return orders_.erase(iter);
+}
+
+auto StopOrdersContainer::has_triggered(Price trade_price) const -> bool {
+  return !orders_.empty() && begin()->second.is_triggered_by(trade_price);
+}
+
+auto StopOrdersContainer::take_triggered(Price trade_price)
+    -> std::vector<StopOrder> {
+  std::vector<StopOrder> triggered;
+  auto iter = orders_.begin();
+  for (; iter != orders_.end() && iter->second.is_triggered_by(trade_price);
+       ++iter) {
+    triggered.push_back(iter->second);
+  }
+
+  if (!triggered.empty()) {
+    log::debug("{} stop orders are triggered by a trade at {}",
+               triggered.size(),
+               trade_price);
+    orders_.erase(orders_.begin(), iter);
+  }
+  return triggered;
+}
+
+OrderPage::OrderPage(Side side) : limit_orders_(side), stop_orders_(side) {}
 
 auto OrderPage::limit_orders() -> LimitOrdersContainer& {
   return limit_orders_;
 }
 
+auto OrderPage::stop_orders() -> StopOrdersContainer& { return stop_orders_; }
+
 auto OrderBook::buy_page() -> OrderPage& { return buy_page_; }
 
 auto OrderBook::sell_page() -> OrderPage& { return sell_page_; }
@@ -136,4 +229,12 @@ auto OrderBook::take_page(const Side side) -> OrderPage& {
       core::underlying_cast(side.value())));
 }
 
+auto OrderBook::last_trade_price() const -> std::optional<Price> {
+  return last_trade_price_;
+}
+
+auto OrderBook::record_trade_price(Price price) -> void {
+  last_trade_price_ = price;
+}
+
 }  // namespace simulator::trading_system::matching_engine
\ No newline at end of file
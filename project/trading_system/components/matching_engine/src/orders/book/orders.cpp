@@ -1,17 +1,21 @@
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <cassert>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
 #include <utility>
 
+#include "core/common/std_formatter.hpp"
+#include "core/tools/numeric.hpp"
 #include "core/tools/time.hpp"
 #include "idgen/execution_id.hpp"
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/market_order.hpp"
 #include "ih/orders/book/order_metadata.hpp"
 #include "ih/orders/book/order_updates.hpp"
+#include "ih/orders/book/stop_order.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
@@ -55,6 +59,10 @@ auto OrderAttributes::order_owner() const -> std::optional<Party> {
   return std::nullopt;
 }
 
+auto OrderAttributes::owner_key() const -> OwnerKey { return owner_key_; }
+
+auto OrderAttributes::quote() const -> bool { return quote_; }
+
 auto OrderAttributes::set_client_order_id(ClientOrderId client_order_id)
     -> void {
   client_order_id_ = std::move(client_order_id);
@@ -79,8 +87,11 @@ auto OrderAttributes::set_short_sale_exemption_reason(
 
 auto OrderAttributes::set_order_parties(std::vector<Party> parties) -> void {
   std::swap(order_parties_, parties);
+  owner_key_ = intern_owner(order_owner());
 }
 
+auto OrderAttributes::set_quote(bool quote) -> void { quote_ = quote; }
+
 // endregion OrderAttributes
 
 // region OrderRecord
@@ -143,7 +154,20 @@ LimitOrder::LimitOrder(OrderPrice price,
     : record_(std::make_shared<OrderRecord>(std::move(record))),
       price_(price),
       total_quantity_(quantity),
-      cum_executed_quantity_(0.0) {}
+      cum_executed_quantity_(0.0),
+      displayed_quantity_(0.0) {}
+
+LimitOrder::LimitOrder(OrderPrice price,
+                       OrderQuantity quantity,
+                       DisplayQuantity display_quantity,
+                       OrderRecord record)
+    : record_(std::make_shared<OrderRecord>(std::move(record))),
+      price_(price),
+      total_quantity_(quantity),
+      cum_executed_quantity_(0.0),
+      display_quantity_(display_quantity),
+      displayed_quantity_(std::min(static_cast<double>(display_quantity),
+                                   static_cast<double>(quantity))) {}
 
 auto LimitOrder::id() const -> OrderId {
   assert(record_);
@@ -160,6 +184,11 @@ auto LimitOrder::owner() const -> std::optional<Party> {
   return record_->attributes().order_owner();
 }
 
+auto LimitOrder::owner_key() const -> OwnerKey {
+  assert(record_);
+  return record_->attributes().owner_key();
+}
+
 auto LimitOrder::side() const -> Side {
   assert(record_);
   return record_->order_side();
@@ -222,6 +251,21 @@ auto LimitOrder::leaves_quantity() const -> LeavesQuantity {
   return LeavesQuantity{std::max(total - executed, 0.0)};
 }
 
+auto LimitOrder::display_quantity() const -> std::optional<DisplayQuantity> {
+  return display_quantity_;
+}
+
+auto LimitOrder::displayed_quantity() const -> LeavesQuantity {
+  return display_quantity_.has_value() ? displayed_quantity_
+                                       : leaves_quantity();
+}
+
+auto LimitOrder::hidden_quantity() const -> LeavesQuantity {
+  const auto leaves = static_cast<double>(leaves_quantity());
+  const auto displayed = static_cast<double>(displayed_quantity());
+  return LeavesQuantity{std::max(leaves - displayed, 0.0)};
+}
+
 auto LimitOrder::time() const -> OrderTime {
   assert(record_);
   return record_->order_time();
@@ -232,6 +276,10 @@ auto LimitOrder::executed() const -> bool {
          static_cast<double>(total_quantity_);
 }
 
+auto LimitOrder::tradable() const -> bool {
+  return !executed() && status() != OrderStatus::Option::Cancelled;
+}
+
 auto LimitOrder::make_execution_id() -> ExecutionId {
   assert(record_);
   return record_->make_execution_id();
@@ -245,6 +293,37 @@ auto LimitOrder::execute(ExecutedQuantity quantity) -> void {
   assert(record_);
   record_->set_order_status(executed() ? OrderStatus::Option::Filled
                                        : OrderStatus::Option::PartiallyFilled);
+
+  if (display_quantity_.has_value()) {
+    const auto displayed = static_cast<double>(displayed_quantity_);
+    displayed_quantity_ =
+        LeavesQuantity{std::max(displayed - curr_executed, 0.0)};
+    if (core::equal(static_cast<double>(displayed_quantity_), 0.0) &&
+        !executed()) {
+      replenish();
+    }
+  }
+}
+
+auto LimitOrder::restore_hidden_quantity(LeavesQuantity quantity,
+                                         OrderTime order_time) -> void {
+  if (!display_quantity_.has_value()) {
+    return;
+  }
+
+  assert(record_);
+  record_->set_order_time(order_time);
+
+  const auto leaves = static_cast<double>(leaves_quantity());
+  const auto hidden = static_cast<double>(quantity);
+  const auto displayed = std::min(std::max(leaves - hidden, 0.0),
+                                  static_cast<double>(*display_quantity_));
+  // An order having leaves quantity always displays a part of it
+  displayed_quantity_ =
+      core::equal(displayed, 0.0)
+          ? LeavesQuantity{std::min(static_cast<double>(*display_quantity_),
+                                    leaves)}
+          : LeavesQuantity{displayed};
 }
 
 auto LimitOrder::amend(Update update) -> void {
@@ -256,6 +335,8 @@ auto LimitOrder::amend(Update update) -> void {
 
   assert(record_);
   record_->set_order_status(OrderStatus::Option::Modified);
+  // A quote stays a quote, so that the next mass quote replaces it
+  update.attributes.set_quote(record_->attributes().quote());
   record_->set_order_attributes(std::move(update.attributes));
   if (update.price != price_ || update.quantity > total_quantity_) {
     record_->set_order_time(OrderTime(core::get_current_system_time()));
@@ -263,6 +344,17 @@ auto LimitOrder::amend(Update update) -> void {
 
   price_ = update.price;
   total_quantity_ = update.quantity;
+  if (display_quantity_.has_value()) {
+    displayed_quantity_ = std::min(displayed_quantity_, leaves_quantity());
+  }
+}
+
+auto LimitOrder::reduce(LeavesQuantity quantity) -> void {
+  const auto total = static_cast<double>(total_quantity_);
+  total_quantity_ = OrderQuantity{total - static_cast<double>(quantity)};
+  if (display_quantity_.has_value()) {
+    displayed_quantity_ = std::min(displayed_quantity_, leaves_quantity());
+  }
 }
 
 auto LimitOrder::cancel() -> void {
@@ -270,6 +362,16 @@ auto LimitOrder::cancel() -> void {
   record_->set_order_status(OrderStatus::Option::Cancelled);
 }
 
+auto LimitOrder::replenish() -> void {
+  assert(display_quantity_.has_value());
+  displayed_quantity_ =
+      LeavesQuantity{std::min(static_cast<double>(*display_quantity_),
+                              static_cast<double>(leaves_quantity()))};
+  // A replenished slice is queued behind the orders at the same price
+  assert(record_);
+  record_->set_order_time(OrderTime(core::get_current_system_time()));
+}
+
 // endregion LimitOrder
 
 LimitUpdate::LimitUpdate(protocol::Session session,
@@ -304,6 +406,11 @@ auto MarketOrder::owner() const -> std::optional<Party> {
   return record_->attributes().order_owner();
 }
 
+auto MarketOrder::owner_key() const -> OwnerKey {
+  assert(record_);
+  return record_->attributes().owner_key();
+}
+
 auto MarketOrder::side() const -> Side {
   assert(record_);
   return record_->order_side();
@@ -369,6 +476,10 @@ auto MarketOrder::executed() const -> bool {
          static_cast<double>(total_quantity_);
 }
 
+auto MarketOrder::tradable() const -> bool {
+  return !executed() && status() != OrderStatus::Option::Cancelled;
+}
+
 auto MarketOrder::execute(ExecutedQuantity quantity) -> void {
   const auto prev_executed = static_cast<double>(cum_executed_quantity_);
   const auto curr_executed = static_cast<double>(quantity);
@@ -379,6 +490,11 @@ auto MarketOrder::execute(ExecutedQuantity quantity) -> void {
                                        : OrderStatus::Option::PartiallyFilled);
 }
 
+auto MarketOrder::reduce(LeavesQuantity quantity) -> void {
+  const auto total = static_cast<double>(total_quantity_);
+  total_quantity_ = OrderQuantity{total - static_cast<double>(quantity)};
+}
+
 auto MarketOrder::cancel() -> void {
   assert(record_);
   record_->set_order_status(OrderStatus::Option::Cancelled);
@@ -391,6 +507,133 @@ auto MarketOrder::make_execution_id() -> ExecutionId {
 
 // endregion MarketOrder
 
+// region StopOrder
+
+StopOrder::StopOrder(StopPrice stop_price,
+                     std::optional<OrderPrice> limit_price,
+                     OrderQuantity quantity,
+                     OrderRecord record)
+    : record_(std::make_shared<OrderRecord>(std::move(record))),
+      stop_price_(stop_price),
+      limit_price_(limit_price),
+      total_quantity_(quantity) {}
+
+auto StopOrder::id() const -> OrderId {
+  assert(record_);
+  return record_->order_id();
+}
+
+auto StopOrder::attributes() const -> const OrderAttributes& {
+  assert(record_);
+  return record_->attributes();
+}
+
+auto StopOrder::owner() const -> std::optional<Party> {
+  assert(record_);
+  return record_->attributes().order_owner();
+}
+
+auto StopOrder::side() const -> Side {
+  assert(record_);
+  return record_->order_side();
+}
+
+auto StopOrder::status() const -> OrderStatus {
+  assert(record_);
+  return record_->order_status();
+}
+
+auto StopOrder::client_session() const -> const protocol::Session& {
+  assert(record_);
+  return record_->client_session();
+}
+
+auto StopOrder::client_order_id() const
+    -> const std::optional<ClientOrderId>& {
+  return attributes().client_order_id();
+}
+
+auto StopOrder::instrument() const -> const InstrumentDescriptor& {
+  assert(record_);
+  return record_->instrument();
+}
+
+auto StopOrder::time_in_force() const -> TimeInForce {
+  assert(record_);
+  return record_->attributes().time_in_force();
+}
+
+auto StopOrder::expire_time() const -> std::optional<ExpireTime> {
+  assert(record_);
+  return record_->attributes().expire_time();
+}
+
+auto StopOrder::expire_date() const -> std::optional<ExpireDate> {
+  assert(record_);
+  return record_->attributes().expire_date();
+}
+
+auto StopOrder::short_sale_exemption_reason() const
+    -> std::optional<ShortSaleExemptionReason> {
+  assert(record_);
+  return record_->attributes().short_sale_exemption_reason();
+}
+
+auto StopOrder::order_type() const -> OrderType {
+  return limit_price_.has_value() ? OrderType::Option::StopLimit
+                                  : OrderType::Option::Stop;
+}
+
+auto StopOrder::stop_price() const -> StopPrice { return stop_price_; }
+
+auto StopOrder::limit_price() const -> std::optional<OrderPrice> {
+  return limit_price_;
+}
+
+auto StopOrder::total_quantity() const -> OrderQuantity {
+  return total_quantity_;
+}
+
+auto StopOrder::time() const -> OrderTime {
+  assert(record_);
+  return record_->order_time();
+}
+
+auto StopOrder::is_triggered_by(Price trade_price) const -> bool {
+  const auto stop_price = static_cast<Price>(stop_price_);
+  return side() == Side::Option::Buy ? trade_price >= stop_price
+                                     : trade_price <= stop_price;
+}
+
+auto StopOrder::make_execution_id() -> ExecutionId {
+  assert(record_);
+  return record_->make_execution_id();
+}
+
+auto StopOrder::cancel() -> void {
+  assert(record_);
+  record_->set_order_status(OrderStatus::Option::Cancelled);
+}
+
+auto StopOrder::release() && -> Released {
+  assert(record_);
+  OrderRecord record = std::move(*record_);
+  record_.reset();
+  record.set_order_time(OrderTime(core::get_current_system_time()));
+
+  if (limit_price_.has_value()) {
+    return LimitOrder{*limit_price_, total_quantity_, std::move(record)};
+  }
+
+  // Market orders are not kept in the book
+  auto attributes = record.attributes();
+  attributes.set_time_in_force(TimeInForce::Option::ImmediateOrCancel);
+  record.set_order_attributes(std::move(attributes));
+  return MarketOrder{total_quantity_, std::move(record)};
+}
+
+// endregion StopOrder
+
 }  // namespace simulator::trading_system::matching_engine
 
 namespace fmt {
@@ -400,13 +643,14 @@ auto formatter<simulator::trading_system::matching_engine::LimitOrder>::format(
     -> decltype(context.out()) {
   return format_to(
       context.out(),
-      R"({{ "LimitOrder": {{ "id":{}, "status":"{}", "side":"{}", "price":{}, "cum_executed_qty":{}, "leaves_qty":{} }} }})",
+      R"({{ "LimitOrder": {{ "id":{}, "status":"{}", "side":"{}", "price":{}, "cum_executed_qty":{}, "leaves_qty":{}, "displayed_qty":{} }} }})",
       order.id(),
       order.status(),
       order.side(),
       order.price(),
       order.cum_executed_quantity(),
-      order.leaves_quantity());
+      order.leaves_quantity(),
+      order.displayed_quantity());
 }
 
 auto formatter<simulator::trading_system::matching_engine::MarketOrder>::format(
@@ -422,4 +666,18 @@ auto formatter<simulator::trading_system::matching_engine::MarketOrder>::format(
       order.leaves_quantity());
 }
 
+auto formatter<simulator::trading_system::matching_engine::StopOrder>::format(
+    const formattable& order, format_context& context) const
+    -> decltype(context.out()) {
+  return format_to(
+      context.out(),
+      R"({{ "StopOrder": {{ "id":{}, "status":"{}", "side":"{}", "stop_price":{}, "limit_price":{}, "total_qty":{} }} }})",
+      order.id(),
+      order.status(),
+      order.side(),
+      order.stop_price(),
+      order.limit_price(),
+      order.total_quantity());
+}
+
 }  // namespace fmt
@@ -0,0 +1,46 @@
+#include "ih/orders/book/owner_key.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace simulator::trading_system::matching_engine {
+
+namespace {
+
+// Engines intern owners of their orders concurrently, an owner is
+// interned once per order, and usually is already known
+class OwnerRegistry {
+ public:
+  auto intern(const std::string& owner) -> OwnerKey {
+    {
+      const std::shared_lock lock{mutex_};
+      if (const auto key_it = keys_.find(owner); key_it != keys_.end()) {
+        return key_it->second;
+      }
+    }
+
+    const std::unique_lock lock{mutex_};
+    const auto next_key = static_cast<std::uint32_t>(keys_.size()) + 1;
+    return keys_.try_emplace(owner, static_cast<OwnerKey>(next_key))
+        .first->second;
+  }
+
+ private:
+  std::unordered_map<std::string, OwnerKey> keys_;
+  std::shared_mutex mutex_;
+};
+
+}  // namespace
+
+auto intern_owner(const std::optional<Party>& owner) -> OwnerKey {
+  if (!owner.has_value()) {
+    return OwnerKey::None;
+  }
+
+  static OwnerRegistry registry;
+  return registry.intern(static_cast<const std::string&>(owner->party_id()));
+}
+
+}  // namespace simulator::trading_system::matching_engine
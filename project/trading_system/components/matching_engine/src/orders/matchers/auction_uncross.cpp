@@ -0,0 +1,222 @@
+#include "ih/orders/matchers/auction_uncross.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "core/domain/party.hpp"
+#include "core/tools/numeric.hpp"
+#include "ih/common/events/client_notification.hpp"
+#include "ih/orders/book/order_algorithms.hpp"
+#include "ih/orders/replies/execution_reply_builders.hpp"
+#include "ih/orders/tools/notification_creators.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+namespace {
+
+struct PriceLevel {
+  double price = 0.0;
+  double quantity = 0.0;
+};
+
+// Orders of a page are sorted by priority, so orders of a level are adjacent
+auto aggregate_levels(const LimitOrdersContainer& orders)
+    -> std::vector<PriceLevel> {
+  std::vector<PriceLevel> levels;
+  for (const auto& order : orders) {
+    const auto price = static_cast<double>(order.price());
+    const auto quantity = static_cast<double>(order.leaves_quantity());
+    if (!levels.empty() && levels.back().price == price) {
+      levels.back().quantity += quantity;
+    } else {
+      levels.push_back({.price = price, .quantity = quantity});
+    }
+  }
+  return levels;
+}
+
+auto is_better(const AuctionEquilibrium& candidate,
+               const AuctionEquilibrium& best,
+               std::optional<Price> reference_price) -> bool {
+  const auto candidate_volume = static_cast<double>(candidate.volume);
+  const auto best_volume = static_cast<double>(best.volume);
+  if (!core::equal(candidate_volume, best_volume)) {
+    return candidate_volume > best_volume;
+  }
+
+  const auto candidate_imbalance = static_cast<double>(candidate.imbalance);
+  const auto best_imbalance = static_cast<double>(best.imbalance);
+  if (!core::equal(candidate_imbalance, best_imbalance)) {
+    return candidate_imbalance < best_imbalance;
+  }
+
+  if (reference_price.has_value()) {
+    const auto reference = static_cast<double>(*reference_price);
+    return std::fabs(static_cast<double>(candidate.price) - reference) <
+           std::fabs(static_cast<double>(best.price) - reference);
+  }
+  return false;
+}
+
+}  // namespace
+
+AuctionUncross::AuctionUncross(EventListener& event_listener,
+                               OrderBook& order_book)
+    : EventReporter(event_listener), order_book_(order_book) {}
+
+auto AuctionUncross::operator()(MarketPhase auction_phase)
+    -> std::optional<AuctionEquilibrium> {
+  auto& buy_orders = order_book_.buy_page().limit_orders();
+  auto& sell_orders = order_book_.sell_page().limit_orders();
+
+  const auto equilibrium = find_equilibrium(
+      buy_orders, sell_orders, order_book_.last_trade_price());
+  if (!equilibrium) {
+    log::debug("auction order book is not crossed, nothing to uncross");
+    return std::nullopt;
+  }
+
+  log::debug("uncrossing auction at {} with {} volume and {} imbalance",
+             equilibrium->price,
+             equilibrium->volume,
+             equilibrium->imbalance);
+
+  // Orders priced at or better than the equilibrium price are executable,
+  // the executable quantity of the smaller side equals the volume
+  const auto price = static_cast<double>(equilibrium->price);
+  const ExecutionPrice trade_price{price};
+  auto buyer = buy_orders.begin();
+  auto seller = sell_orders.begin();
+  while (buyer != buy_orders.end() && seller != sell_orders.end() &&
+         static_cast<double>(buyer->price()) >= price &&
+         static_cast<double>(seller->price()) <= price) {
+    trade(*buyer, *seller, trade_price, auction_phase);
+    if (buyer->executed()) {
+      ++buyer;
+    }
+    if (seller->executed()) {
+      ++seller;
+    }
+  }
+
+  constexpr auto non_filled_order = [](const LimitOrder& order) {
+    return !order.executed();
+  };
+  buy_orders.erase(buy_orders.begin(),
+                   find_limit_order(buy_orders, non_filled_order));
+  sell_orders.erase(sell_orders.begin(),
+                    find_limit_order(sell_orders, non_filled_order));
+  // A partially executed iceberg order may have replenished its displayed
+  // quantity and lost its time priority
+  if (!buy_orders.empty()) {
+    buy_orders.requeue(buy_orders.begin());
+  }
+  if (!sell_orders.empty()) {
+    sell_orders.requeue(sell_orders.begin());
+  }
+
+  order_book_.record_trade_price(equilibrium->price);
+  return equilibrium;
+}
+
+auto AuctionUncross::find_equilibrium(const LimitOrdersContainer& buy_orders,
+                                      const LimitOrdersContainer& sell_orders,
+                                      std::optional<Price> reference_price)
+    -> std::optional<AuctionEquilibrium> {
+  // Buy levels are sorted by descending price, sell levels - by ascending
+  const auto buy_levels = aggregate_levels(buy_orders);
+  const auto sell_levels = aggregate_levels(sell_orders);
+  if (buy_levels.empty() || sell_levels.empty() ||
+      buy_levels.front().price < sell_levels.front().price) {
+    return std::nullopt;
+  }
+
+  const double lowest_price = sell_levels.front().price;
+  const double highest_price = buy_levels.front().price;
+
+  // Candidate prices are visited in ascending order. Demand is a quantity of
+  // buy orders priced at or above a candidate, supply is a quantity of
+  // sell orders priced at or below it.
+  double demand = 0.0;
+  for (const auto& level : buy_levels) {
+    demand += level.quantity;
+  }
+  double supply = 0.0;
+  auto buy_level = buy_levels.rbegin();
+  auto sell_level = sell_levels.begin();
+
+  std::optional<AuctionEquilibrium> best;
+  while (buy_level != buy_levels.rend() || sell_level != sell_levels.end()) {
+    double price = highest_price;
+    if (buy_level != buy_levels.rend()) {
+      price = std::min(price, buy_level->price);
+    }
+    if (sell_level != sell_levels.end()) {
+      price = std::min(price, sell_level->price);
+    }
+
+    while (sell_level != sell_levels.end() && sell_level->price <= price) {
+      supply += sell_level->quantity;
+      ++sell_level;
+    }
+
+    if (price >= lowest_price) {
+      const AuctionEquilibrium candidate{
+          .price = Price{price},
+          .volume = Quantity{std::min(demand, supply)},
+          .imbalance = Quantity{std::fabs(demand - supply)}};
+      if (!best || is_better(candidate, *best, reference_price)) {
+        best = candidate;
+      }
+    }
+    if (price >= highest_price) {
+      break;
+    }
+
+    while (buy_level != buy_levels.rend() && buy_level->price <= price) {
+      demand -= buy_level->quantity;
+      ++buy_level;
+    }
+  }
+  return best;
+}
+
+auto AuctionUncross::trade(LimitOrder& buyer,
+                           LimitOrder& seller,
+                           ExecutionPrice trade_price,
+                           MarketPhase auction_phase) -> void {
+  const ExecutedQuantity trade_qty{static_cast<Quantity>(
+      std::min(buyer.leaves_quantity(), seller.leaves_quantity()))};
+  log::debug("auction trading {}@{}: buyer: {}; seller: {}",
+             trade_qty,
+             trade_price,
+             buyer,
+             seller);
+  buyer.execute(trade_qty);
+  seller.execute(trade_qty);
+
+  emit(ClientNotification(
+      prepare_execution_report(buyer)
+          .with_execution_id(buyer.make_execution_id())
+          .with_execution_price(trade_price)
+          .with_executed_quantity(trade_qty)
+          .with_counterparty(make_counterparty(seller.owner()))
+          .build()));
+
+  emit(ClientNotification(
+      prepare_execution_report(seller)
+          .with_execution_id(seller.make_execution_id())
+          .with_execution_price(trade_price)
+          .with_executed_quantity(trade_qty)
+          .with_counterparty(make_counterparty(buyer.owner()))
+          .build()));
+
+  emit(order::make_making_order_reduced_notification(buyer));
+  emit(order::make_making_order_reduced_notification(seller));
+  emit(order::make_auction_trade_notification(
+      buyer, seller, trade_price, trade_qty, auction_phase));
+}
+
+}  // namespace simulator::trading_system::matching_engine
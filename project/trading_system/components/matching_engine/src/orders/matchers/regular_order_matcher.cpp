@@ -1,39 +1,53 @@
 #include "ih/orders/matchers/regular_order_matcher.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <numeric>
 #include <ranges>
+#include <type_traits>
 
 #include "core/common/unreachable.hpp"
 #include "core/domain/party.hpp"
 #include "ih/common/events/client_notification.hpp"
 #include "ih/orders/book/order_algorithms.hpp"
+#include "ih/orders/replies/cancellation_reply_builders.hpp"
 #include "ih/orders/replies/execution_reply_builders.hpp"
+#include "ih/orders/replies/modification_reply_builders.hpp"
 #include "ih/orders/tools/notification_creators.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::trading_system::matching_engine {
 
-RegularOrderMatcher::RegularOrderMatcher(EventListener& event_listener,
-                                         OrderBook& order_book)
-    : EventReporter(event_listener), order_book_(order_book) {}
+RegularOrderMatcher::RegularOrderMatcher(
+    EventListener& event_listener,
+    OrderBook& order_book,
+    SelfTradePrevention self_trade_prevention)
+    : EventReporter(event_listener),
+      order_book_(order_book),
+      self_trade_prevention_(self_trade_prevention) {}
 
 auto RegularOrderMatcher::match(LimitOrder& taker) -> void {
   log::debug("matching: {}", taker);
 
-  if (taker.time_in_force() == TimeInForce::Option::ImmediateOrCancel) {
-    trade_ioc_taker(taker, find_matching_orders(taker));
-  } else {
-    trade_taker(taker, find_matching_orders(taker));
-  }
+  const auto replenished_makers =
+      taker.time_in_force() == TimeInForce::Option::ImmediateOrCancel
+          ? trade_ioc_taker(taker, find_matching_orders(taker))
+          : trade_taker(taker, find_matching_orders(taker));
 
-  remove_filled_orders(take_opposite_limit_orders(taker.side()));
+  auto& makers_side = take_opposite_limit_orders(taker.side());
+  requeue_replenished_orders(makers_side, replenished_makers);
+  remove_completed_orders(makers_side);
 }
 
 auto RegularOrderMatcher::match(MarketOrder& taker) -> void {
   log::debug("matching: {}", taker);
 
-  trade_market_taker(taker, find_matching_orders(taker));
-  remove_filled_orders(take_opposite_limit_orders(taker.side()));
+  const auto replenished_makers =
+      trade_market_taker(taker, find_matching_orders(taker));
+
+  auto& makers_side = take_opposite_limit_orders(taker.side());
+  requeue_replenished_orders(makers_side, replenished_makers);
+  remove_completed_orders(makers_side);
 }
 
 auto RegularOrderMatcher::has_facing_orders(const LimitOrder& taker) -> bool {
@@ -46,7 +60,20 @@ auto RegularOrderMatcher::has_facing_orders(const MarketOrder& taker) -> bool {
 }
 
 auto RegularOrderMatcher::can_fully_trade(const LimitOrder& taker) -> bool {
-  const auto makers = find_matching_orders(taker);
+  auto makers = find_matching_orders(taker);
+  // The taker trades with no maker behind the first maker of its owner,
+  // unless the resting orders of the owner are cancelled
+  if (const auto owner = self_trade_owner(taker); owner != OwnerKey::None) {
+    const auto is_own = [owner](const LimitOrder* maker) {
+      return maker->owner_key() == owner;
+    };
+    if (self_trade_prevention_ == SelfTradePrevention::CancelOldest) {
+      std::erase_if(makers, is_own);
+    } else {
+      makers.erase(std::ranges::find_if(makers, is_own), makers.end());
+    }
+  }
+
   const LeavesQuantity making_qty = std::accumulate(
       makers.begin(),
       makers.end(),
@@ -86,13 +113,22 @@ auto RegularOrderMatcher::find_matching_orders(const MarketOrder& taker)
 }
 
 auto RegularOrderMatcher::trade_taker(LimitOrder& taker,
-                                      const std::vector<LimitOrder*>& makers)
-    -> void {
-  for (LimitOrder* maker : makers) {
-    if (taker.executed()) {
+                                      std::vector<LimitOrder*> makers)
+    -> std::vector<OrderId> {
+  std::vector<OrderId> replenished_makers;
+  const auto self_trading_owner = self_trade_owner(taker);
+  for (std::size_t maker_idx = 0; maker_idx < makers.size(); ++maker_idx) {
+    if (!taker.tradable()) {
       break;
     }
 
+    LimitOrder* maker = makers[maker_idx];
+    if (self_trading_owner != OwnerKey::None &&
+        maker->owner_key() == self_trading_owner) [[unlikely]] {
+      prevent_self_trade(taker, *maker);
+      continue;
+    }
+
     const auto [trade_px, trade_qty] = compute_trade(taker, *maker);
     log::debug("trading {}@{}: taker: {}; maker: {}",
                trade_qty,
@@ -100,7 +136,10 @@ auto RegularOrderMatcher::trade_taker(LimitOrder& taker,
                *maker,
                taker);
     taker.execute(trade_qty);
-    maker->execute(trade_qty);
+    if (execute_maker(*maker, trade_qty)) {
+      requeue_maker(makers, maker_idx);
+      replenished_makers.push_back(maker->id());
+    }
 
     emit(ClientNotification(
         prepare_execution_report(taker)
@@ -120,11 +159,14 @@ auto RegularOrderMatcher::trade_taker(LimitOrder& taker,
 
     emit(order::make_making_order_reduced_notification(*maker));
     emit(order::make_trade_notification(taker, *maker, trade_px, trade_qty));
+    order_book_.record_trade_price(static_cast<Price>(trade_px));
   }
+  return replenished_makers;
 }
 
-auto RegularOrderMatcher::trade_ioc_taker(
-    LimitOrder& taker, const std::vector<LimitOrder*>& makers) -> void {
+auto RegularOrderMatcher::trade_ioc_taker(LimitOrder& taker,
+                                          std::vector<LimitOrder*> makers)
+    -> std::vector<OrderId> {
   if (makers.empty()) {
     log::err(
         "[BUG] the matcher can not trade an order, no orders were matched with "
@@ -133,14 +175,20 @@ auto RegularOrderMatcher::trade_ioc_taker(
     throw std::logic_error("no orders can be traded with IoC order");
   }
 
-  const auto last_maker_it = std::prev(makers.end());
-  for (auto maker_iter = makers.begin(); maker_iter != makers.end();
-       ++maker_iter) {
-    if (taker.executed()) {
+  std::vector<OrderId> replenished_makers;
+  const auto self_trading_owner = self_trade_owner(taker);
+  for (std::size_t maker_idx = 0; maker_idx < makers.size(); ++maker_idx) {
+    if (!taker.tradable()) {
       break;
     }
 
-    LimitOrder* maker = *maker_iter;
+    LimitOrder* maker = makers[maker_idx];
+    if (self_trading_owner != OwnerKey::None &&
+        maker->owner_key() == self_trading_owner) [[unlikely]] {
+      prevent_self_trade(taker, *maker);
+      continue;
+    }
+
     const auto [trade_px, trade_qty] = compute_trade(taker, *maker);
     log::debug("trading {}@{}: taker: {}; maker: {}",
                trade_qty,
@@ -148,9 +196,12 @@ auto RegularOrderMatcher::trade_ioc_taker(
                taker,
                *maker);
     taker.execute(trade_qty);
-    maker->execute(trade_qty);
+    if (execute_maker(*maker, trade_qty)) {
+      requeue_maker(makers, maker_idx);
+      replenished_makers.push_back(maker->id());
+    }
 
-    if (maker_iter == last_maker_it && !taker.executed()) {
+    if (maker_idx + 1 == makers.size() && taker.tradable()) {
       taker.cancel();
     }
 
@@ -172,11 +223,20 @@ auto RegularOrderMatcher::trade_ioc_taker(
 
     emit(order::make_making_order_reduced_notification(*maker));
     emit(order::make_trade_notification(taker, *maker, trade_px, trade_qty));
+    order_book_.record_trade_price(static_cast<Price>(trade_px));
   }
+
+  // The remainder is left when the last makers are not traded
+  // to prevent self trades
+  if (taker.tradable()) {
+    cancel_taker(taker);
+  }
+  return replenished_makers;
 }
 
-auto RegularOrderMatcher::trade_market_taker(
-    MarketOrder& taker, const std::vector<LimitOrder*>& makers) -> void {
+auto RegularOrderMatcher::trade_market_taker(MarketOrder& taker,
+                                             std::vector<LimitOrder*> makers)
+    -> std::vector<OrderId> {
   if (makers.empty()) {
     log::err(
         "[BUG] the matcher can not trade an order, no orders were matched with "
@@ -185,14 +245,20 @@ auto RegularOrderMatcher::trade_market_taker(
     throw std::logic_error("no orders can be traded with market order");
   }
 
-  const auto last_maker_it = std::prev(makers.end());
-  for (auto maker_iter = makers.begin(); maker_iter != makers.end();
-       ++maker_iter) {
-    if (taker.executed()) {
+  std::vector<OrderId> replenished_makers;
+  const auto self_trading_owner = self_trade_owner(taker);
+  for (std::size_t maker_idx = 0; maker_idx < makers.size(); ++maker_idx) {
+    if (!taker.tradable()) {
       break;
     }
 
-    LimitOrder* maker = *maker_iter;
+    LimitOrder* maker = makers[maker_idx];
+    if (self_trading_owner != OwnerKey::None &&
+        maker->owner_key() == self_trading_owner) [[unlikely]] {
+      prevent_self_trade(taker, *maker);
+      continue;
+    }
+
     const auto [trade_px, trade_qty] = compute_trade(taker, *maker);
     log::debug("trading {}@{}: taker: {}; maker: {}",
                trade_qty,
@@ -200,9 +266,12 @@ auto RegularOrderMatcher::trade_market_taker(
                taker,
                *maker);
     taker.execute(trade_qty);
-    maker->execute(trade_qty);
+    if (execute_maker(*maker, trade_qty)) {
+      requeue_maker(makers, maker_idx);
+      replenished_makers.push_back(maker->id());
+    }
 
-    if (maker_iter == last_maker_it && !taker.executed()) {
+    if (maker_idx + 1 == makers.size() && taker.tradable()) {
       taker.cancel();
     }
 
@@ -224,7 +293,92 @@ auto RegularOrderMatcher::trade_market_taker(
 
     emit(order::make_making_order_reduced_notification(*maker));
     emit(order::make_trade_notification(taker, *maker, trade_px, trade_qty));
+    order_book_.record_trade_price(static_cast<Price>(trade_px));
   }
+
+  // The remainder is left when the last makers are not traded
+  // to prevent self trades
+  if (taker.tradable()) {
+    cancel_taker(taker);
+  }
+  return replenished_makers;
+}
+
+template <typename TakerOrderType>
+auto RegularOrderMatcher::self_trade_owner(const TakerOrderType& taker) const
+    -> OwnerKey {
+  return self_trade_prevention_ == SelfTradePrevention::None
+             ? OwnerKey::None
+             : taker.owner_key();
+}
+
+template <typename TakerOrderType>
+auto RegularOrderMatcher::prevent_self_trade(TakerOrderType& taker,
+                                             LimitOrder& maker) -> void {
+  log::debug("preventing self trade: taker: {}; maker: {}", taker, maker);
+
+  switch (self_trade_prevention_) {
+    case SelfTradePrevention::None:
+      return;
+    case SelfTradePrevention::CancelNewest:
+      cancel_taker(taker);
+      return;
+    case SelfTradePrevention::CancelOldest:
+      cancel_maker(maker);
+      return;
+    case SelfTradePrevention::CancelBoth:
+      cancel_maker(maker);
+      cancel_taker(taker);
+      return;
+    case SelfTradePrevention::Decrement: {
+      const LeavesQuantity quantity{static_cast<Quantity>(
+          std::min(taker.leaves_quantity(), maker.leaves_quantity()))};
+      taker.reduce(quantity);
+      maker.reduce(quantity);
+
+      if (maker.tradable()) {
+        emit(order::make_making_order_reduced_notification(maker));
+        emit(ClientNotification(
+            prepare_modification_confirmation(maker)
+                .with_execution_id(maker.make_execution_id())
+                .build()));
+      } else {
+        cancel_maker(maker);
+      }
+
+      if (!taker.tradable()) {
+        cancel_taker(taker);
+      } else if constexpr (std::is_same_v<TakerOrderType, LimitOrder>) {
+        // A market taker is reported once it is filled or cancelled
+        emit(ClientNotification(
+            prepare_modification_confirmation(taker)
+                .with_execution_id(taker.make_execution_id())
+                .build()));
+      }
+      return;
+    }
+  }
+
+  core::unreachable();
+}
+
+template <typename TakerOrderType>
+auto RegularOrderMatcher::cancel_taker(TakerOrderType& taker) -> void {
+  taker.cancel();
+  emit(ClientNotification(prepare_cancellation_confirmation(taker)
+                              .with_execution_id(taker.make_execution_id())
+                              .with_client_order_id(taker.client_order_id())
+                              .build()));
+}
+
+// A cancelled maker is removed from the book along with the executed ones
+auto RegularOrderMatcher::cancel_maker(LimitOrder& maker) -> void {
+  maker.cancel();
+  emit(order::make_making_order_removed_from_book_notification(maker));
+  emit(ClientNotification(prepare_cancellation_confirmation(maker)
+                              .with_execution_id(maker.make_execution_id())
+                              .with_client_order_id(maker.client_order_id())
+                              .build()));
 }
 
 auto RegularOrderMatcher::take_opposite_limit_orders(Side aggressor_side)
@@ -262,13 +416,50 @@ auto RegularOrderMatcher::make_price_criteria(const LimitOrder& aggressor)
   core::unreachable();
 }
 
-auto RegularOrderMatcher::remove_filled_orders(LimitOrdersContainer& side)
+auto RegularOrderMatcher::remove_completed_orders(LimitOrdersContainer& side)
     -> void {
-  constexpr auto non_filled_order = [](const LimitOrder& order) {
-    return !order.executed();
+  constexpr auto tradable_order = [](const LimitOrder& order) {
+    return order.tradable();
   };
 
-  side.erase(side.begin(), find_limit_order(side, non_filled_order));
+  side.erase(side.begin(), find_limit_order(side, tradable_order));
+}
+
+auto RegularOrderMatcher::requeue_replenished_orders(
+    LimitOrdersContainer& side, const std::vector<OrderId>& order_ids)
+    -> void {
+  // Orders are moved in the order they were replenished, so that an order
+  // replenished later is queued behind an order replenished earlier
+  for (const auto order_id : order_ids) {
+    const auto order_it =
+        find_limit_order(side, [order_id](const LimitOrder& order) {
+          return order.id() == order_id;
+        });
+    if (order_it == side.end()) [[unlikely]] {
+      continue;
+    }
+    side.requeue(order_it);
+  }
+}
+
+auto RegularOrderMatcher::execute_maker(LimitOrder& maker,
+                                        ExecutedQuantity quantity) -> bool {
+  const bool slice_executed = static_cast<double>(quantity) >=
+                              static_cast<double>(maker.displayed_quantity());
+  maker.execute(quantity);
+  return slice_executed && !maker.executed();
+}
+
+auto RegularOrderMatcher::requeue_maker(std::vector<LimitOrder*>& makers,
+                                        std::size_t maker_idx) -> void {
+  LimitOrder* maker = makers[maker_idx];
+  const auto level_end = std::find_if(
+      std::next(makers.begin(), static_cast<std::ptrdiff_t>(maker_idx) + 1),
+      makers.end(),
+      [price = maker->price()](const LimitOrder* other) {
+        return other->price() != price;
+      });
+  makers.insert(level_end, maker);
 }
 
 template <typename TakerOrderType>
@@ -277,7 +468,7 @@ auto RegularOrderMatcher::compute_trade(const TakerOrderType& taker,
     -> std::pair<ExecutionPrice, ExecutedQuantity> {
   const ExecutionPrice trade_px{static_cast<Price>(maker.price())};
   const ExecutedQuantity trade_qty{static_cast<Quantity>(
-      std::min(taker.leaves_quantity(), maker.leaves_quantity()))};
+      std::min(taker.leaves_quantity(), maker.displayed_quantity()))};
   return std::make_pair(trade_px, trade_qty);
 }
 
@@ -3,10 +3,15 @@
 #include <variant>
 
 #include "core/tools/overload.hpp"
+#include "ih/common/events/event_reporter.hpp"
+#include "ih/orders/actions/auction_order_action_processor.hpp"
 #include "ih/orders/actions/elimination.hpp"
+#include "ih/orders/actions/mass_cancellation.hpp"
 #include "ih/orders/actions/regular_order_action_processor.hpp"
+#include "ih/orders/matchers/auction_uncross.hpp"
 #include "ih/orders/replies/client_reject_reporter.hpp"
 #include "ih/orders/requests/interpretation.hpp"
+#include "ih/orders/tools/id_conversion.hpp"
 #include "ih/orders/tools/order_book_state_converter.hpp"
 #include "ih/orders/validation/client_request_validator.hpp"
 #include "log/logging.hpp"
@@ -27,6 +32,36 @@ auto setup_client_request_validator(const Configuration& configuration)
   return validator;
 }
 
+[[nodiscard]]
+auto make_quote_placement(const protocol::MassQuoteRequest& request,
+                          const protocol::QuoteEntry& entry)
+    -> protocol::OrderPlacementRequest {
+  protocol::OrderPlacementRequest placement{request.session};
+  placement.instrument = request.instrument;
+  placement.parties = request.parties;
+  placement.client_order_id = entry.client_order_id;
+  placement.order_price = entry.order_price;
+  placement.order_quantity = entry.order_quantity;
+  placement.side = entry.side;
+  placement.order_type = OrderType::Option::Limit;
+  placement.time_in_force = TimeInForce::Option::Day;
+  return placement;
+}
+
+[[nodiscard]]
+auto make_mass_cancellation_report(
+    const protocol::OrderMassCancellationRequest& request,
+    std::size_t cancelled,
+    OrderId report_id) -> protocol::OrderMassCancellationReport {
+  protocol::OrderMassCancellationReport report{request.session};
+  report.instrument = request.instrument;
+  report.client_order_id = request.client_order_id;
+  report.venue_order_id = order::to_venue_order_id(report_id);
+  report.side = request.side;
+  report.total_affected_orders = TotalAffectedOrders{cancelled};
+  return report;
+}
+
 }  // namespace
 
 OrderSystemFacade::OrderSystemFacade(
@@ -37,7 +72,8 @@ OrderSystemFacade::OrderSystemFacade(
     std::unique_ptr<order::Validator> validator,
     std::unique_ptr<order::RejectNotifier> reject_notifier,
     std::unique_ptr<OrderBook> depr_order_book,
-    std::unique_ptr<OrderActionHandler> depr_order_action_handler)
+    std::unique_ptr<OrderActionHandler> depr_order_action_handler,
+    std::unique_ptr<OrderActionHandler> auction_order_action_handler)
     : configuration_(configuration),
       phase_handler_(event_listener),
       halt_not_closed_phase_setting_{},
@@ -47,27 +83,12 @@ OrderSystemFacade::OrderSystemFacade(
       reject_notifier_(std::move(reject_notifier)),
       depr_order_book_(std::move(depr_order_book)),
       depr_order_action_handler_(std::move(depr_order_action_handler)),
+      auction_order_action_handler_(std::move(auction_order_action_handler)),
       event_listener_(&event_listener) {}
 
 auto OrderSystemFacade::process(const protocol::OrderPlacementRequest& request)
     -> void {
-  if (!validate(request)) {
-    return;
-  }
-
-  PlacementInterpreter interpreter(std::invoke(*order_id_generator_));
-  const auto dispatcher = core::overload(
-      [&](LimitOrder order) {
-        depr_order_action_handler_->place_limit_order(std::move(order));
-      },
-      [&](MarketOrder order) {
-        depr_order_action_handler_->place_market_order(std::move(order));
-      },
-      [&](OrderRequestError error) {
-        reject_notifier_->notify_rejected(request, describe(error));
-      });
-
-  std::visit(dispatcher, interpreter.interpret(request));
+  place(request, /*quote=*/false);
 }
 
 auto OrderSystemFacade::process(
@@ -79,7 +100,7 @@ auto OrderSystemFacade::process(
   ModificationInterpreter interpreter;
   const auto dispatcher = core::overload(
       [&](LimitUpdate update) {
-        depr_order_action_handler_->amend_limit_order(std::move(update));
+        order_action_handler().amend_limit_order(std::move(update));
       },
       [&](OrderRequestError error) {
         reject_notifier_->notify_rejected(request, describe(error));
@@ -97,7 +118,7 @@ auto OrderSystemFacade::process(
   CancellationInterpreter interpreter;
   const auto dispatcher = core::overload(
       [&](const OrderCancel& cancel) {
-        depr_order_action_handler_->cancel_order(cancel);
+        order_action_handler().cancel_order(cancel);
       },
       [&](OrderRequestError error) {
         reject_notifier_->notify_rejected(request, describe(error));
@@ -106,6 +127,41 @@ auto OrderSystemFacade::process(
   std::visit(dispatcher, interpreter.interpret(request));
 }
 
+auto OrderSystemFacade::process(
+    const protocol::OrderMassCancellationRequest& request) -> void {
+  if (!validate_phase(request)) {
+    return;
+  }
+
+  const order::MassCancellation cancellation{*event_listener_, request};
+  const auto cancelled = cancellation(*depr_order_book_);
+  log::debug("cancelled {} orders by a mass cancellation request", cancelled);
+
+  // A request without an instrument is broadcast to all engines,
+  // the trading system reports it once for all of them instead
+  if (request.instrument.has_value()) {
+    const EventReporter reporter{*event_listener_};
+    reporter.emit(ClientNotification{make_mass_cancellation_report(
+        request, cancelled, std::invoke(*order_id_generator_))});
+  }
+}
+
+auto OrderSystemFacade::process(const protocol::MassQuoteRequest& request)
+    -> void {
+  if (!validate_phase(request)) {
+    return;
+  }
+
+  const order::MassCancellation cancellation{*event_listener_, request};
+  const auto cancelled = cancellation(*depr_order_book_);
+  log::debug("cancelled {} orders replaced by a mass quote", cancelled);
+
+  // Each entry is validated and rejected on its own
+  for (const auto& entry : request.entries) {
+    place(make_quote_placement(request, entry), /*quote=*/true);
+  }
+}
+
 auto OrderSystemFacade::process(const protocol::SecurityStatusRequest& request)
     -> void {
   phase_handler_.process(request);
@@ -113,6 +169,7 @@ auto OrderSystemFacade::process(const protocol::SecurityStatusRequest& request)
 
 auto OrderSystemFacade::store_state(market_state::OrderBook& state) -> void {
   store_order_book_state(*depr_order_book_, state);
+  state.last_order_id = order_id_generator_->last_generated();
 }
 
 auto OrderSystemFacade::recover_state(market_state::OrderBook state) -> void {
@@ -121,11 +178,48 @@ auto OrderSystemFacade::recover_state(market_state::OrderBook state) -> void {
 
   recover_page(std::move(state.buy_orders), order::OrderBookSide::Buy);
   recover_page(std::move(state.sell_orders), order::OrderBookSide::Sell);
+  if (state.buy_stop_orders.has_value()) {
+    recover_page(std::move(*state.buy_stop_orders), order::OrderBookSide::Buy);
+  }
+  if (state.sell_stop_orders.has_value()) {
+    recover_page(std::move(*state.sell_stop_orders),
+                 order::OrderBookSide::Sell);
+  }
+
+  if (state.last_order_id.has_value()) {
+    order_id_generator_->resume_after(*state.last_order_id);
+  }
 }
 
-auto OrderSystemFacade::recover_page(
-    std::vector<market_state::LimitOrder> orders_state,
-    order::OrderBookSide side) -> void {
+auto OrderSystemFacade::place(const protocol::OrderPlacementRequest& request,
+                              bool quote) -> void {
+  if (!validate(request)) {
+    return;
+  }
+
+  PlacementInterpreter interpreter(std::invoke(*order_id_generator_));
+  const auto dispatcher = core::overload(
+      [&](LimitOrder order) {
+        order_action_handler().place_limit_order(std::move(order));
+      },
+      [&](MarketOrder order) {
+        order_action_handler().place_market_order(std::move(order));
+      },
+      [&](StopOrder order) {
+        order_action_handler().place_stop_order(std::move(order));
+      },
+      [&](OrderRequestError error) {
+        reject_notifier_->notify_rejected(request, describe(error));
+      });
+
+  std::visit(dispatcher,
+             quote ? interpreter.interpret_quote(request)
+                   : interpreter.interpret(request));
+}
+
+template <typename OrderState>
+auto OrderSystemFacade::recover_page(std::vector<OrderState> orders_state,
+                                     order::OrderBookSide side) -> void {
   for (auto&& order : orders_state) {
     if (const auto error_message = validate(order, side)) {
       log::err("validation failed with '{}' error, order was not recovered: {}",
@@ -134,12 +228,27 @@ auto OrderSystemFacade::recover_page(
       continue;
     }
 
-    depr_order_action_handler_->recover_order(std::move(order));
+    order_action_handler().recover_order(std::move(order));
   }
 }
 
 template <typename RequestType>
 auto OrderSystemFacade::validate(const RequestType& request) -> bool {
+  if (!validate_phase(request)) {
+    return false;
+  }
+
+  const auto conclusion = validator_->validate(request);
+  if (conclusion.failed()) {
+    reject_notifier_->notify_rejected(request, conclusion.error());
+    return false;
+  }
+
+  return true;
+}
+
+template <typename RequestType>
+auto OrderSystemFacade::validate_phase(const RequestType& request) -> bool {
   if (phase_handler_.in_closed_phase()) {
     reject_notifier_->notify_rejected(
         request, "request cannot be processed during closed phase");
@@ -152,16 +261,11 @@ auto OrderSystemFacade::validate(const RequestType& request) -> bool {
     return false;
   }
 
-  const auto conclusion = validator_->validate(request);
-  if (conclusion.failed()) {
-    reject_notifier_->notify_rejected(request, conclusion.error());
-    return false;
-  }
-
   return true;
 }
 
-auto OrderSystemFacade::validate(const market_state::LimitOrder& order,
+template <typename OrderState>
+auto OrderSystemFacade::validate(const OrderState& order,
                                  order::OrderBookSide order_book_side)
     -> std::optional<std::string_view> {
   if (phase_handler_.in_closed_phase() &&
@@ -204,17 +308,60 @@ auto OrderSystemFacade::reject_on_halt(
          !halt_not_closed_phase_setting_.allow_cancels;
 }
 
+template <>
+auto OrderSystemFacade::reject_on_halt(
+    const protocol::OrderMassCancellationRequest& /*request*/) -> bool {
+  return phase_handler_.in_halt_phase() &&
+         !halt_not_closed_phase_setting_.allow_cancels;
+}
+
+auto OrderSystemFacade::order_action_handler() -> OrderActionHandler& {
+  return phase_handler_.in_auction_phase() ? *auction_order_action_handler_
+                                           : *depr_order_action_handler_;
+}
+
 auto OrderSystemFacade::handle(const event::Tick& tick) -> void {
   order::SystemElimination eliminator(*event_listener_, tick);
   eliminator(*depr_order_book_);
 }
 
+auto OrderSystemFacade::expiry_deadline() -> std::optional<TickDeadline> {
+  return order::find_expiry_deadline(*depr_order_book_);
+}
+
 auto OrderSystemFacade::handle(const event::PhaseTransition& phase_transition)
     -> void {
+  const auto previous_phase = phase_handler_.current_phase();
+  const bool was_in_auction = phase_handler_.in_auction_phase();
+  const bool was_in_continuous_trading =
+      phase_handler_.in_continuous_trading_phase();
+
   phase_handler_.handle(phase_transition);
   halt_not_closed_phase_setting_ = phase_transition.phase.settings().value_or(
       Phase::Settings{.allow_cancels = false});
 
+  // A halt of an auction does not end it
+  if (was_in_auction && phase_handler_.current_phase().trading_phase() !=
+                            previous_phase.trading_phase()) {
+    AuctionUncross uncross(*event_listener_, *depr_order_book_);
+    if (const auto equilibrium = uncross(previous_phase)) {
+      log::info("{} auction uncrossed at {} with {} volume",
+                previous_phase.trading_phase(),
+                equilibrium->price,
+                equilibrium->volume);
+    } else {
+      log::info("{} auction ended without trades",
+                previous_phase.trading_phase());
+    }
+  }
+
+  // Stop orders kept untriggered by an auction or a halt are evaluated
+  // once continuous trading starts, never in a closed or halted book
+  if (!was_in_continuous_trading &&
+      phase_handler_.in_continuous_trading_phase()) {
+    order_action_handler().trigger_stop_orders();
+  }
+
   if (phase_handler_.in_closed_phase()) {
     order::ClosedPhaseElimination eliminator(*event_listener_,
                                              phase_transition.tz_time_point);
@@ -246,7 +393,10 @@ auto OrderSystemFacade::setup(const Instrument& instrument,
 
   auto depr_order_book = std::make_unique<OrderBook>();
   auto depr_order_action_handler =
-      std::make_unique<RegularOrderActionProcessor>(listener, *depr_order_book);
+      std::make_unique<RegularOrderActionProcessor>(
+          listener, *depr_order_book, configuration.self_trade_prevention);
+  auto auction_order_action_handler =
+      std::make_unique<AuctionOrderActionProcessor>(listener, *depr_order_book);
 
   return {listener,
           instrument,
@@ -255,7 +405,8 @@ auto OrderSystemFacade::setup(const Instrument& instrument,
           std::move(validator),
           std::move(reject_notifier),
           std::move(depr_order_book),
-          std::move(depr_order_action_handler)};
+          std::move(depr_order_action_handler),
+          std::move(auction_order_action_handler)};
 }
 
 }  // namespace simulator::trading_system::matching_engine
\ No newline at end of file
@@ -19,6 +19,23 @@ auto make_aux_order_identifiers(OrderIdGenerator& order_id_generator)
                         generate_aux_execution_id(rejected_order_id));
 }
 
+// Mass requests have no dedicated reject message
+template <typename RequestType>
+auto make_business_reject(const RequestType& request,
+                          RejectedMessageType rejected_type,
+                          std::string_view reason)
+    -> protocol::BusinessMessageReject {
+  protocol::BusinessMessageReject reject{request.session};
+  reject.business_reject_reason = BusinessRejectReason::Option::Other;
+  reject.text = RejectText(std::string(reason));
+  reject.ref_message_type = rejected_type;
+  reject.ref_seq_num = request.seq_num;
+  if (const auto& rejected_id = request.client_order_id) {
+    reject.ref_id = BusinessRejectRefId(rejected_id->value());
+  }
+  return reject;
+}
+
 }  // namespace
 
 ClientRejectReporter::ClientRejectReporter(EventListener& event_listener,
@@ -90,4 +107,25 @@ auto ClientRejectReporter::notify_rejected(
   emit(ClientNotification(std::move(reject)));
 }
 
+auto ClientRejectReporter::notify_rejected(
+    const protocol::OrderMassCancellationRequest& request,
+    std::string_view reason) -> void {
+  log::debug(
+      "notifying the client that the order mass cancellation request has been "
+      "rejected");
+
+  emit(ClientNotification(make_business_reject(
+      request, RejectedMessageType::Option::OrderMassCancelRequest, reason)));
+}
+
+auto ClientRejectReporter::notify_rejected(
+    const protocol::MassQuoteRequest& request, std::string_view reason)
+    -> void {
+  log::debug(
+      "notifying the client that the mass quote request has been rejected");
+
+  emit(ClientNotification(make_business_reject(
+      request, RejectedMessageType::Option::MassQuote, reason)));
+}
+
 }  // namespace simulator::trading_system::matching_engine::order
\ No newline at end of file
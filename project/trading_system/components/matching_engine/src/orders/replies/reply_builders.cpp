@@ -36,6 +36,43 @@ auto CancellationConfirmationBuilder::for_order(const LimitOrder& order)
   return *this;
 }
 
+auto CancellationConfirmationBuilder::for_order(const MarketOrder& order)
+    -> CancellationConfirmationBuilder& {
+  message_.instrument = order.instrument();
+  message_.parties = order.attributes().order_parties();
+  message_.venue_order_id = order::to_venue_order_id(order.id());
+  message_.leaving_quantity = order.leaves_quantity();
+  message_.cum_executed_quantity = order.cum_executed_quantity();
+  message_.order_status = order.status();
+  message_.side = order.side();
+  message_.time_in_force = order.time_in_force();
+  message_.short_sale_exempt_reason = order.short_sale_exemption_reason();
+  message_.expire_time = order.expire_time();
+  message_.expire_date = order.expire_date();
+  message_.order_type = OrderType::Option::Market;
+  return *this;
+}
+
+auto CancellationConfirmationBuilder::for_order(const StopOrder& order)
+    -> CancellationConfirmationBuilder& {
+  message_.instrument = order.instrument();
+  message_.parties = order.attributes().order_parties();
+  message_.venue_order_id = order::to_venue_order_id(order.id());
+  // A stop order is not executed before it is triggered
+  message_.leaving_quantity =
+      LeavesQuantity{static_cast<double>(order.total_quantity())};
+  message_.cum_executed_quantity = CumExecutedQuantity{0};
+  message_.order_price = order.limit_price();
+  message_.order_status = order.status();
+  message_.side = order.side();
+  message_.time_in_force = order.time_in_force();
+  message_.short_sale_exempt_reason = order.short_sale_exemption_reason();
+  message_.expire_time = order.expire_time();
+  message_.expire_date = order.expire_date();
+  message_.order_type = order.order_type();
+  return *this;
+}
+
 auto CancellationConfirmationBuilder::with_execution_id(ExecutionId identifier)
     -> CancellationConfirmationBuilder& {
   message_.execution_id = std::move(identifier);
@@ -63,6 +100,20 @@ auto prepare_cancellation_confirmation(const LimitOrder& order)
   return builder;
 }
 
+auto prepare_cancellation_confirmation(const MarketOrder& order)
+    -> CancellationConfirmationBuilder {
+  CancellationConfirmationBuilder builder{order.client_session()};
+  builder.for_order(order);
+  return builder;
+}
+
+auto prepare_cancellation_confirmation(const StopOrder& order)
+    -> CancellationConfirmationBuilder {
+  CancellationConfirmationBuilder builder{order.client_session()};
+  builder.for_order(order);
+  return builder;
+}
+
 CancellationRejectBuilder::CancellationRejectBuilder(protocol::Session session)
     : message_(std::move(session)) {
   message_.order_status = OrderStatus::Option::Rejected;
@@ -371,6 +422,23 @@ auto PlacementConfirmationBuilder::for_order(const MarketOrder& order)
   return *this;
 }
 
+auto PlacementConfirmationBuilder::for_order(const StopOrder& order)
+    -> PlacementConfirmationBuilder& {
+  message_.instrument = order.instrument();
+  message_.parties = order.attributes().order_parties();
+  message_.client_order_id = order.client_order_id();
+  message_.venue_order_id = order::to_venue_order_id(order.id());
+  message_.order_price = order.limit_price();
+  message_.order_quantity = order.total_quantity();
+  message_.side = order.side();
+  message_.time_in_force = order.time_in_force();
+  message_.short_sale_exempt_reason = order.short_sale_exemption_reason();
+  message_.expire_time = order.expire_time();
+  message_.expire_date = order.expire_date();
+  message_.order_type = order.order_type();
+  return *this;
+}
+
 auto PlacementConfirmationBuilder::with_execution_id(ExecutionId identifier)
     -> PlacementConfirmationBuilder& {
   message_.execution_id = std::move(identifier);
@@ -391,6 +459,13 @@ auto prepare_placement_confirmation(const MarketOrder& order)
   return builder;
 }
 
+auto prepare_placement_confirmation(const StopOrder& order)
+    -> PlacementConfirmationBuilder {
+  PlacementConfirmationBuilder builder{order.client_session()};
+  builder.for_order(order);
+  return builder;
+}
+
 PlacementRejectBuilder::PlacementRejectBuilder(protocol::Session session)
     : message_(std::move(session)) {}
 
@@ -31,7 +31,9 @@ auto interpret_side(std::optional<Side> side)
 auto interpret_order_type(std::optional<OrderType> order_type)
     -> tl::expected<OrderType, OrderRequestError> {
   if (order_type == OrderType::Option::Limit ||
-      order_type == OrderType::Option::Market) [[likely]] {
+      order_type == OrderType::Option::Market ||
+      order_type == OrderType::Option::Stop ||
+      order_type == OrderType::Option::StopLimit) [[likely]] {
     return *order_type;
   }
 
@@ -133,6 +135,9 @@ auto PlacementInterpreter::interpret(
       return interpret_as_limit_order(request);
     case OrderType::Option::Market:
       return interpret_as_market_order(request);
+    case OrderType::Option::Stop:
+    case OrderType::Option::StopLimit:
+      return interpret_as_stop_order(request);
   }
 
   // The execution must not reach this point, as this means that
@@ -140,6 +145,17 @@ auto PlacementInterpreter::interpret(
   core::unreachable();
 }
 
+auto PlacementInterpreter::interpret_quote(
+    const protocol::OrderPlacementRequest& request) -> NewOrderInterpretation {
+  auto attributes = detail::OrderAttributesCreator::create_from(request);
+  if (!attributes.has_value()) {
+    return attributes.error();
+  }
+  attributes->set_quote(true);
+
+  return interpret_as_limit_order(request, std::move(*attributes));
+}
+
 auto PlacementInterpreter::create_order_record(
     const protocol::OrderPlacementRequest& request,
     OrderAttributes order_attributes) const
@@ -163,7 +179,13 @@ auto PlacementInterpreter::interpret_as_limit_order(
     return attributes.error();
   }
 
-  auto order_record = create_order_record(request, std::move(*attributes));
+  return interpret_as_limit_order(request, std::move(*attributes));
+}
+
+auto PlacementInterpreter::interpret_as_limit_order(
+    const protocol::OrderPlacementRequest& request, OrderAttributes attributes)
+    -> NewOrderInterpretation {
+  auto order_record = create_order_record(request, std::move(attributes));
   if (!order_record.has_value()) {
     return order_record.error();
   }
@@ -174,6 +196,12 @@ auto PlacementInterpreter::interpret_as_limit_order(
   if (!request.order_quantity.has_value()) {
     return OrderRequestError::QuantityMissing;
   }
+  if (request.display_quantity.has_value()) {
+    return LimitOrder{request.order_price.value(),
+                      request.order_quantity.value(),
+                      request.display_quantity.value(),
+                      std::move(order_record.value())};
+  }
   return LimitOrder{request.order_price.value(),
                     request.order_quantity.value(),
                     std::move(order_record.value())};
@@ -200,6 +228,39 @@ auto PlacementInterpreter::interpret_as_market_order(
                      std::move(order_record.value())};
 }
 
+auto PlacementInterpreter::interpret_as_stop_order(
+    const protocol::OrderPlacementRequest& request) -> NewOrderInterpretation {
+  auto attributes = detail::OrderAttributesCreator::create_from(request);
+  if (!attributes.has_value()) {
+    return attributes.error();
+  }
+
+  auto order_record = create_order_record(request, std::move(*attributes));
+  if (!order_record.has_value()) {
+    return order_record.error();
+  }
+
+  if (!request.stop_price.has_value()) {
+    return OrderRequestError::StopPriceMissing;
+  }
+  // A stop order is released as a market order, its price is ignored
+  std::optional<OrderPrice> limit_price;
+  if (request.order_type == OrderType::Option::StopLimit) {
+    if (!request.order_price.has_value()) {
+      return OrderRequestError::PriceMissing;
+    }
+    limit_price = request.order_price;
+  }
+  if (!request.order_quantity.has_value()) {
+    return OrderRequestError::QuantityMissing;
+  }
+
+  return StopOrder{*request.stop_price,
+                   limit_price,
+                   *request.order_quantity,
+                   std::move(order_record.value())};
+}
+
 // endregion PlacementInterpreter
 
 // region ModificationInterpreter
@@ -298,6 +359,8 @@ auto describe(OrderRequestError error) -> std::string_view {
       return "unknown time in force";
     case OrderRequestError::PriceMissing:
       return "order price missing";
+    case OrderRequestError::StopPriceMissing:
+      return "order stop price missing";
     case OrderRequestError::QuantityMissing:
       return "order quantity missing";
     case OrderRequestError::OrderIdInvalid:
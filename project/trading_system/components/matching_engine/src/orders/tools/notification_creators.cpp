@@ -41,7 +41,7 @@ auto make_making_order_added_to_book_notification(const LimitOrder& order)
   return OrderBookNotification(OrderAdded{
       .order_owner = get_owner_id(order.owner()),
       .order_price = static_cast<Price>(order.price()),
-      .order_quantity = static_cast<Quantity>(order.leaves_quantity()),
+      .order_quantity = static_cast<Quantity>(order.displayed_quantity()),
       .order_id = order.id(),
       .order_side = order.side()});
 }
@@ -58,7 +58,7 @@ auto make_making_order_reduced_notification(const LimitOrder& maker)
     -> OrderBookNotification {
   return OrderBookNotification(OrderReduced{
       .order_price = static_cast<Price>(maker.price()),
-      .order_quantity = static_cast<Quantity>(maker.leaves_quantity()),
+      .order_quantity = static_cast<Quantity>(maker.displayed_quantity()),
       .order_id = maker.id(),
       .order_side = maker.side()});
 }
@@ -76,8 +76,8 @@ auto make_trade_notification(const LimitOrder& taker,
       .traded_quantity = static_cast<Quantity>(traded_quantity),
       .aggressor_side = AggressorSide{taker.side()},
       .trade_time = core::get_current_system_time(),
-      .market_phase =
-          MarketPhase::open()});  // The "Open" phase is hardcoded for now.
+      // Continuous matching happens in the Open phase only
+      .market_phase = MarketPhase::open()});
 }
 
 auto make_trade_notification(const MarketOrder& taker,
@@ -93,8 +93,24 @@ auto make_trade_notification(const MarketOrder& taker,
       .traded_quantity = static_cast<Quantity>(traded_quantity),
       .aggressor_side = AggressorSide{taker.side()},
       .trade_time = core::get_current_system_time(),
-      .market_phase =
-          MarketPhase::open()});  // The "Open" phase is hardcoded for now.
+      // Continuous matching happens in the Open phase only
+      .market_phase = MarketPhase::open()});
+}
+
+auto make_auction_trade_notification(const LimitOrder& buyer,
+                                     const LimitOrder& seller,
+                                     ExecutionPrice trade_price,
+                                     ExecutedQuantity traded_quantity,
+                                     MarketPhase auction_phase)
+    -> OrderBookNotification {
+  return OrderBookNotification(Trade{
+      .buyer = get_trade_actor<BuyerId>(buyer.owner()),
+      .seller = get_trade_actor<SellerId>(seller.owner()),
+      .trade_price = static_cast<Price>(trade_price),
+      .traded_quantity = static_cast<Quantity>(traded_quantity),
+      .aggressor_side = std::nullopt,
+      .trade_time = core::get_current_system_time(),
+      .market_phase = auction_phase});
 }
 
 }  // namespace simulator::trading_system::matching_engine::order
\ No newline at end of file
@@ -1,5 +1,10 @@
 #include "ih/orders/tools/order_book_state_converter.hpp"
 
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "core/common/unreachable.hpp"
 #include "core/tools/overload.hpp"
 #include "ih/orders/book/order_metadata.hpp"
 
@@ -7,8 +12,8 @@ namespace simulator::trading_system::matching_engine {
 
 namespace {
 
-auto store(const OrderAttributes& attributes,
-           market_state::LimitOrder& order_state) {
+// Stores the attributes of a limit or a stop order
+auto store(const OrderAttributes& attributes, auto& order_state) {
   order_state.client_order_id = attributes.client_order_id();
   order_state.order_parties = attributes.order_parties();
   order_state.expire_time = attributes.expire_time();
@@ -18,6 +23,22 @@ auto store(const OrderAttributes& attributes,
   order_state.time_in_force = attributes.time_in_force();
 }
 
+auto store(const protocol::Session& session,
+           market_state::Session& session_state) {
+  const auto dispatcher = core::overload(
+      [&](const protocol::fix::Session& fix_session) {
+        session_state = {market_state::SessionType::Fix, fix_session};
+      },
+      [&](const protocol::generator::Session&) {
+        session_state.type = market_state::SessionType::Generator;
+      },
+      [&](const protocol::mdfeed::Session&) {
+        // The market data feed never places orders
+        core::unreachable();
+      });
+  std::visit(dispatcher, session.value);
+}
+
 auto store(const LimitOrder& order, market_state::LimitOrder& order_state) {
   store(order.attributes(), order_state);
   order_state.client_instrument_descriptor = order.instrument();
@@ -25,18 +46,18 @@ auto store(const LimitOrder& order, market_state::LimitOrder& order_state) {
   order_state.order_time = order.time();
   order_state.side = order.side();
   order_state.order_status = order.status();
-  const auto dispatcher = core::overload(
-      [&](const protocol::fix::Session& session) {
-        order_state.client_session = {market_state::SessionType::Fix, session};
-      },
-      [&](const protocol::generator::Session&) {
-        order_state.client_session.type = market_state::SessionType::Generator;
-      });
-  std::visit(dispatcher, order.client_session().value);
+  store(order.client_session(), order_state.client_session);
 
   order_state.order_price = order.price();
   order_state.total_quantity = order.total_quantity();
   order_state.cum_executed_quantity = order.cum_executed_quantity();
+  if (const auto display_quantity = order.display_quantity()) {
+    order_state.display_quantity = display_quantity;
+    order_state.hidden_quantity = order.hidden_quantity();
+  }
+  if (order.attributes().quote()) {
+    order_state.quote = true;
+  }
 }
 
 auto store(OrderPage& page,
@@ -48,12 +69,84 @@ auto store(OrderPage& page,
   }
 }
 
+auto store(const StopOrder& order, market_state::StopOrder& order_state) {
+  store(order.attributes(), order_state);
+  order_state.client_instrument_descriptor = order.instrument();
+  order_state.order_id = order.id();
+  order_state.order_time = order.time();
+  order_state.side = order.side();
+  order_state.order_status = order.status();
+  store(order.client_session(), order_state.client_session);
+
+  order_state.stop_price = order.stop_price();
+  order_state.order_price = order.limit_price();
+  order_state.total_quantity = order.total_quantity();
+}
+
+// Stop orders are stored in the order they are triggered in,
+// so that the recovered orders keep their priority
+auto store(const StopOrdersContainer& orders,
+           std::optional<std::vector<market_state::StopOrder>>& orders_state) {
+  if (orders.empty()) {
+    return;
+  }
+
+  auto& stored = orders_state.emplace();
+  stored.reserve(orders.size());
+  for (const auto& [stop_price, order] : orders) {
+    market_state::StopOrder order_state;
+    store(order, order_state);
+    stored.push_back(std::move(order_state));
+  }
+}
+
+auto recover_attributes(auto& order_state) -> OrderAttributes {
+  OrderAttributes attributes;
+  if (auto&& value = order_state.client_order_id) {
+    attributes.set_client_order_id(std::move(*value));
+  }
+  attributes.set_time_in_force(order_state.time_in_force);
+  if (const auto value = order_state.expire_time) {
+    attributes.set_expire_time(*value);
+  }
+  if (const auto value = order_state.expire_date) {
+    attributes.set_expire_date(*value);
+  }
+  if (const auto value = order_state.short_sale_exemption_reason) {
+    attributes.set_short_sale_exemption_reason(*value);
+  }
+  attributes.set_order_parties(std::move(order_state.order_parties));
+  return attributes;
+}
+
 }  // namespace
 
 auto store_order_book_state(OrderBook& order_book,
                             market_state::OrderBook& state) -> void {
   store(order_book.buy_page(), state.buy_orders);
   store(order_book.sell_page(), state.sell_orders);
+  store(order_book.buy_page().stop_orders(), state.buy_stop_orders);
+  store(order_book.sell_page().stop_orders(), state.sell_stop_orders);
+}
+
+auto recover_order_attributes(market_state::LimitOrder& order_state)
+    -> OrderAttributes {
+  OrderAttributes attributes = recover_attributes(order_state);
+  attributes.set_quote(order_state.quote.value_or(false));
+  return attributes;
+}
+
+auto recover_order_attributes(market_state::StopOrder& order_state)
+    -> OrderAttributes {
+  return recover_attributes(order_state);
+}
+
+auto recover_session(market_state::Session&& session) -> protocol::Session {
+  if (session.type == market_state::SessionType::Fix &&
+      session.fix_session.has_value()) {
+    return protocol::Session{std::move(session.fix_session.value())};
+  }
+  return protocol::Session{protocol::generator::Session{}};
 }
 
 }  // namespace simulator::trading_system::matching_engine
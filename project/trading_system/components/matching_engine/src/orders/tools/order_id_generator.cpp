@@ -9,23 +9,35 @@ namespace simulator::trading_system::matching_engine::order {
 
 namespace {
 
-class IdgenOrderIdImplementation : public OrderIdGenerator {
+auto generate_initial_order_id() -> OrderId {
+  auto gen_context = idgen::make_order_id_generation_ctx();
+  return idgen::generate_new_id(gen_context);
+}
+
+class SequentialOrderIdImplementation : public OrderIdGenerator {
  public:
-  IdgenOrderIdImplementation()
-      : gen_context_(idgen::make_order_id_generation_ctx()) {}
+  explicit SequentialOrderIdImplementation(OrderId initial_order_id)
+      : next_order_id_(initial_order_id.value()) {}
+
+  auto operator()() -> OrderId override { return OrderId{next_order_id_++}; }
+
+  auto last_generated() const -> OrderId override {
+    return OrderId{next_order_id_ - 1};
+  }
 
-  auto operator()() -> OrderId override {
-    return idgen::generate_new_id(gen_context_);
+  auto resume_after(OrderId last_order_id) -> void override {
+    next_order_id_ = last_order_id.value() + 1;
   }
 
  private:
-  idgen::OrderIdContext gen_context_;
+  OrderId::value_type next_order_id_;
 };
 
 }  // namespace
 
 auto OrderIdGenerator::create() -> std::unique_ptr<OrderIdGenerator> {
-  return std::make_unique<IdgenOrderIdImplementation>();
+  return std::make_unique<SequentialOrderIdImplementation>(
+      generate_initial_order_id());
 }
 
 auto generate_order_id(OrderIdGenerator& generator) -> OrderId {
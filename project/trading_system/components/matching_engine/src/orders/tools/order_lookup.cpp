@@ -1,5 +1,7 @@
 #include "ih/orders/tools/order_lookup.hpp"
 
+#include <algorithm>
+
 #include "ih/orders/actions/order_action_handler.hpp"
 #include "ih/orders/book/order_algorithms.hpp"
 
@@ -42,6 +44,26 @@ auto find_limit_order_by_orig_client_order_id(
   return find_unique_limit_order(page, pred);
 }
 
+auto matches_stop_order(const StopOrder& order, const OrderCancel& cancel)
+    -> bool {
+  if (cancel.order_id.has_value()) {
+    return order.id() == *cancel.order_id;
+  }
+
+  const auto& client_order_id = order.client_order_id();
+  if (!client_order_id.has_value() ||
+      !(order.client_session() == cancel.client_session)) {
+    return false;
+  }
+  if (cancel.orig_client_order_id.has_value()) {
+    return client_order_id->value() == cancel.orig_client_order_id->value();
+  }
+  if (cancel.client_order_id.has_value()) {
+    return *client_order_id == *cancel.client_order_id;
+  }
+  return false;
+}
+
 }  // namespace
 
 auto find_target_limit_order(OrderPage& page, const LimitUpdate& update)
@@ -76,4 +98,15 @@ auto find_target_limit_order(OrderPage& page, const OrderCancel& cancel)
   return limit_orders_end(page);
 }
 
+auto find_target_stop_order(OrderPage& page, const OrderCancel& cancel)
+    -> StopOrdersContainer::iterator {
+  auto& orders = page.stop_orders();
+  return std::find_if(
+      orders.begin(),
+      orders.end(),
+      [&cancel](const StopOrdersContainer::value_type& entry) {
+        return matches_stop_order(entry.second, cancel);
+      });
+}
+
 }  // namespace simulator::trading_system::matching_engine
\ No newline at end of file
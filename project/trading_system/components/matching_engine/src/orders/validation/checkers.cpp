@@ -20,9 +20,7 @@ auto SideSupported::check(std::optional<Side> side) -> ValidationResult {
   return verr;
 }
 
-auto OrderSideSupported::operator()(const market_state::LimitOrder& order) const
-    -> ValidationResult {
-  const auto side = order.side;
+auto OrderSideSupported::check(Side side) const -> ValidationResult {
   switch (order_book_side_) {
     case OrderBookSide::Buy:
       return side == Side::Option::Buy
@@ -43,15 +41,16 @@ auto OrderTypeSupported::check(std::optional<OrderType> order_type)
     -> ValidationResult {
   const bool supported = !order_type.has_value() ||
                          order_type == OrderType::Option::Limit ||
-                         order_type == OrderType::Option::Market;
+                         order_type == OrderType::Option::Market ||
+                         order_type == OrderType::Option::Stop ||
+                         order_type == OrderType::Option::StopLimit;
 
   return supported ? std::nullopt
                    : std::make_optional(ValidationError::OrderTypeUnknown);
 }
 
-auto OrderStatusSupported::operator()(
-    const market_state::LimitOrder& order) const -> ValidationResult {
-  const auto order_status = order.order_status;
+auto OrderStatusSupported::check(OrderStatus order_status)
+    -> ValidationResult {
   const bool supported = order_status == OrderStatus::Option::New ||
                          order_status == OrderStatus::Option::PartiallyFilled ||
                          order_status == OrderStatus::Option::Modified;
@@ -60,24 +59,6 @@ auto OrderStatusSupported::operator()(
                    : std::make_optional(ValidationError::OrderStatusUnknown);
 }
 
-auto TotalQuantityRespectsMinimum::operator()(
-    const market_state::LimitOrder& request) const -> ValidationResult {
-  return field_respects_minimum(
-      request.total_quantity, min_, ValidationError::TotalQuantityMinViolated);
-}
-
-auto TotalQuantityRespectsMaximum::operator()(
-    const market_state::LimitOrder& order) const -> ValidationResult {
-  return field_respects_maximum(
-      order.total_quantity, max_, ValidationError::TotalQuantityMaxViolated);
-}
-
-auto TotalQuantityRespectsTick::operator()(
-    const market_state::LimitOrder& order) const -> ValidationResult {
-  return field_respects_tick(
-      order.total_quantity, tick_, ValidationError::TotalQuantityTickViolated);
-}
-
 auto CumExecutedQuantityRespectsNonNegativity::operator()(
     const market_state::LimitOrder& order) const -> ValidationResult {
   return fields_respect_order(
@@ -110,9 +91,32 @@ auto OrderPriceAbsent::check(std::optional<OrderPrice> price)
              : std::make_optional(ValidationError::OrderPriceNotAllowed);
 }
 
-auto TimeInForceSupported::operator()(
-    const market_state::LimitOrder& order) const -> ValidationResult {
-  const auto time_in_force = order.time_in_force;
+auto DisplayQuantityAbsent::check(std::optional<DisplayQuantity> quantity)
+    -> ValidationResult {
+  return !quantity.has_value()
+             ? std::nullopt
+             : std::make_optional(ValidationError::DisplayQuantityNotAllowed);
+}
+
+auto DisplayQuantityWithinOrderQuantity::check(
+    std::optional<DisplayQuantity> display_quantity,
+    std::optional<OrderQuantity> order_quantity) -> ValidationResult {
+  if (!display_quantity.has_value()) {
+    return std::nullopt;
+  }
+
+  const auto display = static_cast<double>(*display_quantity);
+  const bool exceeds_order =
+      order_quantity.has_value() &&
+      display > static_cast<double>(*order_quantity);
+  return display > 0.0 && !exceeds_order
+             ? std::nullopt
+             : std::make_optional(
+                   ValidationError::DisplayQuantityRangeViolated);
+}
+
+auto TimeInForceSupported::check(TimeInForce time_in_force)
+    -> ValidationResult {
   const bool supported = time_in_force == TimeInForce::Option::Day ||
                          time_in_force == TimeInForce::Option::GoodTillDate ||
                          time_in_force == TimeInForce::Option::GoodTillCancel;
@@ -150,10 +154,9 @@ auto OrderNotExpired::check_not_expired(const ExpireDate& date) const
       date, today, std::greater_equal{}, ValidationError::OrderAlreadyExpired);
 }
 
-auto DayOrderNotExpired::operator()(const market_state::LimitOrder& order) const
-    -> ValidationResult {
+auto DayOrderNotExpired::check(OrderTime order_time) -> ValidationResult {
   const auto today = core::to_time(core::get_current_system_date());
-  return fields_respect_order(order.order_time,
+  return fields_respect_order(order_time,
                               today,
                               std::greater_equal{},
                               ValidationError::OrderAlreadyExpired);
@@ -98,6 +98,28 @@ auto ClientRequestValidator::validate(const market_state::LimitOrder& order,
   return conclusion;
 }
 
+auto ClientRequestValidator::validate(const market_state::StopOrder& order,
+                                      OrderBookSide order_book_side) const
+    -> Conclusion {
+  log::debug("validating market_state::StopOrder");
+
+  Validation validation{order, describe};
+  run(validation, order_book_side);
+  auto conclusion = validation.successful()
+                        ? Conclusion::success()
+                        : Conclusion::failure(validation.error_description());
+
+  if (conclusion.failed()) {
+    log::debug(
+        "validation failed with '{}' error, market_state::StopOrder "
+        "was considered as invalid: {}",
+        validation.error(),
+        order);
+  }
+
+  return conclusion;
+}
+
 auto ClientRequestValidator::run(
     Validation<protocol::OrderPlacementRequest>& validation) const -> void {
   const protocol::OrderPlacementRequest& request = validation.request();
@@ -113,9 +135,22 @@ auto ClientRequestValidator::run(
 
   if (request.order_type == OrderType::Option::Limit) {
     validation.expect(OrderPriceSpecified())
-        .expect(OrderPriceRespectsTick(config_.price_tick));
+        .expect(OrderPriceRespectsTick(config_.price_tick))
+        .expect(DisplayQuantityWithinOrderQuantity())
+        .expect(DisplayQuantityRespectsTick(config_.quantity_tick));
   } else if (request.order_type == OrderType::Option::Market) {
-    validation.expect(OrderPriceAbsent());
+    validation.expect(OrderPriceAbsent()).expect(DisplayQuantityAbsent());
+  } else if (request.order_type == OrderType::Option::Stop) {
+    validation.expect(OrderPriceAbsent())
+        .expect(StopPriceSpecified())
+        .expect(StopPriceRespectsTick(config_.price_tick))
+        .expect(DisplayQuantityAbsent());
+  } else if (request.order_type == OrderType::Option::StopLimit) {
+    validation.expect(OrderPriceSpecified())
+        .expect(OrderPriceRespectsTick(config_.price_tick))
+        .expect(StopPriceSpecified())
+        .expect(StopPriceRespectsTick(config_.price_tick))
+        .expect(DisplayQuantityAbsent());
   }
 
   if (request.time_in_force == TimeInForce::Option::GoodTillDate) {
@@ -166,6 +201,7 @@ auto ClientRequestValidator::run(
       .expect(CumExecutedQuantityRespectsTick{config_.quantity_tick})
       .expect(CumExecutedQuantityIsLessThanTotalQuantity{})
       .expect(OrderPriceRespectsTick{config_.price_tick})
+      .expect(DisplayQuantityRespectsTick{config_.quantity_tick})
       .expect(OrderStatusSupported{})
       .expect(TimeInForceSupported{});
 
@@ -179,4 +215,26 @@ auto ClientRequestValidator::run(
   }
 }
 
-}  // namespace simulator::trading_system::matching_engine::order
\ No newline at end of file
+auto ClientRequestValidator::run(
+    Validation<market_state::StopOrder>& validation,
+    OrderBookSide order_book_side) const -> void {
+  validation.expect(OrderSideSupported{order_book_side})
+      .expect(TotalQuantityRespectsMinimum{config_.min_quantity})
+      .expect(TotalQuantityRespectsMaximum{config_.max_quantity})
+      .expect(TotalQuantityRespectsTick{config_.quantity_tick})
+      .expect(StopPriceRespectsTick{config_.price_tick})
+      .expect(OrderPriceRespectsTick{config_.price_tick})
+      .expect(OrderStatusSupported{})
+      .expect(TimeInForceSupported{});
+
+  const market_state::StopOrder& order = validation.request();
+  if (order.time_in_force == TimeInForce::Option::Day) {
+    validation.expect(DayOrderNotExpired());
+  }
+  if (order.time_in_force == TimeInForce::Option::GoodTillDate) {
+    validation.expect(OrderExpireInfoSpecified())
+        .expect(OrderNotExpired(config_.clock));
+  }
+}
+
+}  // namespace simulator::trading_system::matching_engine::order
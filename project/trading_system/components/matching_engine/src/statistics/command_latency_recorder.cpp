@@ -0,0 +1,91 @@
+#include "ih/statistics/command_latency_recorder.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace simulator::trading_system::matching_engine {
+namespace {
+
+auto command_name(CommandType command) -> std::string_view {
+  switch (command) {
+    case CommandType::PlaceOrder:
+      return "PlaceOrder";
+    case CommandType::AmendOrder:
+      return "AmendOrder";
+    case CommandType::CancelOrder:
+      return "CancelOrder";
+    case CommandType::MassCancelOrders:
+      return "MassCancelOrders";
+    case CommandType::MassQuote:
+      return "MassQuote";
+    case CommandType::ProcessSecurityStatusRequest:
+      return "ProcessSecurityStatusRequest";
+    case CommandType::ProcessMarketDataRequest:
+      return "ProcessMarketDataRequest";
+    case CommandType::CaptureInstrumentState:
+      return "CaptureInstrumentState";
+    case CommandType::StoreState:
+      return "StoreState";
+    case CommandType::RecoverState:
+      return "RecoverState";
+    case CommandType::NotifyClientDisconnected:
+      return "NotifyClientDisconnected";
+    case CommandType::Tick:
+      return "Tick";
+    case CommandType::PhaseTransition:
+      return "PhaseTransition";
+  }
+  return "Unknown";
+}
+
+auto stage_name(LatencyStage stage) -> std::string_view {
+  switch (stage) {
+    case LatencyStage::QueueWait:
+      return "QueueWait";
+    case LatencyStage::Execution:
+      return "Execution";
+    case LatencyStage::MarketData:
+      return "MarketData";
+    case LatencyStage::ReplyDispatch:
+      return "ReplyDispatch";
+  }
+  return "Unknown";
+}
+
+}  // namespace
+
+CommandLatencyRecorder::~CommandLatencyRecorder() noexcept {
+  for (auto& histogram : histograms_) {
+    delete histogram.load(std::memory_order_relaxed);
+  }
+}
+
+auto CommandLatencyRecorder::report(
+    std::vector<protocol::CommandLatency>& latencies) const -> void {
+  for (std::size_t index = 0; index < histograms_.size(); ++index) {
+    const auto* histogram = histograms_[index].load(std::memory_order_acquire);
+    if (histogram == nullptr) {
+      continue;
+    }
+
+    const auto summary = histogram->summarize();
+    if (summary.count == 0) {
+      continue;
+    }
+
+    const auto command = static_cast<CommandType>(index / StagesCount);
+    const auto stage = static_cast<LatencyStage>(index % StagesCount);
+    latencies.push_back(
+        protocol::CommandLatency{.command = std::string{command_name(command)},
+                                 .stage = std::string{stage_name(stage)},
+                                 .count = summary.count,
+                                 .mean = summary.mean,
+                                 .p50 = summary.p50,
+                                 .p90 = summary.p90,
+                                 .p99 = summary.p99,
+                                 .p999 = summary.p999,
+                                 .max = summary.max});
+  }
+}
+
+}  // namespace simulator::trading_system::matching_engine
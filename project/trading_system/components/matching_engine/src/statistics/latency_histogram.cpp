@@ -0,0 +1,55 @@
+#include "ih/statistics/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace simulator::trading_system::matching_engine {
+namespace {
+
+// Returns the number of samples a percentile rank in [0, 100] covers
+auto rank_count(std::uint64_t count, double rank) -> std::uint64_t {
+  const auto covered = std::ceil(static_cast<double>(count) * rank / 100.0);
+  return std::max(std::uint64_t{1}, static_cast<std::uint64_t>(covered));
+}
+
+}  // namespace
+
+auto LatencyHistogram::summarize() const -> Summary {
+  std::array<std::uint64_t, BucketsCount> counts{};
+  std::uint64_t count = 0;
+  for (std::size_t bucket = 0; bucket < BucketsCount; ++bucket) {
+    counts[bucket] = buckets_[bucket].load(std::memory_order_relaxed);
+    count += counts[bucket];
+  }
+
+  Summary summary;
+  if (count == 0) {
+    return summary;
+  }
+
+  const auto max = max_.load(std::memory_order_relaxed);
+  const auto percentile = [&](double rank) {
+    const auto target = rank_count(count, rank);
+    std::uint64_t covered = 0;
+    for (std::size_t bucket = 0; bucket < BucketsCount; ++bucket) {
+      covered += counts[bucket];
+      if (covered >= target) {
+        return std::chrono::nanoseconds{static_cast<std::int64_t>(
+            std::min(highest_equivalent(bucket), max))};
+      }
+    }
+    return std::chrono::nanoseconds{static_cast<std::int64_t>(max)};
+  };
+
+  summary.count = count;
+  summary.mean = std::chrono::nanoseconds{static_cast<std::int64_t>(
+      sum_.load(std::memory_order_relaxed) / count)};
+  summary.p50 = percentile(50);
+  summary.p90 = percentile(90);
+  summary.p99 = percentile(99);
+  summary.p999 = percentile(99.9);
+  summary.max = std::chrono::nanoseconds{static_cast<std::int64_t>(max)};
+  return summary;
+}
+
+}  // namespace simulator::trading_system::matching_engine
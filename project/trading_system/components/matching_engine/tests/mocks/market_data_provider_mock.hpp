@@ -0,0 +1,29 @@
+#ifndef SIMULATOR_MATCHING_ENGINE_TESTS_MOCKS_MARKET_DATA_PROVIDER_MOCK_HPP_
+#define SIMULATOR_MATCHING_ENGINE_TESTS_MOCKS_MARKET_DATA_PROVIDER_MOCK_HPP_
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "ih/market_data/cache/market_data_provider.hpp"
+
+namespace simulator::trading_system::matching_engine {
+
+struct MarketDataProviderMock : public mdata::MarketDataProvider {
+  MOCK_METHOD(std::vector<MarketDataEntry>,
+              compose_initial,
+              (const mdata::StreamingSettings&),
+              (const, override));
+
+  MOCK_METHOD(std::vector<MarketDataEntry>,
+              compose_update,
+              (const mdata::StreamingSettings&),
+              (const, override));
+
+  MOCK_METHOD(std::uint64_t, update_sequence, (), (const, override));
+};
+
+}  // namespace simulator::trading_system::matching_engine
+
+#endif  // SIMULATOR_MATCHING_ENGINE_TESTS_MOCKS_MARKET_DATA_PROVIDER_MOCK_HPP_
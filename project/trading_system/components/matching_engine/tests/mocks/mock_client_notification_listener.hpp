@@ -9,6 +9,7 @@
 #include "protocol/app/execution_report.hpp"
 #include "protocol/app/order_cancellation_confirmation.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_modification_confirmation.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_placement_confirmation.hpp"
@@ -27,6 +28,7 @@ class MockClientNotificationListener : public EventListener {
   MOCK_METHOD(void, on_modification_reject, (protocol::OrderModificationReject));
   MOCK_METHOD(void, on_cancellation_confirmation, (protocol::OrderCancellationConfirmation));
   MOCK_METHOD(void, on_cancellation_reject, (protocol::OrderCancellationReject));
+  MOCK_METHOD(void, on_mass_cancellation_report, (protocol::OrderMassCancellationReport));
   MOCK_METHOD(void, on_execution_report, (protocol::ExecutionReport));
   MOCK_METHOD(void, on_market_data_reject, (protocol::MarketDataReject));
   MOCK_METHOD(void, on_market_data_snapshot, (protocol::MarketDataSnapshot));
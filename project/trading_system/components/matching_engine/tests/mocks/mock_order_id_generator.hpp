@@ -10,6 +10,8 @@ namespace simulator::trading_system::matching_engine {
 class MockOrderIdGenerator : public order::OrderIdGenerator {
  public:
   MOCK_METHOD(OrderId, generate, (), (const));
+  MOCK_METHOD(OrderId, last_generated, (), (const, override));
+  MOCK_METHOD(void, resume_after, (OrderId), (override));
 
  private:
   auto operator()() -> OrderId override;
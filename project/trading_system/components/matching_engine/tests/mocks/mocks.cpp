@@ -31,6 +31,9 @@ auto MockClientNotificationListener::on(Event event) -> void {
       [this](protocol::OrderCancellationConfirmation message) {
         on_cancellation_confirmation(std::move(message));
       },
+      [this](protocol::OrderMassCancellationReport message) {
+        on_mass_cancellation_report(std::move(message));
+      },
       [this](protocol::ExecutionReport message) {
         on_execution_report(std::move(message));
       },
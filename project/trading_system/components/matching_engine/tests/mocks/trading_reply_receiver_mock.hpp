@@ -32,6 +32,7 @@ struct TradingReplyReceiverMock : public middleware::TradingReplyReceiver {
 
   MOCK_METHOD(void, process, (protocol::OrderCancellationReject), (override));
   MOCK_METHOD(void, process, (protocol::OrderCancellationConfirmation), (override));
+  MOCK_METHOD(void, process, (protocol::OrderMassCancellationReport), (override));
 
   MOCK_METHOD(void, process, (protocol::MarketDataReject), (override));
   MOCK_METHOD(void, process, (protocol::MarketDataSnapshot), (override));
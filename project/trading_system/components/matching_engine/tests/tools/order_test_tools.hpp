@@ -10,6 +10,7 @@
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/market_order.hpp"
 #include "ih/orders/book/order_metadata.hpp"
+#include "ih/orders/book/stop_order.hpp"
 #include "protocol/types/session.hpp"
 
 namespace simulator::trading_system::matching_engine {
@@ -26,6 +27,11 @@ class OrderBuilder {
 
   auto build_market_order() const -> MarketOrder;
 
+  auto build_stop_order() const -> StopOrder;
+
+  // Builds a stop order, which limit price is the order price
+  auto build_stop_limit_order() const -> StopOrder;
+
   auto with_order_id(OrderId identifier) -> OrderBuilder &;
 
   auto with_side(Side side) -> OrderBuilder &;
@@ -47,12 +53,19 @@ class OrderBuilder {
 
   auto with_order_quantity(OrderQuantity quantity) -> OrderBuilder &;
 
+  auto with_stop_price(StopPrice price) -> OrderBuilder &;
+
+  auto with_display_quantity(DisplayQuantity quantity) -> OrderBuilder &;
+
   auto with_expire_time(ExpireTime time) -> OrderBuilder &;
 
   auto with_expire_date(ExpireDate date) -> OrderBuilder &;
 
   auto with_order_time(OrderTime time) -> OrderBuilder &;
 
+  // Marks the order as placed by a mass quote entry
+  auto as_quote() -> OrderBuilder &;
+
  private:
   InstrumentDescriptor instrument_;
   protocol::Session session_{protocol::generator::Session{}};
@@ -62,11 +75,14 @@ class OrderBuilder {
   std::optional<ExpireTime> expire_time_;
   std::optional<ExpireDate> expire_date_;
   std::optional<ShortSaleExemptionReason> short_sale_exemption_reason_;
+  std::optional<DisplayQuantity> display_quantity_;
   OrderPrice price_{42};
+  StopPrice stop_price_{40};
   OrderQuantity quantity_{420};
   OrderId order_id_{4221};
   Side side_{Side::Option::Buy};
   TimeInForce time_in_force_{TimeInForce::Option::Day};
+  bool quote_{false};
 };
 
 // NOLINTEND(*-magic-numbers)
@@ -13,6 +13,7 @@ auto OrderBuilder::build_order_attributes() const -> OrderAttributes {
   OrderAttributes attributes;
   attributes.set_order_parties(parties_);
   attributes.set_time_in_force(time_in_force_);
+  attributes.set_quote(quote_);
   if (client_order_id_) {
     attributes.set_client_order_id(*client_order_id_);
   }
@@ -39,6 +40,10 @@ auto OrderBuilder::build_order_record() const -> OrderRecord {
 }
 
 auto OrderBuilder::build_limit_order() const -> LimitOrder {
+  if (display_quantity_.has_value()) {
+    return LimitOrder{
+        price_, quantity_, *display_quantity_, build_order_record()};
+  }
   return LimitOrder{price_, quantity_, build_order_record()};
 }
 
@@ -46,6 +51,14 @@ auto OrderBuilder::build_market_order() const -> MarketOrder {
   return MarketOrder{quantity_, build_order_record()};
 }
 
+auto OrderBuilder::build_stop_order() const -> StopOrder {
+  return StopOrder{stop_price_, std::nullopt, quantity_, build_order_record()};
+}
+
+auto OrderBuilder::build_stop_limit_order() const -> StopOrder {
+  return StopOrder{stop_price_, price_, quantity_, build_order_record()};
+}
+
 auto OrderBuilder::with_order_id(OrderId identifier) -> OrderBuilder& {
   order_id_ = identifier;
   return *this;
@@ -103,6 +116,17 @@ auto OrderBuilder::with_order_quantity(OrderQuantity quantity)
   return *this;
 }
 
+auto OrderBuilder::with_stop_price(StopPrice price) -> OrderBuilder& {
+  stop_price_ = price;
+  return *this;
+}
+
+auto OrderBuilder::with_display_quantity(DisplayQuantity quantity)
+    -> OrderBuilder& {
+  display_quantity_ = quantity;
+  return *this;
+}
+
 auto OrderBuilder::with_expire_time(ExpireTime time) -> OrderBuilder& {
   expire_time_ = time;
   return *this;
@@ -118,6 +142,11 @@ auto OrderBuilder::with_order_time(OrderTime time) -> OrderBuilder& {
   return *this;
 }
 
+auto OrderBuilder::as_quote() -> OrderBuilder& {
+  quote_ = true;
+  return *this;
+}
+
 // NOLINTEND(*magic-numbers*)
 
 }  // namespace simulator::trading_system::matching_engine
\ No newline at end of file
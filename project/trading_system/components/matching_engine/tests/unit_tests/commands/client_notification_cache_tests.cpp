@@ -0,0 +1,103 @@
+#include <gmock/gmock.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "ih/commands/client_notification_cache.hpp"
+#include "middleware/channels/trading_reply_channel.hpp"
+#include "tests/mocks/trading_reply_receiver_mock.hpp"
+#include "tests/tools/protocol_test_tools.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+struct MatchingEngineClientNotificationCache : public Test {
+  auto SetUp() -> void override {
+    std::shared_ptr<middleware::TradingReplyReceiver> receiver_pointer{
+        std::addressof(trading_reply_receiver), [](auto* /*pointer*/) {}};
+    middleware::bind_trading_reply_channel(receiver_pointer);
+  }
+
+  auto TearDown() -> void override {
+    middleware::release_trading_reply_channel();
+  }
+
+  static auto make_report(std::string client_order_id)
+      -> protocol::ExecutionReport {
+    auto report = make_message<protocol::ExecutionReport>();
+    report.client_order_id = ClientOrderId{std::move(client_order_id)};
+    return report;
+  }
+
+  static auto has_client_order_id(const std::string& client_order_id) {
+    return MatcherCast<protocol::ExecutionReport>(
+        Field(&protocol::ExecutionReport::client_order_id,
+              Optional(Eq(ClientOrderId{client_order_id}))));
+  }
+
+  StrictMock<TradingReplyReceiverMock> trading_reply_receiver;
+  ClientNotificationCache cache;
+};
+
+TEST_F(MatchingEngineClientNotificationCache, PublishesRepliesInOrder) {
+  cache.add(ClientNotification{make_report("first")});
+  cache.add(ClientNotification{make_report("second")});
+
+  InSequence sequence;
+  EXPECT_CALL(trading_reply_receiver, process(has_client_order_id("first")));
+  EXPECT_CALL(trading_reply_receiver, process(has_client_order_id("second")));
+
+  cache.collect().publish();
+}
+
+TEST_F(MatchingEngineClientNotificationCache, DoesNotPublishRepliesTwice) {
+  cache.add(ClientNotification{make_report("first")});
+  EXPECT_CALL(trading_reply_receiver, process(has_client_order_id("first")));
+  cache.collect().publish();
+
+  cache.add(ClientNotification{make_report("second")});
+  EXPECT_CALL(trading_reply_receiver, process(has_client_order_id("second")));
+  cache.collect().publish();
+}
+
+TEST_F(MatchingEngineClientNotificationCache, DoesNotPublishDiscardedReplies) {
+  cache.add(ClientNotification{make_report("discarded")});
+  cache.collect().discard();
+
+  cache.add(ClientNotification{make_report("published")});
+  EXPECT_CALL(trading_reply_receiver,
+              process(has_client_order_id("published")));
+  cache.collect().publish();
+}
+
+TEST_F(MatchingEngineClientNotificationCache, PublishesNothingWhenEmpty) {
+  cache.collect().publish();
+}
+
+TEST_F(MatchingEngineClientNotificationCache, PreallocatesRepliesStorage) {
+  ASSERT_GE(cache.capacity(), ClientNotificationCache::InitialCapacity);
+}
+
+TEST_F(MatchingEngineClientNotificationCache, ReusesRepliesStorage) {
+  EXPECT_CALL(trading_reply_receiver,
+              process(A<protocol::ExecutionReport>()))
+      .Times(AnyNumber());
+
+  const auto initial_capacity = cache.capacity();
+  for (std::size_t i = 0; i < ClientNotificationCache::InitialCapacity; ++i) {
+    cache.add(ClientNotification{make_report("order")});
+  }
+  cache.collect().publish();
+
+  cache.add(ClientNotification{make_report("order")});
+  cache.collect().publish();
+
+  ASSERT_EQ(cache.capacity(), initial_capacity);
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
@@ -56,6 +56,27 @@ TEST(MatchingEngineLastTradeRecoverFormatting, FmtFormatting) {
       R"("market_phase": { TradingPhase=Open, TradingStatus=Resume } } } })");
 }
 
+TEST(MatchingEngineTradeHistoryRecoverFormatting, FmtFormatting) {
+  using namespace std::chrono_literals;
+
+  const TradeHistoryRecover event{
+      {Trade{BuyerId{"buyer_id"},
+             SellerId{"seller_id"},
+             Price{3.14},
+             Quantity{42.3},
+             AggressorSide{Side::Option::Buy},
+             core::sys_us{core::sys_days{2025y / 12 / 31} + 13h + 30min + 59s +
+                          123456us},
+             MarketPhase::open()}}};
+
+  ASSERT_EQ(
+      fmt::to_string(event),
+      R"({ "TradeHistoryRecover": { "trades": [{ "buyer": "buyer_id", )"
+      R"("seller": "seller_id", "trade_price": 3.14, "traded_quantity": 42.3, )"
+      R"("aggressor_side": "Buy", "trade_time": "2025-12-31 13:30:59.123456", )"
+      R"("market_phase": { TradingPhase=Open, TradingStatus=Resume } }] } })");
+}
+
 TEST(MatchingEngineInstrumentInfoRecoverFormatting, FmtFormatting) {
   using namespace std::chrono_literals;
 
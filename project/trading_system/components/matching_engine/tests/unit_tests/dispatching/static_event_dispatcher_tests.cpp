@@ -0,0 +1,70 @@
+#include <gmock/gmock.h>
+
+#include <utility>
+
+#include "ih/common/events/client_notification.hpp"
+#include "ih/common/events/event.hpp"
+#include "ih/common/events/order_book_notification.hpp"
+#include "ih/dispatching/static_event_dispatcher.hpp"
+#include "protocol/app/order_placement_confirmation.hpp"
+#include "protocol/types/session.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+using namespace ::testing;  // NOLINT
+
+struct ClientNotificationHandlerMock {
+  MOCK_METHOD(void, handle, (ClientNotification));
+};
+
+struct OrderBookNotificationHandlerMock {
+  MOCK_METHOD(void, handle, (OrderBookNotification));
+};
+
+struct StaticEventDispatcher : public ::testing::Test {
+  static auto make_client_notification() -> ClientNotification {
+    return ClientNotification(protocol::OrderPlacementConfirmation{
+        protocol::Session{protocol::generator::Session{}}});
+  }
+
+  static auto make_order_book_notification() -> OrderBookNotification {
+    return OrderBookNotification{OrderRemoved{.order_price = Price(100),
+                                              .order_id = OrderId(1),
+                                              .order_side = Side::Option::Buy}};
+  }
+
+  template <typename EventType>
+  auto emit(EventType&& event) -> void {
+    static_cast<EventListener&>(dispatcher)
+        .on(Event(std::forward<EventType>(event)));
+  }
+
+  StrictMock<ClientNotificationHandlerMock> client_handler;
+  StrictMock<OrderBookNotificationHandlerMock> order_book_handler;
+  matching_engine::StaticEventDispatcher<ClientNotificationHandlerMock,
+                                         OrderBookNotificationHandlerMock>
+      dispatcher{client_handler, order_book_handler};
+};
+
+TEST_F(StaticEventDispatcher, DispatchesClientNotificationToItsHandler) {
+  EXPECT_CALL(client_handler, handle).Times(1);
+
+  emit(make_client_notification());
+}
+
+TEST_F(StaticEventDispatcher, DispatchesOrderBookNotificationToItsHandler) {
+  EXPECT_CALL(order_book_handler,
+              handle(Field(&OrderBookNotification::value,
+                           VariantWith<OrderRemoved>(_))))
+      .Times(1);
+
+  emit(make_order_book_notification());
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
@@ -37,6 +37,19 @@ TEST_F(MatchingEngineMarketDataRecover, EmitsLastTradeRecoverOnRecoverTrade) {
   recover(trade);
 }
 
+TEST_F(MatchingEngineMarketDataRecover,
+       EmitsTradeHistoryRecoverOnRecoverRecentTrades) {
+  std::vector<Trade> trades{NewTrade{}.with_trade_price(Price{42}).create()};
+
+  EXPECT_CALL(event_listener,
+              on(IsOrderBookNotification(VariantWith<TradeHistoryRecover>(
+                  Field(&TradeHistoryRecover::trades,
+                        ElementsAre(Field(&Trade::trade_price,
+                                          Eq(Price{42})))))))));
+
+  recover(std::move(trades));
+}
+
 TEST_F(MatchingEngineMarketDataRecover,
        EmitsInstrumentInfoRecoverOnRecoverNulloptIntrumentInfo) {
   EXPECT_CALL(event_listener,
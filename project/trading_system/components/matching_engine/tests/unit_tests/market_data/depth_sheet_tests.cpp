@@ -189,6 +189,169 @@ TEST_F(DepthSheetTest, OfferSheetKeepsLevelsSotedByOfferPriceCriteria) {
                           Property(&DepthLevel::price, Eq(Price(200)))));
 }
 
+TEST_F(DepthSheetTest, HasNoStatsWhenCreated) {
+  EXPECT_THAT(sheet.levels_count(), Eq(0U));
+  EXPECT_THAT(sheet.tob_price(), Eq(std::nullopt));
+  EXPECT_THAT(sheet.tob_quantity(), Eq(std::nullopt));
+}
+
+TEST_F(DepthSheetTest, CountsVisibleLevels) {
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(100))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(3))
+                  .with_order_price(Price(101))
+                  .create());
+
+  ASSERT_THAT(sheet.levels_count(), Eq(2U));
+}
+
+TEST_F(DepthSheetTest, DoesNotCountEmptiedLevel) {
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(101))
+                  .create());
+
+  sheet.apply(NewOrderRemoved::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+
+  ASSERT_THAT(sheet.levels_count(), Eq(1U));
+}
+
+TEST_F(DepthSheetTest, CountsRefilledLevelOnce) {
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+  sheet.apply(NewOrderRemoved::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(100))
+                  .create());
+
+  ASSERT_THAT(sheet.levels_count(), Eq(1U));
+}
+
+TEST_F(DepthSheetTest, KeepsLevelsCountWhileFolding) {
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(101))
+                  .create());
+  sheet.apply(NewOrderRemoved::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(101))
+                  .create());
+
+  sheet.fold();
+
+  ASSERT_THAT(sheet.levels_count(), Eq(1U));
+}
+
+TEST_F(DepthSheetTest, ReportsBestPriceAndQuantityAsTopOfBook) {
+  sheet = DepthSheet::create_bid_sheet(idgen);
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .with_order_quantity(Quantity(10))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(101))
+                  .with_order_quantity(Quantity(20))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(3))
+                  .with_order_price(Price(101))
+                  .with_order_quantity(Quantity(30))
+                  .create());
+
+  EXPECT_THAT(sheet.tob_price(), Optional(Eq(Price(101))));
+  EXPECT_THAT(sheet.tob_quantity(), Optional(Eq(Quantity(50))));
+}
+
+TEST_F(DepthSheetTest, UpdatesTopOfBookQuantityWhenTopLevelReduced) {
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .with_order_quantity(Quantity(20))
+                  .create());
+
+  sheet.apply(NewOrderReduced::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .with_order_quantity(Quantity(5))
+                  .create());
+
+  EXPECT_THAT(sheet.tob_price(), Optional(Eq(Price(100))));
+  EXPECT_THAT(sheet.tob_quantity(), Optional(Eq(Quantity(5))));
+}
+
+TEST_F(DepthSheetTest, MovesTopOfBookToNextVisibleLevelWhenTopLevelEmptied) {
+  sheet = DepthSheet::create_offer_sheet(idgen);
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(102))
+                  .with_order_quantity(Quantity(10))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(101))
+                  .with_order_quantity(Quantity(20))
+                  .create());
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(3))
+                  .with_order_price(Price(100))
+                  .with_order_quantity(Quantity(30))
+                  .create());
+
+  sheet.apply(NewOrderRemoved::init()
+                  .with_order_id(OrderId(2))
+                  .with_order_price(Price(101))
+                  .create());
+  sheet.apply(NewOrderRemoved::init()
+                  .with_order_id(OrderId(3))
+                  .with_order_price(Price(100))
+                  .create());
+
+  EXPECT_THAT(sheet.tob_price(), Optional(Eq(Price(102))));
+  EXPECT_THAT(sheet.tob_quantity(), Optional(Eq(Quantity(10))));
+}
+
+TEST_F(DepthSheetTest, HasNoTopOfBookWhenAllLevelsEmptied) {
+  sheet.apply(NewOrderAdded::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+
+  sheet.apply(NewOrderRemoved::init()
+                  .with_order_id(OrderId(1))
+                  .with_order_price(Price(100))
+                  .create());
+
+  EXPECT_THAT(sheet.tob_price(), Eq(std::nullopt));
+  EXPECT_THAT(sheet.tob_quantity(), Eq(std::nullopt));
+}
+
 // NOLINTEND(*magic-number*)
 
 }  // namespace simulator::trading_system::matching_engine::mdata
\ No newline at end of file
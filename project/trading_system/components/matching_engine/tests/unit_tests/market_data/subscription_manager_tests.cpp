@@ -0,0 +1,180 @@
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include "ih/market_data/subscriptions/subscription_manager.hpp"
+#include "tests/mocks/event_listener_mock.hpp"
+#include "tests/mocks/market_data_provider_mock.hpp"
+#include "tests/tools/matchers.hpp"
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+namespace simulator::trading_system::matching_engine::mdata::tests {
+namespace {
+
+struct SubscriptionManager : Test {
+  static auto make_session(const std::string& sender) -> protocol::Session {
+    return protocol::Session{
+        protocol::fix::Session{protocol::fix::BeginString{"FIXT1.1"},
+                               protocol::fix::SenderCompId{sender},
+                               protocol::fix::TargetCompId{"SIMULATOR"}}};
+  }
+
+  static auto make_request(const protocol::Session& session,
+                           const std::string& request_id,
+                           MdSubscriptionRequestType type)
+      -> protocol::MarketDataRequest {
+    protocol::MarketDataRequest request{session};
+    request.request_id = MdRequestId{request_id};
+    request.request_type = type;
+    request.instruments.emplace_back();
+    request.market_data_types.emplace_back(MdEntryType::Option::Bid);
+    return request;
+  }
+
+  auto subscribe(const protocol::Session& session,
+                 const std::string& request_id) -> void {
+    manager.process(make_request(
+        session, request_id, MdSubscriptionRequestType::Option::Subscribe));
+  }
+
+  auto unsubscribe(const protocol::Session& session,
+                   const std::string& request_id) -> void {
+    manager.process(make_request(
+        session, request_id, MdSubscriptionRequestType::Option::Unsubscribe));
+  }
+
+  const protocol::Session first_session = make_session("FIRST");
+  const protocol::Session second_session = make_session("SECOND");
+
+  NiceMock<EventListenerMock> listener;
+  NiceMock<MarketDataProviderMock> provider;
+  mdata::SubscriptionManager manager{Configuration{}, listener, provider};
+
+ private:
+  auto SetUp() -> void override {
+    ON_CALL(provider, compose_update)
+        .WillByDefault(Return(std::vector{MarketDataEntry{}}));
+  }
+};
+
+MATCHER_P2(IsUpdateFor, session, request_id, "") {
+  return ExplainMatchResult(
+      IsClientNotification(VariantWith<protocol::MarketDataUpdate>(
+          AllOf(Field(&protocol::MarketDataUpdate::session, Eq(session)),
+                Field(&protocol::MarketDataUpdate::request_id,
+                      Optional(Eq(MdRequestId{request_id})))))),
+      arg,
+      result_listener);
+}
+
+MATCHER_P(IsRejectWithReason, reason, "") {
+  return ExplainMatchResult(
+      IsClientNotification(VariantWith<protocol::MarketDataReject>(
+          Field(&protocol::MarketDataReject::reject_reason,
+                Optional(Eq(reason))))),
+      arg,
+      result_listener);
+}
+
+MATCHER(IsReject, "") {
+  return ExplainMatchResult(
+      IsClientNotification(VariantWith<protocol::MarketDataReject>(_)),
+      arg,
+      result_listener);
+}
+
+TEST_F(SubscriptionManager, RejectsDuplicateRequestIdOfSameSession) {
+  subscribe(first_session, "request");
+
+  EXPECT_CALL(listener,
+              on(IsRejectWithReason(MdRejectReason::Option::DuplicateMdReqId)));
+
+  subscribe(first_session, "request");
+}
+
+TEST_F(SubscriptionManager, AcceptsSameRequestIdOfDifferentSessions) {
+  subscribe(first_session, "request");
+
+  EXPECT_CALL(listener, on(IsReject())).Times(0);
+
+  subscribe(second_session, "request");
+}
+
+TEST_F(SubscriptionManager, RejectsUnsubscriptionOfUnknownRequestId) {
+  subscribe(first_session, "request");
+
+  EXPECT_CALL(listener, on(IsReject()));
+
+  unsubscribe(second_session, "request");
+}
+
+TEST_F(SubscriptionManager, StopsPublishingToUnsubscribedRequest) {
+  subscribe(first_session, "first");
+  subscribe(first_session, "second");
+  subscribe(first_session, "third");
+  unsubscribe(first_session, "first");
+
+  EXPECT_CALL(listener, on(IsUpdateFor(first_session, "first"))).Times(0);
+  EXPECT_CALL(listener, on(IsUpdateFor(first_session, "second")));
+  EXPECT_CALL(listener, on(IsUpdateFor(first_session, "third")));
+
+  manager.publish();
+}
+
+TEST_F(SubscriptionManager, RemovesAllSubscriptionsOfDisconnectedSession) {
+  subscribe(first_session, "first");
+  subscribe(second_session, "second");
+  subscribe(first_session, "third");
+  subscribe(second_session, "fourth");
+  manager.unsubscribe(first_session);
+
+  EXPECT_CALL(listener, on(IsUpdateFor(first_session, "first"))).Times(0);
+  EXPECT_CALL(listener, on(IsUpdateFor(first_session, "third"))).Times(0);
+  EXPECT_CALL(listener, on(IsUpdateFor(second_session, "second")));
+  EXPECT_CALL(listener, on(IsUpdateFor(second_session, "fourth")));
+
+  manager.publish();
+}
+
+TEST_F(SubscriptionManager, SendsInitialSnapshotWithLastUpdateSequence) {
+  ON_CALL(provider, update_sequence).WillByDefault(Return(41));
+
+  EXPECT_CALL(listener,
+              on(IsClientNotification(VariantWith<protocol::MarketDataSnapshot>(
+                  Field(&protocol::MarketDataSnapshot::update_sequence,
+                        Optional(Eq(SeqNum{41})))))));
+
+  subscribe(first_session, "request");
+}
+
+TEST_F(SubscriptionManager, PublishesUpdatesWithListingUpdateSequence) {
+  subscribe(first_session, "first");
+  subscribe(second_session, "second");
+  ON_CALL(provider, update_sequence).WillByDefault(Return(42));
+
+  EXPECT_CALL(listener,
+              on(IsClientNotification(VariantWith<protocol::MarketDataUpdate>(
+                  Field(&protocol::MarketDataUpdate::update_sequence,
+                        Optional(Eq(SeqNum{42})))))))
+      .Times(2);
+
+  manager.publish();
+}
+
+TEST_F(SubscriptionManager, AllowsToResubscribeAfterDisconnection) {
+  subscribe(first_session, "request");
+  manager.unsubscribe(first_session);
+
+  EXPECT_CALL(listener, on(IsReject())).Times(0);
+
+  subscribe(first_session, "request");
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::mdata::tests
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
@@ -132,6 +132,43 @@ TEST_F(TradeCache, ReportsOnlyLastTradeInInitial) {
   ASSERT_THAT(entries, ElementsAre(EntryHas(Price{400.}, Quantity{1000.})));
 }
 
+TEST_F(TradeCache, ReportsRecentTradesInInitialUpToHistoryDepth) {
+  cache.configure({.history_depth = 2});
+  cache.update(make_update(make_test_trade(Price{50.}, Quantity{150.}),
+                           make_test_trade(Price{100.}, Quantity{200.}),
+                           make_test_trade(Price{400.}, Quantity{1000.})));
+
+  cache.compose_initial(settings, entries);
+
+  ASSERT_THAT(entries,
+              ElementsAre(EntryHas(Price{100.}, Quantity{200.}),
+                          EntryHas(Price{400.}, Quantity{1000.})));
+}
+
+TEST_F(TradeCache, KeepsRecentTradesOfPreviousUpdatesInInitial) {
+  cache.configure({.history_depth = 3});
+  cache.update(make_update(make_test_trade(Price{50.}, Quantity{150.})));
+  cache.update(make_update(make_test_trade(Price{100.}, Quantity{200.}),
+                           make_test_trade(Price{400.}, Quantity{1000.})));
+
+  cache.compose_initial(settings, entries);
+
+  ASSERT_THAT(entries,
+              ElementsAre(EntryHas(Price{50.}, Quantity{150.}),
+                          EntryHas(Price{100.}, Quantity{200.}),
+                          EntryHas(Price{400.}, Quantity{1000.})));
+}
+
+TEST_F(TradeCache, ReportsLastTradeInInitialWhenHistoryDepthIsZero) {
+  cache.configure({.history_depth = 0});
+  cache.update(make_update(make_test_trade(Price{50.}, Quantity{150.}),
+                           make_test_trade(Price{100.}, Quantity{200.})));
+
+  cache.compose_initial(settings, entries);
+
+  ASSERT_THAT(entries, ElementsAre(EntryHas(Price{100.}, Quantity{200.})));
+}
+
 TEST_F(TradeCache, ReportsAllTradesInFullUpdate) {
   cache.update(make_update(make_test_trade(Price{50.}, Quantity{150.}),
                            make_test_trade(Price{100.}, Quantity{200.}),
@@ -213,7 +250,8 @@ TEST_F(TradeCache, DoesNotReportTradeAggressorSideInInitialWhenDisabled) {
 
 TEST_F(TradeCache, StoresNullLastTradeIfNotUpdated) {
   std::optional<Trade> last_trade;
-  cache.store_state(last_trade);
+  std::optional<std::vector<Trade>> recent_trades;
+  cache.store_state(last_trade, recent_trades);
 
   ASSERT_EQ(last_trade, std::nullopt);
 }
@@ -224,12 +262,28 @@ TEST_F(TradeCache, StoresLastTrade) {
                            make_test_trade(Price{400.}, Quantity{1000.})));
 
   std::optional<Trade> last_trade;
-  cache.store_state(last_trade);
+  std::optional<std::vector<Trade>> recent_trades;
+  cache.store_state(last_trade, recent_trades);
 
   ASSERT_NE(last_trade, std::nullopt);
   ASSERT_EQ(last_trade->trade_price, Price{400.});
 }
 
+TEST_F(TradeCache, StoresRecentTradesFromOldestToLast) {
+  cache.configure({.history_depth = 2});
+  cache.update(make_update(make_test_trade(Price{50.}, Quantity{150.}),
+                           make_test_trade(Price{100.}, Quantity{200.}),
+                           make_test_trade(Price{400.}, Quantity{1000.})));
+
+  std::optional<Trade> last_trade;
+  std::optional<std::vector<Trade>> recent_trades;
+  cache.store_state(last_trade, recent_trades);
+
+  ASSERT_THAT(recent_trades,
+              Optional(ElementsAre(Field(&Trade::trade_price, Price{100.}),
+                                   Field(&Trade::trade_price, Price{400.}))));
+}
+
 TEST_F(TradeCache, RemovesPreviousTradesOnLastTradeRecoverInInitial) {
   cache.update(make_update(make_test_trade(Price{50.}, Quantity{150.}),
                            LastTradeRecover{}));
@@ -270,6 +324,31 @@ TEST_F(TradeCache, RecoversTradeFromLastTradeRecoverIfItIsPresent) {
   ASSERT_THAT(entries, ElementsAre(EntryHas(Price{100.}, Quantity{200.})));
 }
 
+TEST_F(TradeCache, RecoversInInitialTradesFromTradeHistoryRecover) {
+  cache.configure({.history_depth = 2});
+  cache.update(make_update(
+      make_test_trade(Price{50.}, Quantity{150.}),
+      LastTradeRecover{.trade = make_test_trade(Price{400.}, Quantity{1000.})},
+      TradeHistoryRecover{
+          .trades = {make_test_trade(Price{100.}, Quantity{200.}),
+                     make_test_trade(Price{400.}, Quantity{1000.})}}));
+
+  cache.compose_initial(settings, entries);
+
+  ASSERT_THAT(entries,
+              ElementsAre(EntryHas(Price{100.}, Quantity{200.}),
+                          EntryHas(Price{400.}, Quantity{1000.})));
+}
+
+TEST_F(TradeCache, DoesNotReportRecoveredTradeHistoryInUpdate) {
+  cache.update(make_update(TradeHistoryRecover{
+      .trades = {make_test_trade(Price{100.}, Quantity{200.})}}));
+
+  cache.compose_update(settings, entries);
+
+  ASSERT_THAT(entries, IsEmpty());
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::matching_engine::mdata::tests
 
@@ -0,0 +1,118 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include "ih/market_data/cache/trade_history.hpp"
+#include "tools/order_book_notification_builder.hpp"
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+namespace simulator::trading_system::matching_engine::mdata::tests {
+namespace {
+
+struct TradeHistory : Test {
+  static auto make_trade(const Price price) -> Trade {
+    return NewTrade().with_trade_price(price).create();
+  }
+
+  static auto stored(const mdata::TradeHistory& history) -> std::vector<Trade> {
+    std::vector<Trade> trades;
+    history.store(trades);
+    return trades;
+  }
+
+  static auto HasPrice(const Price price) {
+    return Field(&Trade::trade_price, Eq(price));
+  }
+};
+
+TEST_F(TradeHistory, IsEmptyInitially) {
+  const mdata::TradeHistory history{3};
+
+  ASSERT_TRUE(history.empty());
+  ASSERT_EQ(history.size(), 0);
+  ASSERT_EQ(history.capacity(), 3);
+}
+
+TEST_F(TradeHistory, KeepsTradesBelowCapacity) {
+  mdata::TradeHistory history{3};
+
+  history.push(make_trade(Price{1.}));
+  history.push(make_trade(Price{2.}));
+
+  ASSERT_EQ(history.size(), 2);
+  ASSERT_THAT(history.last(), HasPrice(Price{2.}));
+  ASSERT_THAT(stored(history),
+              ElementsAre(HasPrice(Price{1.}), HasPrice(Price{2.})));
+}
+
+TEST_F(TradeHistory, OverwritesOldestTradeWhenFull) {
+  mdata::TradeHistory history{2};
+
+  history.push(make_trade(Price{1.}));
+  history.push(make_trade(Price{2.}));
+  history.push(make_trade(Price{3.}));
+  history.push(make_trade(Price{4.}));
+  history.push(make_trade(Price{5.}));
+
+  ASSERT_EQ(history.size(), 2);
+  ASSERT_THAT(history.last(), HasPrice(Price{5.}));
+  ASSERT_THAT(stored(history),
+              ElementsAre(HasPrice(Price{4.}), HasPrice(Price{5.})));
+}
+
+TEST_F(TradeHistory, IgnoresTradesWhenCapacityIsZero) {
+  mdata::TradeHistory history{0};
+
+  history.push(make_trade(Price{1.}));
+
+  ASSERT_TRUE(history.empty());
+}
+
+TEST_F(TradeHistory, KeepsMostRecentTradesWhenCapacityShrinks) {
+  mdata::TradeHistory history{3};
+  history.push(make_trade(Price{1.}));
+  history.push(make_trade(Price{2.}));
+  history.push(make_trade(Price{3.}));
+  history.push(make_trade(Price{4.}));
+
+  history.set_capacity(2);
+
+  ASSERT_EQ(history.capacity(), 2);
+  ASSERT_THAT(stored(history),
+              ElementsAre(HasPrice(Price{3.}), HasPrice(Price{4.})));
+}
+
+TEST_F(TradeHistory, KeepsTradesOrderWhenCapacityGrows) {
+  mdata::TradeHistory history{2};
+  history.push(make_trade(Price{1.}));
+  history.push(make_trade(Price{2.}));
+  history.push(make_trade(Price{3.}));
+
+  history.set_capacity(3);
+  history.push(make_trade(Price{4.}));
+
+  ASSERT_THAT(stored(history),
+              ElementsAre(HasPrice(Price{2.}),
+                          HasPrice(Price{3.}),
+                          HasPrice(Price{4.})));
+}
+
+TEST_F(TradeHistory, RemovesAllTradesOnClear) {
+  mdata::TradeHistory history{2};
+  history.push(make_trade(Price{1.}));
+  history.push(make_trade(Price{2.}));
+  history.push(make_trade(Price{3.}));
+
+  history.clear();
+  history.push(make_trade(Price{4.}));
+
+  ASSERT_THAT(stored(history), ElementsAre(HasPrice(Price{4.})));
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::mdata::tests
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
@@ -0,0 +1,107 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "common/instrument.hpp"
+#include "common/tick_scheduler.hpp"
+#include "core/tools/time.hpp"
+#include "matching_engine/configuration.hpp"
+#include "matching_engine/matching_engine.hpp"
+#include "middleware/channels/trading_reply_channel.hpp"
+#include "runtime/service.hpp"
+#include "tests/mocks/trading_reply_receiver_mock.hpp"
+#include "tests/tools/protocol_test_tools.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+class InlineService final : public runtime::Service {
+ public:
+  auto execute(std::function<void()> task) -> void override { task(); }
+};
+
+class IgnoringTickScheduler final : public TickScheduler {
+ public:
+  auto schedule(InstrumentId /*instrument_id*/, TickDeadline /*deadline*/)
+      -> void override {}
+
+  auto reschedule(InstrumentId /*instrument_id*/,
+                  std::optional<TickDeadline> /*deadline*/) -> void override {}
+};
+
+struct MatchingEngineReplay : public Test {
+  auto SetUp() -> void override {
+    std::shared_ptr<middleware::TradingReplyReceiver> receiver_pointer{
+        std::addressof(trading_reply_receiver), [](auto* /*pointer*/) {}};
+    middleware::bind_trading_reply_channel(receiver_pointer);
+  }
+
+  auto TearDown() -> void override {
+    middleware::release_trading_reply_channel();
+  }
+
+  static auto make_instrument() -> Instrument {
+    Instrument instrument;
+    instrument.symbol = Symbol{"AAPL"};
+    return instrument;
+  }
+
+  // Cancels an unknown order, which is rejected in any phase
+  static auto make_cancellation() -> protocol::OrderCancellationRequest {
+    auto request = make_message<protocol::OrderCancellationRequest>();
+    request.client_order_id = ClientOrderId{"Cancel-1"};
+    request.orig_client_order_id = OrigClientOrderId{"Order-1"};
+    request.side = Side::Option::Buy;
+    return request;
+  }
+
+  static auto make_placement() -> protocol::OrderPlacementRequest {
+    auto request = make_message<protocol::OrderPlacementRequest>();
+    request.client_order_id = ClientOrderId{"Order-1"};
+    request.order_type = OrderType::Option::Limit;
+    request.time_in_force = TimeInForce::Option::Day;
+    request.side = Side::Option::Buy;
+    request.order_price = OrderPrice{100};
+    request.order_quantity = OrderQuantity{10};
+    return request;
+  }
+
+  const core::sys_us journaled_at{std::chrono::seconds{1726673575}};
+  StrictMock<TradingReplyReceiverMock> trading_reply_receiver;
+  const Configuration configuration;
+  InlineService service;
+  IgnoringTickScheduler tick_scheduler;
+  MatchingEngine engine{
+      make_instrument(), configuration, service, tick_scheduler};
+};
+
+// The strict receiver mock fails the test on any reply sent
+TEST_F(MatchingEngineReplay, DoesNotEmitClientNotificationsOfReplayedCommands) {
+  engine.replay_at(journaled_at);
+  engine.execute(make_placement());
+  engine.execute(make_cancellation());
+  engine.handle(event::Tick{.sys_tick_time = journaled_at});
+  engine.finish_replay();
+}
+
+TEST_F(MatchingEngineReplay, EmitsClientNotificationsOnceReplayIsFinished) {
+  engine.replay_at(journaled_at);
+  engine.finish_replay();
+
+  EXPECT_CALL(trading_reply_receiver,
+              process(A<protocol::OrderCancellationReject>()));
+
+  engine.execute(make_cancellation());
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
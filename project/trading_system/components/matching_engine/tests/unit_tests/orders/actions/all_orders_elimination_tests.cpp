@@ -74,5 +74,17 @@ TEST_F(MatchingEngineAllOrdersElimination,
   eliminator(order_book);
 }
 
+TEST_F(MatchingEngineAllOrdersElimination, DeletesStopOrders) {
+  order_book.buy_page().stop_orders().emplace(
+      builder.with_side(Side{Side::Option::Buy}).build_stop_order());
+  order_book.sell_page().stop_orders().emplace(
+      builder.with_side(Side{Side::Option::Sell}).build_stop_order());
+
+  eliminator(order_book);
+
+  ASSERT_TRUE(order_book.buy_page().stop_orders().empty());
+  ASSERT_TRUE(order_book.sell_page().stop_orders().empty());
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::matching_engine::order::test
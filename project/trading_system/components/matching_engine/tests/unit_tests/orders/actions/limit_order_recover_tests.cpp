@@ -107,6 +107,24 @@ TEST_F(MatchingEngineLimitOrderRecover, RecoversOrderParties) {
                                             ElementsAre(party)))));
 }
 
+TEST_F(MatchingEngineLimitOrderRecover, RecoversQuoteMark) {
+  market_state_order.quote = true;
+
+  recover(std::move(market_state_order));
+  ASSERT_THAT(order_book.buy_page().limit_orders(),
+              ElementsAre(Property(
+                  &LimitOrder::attributes,
+                  Property(&OrderAttributes::quote, IsTrue()))));
+}
+
+TEST_F(MatchingEngineLimitOrderRecover, RecoversRegularOrderWithoutQuoteMark) {
+  recover(std::move(market_state_order));
+  ASSERT_THAT(order_book.buy_page().limit_orders(),
+              ElementsAre(Property(
+                  &LimitOrder::attributes,
+                  Property(&OrderAttributes::quote, IsFalse()))));
+}
+
 TEST_F(MatchingEngineLimitOrderRecover, RecoversOrderId) {
   market_state_order.order_id = OrderId{42};
 
@@ -217,6 +235,27 @@ TEST_F(MatchingEngineLimitOrderRecover,
       ElementsAre(Property(&LimitOrder::status, Eq(OrderStatus::Option::New))));
 }
 
+TEST_F(MatchingEngineLimitOrderRecover, RecoversIcebergOrderQuantities) {
+  using namespace std::chrono_literals;
+  constexpr auto order_time = OrderTime{core::sys_us{
+      core::sys_days{2025y / 1 / 25} + 13h + 14min + 1s + 123456us}};
+  market_state_order.order_time = order_time;
+  market_state_order.total_quantity = OrderQuantity{1000.0};
+  market_state_order.cum_executed_quantity = CumExecutedQuantity{150.0};
+  market_state_order.display_quantity = DisplayQuantity{100.0};
+  market_state_order.hidden_quantity = LeavesQuantity{800.0};
+
+  recover(std::move(market_state_order));
+  ASSERT_THAT(
+      order_book.buy_page().limit_orders(),
+      ElementsAre(AllOf(
+          Property(&LimitOrder::display_quantity,
+                   Optional(Eq(DisplayQuantity{100.0}))),
+          Property(&LimitOrder::displayed_quantity, Eq(LeavesQuantity{50.0})),
+          Property(&LimitOrder::hidden_quantity, Eq(LeavesQuantity{800.0})),
+          Property(&LimitOrder::time, Eq(order_time)))));
+}
+
 TEST_F(MatchingEngineLimitOrderRecover, EmitsOrderAddedOnRecover) {
   market_state_order.order_id = OrderId{42};
 
@@ -0,0 +1,195 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ih/orders/actions/mass_cancellation.hpp"
+#include "tests/mocks/event_listener_mock.hpp"
+#include "tests/tools/matchers.hpp"
+#include "tests/tools/order_test_tools.hpp"
+
+namespace simulator::trading_system::matching_engine::order::test {
+namespace {
+
+// NOLINTBEGIN(*magic-numbers*)
+
+using namespace ::testing;  // NOLINT
+
+struct MatchingEngineMassCancellation : public Test {
+  static auto make_session(const std::string& sender) -> protocol::Session {
+    return protocol::Session{
+        protocol::fix::Session{protocol::fix::BeginString{"FIXT1.1"},
+                               protocol::fix::SenderCompId{sender},
+                               protocol::fix::TargetCompId{"Venue"}}};
+  }
+
+  static auto make_party(const std::string& identifier) -> Party {
+    return Party{PartyId{identifier},
+                 PartyIdSource::Option::Proprietary,
+                 PartyRole::Option::ExecutingFirm};
+  }
+
+  auto add_limit_order(OrderId order_id,
+                       Side side,
+                       const protocol::Session& session) -> void {
+    const auto order = OrderBuilder{}
+                           .with_order_id(order_id)
+                           .with_side(side)
+                           .with_client_session(session)
+                           .build_limit_order();
+    order_book.take_page(side).limit_orders().emplace(order);
+  }
+
+  auto add_party_order(OrderId order_id,
+                       const protocol::Session& session,
+                       std::vector<Party> parties) -> void {
+    order_book.buy_page().limit_orders().emplace(
+        OrderBuilder{}
+            .with_order_id(order_id)
+            .with_client_session(session)
+            .with_order_parties(std::move(parties))
+            .build_limit_order());
+  }
+
+  auto add_quote(OrderId order_id,
+                 const protocol::Session& session,
+                 std::vector<Party> parties = {}) -> void {
+    order_book.buy_page().limit_orders().emplace(
+        OrderBuilder{}
+            .with_order_id(order_id)
+            .with_client_session(session)
+            .with_order_parties(std::move(parties))
+            .as_quote()
+            .build_limit_order());
+  }
+
+  auto limit_order_ids(Side side) -> std::vector<OrderId> {
+    std::vector<OrderId> identifiers;
+    for (const auto& order : order_book.take_page(side).limit_orders()) {
+      identifiers.push_back(order.id());
+    }
+    return identifiers;
+  }
+
+  NiceMock<EventListenerMock> event_listener;
+  OrderBook order_book;
+
+  const protocol::Session session = make_session("Client");
+  const protocol::Session other_session = make_session("Other");
+  protocol::OrderMassCancellationRequest request{session};
+};
+
+TEST_F(MatchingEngineMassCancellation, CancelsOrdersOfRequestingSession) {
+  add_limit_order(OrderId{1}, Side::Option::Buy, session);
+  add_limit_order(OrderId{2}, Side::Option::Buy, other_session);
+  add_limit_order(OrderId{3}, Side::Option::Buy, session);
+  add_limit_order(OrderId{4}, Side::Option::Sell, session);
+
+  const MassCancellation cancellation{event_listener, request};
+
+  ASSERT_EQ(cancellation(order_book), 3);
+  ASSERT_THAT(limit_order_ids(Side::Option::Buy), ElementsAre(OrderId{2}));
+  ASSERT_THAT(limit_order_ids(Side::Option::Sell), IsEmpty());
+}
+
+TEST_F(MatchingEngineMassCancellation, KeepsPriorityOfRemainingOrders) {
+  add_limit_order(OrderId{1}, Side::Option::Sell, other_session);
+  add_limit_order(OrderId{2}, Side::Option::Sell, session);
+  add_limit_order(OrderId{3}, Side::Option::Sell, other_session);
+  add_limit_order(OrderId{4}, Side::Option::Sell, session);
+  add_limit_order(OrderId{5}, Side::Option::Sell, other_session);
+
+  const MassCancellation cancellation{event_listener, request};
+  cancellation(order_book);
+
+  ASSERT_THAT(limit_order_ids(Side::Option::Sell),
+              ElementsAre(OrderId{1}, OrderId{3}, OrderId{5}));
+}
+
+TEST_F(MatchingEngineMassCancellation, CancelsOrdersOfRequestedSideOnly) {
+  add_limit_order(OrderId{1}, Side::Option::Buy, session);
+  add_limit_order(OrderId{2}, Side::Option::Sell, session);
+  request.side = Side::Option::SellShort;
+
+  const MassCancellation cancellation{event_listener, request};
+
+  ASSERT_EQ(cancellation(order_book), 1);
+  ASSERT_THAT(limit_order_ids(Side::Option::Buy), ElementsAre(OrderId{1}));
+}
+
+TEST_F(MatchingEngineMassCancellation, CancelsOwnOrdersOfRequestedParties) {
+  add_party_order(OrderId{1}, session, {make_party("Firm")});
+  add_limit_order(OrderId{2}, Side::Option::Buy, session);
+  add_party_order(OrderId{3}, other_session, {make_party("Firm")});
+  request.parties.push_back(make_party("Firm"));
+
+  const MassCancellation cancellation{event_listener, request};
+
+  ASSERT_EQ(cancellation(order_book), 1);
+  ASSERT_THAT(limit_order_ids(Side::Option::Buy),
+              ElementsAre(OrderId{2}, OrderId{3}));
+}
+
+TEST_F(MatchingEngineMassCancellation, EmitsNotificationsOnCancellation) {
+  add_limit_order(OrderId{123}, Side::Option::Buy, session);
+
+  EXPECT_CALL(event_listener,
+              on(IsOrderBookNotification(VariantWith<OrderRemoved>(
+                  Field(&OrderRemoved::order_id, Eq(OrderId{123}))))));
+  EXPECT_CALL(event_listener,
+              on(IsClientNotification(
+                  VariantWith<protocol::OrderCancellationConfirmation>(_))));
+
+  const MassCancellation cancellation{event_listener, request};
+  cancellation(order_book);
+}
+
+TEST_F(MatchingEngineMassCancellation, CancelsStopOrders) {
+  order_book.buy_page().stop_orders().emplace(
+      OrderBuilder{}.with_client_session(session).build_stop_order());
+
+  const MassCancellation cancellation{event_listener, request};
+
+  ASSERT_EQ(cancellation(order_book), 1);
+  ASSERT_TRUE(order_book.buy_page().stop_orders().empty());
+}
+
+TEST_F(MatchingEngineMassCancellation, KeepsStopOrdersOnMassQuote) {
+  order_book.buy_page().stop_orders().emplace(
+      OrderBuilder{}.with_client_session(session).build_stop_order());
+  add_quote(OrderId{1}, session);
+  const protocol::MassQuoteRequest quote{session};
+
+  const MassCancellation cancellation{event_listener, quote};
+
+  ASSERT_EQ(cancellation(order_book), 1);
+  ASSERT_EQ(order_book.buy_page().stop_orders().size(), 1);
+  ASSERT_THAT(limit_order_ids(Side::Option::Buy), IsEmpty());
+}
+
+TEST_F(MatchingEngineMassCancellation, KeepsRegularOrdersOfSessionOnMassQuote) {
+  add_limit_order(OrderId{1}, Side::Option::Buy, session);
+  add_quote(OrderId{2}, session);
+  const protocol::MassQuoteRequest quote{session};
+
+  const MassCancellation cancellation{event_listener, quote};
+
+  ASSERT_EQ(cancellation(order_book), 1);
+  ASSERT_THAT(limit_order_ids(Side::Option::Buy), ElementsAre(OrderId{1}));
+}
+
+TEST_F(MatchingEngineMassCancellation,
+       CancelsQuotesOfQuotingSessionOnlyWhenPartyIsShared) {
+  add_quote(OrderId{1}, other_session, {make_party("Firm")});
+  add_quote(OrderId{2}, session, {make_party("Firm")});
+  protocol::MassQuoteRequest quote{session};
+  quote.parties.push_back(make_party("Firm"));
+
+  const MassCancellation cancellation{event_listener, quote};
+
+  ASSERT_EQ(cancellation(order_book), 1);
+  ASSERT_THAT(limit_order_ids(Side::Option::Buy), ElementsAre(OrderId{1}));
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::order::test
@@ -0,0 +1,128 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ih/orders/actions/stop_order_trigger.hpp"
+#include "ih/orders/book/order_book.hpp"
+#include "ih/orders/matchers/regular_order_matcher.hpp"
+#include "tests/mocks/event_listener_mock.hpp"
+#include "tests/tools/matchers.hpp"
+#include "tests/tools/order_test_tools.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+struct StopOrderTriggering : public Test {
+  NiceMock<EventListenerMock> event_listener;
+  OrderBuilder builder;
+  OrderBook order_book;
+  RegularOrderMatcher matcher{event_listener, order_book};
+
+  StopOrderTrigger trigger{event_listener, order_book, matcher};
+
+  auto add_buy_stop(OrderId order_id, StopPrice stop_price) -> void {
+    order_book.buy_page().stop_orders().emplace(
+        builder.with_order_id(order_id)
+            .with_side(Side::Option::Buy)
+            .with_stop_price(stop_price)
+            .with_order_quantity(OrderQuantity{10})
+            .build_stop_order());
+  }
+
+  auto add_sell_limit(OrderId order_id, OrderPrice price) -> void {
+    order_book.sell_page().limit_orders().emplace(
+        builder.with_order_id(order_id)
+            .with_side(Side::Option::Sell)
+            .with_order_price(price)
+            .with_order_quantity(OrderQuantity{10})
+            .build_limit_order());
+  }
+};
+
+TEST_F(StopOrderTriggering, KeepsStopOrdersWhenNoTradeHappened) {
+  add_buy_stop(OrderId{1}, StopPrice{100});
+
+  trigger();
+
+  ASSERT_THAT(order_book.buy_page().stop_orders().size(), Eq(1));
+}
+
+TEST_F(StopOrderTriggering, KeepsStopOrdersNotReachedByLastTradePrice) {
+  add_buy_stop(OrderId{1}, StopPrice{100});
+  order_book.record_trade_price(Price{99});
+
+  trigger();
+
+  ASSERT_THAT(order_book.buy_page().stop_orders().size(), Eq(1));
+}
+
+TEST_F(StopOrderTriggering, TradesTriggeredStopOrderAsMarketOrder) {
+  add_buy_stop(OrderId{1}, StopPrice{100});
+  add_sell_limit(OrderId{2}, OrderPrice{101});
+  order_book.record_trade_price(Price{100});
+
+  EXPECT_CALL(event_listener, on(_)).Times(AnyNumber());
+  EXPECT_CALL(event_listener,
+              on(IsClientNotification(VariantWith<protocol::ExecutionReport>(
+                  Field(&protocol::ExecutionReport::venue_order_id,
+                        Eq(VenueOrderId{"1"}))))));
+
+  trigger();
+
+  ASSERT_THAT(order_book.buy_page().stop_orders().empty(), IsTrue());
+  ASSERT_THAT(order_book.sell_page().limit_orders(), IsEmpty());
+}
+
+TEST_F(StopOrderTriggering, CancelsTriggeredStopOrderWithoutFacingOrders) {
+  add_buy_stop(OrderId{1}, StopPrice{100});
+  order_book.record_trade_price(Price{100});
+
+  EXPECT_CALL(event_listener, on(_)).Times(AnyNumber());
+  EXPECT_CALL(event_listener,
+              on(IsClientNotification(
+                  VariantWith<protocol::OrderCancellationConfirmation>(Field(
+                      &protocol::OrderCancellationConfirmation::venue_order_id,
+                      Eq(VenueOrderId{"1"}))))));
+
+  trigger();
+
+  ASSERT_THAT(order_book.buy_page().stop_orders().empty(), IsTrue());
+}
+
+TEST_F(StopOrderTriggering, PlacesTriggeredStopLimitOrderInBook) {
+  order_book.buy_page().stop_orders().emplace(
+      builder.with_order_id(OrderId{1})
+          .with_side(Side::Option::Buy)
+          .with_stop_price(StopPrice{100})
+          .with_order_price(OrderPrice{100.5})
+          .build_stop_limit_order());
+  order_book.record_trade_price(Price{100});
+
+  trigger();
+
+  ASSERT_THAT(order_book.buy_page().stop_orders().empty(), IsTrue());
+  ASSERT_THAT(order_book.buy_page().limit_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{1}))));
+}
+
+TEST_F(StopOrderTriggering, TriggersStopOrdersReachedByReleasedOrderTrades) {
+  add_buy_stop(OrderId{1}, StopPrice{100});
+  add_buy_stop(OrderId{2}, StopPrice{101});
+  add_sell_limit(OrderId{3}, OrderPrice{101});
+  add_sell_limit(OrderId{4}, OrderPrice{102});
+  order_book.record_trade_price(Price{100});
+
+  trigger();
+
+  ASSERT_THAT(order_book.buy_page().stop_orders().empty(), IsTrue());
+  ASSERT_THAT(order_book.sell_page().limit_orders(), IsEmpty());
+  ASSERT_THAT(order_book.last_trade_price(), Optional(Eq(Price{102})));
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
@@ -806,5 +806,62 @@ TEST_F(
   eliminator(order_book);
 }
 
+struct MatchingEngineExpiryDeadline : public Test {
+  OrderBuilder builder;
+  OrderBook order_book;
+};
+
+TEST_F(MatchingEngineExpiryDeadline, IsAbsentForEmptyBook) {
+  ASSERT_EQ(find_expiry_deadline(order_book), std::nullopt);
+}
+
+TEST_F(MatchingEngineExpiryDeadline, IsAbsentForGoodTillCancelOrders) {
+  order_book.buy_page().limit_orders().emplace(
+      builder.with_side(Side{Side::Option::Buy})
+          .with_time_in_force(TimeInForce::Option::GoodTillCancel)
+          .build_limit_order());
+
+  ASSERT_EQ(find_expiry_deadline(order_book), std::nullopt);
+}
+
+TEST_F(MatchingEngineExpiryDeadline, IsNewDayForDayOrder) {
+  order_book.sell_page().limit_orders().emplace(
+      builder.with_side(Side{Side::Option::Sell})
+          .with_time_in_force(TimeInForce::Option::Day)
+          .build_limit_order());
+
+  ASSERT_EQ(find_expiry_deadline(order_book), TickDeadline{.new_day = true});
+}
+
+TEST_F(MatchingEngineExpiryDeadline, IsNewDayForOrderWithExpireDate) {
+  using namespace std::chrono_literals;
+
+  order_book.buy_page().limit_orders().emplace(
+      builder.with_side(Side{Side::Option::Buy})
+          .with_time_in_force(TimeInForce::Option::GoodTillDate)
+          .with_expire_date(ExpireDate(core::sys_days{2025y / 12 / 30}))
+          .build_limit_order());
+
+  ASSERT_EQ(find_expiry_deadline(order_book), TickDeadline{.new_day = true});
+}
+
+TEST_F(MatchingEngineExpiryDeadline, IsEarliestExpireTimeOfOrders) {
+  using namespace std::chrono_literals;
+  const auto now = core::get_current_system_time();
+
+  order_book.buy_page().limit_orders().emplace(
+      builder.with_side(Side{Side::Option::Buy})
+          .with_time_in_force(TimeInForce::Option::GoodTillDate)
+          .with_expire_time(ExpireTime(now + 2h))
+          .build_limit_order());
+  order_book.sell_page().limit_orders().emplace(
+      builder.with_side(Side{Side::Option::Sell})
+          .with_time_in_force(TimeInForce::Option::GoodTillDate)
+          .with_expire_time(ExpireTime(now + 1h))
+          .build_limit_order());
+
+  ASSERT_EQ(find_expiry_deadline(order_book), TickDeadline{.time = now + 1h});
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::matching_engine::order::test
@@ -178,6 +178,14 @@ TEST_F(LimitOrderEntry, ThrowsExceptionWhenNewQuantityLessThanExecuted) {
                std::logic_error);
 }
 
+TEST_F(LimitOrderEntry, RemainsQuoteWhenAmended) {
+  auto order = builder.as_quote().build_limit_order();
+
+  order.amend(make_update(OrderPrice{2}, OrderQuantity{200}));
+
+  ASSERT_THAT(order.attributes().quote(), IsTrue());
+}
+
 TEST_F(LimitOrderEntry, UpdatesOrderTimeWhenPriceChanged) {
   const auto orig_order_time = make_test_order_time();
   auto order = builder.with_order_price(OrderPrice{5})
@@ -269,6 +277,137 @@ TEST_F(LimitOrderEntry, DoesNotReturnOwnerWhenNoExecutingFirmIsSpecified) {
   ASSERT_THAT(order.owner(), std::nullopt);
 }
 
+TEST_F(LimitOrderEntry, InternsSameOwnerKeyForOrdersOfSameOwner) {
+  const Party owner{PartyId{"QUOD"},
+                    PartyIdSource::Option::Proprietary,
+                    PartyRole::Option::ExecutingFirm};
+  const Party other{PartyId{"XTX"},
+                    PartyIdSource::Option::Proprietary,
+                    PartyRole::Option::ExecutingFirm};
+
+  const auto order =
+      OrderBuilder{}.with_order_parties({owner}).build_limit_order();
+  const auto same_owner_order =
+      OrderBuilder{}.with_order_parties({owner}).build_limit_order();
+  const auto other_owner_order =
+      OrderBuilder{}.with_order_parties({other}).build_limit_order();
+
+  ASSERT_THAT(order.owner_key(), Ne(OwnerKey::None));
+  ASSERT_THAT(order.owner_key(), Eq(same_owner_order.owner_key()));
+  ASSERT_THAT(order.owner_key(), Ne(other_owner_order.owner_key()));
+}
+
+TEST_F(LimitOrderEntry, HasNoOwnerKeyWhenNoExecutingFirmIsSpecified) {
+  const auto order = builder.build_limit_order();
+
+  ASSERT_THAT(order.owner_key(), Eq(OwnerKey::None));
+}
+
+TEST_F(LimitOrderEntry, IsNotTradableWhenCancelled) {
+  auto order =
+      builder.with_order_quantity(OrderQuantity{100}).build_limit_order();
+  ASSERT_THAT(order.tradable(), IsTrue());
+
+  order.cancel();
+
+  ASSERT_THAT(order.tradable(), IsFalse());
+}
+
+TEST_F(LimitOrderEntry, ReducesHiddenQuantityOfIcebergOrderFirst) {
+  auto order = builder.with_order_quantity(OrderQuantity{250})
+                   .with_display_quantity(DisplayQuantity{100})
+                   .build_limit_order();
+
+  order.reduce(LeavesQuantity{120});
+
+  ASSERT_THAT(order.total_quantity(), Eq(OrderQuantity{130}));
+  ASSERT_THAT(order.displayed_quantity(), Eq(Quantity{100}));
+  ASSERT_THAT(order.hidden_quantity(), Eq(Quantity{30}));
+}
+
+TEST_F(LimitOrderEntry, IsNotTradableWhenReducedByLeavesQuantity) {
+  auto order =
+      builder.with_order_quantity(OrderQuantity{100}).build_limit_order();
+  order.execute(ExecutedQuantity{40});
+
+  order.reduce(LeavesQuantity{60});
+
+  ASSERT_THAT(order.leaves_quantity(), Eq(Quantity{0}));
+  ASSERT_THAT(order.tradable(), IsFalse());
+}
+
+TEST_F(LimitOrderEntry, DisplaysLeavesQuantityWhenDisplayQuantityIsAbsent) {
+  const auto order = make_order(OrderQuantity{100});
+
+  ASSERT_THAT(order.display_quantity(), Eq(std::nullopt));
+  ASSERT_THAT(order.displayed_quantity(), Eq(Quantity{100}));
+  ASSERT_THAT(order.hidden_quantity(), Eq(Quantity{0}));
+}
+
+TEST_F(LimitOrderEntry, DisplaysSliceOfIcebergOrder) {
+  const auto order = builder.with_order_quantity(OrderQuantity{250})
+                         .with_display_quantity(DisplayQuantity{100})
+                         .build_limit_order();
+
+  ASSERT_THAT(order.display_quantity(), Optional(Eq(DisplayQuantity{100})));
+  ASSERT_THAT(order.displayed_quantity(), Eq(Quantity{100}));
+  ASSERT_THAT(order.hidden_quantity(), Eq(Quantity{150}));
+}
+
+TEST_F(LimitOrderEntry, ReducesDisplayedSliceOfIcebergOrderWhenExecuted) {
+  const auto order_time = make_test_order_time();
+  auto order = builder.with_order_quantity(OrderQuantity{250})
+                   .with_display_quantity(DisplayQuantity{100})
+                   .with_order_time(order_time)
+                   .build_limit_order();
+
+  order.execute(ExecutedQuantity{40});
+
+  ASSERT_THAT(order.displayed_quantity(), Eq(Quantity{60}));
+  ASSERT_THAT(order.hidden_quantity(), Eq(Quantity{150}));
+  ASSERT_THAT(order.time(), Eq(order_time));
+}
+
+TEST_F(LimitOrderEntry, ReplenishesIcebergOrderWhenDisplayedSliceExecuted) {
+  const auto order_time = make_test_order_time();
+  auto order = builder.with_order_quantity(OrderQuantity{250})
+                   .with_display_quantity(DisplayQuantity{100})
+                   .with_order_time(order_time)
+                   .build_limit_order();
+
+  order.execute(ExecutedQuantity{100});
+
+  ASSERT_THAT(order.displayed_quantity(), Eq(Quantity{100}));
+  ASSERT_THAT(order.hidden_quantity(), Eq(Quantity{50}));
+  ASSERT_THAT(order.time(), Gt(order_time));
+}
+
+TEST_F(LimitOrderEntry, ReplenishesIcebergOrderWithRemainingHiddenQuantity) {
+  auto order = builder.with_order_quantity(OrderQuantity{250})
+                   .with_display_quantity(DisplayQuantity{100})
+                   .build_limit_order();
+
+  order.execute(ExecutedQuantity{100});
+  order.execute(ExecutedQuantity{100});
+
+  ASSERT_THAT(order.displayed_quantity(), Eq(Quantity{50}));
+  ASSERT_THAT(order.hidden_quantity(), Eq(Quantity{0}));
+}
+
+TEST_F(LimitOrderEntry, RestoresHiddenQuantityAndTimeOfIcebergOrder) {
+  const auto order_time = make_test_order_time();
+  auto order = builder.with_order_quantity(OrderQuantity{250})
+                   .with_display_quantity(DisplayQuantity{100})
+                   .build_limit_order();
+  order.execute(ExecutedQuantity{100});
+
+  order.restore_hidden_quantity(LeavesQuantity{120}, order_time);
+
+  ASSERT_THAT(order.displayed_quantity(), Eq(Quantity{30}));
+  ASSERT_THAT(order.hidden_quantity(), Eq(Quantity{120}));
+  ASSERT_THAT(order.time(), Eq(order_time));
+}
+
 // NOLINTEND(*-magic-numbers)
 
 }  // namespace simulator::trading_system::matching_engine::test
\ No newline at end of file
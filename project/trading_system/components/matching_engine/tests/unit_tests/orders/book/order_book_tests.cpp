@@ -1,17 +1,21 @@
 #include <gmock/gmock.h>
 
+#include <chrono>
 #include <stdexcept>
 #include <vector>
 
 #include "core/domain/attributes.hpp"
+#include "core/tools/time.hpp"
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/order_book.hpp"
+#include "ih/orders/book/stop_order.hpp"
 #include "tools/order_test_tools.hpp"
 
 namespace simulator::trading_system::matching_engine::test {
 namespace {
 
 using namespace ::testing;  // NOLINT
+using namespace std::chrono_literals;
 
 // NOLINTBEGIN(*magic-numbers*,*non-private-member*)
 
@@ -150,8 +154,137 @@ TEST_F(LimitOrdersContainer, ReportsErrorOnErasingRangeByInvalidIterators) {
                std::invalid_argument);
 }
 
+TEST_F(LimitOrdersContainer, RequeuesReplenishedOrderBehindItsPriceLevel) {
+  const OrderTime order_time{core::get_current_system_time() - 1s};
+  OrderBuilder builder;
+  buy_container.emplace(builder.with_order_id(OrderId{1})
+                            .with_side(Side::Option::Buy)
+                            .with_order_time(order_time)
+                            .with_order_price(OrderPrice{100})
+                            .with_order_quantity(OrderQuantity{200})
+                            .with_display_quantity(DisplayQuantity{100})
+                            .build_limit_order());
+  add_buy_order(OrderId{2}, OrderPrice{100});
+  add_buy_order(OrderId{3}, OrderPrice{99});
+  buy_container.begin()->execute(ExecutedQuantity{100});
+
+  const auto requeued = buy_container.requeue(buy_container.begin());
+
+  ASSERT_THAT(requeued->id(), Eq(OrderId{1}));
+  ASSERT_THAT(buy_container,
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{2})),
+                          Property(&LimitOrder::id, Eq(OrderId{1})),
+                          Property(&LimitOrder::id, Eq(OrderId{3}))));
+}
+
+TEST_F(LimitOrdersContainer, KeepsOrderWithUnchangedTimeInPlaceOnRequeue) {
+  add_buy_order(OrderId{1}, OrderPrice{100});
+  add_buy_order(OrderId{2}, OrderPrice{100});
+
+  const auto requeued = buy_container.requeue(buy_container.begin());
+
+  ASSERT_THAT(requeued, Eq(buy_container.begin()));
+  ASSERT_THAT(buy_container,
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{1})),
+                          Property(&LimitOrder::id, Eq(OrderId{2}))));
+}
+
+TEST_F(LimitOrdersContainer, ReportsErrorOnRequeueingOrderByInvalidIterator) {
+  add_buy_order(OrderId{1});
+
+  EXPECT_THROW(buy_container.requeue(buy_container.end()),
+               std::invalid_argument);
+}
+
 // endregion LimitOrdersContainer tests
 
+// region StopOrdersContainer tests
+
+struct StopOrdersContainer : public Test {
+ public:
+  matching_engine::StopOrdersContainer buy_container{Side::Option::Buy};
+  matching_engine::StopOrdersContainer sell_container{Side::Option::Sell};
+
+  auto add_buy_order(OrderId order_id, StopPrice price) {
+    return buy_container.emplace(order_builder_.with_order_id(order_id)
+                                     .with_stop_price(price)
+                                     .with_side(Side::Option::Buy)
+                                     .build_stop_order());
+  }
+
+  auto add_sell_order(OrderId order_id, StopPrice price) {
+    return sell_container.emplace(order_builder_.with_order_id(order_id)
+                                      .with_stop_price(price)
+                                      .with_side(Side::Option::Sell)
+                                      .build_stop_order());
+  }
+
+  static auto ids_of(const std::vector<StopOrder>& orders)
+      -> std::vector<OrderId> {
+    std::vector<OrderId> identifiers;
+    for (const auto& order : orders) {
+      identifiers.push_back(order.id());
+    }
+    return identifiers;
+  }
+
+ private:
+  OrderBuilder order_builder_;
+};
+
+TEST_F(StopOrdersContainer, IsEmptyAfterCreation) {
+  ASSERT_THAT(buy_container.empty(), IsTrue());
+  ASSERT_THAT(sell_container.empty(), IsTrue());
+}
+
+TEST_F(StopOrdersContainer, ErasesOrder) {
+  const auto iter = add_buy_order(OrderId{42}, StopPrice{100});
+  ASSERT_THAT(buy_container.size(), Eq(1));
+
+  buy_container.erase(iter);
+
+  ASSERT_THAT(buy_container.empty(), IsTrue());
+}
+
+TEST_F(StopOrdersContainer, ReportsErrorOnErasingOrderByInvalidIterator) {
+  add_buy_order(OrderId{42}, StopPrice{100});
+
+  ASSERT_THROW(buy_container.erase(buy_container.end()), std::invalid_argument);
+}
+
+TEST_F(StopOrdersContainer, DoesNotTriggerBuyOrdersBelowStopPrice) {
+  add_buy_order(OrderId{1}, StopPrice{100});
+
+  ASSERT_THAT(buy_container.has_triggered(Price{99.99}), IsFalse());
+  ASSERT_THAT(buy_container.take_triggered(Price{99.99}), IsEmpty());
+  ASSERT_THAT(buy_container.size(), Eq(1));
+}
+
+TEST_F(StopOrdersContainer, TakesBuyOrdersWithStopPriceReached) {
+  add_buy_order(OrderId{1}, StopPrice{102});
+  add_buy_order(OrderId{2}, StopPrice{100});
+  add_buy_order(OrderId{3}, StopPrice{101});
+  add_buy_order(OrderId{4}, StopPrice{100});
+
+  ASSERT_THAT(buy_container.has_triggered(Price{101}), IsTrue());
+  ASSERT_THAT(ids_of(buy_container.take_triggered(Price{101})),
+              ElementsAre(OrderId{2}, OrderId{4}, OrderId{3}));
+  ASSERT_THAT(buy_container.size(), Eq(1));
+}
+
+TEST_F(StopOrdersContainer, TakesSellOrdersWithStopPriceReached) {
+  add_sell_order(OrderId{1}, StopPrice{98});
+  add_sell_order(OrderId{2}, StopPrice{100});
+  add_sell_order(OrderId{3}, StopPrice{99});
+
+  ASSERT_THAT(sell_container.has_triggered(Price{99}), IsTrue());
+  ASSERT_THAT(ids_of(sell_container.take_triggered(Price{99})),
+              ElementsAre(OrderId{2}, OrderId{3}));
+  ASSERT_THAT(sell_container.size(), Eq(1));
+}
+
+// endregion StopOrdersContainer tests
+
 // region OrderBook tests
 
 struct OrderBook : public Test {
@@ -0,0 +1,105 @@
+#include <gmock/gmock.h>
+
+#include <utility>
+#include <variant>
+
+#include "common/attributes.hpp"
+#include "ih/orders/book/limit_order.hpp"
+#include "ih/orders/book/market_order.hpp"
+#include "ih/orders/book/stop_order.hpp"
+#include "tools/order_test_tools.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*-magic-numbers)
+
+struct StopOrderEntry : public Test {
+  OrderBuilder builder;
+
+  auto make_order(Side side, StopPrice stop_price) -> StopOrder {
+    return builder.with_side(side)
+        .with_stop_price(stop_price)
+        .build_stop_order();
+  }
+};
+
+TEST_F(StopOrderEntry, HasNewStatusOnceCreated) {
+  const auto order = make_order(Side::Option::Buy, StopPrice{100});
+
+  ASSERT_THAT(order.status(), Eq(OrderStatus::Option::New));
+}
+
+TEST_F(StopOrderEntry, HasCancelledStatusOnceCancelled) {
+  auto order = make_order(Side::Option::Buy, StopPrice{100});
+  order.cancel();
+
+  ASSERT_THAT(order.status(), Eq(OrderStatus::Option::Cancelled));
+}
+
+TEST_F(StopOrderEntry, HasStopOrderTypeWithoutLimitPrice) {
+  const auto order = builder.build_stop_order();
+
+  ASSERT_THAT(order.order_type(), Eq(OrderType::Option::Stop));
+  ASSERT_THAT(order.limit_price(), Eq(std::nullopt));
+}
+
+TEST_F(StopOrderEntry, HasStopLimitOrderTypeWithLimitPrice) {
+  const auto order =
+      builder.with_order_price(OrderPrice{101}).build_stop_limit_order();
+
+  ASSERT_THAT(order.order_type(), Eq(OrderType::Option::StopLimit));
+  ASSERT_THAT(order.limit_price(), Optional(Eq(OrderPrice{101})));
+}
+
+TEST_F(StopOrderEntry, BuyOrderIsTriggeredByTradeAtOrAboveStopPrice) {
+  const auto order = make_order(Side::Option::Buy, StopPrice{100});
+
+  ASSERT_THAT(order.is_triggered_by(Price{99.99}), IsFalse());
+  ASSERT_THAT(order.is_triggered_by(Price{100}), IsTrue());
+  ASSERT_THAT(order.is_triggered_by(Price{100.01}), IsTrue());
+}
+
+TEST_F(StopOrderEntry, SellOrderIsTriggeredByTradeAtOrBelowStopPrice) {
+  const auto order = make_order(Side::Option::Sell, StopPrice{100});
+
+  ASSERT_THAT(order.is_triggered_by(Price{100.01}), IsFalse());
+  ASSERT_THAT(order.is_triggered_by(Price{100}), IsTrue());
+  ASSERT_THAT(order.is_triggered_by(Price{99.99}), IsTrue());
+}
+
+TEST_F(StopOrderEntry, ReleasesStopOrderAsImmediateMarketOrder) {
+  auto order = builder.with_order_id(OrderId{42})
+                   .with_order_quantity(OrderQuantity{10})
+                   .build_stop_order();
+
+  const auto released = std::move(order).release();
+
+  ASSERT_THAT(released,
+              VariantWith<MarketOrder>(AllOf(
+                  Property(&MarketOrder::id, Eq(OrderId{42})),
+                  Property(&MarketOrder::total_quantity, Eq(OrderQuantity{10})),
+                  Property(&MarketOrder::time_in_force,
+                           Eq(TimeInForce::Option::ImmediateOrCancel)))));
+}
+
+TEST_F(StopOrderEntry, ReleasesStopLimitOrderAsLimitOrder) {
+  auto order = builder.with_order_id(OrderId{42})
+                   .with_order_price(OrderPrice{101})
+                   .with_time_in_force(TimeInForce::Option::GoodTillCancel)
+                   .build_stop_limit_order();
+
+  const auto released = std::move(order).release();
+
+  ASSERT_THAT(released,
+              VariantWith<LimitOrder>(AllOf(
+                  Property(&LimitOrder::id, Eq(OrderId{42})),
+                  Property(&LimitOrder::price, Eq(OrderPrice{101})),
+                  Property(&LimitOrder::time_in_force,
+                           Eq(TimeInForce::Option::GoodTillCancel)))));
+}
+
+// NOLINTEND(*-magic-numbers)
+
+}  // namespace simulator::trading_system::matching_engine::test
@@ -0,0 +1,167 @@
+#include <gmock/gmock.h>
+
+#include "ih/orders/book/order_book.hpp"
+#include "ih/orders/matchers/auction_uncross.hpp"
+#include "mocks/mock_execution_reports_listener.hpp"
+#include "tools/order_test_tools.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+struct AuctionUncrossing : public Test {
+  auto add_order(OrderId order_id, Side side, Price price, Quantity quantity)
+      -> void {
+    book.take_page(side).limit_orders().emplace(
+        order_builder_.with_order_id(order_id)
+            .with_order_price(static_cast<OrderPrice>(price))
+            .with_order_quantity(static_cast<OrderQuantity>(quantity))
+            .with_side(side)
+            .with_time_in_force(TimeInForce::Option::Day)
+            .build_limit_order());
+  }
+
+  auto add_buy(OrderId order_id, Price price, Quantity quantity) -> void {
+    add_order(order_id, Side::Option::Buy, price, quantity);
+  }
+
+  auto add_sell(OrderId order_id, Price price, Quantity quantity) -> void {
+    add_order(order_id, Side::Option::Sell, price, quantity);
+  }
+
+  auto find_equilibrium(std::optional<Price> reference_price = std::nullopt)
+      -> std::optional<AuctionEquilibrium> {
+    return AuctionUncross::find_equilibrium(book.buy_page().limit_orders(),
+                                            book.sell_page().limit_orders(),
+                                            reference_price);
+  }
+
+  inline static const MarketPhase OpeningAuction{
+      TradingPhase::Option::OpeningAuction, TradingStatus::Option::Resume};
+
+  OrderBook book;
+  MockExecutionReportsListener listener;
+  AuctionUncross uncross{listener, book};
+
+ private:
+  OrderBuilder order_builder_;
+};
+
+TEST_F(AuctionUncrossing, FindsNoEquilibriumInEmptyBook) {
+  ASSERT_FALSE(find_equilibrium().has_value());
+}
+
+TEST_F(AuctionUncrossing, FindsNoEquilibriumInNotCrossedBook) {
+  add_buy(OrderId{1}, Price{99}, Quantity{10});
+  add_sell(OrderId{2}, Price{100}, Quantity{10});
+
+  ASSERT_FALSE(find_equilibrium().has_value());
+}
+
+TEST_F(AuctionUncrossing, FindsPriceMaximizingExecutedVolume) {
+  add_buy(OrderId{1}, Price{101}, Quantity{10});
+  add_buy(OrderId{2}, Price{100}, Quantity{10});
+  add_sell(OrderId{3}, Price{99}, Quantity{5});
+  add_sell(OrderId{4}, Price{100}, Quantity{20});
+
+  const auto equilibrium = find_equilibrium();
+
+  ASSERT_TRUE(equilibrium.has_value());
+  EXPECT_EQ(equilibrium->price, Price{100});
+  EXPECT_EQ(equilibrium->volume, Quantity{20});
+  EXPECT_EQ(equilibrium->imbalance, Quantity{5});
+}
+
+TEST_F(AuctionUncrossing, ResolvesVolumeTieByMinimumImbalance) {
+  add_buy(OrderId{1}, Price{102}, Quantity{10});
+  add_buy(OrderId{2}, Price{101}, Quantity{10});
+  add_buy(OrderId{3}, Price{100}, Quantity{10});
+  add_sell(OrderId{4}, Price{99}, Quantity{5});
+  add_sell(OrderId{5}, Price{100}, Quantity{15});
+  add_sell(OrderId{6}, Price{101}, Quantity{20});
+
+  const auto equilibrium = find_equilibrium();
+
+  ASSERT_TRUE(equilibrium.has_value());
+  EXPECT_EQ(equilibrium->price, Price{100});
+  EXPECT_EQ(equilibrium->volume, Quantity{20});
+  EXPECT_EQ(equilibrium->imbalance, Quantity{10});
+}
+
+TEST_F(AuctionUncrossing, ResolvesImbalanceTieByReferencePrice) {
+  add_buy(OrderId{1}, Price{101}, Quantity{10});
+  add_sell(OrderId{2}, Price{100}, Quantity{10});
+
+  const auto equilibrium = find_equilibrium(Price{105});
+
+  ASSERT_TRUE(equilibrium.has_value());
+  EXPECT_EQ(equilibrium->price, Price{101});
+}
+
+TEST_F(AuctionUncrossing, ResolvesTieByLowerPriceWithoutReferencePrice) {
+  add_buy(OrderId{1}, Price{101}, Quantity{10});
+  add_sell(OrderId{2}, Price{100}, Quantity{10});
+
+  const auto equilibrium = find_equilibrium();
+
+  ASSERT_TRUE(equilibrium.has_value());
+  EXPECT_EQ(equilibrium->price, Price{100});
+}
+
+TEST_F(AuctionUncrossing, DoesNotTradeNotCrossedBook) {
+  add_buy(OrderId{1}, Price{99}, Quantity{10});
+  add_sell(OrderId{2}, Price{100}, Quantity{10});
+
+  ASSERT_FALSE(uncross(OpeningAuction).has_value());
+  EXPECT_THAT(listener.reports, IsEmpty());
+  EXPECT_THAT(book.buy_page().limit_orders(), SizeIs(1));
+  EXPECT_THAT(book.sell_page().limit_orders(), SizeIs(1));
+}
+
+TEST_F(AuctionUncrossing, ExecutesCrossedOrdersAtEquilibriumPrice) {
+  add_buy(OrderId{1}, Price{101}, Quantity{10});
+  add_buy(OrderId{2}, Price{100}, Quantity{10});
+  add_sell(OrderId{3}, Price{100}, Quantity{15});
+
+  ASSERT_TRUE(uncross(OpeningAuction).has_value());
+
+  ASSERT_THAT(listener.reports, SizeIs(4));
+  for (const auto& report : listener.reports) {
+    EXPECT_THAT(report.execution_price, Optional(Eq(ExecutionPrice{100})));
+  }
+  EXPECT_THAT(listener.reports[0].executed_quantity,
+              Optional(Eq(ExecutedQuantity{10})));
+  EXPECT_THAT(listener.reports[2].executed_quantity,
+              Optional(Eq(ExecutedQuantity{5})));
+}
+
+TEST_F(AuctionUncrossing, RemovesFilledOrdersFromBook) {
+  add_buy(OrderId{1}, Price{101}, Quantity{10});
+  add_buy(OrderId{2}, Price{100}, Quantity{10});
+  add_sell(OrderId{3}, Price{100}, Quantity{15});
+
+  ASSERT_TRUE(uncross(OpeningAuction).has_value());
+
+  auto& buy_orders = book.buy_page().limit_orders();
+  ASSERT_THAT(buy_orders, SizeIs(1));
+  EXPECT_EQ(buy_orders.begin()->id(), OrderId{2});
+  EXPECT_EQ(buy_orders.begin()->leaves_quantity(), LeavesQuantity{5});
+  EXPECT_THAT(book.sell_page().limit_orders(), IsEmpty());
+}
+
+TEST_F(AuctionUncrossing, RecordsEquilibriumPriceAsLastTradePrice) {
+  add_buy(OrderId{1}, Price{101}, Quantity{10});
+  add_sell(OrderId{2}, Price{100}, Quantity{10});
+
+  ASSERT_TRUE(uncross(OpeningAuction).has_value());
+
+  ASSERT_THAT(book.last_trade_price(), Optional(Eq(Price{100})));
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
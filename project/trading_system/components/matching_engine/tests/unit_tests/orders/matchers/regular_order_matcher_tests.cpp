@@ -709,6 +709,323 @@ TEST_F(SellMarketOrderMatching, MatchesWithSeveralFacingOrders) {
 
 // endregion SellMarketOrderMatching
 
+// region IcebergOrderMatching
+
+struct IcebergOrderMatching : public Test {
+  auto make_aggressor(OrderId order_id,
+                      Quantity quantity,
+                      TimeInForce time_in_force) -> LimitOrder {
+    return order_builder_.with_order_id(order_id)
+        .with_order_price(OrderPrice{100})
+        .with_order_quantity(static_cast<OrderQuantity>(quantity))
+        .with_side(Side::Option::Buy)
+        .with_time_in_force(time_in_force)
+        .build_limit_order();
+  }
+
+  auto add_resting_order(OrderId order_id, Quantity quantity) -> void {
+    resting_orders().emplace(
+        OrderBuilder{}
+            .with_order_id(order_id)
+            .with_order_price(OrderPrice{100})
+            .with_order_quantity(static_cast<OrderQuantity>(quantity))
+            .with_side(Side::Option::Sell)
+            .build_limit_order());
+  }
+
+  auto add_iceberg_order(OrderId order_id,
+                         Quantity quantity,
+                         Quantity display_quantity) -> void {
+    resting_orders().emplace(
+        OrderBuilder{}
+            .with_order_id(order_id)
+            .with_order_price(OrderPrice{100})
+            .with_order_quantity(static_cast<OrderQuantity>(quantity))
+            .with_display_quantity(
+                static_cast<DisplayQuantity>(display_quantity))
+            .with_side(Side::Option::Sell)
+            .build_limit_order());
+  }
+
+  auto resting_orders() -> LimitOrdersContainer& {
+    return book_.sell_page().limit_orders();
+  }
+
+ private:
+  OrderBook book_;
+  OrderBuilder order_builder_;
+
+ public:
+  MockExecutionReportsListener listener;
+  RegularOrderMatcher matcher{listener, book_};
+};
+
+TEST_F(IcebergOrderMatching, TradesDisplayedQuantityOfIcebergOrder) {
+  add_iceberg_order(OrderId{1}, Quantity{300}, Quantity{100});
+  add_resting_order(OrderId{2}, Quantity{100});
+
+  LimitOrder order =
+      make_aggressor(OrderId{3}, Quantity{150}, TimeInForce::Option::Day);
+  matcher.match(order);
+
+  ASSERT_THAT(listener.reports, SizeIs(4));
+  EXPECT_THAT(listener.reports[1].executed_quantity,
+              Optional(Eq(Quantity{100})));
+  EXPECT_THAT(listener.reports[3].executed_quantity,
+              Optional(Eq(Quantity{50})));
+}
+
+TEST_F(IcebergOrderMatching, QueuesReplenishedIcebergOrderBehindItsLevel) {
+  add_iceberg_order(OrderId{1}, Quantity{300}, Quantity{100});
+  add_resting_order(OrderId{2}, Quantity{100});
+
+  LimitOrder order =
+      make_aggressor(OrderId{3}, Quantity{150}, TimeInForce::Option::Day);
+  matcher.match(order);
+
+  ASSERT_THAT(resting_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{2})),
+                          Property(&LimitOrder::id, Eq(OrderId{1}))));
+  EXPECT_THAT(resting_orders().begin()->leaves_quantity(),
+              Eq(Quantity{50}));
+  EXPECT_THAT(std::next(resting_orders().begin())->displayed_quantity(),
+              Eq(Quantity{100}));
+  EXPECT_THAT(std::next(resting_orders().begin())->hidden_quantity(),
+              Eq(Quantity{100}));
+}
+
+TEST_F(IcebergOrderMatching, KeepsPriorityOfPartiallyExecutedDisplayedSlice) {
+  add_iceberg_order(OrderId{1}, Quantity{300}, Quantity{100});
+  add_resting_order(OrderId{2}, Quantity{100});
+
+  LimitOrder order =
+      make_aggressor(OrderId{3}, Quantity{50}, TimeInForce::Option::Day);
+  matcher.match(order);
+
+  ASSERT_THAT(resting_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{1})),
+                          Property(&LimitOrder::id, Eq(OrderId{2}))));
+  EXPECT_THAT(resting_orders().begin()->displayed_quantity(),
+              Eq(Quantity{50}));
+}
+
+TEST_F(IcebergOrderMatching, TradesReplenishedIcebergOrderAfterItsLevel) {
+  add_iceberg_order(OrderId{1}, Quantity{300}, Quantity{100});
+  add_resting_order(OrderId{2}, Quantity{50});
+
+  LimitOrder order =
+      make_aggressor(OrderId{3}, Quantity{250}, TimeInForce::Option::Day);
+  matcher.match(order);
+
+  ASSERT_THAT(listener.reports, SizeIs(6));
+  EXPECT_THAT(listener.reports[3].executed_quantity,
+              Optional(Eq(Quantity{50})));
+  EXPECT_THAT(listener.reports[5].executed_quantity,
+              Optional(Eq(Quantity{100})));
+  EXPECT_THAT(order.executed(), IsTrue());
+  ASSERT_THAT(resting_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{1}))));
+  EXPECT_THAT(resting_orders().begin()->leaves_quantity(), Eq(Quantity{100}));
+}
+
+TEST_F(IcebergOrderMatching, FullyMatchesIocOrderWithReplenishedIcebergOrder) {
+  add_iceberg_order(OrderId{1}, Quantity{300}, Quantity{100});
+
+  LimitOrder order = make_aggressor(
+      OrderId{2}, Quantity{250}, TimeInForce::Option::ImmediateOrCancel);
+  matcher.match(order);
+
+  EXPECT_THAT(order.executed(), IsTrue());
+  EXPECT_THAT(order.status(), Eq(OrderStatus::Option::Filled));
+  ASSERT_THAT(resting_orders(), SizeIs(1));
+  EXPECT_THAT(resting_orders().begin()->displayed_quantity(),
+              Eq(Quantity{50}));
+}
+
+TEST_F(IcebergOrderMatching, RemovesFullyExecutedIcebergOrder) {
+  add_iceberg_order(OrderId{1}, Quantity{200}, Quantity{100});
+  add_resting_order(OrderId{2}, Quantity{100});
+
+  LimitOrder order =
+      make_aggressor(OrderId{3}, Quantity{300}, TimeInForce::Option::Day);
+  matcher.match(order);
+
+  EXPECT_THAT(order.executed(), IsTrue());
+  ASSERT_THAT(resting_orders(), IsEmpty());
+}
+
+// endregion IcebergOrderMatching
+
+// region SelfTradePreventionMatching
+
+struct SelfTradePreventionMatching : public Test {
+  static auto make_party(const std::string& identifier) -> Party {
+    return Party{PartyId{identifier},
+                 PartyIdSource::Option::Proprietary,
+                 PartyRole::Option::ExecutingFirm};
+  }
+
+  auto make_aggressor(Quantity quantity,
+                      TimeInForce time_in_force = TimeInForce::Option::Day)
+      -> LimitOrder {
+    return OrderBuilder{}
+        .with_order_id(OrderId{100})
+        .with_order_price(OrderPrice{100})
+        .with_order_quantity(static_cast<OrderQuantity>(quantity))
+        .with_side(Side::Option::Buy)
+        .with_time_in_force(time_in_force)
+        .with_order_parties({make_party("Firm")})
+        .build_limit_order();
+  }
+
+  auto add_resting_order(OrderId order_id,
+                         Quantity quantity,
+                         const std::string& owner) -> void {
+    resting_orders().emplace(
+        OrderBuilder{}
+            .with_order_id(order_id)
+            .with_order_price(OrderPrice{100})
+            .with_order_quantity(static_cast<OrderQuantity>(quantity))
+            .with_side(Side::Option::Sell)
+            .with_order_parties({make_party(owner)})
+            .build_limit_order());
+  }
+
+  auto make_matcher(SelfTradePrevention mode) -> RegularOrderMatcher {
+    return RegularOrderMatcher{listener, book_, mode};
+  }
+
+  auto resting_orders() -> LimitOrdersContainer& {
+    return book_.sell_page().limit_orders();
+  }
+
+ private:
+  OrderBook book_;
+
+ public:
+  MockExecutionReportsListener listener;
+};
+
+TEST_F(SelfTradePreventionMatching, TradesWithOwnOrderWhenDisabled) {
+  add_resting_order(OrderId{1}, Quantity{100}, "Firm");
+
+  LimitOrder order = make_aggressor(Quantity{100});
+  make_matcher(SelfTradePrevention::None).match(order);
+
+  EXPECT_THAT(order.executed(), IsTrue());
+  ASSERT_THAT(resting_orders(), IsEmpty());
+}
+
+TEST_F(SelfTradePreventionMatching, TradesWithOrderOfOtherOwner) {
+  add_resting_order(OrderId{1}, Quantity{100}, "Other");
+
+  LimitOrder order = make_aggressor(Quantity{100});
+  make_matcher(SelfTradePrevention::CancelNewest).match(order);
+
+  EXPECT_THAT(order.executed(), IsTrue());
+  ASSERT_THAT(resting_orders(), IsEmpty());
+}
+
+TEST_F(SelfTradePreventionMatching, CancelsIncomingOrderOnCancelNewest) {
+  add_resting_order(OrderId{1}, Quantity{100}, "Other");
+  add_resting_order(OrderId{2}, Quantity{100}, "Firm");
+
+  LimitOrder order = make_aggressor(Quantity{150});
+  make_matcher(SelfTradePrevention::CancelNewest).match(order);
+
+  EXPECT_THAT(order.status(), Eq(OrderStatus::Option::Cancelled));
+  EXPECT_THAT(order.leaves_quantity(), Eq(Quantity{50}));
+  EXPECT_THAT(order.tradable(), IsFalse());
+  ASSERT_THAT(resting_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{2}))));
+}
+
+TEST_F(SelfTradePreventionMatching, CancelsRestingOrderOnCancelOldest) {
+  add_resting_order(OrderId{1}, Quantity{100}, "Firm");
+  add_resting_order(OrderId{2}, Quantity{100}, "Other");
+
+  LimitOrder order = make_aggressor(Quantity{50});
+  make_matcher(SelfTradePrevention::CancelOldest).match(order);
+
+  EXPECT_THAT(order.executed(), IsTrue());
+  ASSERT_THAT(resting_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{2}))));
+  EXPECT_THAT(resting_orders().begin()->leaves_quantity(), Eq(Quantity{50}));
+}
+
+TEST_F(SelfTradePreventionMatching, CancelsBothOrdersOnCancelBoth) {
+  add_resting_order(OrderId{1}, Quantity{100}, "Firm");
+  add_resting_order(OrderId{2}, Quantity{100}, "Other");
+
+  LimitOrder order = make_aggressor(Quantity{50});
+  make_matcher(SelfTradePrevention::CancelBoth).match(order);
+
+  EXPECT_THAT(order.status(), Eq(OrderStatus::Option::Cancelled));
+  EXPECT_THAT(listener.reports, IsEmpty());
+  ASSERT_THAT(resting_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{2}))));
+  EXPECT_THAT(resting_orders().begin()->leaves_quantity(),
+              Eq(Quantity{100}));
+}
+
+TEST_F(SelfTradePreventionMatching, DecrementsIncomingOrderOnDecrement) {
+  add_resting_order(OrderId{1}, Quantity{60}, "Firm");
+  add_resting_order(OrderId{2}, Quantity{100}, "Other");
+
+  LimitOrder order = make_aggressor(Quantity{100});
+  make_matcher(SelfTradePrevention::Decrement).match(order);
+
+  EXPECT_THAT(order.total_quantity(), Eq(OrderQuantity{40}));
+  EXPECT_THAT(order.executed(), IsTrue());
+  ASSERT_THAT(resting_orders(),
+              ElementsAre(Property(&LimitOrder::id, Eq(OrderId{2}))));
+  EXPECT_THAT(resting_orders().begin()->leaves_quantity(), Eq(Quantity{60}));
+}
+
+TEST_F(SelfTradePreventionMatching, DecrementsRestingOrderOnDecrement) {
+  add_resting_order(OrderId{1}, Quantity{150}, "Firm");
+
+  LimitOrder order = make_aggressor(Quantity{100});
+  make_matcher(SelfTradePrevention::Decrement).match(order);
+
+  EXPECT_THAT(order.status(), Eq(OrderStatus::Option::Cancelled));
+  EXPECT_THAT(listener.reports, IsEmpty());
+  ASSERT_THAT(resting_orders(), SizeIs(1));
+  EXPECT_THAT(resting_orders().begin()->leaves_quantity(), Eq(Quantity{50}));
+}
+
+TEST_F(SelfTradePreventionMatching, CancelsIocRemainderLeftByPrevention) {
+  add_resting_order(OrderId{1}, Quantity{100}, "Other");
+  add_resting_order(OrderId{2}, Quantity{100}, "Firm");
+
+  LimitOrder order =
+      make_aggressor(Quantity{150}, TimeInForce::Option::ImmediateOrCancel);
+  make_matcher(SelfTradePrevention::CancelOldest).match(order);
+
+  EXPECT_THAT(order.status(), Eq(OrderStatus::Option::Cancelled));
+  EXPECT_THAT(order.leaves_quantity(), Eq(Quantity{50}));
+  ASSERT_THAT(resting_orders(), IsEmpty());
+}
+
+TEST_F(SelfTradePreventionMatching, DoesNotCountOwnOrdersForFullTrade) {
+  add_resting_order(OrderId{1}, Quantity{100}, "Firm");
+  add_resting_order(OrderId{2}, Quantity{100}, "Other");
+
+  const LimitOrder order = make_aggressor(Quantity{150});
+
+  EXPECT_THAT(make_matcher(SelfTradePrevention::CancelNewest)
+                  .can_fully_trade(order),
+              IsFalse());
+  EXPECT_THAT(make_matcher(SelfTradePrevention::CancelOldest)
+                  .can_fully_trade(order),
+              IsFalse());
+  EXPECT_THAT(
+      make_matcher(SelfTradePrevention::None).can_fully_trade(order),
+      IsTrue());
+}
+
+// endregion SelfTradePreventionMatching
+
 // NOLINTEND(*magic-numbers*,*non-private-member*)
 
 }  // namespace
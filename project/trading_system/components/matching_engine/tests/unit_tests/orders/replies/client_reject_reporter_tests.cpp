@@ -340,6 +340,61 @@ TEST_F(OrderCancellationRejectReporting, HardcodesRejectedOrderStatus) {
 
 /*----------------------------------------------------------------------------*/
 
+class MassRequestRejectReporting : public Test {
+ public:
+  auto listener() -> decltype(auto) { return (listener_); }
+
+  auto report_request_rejected(auto&&... args) -> void {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    reporter_.notify_rejected(std::forward<decltype(args)>(args)...);
+  }
+
+  protocol::BusinessMessageReject reject =
+      make_message<protocol::BusinessMessageReject>();
+
+ private:
+  auto SetUp() -> void override {
+    ON_CALL(listener_, on_business_message_reject)
+        .WillByDefault(SaveArg<0>(&reject));
+  }
+
+  StrictMock<MockClientNotificationListener> listener_;
+  NiceMock<MockOrderIdGenerator> order_id_generator_;
+  order::ClientRejectReporter reporter_{listener_, order_id_generator_};
+};
+
+TEST_F(MassRequestRejectReporting, RejectsOrderMassCancellationRequest) {
+  auto request = make_message<protocol::OrderMassCancellationRequest>();
+  request.client_order_id = ClientOrderId{"mass-cancel-id"};
+  request.seq_num = SeqNum{7};
+
+  EXPECT_CALL(listener(), on_business_message_reject);
+  report_request_rejected(request, "test reject reason");
+
+  ASSERT_THAT(reject.session, Eq(request.session));
+  ASSERT_THAT(reject.ref_message_type,
+              Optional(RejectedMessageType::Option::OrderMassCancelRequest));
+  ASSERT_THAT(reject.ref_id, Optional(BusinessRejectRefId{"mass-cancel-id"}));
+  ASSERT_THAT(reject.ref_seq_num, Optional(SeqNum{7}));
+  ASSERT_THAT(reject.text, Optional(RejectText{"test reject reason"}));
+}
+
+TEST_F(MassRequestRejectReporting, RejectsMassQuoteRequest) {
+  auto request = make_message<protocol::MassQuoteRequest>();
+  request.client_order_id = ClientOrderId{"quote-id"};
+
+  EXPECT_CALL(listener(), on_business_message_reject);
+  report_request_rejected(request, "test reject reason");
+
+  ASSERT_THAT(reject.ref_message_type,
+              Optional(RejectedMessageType::Option::MassQuote));
+  ASSERT_THAT(reject.ref_id, Optional(BusinessRejectRefId{"quote-id"}));
+  ASSERT_THAT(reject.business_reject_reason,
+              Optional(BusinessRejectReason::Option::Other));
+}
+
+/*----------------------------------------------------------------------------*/
+
 // NOLINTEND(*magic-numbers*,*non-private-member*)
 
 }  // namespace
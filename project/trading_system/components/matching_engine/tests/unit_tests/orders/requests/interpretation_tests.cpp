@@ -8,6 +8,7 @@
 #include "core/domain/party.hpp"
 #include "ih/orders/book/limit_order.hpp"
 #include "ih/orders/book/order_updates.hpp"
+#include "ih/orders/book/stop_order.hpp"
 #include "ih/orders/requests/interpretation.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
@@ -78,6 +79,20 @@ TEST(OrderTypeInterpretation, InterpretsLimitOrderType) {
   ASSERT_THAT(result.value(), Eq(OrderType::Option::Limit));
 }
 
+TEST(OrderTypeInterpretation, InterpretsStopOrderType) {
+  const auto result = interpret_order_type(OrderType::Option::Stop);
+
+  ASSERT_THAT(result.has_value(), IsTrue());
+  ASSERT_THAT(result.value(), Eq(OrderType::Option::Stop));
+}
+
+TEST(OrderTypeInterpretation, InterpretsStopLimitOrderType) {
+  const auto result = interpret_order_type(OrderType::Option::StopLimit);
+
+  ASSERT_THAT(result.has_value(), IsTrue());
+  ASSERT_THAT(result.value(), Eq(OrderType::Option::StopLimit));
+}
+
 // endregion OrderTypeInterpretation
 
 // region TimeInForceInterpretation
@@ -302,6 +317,11 @@ TEST(OrderErrorFormatting, FormatsPriceMissing) {
               Eq(RejectText{"order price missing"}));
 }
 
+TEST(OrderErrorFormatting, FormatsStopPriceMissing) {
+  ASSERT_THAT(convert_to_reason_text(OrderRequestError::StopPriceMissing),
+              Eq(RejectText{"order stop price missing"}));
+}
+
 TEST(OrderErrorFormatting, FormatsQuantityMissing) {
   ASSERT_THAT(convert_to_reason_text(OrderRequestError::QuantityMissing),
               Eq(RejectText{"order quantity missing"}));
@@ -321,6 +341,7 @@ struct PlacementInterpretation : public Test {
   protocol::OrderPlacementRequest raw_request{session};
   protocol::OrderPlacementRequest limit_request{session};
   protocol::OrderPlacementRequest market_request{session};
+  protocol::OrderPlacementRequest stop_request{session};
 
   const OrderId order_id{4221};
   PlacementInterpreter interpreter{order_id};
@@ -337,6 +358,12 @@ struct PlacementInterpretation : public Test {
     market_request.order_type = OrderType::Option::Market;
     market_request.side = Side::Option::Buy;
     market_request.order_quantity = OrderQuantity{100};
+
+    // Minimal set of required fields for a stop order
+    stop_request.order_type = OrderType::Option::Stop;
+    stop_request.side = Side::Option::Buy;
+    stop_request.stop_price = StopPrice{105.0};
+    stop_request.order_quantity = OrderQuantity{100};
   }
 };
 
@@ -475,6 +502,20 @@ TEST_F(PlacementInterpretation, CreatesLimitOrderWithGivenClientOrderId) {
               Eq(client_order_id));
 }
 
+TEST_F(PlacementInterpretation, CreatesLimitOrderNotMarkedAsQuote) {
+  const auto order = interpreter.interpret(limit_request);
+
+  ASSERT_THAT(order, VariantWith<LimitOrder>(_));
+  ASSERT_THAT(std::get<LimitOrder>(order).attributes().quote(), IsFalse());
+}
+
+TEST_F(PlacementInterpretation, CreatesQuoteMarkedAsQuote) {
+  const auto order = interpreter.interpret_quote(limit_request);
+
+  ASSERT_THAT(order, VariantWith<LimitOrder>(_));
+  ASSERT_THAT(std::get<LimitOrder>(order).attributes().quote(), IsTrue());
+}
+
 TEST_F(PlacementInterpretation, ReportsQuantityMissingForMarketOrder) {
   market_request.order_quantity = std::nullopt;
 
@@ -570,6 +611,70 @@ TEST_F(PlacementInterpretation, ImplicitlySetsIocTimeInForceForMarketOrder) {
               Eq(TimeInForce::Option::ImmediateOrCancel));
 }
 
+TEST_F(PlacementInterpretation, ReportsStopPriceMissingForStopOrder) {
+  stop_request.stop_price = std::nullopt;
+
+  const auto error = interpreter.interpret(stop_request);
+
+  ASSERT_THAT(
+      error,
+      VariantWith<OrderRequestError>(Eq(OrderRequestError::StopPriceMissing)));
+}
+
+TEST_F(PlacementInterpretation, ReportsQuantityMissingForStopOrder) {
+  stop_request.order_quantity = std::nullopt;
+
+  const auto error = interpreter.interpret(stop_request);
+
+  ASSERT_THAT(
+      error,
+      VariantWith<OrderRequestError>(Eq(OrderRequestError::QuantityMissing)));
+}
+
+TEST_F(PlacementInterpretation, ReportsPriceMissingForStopLimitOrder) {
+  stop_request.order_type = OrderType::Option::StopLimit;
+
+  const auto error = interpreter.interpret(stop_request);
+
+  ASSERT_THAT(
+      error,
+      VariantWith<OrderRequestError>(Eq(OrderRequestError::PriceMissing)));
+}
+
+TEST_F(PlacementInterpretation, CreatesStopOrderWithGivenStopPrice) {
+  const auto order = interpreter.interpret(stop_request);
+
+  ASSERT_THAT(order,
+              VariantWith<StopOrder>(AllOf(
+                  Property(&StopOrder::id, Eq(order_id)),
+                  Property(&StopOrder::stop_price, Eq(StopPrice{105.0})),
+                  Property(&StopOrder::limit_price, Eq(std::nullopt)))));
+}
+
+TEST_F(PlacementInterpretation, IgnoresOrderPriceForStopOrder) {
+  stop_request.order_price = OrderPrice{106.0};
+
+  const auto order = interpreter.interpret(stop_request);
+
+  ASSERT_THAT(order,
+              VariantWith<StopOrder>(
+                  Property(&StopOrder::limit_price, Eq(std::nullopt))));
+}
+
+TEST_F(PlacementInterpretation, CreatesStopLimitOrderWithGivenLimitPrice) {
+  stop_request.order_type = OrderType::Option::StopLimit;
+  stop_request.order_price = OrderPrice{106.0};
+
+  const auto order = interpreter.interpret(stop_request);
+
+  ASSERT_THAT(order,
+              VariantWith<StopOrder>(AllOf(
+                  Property(&StopOrder::order_type,
+                           Eq(OrderType::Option::StopLimit)),
+                  Property(&StopOrder::limit_price,
+                           Optional(Eq(OrderPrice{106.0}))))));
+}
+
 // endregion PlacementInterpretation
 
 // region ModificationInterpretation
@@ -1,7 +1,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "ih/orders/actions/stop_order_recover.hpp"
 #include "ih/orders/tools/order_book_state_converter.hpp"
+#include "tests/tools/order_test_tools.hpp"
 
 namespace simulator::trading_system::matching_engine::test {
 namespace {
@@ -585,5 +587,162 @@ TEST_F(MatchingEngineOrderBookStateConverterLimitOrder,
             CumExecutedQuantity{0.0});
 }
 
+TEST_F(MatchingEngineOrderBookStateConverterLimitOrder,
+       DoesNotStoreDisplayQuantityOfRegularOrder) {
+  const LimitOrder order{
+      OrderPrice{3.14}, OrderQuantity{2.74}, std::move(order_record)};
+  order_book.buy_page().limit_orders().emplace(order);
+
+  store_order_book_state(order_book, order_book_state);
+
+  ASSERT_EQ(order_book_state.buy_orders[0].display_quantity, std::nullopt);
+  ASSERT_EQ(order_book_state.buy_orders[0].hidden_quantity, std::nullopt);
+}
+
+TEST_F(MatchingEngineOrderBookStateConverterLimitOrder,
+       StoresDisplayAndHiddenQuantitiesOfIcebergOrder) {
+  LimitOrder order{OrderPrice{3.14},
+                   OrderQuantity{10},
+                   DisplayQuantity{4},
+                   std::move(order_record)};
+  order.execute(ExecutedQuantity{1});
+  order_book.buy_page().limit_orders().emplace(order);
+
+  store_order_book_state(order_book, order_book_state);
+
+  ASSERT_EQ(order_book_state.buy_orders[0].display_quantity,
+            DisplayQuantity{4});
+  ASSERT_EQ(order_book_state.buy_orders[0].hidden_quantity,
+            LeavesQuantity{6});
+}
+
+TEST_F(MatchingEngineOrderBookStateConverterLimitOrder,
+       DoesNotStoreQuoteMarkOfRegularOrder) {
+  const LimitOrder order{
+      OrderPrice{3.14}, OrderQuantity{2.74}, std::move(order_record)};
+  order_book.buy_page().limit_orders().emplace(order);
+
+  store_order_book_state(order_book, order_book_state);
+
+  ASSERT_EQ(order_book_state.buy_orders[0].quote, std::nullopt);
+}
+
+TEST_F(MatchingEngineOrderBookStateConverterLimitOrder, StoresQuoteMark) {
+  OrderAttributes attributes;
+  attributes.set_quote(true);
+  const LimitOrder order{OrderPrice{3.14},
+                         OrderQuantity{2.74},
+                         OrderRecord{OrderId{42},
+                                     Side::Option::Buy,
+                                     protocol::Session{
+                                         protocol::generator::Session{}},
+                                     {},
+                                     std::move(attributes)}};
+  order_book.buy_page().limit_orders().emplace(order);
+
+  store_order_book_state(order_book, order_book_state);
+
+  ASSERT_EQ(order_book_state.buy_orders[0].quote, true);
+}
+
+struct MatchingEngineOrderBookStateConverterStopOrder
+    : public ::testing::Test {
+  OrderBuilder builder;
+  OrderBook order_book;
+  market_state::OrderBook order_book_state;
+};
+
+TEST_F(MatchingEngineOrderBookStateConverterStopOrder,
+       DoesNotStoreStopOrdersOfBookWithoutStopOrders) {
+  store_order_book_state(order_book, order_book_state);
+
+  ASSERT_EQ(order_book_state.buy_stop_orders, std::nullopt);
+  ASSERT_EQ(order_book_state.sell_stop_orders, std::nullopt);
+}
+
+TEST_F(MatchingEngineOrderBookStateConverterStopOrder,
+       StoresStopOrderInBuyStopOrders) {
+  order_book.buy_page().stop_orders().emplace(
+      builder.with_order_id(OrderId{42})
+          .with_side(Side::Option::Buy)
+          .with_stop_price(StopPrice{101})
+          .with_order_quantity(OrderQuantity{10})
+          .build_stop_order());
+
+  store_order_book_state(order_book, order_book_state);
+
+  ASSERT_TRUE(order_book_state.buy_stop_orders.has_value());
+  ASSERT_EQ(order_book_state.buy_stop_orders->size(), 1);
+  const auto& order_state = order_book_state.buy_stop_orders->front();
+  EXPECT_EQ(order_state.order_id, OrderId{42});
+  EXPECT_EQ(order_state.stop_price, StopPrice{101});
+  EXPECT_EQ(order_state.order_price, std::nullopt);
+  EXPECT_EQ(order_state.total_quantity, OrderQuantity{10});
+  EXPECT_EQ(order_book_state.sell_stop_orders, std::nullopt);
+}
+
+TEST_F(MatchingEngineOrderBookStateConverterStopOrder,
+       StoresStopLimitOrderInSellStopOrders) {
+  order_book.sell_page().stop_orders().emplace(
+      builder.with_order_id(OrderId{42})
+          .with_side(Side::Option::Sell)
+          .with_stop_price(StopPrice{99})
+          .with_order_price(OrderPrice{98})
+          .with_order_quantity(OrderQuantity{10})
+          .build_stop_limit_order());
+
+  store_order_book_state(order_book, order_book_state);
+
+  ASSERT_TRUE(order_book_state.sell_stop_orders.has_value());
+  ASSERT_EQ(order_book_state.sell_stop_orders->size(), 1);
+  const auto& order_state = order_book_state.sell_stop_orders->front();
+  EXPECT_EQ(order_state.stop_price, StopPrice{99});
+  EXPECT_EQ(order_state.order_price, OrderPrice{98});
+  EXPECT_EQ(order_book_state.buy_stop_orders, std::nullopt);
+}
+
+TEST_F(MatchingEngineOrderBookStateConverterStopOrder,
+       RecoversStoredStopOrders) {
+  order_book.buy_page().stop_orders().emplace(
+      builder.with_order_id(OrderId{1})
+          .with_side(Side::Option::Buy)
+          .with_client_order_id(ClientOrderId{"stop"})
+          .with_time_in_force(TimeInForce::Option::GoodTillCancel)
+          .with_stop_price(StopPrice{102})
+          .with_order_quantity(OrderQuantity{10})
+          .build_stop_order());
+  order_book.buy_page().stop_orders().emplace(
+      builder.with_order_id(OrderId{2})
+          .with_stop_price(StopPrice{101})
+          .build_stop_order());
+  order_book.sell_page().stop_orders().emplace(
+      builder.with_order_id(OrderId{3})
+          .with_side(Side::Option::Sell)
+          .with_client_order_id(ClientOrderId{"stop-limit"})
+          .with_stop_price(StopPrice{99})
+          .with_order_price(OrderPrice{98})
+          .build_stop_limit_order());
+  store_order_book_state(order_book, order_book_state);
+
+  OrderBook recovered_book;
+  StopOrderRecover recover{recovered_book};
+  for (const auto& order_state : *order_book_state.buy_stop_orders) {
+    recover(order_state);
+  }
+  for (const auto& order_state : *order_book_state.sell_stop_orders) {
+    recover(order_state);
+  }
+
+  market_state::OrderBook recovered_state;
+  store_order_book_state(recovered_book, recovered_state);
+  ASSERT_EQ(recovered_state, order_book_state);
+  ASSERT_TRUE(recovered_book.buy_page().limit_orders().empty());
+  ASSERT_TRUE(recovered_book.sell_page().limit_orders().empty());
+  ASSERT_TRUE(recovered_book.buy_page().stop_orders().has_triggered(
+      Price{101}));
+  ASSERT_FALSE(recovered_book.sell_page().stop_orders().has_triggered(
+      Price{100}));
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::matching_engine::test
@@ -0,0 +1,49 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ih/orders/tools/order_id_generator.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+struct MatchingEngineOrderIdGenerator : public ::testing::Test {
+  std::unique_ptr<order::OrderIdGenerator> generator =
+      order::OrderIdGenerator::create();
+};
+
+TEST_F(MatchingEngineOrderIdGenerator, GeneratesSequentialIdentifiers) {
+  const auto first = order::generate_order_id(*generator);
+  const auto second = order::generate_order_id(*generator);
+
+  ASSERT_EQ(second.value(), first.value() + 1);
+}
+
+TEST_F(MatchingEngineOrderIdGenerator, ReportsLastGeneratedIdentifier) {
+  const auto generated = order::generate_order_id(*generator);
+
+  ASSERT_EQ(generator->last_generated(), generated);
+}
+
+TEST_F(MatchingEngineOrderIdGenerator,
+       ReportsIdentifierPrecedingFirstOneBeforeGeneration) {
+  const auto last_generated = generator->last_generated();
+
+  ASSERT_EQ(order::generate_order_id(*generator).value(),
+            last_generated.value() + 1);
+}
+
+TEST_F(MatchingEngineOrderIdGenerator, ResumesSequenceAfterIdentifier) {
+  generator->resume_after(OrderId{42});
+
+  ASSERT_EQ(order::generate_order_id(*generator), OrderId{43});
+  ASSERT_EQ(order::generate_order_id(*generator), OrderId{44});
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
@@ -219,6 +219,18 @@ TYPED_TEST(OrderTypeSupportedChecker, PassesWhenOrderTypeIsMarket) {
   ASSERT_THAT(this->checker(this->input), Eq(std::nullopt));
 }
 
+TYPED_TEST(OrderTypeSupportedChecker, PassesWhenOrderTypeIsStop) {
+  this->input.order_type = OrderType::Option::Stop;
+
+  ASSERT_THAT(this->checker(this->input), Eq(std::nullopt));
+}
+
+TYPED_TEST(OrderTypeSupportedChecker, PassesWhenOrderTypeIsStopLimit) {
+  this->input.order_type = OrderType::Option::StopLimit;
+
+  ASSERT_THAT(this->checker(this->input), Eq(std::nullopt));
+}
+
 TYPED_TEST(OrderTypeSupportedChecker, PassesWhenOrderTypeIsNotSpecified) {
   this->input.order_type = std::nullopt;
 
@@ -936,6 +948,152 @@ TEST_F(LimitOrderOrderPriceRespectsTickChecker, FailsWhenTickIsNegative) {
 
 /*----------------------------------------------------------------------------*/
 
+struct StopPriceSpecifiedChecker : public Test {
+  StopPriceSpecified checker;
+  protocol::OrderPlacementRequest input =
+      make_message<protocol::OrderPlacementRequest>();
+};
+
+TEST_F(StopPriceSpecifiedChecker, ReportsStopPriceMissing) {
+  input.stop_price = std::nullopt;
+
+  ASSERT_THAT(checker(input), Optional(Eq(ValidationError::StopPriceMissing)));
+}
+
+TEST_F(StopPriceSpecifiedChecker, PassesWhenStopPriceIsPresent) {
+  input.stop_price = StopPrice{1};
+
+  ASSERT_THAT(checker(input), Eq(std::nullopt));
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct StopPriceRespectsTickChecker : public Test {
+  protocol::OrderPlacementRequest input =
+      make_message<protocol::OrderPlacementRequest>();
+};
+
+TEST_F(StopPriceRespectsTickChecker, SuccessWhenStopPriceIsNotSpecified) {
+  input.stop_price = std::nullopt;
+
+  ASSERT_THAT(StopPriceRespectsTick{PriceTick{1}}(input), Eq(std::nullopt));
+}
+
+TEST_F(StopPriceRespectsTickChecker, SuccessWhenTickIsNotSpecified) {
+  input.stop_price = StopPrice{1};
+
+  ASSERT_THAT(StopPriceRespectsTick{std::nullopt}(input), Eq(std::nullopt));
+}
+
+TEST_F(StopPriceRespectsTickChecker, SuccessWhenStopPriceIsMultipleOfTick) {
+  input.stop_price = StopPrice{16.4};
+
+  ASSERT_THAT(StopPriceRespectsTick{PriceTick{0.2}}(input), Eq(std::nullopt));
+}
+
+TEST_F(StopPriceRespectsTickChecker, FailsWhenStopPriceIsNotMultipleOfTick) {
+  input.stop_price = StopPrice{16.5};
+
+  ASSERT_THAT(StopPriceRespectsTick{PriceTick{0.4}}(input),
+              Optional(Eq(ValidationError::StopPriceTickViolated)));
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct DisplayQuantityAbsentChecker : public Test {
+  DisplayQuantityAbsent checker;
+  protocol::OrderPlacementRequest input =
+      make_message<protocol::OrderPlacementRequest>();
+};
+
+TEST_F(DisplayQuantityAbsentChecker, ReportsDisplayQuantityNotAllowed) {
+  input.display_quantity = DisplayQuantity{1};
+
+  ASSERT_THAT(checker(input),
+              Optional(Eq(ValidationError::DisplayQuantityNotAllowed)));
+}
+
+TEST_F(DisplayQuantityAbsentChecker, PassesWhenDisplayQuantityIsNotSpecified) {
+  input.display_quantity = std::nullopt;
+
+  ASSERT_THAT(checker(input), Eq(std::nullopt));
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct DisplayQuantityWithinOrderQuantityChecker : public Test {
+  DisplayQuantityWithinOrderQuantity checker;
+  protocol::OrderPlacementRequest input =
+      make_message<protocol::OrderPlacementRequest>();
+};
+
+TEST_F(DisplayQuantityWithinOrderQuantityChecker,
+       SuccessWhenDisplayQuantityIsNotSpecified) {
+  input.order_quantity = OrderQuantity{100};
+  input.display_quantity = std::nullopt;
+
+  ASSERT_THAT(checker(input), Eq(std::nullopt));
+}
+
+TEST_F(DisplayQuantityWithinOrderQuantityChecker,
+       SuccessWhenDisplayQuantityIsLessThanOrderQuantity) {
+  input.order_quantity = OrderQuantity{100};
+  input.display_quantity = DisplayQuantity{10};
+
+  ASSERT_THAT(checker(input), Eq(std::nullopt));
+}
+
+TEST_F(DisplayQuantityWithinOrderQuantityChecker,
+       SuccessWhenDisplayQuantityIsEqualToOrderQuantity) {
+  input.order_quantity = OrderQuantity{100};
+  input.display_quantity = DisplayQuantity{100};
+
+  ASSERT_THAT(checker(input), Eq(std::nullopt));
+}
+
+TEST_F(DisplayQuantityWithinOrderQuantityChecker,
+       FailsWhenDisplayQuantityIsGreaterThanOrderQuantity) {
+  input.order_quantity = OrderQuantity{100};
+  input.display_quantity = DisplayQuantity{100.5};
+
+  ASSERT_THAT(checker(input),
+              Optional(Eq(ValidationError::DisplayQuantityRangeViolated)));
+}
+
+TEST_F(DisplayQuantityWithinOrderQuantityChecker,
+       FailsWhenDisplayQuantityIsZero) {
+  input.order_quantity = OrderQuantity{100};
+  input.display_quantity = DisplayQuantity{0};
+
+  ASSERT_THAT(checker(input),
+              Optional(Eq(ValidationError::DisplayQuantityRangeViolated)));
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct DisplayQuantityRespectsTickChecker : public Test {
+  protocol::OrderPlacementRequest input =
+      make_message<protocol::OrderPlacementRequest>();
+};
+
+TEST_F(DisplayQuantityRespectsTickChecker,
+       SuccessWhenDisplayQuantityIsMultipleOfTick) {
+  input.display_quantity = DisplayQuantity{10.5};
+
+  ASSERT_THAT(DisplayQuantityRespectsTick{QuantityTick{0.5}}(input),
+              Eq(std::nullopt));
+}
+
+TEST_F(DisplayQuantityRespectsTickChecker,
+       FailsWhenDisplayQuantityIsNotMultipleOfTick) {
+  input.display_quantity = DisplayQuantity{10.3};
+
+  ASSERT_THAT(DisplayQuantityRespectsTick{QuantityTick{0.5}}(input),
+              Optional(Eq(ValidationError::DisplayQuantityTickViolated)));
+}
+
+/*----------------------------------------------------------------------------*/
+
 struct TimeInForceSupportedChecker : public Test {
   market_state::LimitOrder order;
 };
@@ -177,6 +177,95 @@ TEST_F(OrderPlacementRequestValidation, FailsWhenPriceSpecifiedForMarketOrder) {
   ASSERT_THAT(conclusion, IsError("order price is not allowed"));
 }
 
+TEST_F(OrderPlacementRequestValidation, FailsWhenStopPriceUnspecified) {
+  request.order_type = OrderType::Option::Stop;
+  request.stop_price = std::nullopt;
+
+  const auto conclusion = validate(request);
+
+  ASSERT_THAT(conclusion, IsError("stop price missing"));
+}
+
+TEST_F(OrderPlacementRequestValidation, FailsWhenPriceSpecifiedForStopOrder) {
+  request.order_type = OrderType::Option::Stop;
+  request.stop_price = StopPrice{100};
+  request.order_price = OrderPrice{100};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_THAT(conclusion, IsError("order price is not allowed"));
+}
+
+TEST_F(OrderPlacementRequestValidation,
+       FailsWhenPriceUnspecifiedForStopLimitOrder) {
+  request.order_type = OrderType::Option::StopLimit;
+  request.stop_price = StopPrice{100};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_THAT(conclusion, IsError("order price missing"));
+}
+
+TEST_F(OrderPlacementRequestValidation,
+       FailsWhenStopPriceIsNotMultipleOfPriceTick) {
+  set_price_tick(PriceTick{0.5});
+  request.order_type = OrderType::Option::StopLimit;
+  request.order_price = OrderPrice{100};
+  request.stop_price = StopPrice{100.2};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_THAT(conclusion, IsError("stop price tick constraint violated"));
+}
+
+TEST_F(OrderPlacementRequestValidation,
+       FailsWhenDisplayQuantitySpecifiedForMarketOrder) {
+  request.order_type = OrderType::Option::Market;
+  request.display_quantity = DisplayQuantity{10};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_THAT(conclusion, IsError("display quantity is not allowed"));
+}
+
+TEST_F(OrderPlacementRequestValidation,
+       FailsWhenDisplayQuantityExceedsOrderQuantity) {
+  request.order_type = OrderType::Option::Limit;
+  request.order_price = OrderPrice{100};
+  request.display_quantity = DisplayQuantity{200};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_THAT(
+      conclusion,
+      IsError("display quantity is not positive or exceeds order quantity"));
+}
+
+TEST_F(OrderPlacementRequestValidation,
+       FailsWhenDisplayQuantityIsNotMultipleOfQuantityTick) {
+  set_quantity_tick(QuantityTick{10});
+  request.order_type = OrderType::Option::Limit;
+  request.order_price = OrderPrice{100};
+  request.display_quantity = DisplayQuantity{15};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_THAT(conclusion,
+              IsError("display quantity multiple constraint violated"));
+}
+
+TEST_F(OrderPlacementRequestValidation,
+       SucceedsWhenAllConstraintsMetForIcebergOrder) {
+  set_quantity_tick(QuantityTick{10});
+  request.order_type = OrderType::Option::Limit;
+  request.order_price = OrderPrice{100};
+  request.display_quantity = DisplayQuantity{20};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_FALSE(conclusion.failed());
+}
+
 TEST_F(OrderPlacementRequestValidation,
        SucceedsWhenAllConstraintsMetForLimitOrder) {
   set_min_quantity(MinQuantity{100});
@@ -219,6 +308,18 @@ TEST_F(OrderPlacementRequestValidation,
   ASSERT_FALSE(conclusion.failed());
 }
 
+TEST_F(OrderPlacementRequestValidation,
+       SucceedsWhenAllConstraintsMetForStopLimitOrder) {
+  set_price_tick(PriceTick{0.05});
+  request.order_type = OrderType::Option::StopLimit;
+  request.order_price = OrderPrice{100.25};
+  request.stop_price = StopPrice{100.5};
+
+  const auto conclusion = validate(request);
+
+  ASSERT_FALSE(conclusion.failed());
+}
+
 /*----------------------------------------------------------------------------*/
 
 struct OrderModificationRequestValidation : public Test,
@@ -45,7 +45,12 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_pair(ValidationError::TimeInForceInvalid, "time in force value is invalid"),
         std::make_pair(ValidationError::OrderAlreadyExpired, "order already expired"),
         std::make_pair(ValidationError::BothExpireDateTimeSpecified, "both expire date and expire time specified"),
-        std::make_pair(ValidationError::ExpireDateTimeMissing, "neither expire date nor expire time specified")));
+        std::make_pair(ValidationError::ExpireDateTimeMissing, "neither expire date nor expire time specified"),
+        std::make_pair(ValidationError::StopPriceMissing, "stop price missing"),
+        std::make_pair(ValidationError::StopPriceTickViolated, "stop price tick constraint violated"),
+        std::make_pair(ValidationError::DisplayQuantityNotAllowed, "display quantity is not allowed"),
+        std::make_pair(ValidationError::DisplayQuantityRangeViolated, "display quantity is not positive or exceeds order quantity"),
+        std::make_pair(ValidationError::DisplayQuantityTickViolated, "display quantity multiple constraint violated")));
 // clang-format on
 
 struct OrderValidationErrorsFormatting
@@ -85,7 +90,12 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_pair(ValidationError::TimeInForceInvalid, "TimeInForceInvalid"),
         std::make_pair(ValidationError::OrderAlreadyExpired, "OrderAlreadyExpired"),
         std::make_pair(ValidationError::BothExpireDateTimeSpecified, "BothExpireDateTimeSpecified"),
-        std::make_pair(ValidationError::ExpireDateTimeMissing, "ExpireDateTimeMissing")));
+        std::make_pair(ValidationError::ExpireDateTimeMissing, "ExpireDateTimeMissing"),
+        std::make_pair(ValidationError::StopPriceMissing, "StopPriceMissing"),
+        std::make_pair(ValidationError::StopPriceTickViolated, "StopPriceTickViolated"),
+        std::make_pair(ValidationError::DisplayQuantityNotAllowed, "DisplayQuantityNotAllowed"),
+        std::make_pair(ValidationError::DisplayQuantityRangeViolated, "DisplayQuantityRangeViolated"),
+        std::make_pair(ValidationError::DisplayQuantityTickViolated, "DisplayQuantityTickViolated")));
 // clang-format on
 
 }  // namespace
@@ -0,0 +1,67 @@
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include "ih/statistics/command_latency_recorder.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*non-private-member*)
+
+struct MatchingEngineCommandLatencyRecorder : public Test {
+  auto SetUp() -> void override {
+    if constexpr (!LatencyHistogramsEnabled) {
+      GTEST_SKIP() << "latency histograms are compiled out";
+    }
+  }
+
+  auto report() const -> std::vector<protocol::CommandLatency> {
+    std::vector<protocol::CommandLatency> latencies;
+    recorder.report(latencies);
+    return latencies;
+  }
+
+  static auto is_stage(const std::string& command, const std::string& stage) {
+    return AllOf(Field(&protocol::CommandLatency::command, Eq(command)),
+                 Field(&protocol::CommandLatency::stage, Eq(stage)),
+                 Field(&protocol::CommandLatency::count, Eq(1)));
+  }
+
+  CommandLatencyRecorder recorder;
+};
+
+TEST_F(MatchingEngineCommandLatencyRecorder, ReportsNothingInitially) {
+  ASSERT_THAT(report(), IsEmpty());
+}
+
+TEST_F(MatchingEngineCommandLatencyRecorder, ReportsExecutedCommandStages) {
+  recorder.start(CommandType::CancelOrder, CommandLatencyRecorder::now());
+  recorder.finish_execution();
+  recorder.finish_reply_dispatch();
+
+  ASSERT_THAT(report(),
+              ElementsAre(is_stage("CancelOrder", "QueueWait"),
+                          is_stage("CancelOrder", "Execution"),
+                          is_stage("CancelOrder", "ReplyDispatch")));
+}
+
+TEST_F(MatchingEngineCommandLatencyRecorder, ReportsMarketDataWhenPublished) {
+  recorder.start(CommandType::Tick, CommandLatencyRecorder::now());
+  recorder.start_market_data();
+  recorder.finish_market_data();
+  recorder.finish_execution();
+
+  ASSERT_THAT(report(),
+              ElementsAre(is_stage("Tick", "QueueWait"),
+                          is_stage("Tick", "Execution"),
+                          is_stage("Tick", "MarketData")));
+}
+
+// NOLINTEND(*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
@@ -0,0 +1,100 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+#include "ih/statistics/latency_histogram.hpp"
+
+namespace simulator::trading_system::matching_engine::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+using namespace std::chrono_literals;
+
+// NOLINTBEGIN(*magic-numbers*)
+
+TEST(MatchingEngineLatencyHistogram, CountsSmallValuesExactly) {
+  for (std::uint64_t value = 0; value < 32; ++value) {
+    const auto bucket = LatencyHistogram::bucket_of(value);
+    ASSERT_THAT(LatencyHistogram::highest_equivalent(bucket), Eq(value));
+  }
+}
+
+TEST(MatchingEngineLatencyHistogram, KeepsRelativePrecisionOfLargeValues) {
+  for (std::uint64_t value = 32; value < 1'000'000; value += 7) {
+    const auto bucket = LatencyHistogram::bucket_of(value);
+    const auto highest = LatencyHistogram::highest_equivalent(bucket);
+    ASSERT_THAT(highest, Ge(value));
+    ASSERT_THAT(highest - value, Le(value / 16));
+  }
+}
+
+TEST(MatchingEngineLatencyHistogram, PlacesAdjacentValuesIntoOrderedBuckets) {
+  EXPECT_THAT(LatencyHistogram::bucket_of(31), Eq(31));
+  EXPECT_THAT(LatencyHistogram::bucket_of(32), Eq(32));
+  EXPECT_THAT(LatencyHistogram::bucket_of(33), Eq(32));
+  EXPECT_THAT(LatencyHistogram::bucket_of(34), Eq(33));
+  EXPECT_THAT(LatencyHistogram::bucket_of(63), Eq(47));
+  EXPECT_THAT(LatencyHistogram::bucket_of(64), Eq(48));
+}
+
+TEST(MatchingEngineLatencyHistogram, CountsHugeValuesInLastBucket) {
+  const auto last =
+      LatencyHistogram::bucket_of(std::numeric_limits<std::uint64_t>::max());
+
+  ASSERT_THAT(LatencyHistogram::bucket_of(std::uint64_t{1} << 40), Eq(last));
+}
+
+TEST(MatchingEngineLatencyHistogram, SummarizesNoSamples) {
+  const LatencyHistogram histogram;
+
+  const auto summary = histogram.summarize();
+
+  EXPECT_THAT(summary.count, Eq(0));
+  EXPECT_THAT(summary.mean, Eq(0ns));
+  EXPECT_THAT(summary.p50, Eq(0ns));
+  EXPECT_THAT(summary.max, Eq(0ns));
+}
+
+TEST(MatchingEngineLatencyHistogram, CountsNegativeLatencyAsZero) {
+  LatencyHistogram histogram;
+
+  histogram.record(-5ns);
+
+  const auto summary = histogram.summarize();
+  EXPECT_THAT(summary.count, Eq(1));
+  EXPECT_THAT(summary.max, Eq(0ns));
+}
+
+TEST(MatchingEngineLatencyHistogram, SummarizesPercentiles) {
+  LatencyHistogram histogram;
+  for (std::int64_t latency = 1; latency <= 100; ++latency) {
+    histogram.record(std::chrono::nanoseconds{latency});
+  }
+
+  const auto summary = histogram.summarize();
+
+  EXPECT_THAT(summary.count, Eq(100));
+  EXPECT_THAT(summary.mean, Eq(50ns));
+  EXPECT_THAT(summary.p50, Eq(51ns));
+  EXPECT_THAT(summary.p90, Eq(91ns));
+  EXPECT_THAT(summary.p99, Eq(99ns));
+  EXPECT_THAT(summary.p999, Eq(100ns));
+  EXPECT_THAT(summary.max, Eq(100ns));
+}
+
+TEST(MatchingEngineLatencyHistogram, DoesNotReportPercentileAboveMax) {
+  LatencyHistogram histogram;
+
+  histogram.record(1000ns);
+
+  const auto summary = histogram.summarize();
+  EXPECT_THAT(summary.p50, Eq(1000ns));
+  EXPECT_THAT(summary.p999, Eq(1000ns));
+}
+
+// NOLINTEND(*magic-numbers*)
+
+}  // namespace
+}  // namespace simulator::trading_system::matching_engine::test
@@ -5,6 +5,7 @@
 #include <thread>
 #include <utility>
 
+#include "cfg/api/venue_scope.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::trading_system::runtime {
@@ -33,8 +34,8 @@ auto OneSecondRateLoop::run() -> void {
     return;
   }
 
-  thread_ = std::make_unique<std::jthread>(
-      [this](std::stop_token stop) { loop_main(std::move(stop)); });
+  thread_ = std::make_unique<std::jthread>(cfg::bind_venue_scope(
+      [this](std::stop_token stop) { loop_main(std::move(stop)); }));
 
   log::debug("loop started with {} repeating tasks", tasks_.size());
 }
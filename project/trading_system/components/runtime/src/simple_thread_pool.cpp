@@ -4,6 +4,7 @@
 #include <mutex>
 #include <utility>
 
+#include "cfg/api/venue_scope.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::trading_system::runtime {
@@ -47,8 +48,10 @@ auto SimpleThreadPool::enqueue(std::function<void()> task) -> void {
 auto SimpleThreadPool::init() -> void {
   const auto threads_count = concurrency();
   threads_.reserve(threads_count);
+  // Threads serve the venue the pool is created for
   for (std::size_t trd = 0; trd < threads_count; ++trd) {
-    threads_.emplace_back([this](const auto& stop) { run(stop); });
+    threads_.emplace_back(cfg::bind_venue_scope(
+        [this](const std::stop_token& stop) { run(stop); }));
   }
   log::debug("threadpool with {} threads created", threads_count);
 }
@@ -2,11 +2,14 @@
 #define SIMULATOR_TRADING_SYSTEM_IH_CONFIG_CONFIG_HPP_
 
 #include <bitset>
+#include <cstdint>
+#include <string>
 #include <utility>
 
 #include "core/tools/time.hpp"
 #include "ies/phase_record.hpp"
 #include "ies/phase_schedule.hpp"
+#include "matching_engine/configuration.hpp"
 
 namespace simulator::trading_system {
 
@@ -56,6 +59,14 @@ class Config {
     return flags_[trade_aggressor_streaming_enabled_flag];
   }
 
+  auto trade_history_depth() const -> std::uint32_t {
+    return trade_history_depth_;
+  }
+
+  auto self_trade_prevention() const -> matching_engine::SelfTradePrevention {
+    return self_trade_prevention_;
+  }
+
   auto depth_orders_exclusion_enabled() const -> bool {
     return flags_[depth_orders_exclusion_enabled_flag];
   }
@@ -104,6 +115,15 @@ class Config {
     flags_[trade_aggressor_streaming_enabled_flag] = enabled;
   }
 
+  auto set_trade_history_depth(std::uint32_t depth) -> void {
+    trade_history_depth_ = depth;
+  }
+
+  auto set_self_trade_prevention(matching_engine::SelfTradePrevention mode)
+      -> void {
+    self_trade_prevention_ = mode;
+  }
+
   auto set_depth_orders_exclusion(bool enabled) -> void {
     flags_[depth_orders_exclusion_enabled_flag] = enabled;
   }
@@ -127,6 +147,9 @@ class Config {
   core::TzClock tz_clock_;
   std::bitset<flags_count> flags_;
   std::string persistence_file_path_;
+  std::uint32_t trade_history_depth_ = 1;
+  matching_engine::SelfTradePrevention self_trade_prevention_ =
+      matching_engine::SelfTradePrevention::None;
 };
 
 }  // namespace simulator::trading_system
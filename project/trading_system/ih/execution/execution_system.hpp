@@ -9,7 +9,9 @@
 #include "ih/repository/repository_accessor.hpp"
 #include "ih/tools/instrument_resolver.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -28,6 +30,12 @@ struct Executor {
   virtual auto execute_request(protocol::OrderCancellationRequest request) const
       -> void = 0;
 
+  virtual auto execute_request(
+      protocol::OrderMassCancellationRequest request) const -> void = 0;
+
+  virtual auto execute_request(protocol::MassQuoteRequest request) const
+      -> void = 0;
+
   virtual auto execute_request(protocol::MarketDataRequest request) const
       -> void = 0;
 
@@ -56,8 +64,12 @@ struct Executor {
 // a rejection message via the trading reply middleware channel.
 class ExecutionSystem : public Executor {
  public:
+  // Invoked each time an engine has recovered its state
+  using RecoveryListener = std::function<void()>;
+
   ExecutionSystem(const InstrumentResolver& instrument_resolver,
-                  const RepositoryAccessor& repository_accessor) noexcept;
+                  const RepositoryAccessor& repository_accessor,
+                  RecoveryListener on_engine_recovered = {}) noexcept;
 
   auto execute_request(protocol::OrderPlacementRequest request) const
       -> void override;
@@ -68,6 +80,14 @@ class ExecutionSystem : public Executor {
   auto execute_request(protocol::OrderCancellationRequest request) const
       -> void override;
 
+  // Dispatches the request to all executors,
+  // when the request does not specify an instrument
+  auto execute_request(protocol::OrderMassCancellationRequest request) const
+      -> void override;
+
+  auto execute_request(protocol::MassQuoteRequest request) const
+      -> void override;
+
   auto execute_request(protocol::MarketDataRequest request) const
       -> void override;
 
@@ -81,6 +101,8 @@ class ExecutionSystem : public Executor {
       std::vector<market_state::InstrumentState>& instruments) const
       -> void override;
 
+  // Engines recover their states concurrently,
+  // the call returns when all the engines have recovered
   auto recover_state_request(
       std::vector<market_state::InstrumentState> instruments) const
       -> void override;
@@ -98,6 +120,7 @@ class ExecutionSystem : public Executor {
   RejectNotifier reject_notifier_;
   const InstrumentResolver& instrument_resolver_;
   const RepositoryAccessor& repository_accessor_;
+  RecoveryListener on_engine_recovered_;
 };
 
 }  // namespace simulator::trading_system
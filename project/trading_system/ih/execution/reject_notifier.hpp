@@ -6,8 +6,10 @@
 
 #include "protocol/app/market_data_reject.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_reject.hpp"
@@ -37,6 +39,12 @@ class RejectNotifier {
   auto reject(const protocol::OrderCancellationRequest& request,
               std::string_view reason) const -> void;
 
+  auto reject(const protocol::OrderMassCancellationRequest& request,
+              std::string_view reason) const -> void;
+
+  auto reject(const protocol::MassQuoteRequest& request,
+              std::string_view reason) const -> void;
+
   auto reject(const protocol::MarketDataRequest& request,
               std::string_view reason) const -> void;
 
@@ -49,6 +57,12 @@ class RejectNotifier {
   auto notify_multiple_instruments_requested(
       const protocol::MarketDataRequest& request) const -> void;
 
+  // Confirms an order mass cancellation request broadcast to all engines.
+  // Each engine reports cancelled orders on its own, so the confirmation
+  // carries no number of affected orders.
+  auto notify_mass_cancellation_broadcast(
+      const protocol::OrderMassCancellationRequest& request) const -> void;
+
  private:
   std::unique_ptr<OrderIdentifiersGenerator> id_generator_;
 };
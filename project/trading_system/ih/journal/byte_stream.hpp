@@ -0,0 +1,123 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_BYTE_STREAM_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_BYTE_STREAM_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace simulator::trading_system::journal {
+
+// Writes little-endian integers and length-prefixed strings
+// into a growing byte buffer.
+class ByteWriter {
+ public:
+  explicit ByteWriter(std::vector<std::byte>& buffer) noexcept
+      : buffer_(buffer) {}
+
+  template <std::integral T>
+  auto put(T value) -> void {
+    if constexpr (std::endian::native == std::endian::big) {
+      value = byteswap(value);
+    }
+    const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+    buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+  }
+
+  auto put(std::string_view chars) -> void {
+    put(static_cast<std::uint32_t>(chars.size()));
+    const auto* bytes = reinterpret_cast<const std::byte*>(chars.data());
+    buffer_.insert(buffer_.end(), bytes, bytes + chars.size());
+  }
+
+  // Returns the number of bytes written to the buffer so far
+  [[nodiscard]]
+  auto position() const noexcept -> std::size_t {
+    return buffer_.size();
+  }
+
+  // Overwrites a previously written integer at the given position
+  template <std::integral T>
+  auto put_at(std::size_t position, T value) -> void {
+    if constexpr (std::endian::native == std::endian::big) {
+      value = byteswap(value);
+    }
+    std::memcpy(buffer_.data() + position, &value, sizeof(T));
+  }
+
+ private:
+  template <std::integral T>
+  static auto byteswap(T value) noexcept -> T {
+    auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+    std::reverse(bytes.begin(), bytes.end());
+    return std::bit_cast<T>(bytes);
+  }
+
+  std::vector<std::byte>& buffer_;
+};
+
+// Reads values written by the ByteWriter.
+// Reading past the end of the buffer yields zero values and marks the reader
+// as failed, so that a record may be decoded completely before it is checked.
+class ByteReader {
+ public:
+  explicit ByteReader(std::span<const std::byte> buffer) noexcept
+      : buffer_(buffer) {}
+
+  [[nodiscard]]
+  auto remaining() const noexcept -> std::size_t {
+    return buffer_.size() - offset_;
+  }
+
+  [[nodiscard]]
+  auto failed() const noexcept -> bool {
+    return failed_;
+  }
+
+  template <std::integral T>
+  auto get() noexcept -> T {
+    if (remaining() < sizeof(T)) {
+      failed_ = true;
+      offset_ = buffer_.size();
+      return T{};
+    }
+
+    std::array<std::byte, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), buffer_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    if constexpr (std::endian::native == std::endian::big) {
+      std::reverse(bytes.begin(), bytes.end());
+    }
+    return std::bit_cast<T>(bytes);
+  }
+
+  auto get_string() -> std::string {
+    const auto size = get<std::uint32_t>();
+    if (remaining() < size) {
+      failed_ = true;
+      offset_ = buffer_.size();
+      return {};
+    }
+
+    std::string chars(size, '\0');
+    std::memcpy(chars.data(), buffer_.data() + offset_, size);
+    offset_ += size;
+    return chars;
+  }
+
+ private:
+  std::span<const std::byte> buffer_;
+  std::size_t offset_{0};
+  bool failed_{false};
+};
+
+}  // namespace simulator::trading_system::journal
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_BYTE_STREAM_HPP_
@@ -0,0 +1,95 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_CODEC_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_CODEC_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tl/expected.hpp>
+#include <variant>
+#include <vector>
+
+#include "common/events.hpp"
+#include "core/tools/time.hpp"
+#include "protocol/app/mass_quote_request.hpp"
+#include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
+#include "protocol/app/order_modification_request.hpp"
+#include "protocol/app/order_placement_request.hpp"
+#include "protocol/app/session_terminated_event.hpp"
+
+namespace simulator::trading_system::journal {
+
+// Engine commands, which change an instrument state and are journaled
+using Command = std::variant<protocol::OrderPlacementRequest,
+                             protocol::OrderModificationRequest,
+                             protocol::OrderCancellationRequest,
+                             protocol::SessionTerminatedEvent,
+                             event::Tick,
+                             event::PhaseTransition,
+                             protocol::OrderMassCancellationRequest,
+                             protocol::MassQuoteRequest>;
+
+struct Record {
+  std::uint64_t sequence = 0;
+  // The time the command was journaled at, the command is replayed
+  // as if it was processed at this time
+  core::sys_us time;
+  Command command;
+};
+
+struct Header {
+  std::uint64_t generation = 0;
+};
+
+// A journal file starts with a fixed-size header:
+//   [u32 magic][u16 version][u16 reserved][u64 generation]
+// followed by records:
+//   [u32 length][u8 command type][u64 sequence][i64 time][payload][u32 crc32]
+// where the length covers the command type, the sequence, the time
+// in microseconds since the epoch and the payload,
+// and the checksum is calculated over the same bytes.
+// Integers are little-endian.
+constexpr std::size_t HeaderSize = 16;
+
+enum class DecodingError : std::uint8_t {
+  // The buffer ends in the middle of a record, which is expected
+  // at the end of a journal written by a crashed process
+  Truncated,
+  ChecksumMismatch,
+  UnknownMagic,
+  UnsupportedVersion,
+  UnknownCommandType,
+  MalformedPayload,
+  // The record sequence does not follow the previous record one
+  OutOfSequence
+};
+
+auto encode(const Header& header, std::vector<std::byte>& buffer) -> void;
+
+// Appends an encoded record to the buffer,
+// the buffer is not cleared to allow its reuse between records.
+auto encode(std::uint64_t sequence,
+            core::sys_us time,
+            const Command& command,
+            std::vector<std::byte>& buffer) -> void;
+
+[[nodiscard]]
+auto decode_header(std::span<const std::byte> buffer)
+    -> tl::expected<Header, DecodingError>;
+
+struct DecodedRecord {
+  Record record;
+  // The number of bytes the record occupies in the buffer
+  std::size_t size = 0;
+};
+
+[[nodiscard]]
+auto decode_record(std::span<const std::byte> buffer)
+    -> tl::expected<DecodedRecord, DecodingError>;
+
+[[nodiscard]]
+auto describe(DecodingError error) -> const char*;
+
+}  // namespace simulator::trading_system::journal
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_CODEC_HPP_
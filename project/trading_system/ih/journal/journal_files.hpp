@@ -0,0 +1,46 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_FILES_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_FILES_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/instrument.hpp"
+
+namespace simulator::trading_system::journal {
+
+// Journals of all engines are kept in a directory next to the market state
+// persistence file, a journal file is named after an instrument key and
+// a generation: "<key>.<generation>.journal".
+// A new generation starts each time the instrument state is stored.
+
+[[nodiscard]]
+auto journal_directory(const std::filesystem::path& persistence_file_path)
+    -> std::filesystem::path;
+
+// Returns a key identifying the instrument across venue restarts,
+// the database identifier is preferred as internal identifiers are
+// assigned in the instruments loading order
+[[nodiscard]]
+auto journal_key(const Instrument& instrument) -> std::string;
+
+[[nodiscard]]
+auto journal_file_path(const std::filesystem::path& directory,
+                       std::string_view key,
+                       std::uint64_t generation) -> std::filesystem::path;
+
+// Returns generations of the instrument journals in ascending order
+[[nodiscard]]
+auto list_generations(const std::filesystem::path& directory,
+                      std::string_view key) -> std::vector<std::uint64_t>;
+
+// Removes the instrument journals, which are older than the given generation
+auto remove_generations_before(const std::filesystem::path& directory,
+                               std::string_view key,
+                               std::uint64_t generation) -> void;
+
+}  // namespace simulator::trading_system::journal
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_FILES_HPP_
@@ -0,0 +1,53 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_READER_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_READER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <tl/expected.hpp>
+#include <vector>
+
+#include "ih/journal/journal_codec.hpp"
+
+namespace simulator::trading_system::journal {
+
+// Reads records of a journal file in the order they were appended.
+// Reading stops at the first record, which can not be decoded,
+// records following a damaged one are never returned.
+class Reader {
+ public:
+  [[nodiscard]]
+  static auto open(const std::filesystem::path& file_path)
+      -> tl::expected<Reader, std::string>;
+
+  [[nodiscard]]
+  auto header() const noexcept -> const Header& {
+    return header_;
+  }
+
+  // Returns the next record, nothing at the end of the journal
+  // or when the next record is damaged
+  [[nodiscard]]
+  auto next() -> std::optional<Record>;
+
+  // Describes why reading stopped before the end of the journal
+  [[nodiscard]]
+  auto error() const noexcept -> std::optional<DecodingError> {
+    return error_;
+  }
+
+ private:
+  Reader(std::vector<std::byte> content, Header header);
+
+  std::vector<std::byte> content_;
+  Header header_;
+  std::size_t offset_ = HeaderSize;
+  std::uint64_t last_sequence_ = 0;
+  std::optional<DecodingError> error_;
+};
+
+}  // namespace simulator::trading_system::journal
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_READER_HPP_
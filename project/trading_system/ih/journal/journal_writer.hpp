@@ -0,0 +1,141 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_WRITER_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_WRITER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tl/expected.hpp>
+#include <vector>
+
+#include "ih/journal/journal_codec.hpp"
+
+namespace simulator::trading_system::journal {
+
+class Writer;
+
+// Commits records of all attached journal writers from a single background
+// thread (group commit): once records are appended to any writer, the
+// committer waits for the commit interval to elapse or for the buffered
+// records of a writer to reach its commit size, and then writes and syncs
+// the buffered records of every writer with a single fdatasync per file.
+// The committer sleeps without a timeout while no records are appended.
+class Committer {
+ public:
+  static constexpr std::chrono::microseconds DefaultCommitInterval{2000};
+
+  explicit Committer(
+      std::chrono::microseconds commit_interval = DefaultCommitInterval);
+  Committer(const Committer&) = delete;
+  Committer(Committer&&) = delete;
+  // Writers are to be detached before, they commit the remaining records
+  // themselves
+  ~Committer() noexcept;
+
+  auto operator=(const Committer&) -> Committer& = delete;
+  auto operator=(Committer&&) -> Committer& = delete;
+
+  auto attach(Writer& writer) -> void;
+
+  // Returns once the writer is not being committed
+  auto detach(Writer& writer) -> void;
+
+  // Wakes the committer up once records are appended,
+  // the records are committed immediately when the commit is due
+  auto notify_appended(bool commit_due) -> void;
+
+ private:
+  auto run() -> void;
+
+  auto commit_writers() -> void;
+
+  std::chrono::microseconds commit_interval_;
+
+  // Guards the appended records flags and the stop flag
+  std::mutex mutex_;
+  std::condition_variable records_appended_;
+  bool records_pending_ = false;
+  bool commit_due_ = false;
+  bool stopped_ = false;
+
+  // Guards the attached writers, is held while the writers are committed
+  std::mutex writers_mutex_;
+  std::vector<Writer*> writers_;
+
+  std::thread thread_;
+};
+
+// Appends records to a journal file, the records are buffered in memory
+// and written by the committer the writer is attached to.
+//
+// Appending does not wait for the commit, so records appended during
+// the last commit interval are lost when the process crashes.
+class Writer {
+ public:
+  struct Settings {
+    std::size_t commit_size = 256 * 1024;
+  };
+
+  // Creates a new journal file, an existing file is not overwritten.
+  // The writer is attached to the committer while it is alive.
+  [[nodiscard]]
+  static auto create(const std::filesystem::path& file_path,
+                     std::uint64_t generation,
+                     Settings settings,
+                     Committer& committer)
+      -> tl::expected<std::unique_ptr<Writer>, std::string>;
+
+  Writer(const Writer&) = delete;
+  Writer(Writer&&) = delete;
+  // Detaches from the committer, commits the buffered records
+  // and closes the file
+  ~Writer() noexcept;
+
+  auto operator=(const Writer&) -> Writer& = delete;
+  auto operator=(Writer&&) -> Writer& = delete;
+
+  // Appends a command journaled at the current time
+  auto append(const Command& command) -> void;
+
+  // Writes and syncs the buffered records, returns once they are durable
+  auto commit() -> void;
+
+  [[nodiscard]]
+  auto generation() const noexcept -> std::uint64_t {
+    return generation_;
+  }
+
+ private:
+  Writer(int file_descriptor,
+         std::filesystem::path file_path,
+         std::uint64_t generation,
+         Settings settings,
+         Committer& committer);
+
+  auto write_all(const std::vector<std::byte>& bytes) -> bool;
+
+  Settings settings_;
+  std::filesystem::path file_path_;
+  std::uint64_t generation_;
+  int file_descriptor_;
+  Committer& committer_;
+  bool attached_ = false;
+
+  // Guards the buffered records and the sequence
+  std::mutex mutex_;
+  std::vector<std::byte> pending_;
+  std::uint64_t last_sequence_ = 0;
+
+  // Serializes commits, guards the records being committed
+  std::mutex commit_mutex_;
+  std::vector<std::byte> committing_;
+};
+
+}  // namespace simulator::trading_system::journal
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNAL_WRITER_HPP_
@@ -0,0 +1,97 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNALING_TRADING_ENGINE_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNALING_TRADING_ENGINE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "common/trading_engine.hpp"
+#include "ih/journal/journal_reader.hpp"
+#include "ih/journal/journal_writer.hpp"
+
+namespace simulator::trading_system::journal {
+
+// Journals commands changing the instrument state before passing them
+// to the decorated engine, so that the state can be restored by replaying
+// the journal on top of the last stored state.
+//
+// Each stored state starts a new journal generation, the stored state
+// refers to the generation, from which the journal is to be replayed.
+// Journaling starts once the state is stored for the first time,
+// the journal is replayed only when the state is recovered before that,
+// i.e. at the venue start-up.
+//
+// Storing the state fails with an exception when a new journal generation
+// cannot be created, the previous generation is journaled to then.
+class JournalingTradingEngine final : public TradingEngine {
+ public:
+  JournalingTradingEngine(std::filesystem::path directory,
+                          std::string key,
+                          std::unique_ptr<TradingEngine> engine,
+                          Writer::Settings settings,
+                          std::shared_ptr<Committer> committer);
+
+  auto execute(protocol::OrderPlacementRequest request) -> void override;
+
+  auto execute(protocol::OrderModificationRequest request) -> void override;
+
+  auto execute(protocol::OrderCancellationRequest request) -> void override;
+
+  auto execute(protocol::OrderMassCancellationRequest request)
+      -> void override;
+
+  auto execute(protocol::MassQuoteRequest request) -> void override;
+
+  auto execute(protocol::MarketDataRequest request) -> void override;
+
+  auto execute(protocol::SecurityStatusRequest request) -> void override;
+
+  auto provide_state(protocol::InstrumentState& reply) -> void override;
+
+  auto store_state(market_state::InstrumentState& state) -> void override;
+
+  auto recover_state(market_state::InstrumentState state) -> void override;
+
+  auto provide_latency(protocol::EngineLatency& latency) -> void override;
+
+  auto handle(const protocol::SessionTerminatedEvent& event) -> void override;
+
+  auto handle(event::Tick tick) -> void override;
+
+  auto handle(event::PhaseTransition phase_transition) -> void override;
+
+  auto replay_at(core::sys_us journaled_at) -> void override;
+
+  auto finish_replay() -> void override;
+
+ private:
+  auto append(const Command& command) -> void;
+
+  auto start_generation() -> void;
+
+  auto replay_generations(std::uint64_t first_generation) -> void;
+
+  std::filesystem::path directory_;
+  std::string key_;
+  std::unique_ptr<TradingEngine> engine_;
+  Writer::Settings settings_;
+  // Outlives writers of the engine
+  std::shared_ptr<Committer> committer_;
+
+  // Keeps journal records in the order commands are passed to the engine
+  std::mutex mutex_;
+  std::unique_ptr<Writer> writer_;
+  std::uint64_t last_generation_ = 0;
+  bool journaling_started_ = false;
+};
+
+// Passes journaled commands to the engine in the order they were journaled,
+// each one as replayed at the time it was journaled at.
+// Returns the number of replayed commands.
+auto replay(Reader& reader, TradingEngine& engine) -> std::uint64_t;
+
+}  // namespace simulator::trading_system::journal
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_JOURNAL_JOURNALING_TRADING_ENGINE_HPP_
@@ -1,6 +1,7 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_IH_REPOSITORY_TRADING_ENGINES_REPOSITORY_HPP_
 #define SIMULATOR_TRADING_SYSTEM_IH_REPOSITORY_TRADING_ENGINES_REPOSITORY_HPP_
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <unordered_map>
@@ -13,6 +14,11 @@ namespace simulator::trading_system {
 
 // Trading engines repository keeps track of all trading engines in the system.
 // The repository is responsible for managing the lifetime of trading engines.
+//
+// Engines are routed through a flat table indexed by instrument identifiers:
+// the identifiers are generated sequentially when instruments are loaded,
+// so they are dense. An identifier too large to keep the table dense
+// is routed through a hash map instead.
 class TradingEnginesRepository {
   struct InstrumentIdHasher {
     auto operator()(InstrumentId identifier) const -> std::size_t;
@@ -20,8 +26,13 @@ class TradingEnginesRepository {
 
   using EngineReference = std::reference_wrapper<TradingEngine>;
   using Storage = std::vector<std::unique_ptr<TradingEngine>>;
-  using ByInstrumentLookupTable =
-      std::unordered_map<InstrumentId, EngineReference, InstrumentIdHasher>;
+  using RoutingTable = std::vector<TradingEngine*>;
+  using SparseLookupTable =
+      std::unordered_map<InstrumentId, TradingEngine*, InstrumentIdHasher>;
+
+  // The routing table is kept at most this many slots larger
+  // than twice the number of engines
+  constexpr static std::size_t MaxRoutingTableSlack = 1024;
 
  public:
   TradingEnginesRepository() = default;
@@ -49,10 +60,17 @@ class TradingEnginesRepository {
   auto associate_instrument_with_engine(InstrumentId instrument_id,
                                         TradingEngine& engine) -> void;
 
+  [[nodiscard]]
+  auto find_route(InstrumentId identifier) const -> TradingEngine*;
+
+  [[nodiscard]]
+  auto fits_routing_table(InstrumentId identifier) const -> bool;
+
   auto apply_for_each_engine(
       const std::function<void(TradingEngine&)>& function) const -> void;
 
-  ByInstrumentLookupTable by_instrument_lookup_;
+  RoutingTable routing_table_;
+  SparseLookupTable sparse_lookup_;
   Storage engines_;
 };
 
@@ -25,11 +25,24 @@ class MarketStatePersistenceController {
       std::string venue_id,
       std::vector<Instrument>&& instruments);
 
+  // Stores the market state and starts new generations of engine journals,
+  // journals preceding the stored state are removed
   auto store() -> core::code::StoreMarketState;
 
+  // Recovers the stored market state, the state is stored again,
+  // so that engine journals start from the recovered state
   auto recover() -> RecoverResult;
 
+  // Recovers the market state at the venue start-up: the stored state is
+  // recovered and engine journals are replayed on top of it,
+  // the resulting state is stored to start new journal generations
+  auto restore() -> RecoverResult;
+
  private:
+  auto recover_stored_state() -> RecoverResult;
+
+  auto checkpoint() -> void;
+
   const Config& config_;
   const Executor& executor_;
   gsl::not_null<std::unique_ptr<Serializer>> serializer_;
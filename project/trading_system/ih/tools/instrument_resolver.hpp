@@ -1,10 +1,12 @@
 #ifndef SIMULATOR_TRADING_SYSTEM_IH_TOOLS_INSTRUMENT_RESOLVER_HPP_
 #define SIMULATOR_TRADING_SYSTEM_IH_TOOLS_INSTRUMENT_RESOLVER_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <tl/expected.hpp>
 
 #include "core/domain/instrument_descriptor.hpp"
+#include "ih/tools/resolution_memo.hpp"
 #include "instruments/cache.hpp"
 #include "instruments/lookup_error.hpp"
 #include "instruments/view.hpp"
@@ -28,10 +30,18 @@ struct InstrumentResolver {
   [[nodiscard]]
   virtual auto resolve_instrument(const Instrument& instrument) const
       -> tl::expected<instrument::View, instrument::LookupError> = 0;
+
+  // Reports how many descriptors were resolved from the memo
+  [[nodiscard]]
+  virtual auto memo_statistics() const -> ResolutionMemoStatistics = 0;
 };
 
+// Creates a resolver, which memoizes results of descriptors resolution
+// until instruments are reloaded into the cache
 [[nodiscard]]
-auto create_cached_instrument_resolver(const instrument::Cache& cache)
+auto create_cached_instrument_resolver(
+    const instrument::Cache& cache,
+    std::size_t memo_capacity = ResolutionMemo::DefaultCapacity)
     -> std::unique_ptr<InstrumentResolver>;
 
 }  // namespace simulator::trading_system
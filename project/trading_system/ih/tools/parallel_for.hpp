@@ -0,0 +1,22 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_TOOLS_PARALLEL_FOR_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_TOOLS_PARALLEL_FOR_HPP_
+
+#include <cstddef>
+#include <functional>
+
+namespace simulator::trading_system {
+
+// Invokes `task(index)` for each index in [0, count) on a temporary pool
+// of `workers` threads (hardware concurrency, when zero) and returns when
+// all the tasks are done.
+//
+// Indexes are claimed by workers one by one, so the tasks may complete
+// in any order. Once a task throws, the rest of the unclaimed tasks
+// are skipped and the first thrown exception is rethrown to the caller.
+auto parallel_for(std::size_t count,
+                  const std::function<void(std::size_t)>& task,
+                  std::size_t workers = 0) -> void;
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_TOOLS_PARALLEL_FOR_HPP_
@@ -0,0 +1,117 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_TOOLS_RESOLUTION_MEMO_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_TOOLS_RESOLUTION_MEMO_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <tl/expected.hpp>
+#include <utility>
+#include <vector>
+
+#include "core/domain/instrument_descriptor.hpp"
+#include "instruments/lookup_error.hpp"
+#include "instruments/view.hpp"
+
+namespace simulator::trading_system {
+
+struct ResolutionMemoStatistics {
+  std::uint64_t hits = 0;
+  std::uint64_t misses = 0;
+};
+
+// Bounded memo of instrument descriptors resolution results.
+//
+// Results are keyed by descriptor identifying fields (all the fields
+// a lookup reads, the requester instrument id is ignored) and tagged
+// with a generation of the instruments they were resolved from.
+// A result of another generation is never returned, so the memo is
+// invalidated by an instruments universe reload.
+//
+// The memo is split into shards guarded by their own mutexes,
+// each shard is a direct-mapped table: a new result replaces
+// a result stored in the same slot.
+class ResolutionMemo {
+ public:
+  using Result = tl::expected<instrument::View, instrument::LookupError>;
+
+  constexpr static std::size_t ShardsCount = 16;
+  constexpr static std::size_t DefaultCapacity = 4096;
+
+  explicit ResolutionMemo(std::size_t capacity = DefaultCapacity);
+
+  // Returns a memoized result for the descriptor of a given generation,
+  // invokes `resolve(descriptor)` and memoizes its result on a miss.
+  template <typename Resolver>
+  auto resolve(const InstrumentDescriptor& descriptor,
+               std::uint64_t generation,
+               Resolver&& resolve) -> Result;
+
+  [[nodiscard]]
+  auto statistics() const noexcept -> ResolutionMemoStatistics;
+
+  [[nodiscard]]
+  static auto hash(const InstrumentDescriptor& descriptor) noexcept
+      -> std::size_t;
+
+  // Checks whether descriptors are resolved identically
+  [[nodiscard]]
+  static auto same_identity(const InstrumentDescriptor& lhs,
+                            const InstrumentDescriptor& rhs) -> bool;
+
+ private:
+  struct Entry {
+    InstrumentDescriptor descriptor;
+    Result result;
+    std::size_t hash;
+    std::uint64_t generation;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::vector<std::optional<Entry>> slots;
+  };
+
+  [[nodiscard]]
+  auto find(const InstrumentDescriptor& descriptor,
+            std::size_t hash,
+            std::uint64_t generation) -> std::optional<Result>;
+
+  auto store(const InstrumentDescriptor& descriptor,
+             std::size_t hash,
+             std::uint64_t generation,
+             const Result& result) -> void;
+
+  [[nodiscard]]
+  auto shard_of(std::size_t hash) noexcept -> Shard&;
+
+  [[nodiscard]]
+  static auto slot_of(Shard& shard, std::size_t hash) noexcept
+      -> std::optional<Entry>&;
+
+  std::array<Shard, ShardsCount> shards_;
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+};
+
+template <typename Resolver>
+auto ResolutionMemo::resolve(const InstrumentDescriptor& descriptor,
+                             std::uint64_t generation,
+                             Resolver&& resolve) -> Result {
+  const std::size_t descriptor_hash = hash(descriptor);
+  if (auto result = find(descriptor, descriptor_hash, generation)) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return *std::move(result);
+  }
+
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  Result result = std::forward<Resolver>(resolve)(descriptor);
+  store(descriptor, descriptor_hash, generation, result);
+  return result;
+}
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_TOOLS_RESOLUTION_MEMO_HPP_
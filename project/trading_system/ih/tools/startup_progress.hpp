@@ -0,0 +1,60 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_TOOLS_STARTUP_PROGRESS_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_TOOLS_STARTUP_PROGRESS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "protocol/admin/startup_progress.hpp"
+
+namespace simulator::trading_system {
+
+// Tracks the trading system start-up: construction of trading engines
+// and recovery of their states.
+//
+// The progress is updated by start-up workers and may be reported
+// concurrently, engines recovered after the start-up are not counted.
+class StartupProgress {
+ public:
+  using Stage = protocol::StartupProgressReply::Stage;
+
+  StartupProgress() noexcept;
+
+  auto begin_construction(std::size_t engines_total) noexcept -> void;
+
+  auto engine_constructed() noexcept -> void;
+
+  auto begin_recovery() noexcept -> void;
+
+  auto engine_recovered() noexcept -> void;
+
+  auto complete() noexcept -> void;
+
+  auto fail() noexcept -> void;
+
+  [[nodiscard]]
+  auto stage() const noexcept -> Stage;
+
+  auto report(protocol::StartupProgressReply& reply) const -> void;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  [[nodiscard]]
+  auto elapsed() const noexcept -> std::chrono::milliseconds;
+
+  auto finish(Stage stage) noexcept -> void;
+
+  Clock::time_point started_at_;
+  std::atomic<Stage> stage_{Stage::Initializing};
+  std::atomic<std::uint64_t> engines_total_{0};
+  std::atomic<std::uint64_t> engines_constructed_{0};
+  std::atomic<std::uint64_t> engines_recovered_{0};
+  // Start-up duration in milliseconds, negative until the start-up finishes
+  std::atomic<std::int64_t> duration_{-1};
+};
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_TOOLS_STARTUP_PROGRESS_HPP_
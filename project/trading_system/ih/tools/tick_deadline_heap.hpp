@@ -0,0 +1,87 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_TOOLS_TICK_DEADLINE_HEAP_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_TOOLS_TICK_DEADLINE_HEAP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "common/attributes.hpp"
+#include "common/events.hpp"
+#include "common/tick_scheduler.hpp"
+#include "core/tools/time.hpp"
+
+namespace simulator::trading_system {
+
+// Keeps deadlines of trading engines, so that a tick is dispatched only
+// to engines, which deadlines are due at it.
+//
+// Timed deadlines are ordered in a min-heap, a replaced deadline is not
+// removed from the heap, but is skipped once it reaches the top.
+// New day deadlines are due at the same tick, they are not ordered.
+// An entry of an instrument is kept once its deadline is taken,
+// as its engine is likely to schedule a new one.
+class TickDeadlineHeap final : public TickScheduler {
+ public:
+  auto schedule(InstrumentId instrument_id, TickDeadline deadline)
+      -> void override;
+
+  auto reschedule(InstrumentId instrument_id,
+                  std::optional<TickDeadline> deadline) -> void override;
+
+  // Removes deadlines due at the tick, returns identifiers of instruments
+  // which engines are to handle the tick, timed deadlines go first
+  // in the deadlines order
+  [[nodiscard]]
+  auto take_due(const event::Tick& tick) -> std::vector<InstrumentId>;
+
+  // Returns the number of instrument engines with a deadline
+  [[nodiscard]]
+  auto size() const -> std::size_t;
+
+ private:
+  struct InstrumentIdHasher {
+    auto operator()(InstrumentId identifier) const -> std::size_t;
+  };
+
+  struct Entry {
+    // Is empty when no deadline is scheduled
+    TickDeadline deadline;
+    // Identifies a heap node referring to the deadline time
+    std::uint64_t version = 0;
+  };
+
+  struct Node {
+    core::sys_us time;
+    InstrumentId instrument_id;
+    std::uint64_t version = 0;
+
+    auto operator>(const Node& other) const -> bool {
+      return time > other.time;
+    }
+  };
+
+  // Stale nodes are dropped once the heap is this many times larger
+  // than the number of scheduled deadlines
+  constexpr static std::size_t CompactionFactor = 4;
+
+  auto store(InstrumentId instrument_id,
+             Entry& entry,
+             const TickDeadline& deadline) -> void;
+
+  auto compact() -> void;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<InstrumentId, Entry, InstrumentIdHasher> entries_;
+  std::priority_queue<Node, std::vector<Node>, std::greater<>> heap_;
+  std::size_t scheduled_ = 0;
+  std::uint64_t last_version_ = 0;
+};
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_TOOLS_TICK_DEADLINE_HEAP_HPP_
@@ -0,0 +1,56 @@
+#ifndef SIMULATOR_TRADING_SYSTEM_IH_TOOLS_VENUE_EXECUTOR_HPP_
+#define SIMULATOR_TRADING_SYSTEM_IH_TOOLS_VENUE_EXECUTOR_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "cfg/api/cfg.hpp"
+#include "runtime/service.hpp"
+
+namespace simulator::trading_system {
+
+// Runs tasks of a hosted venue on an executor shared by the venues
+// hosted by the process.
+//
+// Tasks run bound to the venue the executor is constructed in and
+// their duration is charged to the venue. `await` waits for the tasks
+// of this venue only, so that a venue can be terminated while other
+// venues keep running on the shared executor.
+class VenueExecutor : public runtime::Service {
+ public:
+  explicit VenueExecutor(runtime::Service& shared_executor);
+
+  auto execute(std::function<void()> task) -> void override;
+
+  // Returns when all the tasks submitted so far (and the tasks they
+  // submit) are done
+  auto await() const noexcept -> void;
+
+ private:
+  struct State {
+    explicit State(const cfg::HostedVenueConfiguration* venue) noexcept
+        : venue(venue) {}
+
+    const cfg::HostedVenueConfiguration* venue;
+    std::atomic<std::size_t> pending{0};
+  };
+
+  static auto run(State& state, const std::function<void()>& task) -> void;
+
+  // Charges the task duration to the venue and marks the task done,
+  // is called whether the task has returned or thrown
+  static auto complete(State& state, std::chrono::nanoseconds duration) noexcept
+      -> void;
+
+  runtime::Service& shared_executor_;
+  // Is shared with the submitted tasks, which may complete
+  // after the executor has observed them done and been destroyed
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace simulator::trading_system
+
+#endif  // SIMULATOR_TRADING_SYSTEM_IH_TOOLS_VENUE_EXECUTOR_HPP_
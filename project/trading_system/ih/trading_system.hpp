@@ -2,26 +2,73 @@
 #define SIMULATOR_TRADING_SYSTEM_IH_TRADING_SYSTEM_HPP_
 
 #include <atomic>
+#include <future>
 #include <memory>
+#include <utility>
 
+#include "cfg/api/venue_scope.hpp"
 #include "config/config.hpp"
+#include "ih/tools/startup_progress.hpp"
 #include "ih/trading_system_facade.hpp"
 #include "instruments/cache.hpp"
 #include "log/logging.hpp"
+#include "runtime/service.hpp"
+#include "runtime/thread_pool.hpp"
 #include "trading_system/trading_system.hpp"
 
 namespace simulator::trading_system {
 
+struct SharedExecutor::Implementation {
+  runtime::ThreadPool thread_pool =
+      runtime::ThreadPool::create_simple_thread_pool();
+};
+
+// The trading system facade is constructed in the background,
+// so that the start-up progress can be reported while engines
+// are constructed and recovered. Requests are ignored until
+// the system is launched, the launch awaits the facade construction.
+//
+// The background construction is bound to the venue of the creating
+// thread, so that a hosted venue reads its own configuration.
 struct System::Implementation {
-  explicit Implementation(Config config, instrument::Cache instruments)
-      : trading_system_facade_(std::make_unique<TradingSystemFacade>(
-            std::move(config), std::move(instruments))) {}
+  explicit Implementation(Config config,
+                          instrument::Cache instruments,
+                          runtime::Service* shared_executor = nullptr)
+      : startup_(std::async(
+            std::launch::async,
+            cfg::bind_venue_scope([this,
+                                   shared_executor,
+                                   config = std::move(config),
+                                   instruments =
+                                       std::move(instruments)]() mutable {
+              return create_facade(
+                  std::move(config), std::move(instruments), shared_executor);
+            }))) {}
+
+  Implementation(const Implementation&) = delete;
+  Implementation(Implementation&&) = delete;
+  ~Implementation() = default;
 
-  auto launch() -> void { launched_ = true; }
+  auto operator=(const Implementation&) -> Implementation& = delete;
+  auto operator=(Implementation&&) -> Implementation& = delete;
+
+  auto launch() -> void {
+    trading_system_facade_ = startup_.get();
+    launched_ = true;
+  }
 
   auto terminate() -> void {
     launched_ = false;
-    trading_system_facade_->terminate();
+    if (startup_.valid()) {
+      trading_system_facade_ = startup_.get();
+    }
+    if (trading_system_facade_) {
+      trading_system_facade_->terminate();
+    }
+  }
+
+  auto report(protocol::StartupProgressReply& reply) const -> void {
+    startup_progress_.report(reply);
   }
 
   template <typename... Args>
@@ -45,8 +92,25 @@ struct System::Implementation {
   }
 
  private:
+  auto create_facade(Config config,
+                     instrument::Cache instruments,
+                     runtime::Service* shared_executor)
+      -> std::unique_ptr<TradingSystemFacade> try {
+    return std::make_unique<TradingSystemFacade>(std::move(config),
+                                                 std::move(instruments),
+                                                 startup_progress_,
+                                                 shared_executor);
+  } catch (...) {
+    startup_progress_.fail();
+    throw;
+  }
+
+  StartupProgress startup_progress_;
   std::unique_ptr<TradingSystemFacade> trading_system_facade_;
   std::atomic<bool> launched_ = false;
+  // Declared last to be destroyed first: the destruction awaits
+  // the facade construction which refers to the members above
+  std::future<std::unique_ptr<TradingSystemFacade>> startup_;
 };
 
 }  // namespace simulator::trading_system
@@ -8,12 +8,18 @@
 #include "ih/config/config.hpp"
 #include "ih/execution/execution_system.hpp"
 #include "ih/state_persistence/market_state_persistence_controller.hpp"
+#include "ih/tools/startup_progress.hpp"
+#include "ih/tools/tick_deadline_heap.hpp"
+#include "ih/tools/venue_executor.hpp"
 #include "instruments/cache.hpp"
+#include "protocol/admin/engine_latency.hpp"
 #include "protocol/admin/market_state.hpp"
 #include "protocol/admin/trading_phase.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -21,13 +27,21 @@
 #include "repository/repository_accessor.hpp"
 #include "repository/trading_engines_repository.hpp"
 #include "runtime/loop.hpp"
+#include "runtime/service.hpp"
 #include "runtime/thread_pool.hpp"
 
 namespace simulator::trading_system {
 
 class TradingSystemFacade {
  public:
-  TradingSystemFacade(Config config, instrument::Cache instruments);
+  // Constructs trading engines and recovers their states,
+  // reporting the start-up progress to `startup_progress`.
+  // Engines run on `shared_executor` when it is given,
+  // otherwise on a thread pool owned by the facade
+  TradingSystemFacade(Config config,
+                      instrument::Cache instruments,
+                      StartupProgress& startup_progress,
+                      runtime::Service* shared_executor = nullptr);
 
   auto execute(protocol::OrderPlacementRequest request) -> void;
 
@@ -35,6 +49,10 @@ class TradingSystemFacade {
 
   auto execute(protocol::OrderCancellationRequest request) -> void;
 
+  auto execute(protocol::OrderMassCancellationRequest request) -> void;
+
+  auto execute(protocol::MassQuoteRequest request) -> void;
+
   auto execute(protocol::MarketDataRequest request) -> void;
 
   auto execute(const protocol::SecurityStatusRequest& request) -> void;
@@ -54,6 +72,9 @@ class TradingSystemFacade {
   auto execute(const protocol::RecoverMarketStateRequest& request,
                protocol::RecoverMarketStateReply& reply) -> void;
 
+  auto execute(const protocol::EngineLatencyRequest& request,
+               protocol::EngineLatencyReply& reply) -> void;
+
   auto react_on(const protocol::SessionTerminatedEvent& event) -> void;
 
   auto terminate() -> void;
@@ -67,13 +88,27 @@ class TradingSystemFacade {
 
   auto process(const event::PhaseTransition& event) -> void;
 
-  runtime::ThreadPool thread_pool_;
+  auto collect_latency(protocol::EngineLatencyReply& reply) const -> void;
+
+  auto dump_latency() const -> void;
+
+  auto executor() noexcept -> runtime::Service&;
+
+  auto await_executor() noexcept -> void;
+
+  // Exactly one of the two is set: the own pool of a single-venue
+  // process or the executor running the venue tasks on a shared pool
+  std::unique_ptr<runtime::ThreadPool> thread_pool_;
+  std::unique_ptr<VenueExecutor> venue_executor_;
   runtime::Loop event_loop_;
   instrument::Cache instruments_;
   Config config_;
+  StartupProgress& startup_progress_;
 
   std::unique_ptr<InstrumentResolver> instrument_resolver_;
 
+  // Outlives trading engines, which register their deadlines in it
+  TickDeadlineHeap tick_deadlines_;
   TradingEnginesRepository engines_repository_;
   std::unique_ptr<RepositoryAccessor> repository_accessor_;
 
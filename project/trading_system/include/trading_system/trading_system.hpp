@@ -4,11 +4,15 @@
 #include <memory>
 
 #include "data_layer/api/database/context.hpp"
+#include "protocol/admin/engine_latency.hpp"
 #include "protocol/admin/market_state.hpp"
+#include "protocol/admin/startup_progress.hpp"
 #include "protocol/admin/trading_phase.hpp"
 #include "protocol/app/instrument_state_request.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_request.hpp"
 #include "protocol/app/security_status_request.hpp"
@@ -33,10 +37,38 @@ struct System {
   std::unique_ptr<Implementation> impl_;
 };
 
+// Threads shared by the trading systems of the venues
+// hosted by a single process
+struct SharedExecutor {
+  struct Implementation;
+
+  explicit SharedExecutor(std::unique_ptr<Implementation> impl) noexcept;
+  SharedExecutor(const SharedExecutor&) = delete;
+  SharedExecutor(SharedExecutor&&) noexcept;
+  ~SharedExecutor() noexcept;
+
+  auto operator=(const SharedExecutor&) -> SharedExecutor& = delete;
+  auto operator=(SharedExecutor&&) noexcept -> SharedExecutor&;
+
+  auto implementation() const noexcept -> Implementation&;
+
+ private:
+  std::unique_ptr<Implementation> impl_;
+};
+
+[[nodiscard]]
+auto create_shared_executor() -> SharedExecutor;
+
 [[nodiscard]]
 auto create_trading_system(const data_layer::database::Context& database)
     -> System;
 
+// Creates a trading system of the venue the calling thread is bound to,
+// running its engines on `executor`, which must outlive the system
+[[nodiscard]]
+auto create_trading_system(const data_layer::database::Context& database,
+                           SharedExecutor& executor) -> System;
+
 auto launch_trading_system(System& trading_system) -> void;
 
 auto terminate_trading_system(System& trading_system) noexcept -> void;
@@ -50,6 +82,12 @@ auto process(protocol::OrderModificationRequest request, System& trading_system)
 auto process(protocol::OrderCancellationRequest request, System& trading_system)
     -> void;
 
+auto process(protocol::OrderMassCancellationRequest request,
+             System& trading_system) -> void;
+
+auto process(protocol::MassQuoteRequest request, System& trading_system)
+    -> void;
+
 auto process(protocol::MarketDataRequest request, System& trading_system)
     -> void;
 
@@ -76,6 +114,15 @@ auto process(const protocol::RecoverMarketStateRequest& request,
              protocol::RecoverMarketStateReply& reply,
              System& trading_system) -> void;
 
+auto process(const protocol::EngineLatencyRequest& request,
+             protocol::EngineLatencyReply& reply,
+             System& trading_system) -> void;
+
+// Is served before the trading system is launched
+auto process(const protocol::StartupProgressRequest& request,
+             protocol::StartupProgressReply& reply,
+             System& trading_system) -> void;
+
 auto react_on(const protocol::SessionTerminatedEvent& event,
               System& trading_system) -> void;
 
@@ -5,6 +5,7 @@
 #include <chrono>
 #include <istream>
 #include <optional>
+#include <string_view>
 
 #include "core/tools/time.hpp"
 #include "ih/config/phase_entry_reader.hpp"
@@ -50,6 +51,41 @@ auto determine_trading_phase(data_layer::MarketPhase::Phase value)
   return std::nullopt;
 }
 
+auto determine_self_trade_prevention(
+    data_layer::Venue::SelfTradePrevention value)
+    -> matching_engine::SelfTradePrevention {
+  using Mode = data_layer::Venue::SelfTradePrevention;
+  switch (value) {
+    case Mode::None:
+      return matching_engine::SelfTradePrevention::None;
+    case Mode::CancelNewest:
+      return matching_engine::SelfTradePrevention::CancelNewest;
+    case Mode::CancelOldest:
+      return matching_engine::SelfTradePrevention::CancelOldest;
+    case Mode::CancelBoth:
+      return matching_engine::SelfTradePrevention::CancelBoth;
+    case Mode::Decrement:
+      return matching_engine::SelfTradePrevention::Decrement;
+  }
+  return matching_engine::SelfTradePrevention::None;
+}
+
+auto describe(matching_engine::SelfTradePrevention value) -> std::string_view {
+  switch (value) {
+    case matching_engine::SelfTradePrevention::None:
+      return "None";
+    case matching_engine::SelfTradePrevention::CancelNewest:
+      return "CancelNewest";
+    case matching_engine::SelfTradePrevention::CancelOldest:
+      return "CancelOldest";
+    case matching_engine::SelfTradePrevention::CancelBoth:
+      return "CancelBoth";
+    case matching_engine::SelfTradePrevention::Decrement:
+      return "Decrement";
+  }
+  return "Unknown";
+}
+
 }  // namespace
 
 auto PhaseEntryReader::operator()(const data_layer::MarketPhase& record)
@@ -159,6 +195,29 @@ auto VenueEntryReader::operator()(const data_layer::Venue& record) const
     destination_->set_trade_aggressor_streaming(value);
   }
 
+  {
+    constexpr auto max_depth = data_layer::Venue::MaxTnsHistoryDepth;
+    std::uint32_t value = record.tns_history_depth().value_or(1);
+    if (value > max_depth) {
+      log::warn(
+          "venue trades history depth {} exceeds the maximal supported depth, "
+          "{} is used instead",
+          value,
+          max_depth);
+      value = max_depth;
+    }
+    log::info("venue trades history depth: {}", value);
+    destination_->set_trade_history_depth(value);
+  }
+
+  {
+    const auto value = determine_self_trade_prevention(
+        record.self_trade_prevention().value_or(
+            data_layer::Venue::SelfTradePrevention::None));
+    log::info("venue self-trade prevention mode: {}", describe(value));
+    destination_->set_self_trade_prevention(value);
+  }
+
   {
     const bool value = not record.include_own_orders_flag().value_or(true);
     log::info("venue supports client's depth orders exclusion: {}", value);
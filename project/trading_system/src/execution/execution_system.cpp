@@ -1,8 +1,11 @@
 #include "ih/execution/execution_system.hpp"
 
+#include <cstddef>
 #include <string_view>
+#include <utility>
 
 #include "common/trading_engine.hpp"
+#include "ih/tools/parallel_for.hpp"
 #include "instruments/lookup_error.hpp"
 #include "log/logging.hpp"
 
@@ -27,6 +30,23 @@ auto make_operation(protocol::OrderCancellationRequest request) {
   };
 }
 
+auto make_operation(protocol::OrderMassCancellationRequest request) {
+  return [request = std::move(request)](TradingEngine& engine) mutable {
+    engine.execute(std::move(request));
+  };
+}
+
+auto make_broadcast_operation(
+    const protocol::OrderMassCancellationRequest& request) {
+  return [request](TradingEngine& engine) { engine.execute(request); };
+}
+
+auto make_operation(protocol::MassQuoteRequest request) {
+  return [request = std::move(request)](TradingEngine& engine) mutable {
+    engine.execute(std::move(request));
+  };
+}
+
 auto make_operation(protocol::MarketDataRequest request) {
   return [request = std::move(request)](TradingEngine& engine) mutable {
     engine.execute(std::move(request));
@@ -73,9 +93,11 @@ constexpr auto describe(instrument::LookupError error) -> std::string_view {
 
 ExecutionSystem::ExecutionSystem(
     const InstrumentResolver& instrument_resolver,
-    const RepositoryAccessor& repository_accessor) noexcept
+    const RepositoryAccessor& repository_accessor,
+    RecoveryListener on_engine_recovered) noexcept
     : instrument_resolver_(instrument_resolver),
-      repository_accessor_(repository_accessor) {}
+      repository_accessor_(repository_accessor),
+      on_engine_recovered_(std::move(on_engine_recovered)) {}
 
 auto ExecutionSystem::execute_request(
     protocol::OrderPlacementRequest request) const -> void {
@@ -107,6 +129,33 @@ auto ExecutionSystem::execute_request(
   }
 }
 
+auto ExecutionSystem::execute_request(
+    protocol::OrderMassCancellationRequest request) const -> void {
+  if (!request.instrument.has_value()) {
+    broadcast(make_broadcast_operation(request));
+    reject_notifier_.notify_mass_cancellation_broadcast(request);
+    return;
+  }
+
+  const auto view =
+      instrument_resolver_.resolve_instrument(*request.instrument);
+  if (view.has_value()) {
+    unicast(view->instrument().identifier, make_operation(std::move(request)));
+  } else {
+    reject_notifier_.reject(request, describe(view.error()));
+  }
+}
+
+auto ExecutionSystem::execute_request(protocol::MassQuoteRequest request) const
+    -> void {
+  const auto view = instrument_resolver_.resolve_instrument(request.instrument);
+  if (view.has_value()) {
+    unicast(view->instrument().identifier, make_operation(std::move(request)));
+  } else {
+    reject_notifier_.reject(request, describe(view.error()));
+  }
+}
+
 auto ExecutionSystem::execute_request(
     const protocol::InstrumentStateRequest& request,
     protocol::InstrumentState& reply) const -> void {
@@ -160,17 +209,22 @@ auto ExecutionSystem::store_state_request(
 
 auto ExecutionSystem::recover_state_request(
     std::vector<market_state::InstrumentState> instruments) const -> void {
-  for (auto&& instrument_state : instruments) {
+  parallel_for(instruments.size(), [&](std::size_t index) {
+    auto& instrument_state = instruments[index];
     const auto view =
         instrument_resolver_.resolve_instrument(instrument_state.instrument);
-    if (view.has_value()) {
-      unicast(view->instrument().identifier,
-              make_recover_operation(std::move(instrument_state)));
-    } else {
+    if (!view.has_value()) {
       log::warn("The instrument was not found, its recovery was ignored: {}",
                 instrument_state.instrument);
+      return;
     }
-  }
+
+    unicast(view->instrument().identifier,
+            make_recover_operation(std::move(instrument_state)));
+    if (on_engine_recovered_) {
+      on_engine_recovered_();
+    }
+  });
 }
 
 auto ExecutionSystem::handle(
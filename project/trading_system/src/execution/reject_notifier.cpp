@@ -11,6 +11,7 @@
 #include "idgen/order_id.hpp"
 #include "log/logging.hpp"
 #include "middleware/routing/trading_reply_channel.hpp"
+#include "protocol/app/order_mass_cancellation_report.hpp"
 #include "protocol/app/order_placement_reject.hpp"
 
 namespace simulator::trading_system {
@@ -109,6 +110,39 @@ auto RejectNotifier::reject(const protocol::OrderCancellationRequest& request,
   middleware::send_trading_reply(std::move(reject));
 }
 
+auto RejectNotifier::reject(
+    const protocol::OrderMassCancellationRequest& request,
+    std::string_view reason) const -> void {
+  protocol::BusinessMessageReject reject{request.session};
+  reject.ref_seq_num = request.seq_num;
+  reject.ref_message_type = RejectedMessageType::Option::OrderMassCancelRequest;
+  reject.business_reject_reason = BusinessRejectReason::Option::UnknownSecurity;
+  reject.text = RejectText{std::string(reason)};
+
+  if (const auto& rejected_id = request.client_order_id) {
+    reject.ref_id = BusinessRejectRefId(rejected_id->value());
+  }
+
+  log::debug("sending - {}", reject);
+  middleware::send_trading_reply(std::move(reject));
+}
+
+auto RejectNotifier::reject(const protocol::MassQuoteRequest& request,
+                            std::string_view reason) const -> void {
+  protocol::BusinessMessageReject reject{request.session};
+  reject.ref_seq_num = request.seq_num;
+  reject.ref_message_type = RejectedMessageType::Option::MassQuote;
+  reject.business_reject_reason = BusinessRejectReason::Option::UnknownSecurity;
+  reject.text = RejectText{std::string(reason)};
+
+  if (const auto& rejected_id = request.client_order_id) {
+    reject.ref_id = BusinessRejectRefId(rejected_id->value());
+  }
+
+  log::debug("sending - {}", reject);
+  middleware::send_trading_reply(std::move(reject));
+}
+
 auto RejectNotifier::reject(const protocol::MarketDataRequest& request,
                             std::string_view reason) const -> void {
   protocol::MarketDataReject reject{request.session};
@@ -157,4 +191,15 @@ auto RejectNotifier::notify_multiple_instruments_requested(
   middleware::send_trading_reply(std::move(reject));
 }
 
+auto RejectNotifier::notify_mass_cancellation_broadcast(
+    const protocol::OrderMassCancellationRequest& request) const -> void {
+  protocol::OrderMassCancellationReport report{request.session};
+  report.client_order_id = request.client_order_id;
+  report.venue_order_id = id_generator_->generate_identifiers().first;
+  report.side = request.side;
+
+  log::debug("sending - {}", report);
+  middleware::send_trading_reply(std::move(report));
+}
+
 }  // namespace simulator::trading_system
\ No newline at end of file
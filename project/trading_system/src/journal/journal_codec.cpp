@@ -0,0 +1,582 @@
+#include "ih/journal/journal_codec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "core/common/attribute.hpp"
+#include "core/domain/instrument_descriptor.hpp"
+#include "core/domain/party.hpp"
+#include "core/tools/time.hpp"
+#include "ih/journal/byte_stream.hpp"
+
+namespace simulator::trading_system::journal {
+namespace {
+
+constexpr std::uint32_t Magic = 0x4c4e524a;  // "JRNL"
+constexpr std::uint16_t Version = 2;
+
+// Sizes of the record length prefix, the command type with the sequence
+// and the time, and the checksum trailer
+constexpr std::size_t LengthSize = sizeof(std::uint32_t);
+constexpr std::size_t PrologueSize =
+    sizeof(std::uint8_t) + sizeof(std::uint64_t) + sizeof(std::int64_t);
+constexpr std::size_t ChecksumSize = sizeof(std::uint32_t);
+
+// Limits the length of a record read from a damaged journal
+constexpr std::uint32_t MaxRecordLength = 16 * 1024 * 1024;
+
+constexpr auto make_crc32_table() -> std::array<std::uint32_t, 256> {
+  std::array<std::uint32_t, 256> table{};
+  for (std::uint32_t index = 0; index < table.size(); ++index) {
+    std::uint32_t value = index;
+    for (int bit = 0; bit < 8; ++bit) {
+      value = (value & 1U) != 0 ? 0xedb88320U ^ (value >> 1U) : value >> 1U;
+    }
+    table[index] = value;
+  }
+  return table;
+}
+
+constexpr auto Crc32Table = make_crc32_table();
+
+auto crc32(std::span<const std::byte> bytes) noexcept -> std::uint32_t {
+  std::uint32_t crc = 0xffffffffU;
+  for (const auto byte : bytes) {
+    crc = Crc32Table[(crc ^ std::to_integer<std::uint32_t>(byte)) & 0xffU] ^
+          (crc >> 8U);
+  }
+  return crc ^ 0xffffffffU;
+}
+
+template <typename T>
+struct is_optional : std::false_type {};
+
+template <typename T>
+struct is_optional<std::optional<T>> : std::true_type {};
+
+template <typename T>
+struct is_vector : std::false_type {};
+
+template <typename T>
+struct is_vector<std::vector<T>> : std::true_type {};
+
+template <typename T>
+struct is_time_point : std::false_type {};
+
+template <typename Clock, typename Duration>
+struct is_time_point<std::chrono::time_point<Clock, Duration>>
+    : std::true_type {};
+
+auto write_fields(ByteWriter& writer, const Party& party) -> void;
+auto write_fields(ByteWriter& writer, const InstrumentDescriptor& instrument)
+    -> void;
+auto write_fields(ByteWriter& writer, const protocol::Session& session)
+    -> void;
+auto write_fields(ByteWriter& writer, const Phase& phase) -> void;
+auto write_fields(ByteWriter& writer, const protocol::QuoteEntry& entry)
+    -> void;
+
+auto read_fields(ByteReader& reader, std::type_identity<Party> /*type*/)
+    -> Party;
+auto read_fields(ByteReader& reader,
+                 std::type_identity<InstrumentDescriptor> /*type*/)
+    -> InstrumentDescriptor;
+auto read_fields(ByteReader& reader,
+                 std::type_identity<protocol::Session> /*type*/)
+    -> protocol::Session;
+auto read_fields(ByteReader& reader, std::type_identity<Phase> /*type*/)
+    -> Phase;
+auto read_fields(ByteReader& reader,
+                 std::type_identity<protocol::QuoteEntry> /*type*/)
+    -> protocol::QuoteEntry;
+
+template <typename T>
+auto write(ByteWriter& writer, const T& value) -> void {
+  if constexpr (std::is_same_v<T, bool>) {
+    writer.put(static_cast<std::uint8_t>(value ? 1 : 0));
+  } else if constexpr (std::is_enum_v<T>) {
+    writer.put(static_cast<std::underlying_type_t<T>>(value));
+  } else if constexpr (std::integral<T>) {
+    writer.put(value);
+  } else if constexpr (std::floating_point<T>) {
+    static_assert(sizeof(T) == sizeof(std::uint64_t));
+    writer.put(std::bit_cast<std::uint64_t>(value));
+  } else if constexpr (is_time_point<T>::value) {
+    writer.put(static_cast<std::int64_t>(value.time_since_epoch().count()));
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    writer.put(std::string_view{value});
+  } else if constexpr (core::attribute::RepresentsAttribute<T>) {
+    write(writer, value.value());
+  } else if constexpr (is_optional<T>::value) {
+    write(writer, value.has_value());
+    if (value.has_value()) {
+      write(writer, *value);
+    }
+  } else if constexpr (is_vector<T>::value) {
+    writer.put(static_cast<std::uint32_t>(value.size()));
+    for (const auto& element : value) {
+      write(writer, element);
+    }
+  } else {
+    write_fields(writer, value);
+  }
+}
+
+template <typename T>
+auto read(ByteReader& reader) -> T {
+  if constexpr (std::is_same_v<T, bool>) {
+    return reader.get<std::uint8_t>() != 0;
+  } else if constexpr (std::is_enum_v<T>) {
+    return static_cast<T>(reader.get<std::underlying_type_t<T>>());
+  } else if constexpr (std::integral<T>) {
+    return reader.get<T>();
+  } else if constexpr (std::floating_point<T>) {
+    return std::bit_cast<T>(reader.get<std::uint64_t>());
+  } else if constexpr (is_time_point<T>::value) {
+    using Duration = typename T::duration;
+    return T{Duration{
+        static_cast<typename Duration::rep>(reader.get<std::int64_t>())}};
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return reader.get_string();
+  } else if constexpr (core::attribute::RepresentsAttribute<T>) {
+    return T{read<typename T::value_type>(reader)};
+  } else if constexpr (is_optional<T>::value) {
+    if (read<bool>(reader)) {
+      return T{read<typename T::value_type>(reader)};
+    }
+    return std::nullopt;
+  } else if constexpr (is_vector<T>::value) {
+    const auto size = reader.get<std::uint32_t>();
+    T elements;
+    // Each element occupies at least a byte, a damaged size
+    // must not cause a huge allocation
+    elements.reserve(std::min<std::size_t>(size, reader.remaining()));
+    for (std::uint32_t index = 0; index < size && !reader.failed(); ++index) {
+      elements.push_back(read<typename T::value_type>(reader));
+    }
+    return elements;
+  } else {
+    return read_fields(reader, std::type_identity<T>{});
+  }
+}
+
+auto write_fields(ByteWriter& writer, const Party& party) -> void {
+  write(writer, party.party_id());
+  write(writer, party.source());
+  write(writer, party.role());
+}
+
+auto read_fields(ByteReader& reader, std::type_identity<Party> /*type*/)
+    -> Party {
+  auto party_id = read<PartyId>(reader);
+  const auto source = read<PartyIdSource>(reader);
+  const auto role = read<PartyRole>(reader);
+  return Party{std::move(party_id), source, role};
+}
+
+auto write_fields(ByteWriter& writer, const InstrumentDescriptor& instrument)
+    -> void {
+  write(writer, instrument.security_id);
+  write(writer, instrument.symbol);
+  write(writer, instrument.currency);
+  write(writer, instrument.security_exchange);
+  write(writer, instrument.parties);
+  write(writer, instrument.requester_instrument_id);
+  write(writer, instrument.security_type);
+  write(writer, instrument.security_id_source);
+}
+
+auto read_fields(ByteReader& reader,
+                 std::type_identity<InstrumentDescriptor> /*type*/)
+    -> InstrumentDescriptor {
+  InstrumentDescriptor instrument;
+  instrument.security_id = read<decltype(instrument.security_id)>(reader);
+  instrument.symbol = read<decltype(instrument.symbol)>(reader);
+  instrument.currency = read<decltype(instrument.currency)>(reader);
+  instrument.security_exchange =
+      read<decltype(instrument.security_exchange)>(reader);
+  instrument.parties = read<decltype(instrument.parties)>(reader);
+  instrument.requester_instrument_id =
+      read<decltype(instrument.requester_instrument_id)>(reader);
+  instrument.security_type = read<decltype(instrument.security_type)>(reader);
+  instrument.security_id_source =
+      read<decltype(instrument.security_id_source)>(reader);
+  return instrument;
+}
+
+// Sessions are encoded with indices of their alternatives
+static_assert(std::is_same_v<
+              std::variant_alternative_t<0, protocol::Session::ValueType>,
+              protocol::fix::Session>);
+static_assert(std::is_same_v<
+              std::variant_alternative_t<2, protocol::Session::ValueType>,
+              protocol::mdfeed::Session>);
+
+auto write_fields(ByteWriter& writer, const protocol::Session& session)
+    -> void {
+  writer.put(static_cast<std::uint8_t>(session.value.index()));
+  if (const auto* fix = std::get_if<protocol::fix::Session>(&session.value)) {
+    write(writer, fix->begin_string);
+    write(writer, fix->sender_comp_id);
+    write(writer, fix->target_comp_id);
+    write(writer, fix->client_sub_id);
+  }
+}
+
+auto read_fields(ByteReader& reader,
+                 std::type_identity<protocol::Session> /*type*/)
+    -> protocol::Session {
+  switch (reader.get<std::uint8_t>()) {
+    case 0: {
+      auto begin_string = read<protocol::fix::BeginString>(reader);
+      auto sender_comp_id = read<protocol::fix::SenderCompId>(reader);
+      auto target_comp_id = read<protocol::fix::TargetCompId>(reader);
+      protocol::fix::Session session{std::move(begin_string),
+                                     std::move(sender_comp_id),
+                                     std::move(target_comp_id)};
+      session.client_sub_id =
+          read<std::optional<protocol::fix::ClientSubId>>(reader);
+      return protocol::Session{std::move(session)};
+    }
+    case 2:
+      return protocol::Session{protocol::mdfeed::Session{}};
+    default:
+      return protocol::Session{protocol::generator::Session{}};
+  }
+}
+
+auto write_fields(ByteWriter& writer, const Phase& phase) -> void {
+  write(writer, phase.phase());
+  write(writer, phase.status());
+  const auto settings = phase.settings();
+  write(writer, settings.has_value() && settings->allow_cancels);
+}
+
+auto read_fields(ByteReader& reader, std::type_identity<Phase> /*type*/)
+    -> Phase {
+  const auto phase = read<TradingPhase>(reader);
+  const auto status = read<TradingStatus>(reader);
+  // Settings are kept by the phase only when its status requires them
+  return Phase{phase,
+               status,
+               Phase::Settings{.allow_cancels = read<bool>(reader)}};
+}
+
+auto write_fields(ByteWriter& writer, const protocol::QuoteEntry& entry)
+    -> void {
+  write(writer, entry.client_order_id);
+  write(writer, entry.order_price);
+  write(writer, entry.order_quantity);
+  write(writer, entry.side);
+}
+
+auto read_fields(ByteReader& reader,
+                 std::type_identity<protocol::QuoteEntry> /*type*/)
+    -> protocol::QuoteEntry {
+  protocol::QuoteEntry entry;
+  entry.client_order_id = read<decltype(entry.client_order_id)>(reader);
+  entry.order_price = read<decltype(entry.order_price)>(reader);
+  entry.order_quantity = read<decltype(entry.order_quantity)>(reader);
+  entry.side = read<decltype(entry.side)>(reader);
+  return entry;
+}
+
+auto encode_payload(ByteWriter& writer,
+                    const protocol::OrderPlacementRequest& request) -> void {
+  write(writer, request.session);
+  write(writer, request.instrument);
+  write(writer, request.parties);
+  write(writer, request.client_order_id);
+  write(writer, request.expire_time);
+  write(writer, request.expire_date);
+  write(writer, request.order_price);
+  write(writer, request.stop_price);
+  write(writer, request.order_quantity);
+  write(writer, request.display_quantity);
+  write(writer, request.short_sale_exempt_reason);
+  write(writer, request.time_in_force);
+  write(writer, request.order_type);
+  write(writer, request.side);
+}
+
+auto encode_payload(ByteWriter& writer,
+                    const protocol::OrderModificationRequest& request)
+    -> void {
+  write(writer, request.session);
+  write(writer, request.instrument);
+  write(writer, request.parties);
+  write(writer, request.orig_client_order_id);
+  write(writer, request.venue_order_id);
+  write(writer, request.client_order_id);
+  write(writer, request.expire_time);
+  write(writer, request.expire_date);
+  write(writer, request.order_price);
+  write(writer, request.order_quantity);
+  write(writer, request.short_sale_exempt_reason);
+  write(writer, request.time_in_force);
+  write(writer, request.order_type);
+  write(writer, request.side);
+}
+
+auto encode_payload(ByteWriter& writer,
+                    const protocol::OrderCancellationRequest& request)
+    -> void {
+  write(writer, request.session);
+  write(writer, request.instrument);
+  write(writer, request.orig_client_order_id);
+  write(writer, request.venue_order_id);
+  write(writer, request.client_order_id);
+  write(writer, request.parties);
+  write(writer, request.side);
+}
+
+auto encode_payload(ByteWriter& writer,
+                    const protocol::OrderMassCancellationRequest& request)
+    -> void {
+  write(writer, request.session);
+  write(writer, request.instrument);
+  write(writer, request.client_order_id);
+  write(writer, request.seq_num);
+  write(writer, request.parties);
+  write(writer, request.side);
+}
+
+auto encode_payload(ByteWriter& writer,
+                    const protocol::MassQuoteRequest& request) -> void {
+  write(writer, request.session);
+  write(writer, request.instrument);
+  write(writer, request.client_order_id);
+  write(writer, request.seq_num);
+  write(writer, request.parties);
+  write(writer, request.entries);
+}
+
+auto encode_payload(ByteWriter& writer,
+                    const protocol::SessionTerminatedEvent& event) -> void {
+  write(writer, event.session);
+}
+
+auto encode_payload(ByteWriter& writer, const event::Tick& tick) -> void {
+  write(writer, tick.sys_tick_time);
+  write(writer, tick.tz_tick_time);
+  write(writer, tick.is_new_sys_day);
+  write(writer, tick.is_new_tz_day);
+}
+
+auto encode_payload(ByteWriter& writer,
+                    const event::PhaseTransition& transition) -> void {
+  write(writer, transition.tz_time_point);
+  write(writer, transition.phase);
+}
+
+template <typename Request>
+auto read_request_fields(ByteReader& reader, Request& request) -> void {
+  request.instrument = read<InstrumentDescriptor>(reader);
+  if constexpr (!std::is_same_v<Request, protocol::OrderCancellationRequest>) {
+    request.parties = read<std::vector<Party>>(reader);
+  }
+  if constexpr (!std::is_same_v<Request, protocol::OrderPlacementRequest>) {
+    request.orig_client_order_id =
+        read<decltype(request.orig_client_order_id)>(reader);
+    request.venue_order_id = read<decltype(request.venue_order_id)>(reader);
+  }
+  request.client_order_id = read<decltype(request.client_order_id)>(reader);
+  if constexpr (std::is_same_v<Request, protocol::OrderCancellationRequest>) {
+    request.parties = read<std::vector<Party>>(reader);
+  } else {
+    request.expire_time = read<decltype(request.expire_time)>(reader);
+    request.expire_date = read<decltype(request.expire_date)>(reader);
+    request.order_price = read<decltype(request.order_price)>(reader);
+    if constexpr (std::is_same_v<Request, protocol::OrderPlacementRequest>) {
+      request.stop_price = read<decltype(request.stop_price)>(reader);
+    }
+    request.order_quantity = read<decltype(request.order_quantity)>(reader);
+    if constexpr (std::is_same_v<Request, protocol::OrderPlacementRequest>) {
+      request.display_quantity =
+          read<decltype(request.display_quantity)>(reader);
+    }
+    request.short_sale_exempt_reason =
+        read<decltype(request.short_sale_exempt_reason)>(reader);
+    request.time_in_force = read<decltype(request.time_in_force)>(reader);
+    request.order_type = read<decltype(request.order_type)>(reader);
+  }
+  request.side = read<decltype(request.side)>(reader);
+}
+
+auto read_request_fields(ByteReader& reader,
+                         protocol::OrderMassCancellationRequest& request)
+    -> void {
+  request.instrument = read<decltype(request.instrument)>(reader);
+  request.client_order_id = read<decltype(request.client_order_id)>(reader);
+  request.seq_num = read<decltype(request.seq_num)>(reader);
+  request.parties = read<std::vector<Party>>(reader);
+  request.side = read<decltype(request.side)>(reader);
+}
+
+auto read_request_fields(ByteReader& reader,
+                         protocol::MassQuoteRequest& request) -> void {
+  request.instrument = read<InstrumentDescriptor>(reader);
+  request.client_order_id = read<decltype(request.client_order_id)>(reader);
+  request.seq_num = read<decltype(request.seq_num)>(reader);
+  request.parties = read<std::vector<Party>>(reader);
+  request.entries = read<decltype(request.entries)>(reader);
+}
+
+template <typename Request>
+auto decode_request(ByteReader& reader) -> Command {
+  Request request{read<protocol::Session>(reader)};
+  read_request_fields(reader, request);
+  return request;
+}
+
+auto decode_payload(std::size_t type, ByteReader& reader)
+    -> tl::expected<Command, DecodingError> {
+  switch (type) {
+    case 0:
+      return decode_request<protocol::OrderPlacementRequest>(reader);
+    case 1:
+      return decode_request<protocol::OrderModificationRequest>(reader);
+    case 2:
+      return decode_request<protocol::OrderCancellationRequest>(reader);
+    case 3:
+      return protocol::SessionTerminatedEvent{read<protocol::Session>(reader)};
+    case 4: {
+      event::Tick tick;
+      tick.sys_tick_time = read<core::sys_us>(reader);
+      tick.tz_tick_time = read<core::tz_us>(reader);
+      tick.is_new_sys_day = read<bool>(reader);
+      tick.is_new_tz_day = read<bool>(reader);
+      return tick;
+    }
+    case 5: {
+      const auto tz_time_point = read<core::tz_us>(reader);
+      return event::PhaseTransition{.tz_time_point = tz_time_point,
+                                    .phase = read<Phase>(reader)};
+    }
+    case 6:
+      return decode_request<protocol::OrderMassCancellationRequest>(reader);
+    case 7:
+      return decode_request<protocol::MassQuoteRequest>(reader);
+    default:
+      return tl::unexpected{DecodingError::UnknownCommandType};
+  }
+}
+
+static_assert(std::variant_size_v<Command> == 8,
+              "decode_payload must handle every journaled command");
+
+}  // namespace
+
+auto encode(const Header& header, std::vector<std::byte>& buffer) -> void {
+  ByteWriter writer{buffer};
+  writer.put(Magic);
+  writer.put(Version);
+  writer.put(std::uint16_t{0});
+  writer.put(header.generation);
+}
+
+auto encode(std::uint64_t sequence,
+            core::sys_us time,
+            const Command& command,
+            std::vector<std::byte>& buffer) -> void {
+  ByteWriter writer{buffer};
+  const auto length_position = writer.position();
+  writer.put(std::uint32_t{0});
+
+  const auto body_position = writer.position();
+  writer.put(static_cast<std::uint8_t>(command.index()));
+  writer.put(sequence);
+  write(writer, time);
+  std::visit([&](const auto& concrete) { encode_payload(writer, concrete); },
+             command);
+
+  const auto body_size = writer.position() - body_position;
+  writer.put_at(length_position, static_cast<std::uint32_t>(body_size));
+  writer.put(crc32(std::span{buffer}.subspan(body_position, body_size)));
+}
+
+auto decode_header(std::span<const std::byte> buffer)
+    -> tl::expected<Header, DecodingError> {
+  if (buffer.size() < HeaderSize) {
+    return tl::unexpected{DecodingError::Truncated};
+  }
+
+  ByteReader reader{buffer};
+  if (reader.get<std::uint32_t>() != Magic) {
+    return tl::unexpected{DecodingError::UnknownMagic};
+  }
+  if (reader.get<std::uint16_t>() != Version) {
+    return tl::unexpected{DecodingError::UnsupportedVersion};
+  }
+  reader.get<std::uint16_t>();
+  return Header{.generation = reader.get<std::uint64_t>()};
+}
+
+auto decode_record(std::span<const std::byte> buffer)
+    -> tl::expected<DecodedRecord, DecodingError> {
+  ByteReader length_reader{buffer};
+  const auto body_size = length_reader.get<std::uint32_t>();
+  if (length_reader.failed()) {
+    return tl::unexpected{DecodingError::Truncated};
+  }
+  if (body_size < PrologueSize || body_size > MaxRecordLength) {
+    return tl::unexpected{DecodingError::MalformedPayload};
+  }
+  const std::size_t record_size = LengthSize + body_size + ChecksumSize;
+  if (buffer.size() < record_size) {
+    return tl::unexpected{DecodingError::Truncated};
+  }
+
+  const auto body = buffer.subspan(LengthSize, body_size);
+  ByteReader checksum_reader{buffer.subspan(LengthSize + body_size)};
+  if (checksum_reader.get<std::uint32_t>() != crc32(body)) {
+    return tl::unexpected{DecodingError::ChecksumMismatch};
+  }
+
+  ByteReader reader{body};
+  const auto type = reader.get<std::uint8_t>();
+  const auto sequence = reader.get<std::uint64_t>();
+  const auto time = read<core::sys_us>(reader);
+  auto command = decode_payload(type, reader);
+  if (!command.has_value()) {
+    return tl::unexpected{command.error()};
+  }
+  if (reader.failed() || reader.remaining() != 0) {
+    return tl::unexpected{DecodingError::MalformedPayload};
+  }
+
+  return DecodedRecord{
+      .record = Record{.sequence = sequence,
+                       .time = time,
+                       .command = std::move(*command)},
+      .size = record_size};
+}
+
+auto describe(DecodingError error) -> const char* {
+  switch (error) {
+    case DecodingError::Truncated:
+      return "journal ends in the middle of a record";
+    case DecodingError::ChecksumMismatch:
+      return "record checksum does not match its content";
+    case DecodingError::UnknownMagic:
+      return "file is not a command journal";
+    case DecodingError::UnsupportedVersion:
+      return "journal format version is not supported";
+    case DecodingError::UnknownCommandType:
+      return "record has an unknown command type";
+    case DecodingError::MalformedPayload:
+      return "record payload is malformed";
+    case DecodingError::OutOfSequence:
+      return "record sequence does not follow the previous record";
+  }
+  return "unknown decoding error";
+}
+
+}  // namespace simulator::trading_system::journal
@@ -0,0 +1,94 @@
+#include "ih/journal/journal_files.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <optional>
+#include <system_error>
+
+#include "log/logging.hpp"
+
+namespace simulator::trading_system::journal {
+namespace {
+
+constexpr std::string_view Extension = ".journal";
+
+// Parses the generation of the "<key>.<generation>.journal" file name
+auto parse_generation(std::string_view file_name, std::string_view key)
+    -> std::optional<std::uint64_t> {
+  if (!file_name.starts_with(key) || !file_name.ends_with(Extension)) {
+    return std::nullopt;
+  }
+  file_name.remove_prefix(key.size());
+  file_name.remove_suffix(Extension.size());
+  if (!file_name.starts_with('.')) {
+    return std::nullopt;
+  }
+  file_name.remove_prefix(1);
+
+  std::uint64_t generation = 0;
+  const auto* const end = file_name.data() + file_name.size();
+  const auto [last, error] = std::from_chars(file_name.data(), end, generation);
+  if (error != std::errc{} || last != end) {
+    return std::nullopt;
+  }
+  return generation;
+}
+
+}  // namespace
+
+auto journal_directory(const std::filesystem::path& persistence_file_path)
+    -> std::filesystem::path {
+  auto directory = persistence_file_path;
+  directory += Extension;
+  return directory;
+}
+
+auto journal_key(const Instrument& instrument) -> std::string {
+  if (instrument.database_id.has_value()) {
+    return fmt::format("instrument-{}", instrument.database_id->value());
+  }
+  return fmt::format("engine-{}", instrument.identifier.value());
+}
+
+auto journal_file_path(const std::filesystem::path& directory,
+                       std::string_view key,
+                       std::uint64_t generation) -> std::filesystem::path {
+  return directory / fmt::format("{}.{}{}", key, generation, Extension);
+}
+
+auto list_generations(const std::filesystem::path& directory,
+                      std::string_view key) -> std::vector<std::uint64_t> {
+  std::vector<std::uint64_t> generations;
+  std::error_code error;
+  for (const auto& entry :
+       std::filesystem::directory_iterator{directory, error}) {
+    const auto file_name = entry.path().filename().string();
+    if (const auto generation = parse_generation(file_name, key)) {
+      generations.push_back(*generation);
+    }
+  }
+  std::ranges::sort(generations);
+  return generations;
+}
+
+auto remove_generations_before(const std::filesystem::path& directory,
+                               std::string_view key,
+                               std::uint64_t generation) -> void {
+  for (const auto obsolete : list_generations(directory, key)) {
+    if (obsolete >= generation) {
+      break;
+    }
+
+    const auto file_path = journal_file_path(directory, key, obsolete);
+    std::error_code error;
+    if (!std::filesystem::remove(file_path, error) && error) {
+      log::warn("failed to remove obsolete journal {}: {}",
+                file_path.string(),
+                error.message());
+    }
+  }
+}
+
+}  // namespace simulator::trading_system::journal
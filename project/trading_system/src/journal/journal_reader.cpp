@@ -0,0 +1,53 @@
+#include "ih/journal/journal_reader.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <utility>
+
+namespace simulator::trading_system::journal {
+
+auto Reader::open(const std::filesystem::path& file_path)
+    -> tl::expected<Reader, std::string> {
+  std::ifstream file{file_path, std::ios::binary};
+  if (!file.is_open()) {
+    return tl::unexpected{"unable to open the journal file"};
+  }
+
+  std::vector<char> chars{std::istreambuf_iterator<char>{file},
+                          std::istreambuf_iterator<char>{}};
+  std::vector<std::byte> content(chars.size());
+  std::memcpy(content.data(), chars.data(), chars.size());
+
+  auto header = decode_header(content);
+  if (!header.has_value()) {
+    return tl::unexpected{std::string{describe(header.error())}};
+  }
+  return Reader{std::move(content), *header};
+}
+
+Reader::Reader(std::vector<std::byte> content, Header header)
+    : content_(std::move(content)), header_(header) {}
+
+auto Reader::next() -> std::optional<Record> {
+  if (error_.has_value() || offset_ == content_.size()) {
+    return std::nullopt;
+  }
+
+  auto decoded = decode_record(std::span{content_}.subspan(offset_));
+  if (!decoded.has_value()) {
+    error_ = decoded.error();
+    return std::nullopt;
+  }
+  if (decoded->record.sequence != last_sequence_ + 1) {
+    error_ = DecodingError::OutOfSequence;
+    return std::nullopt;
+  }
+
+  offset_ += decoded->size;
+  last_sequence_ = decoded->record.sequence;
+  return std::move(decoded->record);
+}
+
+}  // namespace simulator::trading_system::journal
@@ -0,0 +1,189 @@
+#include "ih/journal/journal_writer.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "core/tools/time.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::trading_system::journal {
+namespace {
+
+auto describe_errno() -> std::string { return std::strerror(errno); }
+
+// Makes a newly created file entry durable
+auto sync_directory(const std::filesystem::path& directory) -> void {
+  const int descriptor = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+  if (descriptor < 0) {
+    return;
+  }
+  ::fsync(descriptor);
+  ::close(descriptor);
+}
+
+}  // namespace
+
+Committer::Committer(std::chrono::microseconds commit_interval)
+    : commit_interval_(commit_interval), thread_([this] { run(); }) {}
+
+Committer::~Committer() noexcept {
+  {
+    const std::lock_guard lock{mutex_};
+    stopped_ = true;
+  }
+  records_appended_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+auto Committer::attach(Writer& writer) -> void {
+  const std::lock_guard lock{writers_mutex_};
+  writers_.push_back(&writer);
+}
+
+auto Committer::detach(Writer& writer) -> void {
+  const std::lock_guard lock{writers_mutex_};
+  std::erase(writers_, &writer);
+}
+
+auto Committer::notify_appended(bool commit_due) -> void {
+  {
+    const std::lock_guard lock{mutex_};
+    const bool wakes_up = !records_pending_ || (commit_due && !commit_due_);
+    records_pending_ = true;
+    commit_due_ = commit_due_ || commit_due;
+    if (!wakes_up) {
+      return;
+    }
+  }
+  records_appended_.notify_one();
+}
+
+auto Committer::run() -> void {
+  std::unique_lock lock{mutex_};
+  while (true) {
+    records_appended_.wait(lock,
+                           [this] { return stopped_ || records_pending_; });
+    if (stopped_) {
+      return;
+    }
+    records_appended_.wait_for(
+        lock, commit_interval_, [this] { return stopped_ || commit_due_; });
+
+    // Records appended from now on are committed by the next pass
+    records_pending_ = false;
+    commit_due_ = false;
+    lock.unlock();
+    commit_writers();
+    lock.lock();
+  }
+}
+
+auto Committer::commit_writers() -> void {
+  const std::lock_guard lock{writers_mutex_};
+  for (auto* writer : writers_) {
+    writer->commit();
+  }
+}
+
+auto Writer::create(const std::filesystem::path& file_path,
+                    std::uint64_t generation,
+                    Settings settings,
+                    Committer& committer)
+    -> tl::expected<std::unique_ptr<Writer>, std::string> {
+  const int descriptor = ::open(file_path.c_str(),
+                                O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+                                S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  if (descriptor < 0) {
+    return tl::unexpected{describe_errno()};
+  }
+
+  std::unique_ptr<Writer> writer{
+      new Writer{descriptor, file_path, generation, settings, committer}};
+
+  std::vector<std::byte> header;
+  encode(Header{.generation = generation}, header);
+  if (!writer->write_all(header) || ::fdatasync(descriptor) != 0) {
+    return tl::unexpected{describe_errno()};
+  }
+  sync_directory(file_path.parent_path());
+
+  committer.attach(*writer);
+  writer->attached_ = true;
+  return writer;
+}
+
+Writer::Writer(int file_descriptor,
+               std::filesystem::path file_path,
+               std::uint64_t generation,
+               Settings settings,
+               Committer& committer)
+    : settings_(settings),
+      file_path_(std::move(file_path)),
+      generation_(generation),
+      file_descriptor_(file_descriptor),
+      committer_(committer) {
+  pending_.reserve(settings_.commit_size);
+  committing_.reserve(settings_.commit_size);
+}
+
+Writer::~Writer() noexcept {
+  if (attached_) {
+    committer_.detach(*this);
+  }
+
+  commit();
+  ::close(file_descriptor_);
+}
+
+auto Writer::append(const Command& command) -> void {
+  bool commit_due = false;
+  {
+    const std::lock_guard lock{mutex_};
+    encode(++last_sequence_, core::get_current_system_time(), command, pending_);
+    commit_due = pending_.size() >= settings_.commit_size;
+  }
+  committer_.notify_appended(commit_due);
+}
+
+auto Writer::commit() -> void {
+  const std::lock_guard commit_lock{commit_mutex_};
+  {
+    const std::lock_guard lock{mutex_};
+    std::swap(pending_, committing_);
+  }
+  if (committing_.empty()) {
+    return;
+  }
+
+  if (!write_all(committing_) || ::fdatasync(file_descriptor_) != 0) {
+    log::err("failed to commit records to the journal {}: {}",
+             file_path_.string(),
+             describe_errno());
+  }
+  committing_.clear();
+}
+
+auto Writer::write_all(const std::vector<std::byte>& bytes) -> bool {
+  std::size_t written = 0;
+  while (written < bytes.size()) {
+    const auto result = ::write(
+        file_descriptor_, bytes.data() + written, bytes.size() - written);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    written += static_cast<std::size_t>(result);
+  }
+  return true;
+}
+
+}  // namespace simulator::trading_system::journal
@@ -0,0 +1,214 @@
+#include "ih/journal/journaling_trading_engine.hpp"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "ih/journal/journal_files.hpp"
+#include "log/logging.hpp"
+
+namespace simulator::trading_system::journal {
+
+JournalingTradingEngine::JournalingTradingEngine(
+    std::filesystem::path directory,
+    std::string key,
+    std::unique_ptr<TradingEngine> engine,
+    Writer::Settings settings,
+    std::shared_ptr<Committer> committer)
+    : directory_(std::move(directory)),
+      key_(std::move(key)),
+      engine_(std::move(engine)),
+      settings_(settings),
+      committer_(std::move(committer)) {
+  if (const auto generations = list_generations(directory_, key_);
+      !generations.empty()) {
+    last_generation_ = generations.back();
+  }
+}
+
+auto JournalingTradingEngine::execute(protocol::OrderPlacementRequest request)
+    -> void {
+  const std::lock_guard lock{mutex_};
+  append(request);
+  engine_->execute(std::move(request));
+}
+
+auto JournalingTradingEngine::execute(
+    protocol::OrderModificationRequest request) -> void {
+  const std::lock_guard lock{mutex_};
+  append(request);
+  engine_->execute(std::move(request));
+}
+
+auto JournalingTradingEngine::execute(
+    protocol::OrderCancellationRequest request) -> void {
+  const std::lock_guard lock{mutex_};
+  append(request);
+  engine_->execute(std::move(request));
+}
+
+auto JournalingTradingEngine::execute(
+    protocol::OrderMassCancellationRequest request) -> void {
+  const std::lock_guard lock{mutex_};
+  append(request);
+  engine_->execute(std::move(request));
+}
+
+auto JournalingTradingEngine::execute(protocol::MassQuoteRequest request)
+    -> void {
+  const std::lock_guard lock{mutex_};
+  append(request);
+  engine_->execute(std::move(request));
+}
+
+auto JournalingTradingEngine::execute(protocol::MarketDataRequest request)
+    -> void {
+  engine_->execute(std::move(request));
+}
+
+auto JournalingTradingEngine::execute(protocol::SecurityStatusRequest request)
+    -> void {
+  engine_->execute(std::move(request));
+}
+
+auto JournalingTradingEngine::provide_state(protocol::InstrumentState& reply)
+    -> void {
+  engine_->provide_state(reply);
+}
+
+auto JournalingTradingEngine::store_state(market_state::InstrumentState& state)
+    -> void {
+  const std::lock_guard lock{mutex_};
+  engine_->store_state(state);
+  start_generation();
+  state.journal_generation = last_generation_;
+}
+
+auto JournalingTradingEngine::recover_state(
+    market_state::InstrumentState state) -> void {
+  const std::lock_guard lock{mutex_};
+  const auto first_generation = state.journal_generation.value_or(0);
+  engine_->recover_state(std::move(state));
+  if (!journaling_started_) {
+    replay_generations(first_generation);
+  }
+}
+
+auto JournalingTradingEngine::provide_latency(protocol::EngineLatency& latency)
+    -> void {
+  engine_->provide_latency(latency);
+}
+
+auto JournalingTradingEngine::handle(
+    const protocol::SessionTerminatedEvent& event) -> void {
+  const std::lock_guard lock{mutex_};
+  append(event);
+  engine_->handle(event);
+}
+
+auto JournalingTradingEngine::handle(event::Tick tick) -> void {
+  const std::lock_guard lock{mutex_};
+  append(tick);
+  engine_->handle(tick);
+}
+
+auto JournalingTradingEngine::handle(event::PhaseTransition phase_transition)
+    -> void {
+  const std::lock_guard lock{mutex_};
+  append(phase_transition);
+  engine_->handle(phase_transition);
+}
+
+auto JournalingTradingEngine::replay_at(core::sys_us journaled_at) -> void {
+  engine_->replay_at(journaled_at);
+}
+
+auto JournalingTradingEngine::finish_replay() -> void {
+  engine_->finish_replay();
+}
+
+auto JournalingTradingEngine::append(const Command& command) -> void {
+  if (writer_ != nullptr) {
+    writer_->append(command);
+  }
+}
+
+auto JournalingTradingEngine::start_generation() -> void {
+  const auto generation = ++last_generation_;
+
+  std::error_code error;
+  std::filesystem::create_directories(directory_, error);
+  const auto file_path = journal_file_path(directory_, key_, generation);
+  auto writer = Writer::create(file_path, generation, settings_, *committer_);
+  if (!writer.has_value()) {
+    throw std::runtime_error(fmt::format("failed to create the journal {}: {}",
+                                         file_path.string(),
+                                         writer.error()));
+  }
+
+  // The previous generation is committed and closed
+  writer_ = std::move(*writer);
+  journaling_started_ = true;
+  log::debug("started journal {}", file_path.string());
+}
+
+auto JournalingTradingEngine::replay_generations(
+    std::uint64_t first_generation) -> void {
+  for (const auto generation : list_generations(directory_, key_)) {
+    if (generation < first_generation) {
+      continue;
+    }
+
+    const auto file_path = journal_file_path(directory_, key_, generation);
+    auto reader = Reader::open(file_path);
+    if (!reader.has_value()) {
+      log::err("failed to replay the journal {}: {}",
+               file_path.string(),
+               reader.error());
+      continue;
+    }
+
+    const auto replayed = replay(*reader, *engine_);
+    if (const auto error = reader->error()) {
+      log::warn("the journal {} is replayed up to a damaged record: {}",
+                file_path.string(),
+                describe(*error));
+    }
+    log::info("replayed {} commands from the journal {}",
+              replayed,
+              file_path.string());
+  }
+}
+
+auto replay(Reader& reader, TradingEngine& engine) -> std::uint64_t {
+  std::uint64_t replayed = 0;
+  while (auto record = reader.next()) {
+    engine.replay_at(record->time);
+    std::visit(
+        [&engine]<typename C>(C&& command) {
+          using Type = std::decay_t<C>;
+          if constexpr (std::is_same_v<Type, protocol::OrderPlacementRequest> ||
+                        std::is_same_v<Type,
+                                       protocol::OrderModificationRequest> ||
+                        std::is_same_v<Type,
+                                       protocol::OrderCancellationRequest> ||
+                        std::is_same_v<Type,
+                                       protocol::OrderMassCancellationRequest> ||
+                        std::is_same_v<Type, protocol::MassQuoteRequest>) {
+            engine.execute(std::forward<C>(command));
+          } else {
+            engine.handle(std::forward<C>(command));
+          }
+        },
+        std::move(record->command));
+    replayed++;
+  }
+  engine.finish_replay();
+  return replayed;
+}
+
+}  // namespace simulator::trading_system::journal
@@ -30,9 +30,8 @@ auto TradingEnginesRepository::add_engine(InstrumentId instrument_id,
 
 auto TradingEnginesRepository::find_instrument_engine(
     InstrumentId identifier) const -> TradingEngine& {
-  const auto engine_it = by_instrument_lookup_.find(identifier);
-  if (engine_it != std::end(by_instrument_lookup_)) [[likely]] {
-    return engine_it->second;
+  if (auto* engine = find_route(identifier)) [[likely]] {
+    return *engine;
   }
 
   throw std::out_of_range{fmt::format(
@@ -41,15 +40,44 @@ auto TradingEnginesRepository::find_instrument_engine(
 
 auto TradingEnginesRepository::associate_instrument_with_engine(
     InstrumentId instrument_id, TradingEngine& engine) -> void {
-  const auto [_, associated] =
-      by_instrument_lookup_.emplace(instrument_id, std::ref(engine));
-
-  if (!associated) [[unlikely]] {
+  if (find_route(instrument_id) != nullptr) [[unlikely]] {
     throw std::invalid_argument(
         fmt::format("trading engine with the same InstrumentId ({}) already "
                     "exists in repository",
                     instrument_id));
   }
+
+  if (!fits_routing_table(instrument_id)) [[unlikely]] {
+    sparse_lookup_.emplace(instrument_id, &engine);
+    return;
+  }
+
+  const auto slot = static_cast<std::size_t>(instrument_id.value());
+  if (slot >= routing_table_.size()) {
+    routing_table_.resize(slot + 1, nullptr);
+  }
+  routing_table_[slot] = &engine;
+}
+
+auto TradingEnginesRepository::find_route(InstrumentId identifier) const
+    -> TradingEngine* {
+  const auto slot = identifier.value();
+  if (slot < routing_table_.size() && routing_table_[slot] != nullptr)
+      [[likely]] {
+    return routing_table_[slot];
+  }
+
+  // The routing table may have grown over a slot of a sparse identifier
+  if (sparse_lookup_.empty()) {
+    return nullptr;
+  }
+  const auto engine_it = sparse_lookup_.find(identifier);
+  return engine_it != std::end(sparse_lookup_) ? engine_it->second : nullptr;
+}
+
+auto TradingEnginesRepository::fits_routing_table(
+    InstrumentId identifier) const -> bool {
+  return identifier.value() < 2 * (engines_.size() + 1) + MaxRoutingTableSlack;
 }
 
 auto TradingEnginesRepository::apply_for_each_engine(
@@ -1,8 +1,14 @@
 #include "ih/state_persistence/market_state_persistence_controller.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <system_error>
 
+#include "ih/journal/journal_files.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::trading_system {
@@ -23,6 +29,30 @@ auto make_snapshot(const std::string& venue_id,
   return snapshot;
 }
 
+// Makes the written file content durable before it replaces the stored state
+auto sync_file(const std::filesystem::path& file_path) -> bool {
+  const int descriptor = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (descriptor < 0) {
+    return false;
+  }
+  const bool synced = ::fsync(descriptor) == 0;
+  ::close(descriptor);
+  return synced;
+}
+
+auto remove_obsolete_journals(const std::filesystem::path& file_path,
+                              const market_state::Snapshot& snapshot) -> void {
+  const auto directory = journal::journal_directory(file_path);
+  for (const auto& instrument_state : snapshot.instruments) {
+    if (instrument_state.journal_generation.has_value()) {
+      journal::remove_generations_before(
+          directory,
+          journal::journal_key(instrument_state.instrument),
+          *instrument_state.journal_generation);
+    }
+  }
+}
+
 }  // namespace
 
 MarketStatePersistenceController::MarketStatePersistenceController(
@@ -59,7 +89,11 @@ auto MarketStatePersistenceController::store() -> core::code::StoreMarketState {
     return core::code::StoreMarketState::PersistenceFilePathIsUnreachable;
   }
 
-  std::ofstream ofs{file_path};
+  // The state is written to a temporary file, which replaces the stored one,
+  // so that the stored state is never left partially written
+  auto temporary_file_path = file_path;
+  temporary_file_path += ".tmp";
+  std::ofstream ofs{temporary_file_path};
   if (!ofs.is_open()) {
     log::err(
         "The market state was not stored: an error when unable to open file.");
@@ -67,14 +101,60 @@ auto MarketStatePersistenceController::store() -> core::code::StoreMarketState {
   }
 
   market_state::Snapshot snapshot = make_snapshot(venue_id_, instruments_);
-  executor_.store_state_request(snapshot.instruments);
+  std::error_code error;
+  try {
+    executor_.store_state_request(snapshot.instruments);
+  } catch (const std::exception& exception) {
+    // An engine fails to start a new journal generation, the previously
+    // stored state remains valid with the journals it refers to
+    log::err("The market state was not stored: {}", exception.what());
+    ofs.close();
+    std::filesystem::remove(temporary_file_path, error);
+    return core::code::StoreMarketState::ErrorWhenWritingToPersistenceFile;
+  }
+
+  const bool serialized = serializer_->serialize(snapshot, ofs);
+  ofs.close();
+  if (!serialized || ofs.fail() || !sync_file(temporary_file_path)) {
+    std::filesystem::remove(temporary_file_path, error);
+    return core::code::StoreMarketState::ErrorWhenWritingToPersistenceFile;
+  }
+  std::filesystem::rename(temporary_file_path, file_path, error);
+  if (error) {
+    log::err("The market state was not stored: {}", error.message());
+    return core::code::StoreMarketState::ErrorWhenWritingToPersistenceFile;
+  }
 
-  return serializer_->serialize(snapshot, ofs)
-             ? core::code::StoreMarketState::Stored
-             : core::code::StoreMarketState::ErrorWhenWritingToPersistenceFile;
+  remove_obsolete_journals(file_path, snapshot);
+  return core::code::StoreMarketState::Stored;
 }
 
 auto MarketStatePersistenceController::recover() -> RecoverResult {
+  auto result = recover_stored_state();
+  if (result.code == core::code::RecoverMarketState::Recovered) {
+    checkpoint();
+  }
+  return result;
+}
+
+auto MarketStatePersistenceController::restore() -> RecoverResult {
+  auto result = recover_stored_state();
+  if (result.code ==
+      core::code::RecoverMarketState::PersistenceFilePathIsUnreachable) {
+    // No state has been stored yet, engines replay their journals
+    // on top of the initial state
+    executor_.recover_state_request(
+        make_snapshot(venue_id_, instruments_).instruments);
+  } else if (result.code != core::code::RecoverMarketState::Recovered) {
+    return result;
+  }
+
+  checkpoint();
+  return result;
+}
+
+auto MarketStatePersistenceController::recover_stored_state()
+    -> RecoverResult {
   if (!config_.persistence_enabled()) {
     log::info(
         "The market state was not recovered: the persistence is disabled.");
@@ -121,4 +201,12 @@ auto MarketStatePersistenceController::recover() -> RecoverResult {
   return {core::code::RecoverMarketState::Recovered, {}};
 }
 
+auto MarketStatePersistenceController::checkpoint() -> void {
+  if (store() != core::code::StoreMarketState::Stored) {
+    log::err(
+        "The recovered market state was not stored, previous engine journals "
+        "are kept.");
+  }
+}
+
 }  // namespace simulator::trading_system
@@ -1,19 +1,26 @@
 #include "ih/tools/instrument_resolver.hpp"
 
+#include <cstddef>
 #include <functional>
 
+#include "ih/tools/resolution_memo.hpp"
 #include "log/logging.hpp"
 
 namespace simulator::trading_system {
 namespace {
 
 struct CachedInstrumentResolver final : InstrumentResolver {
-  explicit CachedInstrumentResolver(const instrument::Cache& cache) noexcept
-      : cache_{cache} {}
+  CachedInstrumentResolver(const instrument::Cache& cache,
+                           std::size_t memo_capacity)
+      : cache_{cache}, memo_{memo_capacity} {}
 
   auto resolve_instrument(const InstrumentDescriptor& descriptor) const
       -> tl::expected<instrument::View, instrument::LookupError> override {
-    return cache_.get().find(descriptor);
+    const instrument::Cache& cache = cache_.get();
+    return memo_.resolve(
+        descriptor, cache.generation(), [&](const auto& resolved) {
+          return cache.find(resolved);
+        });
   }
 
   auto resolve_instrument(const Instrument& instrument) const
@@ -21,16 +28,23 @@ struct CachedInstrumentResolver final : InstrumentResolver {
     return cache_.get().find(instrument);
   }
 
+  auto memo_statistics() const -> ResolutionMemoStatistics override {
+    return memo_.statistics();
+  }
+
  private:
   std::reference_wrapper<const instrument::Cache> cache_;
+  mutable ResolutionMemo memo_;
 };
 
 }  // namespace
 
-auto create_cached_instrument_resolver(const instrument::Cache& cache)
+auto create_cached_instrument_resolver(const instrument::Cache& cache,
+                                       std::size_t memo_capacity)
     -> std::unique_ptr<InstrumentResolver> {
-  log::debug("creating cached instrument resolver");
-  return std::make_unique<CachedInstrumentResolver>(cache);
+  log::debug("creating cached instrument resolver, memo capacity - {}",
+             memo_capacity);
+  return std::make_unique<CachedInstrumentResolver>(cache, memo_capacity);
 }
 
 }  // namespace simulator::trading_system
@@ -0,0 +1,66 @@
+#include "ih/tools/parallel_for.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "log/logging.hpp"
+#include "runtime/thread_pool.hpp"
+
+namespace simulator::trading_system {
+
+auto parallel_for(std::size_t count,
+                  const std::function<void(std::size_t)>& task,
+                  std::size_t workers) -> void {
+  if (workers == 0) {
+    workers = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  }
+  workers = std::min(workers, count);
+
+  if (workers <= 1) {
+    for (std::size_t index = 0; index < count; ++index) {
+      task(index);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_index{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr failure;
+  std::mutex failure_mutex;
+
+  const auto work = [&] {
+    while (!failed.load(std::memory_order_relaxed)) {
+      const auto index = next_index.fetch_add(1, std::memory_order_relaxed);
+      if (index >= count) {
+        return;
+      }
+
+      try {
+        task(index);
+      } catch (...) {
+        const std::lock_guard lock{failure_mutex};
+        if (!failure) {
+          failure = std::current_exception();
+        }
+        failed.store(true, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  log::debug("running {} tasks on {} worker threads", count, workers);
+
+  auto pool = runtime::ThreadPool::create_simple_thread_pool(workers);
+  for (std::size_t worker = 0; worker < workers; ++worker) {
+    pool.execute(work);
+  }
+  pool.await();
+
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+}
+
+}  // namespace simulator::trading_system
@@ -0,0 +1,116 @@
+#include "ih/tools/resolution_memo.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace simulator::trading_system {
+namespace {
+
+auto combine(std::size_t seed, std::size_t hash) noexcept -> std::size_t {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+auto hash_text(const std::string& text) noexcept -> std::size_t {
+  return std::hash<std::string_view>{}(text);
+}
+
+template <typename T>
+auto hash_literal(const std::optional<T>& attribute) noexcept
+    -> std::size_t {
+  return attribute.has_value()
+             ? hash_text(static_cast<const std::string&>(*attribute))
+             : 0;
+}
+
+template <typename T>
+auto hash_enumerable(const std::optional<T>& attribute) noexcept
+    -> std::size_t {
+  return attribute.has_value()
+             ? std::hash<typename T::value_type>{}(attribute->value()) + 1
+             : 0;
+}
+
+}  // namespace
+
+ResolutionMemo::ResolutionMemo(std::size_t capacity) {
+  const std::size_t slots = std::max<std::size_t>(capacity / ShardsCount, 1);
+  for (auto& shard : shards_) {
+    shard.slots.resize(slots);
+  }
+}
+
+auto ResolutionMemo::statistics() const noexcept -> ResolutionMemoStatistics {
+  return ResolutionMemoStatistics{
+      .hits = hits_.load(std::memory_order_relaxed),
+      .misses = misses_.load(std::memory_order_relaxed)};
+}
+
+auto ResolutionMemo::hash(const InstrumentDescriptor& descriptor) noexcept
+    -> std::size_t {
+  std::size_t seed = hash_literal(descriptor.symbol);
+  seed = combine(seed, hash_literal(descriptor.security_id));
+  seed = combine(seed, hash_enumerable(descriptor.security_id_source));
+  seed = combine(seed, hash_literal(descriptor.security_exchange));
+  seed = combine(seed, hash_literal(descriptor.currency));
+  seed = combine(seed, hash_enumerable(descriptor.security_type));
+  for (const auto& party : descriptor.parties) {
+    const auto& party_id = static_cast<const std::string&>(party.party_id());
+    seed = combine(seed, hash_text(party_id));
+    seed = combine(seed,
+                   std::hash<PartyRole::value_type>{}(party.role().value()));
+  }
+  return seed;
+}
+
+auto ResolutionMemo::same_identity(const InstrumentDescriptor& lhs,
+                                   const InstrumentDescriptor& rhs) -> bool {
+  return lhs.symbol == rhs.symbol && lhs.security_id == rhs.security_id &&
+         lhs.security_id_source == rhs.security_id_source &&
+         lhs.security_exchange == rhs.security_exchange &&
+         lhs.currency == rhs.currency &&
+         lhs.security_type == rhs.security_type && lhs.parties == rhs.parties;
+}
+
+auto ResolutionMemo::find(const InstrumentDescriptor& descriptor,
+                          std::size_t hash,
+                          std::uint64_t generation) -> std::optional<Result> {
+  auto& shard = shard_of(hash);
+  const std::lock_guard lock{shard.mutex};
+
+  const auto& entry = slot_of(shard, hash);
+  if (entry.has_value() && entry->hash == hash &&
+      entry->generation == generation &&
+      same_identity(entry->descriptor, descriptor)) {
+    return entry->result;
+  }
+  return std::nullopt;
+}
+
+auto ResolutionMemo::store(const InstrumentDescriptor& descriptor,
+                           std::size_t hash,
+                           std::uint64_t generation,
+                           const Result& result) -> void {
+  auto& shard = shard_of(hash);
+  const std::lock_guard lock{shard.mutex};
+
+  slot_of(shard, hash) = Entry{.descriptor = descriptor,
+                               .result = result,
+                               .hash = hash,
+                               .generation = generation};
+}
+
+auto ResolutionMemo::shard_of(std::size_t hash) noexcept -> Shard& {
+  return shards_[hash % ShardsCount];
+}
+
+auto ResolutionMemo::slot_of(Shard& shard, std::size_t hash) noexcept
+    -> std::optional<Entry>& {
+  return shard.slots[(hash / ShardsCount) % shard.slots.size()];
+}
+
+}  // namespace simulator::trading_system
@@ -0,0 +1,73 @@
+#include "ih/tools/startup_progress.hpp"
+
+#include "log/logging.hpp"
+
+namespace simulator::trading_system {
+
+StartupProgress::StartupProgress() noexcept : started_at_{Clock::now()} {}
+
+auto StartupProgress::begin_construction(std::size_t engines_total) noexcept
+    -> void {
+  engines_total_.store(engines_total, std::memory_order_relaxed);
+  stage_.store(Stage::ConstructingEngines, std::memory_order_release);
+  log::info("constructing {} trading engines", engines_total);
+}
+
+auto StartupProgress::engine_constructed() noexcept -> void {
+  engines_constructed_.fetch_add(1, std::memory_order_relaxed);
+}
+
+auto StartupProgress::begin_recovery() noexcept -> void {
+  stage_.store(Stage::RecoveringState, std::memory_order_release);
+  log::info("constructed {} trading engines in {} ms, recovering their states",
+            engines_constructed_.load(std::memory_order_relaxed),
+            elapsed().count());
+}
+
+auto StartupProgress::engine_recovered() noexcept -> void {
+  if (stage() == Stage::RecoveringState) {
+    engines_recovered_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+auto StartupProgress::complete() noexcept -> void {
+  finish(Stage::Ready);
+  log::info("trading system has started in {} ms, {} engine states recovered",
+            elapsed().count(),
+            engines_recovered_.load(std::memory_order_relaxed));
+}
+
+auto StartupProgress::fail() noexcept -> void {
+  finish(Stage::Failed);
+  log::err("trading system start-up has failed in {} ms", elapsed().count());
+}
+
+auto StartupProgress::stage() const noexcept -> Stage {
+  return stage_.load(std::memory_order_acquire);
+}
+
+auto StartupProgress::report(protocol::StartupProgressReply& reply) const
+    -> void {
+  reply.stage = stage();
+  reply.engines_total = engines_total_.load(std::memory_order_relaxed);
+  reply.engines_constructed =
+      engines_constructed_.load(std::memory_order_relaxed);
+  reply.engines_recovered = engines_recovered_.load(std::memory_order_relaxed);
+  reply.elapsed = elapsed();
+}
+
+auto StartupProgress::elapsed() const noexcept -> std::chrono::milliseconds {
+  const auto duration = duration_.load(std::memory_order_acquire);
+  if (duration >= 0) {
+    return std::chrono::milliseconds{duration};
+  }
+  return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() -
+                                                               started_at_);
+}
+
+auto StartupProgress::finish(Stage stage) noexcept -> void {
+  duration_.store(elapsed().count(), std::memory_order_release);
+  stage_.store(stage, std::memory_order_release);
+}
+
+}  // namespace simulator::trading_system
@@ -0,0 +1,107 @@
+#include "ih/tools/tick_deadline_heap.hpp"
+
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace simulator::trading_system {
+
+auto TickDeadlineHeap::InstrumentIdHasher::operator()(
+    InstrumentId identifier) const -> std::size_t {
+  return std::hash<std::uint64_t>{}(static_cast<std::uint64_t>(identifier));
+}
+
+auto TickDeadlineHeap::schedule(InstrumentId instrument_id,
+                                TickDeadline deadline) -> void {
+  const std::lock_guard lock{mutex_};
+
+  auto& entry = entries_[instrument_id];
+  deadline.merge(entry.deadline);
+  store(instrument_id, entry, deadline);
+}
+
+auto TickDeadlineHeap::reschedule(InstrumentId instrument_id,
+                                  std::optional<TickDeadline> deadline)
+    -> void {
+  const std::lock_guard lock{mutex_};
+
+  auto& entry = entries_[instrument_id];
+  store(instrument_id, entry, deadline.value_or(TickDeadline{}));
+}
+
+auto TickDeadlineHeap::take_due(const event::Tick& tick)
+    -> std::vector<InstrumentId> {
+  const std::lock_guard lock{mutex_};
+
+  std::vector<InstrumentId> due;
+  while (!heap_.empty() && heap_.top().time <= tick.sys_tick_time) {
+    const Node node = heap_.top();
+    heap_.pop();
+
+    auto& entry = entries_.at(node.instrument_id);
+    if (entry.version == node.version) {
+      due.push_back(node.instrument_id);
+      store(node.instrument_id, entry, TickDeadline{});
+    }
+  }
+
+  if (tick.is_new_tz_day) {
+    for (auto& [instrument_id, entry] : entries_) {
+      if (entry.deadline.new_day) {
+        due.push_back(instrument_id);
+        store(instrument_id, entry, TickDeadline{});
+      }
+    }
+  }
+
+  return due;
+}
+
+auto TickDeadlineHeap::size() const -> std::size_t {
+  const std::lock_guard lock{mutex_};
+  return scheduled_;
+}
+
+auto TickDeadlineHeap::store(InstrumentId instrument_id,
+                             Entry& entry,
+                             const TickDeadline& deadline) -> void {
+  if (!entry.deadline.empty() && deadline.empty()) {
+    --scheduled_;
+  } else if (entry.deadline.empty() && !deadline.empty()) {
+    ++scheduled_;
+  }
+
+  const bool time_changed = entry.deadline.time != deadline.time;
+  entry.deadline = deadline;
+  if (!time_changed) {
+    return;
+  }
+
+  // A node of the previous deadline time becomes stale
+  entry.version = ++last_version_;
+  if (deadline.time.has_value()) {
+    heap_.push(Node{.time = *deadline.time,
+                    .instrument_id = instrument_id,
+                    .version = entry.version});
+    if (heap_.size() > CompactionFactor * (scheduled_ + 1)) {
+      compact();
+    }
+  }
+}
+
+auto TickDeadlineHeap::compact() -> void {
+  std::vector<Node> nodes;
+  nodes.reserve(scheduled_);
+  for (const auto& [instrument_id, entry] : entries_) {
+    if (entry.deadline.time.has_value()) {
+      nodes.push_back(Node{.time = *entry.deadline.time,
+                           .instrument_id = instrument_id,
+                           .version = entry.version});
+    }
+  }
+  heap_ = decltype(heap_){std::greater<>{}, std::move(nodes)};
+}
+
+}  // namespace simulator::trading_system
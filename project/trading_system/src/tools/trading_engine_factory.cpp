@@ -1,8 +1,11 @@
 #include "ih/tools/trading_engine_factory.hpp"
 
 #include <gsl/pointers>
+#include <memory>
 
 #include "ih/config/config.hpp"
+#include "ih/journal/journal_files.hpp"
+#include "ih/journal/journaling_trading_engine.hpp"
 #include "log/logging.hpp"
 #include "matching_engine/configuration.hpp"
 #include "matching_engine/matching_engine.hpp"
@@ -14,9 +17,13 @@ namespace {
 
 class MatchingEngineFactory final : public TradingEngineFactory {
  public:
-  explicit MatchingEngineFactory(const Config& config,
-                                 runtime::Service& executor)
-      : config_(&config), executor_(&executor) {}
+  MatchingEngineFactory(const Config& config,
+                        runtime::Service& executor,
+                        TickScheduler& tick_scheduler)
+      : config_(&config),
+        executor_(&executor),
+        tick_scheduler_(&tick_scheduler),
+        journal_committer_(std::make_shared<journal::Committer>()) {}
 
  private:
   auto create_trading_engine(const Instrument& instrument) const
@@ -24,8 +31,28 @@ class MatchingEngineFactory final : public TradingEngineFactory {
     log::debug("creating matching engine for instrument {}",
                instrument.identifier);
 
-    return std::make_unique<matching_engine::MatchingEngine>(
-        instrument, make_matching_engine_configuration(instrument), *executor_);
+    auto engine = std::make_unique<matching_engine::MatchingEngine>(
+        instrument,
+        make_matching_engine_configuration(instrument),
+        *executor_,
+        *tick_scheduler_);
+    if (!journaling_enabled()) {
+      return engine;
+    }
+
+    return std::make_unique<journal::JournalingTradingEngine>(
+        journal::journal_directory(config_->persistence_file_path()),
+        journal::journal_key(instrument),
+        std::move(engine),
+        journal::Writer::Settings{},
+        journal_committer_);
+  }
+
+  // Commands are journaled whenever the market state is persisted,
+  // the journal complements the last stored state
+  auto journaling_enabled() const -> bool {
+    return config_->persistence_enabled() &&
+           !config_->persistence_file_path().empty();
   }
 
   auto make_matching_engine_configuration(const Instrument& instrument) const
@@ -42,21 +69,28 @@ class MatchingEngineFactory final : public TradingEngineFactory {
         .report_trade_parties = config_->trade_parties_streaming_enabled(),
         .report_trade_aggressor_side =
             config_->trade_aggressor_streaming_enabled(),
+        .trade_history_depth = config_->trade_history_depth(),
         .support_market_data_orders_exclusion =
-            config_->depth_orders_exclusion_enabled()};
+            config_->depth_orders_exclusion_enabled(),
+        .self_trade_prevention = config_->self_trade_prevention()};
   }
 
   gsl::not_null<const Config*> config_;
   gsl::not_null<runtime::Service*> executor_;
+  gsl::not_null<TickScheduler*> tick_scheduler_;
+  // Commits journals of all engines from a single thread
+  std::shared_ptr<journal::Committer> journal_committer_;
 };
 
 }  // namespace
 
 auto create_matching_engine_factory(const Config& config,
-                                    runtime::Service& executor)
+                                    runtime::Service& executor,
+                                    TickScheduler& tick_scheduler)
     -> std::unique_ptr<TradingEngineFactory> {
   log::debug("creating matching engine factory");
-  return std::make_unique<MatchingEngineFactory>(config, executor);
+  return std::make_unique<MatchingEngineFactory>(
+      config, executor, tick_scheduler);
 }
 
 }  // namespace simulator::trading_system
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "ih/tools/venue_executor.hpp"
+
+#include <chrono>
+#include <utility>
+
+#include "cfg/api/venue_scope.hpp"
+
+namespace simulator::trading_system {
+
+VenueExecutor::VenueExecutor(runtime::Service& shared_executor)
+    : shared_executor_(shared_executor),
+      state_(std::make_shared<State>(cfg::current_venue())) {}
+
+auto VenueExecutor::execute(std::function<void()> task) -> void {
+  state_->pending.fetch_add(1, std::memory_order_relaxed);
+  try {
+    shared_executor_.execute([state = state_, task = std::move(task)] {
+      run(*state, task);
+    });
+  } catch (...) {
+    state_->pending.fetch_sub(1, std::memory_order_relaxed);
+    throw;
+  }
+}
+
+auto VenueExecutor::await() const noexcept -> void {
+  for (auto pending = state_->pending.load(std::memory_order_acquire);
+       pending != 0;
+       pending = state_->pending.load(std::memory_order_acquire)) {
+    state_->pending.wait(pending, std::memory_order_acquire);
+  }
+}
+
+auto VenueExecutor::run(State& state, const std::function<void()>& task)
+    -> void {
+  const cfg::VenueScope scope{state.venue};
+  const auto started = std::chrono::steady_clock::now();
+  try {
+    task();
+  } catch (...) {
+    complete(state, std::chrono::steady_clock::now() - started);
+    throw;
+  }
+  complete(state, std::chrono::steady_clock::now() - started);
+}
+
+auto VenueExecutor::complete(State& state,
+                             std::chrono::nanoseconds duration) noexcept
+    -> void {
+  cfg::charge_venue(state.venue, duration);
+  if (state.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    state.pending.notify_all();
+  }
+}
+
+}  // namespace simulator::trading_system
@@ -41,12 +41,15 @@ auto create_instruments_cache(const database::Context& database)
 }
 
 [[nodiscard]]
-auto create_trading_system_implementation(const database::Context& database)
+auto create_trading_system_implementation(
+    const database::Context& database,
+    runtime::Service* shared_executor = nullptr)
     -> std::unique_ptr<System::Implementation> {
   try {
     return std::make_unique<System::Implementation>(
         read_system_configuration(database),
-        create_instruments_cache(database));
+        create_instruments_cache(database),
+        shared_executor);
   } catch (const std::exception& exception) {
     log::err(
         "failed to create a trading system implementation, an error occurred: "
@@ -108,6 +111,37 @@ auto System::implementation() const noexcept -> Implementation& {
   std::abort();
 }
 
+SharedExecutor::SharedExecutor(std::unique_ptr<Implementation> impl) noexcept
+    : impl_(std::move(impl)) {}
+
+SharedExecutor::SharedExecutor(SharedExecutor&&) noexcept = default;
+
+SharedExecutor::~SharedExecutor() noexcept = default;
+
+auto SharedExecutor::operator=(SharedExecutor&&) noexcept
+    -> SharedExecutor& = default;
+
+auto SharedExecutor::implementation() const noexcept -> Implementation& {
+  if (impl_) [[likely]] {
+    return *impl_;
+  }
+
+  log::err(
+      "shared executor implementation has not been "
+      "allocated/initialized, this may indicate a critical bug "
+      "in the component, can not continue execution, aborting...");
+
+  std::abort();
+}
+
+auto create_shared_executor() -> SharedExecutor {
+  log::debug("creating trading systems shared executor");
+  SharedExecutor executor{std::make_unique<SharedExecutor::Implementation>()};
+  log::info("created trading systems shared executor");
+
+  return executor;
+}
+
 auto create_trading_system(const database::Context& database) -> System {
   log::debug("creating trading system instance");
   System engine{create_trading_system_implementation(database)};
@@ -116,6 +150,16 @@ auto create_trading_system(const database::Context& database) -> System {
   return engine;
 }
 
+auto create_trading_system(const database::Context& database,
+                           SharedExecutor& executor) -> System {
+  log::debug("creating trading system instance on a shared executor");
+  System engine{create_trading_system_implementation(
+      database, &executor.implementation().thread_pool)};
+  log::info("created trading system instance on a shared executor");
+
+  return engine;
+}
+
 auto launch_trading_system(System& trading_system) -> void {
   log::debug("launching trading system");
   launch_trading_system(trading_system.implementation());
@@ -146,6 +190,18 @@ auto process(protocol::OrderCancellationRequest request, System& trading_system)
   trading_system.implementation().execute(std::move(request));
 }
 
+auto process(protocol::OrderMassCancellationRequest request,
+             System& trading_system) -> void {
+  log::debug("called the procedure to process OrderMassCancellationRequest");
+  trading_system.implementation().execute(std::move(request));
+}
+
+auto process(protocol::MassQuoteRequest request, System& trading_system)
+    -> void {
+  log::debug("called the procedure to process MassQuoteRequest");
+  trading_system.implementation().execute(std::move(request));
+}
+
 auto process(protocol::MarketDataRequest request, System& trading_system)
     -> void {
   log::debug("called the procedure to process MarketDataRequest");
@@ -193,6 +249,20 @@ auto process(const protocol::RecoverMarketStateRequest& request,
   trading_system.implementation().execute(request, reply);
 }
 
+auto process(const protocol::EngineLatencyRequest& request,
+             protocol::EngineLatencyReply& reply,
+             System& trading_system) -> void {
+  log::debug("called the procedure to process EngineLatencyRequest");
+  trading_system.implementation().execute(request, reply);
+}
+
+auto process([[maybe_unused]] const protocol::StartupProgressRequest& request,
+             protocol::StartupProgressReply& reply,
+             System& trading_system) -> void {
+  log::debug("called the procedure to process StartupProgressRequest");
+  trading_system.implementation().report(reply);
+}
+
 auto react_on(const protocol::SessionTerminatedEvent& event,
               System& trading_system) -> void {
   log::debug("called procedure to react on SessionTerminatedEvent");
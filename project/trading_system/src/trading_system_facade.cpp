@@ -1,9 +1,15 @@
 #include "ih/trading_system_facade.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "cfg/api/cfg.hpp"
 #include "ih/state_persistence/serializer.hpp"
 #include "ih/tools/instrument_resolver.hpp"
 #include "ih/tools/loaders.hpp"
+#include "ih/tools/parallel_for.hpp"
 #include "ih/tools/trading_engine_factory.hpp"
 #include "log/logging.hpp"
 
@@ -12,14 +18,26 @@ namespace simulator::trading_system {
 namespace database = data_layer::database;
 
 TradingSystemFacade::TradingSystemFacade(Config config,
-                                         instrument::Cache instruments)
-    : thread_pool_(runtime::ThreadPool::create_simple_thread_pool()),
+                                         instrument::Cache instruments,
+                                         StartupProgress& startup_progress,
+                                         runtime::Service* shared_executor)
+    : thread_pool_(shared_executor == nullptr
+                       ? std::make_unique<runtime::ThreadPool>(
+                             runtime::ThreadPool::create_simple_thread_pool())
+                       : nullptr),
+      venue_executor_(shared_executor != nullptr
+                          ? std::make_unique<VenueExecutor>(*shared_executor)
+                          : nullptr),
       event_loop_(runtime::Loop::create_one_second_rate_loop()),
       instruments_(std::move(instruments)),
       config_(std::move(config)),
+      startup_progress_(startup_progress),
       instrument_resolver_(create_cached_instrument_resolver(instruments_)),
       repository_accessor_(RepositoryAccessor::create(engines_repository_)),
-      execution_system_(*instrument_resolver_, *repository_accessor_),
+      execution_system_(
+          *instrument_resolver_,
+          *repository_accessor_,
+          [&startup_progress] { startup_progress.engine_recovered(); }),
       event_controller_(ies::Controller(event_loop_)),
       persistence_controller_{config_,
                               execution_system_,
@@ -29,8 +47,12 @@ TradingSystemFacade::TradingSystemFacade(Config config,
   log::debug("creating trading system facade");
 
   init_trading_engines();
+  // Engine journals are replayed before the event system starts,
+  // so that live events do not interleave with replayed ones
+  startup_progress_.begin_recovery();
+  persistence_controller_.restore();
   launch_ies();
-  persistence_controller_.recover();
+  startup_progress_.complete();
 
   log::info("trading system facade created");
 }
@@ -53,6 +75,17 @@ auto TradingSystemFacade::execute(protocol::OrderCancellationRequest request)
   execution_system_.execute_request(request);
 }
 
+auto TradingSystemFacade::execute(
+    protocol::OrderMassCancellationRequest request) -> void {
+  log::debug("trading system received {}", request);
+  execution_system_.execute_request(std::move(request));
+}
+
+auto TradingSystemFacade::execute(protocol::MassQuoteRequest request) -> void {
+  log::debug("trading system received {}", request);
+  execution_system_.execute_request(std::move(request));
+}
+
 auto TradingSystemFacade::execute(protocol::MarketDataRequest request) -> void {
   log::debug("trading system received {}", request);
   execution_system_.execute_request(std::move(request));
@@ -97,6 +130,12 @@ auto TradingSystemFacade::execute(
   reply.error_message = std::move(error_message);
 }
 
+auto TradingSystemFacade::execute(const protocol::EngineLatencyRequest& request,
+                                  protocol::EngineLatencyReply& reply) -> void {
+  log::debug("trading system received {}", request);
+  collect_latency(reply);
+}
+
 auto TradingSystemFacade::react_on(
     const protocol::SessionTerminatedEvent& event) -> void {
   log::debug("trading system is notified about {}", event);
@@ -106,24 +145,35 @@ auto TradingSystemFacade::react_on(
 auto TradingSystemFacade::terminate() -> void {
   persistence_controller_.store();
   event_loop_.terminate();
-  thread_pool_.await();
+  await_executor();
+  dump_latency();
 }
 
 auto TradingSystemFacade::init_trading_engines() -> void {
   // Load all cached instruments
-  std::vector<Instrument> instruments = instruments_.retrieve_instruments();
+  const std::vector<Instrument> instruments =
+      instruments_.retrieve_instruments();
 
   // Create a matching engine factory
-  std::unique_ptr<TradingEngineFactory> engine_factory =
-      create_matching_engine_factory(config_, thread_pool_);
-
-  for (auto& instrument : instruments) {
-    // Add a trading engine for each instrument to the repository
-    engines_repository_.add_engine(
-        instrument, engine_factory->create_trading_engine(instrument));
+  const std::unique_ptr<TradingEngineFactory> engine_factory =
+      create_matching_engine_factory(config_, executor(), tick_deadlines_);
+
+  // Engines are constructed concurrently, each into its instrument's slot
+  startup_progress_.begin_construction(instruments.size());
+  std::vector<std::unique_ptr<TradingEngine>> engines(instruments.size());
+  parallel_for(instruments.size(), [&](std::size_t index) {
+    engines[index] = engine_factory->create_trading_engine(instruments[index]);
+    startup_progress_.engine_constructed();
+  });
+
+  // Engines are registered in the instruments order,
+  // so that the repository does not depend on the construction timing
+  for (std::size_t index = 0; index < instruments.size(); ++index) {
+    engines_repository_.add_engine(instruments[index],
+                                   std::move(engines[index]));
   }
 
-  log::debug("initialized trading engines");
+  log::debug("initialized {} trading engines", engines_repository_.size());
 }
 
 auto TradingSystemFacade::launch_ies() -> void {
@@ -141,8 +191,10 @@ auto TradingSystemFacade::launch_ies() -> void {
 }
 
 auto TradingSystemFacade::process(const event::Tick& event) -> void {
-  engines_repository_.for_each_engine(
-      [&event](TradingEngine& engine) { engine.handle(event); });
+  // Engines without a due deadline have no orders to expire at the tick
+  for (const InstrumentId instrument_id : tick_deadlines_.take_due(event)) {
+    engines_repository_.find_instrument_engine(instrument_id).handle(event);
+  }
 }
 
 auto TradingSystemFacade::process(const event::PhaseTransition& event) -> void {
@@ -150,4 +202,39 @@ auto TradingSystemFacade::process(const event::PhaseTransition& event) -> void {
       [&event](TradingEngine& engine) { engine.handle(event); });
 }
 
-}  // namespace simulator::trading_system
\ No newline at end of file
+auto TradingSystemFacade::collect_latency(
+    protocol::EngineLatencyReply& reply) const -> void {
+  engines_repository_.for_each_engine([&reply](TradingEngine& engine) {
+    engine.provide_latency(reply.engines.emplace_back());
+  });
+}
+
+auto TradingSystemFacade::executor() noexcept -> runtime::Service& {
+  if (venue_executor_) {
+    return *venue_executor_;
+  }
+  return *thread_pool_;
+}
+
+auto TradingSystemFacade::await_executor() noexcept -> void {
+  if (venue_executor_) {
+    venue_executor_->await();
+    return;
+  }
+  thread_pool_->await();
+}
+
+auto TradingSystemFacade::dump_latency() const -> void {
+  protocol::EngineLatencyReply reply;
+  collect_latency(reply);
+  for (const auto& engine : reply.engines) {
+    for (const auto& command : engine.commands) {
+      log::info("instrument {} ({}) latency: {}",
+                engine.instrument_id,
+                engine.symbol,
+                command);
+    }
+  }
+}
+
+}  // namespace simulator::trading_system
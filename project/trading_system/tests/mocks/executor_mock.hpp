@@ -20,6 +20,14 @@ struct ExecutorMock : public Executor {
               execute_request,
               (protocol::OrderCancellationRequest),
               (const, override));
+  MOCK_METHOD(void,
+              execute_request,
+              (protocol::OrderMassCancellationRequest),
+              (const, override));
+  MOCK_METHOD(void,
+              execute_request,
+              (protocol::MassQuoteRequest),
+              (const, override));
   MOCK_METHOD(void,
               execute_request,
               (protocol::MarketDataRequest),
@@ -23,6 +23,10 @@ struct InstrumentResolverMock : public InstrumentResolver {
               resolve_instrument,
               (const Instrument&),
               (const, override));
+  MOCK_METHOD(ResolutionMemoStatistics,
+              memo_statistics,
+              (),
+              (const, override));
 };
 
 }  // namespace simulator::trading_system::test
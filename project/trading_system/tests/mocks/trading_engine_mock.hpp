@@ -15,14 +15,19 @@ struct TradingEngineMock : TradingEngine {
   MOCK_METHOD(void, execute, (protocol::OrderPlacementRequest request), (override));
   MOCK_METHOD(void, execute, (protocol::OrderModificationRequest request), (override));
   MOCK_METHOD(void, execute, (protocol::OrderCancellationRequest request), (override));
+  MOCK_METHOD(void, execute, (protocol::OrderMassCancellationRequest request), (override));
+  MOCK_METHOD(void, execute, (protocol::MassQuoteRequest request), (override));
   MOCK_METHOD(void, execute, (protocol::MarketDataRequest), (override));
   MOCK_METHOD(void, execute, (protocol::SecurityStatusRequest), (override));
   MOCK_METHOD(void, provide_state, (protocol::InstrumentState & reply), (override));
   MOCK_METHOD(void, store_state, (market_state::InstrumentState& state), (override));
   MOCK_METHOD(void, recover_state, (market_state::InstrumentState event), (override));
+  MOCK_METHOD(void, provide_latency, (protocol::EngineLatency& latency), (override));
   MOCK_METHOD(void, handle, (event::Tick event), (override));
   MOCK_METHOD(void, handle, (event::PhaseTransition event), (override));
   MOCK_METHOD(void, handle, (const protocol::SessionTerminatedEvent& event), (override));
+  MOCK_METHOD(void, replay_at, (core::sys_us journaled_at), (override));
+  MOCK_METHOD(void, finish_replay, (), (override));
   // clang-format on
 };
 
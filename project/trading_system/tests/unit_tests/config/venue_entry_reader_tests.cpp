@@ -109,6 +109,36 @@ TEST_F(TradingSystemVenueEntryReader, SetsTradeAggressorStreamingFromVenue) {
   ASSERT_TRUE(config.trade_aggressor_streaming_enabled());
 }
 
+TEST_F(TradingSystemVenueEntryReader, SetsTradeHistoryDepthByDefaultOne) {
+  reader(Venue::create(patch));
+  ASSERT_EQ(config.trade_history_depth(), 1);
+}
+
+TEST_F(TradingSystemVenueEntryReader, SetsTradeHistoryDepthFromVenue) {
+  patch.with_tns_history_depth(100);  // NOLINT: Test value
+  reader(Venue::create(patch));
+  ASSERT_EQ(config.trade_history_depth(), 100);
+}
+
+TEST_F(TradingSystemVenueEntryReader, CapsTradeHistoryDepthFromVenue) {
+  patch.with_tns_history_depth(Venue::MaxTnsHistoryDepth + 1);
+  reader(Venue::create(patch));
+  ASSERT_EQ(config.trade_history_depth(), Venue::MaxTnsHistoryDepth);
+}
+
+TEST_F(TradingSystemVenueEntryReader, SetsSelfTradePreventionByDefaultNone) {
+  reader(Venue::create(patch));
+  ASSERT_EQ(config.self_trade_prevention(),
+            matching_engine::SelfTradePrevention::None);
+}
+
+TEST_F(TradingSystemVenueEntryReader, SetsSelfTradePreventionFromVenue) {
+  patch.with_self_trade_prevention(Venue::SelfTradePrevention::CancelOldest);
+  reader(Venue::create(patch));
+  ASSERT_EQ(config.self_trade_prevention(),
+            matching_engine::SelfTradePrevention::CancelOldest);
+}
+
 TEST_F(TradingSystemVenueEntryReader, SetsDepthOrdersExclusionByDefaultFalse) {
   reader(Venue::create(patch));
   ASSERT_FALSE(config.depth_orders_exclusion_enabled());
@@ -122,6 +122,78 @@ TEST_F(TradingSystemExecutionSystem,
   execution_system.execute_request(request);
 }
 
+TEST_F(TradingSystemExecutionSystem,
+       BroadcastsOrderMassCancellationRequestWithoutInstrument) {
+  const auto request =
+      make_external_request<protocol::OrderMassCancellationRequest>();
+
+  EXPECT_CALL(instrument_resolver,
+              resolve_instrument(A<const InstrumentDescriptor&>()))
+      .Times(0);
+  EXPECT_CALL(repository_accessor, broadcast_impl(_));
+
+  execution_system.execute_request(request);
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       ReportsOrderMassCancellationRequestBroadcastOnce) {
+  const auto request =
+      make_external_request<protocol::OrderMassCancellationRequest>();
+
+  EXPECT_CALL(trading_reply_receiver,
+              process(A<protocol::OrderMassCancellationReport>()))
+      .Times(1);
+
+  execution_system.execute_request(request);
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       UnicastsOrderMassCancellationRequestWithInstrument) {
+  auto request =
+      make_external_request<protocol::OrderMassCancellationRequest>();
+  request.instrument = requested_instrument;
+
+  EXPECT_CALL(repository_accessor, unicast_impl(Eq(instrument.identifier), _));
+  EXPECT_CALL(repository_accessor, broadcast_impl(_)).Times(0);
+  EXPECT_CALL(trading_reply_receiver,
+              process(A<protocol::OrderMassCancellationReport>()))
+      .Times(0);
+
+  execution_system.execute_request(request);
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       HandlesInstrumentResolutionFailureOnOrderMassCancellationRequest) {
+  auto request =
+      make_external_request<protocol::OrderMassCancellationRequest>();
+  request.instrument = requested_instrument;
+
+  ON_CALL(instrument_resolver,
+          resolve_instrument(A<const InstrumentDescriptor&>()))
+      .WillByDefault(Return(
+          tl::make_unexpected(instrument::LookupError::InstrumentNotFound)));
+
+  EXPECT_CALL(trading_reply_receiver,
+              process(A<protocol::BusinessMessageReject>()));
+
+  execution_system.execute_request(request);
+}
+
+TEST_F(TradingSystemExecutionSystem,
+       HandlesInstrumentResolutionFailureOnMassQuoteRequest) {
+  const auto request = make_external_request<protocol::MassQuoteRequest>();
+
+  ON_CALL(instrument_resolver,
+          resolve_instrument(A<const InstrumentDescriptor&>()))
+      .WillByDefault(Return(
+          tl::make_unexpected(instrument::LookupError::InstrumentNotFound)));
+
+  EXPECT_CALL(trading_reply_receiver,
+              process(A<protocol::BusinessMessageReject>()));
+
+  execution_system.execute_request(request);
+}
+
 TEST_F(TradingSystemExecutionSystem,
        RejectesMarketDataRequestWithNoInstruments) {
   auto request = make_external_request<protocol::MarketDataRequest>();
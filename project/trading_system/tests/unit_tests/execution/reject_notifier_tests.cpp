@@ -4,10 +4,13 @@
 #include "ih/execution/reject_notifier.hpp"
 #include "middleware/channels/trading_reply_channel.hpp"
 #include "mocks/trading_reply_receiver_mock.hpp"
+#include "protocol/app/business_message_reject.hpp"
 #include "protocol/app/market_data_reject.hpp"
 #include "protocol/app/market_data_request.hpp"
+#include "protocol/app/mass_quote_request.hpp"
 #include "protocol/app/order_cancellation_reject.hpp"
 #include "protocol/app/order_cancellation_request.hpp"
+#include "protocol/app/order_mass_cancellation_request.hpp"
 #include "protocol/app/order_modification_reject.hpp"
 #include "protocol/app/order_modification_request.hpp"
 #include "protocol/app/order_placement_reject.hpp"
@@ -78,6 +81,37 @@ TEST_F(TradingSystemRejectNotifier, RejectsOrderCancellationRequest) {
   EXPECT_THAT(reject.order_status, Optional(Eq(OrderStatus::Option::Rejected)));
 }
 
+TEST_F(TradingSystemRejectNotifier, RejectsOrderMassCancellationRequest) {
+  auto request = make_request<protocol::OrderMassCancellationRequest>();
+  request.client_order_id = ClientOrderId{"mass-cancel"};
+  auto reject = make_request<protocol::BusinessMessageReject>();
+
+  EXPECT_CALL(middleware_receiver,
+              process(A<protocol::BusinessMessageReject>()))
+      .WillOnce(SaveArg<0>(&reject));
+  notifier.reject(request, "reason");
+
+  EXPECT_THAT(reject.text, Optional(Eq(RejectText{"reason"})));
+  EXPECT_THAT(reject.ref_id, Optional(Eq(BusinessRejectRefId{"mass-cancel"})));
+  EXPECT_THAT(
+      reject.ref_message_type,
+      Optional(Eq(RejectedMessageType::Option::OrderMassCancelRequest)));
+}
+
+TEST_F(TradingSystemRejectNotifier, RejectsMassQuoteRequest) {
+  auto const request = make_request<protocol::MassQuoteRequest>();
+  auto reject = make_request<protocol::BusinessMessageReject>();
+
+  EXPECT_CALL(middleware_receiver,
+              process(A<protocol::BusinessMessageReject>()))
+      .WillOnce(SaveArg<0>(&reject));
+  notifier.reject(request, "reason");
+
+  EXPECT_THAT(reject.text, Optional(Eq(RejectText{"reason"})));
+  EXPECT_THAT(reject.ref_message_type,
+              Optional(Eq(RejectedMessageType::Option::MassQuote)));
+}
+
 TEST_F(TradingSystemRejectNotifier, RejectsMarketDataRequest) {
   auto const request = make_request<protocol::MarketDataRequest>();
   auto reject = make_request<protocol::MarketDataReject>();
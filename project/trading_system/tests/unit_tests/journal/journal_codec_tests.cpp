@@ -0,0 +1,280 @@
+#include <gmock/gmock.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "common/events.hpp"
+#include "common/phase.hpp"
+#include "ih/journal/journal_codec.hpp"
+#include "protocol/types/session.hpp"
+
+namespace simulator::trading_system::journal::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+struct TradingSystemJournalCodec : public Test {
+  static auto make_fix_session() -> protocol::Session {
+    protocol::fix::Session session{protocol::fix::BeginString{"FIXT.1.1"},
+                                   protocol::fix::SenderCompId{"Client"},
+                                   protocol::fix::TargetCompId{"Venue"}};
+    session.client_sub_id = protocol::fix::ClientSubId{"Desk"};
+    return protocol::Session{std::move(session)};
+  }
+
+  auto round_trip(const Command& command) -> Record {
+    buffer.clear();
+    encode(42, journaled_at, command, buffer);
+    const auto decoded = decode_record(buffer);
+    EXPECT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->size, buffer.size());
+    return decoded->record;
+  }
+
+  const core::sys_us journaled_at{std::chrono::seconds{1726673575}};
+  std::vector<std::byte> buffer;
+};
+
+TEST_F(TradingSystemJournalCodec, RoundTripsHeader) {
+  encode(Header{.generation = 7}, buffer);
+
+  ASSERT_EQ(buffer.size(), HeaderSize);
+  const auto header = decode_header(buffer);
+  ASSERT_TRUE(header.has_value());
+  ASSERT_EQ(header->generation, 7);
+}
+
+TEST_F(TradingSystemJournalCodec, RejectsHeaderOfUnknownFile) {
+  buffer.assign(HeaderSize, std::byte{0x7f});
+
+  ASSERT_EQ(decode_header(buffer), tl::unexpected{DecodingError::UnknownMagic});
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsOrderPlacementRequest) {
+  protocol::OrderPlacementRequest request{make_fix_session()};
+  request.instrument.symbol = Symbol{"AAPL"};
+  request.instrument.security_id = SecurityId{"US0378331005"};
+  request.instrument.security_id_source = SecurityIdSource::Option::Isin;
+  request.parties.emplace_back(PartyId{"Trader"},
+                               PartyIdSource::Option::Proprietary,
+                               PartyRole::Option::ExecutingTrader);
+  request.client_order_id = ClientOrderId{"Order-1"};
+  request.expire_time = ExpireTime{core::sys_us{std::chrono::seconds{1}}};
+  request.order_price = OrderPrice{101.25};
+  request.order_quantity = OrderQuantity{300};
+  request.display_quantity = DisplayQuantity{100};
+  request.time_in_force = TimeInForce::Option::GoodTillDate;
+  request.order_type = OrderType::Option::Limit;
+  request.side = Side::Option::Buy;
+
+  const auto record = round_trip(request);
+
+  ASSERT_EQ(record.sequence, 42);
+  ASSERT_EQ(record.time, journaled_at);
+  const auto* decoded =
+      std::get_if<protocol::OrderPlacementRequest>(&record.command);
+  ASSERT_THAT(decoded, NotNull());
+  ASSERT_EQ(decoded->session, request.session);
+  ASSERT_EQ(decoded->instrument, request.instrument);
+  ASSERT_EQ(decoded->parties, request.parties);
+  ASSERT_EQ(decoded->client_order_id, request.client_order_id);
+  ASSERT_EQ(decoded->expire_time, request.expire_time);
+  ASSERT_EQ(decoded->expire_date, std::nullopt);
+  ASSERT_EQ(decoded->order_price, request.order_price);
+  ASSERT_EQ(decoded->stop_price, std::nullopt);
+  ASSERT_EQ(decoded->order_quantity, request.order_quantity);
+  ASSERT_EQ(decoded->display_quantity, request.display_quantity);
+  ASSERT_EQ(decoded->time_in_force, request.time_in_force);
+  ASSERT_EQ(decoded->order_type, request.order_type);
+  ASSERT_EQ(decoded->side, request.side);
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsStopLimitOrderPlacementRequest) {
+  protocol::OrderPlacementRequest request{make_fix_session()};
+  request.instrument.symbol = Symbol{"AAPL"};
+  request.client_order_id = ClientOrderId{"Order-1"};
+  request.order_price = OrderPrice{101.25};
+  request.stop_price = StopPrice{100.5};
+  request.order_quantity = OrderQuantity{300};
+  request.time_in_force = TimeInForce::Option::Day;
+  request.order_type = OrderType::Option::StopLimit;
+  request.side = Side::Option::Buy;
+
+  const auto record = round_trip(request);
+
+  const auto* decoded =
+      std::get_if<protocol::OrderPlacementRequest>(&record.command);
+  ASSERT_THAT(decoded, NotNull());
+  ASSERT_EQ(decoded->order_price, request.order_price);
+  ASSERT_EQ(decoded->stop_price, request.stop_price);
+  ASSERT_EQ(decoded->order_quantity, request.order_quantity);
+  ASSERT_EQ(decoded->order_type, request.order_type);
+  ASSERT_EQ(decoded->side, request.side);
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsOrderModificationRequest) {
+  protocol::OrderModificationRequest request{
+      protocol::Session{protocol::generator::Session{}}};
+  request.orig_client_order_id = OrigClientOrderId{"Order-1"};
+  request.venue_order_id = VenueOrderId{"1001"};
+  request.client_order_id = ClientOrderId{"Order-2"};
+  request.order_quantity = OrderQuantity{100};
+
+  const auto record = round_trip(request);
+
+  const auto* decoded =
+      std::get_if<protocol::OrderModificationRequest>(&record.command);
+  ASSERT_THAT(decoded, NotNull());
+  ASSERT_EQ(decoded->session, request.session);
+  ASSERT_EQ(decoded->orig_client_order_id, request.orig_client_order_id);
+  ASSERT_EQ(decoded->venue_order_id, request.venue_order_id);
+  ASSERT_EQ(decoded->client_order_id, request.client_order_id);
+  ASSERT_EQ(decoded->order_quantity, request.order_quantity);
+  ASSERT_EQ(decoded->order_price, std::nullopt);
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsOrderCancellationRequest) {
+  protocol::OrderCancellationRequest request{make_fix_session()};
+  request.orig_client_order_id = OrigClientOrderId{"Order-1"};
+  request.client_order_id = ClientOrderId{"Order-2"};
+  request.side = Side::Option::Sell;
+
+  const auto record = round_trip(request);
+
+  const auto* decoded =
+      std::get_if<protocol::OrderCancellationRequest>(&record.command);
+  ASSERT_THAT(decoded, NotNull());
+  ASSERT_EQ(decoded->session, request.session);
+  ASSERT_EQ(decoded->orig_client_order_id, request.orig_client_order_id);
+  ASSERT_EQ(decoded->client_order_id, request.client_order_id);
+  ASSERT_EQ(decoded->side, request.side);
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsOrderMassCancellationRequest) {
+  protocol::OrderMassCancellationRequest request{make_fix_session()};
+  request.client_order_id = ClientOrderId{"MassCancel-1"};
+  request.seq_num = SeqNum{12};
+  request.parties.emplace_back(PartyId{"Firm"},
+                               PartyIdSource::Option::Proprietary,
+                               PartyRole::Option::ExecutingFirm);
+  request.side = Side::Option::Buy;
+
+  const auto record = round_trip(request);
+
+  const auto* decoded =
+      std::get_if<protocol::OrderMassCancellationRequest>(&record.command);
+  ASSERT_THAT(decoded, NotNull());
+  ASSERT_EQ(decoded->session, request.session);
+  ASSERT_EQ(decoded->instrument, std::nullopt);
+  ASSERT_EQ(decoded->client_order_id, request.client_order_id);
+  ASSERT_EQ(decoded->seq_num, request.seq_num);
+  ASSERT_EQ(decoded->parties, request.parties);
+  ASSERT_EQ(decoded->side, request.side);
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsMassQuoteRequest) {
+  protocol::MassQuoteRequest request{make_fix_session()};
+  request.instrument.symbol = Symbol{"AAPL"};
+  request.client_order_id = ClientOrderId{"Quote-1"};
+  request.entries.push_back(
+      protocol::QuoteEntry{.client_order_id = ClientOrderId{"Bid-1"},
+                           .order_price = OrderPrice{100.5},
+                           .order_quantity = OrderQuantity{200},
+                           .side = Side::Option::Buy});
+  request.entries.push_back(
+      protocol::QuoteEntry{.client_order_id = ClientOrderId{"Offer-1"},
+                           .order_price = OrderPrice{101.5},
+                           .order_quantity = OrderQuantity{100},
+                           .side = Side::Option::Sell});
+
+  const auto record = round_trip(request);
+
+  const auto* decoded =
+      std::get_if<protocol::MassQuoteRequest>(&record.command);
+  ASSERT_THAT(decoded, NotNull());
+  ASSERT_EQ(decoded->session, request.session);
+  ASSERT_EQ(decoded->instrument, request.instrument);
+  ASSERT_EQ(decoded->client_order_id, request.client_order_id);
+  ASSERT_EQ(decoded->seq_num, std::nullopt);
+  ASSERT_EQ(decoded->entries.size(), 2);
+  ASSERT_EQ(decoded->entries[1].client_order_id, ClientOrderId{"Offer-1"});
+  ASSERT_EQ(decoded->entries[1].order_price, OrderPrice{101.5});
+  ASSERT_EQ(decoded->entries[1].order_quantity, OrderQuantity{100});
+  ASSERT_EQ(decoded->entries[1].side, Side::Option::Sell);
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsSessionTerminatedEvent) {
+  const protocol::SessionTerminatedEvent event{make_fix_session()};
+
+  const auto record = round_trip(event);
+
+  const auto* decoded =
+      std::get_if<protocol::SessionTerminatedEvent>(&record.command);
+  ASSERT_THAT(decoded, NotNull());
+  ASSERT_EQ(decoded->session, event.session);
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsTick) {
+  const event::Tick tick{
+      .sys_tick_time = core::sys_us{std::chrono::seconds{1700000000}},
+      .tz_tick_time = core::tz_us{std::chrono::seconds{1700003600}},
+      .is_new_sys_day = true,
+      .is_new_tz_day = false};
+
+  const auto record = round_trip(tick);
+
+  ASSERT_THAT(record.command, VariantWith<event::Tick>(Eq(tick)));
+}
+
+TEST_F(TradingSystemJournalCodec, RoundTripsPhaseTransition) {
+  const event::PhaseTransition transition{
+      .tz_time_point = core::tz_us{std::chrono::seconds{1700003600}},
+      .phase = Phase{TradingPhase::Option::Open,
+                     TradingStatus::Option::Halt,
+                     Phase::Settings{.allow_cancels = true}}};
+
+  const auto record = round_trip(transition);
+
+  ASSERT_THAT(record.command,
+              VariantWith<event::PhaseTransition>(Eq(transition)));
+}
+
+TEST_F(TradingSystemJournalCodec, ReportsTruncatedRecord) {
+  encode(1, journaled_at, event::Tick{}, buffer);
+  buffer.pop_back();
+
+  ASSERT_EQ(decode_record(buffer), tl::unexpected{DecodingError::Truncated});
+}
+
+TEST_F(TradingSystemJournalCodec, ReportsChecksumMismatch) {
+  encode(1, journaled_at, event::Tick{}, buffer);
+  buffer[sizeof(std::uint32_t) + 2] ^= std::byte{0x01};
+
+  ASSERT_EQ(decode_record(buffer),
+            tl::unexpected{DecodingError::ChecksumMismatch});
+}
+
+TEST_F(TradingSystemJournalCodec, DecodesRecordsAppendedToBuffer) {
+  encode(1, journaled_at, event::Tick{}, buffer);
+  const auto first_size = buffer.size();
+  encode(2,
+         journaled_at,
+         protocol::SessionTerminatedEvent{make_fix_session()},
+         buffer);
+
+  const auto first = decode_record(buffer);
+  ASSERT_TRUE(first.has_value());
+  ASSERT_EQ(first->size, first_size);
+
+  const auto second = decode_record(std::span{buffer}.subspan(first_size));
+  ASSERT_TRUE(second.has_value());
+  ASSERT_EQ(second->record.sequence, 2);
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::journal::test
@@ -0,0 +1,183 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <thread>
+
+#include "common/events.hpp"
+#include "core/tools/time.hpp"
+#include "ih/journal/journal_files.hpp"
+#include "ih/journal/journal_reader.hpp"
+#include "ih/journal/journal_writer.hpp"
+
+namespace simulator::trading_system::journal::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+struct TradingSystemJournalWriter : public Test {
+  auto SetUp() -> void override {
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+  }
+
+  auto TearDown() -> void override { std::filesystem::remove_all(directory); }
+
+  static auto make_tick(std::int64_t seconds) -> event::Tick {
+    return event::Tick{
+        .sys_tick_time = core::sys_us{std::chrono::seconds{seconds}},
+        .tz_tick_time = core::tz_us{std::chrono::seconds{seconds}},
+        .is_new_sys_day = false,
+        .is_new_tz_day = false};
+  }
+
+  auto write_ticks(std::uint64_t generation, std::int64_t count) -> void {
+    auto writer =
+        Writer::create(journal_file_path(directory, "key", generation),
+                       generation,
+                       settings,
+                       committer);
+    ASSERT_TRUE(writer.has_value()) << writer.error();
+    for (std::int64_t tick = 0; tick < count; ++tick) {
+      (*writer)->append(make_tick(tick));
+    }
+  }
+
+  const std::filesystem::path directory{
+      std::filesystem::temp_directory_path() / "journal_writer_tests" /
+      UnitTest::GetInstance()->current_test_info()->name()};
+  Writer::Settings settings;
+  Committer committer;
+};
+
+TEST_F(TradingSystemJournalWriter, DoesNotOverwriteExistingJournal) {
+  write_ticks(1, 1);
+
+  const auto writer = Writer::create(
+      journal_file_path(directory, "key", 1), 1, settings, committer);
+
+  ASSERT_FALSE(writer.has_value());
+}
+
+TEST_F(TradingSystemJournalWriter, WritesRecordsReadInAppendOrder) {
+  write_ticks(3, 100);
+
+  auto reader = Reader::open(journal_file_path(directory, "key", 3));
+  ASSERT_TRUE(reader.has_value()) << reader.error();
+  ASSERT_EQ(reader->header().generation, 3);
+
+  for (std::int64_t tick = 0; tick < 100; ++tick) {
+    const auto record = reader->next();
+    ASSERT_TRUE(record.has_value());
+    ASSERT_EQ(record->sequence, tick + 1);
+    ASSERT_THAT(record->command, VariantWith<event::Tick>(Eq(make_tick(tick))));
+  }
+  ASSERT_EQ(reader->next(), std::nullopt);
+  ASSERT_EQ(reader->error(), std::nullopt);
+}
+
+TEST_F(TradingSystemJournalWriter, CommitsBufferedRecordsOnRequest) {
+  Committer idle_committer{std::chrono::hours{1}};
+  const auto file_path = journal_file_path(directory, "key", 1);
+  auto writer = Writer::create(file_path, 1, settings, idle_committer);
+  ASSERT_TRUE(writer.has_value()) << writer.error();
+
+  (*writer)->append(make_tick(1));
+  (*writer)->commit();
+
+  auto reader = Reader::open(file_path);
+  ASSERT_TRUE(reader.has_value()) << reader.error();
+  ASSERT_TRUE(reader->next().has_value());
+}
+
+TEST_F(TradingSystemJournalWriter, CommitsRecordsOfAllWritersOnceDue) {
+  settings.commit_size = 1;
+  Committer idle_committer{std::chrono::hours{1}};
+  const auto first_path = journal_file_path(directory, "first", 1);
+  const auto second_path = journal_file_path(directory, "second", 1);
+  auto first = Writer::create(first_path, 1, settings, idle_committer);
+  auto second = Writer::create(second_path, 1, settings, idle_committer);
+  ASSERT_TRUE(first.has_value()) << first.error();
+  ASSERT_TRUE(second.has_value()) << second.error();
+
+  (*first)->append(make_tick(1));
+  (*second)->append(make_tick(2));
+
+  // The records reach the commit size, the committer does not wait
+  // for the commit interval to elapse
+  for (const auto& file_path : {first_path, second_path}) {
+    std::optional<Record> record;
+    for (int attempt = 0; attempt < 1000 && !record.has_value(); ++attempt) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      auto reader = Reader::open(file_path);
+      ASSERT_TRUE(reader.has_value()) << reader.error();
+      record = reader->next();
+    }
+    ASSERT_TRUE(record.has_value());
+  }
+}
+
+TEST_F(TradingSystemJournalWriter, StampsRecordsWithCurrentTime) {
+  const core::sys_us now{std::chrono::seconds{1726673575}};
+  {
+    const core::CurrentTimeOverride time_override{now};
+    write_ticks(1, 1);
+  }
+
+  auto reader = Reader::open(journal_file_path(directory, "key", 1));
+  ASSERT_TRUE(reader.has_value()) << reader.error();
+  const auto record = reader->next();
+  ASSERT_TRUE(record.has_value());
+  ASSERT_EQ(record->time, now);
+}
+
+TEST_F(TradingSystemJournalWriter, StopsReadingAtTruncatedRecord) {
+  write_ticks(1, 2);
+  const auto file_path = journal_file_path(directory, "key", 1);
+  std::filesystem::resize_file(file_path,
+                               std::filesystem::file_size(file_path) - 1);
+
+  auto reader = Reader::open(file_path);
+  ASSERT_TRUE(reader.has_value()) << reader.error();
+
+  ASSERT_TRUE(reader->next().has_value());
+  ASSERT_EQ(reader->next(), std::nullopt);
+  ASSERT_EQ(reader->error(), DecodingError::Truncated);
+}
+
+TEST_F(TradingSystemJournalWriter, ListsGenerationsOfKeyInAscendingOrder) {
+  write_ticks(10, 0);
+  write_ticks(2, 0);
+  std::ofstream{directory / "other.1.journal"};
+  std::ofstream{directory / "key.backup"};
+
+  ASSERT_THAT(list_generations(directory, "key"), ElementsAre(2, 10));
+}
+
+TEST_F(TradingSystemJournalWriter, RemovesGenerationsBeforeGiven) {
+  write_ticks(1, 0);
+  write_ticks(2, 0);
+  write_ticks(3, 0);
+
+  remove_generations_before(directory, "key", 3);
+
+  ASSERT_THAT(list_generations(directory, "key"), ElementsAre(3));
+}
+
+TEST_F(TradingSystemJournalWriter, KeysInstrumentByDatabaseIdentifier) {
+  Instrument instrument;
+  instrument.identifier = InstrumentId{1};
+  ASSERT_EQ(journal_key(instrument), "engine-1");
+
+  instrument.database_id = DatabaseId{42};
+  ASSERT_EQ(journal_key(instrument), "instrument-42");
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::journal::test
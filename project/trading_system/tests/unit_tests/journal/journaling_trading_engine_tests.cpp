@@ -0,0 +1,191 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+#include "common/events.hpp"
+#include "core/tools/time.hpp"
+#include "ih/journal/journal_files.hpp"
+#include "ih/journal/journal_reader.hpp"
+#include "ih/journal/journaling_trading_engine.hpp"
+#include "mocks/trading_engine_mock.hpp"
+#include "protocol/types/session.hpp"
+
+namespace simulator::trading_system::journal::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*magic-numbers*,*non-private-member*)
+
+struct TradingSystemJournalingTradingEngine : public Test {
+  using EngineMock = NiceMock<trading_system::test::TradingEngineMock>;
+
+  auto SetUp() -> void override { std::filesystem::remove_all(directory); }
+
+  auto TearDown() -> void override { std::filesystem::remove_all(directory); }
+
+  auto make_engine() -> std::unique_ptr<JournalingTradingEngine> {
+    auto engine = std::make_unique<EngineMock>();
+    inner = engine.get();
+    return std::make_unique<JournalingTradingEngine>(
+        directory, "key", std::move(engine), Writer::Settings{}, committer);
+  }
+
+  static auto make_placement() -> protocol::OrderPlacementRequest {
+    protocol::OrderPlacementRequest request{
+        protocol::Session{protocol::generator::Session{}}};
+    request.client_order_id = ClientOrderId{"Order-1"};
+    return request;
+  }
+
+  const std::filesystem::path directory{
+      std::filesystem::temp_directory_path() / "journaling_engine_tests" /
+      UnitTest::GetInstance()->current_test_info()->name()};
+  EngineMock* inner = nullptr;
+  std::shared_ptr<Committer> committer = std::make_shared<Committer>();
+};
+
+TEST_F(TradingSystemJournalingTradingEngine, ForwardsCommandsToEngine) {
+  auto engine = make_engine();
+
+  EXPECT_CALL(*inner, execute(A<protocol::OrderPlacementRequest>()));
+  EXPECT_CALL(*inner, handle(A<event::Tick>()));
+
+  engine->execute(make_placement());
+  engine->handle(event::Tick{});
+}
+
+TEST_F(TradingSystemJournalingTradingEngine,
+       StartsNewGenerationWhenStateIsStored) {
+  auto engine = make_engine();
+  market_state::InstrumentState state;
+
+  EXPECT_CALL(*inner, store_state(_)).Times(2);
+
+  engine->store_state(state);
+  ASSERT_EQ(state.journal_generation, 1);
+  engine->store_state(state);
+  ASSERT_EQ(state.journal_generation, 2);
+
+  ASSERT_THAT(list_generations(directory, "key"), ElementsAre(1, 2));
+}
+
+TEST_F(TradingSystemJournalingTradingEngine, JournalsCommandsAfterStateStored) {
+  {
+    auto engine = make_engine();
+    market_state::InstrumentState state;
+    engine->store_state(state);
+
+    engine->execute(make_placement());
+    engine->handle(event::Tick{});
+  }
+
+  auto reader = Reader::open(journal_file_path(directory, "key", 1));
+  ASSERT_TRUE(reader.has_value()) << reader.error();
+  const auto placement = reader->next();
+  ASSERT_TRUE(placement.has_value());
+  ASSERT_THAT(placement->command,
+              VariantWith<protocol::OrderPlacementRequest>(_));
+  const auto tick = reader->next();
+  ASSERT_TRUE(tick.has_value());
+  ASSERT_THAT(tick->command, VariantWith<event::Tick>(_));
+  ASSERT_EQ(reader->next(), std::nullopt);
+}
+
+TEST_F(TradingSystemJournalingTradingEngine,
+       ReplaysJournalWhenStateIsRecoveredAtStartUp) {
+  {
+    auto engine = make_engine();
+    market_state::InstrumentState state;
+    engine->store_state(state);
+    engine->execute(make_placement());
+    engine->store_state(state);
+    engine->handle(event::Tick{});
+  }
+
+  auto engine = make_engine();
+  market_state::InstrumentState state;
+  state.journal_generation = 2;
+
+  EXPECT_CALL(*inner, recover_state(_));
+  EXPECT_CALL(*inner, execute(A<protocol::OrderPlacementRequest>())).Times(0);
+  EXPECT_CALL(*inner, handle(A<event::Tick>()));
+
+  engine->recover_state(state);
+}
+
+TEST_F(TradingSystemJournalingTradingEngine,
+       ReplaysCommandsAtTimeTheyWereJournaledAt) {
+  const core::sys_us journaled_at{std::chrono::seconds{1726673575}};
+  {
+    auto engine = make_engine();
+    market_state::InstrumentState state;
+    engine->store_state(state);
+    const core::CurrentTimeOverride time_override{journaled_at};
+    engine->execute(make_placement());
+  }
+
+  auto engine = make_engine();
+  market_state::InstrumentState state;
+  state.journal_generation = 1;
+
+  InSequence sequence;
+  EXPECT_CALL(*inner, replay_at(Eq(journaled_at)));
+  EXPECT_CALL(*inner, execute(A<protocol::OrderPlacementRequest>()));
+  EXPECT_CALL(*inner, finish_replay());
+
+  engine->recover_state(state);
+}
+
+TEST_F(TradingSystemJournalingTradingEngine,
+       FailsToStoreStateWhenJournalCannotBeCreated) {
+  auto engine = make_engine();
+  // A journal of the first generation already exists
+  std::filesystem::create_directories(directory);
+  std::ofstream{journal_file_path(directory, "key", 1)};
+  market_state::InstrumentState state;
+
+  ASSERT_THROW(engine->store_state(state), std::runtime_error);
+}
+
+TEST_F(TradingSystemJournalingTradingEngine,
+       JournalsToPreviousGenerationWhenNewOneCannotBeCreated) {
+  auto engine = make_engine();
+  market_state::InstrumentState state;
+  engine->store_state(state);
+  std::ofstream{journal_file_path(directory, "key", 2)};
+
+  ASSERT_THROW(engine->store_state(state), std::runtime_error);
+  engine->handle(event::Tick{});
+  engine.reset();
+
+  auto reader = Reader::open(journal_file_path(directory, "key", 1));
+  ASSERT_TRUE(reader.has_value()) << reader.error();
+  const auto tick = reader->next();
+  ASSERT_TRUE(tick.has_value());
+  ASSERT_THAT(tick->command, VariantWith<event::Tick>(_));
+}
+
+TEST_F(TradingSystemJournalingTradingEngine,
+       DoesNotReplayJournalOnceJournalingStarted) {
+  auto engine = make_engine();
+  market_state::InstrumentState state;
+  engine->store_state(state);
+  engine->handle(event::Tick{});
+  engine->store_state(state);
+
+  state.journal_generation = 1;
+  EXPECT_CALL(*inner, recover_state(_));
+  EXPECT_CALL(*inner, handle(A<event::Tick>())).Times(0);
+
+  engine->recover_state(state);
+}
+
+// NOLINTEND(*magic-numbers*,*non-private-member*)
+
+}  // namespace
+}  // namespace simulator::trading_system::journal::test
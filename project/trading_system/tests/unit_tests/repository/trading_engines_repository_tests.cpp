@@ -1,6 +1,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -82,6 +83,35 @@ TEST_F(TradingSystemTradingEnginesRepository,
                std::out_of_range);
 }
 
+TEST_F(TradingSystemTradingEnginesRepository,
+       ResolvesEngineBySparseInstrumentId) {
+  add_engine(InstrumentId{1});
+  auto& engine = add_engine(InstrumentId{1'000'000'000});
+
+  ASSERT_THAT(repository.find_instrument_engine(InstrumentId{1'000'000'000}),
+              Ref(engine));
+}
+
+TEST_F(TradingSystemTradingEnginesRepository,
+       ResolvesSparseInstrumentIdCoveredByDenseOnesAddedLater) {
+  auto& engine = add_engine(InstrumentId{5'000});
+  for (std::uint64_t identifier = 1; identifier <= 5'001; ++identifier) {
+    if (identifier != 5'000) {
+      add_engine(InstrumentId{identifier});
+    }
+  }
+
+  ASSERT_THAT(repository.find_instrument_engine(InstrumentId{5'000}),
+              Ref(engine));
+}
+
+TEST_F(TradingSystemTradingEnginesRepository,
+       RejectsToAddEngineWithExistingSparseInstrumentId) {
+  add_engine(InstrumentId{1'000'000'000});
+
+  ASSERT_THROW(add_engine(InstrumentId{1'000'000'000}), std::invalid_argument);
+}
+
 TEST_F(TradingSystemTradingEnginesRepository, IteratesOverAllEngines) {
   auto& engine1 = add_engine(InstrumentId{1});
   auto& engine2 = add_engine(InstrumentId{2});
@@ -16,6 +16,16 @@ class TradingSystemCachedInstrumentResolver : public Test {
     return resolver_->resolve_instrument(descriptor);
   }
 
+  static auto make_descriptor(const char* symbol) -> InstrumentDescriptor {
+    InstrumentDescriptor descriptor;
+    descriptor.symbol = Symbol{symbol};
+    return descriptor;
+  }
+
+  auto resolver() const -> const InstrumentResolver& { return *resolver_; }
+
+  auto cache() -> instrument::Cache& { return cache_; }
+
  private:
   static auto create_instruments_source() -> instrument::MemorySource {
     instrument::MemorySource source;
@@ -86,5 +96,45 @@ TEST_F(TradingSystemCachedInstrumentResolver,
   ASSERT_FALSE(instrument_view.has_value());
 }
 
+TEST_F(TradingSystemCachedInstrumentResolver, MemoizesResolvedDescriptor) {
+  const auto first = resolve(make_descriptor("UNIQUE_SYMBOL"));
+  const auto second = resolve(make_descriptor("UNIQUE_SYMBOL"));
+
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(&first->instrument(), &second->instrument());
+  EXPECT_EQ(resolver().memo_statistics().hits, 1);
+  EXPECT_EQ(resolver().memo_statistics().misses, 1);
+}
+
+TEST_F(TradingSystemCachedInstrumentResolver,
+       IgnoresRequesterInstrumentIdWhenMemoizing) {
+  auto descriptor = make_descriptor("UNIQUE_SYMBOL");
+  ASSERT_TRUE(resolve(descriptor).has_value());
+
+  descriptor.requester_instrument_id = RequesterInstrumentId{42};
+  ASSERT_TRUE(resolve(descriptor).has_value());
+
+  EXPECT_EQ(resolver().memo_statistics().hits, 1);
+}
+
+TEST_F(TradingSystemCachedInstrumentResolver,
+       ResolvesDescriptorAgainAfterInstrumentsReloaded) {
+  ASSERT_TRUE(resolve(make_descriptor("UNIQUE_SYMBOL")).has_value());
+
+  instrument::MemorySource source;
+  cache().load(source.add_instrument([] {
+    Instrument instrument;
+    instrument.symbol = Symbol{"UNIQUE_SYMBOL"};
+    return instrument;
+  }()));
+  const auto instrument_view = resolve(make_descriptor("UNIQUE_SYMBOL"));
+
+  ASSERT_FALSE(instrument_view.has_value());
+  EXPECT_EQ(instrument_view.error(),
+            instrument::LookupError::AmbiguousInstrumentDescriptor);
+  EXPECT_EQ(resolver().memo_statistics().misses, 2);
+}
+
 }  // namespace
 }  // namespace simulator::trading_system::test
\ No newline at end of file
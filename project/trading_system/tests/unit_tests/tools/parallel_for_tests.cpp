@@ -0,0 +1,59 @@
+#include "ih/tools/parallel_for.hpp"
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// NOLINTBEGIN(*-magic-numbers)
+
+TEST(TradingSystemParallelFor, DoesNothingForNoTasks) {
+  MockFunction<void(std::size_t)> task;
+  EXPECT_CALL(task, Call).Times(0);
+
+  parallel_for(0, task.AsStdFunction());
+}
+
+TEST(TradingSystemParallelFor, InvokesTaskForEachIndexOnce) {
+  std::vector<std::atomic<int>> invocations(1000);
+
+  parallel_for(
+      invocations.size(),
+      [&](std::size_t index) { invocations[index].fetch_add(1); },
+      4);
+
+  for (const auto& invoked : invocations) {
+    EXPECT_EQ(invoked.load(), 1);
+  }
+}
+
+TEST(TradingSystemParallelFor, InvokesTasksInOrderWithSingleWorker) {
+  std::vector<std::size_t> indexes;
+
+  parallel_for(
+      3, [&](std::size_t index) { indexes.push_back(index); }, 1);
+
+  EXPECT_THAT(indexes, ElementsAre(0, 1, 2));
+}
+
+TEST(TradingSystemParallelFor, RethrowsTaskException) {
+  const auto task = [](std::size_t index) {
+    if (index == 7) {
+      throw std::runtime_error("task failed");
+    }
+  };
+
+  EXPECT_THROW(parallel_for(100, task, 4), std::runtime_error);
+}
+
+// NOLINTEND(*-magic-numbers)
+
+}  // namespace
+}  // namespace simulator::trading_system::test
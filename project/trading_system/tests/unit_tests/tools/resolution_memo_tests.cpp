@@ -0,0 +1,104 @@
+#include <gmock/gmock.h>
+
+#include <cstdint>
+
+#include "common/instrument.hpp"
+#include "ih/tools/resolution_memo.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+class TradingSystemResolutionMemo : public Test {
+ public:
+  using Result = ResolutionMemo::Result;
+
+  static auto make_descriptor(const char* symbol) -> InstrumentDescriptor {
+    InstrumentDescriptor descriptor;
+    descriptor.symbol = Symbol{symbol};
+    return descriptor;
+  }
+
+  auto resolve(const InstrumentDescriptor& descriptor,
+               std::uint64_t generation = 0) -> Result {
+    return memo.resolve(descriptor, generation, resolver.AsStdFunction());
+  }
+
+  Instrument instrument;
+  ResolutionMemo memo;
+  MockFunction<Result(const InstrumentDescriptor&)> resolver;
+};
+
+TEST_F(TradingSystemResolutionMemo, ResolvesDescriptorOnMiss) {
+  EXPECT_CALL(resolver, Call).WillOnce(Return(Result{instrument}));
+
+  const auto result = resolve(make_descriptor("AAPL"));
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(&result->instrument(), &instrument);
+  EXPECT_EQ(memo.statistics().misses, 1);
+  EXPECT_EQ(memo.statistics().hits, 0);
+}
+
+TEST_F(TradingSystemResolutionMemo, ReturnsMemoizedResultOnHit) {
+  EXPECT_CALL(resolver, Call).WillOnce(Return(Result{instrument}));
+
+  (void)resolve(make_descriptor("AAPL"));
+  const auto result = resolve(make_descriptor("AAPL"));
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(&result->instrument(), &instrument);
+  EXPECT_EQ(memo.statistics().hits, 1);
+}
+
+TEST_F(TradingSystemResolutionMemo, MemoizesLookupErrors) {
+  EXPECT_CALL(resolver, Call)
+      .WillOnce(Return(tl::make_unexpected(
+          instrument::LookupError::InstrumentNotFound)));
+
+  (void)resolve(make_descriptor("AAPL"));
+  const auto result = resolve(make_descriptor("AAPL"));
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), instrument::LookupError::InstrumentNotFound);
+}
+
+TEST_F(TradingSystemResolutionMemo, DistinguishesDescriptors) {
+  EXPECT_CALL(resolver, Call)
+      .Times(2)
+      .WillRepeatedly(Return(Result{instrument}));
+
+  (void)resolve(make_descriptor("AAPL"));
+  (void)resolve(make_descriptor("MSFT"));
+
+  EXPECT_EQ(memo.statistics().misses, 2);
+}
+
+TEST_F(TradingSystemResolutionMemo, ResolvesDescriptorAgainInNewGeneration) {
+  EXPECT_CALL(resolver, Call)
+      .Times(2)
+      .WillRepeatedly(Return(Result{instrument}));
+
+  (void)resolve(make_descriptor("AAPL"), 1);
+  (void)resolve(make_descriptor("AAPL"), 2);
+
+  EXPECT_EQ(memo.statistics().misses, 2);
+  EXPECT_EQ(memo.statistics().hits, 0);
+}
+
+TEST_F(TradingSystemResolutionMemo, IdentifiesDescriptorsByLookupFields) {
+  auto descriptor = make_descriptor("AAPL");
+  auto other = descriptor;
+  other.requester_instrument_id = RequesterInstrumentId{1};
+
+  EXPECT_TRUE(ResolutionMemo::same_identity(descriptor, other));
+  EXPECT_EQ(ResolutionMemo::hash(descriptor), ResolutionMemo::hash(other));
+
+  other.security_exchange = SecurityExchange{"XLON"};
+
+  EXPECT_FALSE(ResolutionMemo::same_identity(descriptor, other));
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test
@@ -0,0 +1,81 @@
+#include "ih/tools/startup_progress.hpp"
+
+#include <gmock/gmock.h>
+
+#include "protocol/admin/startup_progress.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+class TradingSystemStartupProgress : public Test {
+ public:
+  using Stage = StartupProgress::Stage;
+
+  auto report() const -> protocol::StartupProgressReply {
+    protocol::StartupProgressReply reply;
+    progress.report(reply);
+    return reply;
+  }
+
+  StartupProgress progress;
+};
+
+TEST_F(TradingSystemStartupProgress, ReportsInitializingStageInitially) {
+  const auto reply = report();
+
+  EXPECT_EQ(reply.stage, Stage::Initializing);
+  EXPECT_EQ(reply.engines_total, 0);
+}
+
+TEST_F(TradingSystemStartupProgress, CountsConstructedEngines) {
+  progress.begin_construction(2);
+  progress.engine_constructed();
+
+  const auto reply = report();
+
+  EXPECT_EQ(reply.stage, Stage::ConstructingEngines);
+  EXPECT_EQ(reply.engines_total, 2);
+  EXPECT_EQ(reply.engines_constructed, 1);
+}
+
+TEST_F(TradingSystemStartupProgress, CountsRecoveredEngines) {
+  progress.begin_construction(1);
+  progress.engine_constructed();
+  progress.begin_recovery();
+  progress.engine_recovered();
+
+  const auto reply = report();
+
+  EXPECT_EQ(reply.stage, Stage::RecoveringState);
+  EXPECT_EQ(reply.engines_recovered, 1);
+}
+
+TEST_F(TradingSystemStartupProgress, IgnoresEnginesRecoveredAfterStartup) {
+  progress.begin_construction(1);
+  progress.begin_recovery();
+  progress.complete();
+  progress.engine_recovered();
+
+  const auto reply = report();
+
+  EXPECT_EQ(reply.stage, Stage::Ready);
+  EXPECT_EQ(reply.engines_recovered, 0);
+}
+
+TEST_F(TradingSystemStartupProgress, ReportsFailedStartup) {
+  progress.begin_construction(1);
+  progress.fail();
+
+  EXPECT_EQ(report().stage, Stage::Failed);
+}
+
+TEST_F(TradingSystemStartupProgress, FreezesElapsedTimeOnceFinished) {
+  progress.complete();
+
+  EXPECT_EQ(report().elapsed, report().elapsed);
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test
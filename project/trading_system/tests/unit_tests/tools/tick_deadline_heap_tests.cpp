@@ -0,0 +1,100 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+
+#include "common/attributes.hpp"
+#include "common/events.hpp"
+#include "common/tick_scheduler.hpp"
+#include "ih/tools/tick_deadline_heap.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+using namespace std::chrono_literals;
+
+constexpr auto Now = core::sys_us{core::sys_days{2025y / 12 / 30} + 13h};
+
+class TradingSystemTickDeadlineHeap : public Test {
+ public:
+  static auto make_tick(core::sys_us time, bool is_new_day = false)
+      -> event::Tick {
+    return event::Tick{.sys_tick_time = time,
+                       .tz_tick_time = core::tz_us{time.time_since_epoch()},
+                       .is_new_sys_day = is_new_day,
+                       .is_new_tz_day = is_new_day};
+  }
+
+  TickDeadlineHeap heap;
+};
+
+TEST_F(TradingSystemTickDeadlineHeap, TakesNothingWithoutDeadlines) {
+  EXPECT_THAT(heap.take_due(make_tick(Now, /*is_new_day=*/true)), IsEmpty());
+}
+
+TEST_F(TradingSystemTickDeadlineHeap, TakesDeadlinesDueAtTickTime) {
+  heap.schedule(InstrumentId{1}, TickDeadline{.time = Now + 2s});
+  heap.schedule(InstrumentId{2}, TickDeadline{.time = Now});
+  heap.schedule(InstrumentId{3}, TickDeadline{.time = Now + 1s});
+
+  EXPECT_THAT(heap.take_due(make_tick(Now + 1s)),
+              ElementsAre(InstrumentId{2}, InstrumentId{3}));
+  EXPECT_EQ(heap.size(), 1);
+}
+
+TEST_F(TradingSystemTickDeadlineHeap, TakesNewDayDeadlinesOnNewDay) {
+  heap.schedule(InstrumentId{1}, TickDeadline{.new_day = true});
+  heap.schedule(InstrumentId{2}, TickDeadline{.time = Now + 1h});
+
+  EXPECT_THAT(heap.take_due(make_tick(Now)), IsEmpty());
+  EXPECT_THAT(heap.take_due(make_tick(Now, /*is_new_day=*/true)),
+              ElementsAre(InstrumentId{1}));
+}
+
+TEST_F(TradingSystemTickDeadlineHeap, TakesEachInstrumentOnce) {
+  heap.schedule(InstrumentId{1},
+                TickDeadline{.time = Now, .new_day = true});
+
+  EXPECT_THAT(heap.take_due(make_tick(Now, /*is_new_day=*/true)),
+              ElementsAre(InstrumentId{1}));
+  EXPECT_THAT(heap.take_due(make_tick(Now, /*is_new_day=*/true)), IsEmpty());
+}
+
+TEST_F(TradingSystemTickDeadlineHeap, SchedulesEarliestOfMergedDeadlines) {
+  heap.schedule(InstrumentId{1}, TickDeadline{.time = Now + 2s});
+  heap.schedule(InstrumentId{1}, TickDeadline{.time = Now + 1s});
+
+  EXPECT_THAT(heap.take_due(make_tick(Now + 1s)),
+              ElementsAre(InstrumentId{1}));
+}
+
+TEST_F(TradingSystemTickDeadlineHeap, ReplacesRescheduledDeadline) {
+  heap.schedule(InstrumentId{1}, TickDeadline{.time = Now});
+  heap.reschedule(InstrumentId{1}, TickDeadline{.time = Now + 1s});
+
+  EXPECT_THAT(heap.take_due(make_tick(Now)), IsEmpty());
+  EXPECT_THAT(heap.take_due(make_tick(Now + 1s)),
+              ElementsAre(InstrumentId{1}));
+}
+
+TEST_F(TradingSystemTickDeadlineHeap, RemovesDeadlineRescheduledToNothing) {
+  heap.schedule(InstrumentId{1}, TickDeadline{.time = Now});
+  heap.reschedule(InstrumentId{1}, std::nullopt);
+
+  EXPECT_EQ(heap.size(), 0);
+  EXPECT_THAT(heap.take_due(make_tick(Now)), IsEmpty());
+}
+
+TEST_F(TradingSystemTickDeadlineHeap, KeepsDeadlinesAcrossCompaction) {
+  for (int round = 0; round < 100; ++round) {
+    heap.reschedule(InstrumentId{1},
+                    TickDeadline{.time = Now + std::chrono::seconds{round}});
+  }
+  heap.schedule(InstrumentId{2}, TickDeadline{.time = Now});
+
+  EXPECT_THAT(heap.take_due(make_tick(Now + 99s)),
+              ElementsAre(InstrumentId{2}, InstrumentId{1}));
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test
@@ -0,0 +1,123 @@
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cfg/api/cfg.hpp"
+#include "cfg/api/venue_scope.hpp"
+#include "ih/tools/venue_executor.hpp"
+#include "runtime/service.hpp"
+#include "runtime/thread_pool.hpp"
+
+namespace simulator::trading_system::test {
+namespace {
+
+using namespace ::testing;  // NOLINT
+
+// Keeps submitted tasks to be run by a test
+struct DeferredService : public runtime::Service {
+  auto execute(std::function<void()> task) -> void override {
+    tasks.push_back(std::move(task));
+  }
+
+  std::vector<std::function<void()>> tasks;
+};
+
+class TradingSystemVenueExecutor : public Test {
+ public:
+  auto make_venue(std::size_t index) -> cfg::HostedVenueConfiguration {
+    cfg::HostedVenueConfiguration venue;
+    venue.venue.name = "XLON";
+    venue.index = index;
+    return venue;
+  }
+
+  // Is declared before the pool, as pool tasks may wait for it
+  // until the pool threads are joined
+  std::atomic<bool> release = false;
+  runtime::ThreadPool shared_pool =
+      runtime::ThreadPool::create_simple_thread_pool(2);
+};
+
+TEST_F(TradingSystemVenueExecutor, RunsTasksBoundToVenue) {
+  const auto venue = make_venue(1);
+  std::atomic<const cfg::HostedVenueConfiguration*> bound = nullptr;
+
+  {
+    const cfg::VenueScope scope{&venue};
+    VenueExecutor executor{shared_pool};
+    executor.execute([&] { bound = cfg::current_venue(); });
+    executor.await();
+  }
+
+  EXPECT_EQ(bound.load(), &venue);
+}
+
+TEST_F(TradingSystemVenueExecutor, AwaitsTasksSubmittedByTasks) {
+  VenueExecutor executor{shared_pool};
+  std::atomic<int> done = 0;
+
+  executor.execute([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    executor.execute([&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      ++done;
+    });
+    ++done;
+  });
+  executor.await();
+
+  EXPECT_EQ(done.load(), 2);
+}
+
+TEST_F(TradingSystemVenueExecutor, AwaitsOwnTasksOnly) {
+  shared_pool.execute([&] {
+    while (!release) {
+      std::this_thread::yield();
+    }
+  });
+
+  VenueExecutor executor{shared_pool};
+  std::atomic<bool> done = false;
+  executor.execute([&] { done = true; });
+  executor.await();
+
+  EXPECT_TRUE(done);
+  release = true;
+}
+
+TEST_F(TradingSystemVenueExecutor, ChargesTaskDurationToVenue) {
+  const auto venue = make_venue(2);
+  const auto charged_before = cfg::venue_cpu_time(venue);
+
+  {
+    const cfg::VenueScope scope{&venue};
+    VenueExecutor executor{shared_pool};
+    executor.execute(
+        [] { std::this_thread::sleep_for(std::chrono::milliseconds{20}); });
+    executor.await();
+  }
+
+  EXPECT_GE(cfg::venue_cpu_time(venue) - charged_before,
+            std::chrono::milliseconds{20});
+}
+
+TEST_F(TradingSystemVenueExecutor, AwaitsTaskThrowing) {
+  DeferredService deferred;
+  VenueExecutor executor{deferred};
+  executor.execute([] { throw std::runtime_error{"task failed"}; });
+
+  ASSERT_EQ(deferred.tasks.size(), 1);
+  EXPECT_THROW(deferred.tasks.front()(), std::runtime_error);
+
+  executor.await();
+}
+
+}  // namespace
+}  // namespace simulator::trading_system::test